@@ -0,0 +1,134 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+#include <stdlib.h>
+#include <chrono>
+#include <functional>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ze_api.h"
+
+#if defined(_WIN32)
+    #define putenv_safe _putenv
+#else
+    #define putenv_safe putenv
+#endif
+
+#define BENCH_CHECK( call )                                                     \
+    do {                                                                        \
+        ze_result_t bench_result = ( call );                                    \
+        if( ZE_RESULT_SUCCESS != bench_result ) {                               \
+            std::cerr << #call << " failed with " << std::hex << bench_result   \
+                      << std::dec << std::endl;                                 \
+            exit( 1 );                                                          \
+        }                                                                       \
+    } while( 0 )
+
+namespace bench
+{
+    //////////////////////////////////////////////////////////////////////////
+    inline bool argparse( int argc, char *argv[], const char *shortName, const char *longName )
+    {
+        for( int i = 1; i < argc; ++i )
+        {
+            if( ( 0 == strcmp( argv[ i ], shortName ) ) || ( 0 == strcmp( argv[ i ], longName ) ) )
+                return true;
+        }
+        return false;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    inline uint64_t argvalue( int argc, char *argv[], const char *name, uint64_t defaultValue )
+    {
+        for( int i = 1; i + 1 < argc; ++i )
+        {
+            if( 0 == strcmp( argv[ i ], name ) )
+                return strtoull( argv[ i + 1 ], nullptr, 10 );
+        }
+        return defaultValue;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// wall-clock nanoseconds spent running f() iterations times
+    template<typename _func_t>
+    double time_ns( uint64_t iterations, _func_t&& f )
+    {
+        auto start = std::chrono::steady_clock::now();
+        for( uint64_t i = 0; i < iterations; ++i )
+            f();
+        auto end = std::chrono::steady_clock::now();
+        return static_cast<double>( std::chrono::duration_cast<std::chrono::nanoseconds>( end - start ).count() );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// objects of the null driver shared by the benchmarks
+    struct null_env_t
+    {
+        ze_driver_handle_t driver = nullptr;
+        ze_device_handle_t device = nullptr;
+        ze_context_handle_t context = nullptr;
+        ze_command_list_handle_t commandList = nullptr;
+        ze_module_handle_t module = nullptr;
+        ze_kernel_handle_t kernel = nullptr;
+        ze_event_pool_handle_t eventPool = nullptr;
+        std::vector<ze_event_handle_t> events;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// zeInit against the null driver and create the objects the benchmarks use
+    inline void null_env_create( null_env_t &env, uint32_t numEvents )
+    {
+        putenv_safe( const_cast<char *>( "ZE_ENABLE_NULL_DRIVER=1" ) );
+        BENCH_CHECK( zeInit( 0 ) );
+
+        uint32_t count = 1;
+        BENCH_CHECK( zeDriverGet( &count, &env.driver ) );
+        count = 1;
+        BENCH_CHECK( zeDeviceGet( env.driver, &count, &env.device ) );
+
+        ze_context_desc_t contextDesc = { ZE_STRUCTURE_TYPE_CONTEXT_DESC };
+        BENCH_CHECK( zeContextCreate( env.driver, &contextDesc, &env.context ) );
+
+        ze_command_list_desc_t commandListDesc = { ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC };
+        BENCH_CHECK( zeCommandListCreate( env.context, env.device, &commandListDesc, &env.commandList ) );
+
+        ze_module_desc_t moduleDesc = { ZE_STRUCTURE_TYPE_MODULE_DESC };
+        BENCH_CHECK( zeModuleCreate( env.context, env.device, &moduleDesc, &env.module, nullptr ) );
+
+        ze_kernel_desc_t kernelDesc = { ZE_STRUCTURE_TYPE_KERNEL_DESC };
+        kernelDesc.pKernelName = "bench";
+        BENCH_CHECK( zeKernelCreate( env.module, &kernelDesc, &env.kernel ) );
+
+        ze_event_pool_desc_t eventPoolDesc = { ZE_STRUCTURE_TYPE_EVENT_POOL_DESC };
+        eventPoolDesc.count = numEvents;
+        BENCH_CHECK( zeEventPoolCreate( env.context, &eventPoolDesc, 1, &env.device, &env.eventPool ) );
+
+        env.events.resize( numEvents );
+        for( uint32_t i = 0; i < numEvents; ++i )
+        {
+            ze_event_desc_t eventDesc = { ZE_STRUCTURE_TYPE_EVENT_DESC };
+            eventDesc.index = i;
+            BENCH_CHECK( zeEventCreate( env.eventPool, &eventDesc, &env.events[ i ] ) );
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    inline void null_env_destroy( null_env_t &env )
+    {
+        for( auto event : env.events )
+            zeEventDestroy( event );
+        zeEventPoolDestroy( env.eventPool );
+        zeKernelDestroy( env.kernel );
+        zeModuleDestroy( env.module );
+        zeCommandListDestroy( env.commandList );
+        zeContextDestroy( env.context );
+    }
+} // namespace bench
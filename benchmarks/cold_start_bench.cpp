@@ -0,0 +1,117 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <unistd.h>
+
+#include "bench_common.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Measures how long the first zeInit of a process takes, with several
+/// copies of the null driver standing in for installed drivers.
+/// Loader initialization only happens once per process, so every sample is
+/// taken by a fresh child process running this binary with --child.
+/// ZEL_TEST_NULL_DRIVER_INIT_DELAY_MS gives each copy a first-init cost, and
+/// ZEL_LOADER_INIT_THREADS selects how many threads the loader uses.
+
+//////////////////////////////////////////////////////////////////////////
+static int run_child()
+{
+    auto start = std::chrono::steady_clock::now();
+    BENCH_CHECK( zeInit( 0 ) );
+    uint32_t count = 0;
+    BENCH_CHECK( zeDriverGet( &count, nullptr ) );
+    auto end = std::chrono::steady_clock::now();
+
+    printf( "%u %lld\n", count,
+        static_cast<long long>( std::chrono::duration_cast<std::chrono::nanoseconds>( end - start ).count() ) );
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+static bool copy_file( const std::string& from, const std::string& to )
+{
+    std::ifstream in( from, std::ios::binary );
+    std::ofstream out( to, std::ios::binary );
+    out << in.rdbuf();
+    return in.good() && out.good();
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// run the child once and return its time to first zeInit in microseconds
+static double sample( const std::string& self, uint32_t expectedDrivers )
+{
+    std::string command = "\"" + self + "\" --child";
+    FILE* pipe = popen( command.c_str(), "r" );
+    if( nullptr == pipe )
+    {
+        std::cerr << "failed to start " << self << std::endl;
+        exit( 1 );
+    }
+    unsigned count = 0;
+    long long ns = 0;
+    int fields = fscanf( pipe, "%u %lld", &count, &ns );
+    if( ( 0 != pclose( pipe ) ) || ( 2 != fields ) || ( count != expectedDrivers ) )
+    {
+        std::cerr << "child run failed, found " << count << " of " << expectedDrivers << " drivers" << std::endl;
+        exit( 1 );
+    }
+    return ns / 1000.0;
+}
+
+int main( int argc, char *argv[] )
+{
+    if( bench::argparse( argc, argv, "-c", "--child" ) )
+        return run_child();
+
+    const uint32_t numDrivers = std::max<uint32_t>( 1, static_cast<uint32_t>( bench::argvalue( argc, argv, "--drivers", 4 ) ) );
+    const uint64_t delayMs = bench::argvalue( argc, argv, "--delay_ms", 20 );
+    const uint64_t runs = std::max<uint64_t>( 1, bench::argvalue( argc, argv, "--runs", 5 ) );
+
+    char dir[] = "/tmp/ze_cold_start_XXXXXX";
+    if( nullptr == mkdtemp( dir ) )
+    {
+        std::cerr << "failed to create a directory for the driver copies" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> copies;
+    std::string altDrivers;
+    for( uint32_t i = 0; i < numDrivers; ++i )
+    {
+        copies.push_back( std::string( dir ) + "/libze_null_copy" + std::to_string( i ) + ".so" );
+        if( !copy_file( NULL_DRIVER_PATH, copies.back() ) )
+        {
+            std::cerr << "failed to copy " << NULL_DRIVER_PATH << std::endl;
+            return 1;
+        }
+        altDrivers += ( i ? "," : "" ) + copies.back();
+    }
+    setenv( "ZE_ENABLE_ALT_DRIVERS", altDrivers.c_str(), 1 );
+    setenv( "ZEL_TEST_NULL_DRIVER_INIT_DELAY_MS", std::to_string( delayMs ).c_str(), 1 );
+
+    printf( "%-8s %10s %14s %14s\n", "drivers", "threads", "median us", "min us" );
+    for( uint32_t threads : { 1u, numDrivers } )
+    {
+        setenv( "ZEL_LOADER_INIT_THREADS", std::to_string( threads ).c_str(), 1 );
+
+        std::vector<double> samples;
+        for( uint64_t run = 0; run < runs; ++run )
+            samples.push_back( sample( argv[ 0 ], numDrivers ) );
+        std::sort( samples.begin(), samples.end() );
+        printf( "%-8u %10u %14.1f %14.1f\n", numDrivers, threads, samples[ samples.size() / 2 ], samples.front() );
+        if( 1 == numDrivers )
+            break;
+    }
+
+    for( auto& copy : copies )
+        unlink( copy.c_str() );
+    rmdir( dir );
+    return 0;
+}
@@ -0,0 +1,398 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include <atomic>
+#include <cstdio>
+#include <dlfcn.h>
+#include <map>
+#include <thread>
+#include <unistd.h>
+
+#include "bench_common.h"
+#include "ze_ddi.h"
+#include "zes_api.h"
+#include "zes_ddi.h"
+#include "layers/zel_tracing_api.h"
+#include "layers/zel_tracing_register_cb.h"
+#include "loader/ze_loader.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Measures the cost of a call to each of a set of hot APIs, per thread
+/// count, in each dispatch configuration:
+///   direct       the null driver's DDIs called directly
+///   pass         the loader passing calls through
+///   intercept    the loader intercepting calls
+///   valid        the validation layer validating parameters
+///   valid+icpt   the same with the loader intercepting calls
+///   valid-hl     the validation layer tracking handle lifetimes
+///   valid-mt     the validation layer's memory tracker
+///   valid-thr    the validation layer's threading validation
+///   trace-off    the tracing layer loaded without a tracer
+///   trace-on     an enabled tracer
+///   trace-samp   a tracer sampling one call in 100
+///   trace-async  a tracer deferring its epilogues to the worker thread
+///   trace-thr    tracing enabled for the main thread only
+///   trace-rec    every call recorded with ZEL_TRACE_RECORD
+///   trace-stat   every call counted with ZEL_ENABLE_API_STATS
+/// Each thread has its own command list and kernel, which the APIs do not
+/// allow threads to share. Loader and layer setup only happens once per
+/// process, so each configuration runs in a child process started with
+/// --child <configuration>.
+
+//////////////////////////////////////////////////////////////////////////
+/// environment of each configuration, as names set to 1 or name=value;
+/// the variables of the other configurations are cleared
+struct config_t
+{
+    const char* name;
+    std::vector<const char*> env;
+};
+
+static const char* configEnvNames[] = {
+    "ZE_ENABLE_NULL_DRIVER",
+    "ZE_ENABLE_LOADER_INTERCEPT",
+    "ZE_ENABLE_VALIDATION_LAYER",
+    "ZE_ENABLE_PARAMETER_VALIDATION",
+    "ZE_ENABLE_HANDLE_LIFETIME",
+    "ZE_ENABLE_MEMORY_TRACKER",
+    "ZE_ENABLE_THREADING_VALIDATION",
+    "ZE_ENABLE_TRACING_LAYER",
+    "ZEL_TRACE_RECORD",
+    "ZEL_ENABLE_API_STATS",
+    "ZEL_TRACING_SAMPLE_EVERY",
+};
+
+#define TRACE_RECORD_FILE "/tmp/ze_dispatch_bench_trace.bin"
+
+static const config_t configs[] = {
+    { "direct", {} },
+    { "pass", { "ZE_ENABLE_NULL_DRIVER" } },
+    { "intercept", { "ZE_ENABLE_NULL_DRIVER", "ZE_ENABLE_LOADER_INTERCEPT" } },
+    { "valid", { "ZE_ENABLE_NULL_DRIVER", "ZE_ENABLE_VALIDATION_LAYER", "ZE_ENABLE_PARAMETER_VALIDATION" } },
+    { "valid+icpt", { "ZE_ENABLE_NULL_DRIVER", "ZE_ENABLE_LOADER_INTERCEPT", "ZE_ENABLE_VALIDATION_LAYER", "ZE_ENABLE_PARAMETER_VALIDATION" } },
+    { "valid-hl", { "ZE_ENABLE_NULL_DRIVER", "ZE_ENABLE_VALIDATION_LAYER", "ZE_ENABLE_HANDLE_LIFETIME" } },
+    { "valid-mt", { "ZE_ENABLE_NULL_DRIVER", "ZE_ENABLE_VALIDATION_LAYER", "ZE_ENABLE_MEMORY_TRACKER" } },
+    { "valid-thr", { "ZE_ENABLE_NULL_DRIVER", "ZE_ENABLE_VALIDATION_LAYER", "ZE_ENABLE_THREADING_VALIDATION" } },
+    { "trace-off", { "ZE_ENABLE_NULL_DRIVER", "ZE_ENABLE_TRACING_LAYER" } },
+    { "trace-on", { "ZE_ENABLE_NULL_DRIVER", "ZE_ENABLE_TRACING_LAYER" } },
+    { "trace-samp", { "ZE_ENABLE_NULL_DRIVER", "ZE_ENABLE_TRACING_LAYER", "ZEL_TRACING_SAMPLE_EVERY=100" } },
+    { "trace-async", { "ZE_ENABLE_NULL_DRIVER", "ZE_ENABLE_TRACING_LAYER" } },
+    { "trace-thr", { "ZE_ENABLE_NULL_DRIVER" } },
+    { "trace-rec", { "ZE_ENABLE_NULL_DRIVER", "ZEL_TRACE_RECORD=" TRACE_RECORD_FILE } },
+    { "trace-stat", { "ZE_ENABLE_NULL_DRIVER", "ZEL_ENABLE_API_STATS" } },
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// the functions the benchmark calls, either the loader's exports or the
+/// null driver's DDIs
+struct api_t
+{
+    ze_dditable_t ze = {};
+    zes_dditable_t zes = {};
+};
+
+//////////////////////////////////////////////////////////////////////////
+static void api_init_loader( api_t& api )
+{
+    api.ze.Global.pfnInit = zeInit;
+    api.ze.Driver.pfnGet = zeDriverGet;
+    api.ze.Device.pfnGet = zeDeviceGet;
+    api.ze.Context.pfnCreate = zeContextCreate;
+    api.ze.Context.pfnDestroy = zeContextDestroy;
+    api.ze.CommandList.pfnCreate = zeCommandListCreate;
+    api.ze.CommandList.pfnDestroy = zeCommandListDestroy;
+    api.ze.CommandList.pfnAppendLaunchKernel = zeCommandListAppendLaunchKernel;
+    api.ze.Module.pfnCreate = zeModuleCreate;
+    api.ze.Module.pfnDestroy = zeModuleDestroy;
+    api.ze.Kernel.pfnCreate = zeKernelCreate;
+    api.ze.Kernel.pfnDestroy = zeKernelDestroy;
+    api.ze.Kernel.pfnSetArgumentValue = zeKernelSetArgumentValue;
+    api.ze.EventPool.pfnCreate = zeEventPoolCreate;
+    api.ze.EventPool.pfnDestroy = zeEventPoolDestroy;
+    api.ze.Event.pfnCreate = zeEventCreate;
+    api.ze.Event.pfnDestroy = zeEventDestroy;
+    api.ze.Event.pfnHostSynchronize = zeEventHostSynchronize;
+    api.ze.Mem.pfnAllocDevice = zeMemAllocDevice;
+    api.ze.Mem.pfnFree = zeMemFree;
+    api.zes.Global.pfnInit = zesInit;
+    api.zes.Driver.pfnGet = zesDriverGet;
+    api.zes.Device.pfnGet = zesDeviceGet;
+    api.zes.Device.pfnEnumPowerDomains = zesDeviceEnumPowerDomains;
+    api.zes.Power.pfnGetEnergyCounter = zesPowerGetEnergyCounter;
+}
+
+//////////////////////////////////////////////////////////////////////////
+template<typename _table_t>
+static void get_table( void* library, const char* name, _table_t* table )
+{
+    typedef ze_result_t (ZE_APICALL *getTable_t)( ze_api_version_t, _table_t* );
+    auto getTable = reinterpret_cast<getTable_t>( dlsym( library, name ) );
+    if( nullptr == getTable )
+    {
+        std::cerr << "null driver does not export " << name << std::endl;
+        exit( 1 );
+    }
+    BENCH_CHECK( getTable( ZE_API_VERSION_CURRENT, table ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void api_init_direct( api_t& api )
+{
+    void* library = dlopen( NULL_DRIVER_PATH, RTLD_LAZY | RTLD_LOCAL );
+    if( nullptr == library )
+    {
+        std::cerr << "failed to load " << NULL_DRIVER_PATH << std::endl;
+        exit( 1 );
+    }
+    get_table( library, "zeGetGlobalProcAddrTable", &api.ze.Global );
+    get_table( library, "zeGetDriverProcAddrTable", &api.ze.Driver );
+    get_table( library, "zeGetDeviceProcAddrTable", &api.ze.Device );
+    get_table( library, "zeGetContextProcAddrTable", &api.ze.Context );
+    get_table( library, "zeGetCommandListProcAddrTable", &api.ze.CommandList );
+    get_table( library, "zeGetModuleProcAddrTable", &api.ze.Module );
+    get_table( library, "zeGetKernelProcAddrTable", &api.ze.Kernel );
+    get_table( library, "zeGetEventPoolProcAddrTable", &api.ze.EventPool );
+    get_table( library, "zeGetEventProcAddrTable", &api.ze.Event );
+    get_table( library, "zeGetMemProcAddrTable", &api.ze.Mem );
+    get_table( library, "zesGetGlobalProcAddrTable", &api.zes.Global );
+    get_table( library, "zesGetDriverProcAddrTable", &api.zes.Driver );
+    get_table( library, "zesGetDeviceProcAddrTable", &api.zes.Device );
+    get_table( library, "zesGetPowerProcAddrTable", &api.zes.Power );
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// no-op callback for every traced API
+template<typename _params_t>
+static void ZE_APICALL trace_cb( _params_t*, ze_result_t, void*, void** )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void enable_tracer( bool asyncEpilogues = false )
+{
+    static int userData = 0;
+    zel_tracer_async_desc_t async = { ZEL_STRUCTURE_TYPE_TRACER_ASYNC_DESC, nullptr, ZEL_TRACER_ASYNC_FLAG_EPILOGUES };
+    zel_tracer_desc_t desc = { ZEL_STRUCTURE_TYPE_TRACER_DESC, asyncEpilogues ? &async : nullptr, &userData };
+    zel_tracer_handle_t tracer = nullptr;
+    BENCH_CHECK( zelTracerCreate( &desc, &tracer ) );
+    for( auto type : { ZEL_REGISTER_PROLOGUE, ZEL_REGISTER_EPILOGUE } )
+    {
+        BENCH_CHECK( zelTracerCommandListAppendLaunchKernelRegisterCallback( tracer, type, trace_cb ) );
+        BENCH_CHECK( zelTracerKernelSetArgumentValueRegisterCallback( tracer, type, trace_cb ) );
+        BENCH_CHECK( zelTracerEventHostSynchronizeRegisterCallback( tracer, type, trace_cb ) );
+        BENCH_CHECK( zelTracerMemAllocDeviceRegisterCallback( tracer, type, trace_cb ) );
+        BENCH_CHECK( zelTracerMemFreeRegisterCallback( tracer, type, trace_cb ) );
+    }
+    BENCH_CHECK( zelTracerSetEnabled( tracer, true ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// measure every API at every thread count and print one line per result
+static int run_child( const std::string& config, uint64_t iterations, uint32_t maxThreads )
+{
+    api_t api;
+    if( "direct" == config )
+        api_init_direct( api );
+    else
+        api_init_loader( api );
+
+    BENCH_CHECK( api.ze.Global.pfnInit( 0 ) );
+    BENCH_CHECK( api.zes.Global.pfnInit( 0 ) );
+    if( "trace-on" == config || "trace-samp" == config )
+        enable_tracer();
+    if( "trace-async" == config )
+        enable_tracer( true );
+    // the measured calls are made on other threads
+    if( "trace-thr" == config )
+    {
+        enable_tracer();
+        BENCH_CHECK( zelEnableTracingLayerForThread() );
+    }
+
+    ze_driver_handle_t driver = nullptr;
+    ze_device_handle_t device = nullptr;
+    uint32_t count = 1;
+    BENCH_CHECK( api.ze.Driver.pfnGet( &count, &driver ) );
+    count = 1;
+    BENCH_CHECK( api.ze.Device.pfnGet( driver, &count, &device ) );
+
+    ze_context_desc_t contextDesc = { ZE_STRUCTURE_TYPE_CONTEXT_DESC };
+    ze_context_handle_t context = nullptr;
+    BENCH_CHECK( api.ze.Context.pfnCreate( driver, &contextDesc, &context ) );
+    ze_command_list_desc_t commandListDesc = { ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC };
+    std::vector<ze_command_list_handle_t> commandLists( maxThreads );
+    for( auto& commandList : commandLists )
+        BENCH_CHECK( api.ze.CommandList.pfnCreate( context, device, &commandListDesc, &commandList ) );
+    // enough of a module for parameter validation to accept it
+    static const uint8_t moduleIl[ 4 ] = {};
+    ze_module_desc_t moduleDesc = { ZE_STRUCTURE_TYPE_MODULE_DESC };
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.inputSize = sizeof( moduleIl );
+    moduleDesc.pInputModule = moduleIl;
+    ze_module_handle_t module = nullptr;
+    BENCH_CHECK( api.ze.Module.pfnCreate( context, device, &moduleDesc, &module, nullptr ) );
+    ze_kernel_desc_t kernelDesc = { ZE_STRUCTURE_TYPE_KERNEL_DESC };
+    kernelDesc.pKernelName = "bench";
+    std::vector<ze_kernel_handle_t> kernels( maxThreads );
+    for( auto& kernel : kernels )
+        BENCH_CHECK( api.ze.Kernel.pfnCreate( module, &kernelDesc, &kernel ) );
+    ze_event_pool_desc_t eventPoolDesc = { ZE_STRUCTURE_TYPE_EVENT_POOL_DESC };
+    eventPoolDesc.count = 1;
+    ze_event_pool_handle_t eventPool = nullptr;
+    BENCH_CHECK( api.ze.EventPool.pfnCreate( context, &eventPoolDesc, 1, &device, &eventPool ) );
+    ze_event_desc_t eventDesc = { ZE_STRUCTURE_TYPE_EVENT_DESC };
+    ze_event_handle_t event = nullptr;
+    BENCH_CHECK( api.ze.Event.pfnCreate( eventPool, &eventDesc, &event ) );
+
+    zes_driver_handle_t sysmanDriver = nullptr;
+    zes_device_handle_t sysmanDevice = nullptr;
+    zes_pwr_handle_t power = nullptr;
+    count = 1;
+    BENCH_CHECK( api.zes.Driver.pfnGet( &count, &sysmanDriver ) );
+    count = 1;
+    BENCH_CHECK( api.zes.Device.pfnGet( sysmanDriver, &count, &sysmanDevice ) );
+    count = 1;
+    BENCH_CHECK( api.zes.Device.pfnEnumPowerDomains( sysmanDevice, &count, &power ) );
+
+    ze_group_count_t groupCount = { 1, 1, 1 };
+    uint64_t argValue = 0;
+    // each case is called with the index of the calling thread
+    struct { const char* name; std::function<void( uint32_t )> call; } cases[] = {
+        { "zeCommandListAppendLaunchKernel", [&]( uint32_t t ) {
+            api.ze.CommandList.pfnAppendLaunchKernel( commandLists[ t ], kernels[ t ], &groupCount, nullptr, 0, nullptr );
+        } },
+        { "zeKernelSetArgumentValue", [&]( uint32_t t ) {
+            api.ze.Kernel.pfnSetArgumentValue( kernels[ t ], 0, sizeof( argValue ), &argValue );
+        } },
+        { "zeEventHostSynchronize", [&]( uint32_t ) {
+            api.ze.Event.pfnHostSynchronize( event, 0 );
+        } },
+        { "zeEventCreate+zeEventDestroy", [&]( uint32_t ) {
+            ze_event_handle_t newEvent = nullptr;
+            api.ze.Event.pfnCreate( eventPool, &eventDesc, &newEvent );
+            api.ze.Event.pfnDestroy( newEvent );
+        } },
+        { "zeMemAllocDevice+zeMemFree", [&]( uint32_t ) {
+            ze_device_mem_alloc_desc_t allocDesc = { ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC };
+            void* ptr = nullptr;
+            api.ze.Mem.pfnAllocDevice( context, &allocDesc, 64, 64, device, &ptr );
+            api.ze.Mem.pfnFree( context, ptr );
+        } },
+        { "zesPowerGetEnergyCounter", [&]( uint32_t ) {
+            zes_power_energy_counter_t energy = {};
+            api.zes.Power.pfnGetEnergyCounter( power, &energy );
+        } },
+    };
+
+    for( auto& c : cases )
+    {
+        for( uint32_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2 )
+        {
+            std::atomic<uint32_t> ready{ 0 };
+            std::atomic<bool> go{ false };
+            std::vector<double> threadNs( numThreads );
+            std::vector<std::thread> threads;
+            for( uint32_t t = 0; t < numThreads; ++t )
+            {
+                threads.emplace_back( [&, t]() {
+                    ++ready;
+                    while( !go.load() )
+                        std::this_thread::yield();
+                    threadNs[ t ] = bench::time_ns( iterations, [&]() { c.call( t ); } );
+                } );
+            }
+            while( ready.load() != numThreads )
+                std::this_thread::yield();
+            go = true;
+            for( auto& thread : threads )
+                thread.join();
+
+            double avgNs = 0.0;
+            for( auto ns : threadNs )
+                avgNs += ns / iterations;
+            printf( "%s %u %.1f\n", c.name, numThreads, avgNs / numThreads );
+        }
+    }
+
+    api.ze.Event.pfnDestroy( event );
+    api.ze.EventPool.pfnDestroy( eventPool );
+    for( auto kernel : kernels )
+        api.ze.Kernel.pfnDestroy( kernel );
+    api.ze.Module.pfnDestroy( module );
+    for( auto commandList : commandLists )
+        api.ze.CommandList.pfnDestroy( commandList );
+    api.ze.Context.pfnDestroy( context );
+    return 0;
+}
+
+int main( int argc, char *argv[] )
+{
+    const uint64_t iterations = std::max<uint64_t>( 1, bench::argvalue( argc, argv, "--iterations", 200000 ) );
+    const uint32_t maxThreads = std::max<uint32_t>( 1, static_cast<uint32_t>( bench::argvalue( argc, argv, "--max_threads", 8 ) ) );
+
+    for( int i = 1; i + 1 < argc; ++i )
+    {
+        if( 0 == strcmp( argv[ i ], "--child" ) )
+            return run_child( argv[ i + 1 ], iterations, maxThreads );
+    }
+
+    // ns/call of each api and thread count, per configuration
+    std::vector<std::pair<std::string, uint32_t>> rows;
+    std::map<std::pair<std::string, uint32_t>, std::map<std::string, double>> results;
+    for( auto& config : configs )
+    {
+        for( auto name : configEnvNames )
+            unsetenv( name );
+        for( std::string name : config.env )
+        {
+            auto separator = name.find( '=' );
+            if( std::string::npos == separator )
+                setenv( name.c_str(), "1", 1 );
+            else
+                setenv( name.substr( 0, separator ).c_str(), name.substr( separator + 1 ).c_str(), 1 );
+        }
+
+        std::string command = "\"" + std::string( argv[ 0 ] ) + "\" --child " + config.name +
+            " --iterations " + std::to_string( iterations ) + " --max_threads " + std::to_string( maxThreads );
+        FILE* pipe = popen( command.c_str(), "r" );
+        if( nullptr == pipe )
+        {
+            std::cerr << "failed to start " << argv[ 0 ] << std::endl;
+            return 1;
+        }
+        char api[ 128 ];
+        unsigned threads = 0;
+        double ns = 0.0;
+        while( 3 == fscanf( pipe, "%127s %u %lf", api, &threads, &ns ) )
+        {
+            auto row = std::make_pair( std::string( api ), static_cast<uint32_t>( threads ) );
+            if( results.end() == results.find( row ) )
+                rows.push_back( row );
+            results[ row ][ config.name ] = ns;
+        }
+        if( 0 != pclose( pipe ) )
+        {
+            std::cerr << "configuration " << config.name << " failed" << std::endl;
+            return 1;
+        }
+    }
+
+    unlink( TRACE_RECORD_FILE );
+
+    printf( "ns/call %-26s %8s", "api", "threads" );
+    for( auto& config : configs )
+        printf( " %11s", config.name );
+    printf( "\n" );
+    for( auto& row : rows )
+    {
+        printf( "%-34s %8u", row.first.c_str(), row.second );
+        for( auto& config : configs )
+            printf( " %11.1f", results[ row ][ config.name ] );
+        printf( "\n" );
+    }
+    return 0;
+}
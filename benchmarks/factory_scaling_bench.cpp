@@ -0,0 +1,93 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+#include "bench_common.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Measures how creation and destruction of loader handles scales with the
+/// number of threads. Every create/destroy pair inserts into and erases from
+/// the loader's handle factories, so with intercepts forced on this exercises
+/// the factory locking directly.
+int main( int argc, char *argv[] )
+{
+    if( !bench::argparse( argc, argv, "-pass", "--pass_through" ) )
+        putenv_safe( const_cast<char *>( "ZE_ENABLE_LOADER_INTERCEPT=1" ) );
+    const uint64_t iterations = bench::argvalue( argc, argv, "--iterations", 200000 );
+    const uint32_t maxThreads = static_cast<uint32_t>( bench::argvalue( argc, argv, "--max_threads", 64 ) );
+
+    bench::null_env_t env;
+    bench::null_env_create( env, 1 );
+
+    auto eventChurn = [&]() {
+        ze_event_desc_t eventDesc = { ZE_STRUCTURE_TYPE_EVENT_DESC };
+        ze_event_handle_t event = nullptr;
+        zeEventCreate( env.eventPool, &eventDesc, &event );
+        zeEventDestroy( event );
+    };
+    auto commandListChurn = [&]() {
+        ze_command_list_desc_t commandListDesc = { ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC };
+        ze_command_list_handle_t commandList = nullptr;
+        zeCommandListCreate( env.context, env.device, &commandListDesc, &commandList );
+        zeCommandListDestroy( commandList );
+    };
+    auto deviceLookup = [&]() {
+        // existing handle: answered from the enumeration cache
+        uint32_t count = 1;
+        ze_device_handle_t device = nullptr;
+        zeDeviceGet( env.driver, &count, &device );
+    };
+
+    struct { const char* name; std::function<void()> call; } cases[] = {
+        { "zeEventCreate+zeEventDestroy", eventChurn },
+        { "zeCommandListCreate+zeCommandListDestroy", commandListChurn },
+        { "zeDeviceGet", deviceLookup },
+    };
+
+    printf( "%-42s %8s %14s %14s\n", "api", "threads", "ns/call", "Mcalls/s" );
+    for( auto& c : cases )
+    {
+        for( uint32_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2 )
+        {
+            std::atomic<uint32_t> ready{ 0 };
+            std::atomic<bool> go{ false };
+            std::vector<double> threadNs( numThreads );
+            std::vector<std::thread> threads;
+            for( uint32_t t = 0; t < numThreads; ++t )
+            {
+                threads.emplace_back( [&, t]() {
+                    ++ready;
+                    while( !go.load() )
+                        std::this_thread::yield();
+                    threadNs[ t ] = bench::time_ns( iterations, c.call );
+                } );
+            }
+            while( ready.load() != numThreads )
+                std::this_thread::yield();
+            auto start = std::chrono::steady_clock::now();
+            go = true;
+            for( auto& thread : threads )
+                thread.join();
+            auto end = std::chrono::steady_clock::now();
+
+            double avgNs = 0.0;
+            for( auto ns : threadNs )
+                avgNs += ns / iterations;
+            avgNs /= numThreads;
+            double wallNs = static_cast<double>( std::chrono::duration_cast<std::chrono::nanoseconds>( end - start ).count() );
+            double throughput = ( static_cast<double>( iterations ) * numThreads ) / wallNs * 1e3;
+
+            printf( "%-42s %8u %14.1f %14.2f\n", c.name, numThreads, avgNs, throughput );
+        }
+    }
+
+    bench::null_env_destroy( env );
+    return 0;
+}
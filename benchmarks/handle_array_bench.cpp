@@ -0,0 +1,113 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include <atomic>
+#include <cstdio>
+#include <new>
+
+#include "bench_common.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// count every global operator new made by the process, including the ones
+/// made by the loader, which resolves operator new to this executable
+static std::atomic<uint64_t> allocationCount{ 0 };
+
+void* operator new( size_t size )
+{
+    allocationCount.fetch_add( 1, std::memory_order_relaxed );
+    if( void* ptr = malloc( size ? size : 1 ) )
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[]( size_t size )
+{
+    return operator new( size );
+}
+
+void operator delete( void* ptr ) noexcept
+{
+    free( ptr );
+}
+
+void operator delete[]( void* ptr ) noexcept
+{
+    free( ptr );
+}
+
+void operator delete( void* ptr, size_t ) noexcept
+{
+    free( ptr );
+}
+
+void operator delete[]( void* ptr, size_t ) noexcept
+{
+    free( ptr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Measures the heap allocations and time per call of loader intercepts that
+/// translate an array of handles, for increasing array sizes.
+/// By default the loader intercepts are forced on, since the translation only
+/// runs when the loader sits between the application and the driver.
+int main( int argc, char *argv[] )
+{
+    if( !bench::argparse( argc, argv, "-pass", "--pass_through" ) )
+        putenv_safe( const_cast<char *>( "ZE_ENABLE_LOADER_INTERCEPT=1" ) );
+    const uint64_t iterations = bench::argvalue( argc, argv, "--iterations", 1000000 );
+    const uint32_t maxEvents = 256;
+
+    bench::null_env_t env;
+    bench::null_env_create( env, maxEvents );
+
+    ze_command_list_handle_t commandLists[ maxEvents ];
+    for( uint32_t i = 0; i < maxEvents; ++i )
+        commandLists[ i ] = env.commandList;
+
+    ze_command_queue_handle_t commandQueue = nullptr;
+    ze_command_queue_desc_t commandQueueDesc = { ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC };
+    BENCH_CHECK( zeCommandQueueCreate( env.context, env.device, &commandQueueDesc, &commandQueue ) );
+
+    ze_group_count_t groupCount = { 1, 1, 1 };
+
+    printf( "%-40s %8s %14s %12s\n", "api", "handles", "allocs/call", "ns/call" );
+    for( uint32_t numHandles : { 0u, 1u, 4u, 16u, 64u, 256u } )
+    {
+        auto appendLaunchKernel = [&]() {
+            zeCommandListAppendLaunchKernel( env.commandList, env.kernel, &groupCount, nullptr, numHandles, env.events.data() );
+        };
+        auto appendWaitOnEvents = [&]() {
+            zeCommandListAppendWaitOnEvents( env.commandList, numHandles, env.events.data() );
+        };
+        auto executeCommandLists = [&]() {
+            zeCommandQueueExecuteCommandLists( commandQueue, numHandles, commandLists, nullptr );
+        };
+
+        struct { const char* name; std::function<void()> call; } cases[] = {
+            { "zeCommandListAppendLaunchKernel", appendLaunchKernel },
+            { "zeCommandListAppendWaitOnEvents", appendWaitOnEvents },
+            { "zeCommandQueueExecuteCommandLists", executeCommandLists },
+        };
+
+        for( auto& c : cases )
+        {
+            // warm up so that one-time growth of per-thread buffers is not counted
+            bench::time_ns( 16, c.call );
+
+            auto before = allocationCount.load();
+            double ns = bench::time_ns( iterations, c.call );
+            auto allocations = allocationCount.load() - before;
+
+            printf( "%-40s %8u %14.3f %12.1f\n", c.name, numHandles,
+                static_cast<double>( allocations ) / iterations, ns / iterations );
+        }
+    }
+
+    zeCommandQueueDestroy( commandQueue );
+    bench::null_env_destroy( env );
+    return 0;
+}
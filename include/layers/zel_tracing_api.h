@@ -56,6 +56,9 @@ typedef enum _zel_structure_type_t
     // This enumeration value is deprecated.
     // Pluse use ZEL_STRUCTURE_TYPE_TRACER_DESC.
     ZEL_STRUCTURE_TYPE_TRACER_EXP_DESC = 0x1  ,///< ::zel_tracer_desc_t
+    ZEL_STRUCTURE_TYPE_API_STATS = 0x2  ,///< ::zel_api_stats_t
+    ZEL_STRUCTURE_TYPE_TRACER_SAMPLING_DESC = 0x3  ,///< ::zel_tracer_sampling_desc_t
+    ZEL_STRUCTURE_TYPE_TRACER_ASYNC_DESC = 0x4  ,///< ::zel_tracer_async_desc_t
     ZEL_STRUCTURE_TYPE_FORCE_UINT32 = 0x7fffffff
 
 } zel_structure_type_t;
@@ -70,6 +73,74 @@ typedef struct _zel_tracer_desc_t
 
 } zel_tracer_desc_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracer sampling modes
+typedef enum _zel_tracer_sampling_mode_t
+{
+    ZEL_TRACER_SAMPLING_MODE_ALL = 0,               ///< every call is traced
+    ZEL_TRACER_SAMPLING_MODE_EVERY_NTH = 1,         ///< the first of every `count` calls of an API on a thread is traced
+    ZEL_TRACER_SAMPLING_MODE_INTERVAL = 2,          ///< the first call of an API on a thread after every `interval`
+                                                    ///< nanoseconds is traced
+    ZEL_TRACER_SAMPLING_MODE_FORCE_UINT32 = 0x7fffffff
+
+} zel_tracer_sampling_mode_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracer sampling descriptor, chained to ::zel_tracer_desc_t
+/// 
+/// @details
+///     - Calls which are not sampled skip the tracer's callbacks.
+///     - Calls are sampled separately for every API and thread, and the
+///       prologue and epilogue of a call are either both or neither called.
+///     - A tracer created without this descriptor samples calls as set by the
+///       environment variables ZEL_TRACING_SAMPLE_EVERY or
+///       ZEL_TRACING_SAMPLE_INTERVAL_US, and otherwise traces every call.
+typedef struct _zel_tracer_sampling_desc_t
+{
+    zel_structure_type_t stype;                     ///< [in] type of this structure
+    const void* pNext;                              ///< [in][optional] pointer to extension-specific structure
+    zel_tracer_sampling_mode_t mode;                ///< [in] sampling mode
+    uint32_t count;                                 ///< [in] calls per sampled call, for ::ZEL_TRACER_SAMPLING_MODE_EVERY_NTH
+    uint64_t interval;                              ///< [in] nanoseconds between sampled calls, for
+                                                    ///< ::ZEL_TRACER_SAMPLING_MODE_INTERVAL
+
+} zel_tracer_sampling_desc_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Supported tracer asynchronous callback flags
+typedef uint32_t zel_tracer_async_flags_t;
+typedef enum _zel_tracer_async_flag_t
+{
+    ZEL_TRACER_ASYNC_FLAG_EPILOGUES = ZE_BIT(0),    ///< epilogues run on the tracing worker thread
+    ZEL_TRACER_ASYNC_FLAG_FORCE_UINT32 = 0x7fffffff
+
+} zel_tracer_async_flag_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracer asynchronous callback descriptor, chained to
+///        ::zel_tracer_desc_t
+/// 
+/// @details
+///     - Deferred epilogues run on a worker thread of the tracing layer after
+///       the API call has returned, in the order of the calls of each thread.
+///     - The parameters of a deferred epilogue point to copies of the
+///       argument values; memory the arguments point to may have been
+///       released or reused by the time the epilogue runs.
+///     - The instance user data passed to a deferred epilogue is the value
+///       left by the prologue of its call.
+///     - Each thread queues a bounded number of deferred epilogues; epilogues
+///       which do not fit are dropped and counted, see
+///       ::zelTracerGetDroppedEpilogueCount.
+///     - APIs called from a deferred epilogue are not traced.
+typedef struct _zel_tracer_async_desc_t
+{
+    zel_structure_type_t stype;                     ///< [in] type of this structure
+    const void* pNext;                              ///< [in][optional] pointer to extension-specific structure
+    zel_tracer_async_flags_t flags;                 ///< [in] callbacks to defer.
+                                                    ///< must be 0 (default) or a valid combination of ::zel_tracer_async_flag_t.
+
+} zel_tracer_async_desc_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Creates a tracer
 /// 
@@ -86,6 +157,11 @@ typedef struct _zel_tracer_desc_t
 ///         + `nullptr == desc`
 ///         + `nullptr == desc->pUserData`
 ///         + `nullptr == phTracer`
+///     - ::ZE_RESULT_ERROR_INVALID_ARGUMENT
+///         + a chained ::zel_tracer_sampling_desc_t has an unknown mode, or a
+///           zero `count` or `interval` for its mode
+///     - ::ZE_RESULT_ERROR_INVALID_ENUMERATION
+///         + a chained ::zel_tracer_async_desc_t has unknown `flags`
 ///     - ::ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zelTracerCreate(
@@ -103,6 +179,8 @@ zelTracerCreate(
 ///     - The implementation of this function will stall and wait on any
 ///       outstanding threads executing callbacks before freeing any Host
 ///       allocations associated with this tracer.
+///     - The implementation of this function will also wait until the
+///       deferred epilogues of the tracer have run.
 /// 
 /// @returns
 ///     - ::ZE_RESULT_SUCCESS
@@ -111,6 +189,7 @@ zelTracerCreate(
 ///     - ::ZE_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `nullptr == hTracer`
 ///     - ::ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE
+///         + the tracer is enabled, or is destroyed from one of its callbacks
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zelTracerDestroy(
     zel_tracer_handle_t hTracer                 ///< [in][release] handle of tracer object to destroy
@@ -187,6 +266,119 @@ zelTracerSetEnabled(
     ze_bool_t enable                                ///< [in] enable the tracer if true; disable if false
     );
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Retrieves the number of epilogues of a tracer which were dropped
+///        because the queue of deferred epilogues of their thread was full.
+/// 
+/// @details
+///     - Tracers without deferred epilogues drop none.
+///     - The application may call this function from simultaneous threads.
+/// 
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + the tracing layer does not defer epilogues
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `nullptr == hTracer`
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `nullptr == pCount`
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerGetDroppedEpilogueCount(
+    zel_tracer_handle_t hTracer,                    ///< [in] handle of the tracer
+    uint64_t* pCount                                ///< [out] number of epilogues dropped since the tracer was created
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Waits until the epilogues deferred before this call have run.
+/// 
+/// @details
+///     - Returns immediately for tracers without deferred epilogues.
+///     - The application may call this function from simultaneous threads.
+/// 
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + the tracing layer does not defer epilogues
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `nullptr == hTracer`
+///     - ::ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE
+///         + called from a deferred epilogue
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerFlushEpilogues(
+    zel_tracer_handle_t hTracer                     ///< [in] handle of the tracer
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Call statistics of an API
+/// 
+/// @details
+///     - Times are those spent in the driver, measured by the tracing layer.
+///     - Percentiles are read from a histogram of log buckets and are
+///       accurate to within an eighth of their value.
+typedef struct _zel_api_stats_t
+{
+    zel_structure_type_t stype;                     ///< [in] type of this structure
+    const void* pNext;                              ///< [in][optional] pointer to extension-specific structure
+    const char* name;                               ///< [out] name of the API
+    uint64_t callCount;                             ///< [out] number of calls since the statistics were reset
+    uint64_t totalTime;                             ///< [out] total time of the calls, in nanoseconds
+    uint64_t minTime;                               ///< [out] shortest call, in nanoseconds
+    uint64_t maxTime;                               ///< [out] longest call, in nanoseconds
+    uint64_t p50Time;                               ///< [out] median call time, in nanoseconds
+    uint64_t p90Time;                               ///< [out] 90th percentile call time, in nanoseconds
+    uint64_t p99Time;                               ///< [out] 99th percentile call time, in nanoseconds
+    uint64_t p999Time;                              ///< [out] 99.9th percentile call time, in nanoseconds
+
+} zel_api_stats_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Retrieves the call statistics of every API called since the
+///        statistics were last reset.
+/// 
+/// @details
+///     - Statistics are only collected if the environment variable
+///       ZEL_ENABLE_API_STATS is set when the loader is initialized.
+///     - Calls of all threads are merged when this function is called.
+///     - The application may call this function from simultaneous threads.
+/// 
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + statistics are not collected
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `nullptr == pCount`
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracingGetApiStats(
+    uint32_t* pCount,                               ///< [in,out] pointer to the number of APIs.
+                                                    ///< if count is zero, then it is updated to the number of
+                                                    ///< APIs called.
+                                                    ///< if count is greater than the number of APIs called,
+                                                    ///< then it is updated to the correct number.
+    zel_api_stats_t* pStats                         ///< [in,out][optional][range(0, *pCount)] array of API statistics,
+                                                    ///< in no particular order
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Resets the call statistics of every API.
+/// 
+/// @details
+///     - Calls in progress on other threads may be counted either before or
+///       after the reset.
+///     - The application may call this function from simultaneous threads.
+/// 
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + statistics are not collected
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracingResetApiStats(
+    void
+    );
+
 #if !defined(__GNUC__)
 #pragma endregion
 #endif
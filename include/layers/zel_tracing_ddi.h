@@ -89,11 +89,101 @@ typedef ze_result_t (ZE_APICALL *zel_pfnGetTracerApiProcAddrTable_t)(
     zel_tracer_dditable_t*
     );
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for zelTracingGetApiStats
+typedef ze_result_t (ZE_APICALL *zel_pfnTracingGetApiStats_t)(
+    uint32_t*,
+    zel_api_stats_t*
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for zelTracingResetApiStats
+typedef ze_result_t (ZE_APICALL *zel_pfnTracingResetApiStats_t)(
+    void
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of API statistics functions pointers
+typedef struct _zel_tracing_stats_dditable_t
+{
+    zel_pfnTracingGetApiStats_t                              pfnGetApiStats;
+    zel_pfnTracingResetApiStats_t                            pfnResetApiStats;
+} zel_tracing_stats_dditable_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's API statistics table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelGetTracingStatsProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zel_tracing_stats_dditable_t* pDdiTable     ///< [in,out] pointer to table of DDI function pointers
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for zelGetTracingStatsProcAddrTable
+typedef ze_result_t (ZE_APICALL *zel_pfnGetTracingStatsProcAddrTable_t)(
+    ze_api_version_t,
+    zel_tracing_stats_dditable_t*
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for zelTracerGetDroppedEpilogueCount
+typedef ze_result_t (ZE_APICALL *zel_pfnTracerGetDroppedEpilogueCount_t)(
+    zel_tracer_handle_t,
+    uint64_t*
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for zelTracerFlushEpilogues
+typedef ze_result_t (ZE_APICALL *zel_pfnTracerFlushEpilogues_t)(
+    zel_tracer_handle_t
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of deferred epilogue functions pointers
+typedef struct _zel_tracer_async_dditable_t
+{
+    zel_pfnTracerGetDroppedEpilogueCount_t                   pfnGetDroppedEpilogueCount;
+    zel_pfnTracerFlushEpilogues_t                            pfnFlushEpilogues;
+} zel_tracer_async_dditable_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's deferred epilogue
+///        table with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelGetTracerAsyncProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zel_tracer_async_dditable_t* pDdiTable      ///< [in,out] pointer to table of DDI function pointers
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for zelGetTracerAsyncProcAddrTable
+typedef ze_result_t (ZE_APICALL *zel_pfnGetTracerAsyncProcAddrTable_t)(
+    ze_api_version_t,
+    zel_tracer_async_dditable_t*
+    );
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Container for tracing DDI tables
 typedef struct _zel_tracing_dditable_t
 {
    zel_tracer_dditable_t         Tracer;
+   zel_tracing_stats_dditable_t  Stats;
+   zel_tracer_async_dditable_t   Async;
 } zel_tracing_dditable_t;
 
 #if defined(__cplusplus)
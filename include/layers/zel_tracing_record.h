@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zel_tracing_record.h
+ */
+#ifndef _ZEL_TRACING_RECORD_H
+#define _ZEL_TRACING_RECORD_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include <stdint.h>
+
+//
+// Layout of a file recorded with ZEL_TRACE_RECORD, in host byte order:
+//
+//   zel_api_record_header_t
+//   apiCount times:
+//       zel_api_record_api_desc_t, then the name and the comma separated
+//       argument names, without terminators, padded to a multiple of 8 bytes
+//   zel_api_record_t until the end of the file, or until a record with a
+//   zero begin time in a file still being recorded
+//
+// Records of one thread are in call order; records of different threads
+// are interleaved in the order they were flushed.
+//
+
+#define ZEL_API_RECORD_MAGIC "ZELTRACE"
+#define ZEL_API_RECORD_VERSION 1
+#define ZEL_API_RECORD_ARG_COUNT 8
+
+// api of a record reporting in args[0] how many records of its thread
+// were dropped because the thread's buffer was full
+#define ZEL_API_RECORD_DROPPED 0xffffffffu
+
+typedef struct _zel_api_record_header_t
+{
+    char magic[8];                                  ///< ZEL_API_RECORD_MAGIC, without terminator
+    uint32_t version;                               ///< ZEL_API_RECORD_VERSION
+    uint32_t recordSize;                            ///< sizeof(zel_api_record_t)
+    uint64_t startTime;                             ///< steady clock time recording started, in ns
+    uint32_t apiCount;                              ///< number of API descriptions after the header
+    uint32_t argCount;                              ///< ZEL_API_RECORD_ARG_COUNT
+} zel_api_record_header_t;
+
+typedef struct _zel_api_record_api_desc_t
+{
+    uint32_t api;                                   ///< API id used by the records
+    uint32_t nameSize;                              ///< size of the API name
+    uint32_t argNamesSize;                          ///< size of the argument names
+    uint32_t reserved;
+} zel_api_record_api_desc_t;
+
+typedef struct _zel_api_record_t
+{
+    uint32_t api;                                   ///< API id, or ZEL_API_RECORD_DROPPED
+    uint32_t thread;                                ///< recording thread, numbered from 0 in order of first call
+    int32_t result;                                 ///< ze_result_t returned by the call
+    uint32_t argCount;                              ///< number of valid args
+    uint64_t begin;                                 ///< steady clock time the driver was called, in ns
+    uint64_t end;                                   ///< steady clock time the driver returned, in ns
+    uint64_t args[ZEL_API_RECORD_ARG_COUNT];        ///< handle and size arguments, as named by the API description
+} zel_api_record_t;
+
+#endif // _ZEL_TRACING_RECORD_H
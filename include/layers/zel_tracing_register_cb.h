@@ -3359,4 +3359,8 @@ zelTracerResetAllCallbacks(zel_tracer_handle_t hTracer);
 } // extern "C"
 #endif
 
+// Callbacks of the tools and sysman APIs
+#include "zet_tracing_register_cb.h"
+#include "zes_tracing_register_cb.h"
+
 #endif // zel_tracing_register_cb_H
@@ -0,0 +1,4518 @@
+/*
+ *
+ * Copyright (C) 2021-2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zes_tracing_register_cb.h
+ *
+ */
+#ifndef zes_tracing_register_cb_H
+#define zes_tracing_register_cb_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "../zes_api.h"
+#include "zel_tracing_register_cb.h"
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/// Callback definitions for all zes APIs
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesInit
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_init_params_t
+{
+    zes_init_flags_t* pflags;
+} zes_init_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesInit
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnInitCb_t)(
+    zes_init_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_get_properties_params_t
+{
+    zes_device_handle_t* phDevice;
+    zes_device_properties_t** ppProperties;
+} zes_device_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceGetPropertiesCb_t)(
+    zes_device_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceGetState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_get_state_params_t
+{
+    zes_device_handle_t* phDevice;
+    zes_device_state_t** ppState;
+} zes_device_get_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceGetState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceGetStateCb_t)(
+    zes_device_get_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceReset
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_reset_params_t
+{
+    zes_device_handle_t* phDevice;
+    ze_bool_t* pforce;
+} zes_device_reset_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceReset
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceResetCb_t)(
+    zes_device_reset_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceProcessesGetState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_processes_get_state_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_process_state_t** ppProcesses;
+} zes_device_processes_get_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceProcessesGetState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceProcessesGetStateCb_t)(
+    zes_device_processes_get_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDevicePciGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_pci_get_properties_params_t
+{
+    zes_device_handle_t* phDevice;
+    zes_pci_properties_t** ppProperties;
+} zes_device_pci_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDevicePciGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDevicePciGetPropertiesCb_t)(
+    zes_device_pci_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDevicePciGetState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_pci_get_state_params_t
+{
+    zes_device_handle_t* phDevice;
+    zes_pci_state_t** ppState;
+} zes_device_pci_get_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDevicePciGetState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDevicePciGetStateCb_t)(
+    zes_device_pci_get_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDevicePciGetBars
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_pci_get_bars_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_pci_bar_properties_t** ppProperties;
+} zes_device_pci_get_bars_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDevicePciGetBars
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDevicePciGetBarsCb_t)(
+    zes_device_pci_get_bars_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDevicePciGetStats
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_pci_get_stats_params_t
+{
+    zes_device_handle_t* phDevice;
+    zes_pci_stats_t** ppStats;
+} zes_device_pci_get_stats_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDevicePciGetStats
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDevicePciGetStatsCb_t)(
+    zes_device_pci_get_stats_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumDiagnosticTestSuites
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_diagnostic_test_suites_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_diag_handle_t** pphDiagnostics;
+} zes_device_enum_diagnostic_test_suites_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumDiagnosticTestSuites
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumDiagnosticTestSuitesCb_t)(
+    zes_device_enum_diagnostic_test_suites_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumEngineGroups
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_engine_groups_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_engine_handle_t** pphEngine;
+} zes_device_enum_engine_groups_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumEngineGroups
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumEngineGroupsCb_t)(
+    zes_device_enum_engine_groups_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEventRegister
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_event_register_params_t
+{
+    zes_device_handle_t* phDevice;
+    zes_event_type_flags_t* pevents;
+} zes_device_event_register_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEventRegister
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEventRegisterCb_t)(
+    zes_device_event_register_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumFabricPorts
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_fabric_ports_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_fabric_port_handle_t** pphPort;
+} zes_device_enum_fabric_ports_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumFabricPorts
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumFabricPortsCb_t)(
+    zes_device_enum_fabric_ports_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumFans
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_fans_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_fan_handle_t** pphFan;
+} zes_device_enum_fans_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumFans
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumFansCb_t)(
+    zes_device_enum_fans_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumFirmwares
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_firmwares_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_firmware_handle_t** pphFirmware;
+} zes_device_enum_firmwares_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumFirmwares
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumFirmwaresCb_t)(
+    zes_device_enum_firmwares_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumFrequencyDomains
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_frequency_domains_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_freq_handle_t** pphFrequency;
+} zes_device_enum_frequency_domains_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumFrequencyDomains
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumFrequencyDomainsCb_t)(
+    zes_device_enum_frequency_domains_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumLeds
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_leds_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_led_handle_t** pphLed;
+} zes_device_enum_leds_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumLeds
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumLedsCb_t)(
+    zes_device_enum_leds_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumMemoryModules
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_memory_modules_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_mem_handle_t** pphMemory;
+} zes_device_enum_memory_modules_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumMemoryModules
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumMemoryModulesCb_t)(
+    zes_device_enum_memory_modules_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumPerformanceFactorDomains
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_performance_factor_domains_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_perf_handle_t** pphPerf;
+} zes_device_enum_performance_factor_domains_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumPerformanceFactorDomains
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumPerformanceFactorDomainsCb_t)(
+    zes_device_enum_performance_factor_domains_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumPowerDomains
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_power_domains_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_pwr_handle_t** pphPower;
+} zes_device_enum_power_domains_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumPowerDomains
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumPowerDomainsCb_t)(
+    zes_device_enum_power_domains_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceGetCardPowerDomain
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_get_card_power_domain_params_t
+{
+    zes_device_handle_t* phDevice;
+    zes_pwr_handle_t** pphPower;
+} zes_device_get_card_power_domain_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceGetCardPowerDomain
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceGetCardPowerDomainCb_t)(
+    zes_device_get_card_power_domain_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumPsus
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_psus_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_psu_handle_t** pphPsu;
+} zes_device_enum_psus_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumPsus
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumPsusCb_t)(
+    zes_device_enum_psus_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumRasErrorSets
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_ras_error_sets_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_ras_handle_t** pphRas;
+} zes_device_enum_ras_error_sets_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumRasErrorSets
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumRasErrorSetsCb_t)(
+    zes_device_enum_ras_error_sets_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumSchedulers
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_schedulers_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_sched_handle_t** pphScheduler;
+} zes_device_enum_schedulers_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumSchedulers
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumSchedulersCb_t)(
+    zes_device_enum_schedulers_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumStandbyDomains
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_standby_domains_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_standby_handle_t** pphStandby;
+} zes_device_enum_standby_domains_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumStandbyDomains
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumStandbyDomainsCb_t)(
+    zes_device_enum_standby_domains_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumTemperatureSensors
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_temperature_sensors_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_temp_handle_t** pphTemperature;
+} zes_device_enum_temperature_sensors_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumTemperatureSensors
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumTemperatureSensorsCb_t)(
+    zes_device_enum_temperature_sensors_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEccAvailable
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_ecc_available_params_t
+{
+    zes_device_handle_t* phDevice;
+    ze_bool_t** ppAvailable;
+} zes_device_ecc_available_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEccAvailable
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEccAvailableCb_t)(
+    zes_device_ecc_available_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEccConfigurable
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_ecc_configurable_params_t
+{
+    zes_device_handle_t* phDevice;
+    ze_bool_t** ppConfigurable;
+} zes_device_ecc_configurable_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEccConfigurable
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEccConfigurableCb_t)(
+    zes_device_ecc_configurable_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceGetEccState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_get_ecc_state_params_t
+{
+    zes_device_handle_t* phDevice;
+    zes_device_ecc_properties_t** ppState;
+} zes_device_get_ecc_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceGetEccState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceGetEccStateCb_t)(
+    zes_device_get_ecc_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceSetEccState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_set_ecc_state_params_t
+{
+    zes_device_handle_t* phDevice;
+    const zes_device_ecc_desc_t** pnewState;
+    zes_device_ecc_properties_t** ppState;
+} zes_device_set_ecc_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceSetEccState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceSetEccStateCb_t)(
+    zes_device_set_ecc_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceGet
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_get_params_t
+{
+    zes_driver_handle_t* phDriver;
+    uint32_t** ppCount;
+    zes_device_handle_t** pphDevices;
+} zes_device_get_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceGet
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceGetCb_t)(
+    zes_device_get_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceSetOverclockWaiver
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_set_overclock_waiver_params_t
+{
+    zes_device_handle_t* phDevice;
+} zes_device_set_overclock_waiver_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceSetOverclockWaiver
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceSetOverclockWaiverCb_t)(
+    zes_device_set_overclock_waiver_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceGetOverclockDomains
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_get_overclock_domains_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppOverclockDomains;
+} zes_device_get_overclock_domains_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceGetOverclockDomains
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceGetOverclockDomainsCb_t)(
+    zes_device_get_overclock_domains_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceGetOverclockControls
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_get_overclock_controls_params_t
+{
+    zes_device_handle_t* phDevice;
+    zes_overclock_domain_t* pdomainType;
+    uint32_t** ppAvailableControls;
+} zes_device_get_overclock_controls_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceGetOverclockControls
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceGetOverclockControlsCb_t)(
+    zes_device_get_overclock_controls_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceResetOverclockSettings
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_reset_overclock_settings_params_t
+{
+    zes_device_handle_t* phDevice;
+    ze_bool_t* ponShippedState;
+} zes_device_reset_overclock_settings_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceResetOverclockSettings
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceResetOverclockSettingsCb_t)(
+    zes_device_reset_overclock_settings_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceReadOverclockState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_read_overclock_state_params_t
+{
+    zes_device_handle_t* phDevice;
+    zes_overclock_mode_t** ppOverclockMode;
+    ze_bool_t** ppWaiverSetting;
+    ze_bool_t** ppOverclockState;
+    zes_pending_action_t** ppPendingAction;
+    ze_bool_t** ppPendingReset;
+} zes_device_read_overclock_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceReadOverclockState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceReadOverclockStateCb_t)(
+    zes_device_read_overclock_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceEnumOverclockDomains
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_enum_overclock_domains_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zes_overclock_handle_t** pphDomainHandle;
+} zes_device_enum_overclock_domains_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceEnumOverclockDomains
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceEnumOverclockDomainsCb_t)(
+    zes_device_enum_overclock_domains_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDeviceResetExt
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_device_reset_ext_params_t
+{
+    zes_device_handle_t* phDevice;
+    zes_reset_properties_t** ppProperties;
+} zes_device_reset_ext_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDeviceResetExt
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDeviceResetExtCb_t)(
+    zes_device_reset_ext_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDriverEventListen
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_driver_event_listen_params_t
+{
+    ze_driver_handle_t* phDriver;
+    uint32_t* ptimeout;
+    uint32_t* pcount;
+    zes_device_handle_t** pphDevices;
+    uint32_t** ppNumDeviceEvents;
+    zes_event_type_flags_t** ppEvents;
+} zes_driver_event_listen_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDriverEventListen
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDriverEventListenCb_t)(
+    zes_driver_event_listen_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDriverEventListenEx
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_driver_event_listen_ex_params_t
+{
+    ze_driver_handle_t* phDriver;
+    uint64_t* ptimeout;
+    uint32_t* pcount;
+    zes_device_handle_t** pphDevices;
+    uint32_t** ppNumDeviceEvents;
+    zes_event_type_flags_t** ppEvents;
+} zes_driver_event_listen_ex_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDriverEventListenEx
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDriverEventListenExCb_t)(
+    zes_driver_event_listen_ex_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDriverGet
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_driver_get_params_t
+{
+    uint32_t** ppCount;
+    zes_driver_handle_t** pphDrivers;
+} zes_driver_get_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDriverGet
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDriverGetCb_t)(
+    zes_driver_get_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDiagnosticsGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_diagnostics_get_properties_params_t
+{
+    zes_diag_handle_t* phDiagnostics;
+    zes_diag_properties_t** ppProperties;
+} zes_diagnostics_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDiagnosticsGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDiagnosticsGetPropertiesCb_t)(
+    zes_diagnostics_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDiagnosticsGetTests
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_diagnostics_get_tests_params_t
+{
+    zes_diag_handle_t* phDiagnostics;
+    uint32_t** ppCount;
+    zes_diag_test_t** ppTests;
+} zes_diagnostics_get_tests_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDiagnosticsGetTests
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDiagnosticsGetTestsCb_t)(
+    zes_diagnostics_get_tests_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesDiagnosticsRunTests
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_diagnostics_run_tests_params_t
+{
+    zes_diag_handle_t* phDiagnostics;
+    uint32_t* pstartIndex;
+    uint32_t* pendIndex;
+    zes_diag_result_t** ppResult;
+} zes_diagnostics_run_tests_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesDiagnosticsRunTests
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnDiagnosticsRunTestsCb_t)(
+    zes_diagnostics_run_tests_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesEngineGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_engine_get_properties_params_t
+{
+    zes_engine_handle_t* phEngine;
+    zes_engine_properties_t** ppProperties;
+} zes_engine_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesEngineGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnEngineGetPropertiesCb_t)(
+    zes_engine_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesEngineGetActivity
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_engine_get_activity_params_t
+{
+    zes_engine_handle_t* phEngine;
+    zes_engine_stats_t** ppStats;
+} zes_engine_get_activity_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesEngineGetActivity
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnEngineGetActivityCb_t)(
+    zes_engine_get_activity_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesEngineGetActivityExt
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_engine_get_activity_ext_params_t
+{
+    zes_engine_handle_t* phEngine;
+    uint32_t** ppCount;
+    zes_engine_stats_t** ppStats;
+} zes_engine_get_activity_ext_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesEngineGetActivityExt
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnEngineGetActivityExtCb_t)(
+    zes_engine_get_activity_ext_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFabricPortGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fabric_port_get_properties_params_t
+{
+    zes_fabric_port_handle_t* phPort;
+    zes_fabric_port_properties_t** ppProperties;
+} zes_fabric_port_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFabricPortGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFabricPortGetPropertiesCb_t)(
+    zes_fabric_port_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFabricPortGetLinkType
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fabric_port_get_link_type_params_t
+{
+    zes_fabric_port_handle_t* phPort;
+    zes_fabric_link_type_t** ppLinkType;
+} zes_fabric_port_get_link_type_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFabricPortGetLinkType
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFabricPortGetLinkTypeCb_t)(
+    zes_fabric_port_get_link_type_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFabricPortGetConfig
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fabric_port_get_config_params_t
+{
+    zes_fabric_port_handle_t* phPort;
+    zes_fabric_port_config_t** ppConfig;
+} zes_fabric_port_get_config_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFabricPortGetConfig
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFabricPortGetConfigCb_t)(
+    zes_fabric_port_get_config_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFabricPortSetConfig
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fabric_port_set_config_params_t
+{
+    zes_fabric_port_handle_t* phPort;
+    const zes_fabric_port_config_t** ppConfig;
+} zes_fabric_port_set_config_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFabricPortSetConfig
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFabricPortSetConfigCb_t)(
+    zes_fabric_port_set_config_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFabricPortGetState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fabric_port_get_state_params_t
+{
+    zes_fabric_port_handle_t* phPort;
+    zes_fabric_port_state_t** ppState;
+} zes_fabric_port_get_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFabricPortGetState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFabricPortGetStateCb_t)(
+    zes_fabric_port_get_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFabricPortGetThroughput
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fabric_port_get_throughput_params_t
+{
+    zes_fabric_port_handle_t* phPort;
+    zes_fabric_port_throughput_t** ppThroughput;
+} zes_fabric_port_get_throughput_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFabricPortGetThroughput
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFabricPortGetThroughputCb_t)(
+    zes_fabric_port_get_throughput_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFabricPortGetFabricErrorCounters
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fabric_port_get_fabric_error_counters_params_t
+{
+    zes_fabric_port_handle_t* phPort;
+    zes_fabric_port_error_counters_t** ppErrors;
+} zes_fabric_port_get_fabric_error_counters_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFabricPortGetFabricErrorCounters
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFabricPortGetFabricErrorCountersCb_t)(
+    zes_fabric_port_get_fabric_error_counters_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFabricPortGetMultiPortThroughput
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fabric_port_get_multi_port_throughput_params_t
+{
+    zes_device_handle_t* phDevice;
+    uint32_t* pnumPorts;
+    zes_fabric_port_handle_t** pphPort;
+    zes_fabric_port_throughput_t*** ppThroughput;
+} zes_fabric_port_get_multi_port_throughput_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFabricPortGetMultiPortThroughput
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFabricPortGetMultiPortThroughputCb_t)(
+    zes_fabric_port_get_multi_port_throughput_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFanGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fan_get_properties_params_t
+{
+    zes_fan_handle_t* phFan;
+    zes_fan_properties_t** ppProperties;
+} zes_fan_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFanGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFanGetPropertiesCb_t)(
+    zes_fan_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFanGetConfig
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fan_get_config_params_t
+{
+    zes_fan_handle_t* phFan;
+    zes_fan_config_t** ppConfig;
+} zes_fan_get_config_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFanGetConfig
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFanGetConfigCb_t)(
+    zes_fan_get_config_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFanSetDefaultMode
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fan_set_default_mode_params_t
+{
+    zes_fan_handle_t* phFan;
+} zes_fan_set_default_mode_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFanSetDefaultMode
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFanSetDefaultModeCb_t)(
+    zes_fan_set_default_mode_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFanSetFixedSpeedMode
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fan_set_fixed_speed_mode_params_t
+{
+    zes_fan_handle_t* phFan;
+    const zes_fan_speed_t** pspeed;
+} zes_fan_set_fixed_speed_mode_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFanSetFixedSpeedMode
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFanSetFixedSpeedModeCb_t)(
+    zes_fan_set_fixed_speed_mode_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFanSetSpeedTableMode
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fan_set_speed_table_mode_params_t
+{
+    zes_fan_handle_t* phFan;
+    const zes_fan_speed_table_t** pspeedTable;
+} zes_fan_set_speed_table_mode_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFanSetSpeedTableMode
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFanSetSpeedTableModeCb_t)(
+    zes_fan_set_speed_table_mode_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFanGetState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_fan_get_state_params_t
+{
+    zes_fan_handle_t* phFan;
+    zes_fan_speed_units_t* punits;
+    int32_t** ppSpeed;
+} zes_fan_get_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFanGetState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFanGetStateCb_t)(
+    zes_fan_get_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFirmwareGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_firmware_get_properties_params_t
+{
+    zes_firmware_handle_t* phFirmware;
+    zes_firmware_properties_t** ppProperties;
+} zes_firmware_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFirmwareGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFirmwareGetPropertiesCb_t)(
+    zes_firmware_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFirmwareFlash
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_firmware_flash_params_t
+{
+    zes_firmware_handle_t* phFirmware;
+    void** ppImage;
+    uint32_t* psize;
+} zes_firmware_flash_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFirmwareFlash
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFirmwareFlashCb_t)(
+    zes_firmware_flash_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_get_properties_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    zes_freq_properties_t** ppProperties;
+} zes_frequency_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyGetPropertiesCb_t)(
+    zes_frequency_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyGetAvailableClocks
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_get_available_clocks_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    uint32_t** ppCount;
+    double** pphFrequency;
+} zes_frequency_get_available_clocks_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyGetAvailableClocks
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyGetAvailableClocksCb_t)(
+    zes_frequency_get_available_clocks_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyGetRange
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_get_range_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    zes_freq_range_t** ppLimits;
+} zes_frequency_get_range_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyGetRange
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyGetRangeCb_t)(
+    zes_frequency_get_range_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencySetRange
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_set_range_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    const zes_freq_range_t** ppLimits;
+} zes_frequency_set_range_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencySetRange
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencySetRangeCb_t)(
+    zes_frequency_set_range_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyGetState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_get_state_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    zes_freq_state_t** ppState;
+} zes_frequency_get_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyGetState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyGetStateCb_t)(
+    zes_frequency_get_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyGetThrottleTime
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_get_throttle_time_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    zes_freq_throttle_time_t** ppThrottleTime;
+} zes_frequency_get_throttle_time_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyGetThrottleTime
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyGetThrottleTimeCb_t)(
+    zes_frequency_get_throttle_time_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyOcGetCapabilities
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_oc_get_capabilities_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    zes_oc_capabilities_t** ppOcCapabilities;
+} zes_frequency_oc_get_capabilities_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyOcGetCapabilities
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyOcGetCapabilitiesCb_t)(
+    zes_frequency_oc_get_capabilities_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyOcGetFrequencyTarget
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_oc_get_frequency_target_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    double** ppCurrentOcFrequency;
+} zes_frequency_oc_get_frequency_target_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyOcGetFrequencyTarget
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyOcGetFrequencyTargetCb_t)(
+    zes_frequency_oc_get_frequency_target_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyOcSetFrequencyTarget
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_oc_set_frequency_target_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    double* pCurrentOcFrequency;
+} zes_frequency_oc_set_frequency_target_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyOcSetFrequencyTarget
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyOcSetFrequencyTargetCb_t)(
+    zes_frequency_oc_set_frequency_target_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyOcGetVoltageTarget
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_oc_get_voltage_target_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    double** ppCurrentVoltageTarget;
+    double** ppCurrentVoltageOffset;
+} zes_frequency_oc_get_voltage_target_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyOcGetVoltageTarget
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyOcGetVoltageTargetCb_t)(
+    zes_frequency_oc_get_voltage_target_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyOcSetVoltageTarget
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_oc_set_voltage_target_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    double* pCurrentVoltageTarget;
+    double* pCurrentVoltageOffset;
+} zes_frequency_oc_set_voltage_target_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyOcSetVoltageTarget
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyOcSetVoltageTargetCb_t)(
+    zes_frequency_oc_set_voltage_target_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyOcSetMode
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_oc_set_mode_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    zes_oc_mode_t* pCurrentOcMode;
+} zes_frequency_oc_set_mode_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyOcSetMode
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyOcSetModeCb_t)(
+    zes_frequency_oc_set_mode_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyOcGetMode
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_oc_get_mode_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    zes_oc_mode_t** ppCurrentOcMode;
+} zes_frequency_oc_get_mode_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyOcGetMode
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyOcGetModeCb_t)(
+    zes_frequency_oc_get_mode_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyOcGetIccMax
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_oc_get_icc_max_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    double** ppOcIccMax;
+} zes_frequency_oc_get_icc_max_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyOcGetIccMax
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyOcGetIccMaxCb_t)(
+    zes_frequency_oc_get_icc_max_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyOcSetIccMax
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_oc_set_icc_max_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    double* pocIccMax;
+} zes_frequency_oc_set_icc_max_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyOcSetIccMax
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyOcSetIccMaxCb_t)(
+    zes_frequency_oc_set_icc_max_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyOcGetTjMax
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_oc_get_tj_max_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    double** ppOcTjMax;
+} zes_frequency_oc_get_tj_max_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyOcGetTjMax
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyOcGetTjMaxCb_t)(
+    zes_frequency_oc_get_tj_max_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesFrequencyOcSetTjMax
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_frequency_oc_set_tj_max_params_t
+{
+    zes_freq_handle_t* phFrequency;
+    double* pocTjMax;
+} zes_frequency_oc_set_tj_max_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesFrequencyOcSetTjMax
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnFrequencyOcSetTjMaxCb_t)(
+    zes_frequency_oc_set_tj_max_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesLedGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_led_get_properties_params_t
+{
+    zes_led_handle_t* phLed;
+    zes_led_properties_t** ppProperties;
+} zes_led_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesLedGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnLedGetPropertiesCb_t)(
+    zes_led_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesLedGetState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_led_get_state_params_t
+{
+    zes_led_handle_t* phLed;
+    zes_led_state_t** ppState;
+} zes_led_get_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesLedGetState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnLedGetStateCb_t)(
+    zes_led_get_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesLedSetState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_led_set_state_params_t
+{
+    zes_led_handle_t* phLed;
+    ze_bool_t* penable;
+} zes_led_set_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesLedSetState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnLedSetStateCb_t)(
+    zes_led_set_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesLedSetColor
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_led_set_color_params_t
+{
+    zes_led_handle_t* phLed;
+    const zes_led_color_t** ppColor;
+} zes_led_set_color_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesLedSetColor
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnLedSetColorCb_t)(
+    zes_led_set_color_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesMemoryGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_memory_get_properties_params_t
+{
+    zes_mem_handle_t* phMemory;
+    zes_mem_properties_t** ppProperties;
+} zes_memory_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesMemoryGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnMemoryGetPropertiesCb_t)(
+    zes_memory_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesMemoryGetState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_memory_get_state_params_t
+{
+    zes_mem_handle_t* phMemory;
+    zes_mem_state_t** ppState;
+} zes_memory_get_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesMemoryGetState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnMemoryGetStateCb_t)(
+    zes_memory_get_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesMemoryGetBandwidth
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_memory_get_bandwidth_params_t
+{
+    zes_mem_handle_t* phMemory;
+    zes_mem_bandwidth_t** ppBandwidth;
+} zes_memory_get_bandwidth_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesMemoryGetBandwidth
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnMemoryGetBandwidthCb_t)(
+    zes_memory_get_bandwidth_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesOverclockGetDomainProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_overclock_get_domain_properties_params_t
+{
+    zes_overclock_handle_t* phDomainHandle;
+    zes_overclock_properties_t** ppDomainProperties;
+} zes_overclock_get_domain_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesOverclockGetDomainProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnOverclockGetDomainPropertiesCb_t)(
+    zes_overclock_get_domain_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesOverclockGetDomainVFProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_overclock_get_domain_vf_properties_params_t
+{
+    zes_overclock_handle_t* phDomainHandle;
+    zes_vf_property_t** ppVFProperties;
+} zes_overclock_get_domain_vf_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesOverclockGetDomainVFProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnOverclockGetDomainVFPropertiesCb_t)(
+    zes_overclock_get_domain_vf_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesOverclockGetDomainControlProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_overclock_get_domain_control_properties_params_t
+{
+    zes_overclock_handle_t* phDomainHandle;
+    zes_overclock_control_t* pDomainControl;
+    zes_control_property_t** ppControlProperties;
+} zes_overclock_get_domain_control_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesOverclockGetDomainControlProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnOverclockGetDomainControlPropertiesCb_t)(
+    zes_overclock_get_domain_control_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesOverclockGetControlCurrentValue
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_overclock_get_control_current_value_params_t
+{
+    zes_overclock_handle_t* phDomainHandle;
+    zes_overclock_control_t* pDomainControl;
+    double** ppValue;
+} zes_overclock_get_control_current_value_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesOverclockGetControlCurrentValue
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnOverclockGetControlCurrentValueCb_t)(
+    zes_overclock_get_control_current_value_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesOverclockGetControlPendingValue
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_overclock_get_control_pending_value_params_t
+{
+    zes_overclock_handle_t* phDomainHandle;
+    zes_overclock_control_t* pDomainControl;
+    double** ppValue;
+} zes_overclock_get_control_pending_value_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesOverclockGetControlPendingValue
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnOverclockGetControlPendingValueCb_t)(
+    zes_overclock_get_control_pending_value_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesOverclockSetControlUserValue
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_overclock_set_control_user_value_params_t
+{
+    zes_overclock_handle_t* phDomainHandle;
+    zes_overclock_control_t* pDomainControl;
+    double* ppValue;
+    zes_pending_action_t** ppPendingAction;
+} zes_overclock_set_control_user_value_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesOverclockSetControlUserValue
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnOverclockSetControlUserValueCb_t)(
+    zes_overclock_set_control_user_value_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesOverclockGetControlState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_overclock_get_control_state_params_t
+{
+    zes_overclock_handle_t* phDomainHandle;
+    zes_overclock_control_t* pDomainControl;
+    zes_control_state_t** ppControlState;
+    zes_pending_action_t** ppPendingAction;
+} zes_overclock_get_control_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesOverclockGetControlState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnOverclockGetControlStateCb_t)(
+    zes_overclock_get_control_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesOverclockGetVFPointValues
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_overclock_get_vf_point_values_params_t
+{
+    zes_overclock_handle_t* phDomainHandle;
+    zes_vf_type_t* pVFType;
+    zes_vf_array_type_t* pVFArrayType;
+    uint32_t* pPointIndex;
+    uint32_t** pPointValue;
+} zes_overclock_get_vf_point_values_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesOverclockGetVFPointValues
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnOverclockGetVFPointValuesCb_t)(
+    zes_overclock_get_vf_point_values_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesOverclockSetVFPointValues
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_overclock_set_vf_point_values_params_t
+{
+    zes_overclock_handle_t* phDomainHandle;
+    zes_vf_type_t* pVFType;
+    uint32_t* pPointIndex;
+    uint32_t* pPointValue;
+} zes_overclock_set_vf_point_values_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesOverclockSetVFPointValues
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnOverclockSetVFPointValuesCb_t)(
+    zes_overclock_set_vf_point_values_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPerformanceFactorGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_performance_factor_get_properties_params_t
+{
+    zes_perf_handle_t* phPerf;
+    zes_perf_properties_t** ppProperties;
+} zes_performance_factor_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPerformanceFactorGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPerformanceFactorGetPropertiesCb_t)(
+    zes_performance_factor_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPerformanceFactorGetConfig
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_performance_factor_get_config_params_t
+{
+    zes_perf_handle_t* phPerf;
+    double** ppFactor;
+} zes_performance_factor_get_config_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPerformanceFactorGetConfig
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPerformanceFactorGetConfigCb_t)(
+    zes_performance_factor_get_config_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPerformanceFactorSetConfig
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_performance_factor_set_config_params_t
+{
+    zes_perf_handle_t* phPerf;
+    double* pfactor;
+} zes_performance_factor_set_config_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPerformanceFactorSetConfig
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPerformanceFactorSetConfigCb_t)(
+    zes_performance_factor_set_config_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPowerGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_power_get_properties_params_t
+{
+    zes_pwr_handle_t* phPower;
+    zes_power_properties_t** ppProperties;
+} zes_power_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPowerGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPowerGetPropertiesCb_t)(
+    zes_power_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPowerGetEnergyCounter
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_power_get_energy_counter_params_t
+{
+    zes_pwr_handle_t* phPower;
+    zes_power_energy_counter_t** ppEnergy;
+} zes_power_get_energy_counter_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPowerGetEnergyCounter
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPowerGetEnergyCounterCb_t)(
+    zes_power_get_energy_counter_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPowerGetLimits
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_power_get_limits_params_t
+{
+    zes_pwr_handle_t* phPower;
+    zes_power_sustained_limit_t** ppSustained;
+    zes_power_burst_limit_t** ppBurst;
+    zes_power_peak_limit_t** ppPeak;
+} zes_power_get_limits_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPowerGetLimits
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPowerGetLimitsCb_t)(
+    zes_power_get_limits_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPowerSetLimits
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_power_set_limits_params_t
+{
+    zes_pwr_handle_t* phPower;
+    const zes_power_sustained_limit_t** ppSustained;
+    const zes_power_burst_limit_t** ppBurst;
+    const zes_power_peak_limit_t** ppPeak;
+} zes_power_set_limits_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPowerSetLimits
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPowerSetLimitsCb_t)(
+    zes_power_set_limits_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPowerGetEnergyThreshold
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_power_get_energy_threshold_params_t
+{
+    zes_pwr_handle_t* phPower;
+    zes_energy_threshold_t** ppThreshold;
+} zes_power_get_energy_threshold_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPowerGetEnergyThreshold
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPowerGetEnergyThresholdCb_t)(
+    zes_power_get_energy_threshold_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPowerSetEnergyThreshold
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_power_set_energy_threshold_params_t
+{
+    zes_pwr_handle_t* phPower;
+    double* pthreshold;
+} zes_power_set_energy_threshold_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPowerSetEnergyThreshold
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPowerSetEnergyThresholdCb_t)(
+    zes_power_set_energy_threshold_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPowerGetLimitsExt
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_power_get_limits_ext_params_t
+{
+    zes_pwr_handle_t* phPower;
+    uint32_t** ppCount;
+    zes_power_limit_ext_desc_t** ppSustained;
+} zes_power_get_limits_ext_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPowerGetLimitsExt
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPowerGetLimitsExtCb_t)(
+    zes_power_get_limits_ext_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPowerSetLimitsExt
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_power_set_limits_ext_params_t
+{
+    zes_pwr_handle_t* phPower;
+    uint32_t** ppCount;
+    zes_power_limit_ext_desc_t** ppSustained;
+} zes_power_set_limits_ext_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPowerSetLimitsExt
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPowerSetLimitsExtCb_t)(
+    zes_power_set_limits_ext_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPsuGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_psu_get_properties_params_t
+{
+    zes_psu_handle_t* phPsu;
+    zes_psu_properties_t** ppProperties;
+} zes_psu_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPsuGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPsuGetPropertiesCb_t)(
+    zes_psu_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesPsuGetState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_psu_get_state_params_t
+{
+    zes_psu_handle_t* phPsu;
+    zes_psu_state_t** ppState;
+} zes_psu_get_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesPsuGetState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnPsuGetStateCb_t)(
+    zes_psu_get_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesRasGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_ras_get_properties_params_t
+{
+    zes_ras_handle_t* phRas;
+    zes_ras_properties_t** ppProperties;
+} zes_ras_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesRasGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnRasGetPropertiesCb_t)(
+    zes_ras_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesRasGetConfig
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_ras_get_config_params_t
+{
+    zes_ras_handle_t* phRas;
+    zes_ras_config_t** ppConfig;
+} zes_ras_get_config_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesRasGetConfig
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnRasGetConfigCb_t)(
+    zes_ras_get_config_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesRasSetConfig
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_ras_set_config_params_t
+{
+    zes_ras_handle_t* phRas;
+    const zes_ras_config_t** ppConfig;
+} zes_ras_set_config_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesRasSetConfig
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnRasSetConfigCb_t)(
+    zes_ras_set_config_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesRasGetState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_ras_get_state_params_t
+{
+    zes_ras_handle_t* phRas;
+    ze_bool_t* pclear;
+    zes_ras_state_t** ppState;
+} zes_ras_get_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesRasGetState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnRasGetStateCb_t)(
+    zes_ras_get_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesRasGetStateExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_ras_get_state_exp_params_t
+{
+    zes_ras_handle_t* phRas;
+    uint32_t** ppCount;
+    zes_ras_state_exp_t** ppState;
+} zes_ras_get_state_exp_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesRasGetStateExp
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnRasGetStateExpCb_t)(
+    zes_ras_get_state_exp_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesRasClearStateExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_ras_clear_state_exp_params_t
+{
+    zes_ras_handle_t* phRas;
+    zes_ras_error_category_exp_t* pcategory;
+} zes_ras_clear_state_exp_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesRasClearStateExp
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnRasClearStateExpCb_t)(
+    zes_ras_clear_state_exp_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesSchedulerGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_scheduler_get_properties_params_t
+{
+    zes_sched_handle_t* phScheduler;
+    zes_sched_properties_t** ppProperties;
+} zes_scheduler_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesSchedulerGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnSchedulerGetPropertiesCb_t)(
+    zes_scheduler_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesSchedulerGetCurrentMode
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_scheduler_get_current_mode_params_t
+{
+    zes_sched_handle_t* phScheduler;
+    zes_sched_mode_t** ppMode;
+} zes_scheduler_get_current_mode_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesSchedulerGetCurrentMode
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnSchedulerGetCurrentModeCb_t)(
+    zes_scheduler_get_current_mode_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesSchedulerGetTimeoutModeProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_scheduler_get_timeout_mode_properties_params_t
+{
+    zes_sched_handle_t* phScheduler;
+    ze_bool_t* pgetDefaults;
+    zes_sched_timeout_properties_t** ppConfig;
+} zes_scheduler_get_timeout_mode_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesSchedulerGetTimeoutModeProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnSchedulerGetTimeoutModePropertiesCb_t)(
+    zes_scheduler_get_timeout_mode_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesSchedulerGetTimesliceModeProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_scheduler_get_timeslice_mode_properties_params_t
+{
+    zes_sched_handle_t* phScheduler;
+    ze_bool_t* pgetDefaults;
+    zes_sched_timeslice_properties_t** ppConfig;
+} zes_scheduler_get_timeslice_mode_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesSchedulerGetTimesliceModeProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnSchedulerGetTimesliceModePropertiesCb_t)(
+    zes_scheduler_get_timeslice_mode_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesSchedulerSetTimeoutMode
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_scheduler_set_timeout_mode_params_t
+{
+    zes_sched_handle_t* phScheduler;
+    zes_sched_timeout_properties_t** ppProperties;
+    ze_bool_t** ppNeedReload;
+} zes_scheduler_set_timeout_mode_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesSchedulerSetTimeoutMode
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnSchedulerSetTimeoutModeCb_t)(
+    zes_scheduler_set_timeout_mode_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesSchedulerSetTimesliceMode
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_scheduler_set_timeslice_mode_params_t
+{
+    zes_sched_handle_t* phScheduler;
+    zes_sched_timeslice_properties_t** ppProperties;
+    ze_bool_t** ppNeedReload;
+} zes_scheduler_set_timeslice_mode_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesSchedulerSetTimesliceMode
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnSchedulerSetTimesliceModeCb_t)(
+    zes_scheduler_set_timeslice_mode_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesSchedulerSetExclusiveMode
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_scheduler_set_exclusive_mode_params_t
+{
+    zes_sched_handle_t* phScheduler;
+    ze_bool_t** ppNeedReload;
+} zes_scheduler_set_exclusive_mode_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesSchedulerSetExclusiveMode
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnSchedulerSetExclusiveModeCb_t)(
+    zes_scheduler_set_exclusive_mode_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesSchedulerSetComputeUnitDebugMode
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_scheduler_set_compute_unit_debug_mode_params_t
+{
+    zes_sched_handle_t* phScheduler;
+    ze_bool_t** ppNeedReload;
+} zes_scheduler_set_compute_unit_debug_mode_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesSchedulerSetComputeUnitDebugMode
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnSchedulerSetComputeUnitDebugModeCb_t)(
+    zes_scheduler_set_compute_unit_debug_mode_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesStandbyGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_standby_get_properties_params_t
+{
+    zes_standby_handle_t* phStandby;
+    zes_standby_properties_t** ppProperties;
+} zes_standby_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesStandbyGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnStandbyGetPropertiesCb_t)(
+    zes_standby_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesStandbyGetMode
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_standby_get_mode_params_t
+{
+    zes_standby_handle_t* phStandby;
+    zes_standby_promo_mode_t** ppMode;
+} zes_standby_get_mode_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesStandbyGetMode
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnStandbyGetModeCb_t)(
+    zes_standby_get_mode_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesStandbySetMode
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_standby_set_mode_params_t
+{
+    zes_standby_handle_t* phStandby;
+    zes_standby_promo_mode_t* pmode;
+} zes_standby_set_mode_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesStandbySetMode
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnStandbySetModeCb_t)(
+    zes_standby_set_mode_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesTemperatureGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_temperature_get_properties_params_t
+{
+    zes_temp_handle_t* phTemperature;
+    zes_temp_properties_t** ppProperties;
+} zes_temperature_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesTemperatureGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnTemperatureGetPropertiesCb_t)(
+    zes_temperature_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesTemperatureGetConfig
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_temperature_get_config_params_t
+{
+    zes_temp_handle_t* phTemperature;
+    zes_temp_config_t** ppConfig;
+} zes_temperature_get_config_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesTemperatureGetConfig
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnTemperatureGetConfigCb_t)(
+    zes_temperature_get_config_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesTemperatureSetConfig
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_temperature_set_config_params_t
+{
+    zes_temp_handle_t* phTemperature;
+    const zes_temp_config_t** ppConfig;
+} zes_temperature_set_config_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesTemperatureSetConfig
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnTemperatureSetConfigCb_t)(
+    zes_temperature_set_config_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zesTemperatureGetState
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zes_temperature_get_state_params_t
+{
+    zes_temp_handle_t* phTemperature;
+    double** ppTemperature;
+} zes_temperature_get_state_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zesTemperatureGetState
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zes_pfnTemperatureGetStateCb_t)(
+    zes_temperature_get_state_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+/// APIs to register callbacks for each zes API
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesInitRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnInitCb_t pfnInitCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDriverGetRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDriverGetCb_t pfnGetCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceGetRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceGetCb_t pfnGetCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceGetStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceGetStateCb_t pfnGetStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceResetRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceResetCb_t pfnResetCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceResetExtRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceResetExtCb_t pfnResetExtCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceProcessesGetStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceProcessesGetStateCb_t pfnProcessesGetStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDevicePciGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDevicePciGetPropertiesCb_t pfnPciGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDevicePciGetStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDevicePciGetStateCb_t pfnPciGetStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDevicePciGetBarsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDevicePciGetBarsCb_t pfnPciGetBarsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDevicePciGetStatsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDevicePciGetStatsCb_t pfnPciGetStatsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceSetOverclockWaiverRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceSetOverclockWaiverCb_t pfnSetOverclockWaiverCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceGetOverclockDomainsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceGetOverclockDomainsCb_t pfnGetOverclockDomainsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceGetOverclockControlsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceGetOverclockControlsCb_t pfnGetOverclockControlsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceResetOverclockSettingsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceResetOverclockSettingsCb_t pfnResetOverclockSettingsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceReadOverclockStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceReadOverclockStateCb_t pfnReadOverclockStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumOverclockDomainsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumOverclockDomainsCb_t pfnEnumOverclockDomainsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesOverclockGetDomainPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnOverclockGetDomainPropertiesCb_t pfnGetDomainPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesOverclockGetDomainVFPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnOverclockGetDomainVFPropertiesCb_t pfnGetDomainVFPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesOverclockGetDomainControlPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnOverclockGetDomainControlPropertiesCb_t pfnGetDomainControlPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesOverclockGetControlCurrentValueRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnOverclockGetControlCurrentValueCb_t pfnGetControlCurrentValueCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesOverclockGetControlPendingValueRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnOverclockGetControlPendingValueCb_t pfnGetControlPendingValueCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesOverclockSetControlUserValueRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnOverclockSetControlUserValueCb_t pfnSetControlUserValueCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesOverclockGetControlStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnOverclockGetControlStateCb_t pfnGetControlStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesOverclockGetVFPointValuesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnOverclockGetVFPointValuesCb_t pfnGetVFPointValuesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesOverclockSetVFPointValuesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnOverclockSetVFPointValuesCb_t pfnSetVFPointValuesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumDiagnosticTestSuitesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumDiagnosticTestSuitesCb_t pfnEnumDiagnosticTestSuitesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDiagnosticsGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDiagnosticsGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDiagnosticsGetTestsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDiagnosticsGetTestsCb_t pfnGetTestsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDiagnosticsRunTestsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDiagnosticsRunTestsCb_t pfnRunTestsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEccAvailableRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEccAvailableCb_t pfnEccAvailableCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEccConfigurableRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEccConfigurableCb_t pfnEccConfigurableCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceGetEccStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceGetEccStateCb_t pfnGetEccStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceSetEccStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceSetEccStateCb_t pfnSetEccStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumEngineGroupsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumEngineGroupsCb_t pfnEnumEngineGroupsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesEngineGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnEngineGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesEngineGetActivityRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnEngineGetActivityCb_t pfnGetActivityCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEventRegisterRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEventRegisterCb_t pfnEventRegisterCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDriverEventListenRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDriverEventListenCb_t pfnEventListenCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDriverEventListenExRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDriverEventListenExCb_t pfnEventListenExCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumFabricPortsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumFabricPortsCb_t pfnEnumFabricPortsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFabricPortGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFabricPortGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFabricPortGetLinkTypeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFabricPortGetLinkTypeCb_t pfnGetLinkTypeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFabricPortGetConfigRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFabricPortGetConfigCb_t pfnGetConfigCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFabricPortSetConfigRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFabricPortSetConfigCb_t pfnSetConfigCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFabricPortGetStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFabricPortGetStateCb_t pfnGetStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFabricPortGetThroughputRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFabricPortGetThroughputCb_t pfnGetThroughputCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFabricPortGetFabricErrorCountersRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFabricPortGetFabricErrorCountersCb_t pfnGetFabricErrorCountersCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFabricPortGetMultiPortThroughputRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFabricPortGetMultiPortThroughputCb_t pfnGetMultiPortThroughputCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumFansRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumFansCb_t pfnEnumFansCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFanGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFanGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFanGetConfigRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFanGetConfigCb_t pfnGetConfigCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFanSetDefaultModeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFanSetDefaultModeCb_t pfnSetDefaultModeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFanSetFixedSpeedModeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFanSetFixedSpeedModeCb_t pfnSetFixedSpeedModeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFanSetSpeedTableModeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFanSetSpeedTableModeCb_t pfnSetSpeedTableModeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFanGetStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFanGetStateCb_t pfnGetStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumFirmwaresRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumFirmwaresCb_t pfnEnumFirmwaresCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFirmwareGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFirmwareGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFirmwareFlashRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFirmwareFlashCb_t pfnFlashCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumFrequencyDomainsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumFrequencyDomainsCb_t pfnEnumFrequencyDomainsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyGetAvailableClocksRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyGetAvailableClocksCb_t pfnGetAvailableClocksCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyGetRangeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyGetRangeCb_t pfnGetRangeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencySetRangeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencySetRangeCb_t pfnSetRangeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyGetStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyGetStateCb_t pfnGetStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyGetThrottleTimeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyGetThrottleTimeCb_t pfnGetThrottleTimeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyOcGetCapabilitiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyOcGetCapabilitiesCb_t pfnOcGetCapabilitiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyOcGetFrequencyTargetRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyOcGetFrequencyTargetCb_t pfnOcGetFrequencyTargetCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyOcSetFrequencyTargetRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyOcSetFrequencyTargetCb_t pfnOcSetFrequencyTargetCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyOcGetVoltageTargetRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyOcGetVoltageTargetCb_t pfnOcGetVoltageTargetCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyOcSetVoltageTargetRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyOcSetVoltageTargetCb_t pfnOcSetVoltageTargetCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyOcSetModeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyOcSetModeCb_t pfnOcSetModeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyOcGetModeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyOcGetModeCb_t pfnOcGetModeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyOcGetIccMaxRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyOcGetIccMaxCb_t pfnOcGetIccMaxCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyOcSetIccMaxRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyOcSetIccMaxCb_t pfnOcSetIccMaxCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyOcGetTjMaxRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyOcGetTjMaxCb_t pfnOcGetTjMaxCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesFrequencyOcSetTjMaxRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnFrequencyOcSetTjMaxCb_t pfnOcSetTjMaxCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumLedsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumLedsCb_t pfnEnumLedsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesLedGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnLedGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesLedGetStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnLedGetStateCb_t pfnGetStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesLedSetStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnLedSetStateCb_t pfnSetStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesLedSetColorRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnLedSetColorCb_t pfnSetColorCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumMemoryModulesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumMemoryModulesCb_t pfnEnumMemoryModulesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesMemoryGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnMemoryGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesMemoryGetStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnMemoryGetStateCb_t pfnGetStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesMemoryGetBandwidthRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnMemoryGetBandwidthCb_t pfnGetBandwidthCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumPerformanceFactorDomainsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumPerformanceFactorDomainsCb_t pfnEnumPerformanceFactorDomainsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPerformanceFactorGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPerformanceFactorGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPerformanceFactorGetConfigRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPerformanceFactorGetConfigCb_t pfnGetConfigCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPerformanceFactorSetConfigRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPerformanceFactorSetConfigCb_t pfnSetConfigCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumPowerDomainsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumPowerDomainsCb_t pfnEnumPowerDomainsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceGetCardPowerDomainRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceGetCardPowerDomainCb_t pfnGetCardPowerDomainCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPowerGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPowerGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPowerGetEnergyCounterRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPowerGetEnergyCounterCb_t pfnGetEnergyCounterCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPowerGetLimitsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPowerGetLimitsCb_t pfnGetLimitsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPowerSetLimitsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPowerSetLimitsCb_t pfnSetLimitsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPowerGetEnergyThresholdRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPowerGetEnergyThresholdCb_t pfnGetEnergyThresholdCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPowerSetEnergyThresholdRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPowerSetEnergyThresholdCb_t pfnSetEnergyThresholdCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumPsusRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumPsusCb_t pfnEnumPsusCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPsuGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPsuGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPsuGetStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPsuGetStateCb_t pfnGetStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumRasErrorSetsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumRasErrorSetsCb_t pfnEnumRasErrorSetsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesRasGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnRasGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesRasGetConfigRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnRasGetConfigCb_t pfnGetConfigCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesRasSetConfigRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnRasSetConfigCb_t pfnSetConfigCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesRasGetStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnRasGetStateCb_t pfnGetStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumSchedulersRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumSchedulersCb_t pfnEnumSchedulersCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesSchedulerGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnSchedulerGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesSchedulerGetCurrentModeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnSchedulerGetCurrentModeCb_t pfnGetCurrentModeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesSchedulerGetTimeoutModePropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnSchedulerGetTimeoutModePropertiesCb_t pfnGetTimeoutModePropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesSchedulerGetTimesliceModePropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnSchedulerGetTimesliceModePropertiesCb_t pfnGetTimesliceModePropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesSchedulerSetTimeoutModeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnSchedulerSetTimeoutModeCb_t pfnSetTimeoutModeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesSchedulerSetTimesliceModeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnSchedulerSetTimesliceModeCb_t pfnSetTimesliceModeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesSchedulerSetExclusiveModeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnSchedulerSetExclusiveModeCb_t pfnSetExclusiveModeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesSchedulerSetComputeUnitDebugModeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnSchedulerSetComputeUnitDebugModeCb_t pfnSetComputeUnitDebugModeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumStandbyDomainsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumStandbyDomainsCb_t pfnEnumStandbyDomainsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesStandbyGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnStandbyGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesStandbyGetModeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnStandbyGetModeCb_t pfnGetModeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesStandbySetModeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnStandbySetModeCb_t pfnSetModeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesDeviceEnumTemperatureSensorsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnDeviceEnumTemperatureSensorsCb_t pfnEnumTemperatureSensorsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesTemperatureGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnTemperatureGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesTemperatureGetConfigRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnTemperatureGetConfigCb_t pfnGetConfigCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesTemperatureSetConfigRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnTemperatureSetConfigCb_t pfnSetConfigCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesTemperatureGetStateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnTemperatureGetStateCb_t pfnGetStateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPowerGetLimitsExtRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPowerGetLimitsExtCb_t pfnGetLimitsExtCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesPowerSetLimitsExtRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnPowerSetLimitsExtCb_t pfnSetLimitsExtCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesEngineGetActivityExtRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnEngineGetActivityExtCb_t pfnGetActivityExtCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesRasGetStateExpRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnRasGetStateExpCb_t pfnGetStateExpCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZesRasClearStateExpRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zes_pfnRasClearStateExpCb_t pfnClearStateExpCb
+    );
+
+
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+#endif // zes_tracing_register_cb_H
@@ -0,0 +1,1551 @@
+/*
+ *
+ * Copyright (C) 2021-2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zet_tracing_register_cb.h
+ *
+ */
+#ifndef zet_tracing_register_cb_H
+#define zet_tracing_register_cb_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "../zet_api.h"
+#include "zel_tracing_register_cb.h"
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/// Callback definitions for all zet APIs
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDeviceGetDebugProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_device_get_debug_properties_params_t
+{
+    zet_device_handle_t* phDevice;
+    zet_device_debug_properties_t** ppDebugProperties;
+} zet_device_get_debug_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDeviceGetDebugProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDeviceGetDebugPropertiesCb_t)(
+    zet_device_get_debug_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetContextActivateMetricGroups
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_context_activate_metric_groups_params_t
+{
+    zet_context_handle_t* phContext;
+    zet_device_handle_t* phDevice;
+    uint32_t* pcount;
+    zet_metric_group_handle_t** pphMetricGroups;
+} zet_context_activate_metric_groups_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetContextActivateMetricGroups
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnContextActivateMetricGroupsCb_t)(
+    zet_context_activate_metric_groups_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetCommandListAppendMetricStreamerMarker
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_command_list_append_metric_streamer_marker_params_t
+{
+    zet_command_list_handle_t* phCommandList;
+    zet_metric_streamer_handle_t* phMetricStreamer;
+    uint32_t* pvalue;
+} zet_command_list_append_metric_streamer_marker_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetCommandListAppendMetricStreamerMarker
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnCommandListAppendMetricStreamerMarkerCb_t)(
+    zet_command_list_append_metric_streamer_marker_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetCommandListAppendMetricQueryBegin
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_command_list_append_metric_query_begin_params_t
+{
+    zet_command_list_handle_t* phCommandList;
+    zet_metric_query_handle_t* phMetricQuery;
+} zet_command_list_append_metric_query_begin_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetCommandListAppendMetricQueryBegin
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnCommandListAppendMetricQueryBeginCb_t)(
+    zet_command_list_append_metric_query_begin_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetCommandListAppendMetricQueryEnd
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_command_list_append_metric_query_end_params_t
+{
+    zet_command_list_handle_t* phCommandList;
+    zet_metric_query_handle_t* phMetricQuery;
+    ze_event_handle_t* phSignalEvent;
+    uint32_t* pnumWaitEvents;
+    ze_event_handle_t** pphWaitEvents;
+} zet_command_list_append_metric_query_end_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetCommandListAppendMetricQueryEnd
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnCommandListAppendMetricQueryEndCb_t)(
+    zet_command_list_append_metric_query_end_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetCommandListAppendMetricMemoryBarrier
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_command_list_append_metric_memory_barrier_params_t
+{
+    zet_command_list_handle_t* phCommandList;
+} zet_command_list_append_metric_memory_barrier_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetCommandListAppendMetricMemoryBarrier
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnCommandListAppendMetricMemoryBarrierCb_t)(
+    zet_command_list_append_metric_memory_barrier_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetKernelGetProfileInfo
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_kernel_get_profile_info_params_t
+{
+    zet_kernel_handle_t* phKernel;
+    zet_profile_properties_t** ppProfileProperties;
+} zet_kernel_get_profile_info_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetKernelGetProfileInfo
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnKernelGetProfileInfoCb_t)(
+    zet_kernel_get_profile_info_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetModuleGetDebugInfo
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_module_get_debug_info_params_t
+{
+    zet_module_handle_t* phModule;
+    zet_module_debug_info_format_t* pformat;
+    size_t** ppSize;
+    uint8_t** ppDebugInfo;
+} zet_module_get_debug_info_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetModuleGetDebugInfo
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnModuleGetDebugInfoCb_t)(
+    zet_module_get_debug_info_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDebugAttach
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_debug_attach_params_t
+{
+    zet_device_handle_t* phDevice;
+    const zet_debug_config_t** pconfig;
+    zet_debug_session_handle_t** pphDebug;
+} zet_debug_attach_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDebugAttach
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDebugAttachCb_t)(
+    zet_debug_attach_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDebugDetach
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_debug_detach_params_t
+{
+    zet_debug_session_handle_t* phDebug;
+} zet_debug_detach_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDebugDetach
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDebugDetachCb_t)(
+    zet_debug_detach_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDebugReadEvent
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_debug_read_event_params_t
+{
+    zet_debug_session_handle_t* phDebug;
+    uint64_t* ptimeout;
+    zet_debug_event_t** pevent;
+} zet_debug_read_event_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDebugReadEvent
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDebugReadEventCb_t)(
+    zet_debug_read_event_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDebugAcknowledgeEvent
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_debug_acknowledge_event_params_t
+{
+    zet_debug_session_handle_t* phDebug;
+    const zet_debug_event_t** pevent;
+} zet_debug_acknowledge_event_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDebugAcknowledgeEvent
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDebugAcknowledgeEventCb_t)(
+    zet_debug_acknowledge_event_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDebugInterrupt
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_debug_interrupt_params_t
+{
+    zet_debug_session_handle_t* phDebug;
+    ze_device_thread_t* pthread;
+} zet_debug_interrupt_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDebugInterrupt
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDebugInterruptCb_t)(
+    zet_debug_interrupt_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDebugResume
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_debug_resume_params_t
+{
+    zet_debug_session_handle_t* phDebug;
+    ze_device_thread_t* pthread;
+} zet_debug_resume_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDebugResume
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDebugResumeCb_t)(
+    zet_debug_resume_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDebugReadMemory
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_debug_read_memory_params_t
+{
+    zet_debug_session_handle_t* phDebug;
+    ze_device_thread_t* pthread;
+    const zet_debug_memory_space_desc_t** pdesc;
+    size_t* psize;
+    void** pbuffer;
+} zet_debug_read_memory_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDebugReadMemory
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDebugReadMemoryCb_t)(
+    zet_debug_read_memory_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDebugWriteMemory
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_debug_write_memory_params_t
+{
+    zet_debug_session_handle_t* phDebug;
+    ze_device_thread_t* pthread;
+    const zet_debug_memory_space_desc_t** pdesc;
+    size_t* psize;
+    const void** pbuffer;
+} zet_debug_write_memory_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDebugWriteMemory
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDebugWriteMemoryCb_t)(
+    zet_debug_write_memory_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDebugGetRegisterSetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_debug_get_register_set_properties_params_t
+{
+    zet_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zet_debug_regset_properties_t** ppRegisterSetProperties;
+} zet_debug_get_register_set_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDebugGetRegisterSetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDebugGetRegisterSetPropertiesCb_t)(
+    zet_debug_get_register_set_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDebugReadRegisters
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_debug_read_registers_params_t
+{
+    zet_debug_session_handle_t* phDebug;
+    ze_device_thread_t* pthread;
+    uint32_t* ptype;
+    uint32_t* pstart;
+    uint32_t* pcount;
+    void** ppRegisterValues;
+} zet_debug_read_registers_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDebugReadRegisters
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDebugReadRegistersCb_t)(
+    zet_debug_read_registers_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDebugWriteRegisters
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_debug_write_registers_params_t
+{
+    zet_debug_session_handle_t* phDebug;
+    ze_device_thread_t* pthread;
+    uint32_t* ptype;
+    uint32_t* pstart;
+    uint32_t* pcount;
+    void** ppRegisterValues;
+} zet_debug_write_registers_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDebugWriteRegisters
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDebugWriteRegistersCb_t)(
+    zet_debug_write_registers_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetDebugGetThreadRegisterSetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_debug_get_thread_register_set_properties_params_t
+{
+    zet_debug_session_handle_t* phDebug;
+    ze_device_thread_t* pthread;
+    uint32_t** ppCount;
+    zet_debug_regset_properties_t** ppRegisterSetProperties;
+} zet_debug_get_thread_register_set_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetDebugGetThreadRegisterSetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnDebugGetThreadRegisterSetPropertiesCb_t)(
+    zet_debug_get_thread_register_set_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricGet
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_get_params_t
+{
+    zet_metric_group_handle_t* phMetricGroup;
+    uint32_t** ppCount;
+    zet_metric_handle_t** pphMetrics;
+} zet_metric_get_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricGet
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricGetCb_t)(
+    zet_metric_get_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_get_properties_params_t
+{
+    zet_metric_handle_t* phMetric;
+    zet_metric_properties_t** ppProperties;
+} zet_metric_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricGetPropertiesCb_t)(
+    zet_metric_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricGroupGet
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_group_get_params_t
+{
+    zet_device_handle_t* phDevice;
+    uint32_t** ppCount;
+    zet_metric_group_handle_t** pphMetricGroups;
+} zet_metric_group_get_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricGroupGet
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricGroupGetCb_t)(
+    zet_metric_group_get_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricGroupGetProperties
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_group_get_properties_params_t
+{
+    zet_metric_group_handle_t* phMetricGroup;
+    zet_metric_group_properties_t** ppProperties;
+} zet_metric_group_get_properties_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricGroupGetProperties
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricGroupGetPropertiesCb_t)(
+    zet_metric_group_get_properties_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricGroupCalculateMetricValues
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_group_calculate_metric_values_params_t
+{
+    zet_metric_group_handle_t* phMetricGroup;
+    zet_metric_group_calculation_type_t* ptype;
+    size_t* prawDataSize;
+    const uint8_t** ppRawData;
+    uint32_t** ppMetricValueCount;
+    zet_typed_value_t** ppMetricValues;
+} zet_metric_group_calculate_metric_values_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricGroupCalculateMetricValues
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricGroupCalculateMetricValuesCb_t)(
+    zet_metric_group_calculate_metric_values_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricGroupCalculateMultipleMetricValuesExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_group_calculate_multiple_metric_values_exp_params_t
+{
+    zet_metric_group_handle_t* phMetricGroup;
+    zet_metric_group_calculation_type_t* ptype;
+    size_t* prawDataSize;
+    const uint8_t** ppRawData;
+    uint32_t** ppSetCount;
+    uint32_t** ppTotalMetricValueCount;
+    uint32_t** ppMetricCounts;
+    zet_typed_value_t** ppMetricValues;
+} zet_metric_group_calculate_multiple_metric_values_exp_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricGroupCalculateMultipleMetricValuesExp
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricGroupCalculateMultipleMetricValuesExpCb_t)(
+    zet_metric_group_calculate_multiple_metric_values_exp_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricGroupGetGlobalTimestampsExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_group_get_global_timestamps_exp_params_t
+{
+    zet_metric_group_handle_t* phMetricGroup;
+    ze_bool_t* psynchronizedWithHost;
+    uint64_t** pglobalTimestamp;
+    uint64_t** pmetricTimestamp;
+} zet_metric_group_get_global_timestamps_exp_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricGroupGetGlobalTimestampsExp
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricGroupGetGlobalTimestampsExpCb_t)(
+    zet_metric_group_get_global_timestamps_exp_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricGroupGetExportDataExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_group_get_export_data_exp_params_t
+{
+    zet_metric_group_handle_t* phMetricGroup;
+    const uint8_t** ppRawData;
+    size_t* prawDataSize;
+    size_t** ppExportDataSize;
+    uint8_t ** ppExportData;
+} zet_metric_group_get_export_data_exp_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricGroupGetExportDataExp
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricGroupGetExportDataExpCb_t)(
+    zet_metric_group_get_export_data_exp_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricGroupCalculateMetricExportDataExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_group_calculate_metric_export_data_exp_params_t
+{
+    ze_driver_handle_t* phDriver;
+    zet_metric_group_calculation_type_t* ptype;
+    size_t* pexportDataSize;
+    const uint8_t** ppExportData;
+    zet_metric_calculate_exp_desc_t** ppCalculateDescriptor;
+    uint32_t** ppSetCount;
+    uint32_t** ppTotalMetricValueCount;
+    uint32_t** ppMetricCounts;
+    zet_typed_value_t** ppMetricValues;
+} zet_metric_group_calculate_metric_export_data_exp_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricGroupCalculateMetricExportDataExp
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricGroupCalculateMetricExportDataExpCb_t)(
+    zet_metric_group_calculate_metric_export_data_exp_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricQueryCreate
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_query_create_params_t
+{
+    zet_metric_query_pool_handle_t* phMetricQueryPool;
+    uint32_t* pindex;
+    zet_metric_query_handle_t** pphMetricQuery;
+} zet_metric_query_create_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricQueryCreate
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricQueryCreateCb_t)(
+    zet_metric_query_create_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricQueryDestroy
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_query_destroy_params_t
+{
+    zet_metric_query_handle_t* phMetricQuery;
+} zet_metric_query_destroy_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricQueryDestroy
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricQueryDestroyCb_t)(
+    zet_metric_query_destroy_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricQueryReset
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_query_reset_params_t
+{
+    zet_metric_query_handle_t* phMetricQuery;
+} zet_metric_query_reset_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricQueryReset
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricQueryResetCb_t)(
+    zet_metric_query_reset_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricQueryGetData
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_query_get_data_params_t
+{
+    zet_metric_query_handle_t* phMetricQuery;
+    size_t** ppRawDataSize;
+    uint8_t** ppRawData;
+} zet_metric_query_get_data_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricQueryGetData
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricQueryGetDataCb_t)(
+    zet_metric_query_get_data_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricQueryPoolCreate
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_query_pool_create_params_t
+{
+    zet_context_handle_t* phContext;
+    zet_device_handle_t* phDevice;
+    zet_metric_group_handle_t* phMetricGroup;
+    const zet_metric_query_pool_desc_t** pdesc;
+    zet_metric_query_pool_handle_t** pphMetricQueryPool;
+} zet_metric_query_pool_create_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricQueryPoolCreate
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricQueryPoolCreateCb_t)(
+    zet_metric_query_pool_create_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricQueryPoolDestroy
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_query_pool_destroy_params_t
+{
+    zet_metric_query_pool_handle_t* phMetricQueryPool;
+} zet_metric_query_pool_destroy_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricQueryPoolDestroy
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricQueryPoolDestroyCb_t)(
+    zet_metric_query_pool_destroy_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricStreamerOpen
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_streamer_open_params_t
+{
+    zet_context_handle_t* phContext;
+    zet_device_handle_t* phDevice;
+    zet_metric_group_handle_t* phMetricGroup;
+    zet_metric_streamer_desc_t** pdesc;
+    ze_event_handle_t* phNotificationEvent;
+    zet_metric_streamer_handle_t** pphMetricStreamer;
+} zet_metric_streamer_open_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricStreamerOpen
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricStreamerOpenCb_t)(
+    zet_metric_streamer_open_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricStreamerClose
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_streamer_close_params_t
+{
+    zet_metric_streamer_handle_t* phMetricStreamer;
+} zet_metric_streamer_close_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricStreamerClose
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricStreamerCloseCb_t)(
+    zet_metric_streamer_close_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetMetricStreamerReadData
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_metric_streamer_read_data_params_t
+{
+    zet_metric_streamer_handle_t* phMetricStreamer;
+    uint32_t* pmaxReportCount;
+    size_t** ppRawDataSize;
+    uint8_t** ppRawData;
+} zet_metric_streamer_read_data_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetMetricStreamerReadData
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnMetricStreamerReadDataCb_t)(
+    zet_metric_streamer_read_data_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetTracerExpCreate
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_tracer_exp_create_params_t
+{
+    zet_context_handle_t* phContext;
+    const zet_tracer_exp_desc_t** pdesc;
+    zet_tracer_exp_handle_t** pphTracer;
+} zet_tracer_exp_create_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetTracerExpCreate
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnTracerExpCreateCb_t)(
+    zet_tracer_exp_create_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetTracerExpDestroy
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_tracer_exp_destroy_params_t
+{
+    zet_tracer_exp_handle_t* phTracer;
+} zet_tracer_exp_destroy_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetTracerExpDestroy
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnTracerExpDestroyCb_t)(
+    zet_tracer_exp_destroy_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetTracerExpSetPrologues
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_tracer_exp_set_prologues_params_t
+{
+    zet_tracer_exp_handle_t* phTracer;
+    zet_core_callbacks_t** ppCoreCbs;
+} zet_tracer_exp_set_prologues_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetTracerExpSetPrologues
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnTracerExpSetProloguesCb_t)(
+    zet_tracer_exp_set_prologues_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetTracerExpSetEpilogues
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_tracer_exp_set_epilogues_params_t
+{
+    zet_tracer_exp_handle_t* phTracer;
+    zet_core_callbacks_t** ppCoreCbs;
+} zet_tracer_exp_set_epilogues_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetTracerExpSetEpilogues
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnTracerExpSetEpiloguesCb_t)(
+    zet_tracer_exp_set_epilogues_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function parameters for zetTracerExpSetEnabled
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+
+typedef struct _zet_tracer_exp_set_enabled_params_t
+{
+    zet_tracer_exp_handle_t* phTracer;
+    ze_bool_t* penable;
+} zet_tracer_exp_set_enabled_params_t;
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback function-pointer for zetTracerExpSetEnabled
+/// @param[in] params Parameters passed to this instance
+/// @param[in] result Return value
+/// @param[in] pTracerUserData Per-Tracer user data
+/// @param[in,out] ppTracerInstanceUserData Per-Tracer, Per-Instance user data
+
+typedef void (ZE_APICALL *zet_pfnTracerExpSetEnabledCb_t)(
+    zet_tracer_exp_set_enabled_params_t* params,
+    ze_result_t result,
+    void* pTracerUserData,
+    void** ppTracerInstanceUserData
+    );
+
+/// APIs to register callbacks for each zet API
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetModuleGetDebugInfoRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnModuleGetDebugInfoCb_t pfnGetDebugInfoCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDeviceGetDebugPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDeviceGetDebugPropertiesCb_t pfnGetDebugPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDebugAttachRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDebugAttachCb_t pfnAttachCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDebugDetachRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDebugDetachCb_t pfnDetachCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDebugReadEventRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDebugReadEventCb_t pfnReadEventCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDebugAcknowledgeEventRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDebugAcknowledgeEventCb_t pfnAcknowledgeEventCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDebugInterruptRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDebugInterruptCb_t pfnInterruptCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDebugResumeRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDebugResumeCb_t pfnResumeCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDebugReadMemoryRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDebugReadMemoryCb_t pfnReadMemoryCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDebugWriteMemoryRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDebugWriteMemoryCb_t pfnWriteMemoryCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDebugGetRegisterSetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDebugGetRegisterSetPropertiesCb_t pfnGetRegisterSetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDebugGetThreadRegisterSetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDebugGetThreadRegisterSetPropertiesCb_t pfnGetThreadRegisterSetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDebugReadRegistersRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDebugReadRegistersCb_t pfnReadRegistersCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetDebugWriteRegistersRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnDebugWriteRegistersCb_t pfnWriteRegistersCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricGroupGetRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricGroupGetCb_t pfnGetCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricGroupGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricGroupGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricGroupCalculateMetricValuesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricGroupCalculateMetricValuesCb_t pfnCalculateMetricValuesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricGetRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricGetCb_t pfnGetCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricGetPropertiesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricGetPropertiesCb_t pfnGetPropertiesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetContextActivateMetricGroupsRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnContextActivateMetricGroupsCb_t pfnActivateMetricGroupsCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricStreamerOpenRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricStreamerOpenCb_t pfnOpenCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetCommandListAppendMetricStreamerMarkerRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnCommandListAppendMetricStreamerMarkerCb_t pfnAppendMetricStreamerMarkerCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricStreamerCloseRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricStreamerCloseCb_t pfnCloseCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricStreamerReadDataRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricStreamerReadDataCb_t pfnReadDataCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricQueryPoolCreateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricQueryPoolCreateCb_t pfnCreateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricQueryPoolDestroyRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricQueryPoolDestroyCb_t pfnDestroyCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricQueryCreateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricQueryCreateCb_t pfnCreateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricQueryDestroyRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricQueryDestroyCb_t pfnDestroyCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricQueryResetRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricQueryResetCb_t pfnResetCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetCommandListAppendMetricQueryBeginRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnCommandListAppendMetricQueryBeginCb_t pfnAppendMetricQueryBeginCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetCommandListAppendMetricQueryEndRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnCommandListAppendMetricQueryEndCb_t pfnAppendMetricQueryEndCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetCommandListAppendMetricMemoryBarrierRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnCommandListAppendMetricMemoryBarrierCb_t pfnAppendMetricMemoryBarrierCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricQueryGetDataRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricQueryGetDataCb_t pfnGetDataCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetKernelGetProfileInfoRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnKernelGetProfileInfoCb_t pfnGetProfileInfoCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetTracerExpCreateRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnTracerExpCreateCb_t pfnCreateCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetTracerExpDestroyRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnTracerExpDestroyCb_t pfnDestroyCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetTracerExpSetProloguesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnTracerExpSetProloguesCb_t pfnSetProloguesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetTracerExpSetEpiloguesRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnTracerExpSetEpiloguesCb_t pfnSetEpiloguesCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetTracerExpSetEnabledRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnTracerExpSetEnabledCb_t pfnSetEnabledCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricGroupCalculateMultipleMetricValuesExpRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricGroupCalculateMultipleMetricValuesExpCb_t pfnCalculateMultipleMetricValuesExpCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricGroupGetGlobalTimestampsExpRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricGroupGetGlobalTimestampsExpCb_t pfnGetGlobalTimestampsExpCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricGroupGetExportDataExpRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricGroupGetExportDataExpCb_t pfnGetExportDataExpCb
+    );
+
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerZetMetricGroupCalculateMetricExportDataExpRegisterCallback(
+    zel_tracer_handle_t hTracer,
+    zel_tracer_reg_t callback_type,
+    zet_pfnMetricGroupCalculateMetricExportDataExpCb_t pfnCalculateMetricExportDataExpCb
+    );
+
+
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+#endif // zet_tracing_register_cb_H
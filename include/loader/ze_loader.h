@@ -64,6 +64,23 @@ zelLoaderTranslateHandle(
    void *handleIn,                  //Input: handle to translate from loader handle to driver handle
    void **handleOut);                //Output: Pointer to handleOut is set to driver handle if successful
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Optional driver export negotiating dispatch on driver handles.
+///
+/// @details
+///     - The loader calls this function, if a driver exports it, once after
+///       loading the driver and before calling any other driver function.
+///     - By returning ::ZE_RESULT_SUCCESS the driver agrees that every handle
+///       it returns from then on points to an object whose first member is
+///       set to pLoaderDdiTable.
+///     - The loader then forwards calls made on that driver's handles without
+///       wrapping them into loader handles, even when several drivers are
+///       present or loader intercepts are forced.
+///     - Any other result keeps the driver on the default handle translation.
+#define ZEL_DRIVER_SET_LOADER_DDI_TABLE_NAME "zelDriverSetLoaderDdiTable"
+typedef ze_result_t (ZE_APICALL *zel_pfnDriverSetLoaderDdiTable_t)(
+   void *pLoaderDdiTable);              //Input: value the driver stores as the first member of its handles
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for handling calls to released drivers in teardown.
 ///
@@ -82,6 +99,20 @@ zelEnableTracingLayer();
 ZE_DLLEXPORT ze_result_t ZE_APICALL
 zelDisableTracingLayer();
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for Enabling the Tracing Layer for the calling
+///        thread only.
+///
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelEnableTracingLayerForThread();
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for Disabling the Tracing Layer for the calling
+///        thread only.
+///
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelDisableTracingLayerForThread();
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -186,7 +186,8 @@ def _mako_tracing_layer_h(path, namespace, tags, version, specs, meta):
     template = "trc_setters.h.mako"
     fin = os.path.join(tracing_templates_dir, template)
 
-    name = "zel_tracing_register_cb"
+    # the core header also declares the tracer handle and includes the others
+    name = "zel_tracing_register_cb" if namespace == tags['$x'] else "%s_tracing_register_cb"%(namespace)
     filename = "%s.h"%(name)
     fout = os.path.join(dstpath, filename)
 
@@ -228,7 +229,7 @@ def _mako_tracing_layer_cpp(path, namespace, tags, version, specs, meta):
     template = "trc_setters.cpp.mako"
     fin = os.path.join(tracing_templates_dir, template)
 
-    name = "ze_tracing_register_cb"
+    name = "%s_tracing_register_cb"%(namespace)
     filename = "%s.cpp"%(name)
     fout = os.path.join(dstpath, filename)
 
@@ -245,7 +246,7 @@ def _mako_tracing_layer_cpp(path, namespace, tags, version, specs, meta):
     template = "trc_cb_struct.h.mako"
     fin = os.path.join(tracing_templates_dir, template)
 
-    name = "ze_tracing_cb_structs"
+    name = "%s_tracing_cb_structs"%(namespace)
     filename = "%s.h"%(name)
     fout = os.path.join(dstpath, filename)
 
@@ -271,7 +272,7 @@ def _mako_tracing_lib_cpp(path, namespace, tags, version, specs, meta):
     template = "trc_register_cb_libapi.cpp.mako"
     fin = os.path.join(tracing_templates_dir, template)
 
-    name = "ze_tracing_register_cb_libapi"
+    name = "%s_tracing_register_cb_libapi"%(namespace)
     filename = "%s.cpp"%(name)
     fout = os.path.join(dstpath, filename)
 
@@ -348,13 +349,12 @@ def generate_layers(path, section, namespace, tags, version, specs, meta):
     loc = 0
     loc += _mako_validation_layer_cpp(layer_dstpath, namespace, tags, version, specs, meta)
     print("VALIDATION Generated %s lines of code.\n"%loc)
-    if section == "core":
-        loc += _mako_tracing_layer_cpp(layer_dstpath, namespace, tags, version, specs, meta)
-        print("TRACING Generated %s lines of code.\n"%loc)
-        loc += _mako_tracing_lib_cpp(path, namespace, tags, version, specs, meta)
-        print("TRACING Generated %s lines of code.\n"%loc)       
-        loc += _mako_tracing_layer_h(include_dstpath, namespace, tags, version, specs, meta)
-        print("TRACING header Generated %s lines of code.\n"%loc)
+    loc += _mako_tracing_layer_cpp(layer_dstpath, namespace, tags, version, specs, meta)
+    print("TRACING Generated %s lines of code.\n"%loc)
+    loc += _mako_tracing_lib_cpp(path, namespace, tags, version, specs, meta)
+    print("TRACING Generated %s lines of code.\n"%loc)
+    loc += _mako_tracing_layer_h(include_dstpath, namespace, tags, version, specs, meta)
+    print("TRACING header Generated %s lines of code.\n"%loc)
 
 """
 Entry-point:
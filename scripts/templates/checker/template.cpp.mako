@@ -21,7 +21,10 @@ namespace validation_layer
             ${name}_checker.zeValidation = zeChecker;
             ${name}_checker.zetValidation = zetChecker;
             ${name}_checker.zesValidation = zesChecker;
-            validation_layer::context.validationHandlers.push_back(&${name}_checker);
+            ${name}_checker.zeEntryPoints = getZEOverriddenEntryPoints<${name}Checker::ZE${name}Checker>();
+            ${name}_checker.zetEntryPoints = getZETOverriddenEntryPoints<${name}Checker::ZET${name}Checker>();
+            ${name}_checker.zesEntryPoints = getZESOverriddenEntryPoints<${name}Checker::ZES${name}Checker>();
+            validation_layer::context.addValidationChecker(&${name}_checker);
         }
     }
 
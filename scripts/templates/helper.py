@@ -1611,8 +1611,11 @@ def make_tracing_func_name(namespace, tags, obj):
     x_tag = tags['$x']
     tags['$x'] = '' #temporaly remove namespace tag so funx doesn't contain "ze"
     fname =  subt(namespace, tags, "%s%s"%(cname, obj['name']), cpp=False)
-    fname = "zelTracer" + fname + "RegisterCallback" 
     tags['$x'] = x_tag
+    if namespace != x_tag:
+        # keep the tools or sysman namespace, e.g. "zesPowerGet" -> "ZesPowerGet"
+        fname = fname[0].upper() + fname[1:]
+    fname = "zelTracer" + fname + "RegisterCallback" 
     return fname
 
 
@@ -1743,8 +1746,21 @@ def get_callback_table_name(namespace, tags, obj):
     cname = obj_traits.class_name(obj)
     name = subt(namespace, tags, cname, cpp=True) # i.e., "$x" -> ""
     name = name if len(name) > 0 else "Global"
+    container = get_callback_container_name(namespace, tags)
+    if container:
+        name = "%s.%s"%(container, name)
     return name
 
+"""
+Public:
+    returns the name of the member holding the callback tables of a namespace
+    in the tracing layer's container of all callbacks; empty for core
+"""
+def get_callback_container_name(namespace, tags):
+    if namespace == tags['$x']:
+        return ""
+    return {'zet': "Tools", 'zes': "Sysman"}[namespace]
+
 """
 Public:
     returns a list of dict of each pfntables needed
@@ -1825,7 +1841,10 @@ def get_zel_pfncbtables(specs, meta, namespace, tags):
         objs = get_class_function_objs(specs, cname, 1.0, 9999)
         if len(objs) > 0:
             name = get_table_name(namespace, tags, {'class': cname})
-            table = "zel_%s_callbacks_t"%(_camel_to_snake(name))
+            if namespace == tags['$x']:
+                table = "zel_%s_callbacks_t"%(_camel_to_snake(name))
+            else:
+                table = "zel_%s_%s_callbacks_t"%(namespace, _camel_to_snake(name))
             tables.append({
                 'name': name, 
                 'type': table,
@@ -35,7 +35,7 @@ namespace loader
     {
         ${x}_result_t result = ${X}_RESULT_SUCCESS;<%
         add_local = False
-        arrays_to_delete = []
+        cached = re.match(r"zeDeviceGet(SubDevices)?$", th.make_func_name(n, tags, obj)) is not None
     %>
 
         %if re.match(r"Init", obj['name']) and not re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
@@ -57,6 +57,18 @@ namespace loader
             result=ZE_RESULT_ERROR_UNINITIALIZED;
 
         %elif re.match(r"\w+DriverGet$", th.make_func_name(n, tags, obj)) or re.match(r"\w+InitDrivers$", th.make_func_name(n, tags, obj)):
+        %if namespace == "ze" and re.match(r"\w+DriverGet$", th.make_func_name(n, tags, obj)):
+        // repeat enumerations are answered from the cache
+        uint32_t requestedCount = *${obj['params'][0]['name']};
+        if( context->enumeration_cache.get( nullptr, ${obj['params'][0]['name']}, ${obj['params'][1]['name']} ) )
+            return ${X}_RESULT_SUCCESS;
+
+        %elif namespace == "ze":
+        // drivers reported for other driver types may differ
+        if( nullptr != desc )
+            context->enumeration_cache.update_init_driver_flags( desc->flags );
+
+        %endif
         uint32_t total_driver_handle_count = 0;
 
         %if namespace != "zes":
@@ -73,6 +85,10 @@ namespace loader
                 drv.initStatus = ${X}_RESULT_ERROR_UNINITIALIZED;
                 continue;
             }
+
+            // drivers whose manifest declares other driver types are not asked
+            if( ( nullptr != desc ) && drv.driverTypeFlags && !( drv.driverTypeFlags & desc->flags ) )
+                continue;
             %endif
 
             if( ( 0 < *${obj['params'][0]['name']} ) && ( *${obj['params'][0]['name']} == total_driver_handle_count))
@@ -109,7 +125,8 @@ namespace loader
 
                 try
                 {
-                    for( uint32_t i = 0; i < library_driver_handle_count; ++i ) {
+                    // driver handles carry the loader's table and are returned as is
+                    for( uint32_t i = 0; !drv.ddiHandlesTable && i < library_driver_handle_count; ++i ) {
                         uint32_t driver_index = total_driver_handle_count + i;
                         ${obj['params'][1]['name']}[ driver_index ] = reinterpret_cast<${n}_driver_handle_t>(
                             context->${n}_driver_factory.getInstance( ${obj['params'][1]['name']}[ driver_index ], &drv.dditable ) );
@@ -131,6 +148,11 @@ namespace loader
             result = ${X}_RESULT_SUCCESS;
         }
 
+        %if namespace == "ze" and re.match(r"\w+DriverGet$", th.make_func_name(n, tags, obj)):
+        if( ${X}_RESULT_SUCCESS == result )
+            context->enumeration_cache.store( nullptr, requestedCount, *${obj['params'][0]['name']}, ${obj['params'][1]['name']} );
+
+        %endif
         %else:
         %for i, item in enumerate(th.get_loader_prologue(n, tags, obj, meta)):
         %if 0 == i:
@@ -144,34 +166,30 @@ namespace loader
         if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
             return ${X}_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+
+        %if cached:
+        // repeat enumerations are answered from the cache
+        auto hParent = ${obj['params'][0]['name']};
+        uint32_t requestedCount = *${obj['params'][1]['name']};
+        if( context->enumeration_cache.get( hParent, ${obj['params'][1]['name']}, ${obj['params'][2]['name']} ) )
+            return ${X}_RESULT_SUCCESS;
+
+        %endif
         %endif
         %if 'range' in item:
         <%
         add_local = True%>// convert loader handles to driver handles
-        auto ${item['name']}Local = new ${item['type']} [${item['range'][1]}];
-        <%
-        arrays_to_delete.append(item['name']+ 'Local')
-        %>for( size_t i = ${item['range'][0]}; ( nullptr != ${item['name']} ) && ( i < ${item['range'][1]} ); ++i )
+        handle_array_t<${item['type']}> ${item['name']}Local( ${item['range'][1]} );
+        for( size_t i = ${item['range'][0]}; ( nullptr != ${item['name']} ) && ( i < ${item['range'][1]} ); ++i )
             ${item['name']}Local[ i ] = reinterpret_cast<${item['obj']}*>( ${item['name']}[ i ] )->handle;
         %else:
         %if item['optional']:
         // convert loader handle to driver handle
         ${item['name']} = ( ${item['name']} ) ? reinterpret_cast<${item['obj']}*>( ${item['name']} )->handle : nullptr;
         %else:
-        %if re.match(r"\w+ImageDestroy$", th.make_func_name(n, tags, obj)):
-        // remove the handle from the kernel arugment map
-        {
-            std::lock_guard<std::mutex> lock(context->image_handle_map_lock);
-            context->image_handle_map.erase(reinterpret_cast<ze_image_object_t*>(hImage));
-        }
-        %endif
-        %if re.match(r"\w+SamplerDestroy$", th.make_func_name(n, tags, obj)):
-        // remove the handle from the kernel arugment map
-        {
-            std::lock_guard<std::mutex> lock(context->sampler_handle_map_lock);
-            context->sampler_handle_map.erase(reinterpret_cast<ze_sampler_object_t*>(hSampler));
-        }
-        %endif
         // convert loader handle to driver handle
         ${item['name']} = reinterpret_cast<${item['obj']}*>( ${item['name']} )->handle;
         %endif
@@ -180,40 +198,32 @@ namespace loader
         %endfor
         %if re.match(r"\w+KernelSetArgumentValue$", th.make_func_name(n, tags, obj)):
         // convert pArgValue to correct handle if applicable
+        // only pointer-sized arguments can be handles; images and samplers are
+        // recognized by the address ranges of their factories, without a lock
         void *internalArgValue = const_cast<void *>(pArgValue);
-        if (pArgValue) {
-            // check if the arg value is a translated handle
-            ze_image_object_t **imageHandle = static_cast<ze_image_object_t **>(internalArgValue);
-            ze_sampler_object_t **samplerHandle = static_cast<ze_sampler_object_t **>(internalArgValue);
-            {
-                std::lock_guard<std::mutex> image_lock(context->image_handle_map_lock);
-                std::lock_guard<std::mutex> sampler_lock(context->sampler_handle_map_lock);
-                if( context->image_handle_map.find(*imageHandle) != context->image_handle_map.end() ) {
-                    internalArgValue = &context->image_handle_map[*imageHandle];
-                } else if( context->sampler_handle_map.find(*samplerHandle) != context->sampler_handle_map.end() ) {
-                    internalArgValue = &context->sampler_handle_map[*samplerHandle];
-                }
-            }
+        if( ( nullptr != pArgValue ) && ( sizeof( void* ) == argSize ) ) {
+            void *argHandle = nullptr;
+            memcpy( &argHandle, pArgValue, sizeof( argHandle ) );
+            if( context->ze_image_factory.owns( argHandle ) )
+                internalArgValue = &static_cast<ze_image_object_t*>( argHandle )->handle;
+            else if( context->ze_sampler_factory.owns( argHandle ) )
+                internalArgValue = &static_cast<ze_sampler_object_t*>( argHandle )->handle;
         }
         %endif
         ## Workaround due to incorrect defintion of phWaitEvents in the ze headers which missed the range values.
         ## To be removed once the headers have been updated in a new spec release.
         %if re.match(r"\w+CommandListAppendMetricQueryEnd$", th.make_func_name(n, tags, obj)):
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
         %else:
         // forward to device-driver
         %if add_local:
         result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name", "local"]))} );
-        %for array_name in arrays_to_delete:
-        delete []${array_name};
-        %endfor
         %else:
         %if re.match(r"\w+KernelSetArgumentValue$", th.make_func_name(n, tags, obj)):
         result = pfnSetArgumentValue( hKernel, argIndex, argSize, const_cast<const void *>(internalArgValue) );
@@ -223,7 +233,6 @@ namespace loader
         %endif
         %endif
 <%
-        del arrays_to_delete
         del add_local%>
         %for i, item in enumerate(th.get_loader_epilogue(n, tags, obj, meta)):
         %if 0 == i:
@@ -251,25 +260,8 @@ namespace loader
                 *${item['name']} = reinterpret_cast<${item['type']}>(
                     context->${item['factory']}.getInstance( *${item['name']}, dditable ) );
             %else:
-            %if re.match(r"\w+ImageCreate$", th.make_func_name(n, tags, obj)) or re.match(r"\w+SamplerCreate$", th.make_func_name(n, tags, obj)) or re.match(r"\w+ImageViewCreateExp$", th.make_func_name(n, tags, obj)):
-            ${item['type']} internalHandlePtr = *${item['name']};
-            %endif
             *${item['name']} = reinterpret_cast<${item['type']}>(
                 context->${item['factory']}.getInstance( *${item['name']}, dditable ) );
-            %if re.match(r"\w+ImageCreate$", th.make_func_name(n, tags, obj)) or re.match(r"\w+ImageViewCreateExp$", th.make_func_name(n, tags, obj)):
-            // convert loader handle to driver handle and store in map
-            {
-                std::lock_guard<std::mutex> lock(context->image_handle_map_lock);
-                context->image_handle_map.insert({context->ze_image_factory.getInstance( internalHandlePtr, dditable ), internalHandlePtr});
-            }
-            %endif
-            %if re.match(r"\w+SamplerCreate$", th.make_func_name(n, tags, obj)):
-            // convert loader handle to driver handle and store in map
-            {
-                std::lock_guard<std::mutex> lock(context->sampler_handle_map_lock);
-                context->sampler_handle_map.insert({context->ze_sampler_factory.getInstance( internalHandlePtr, dditable ), internalHandlePtr});
-            }
-            %endif
             %endif
             %endif
         }
@@ -287,6 +279,11 @@ namespace loader
         %endif
         %endif
         %endfor
+        %if cached:
+        if( ${X}_RESULT_SUCCESS == result )
+            context->enumeration_cache.store( hParent, requestedCount, *${obj['params'][1]['name']}, ${obj['params'][2]['name']} );
+
+        %endif
         %endif
         return result;
     }
@@ -374,6 +371,8 @@ ${tbl['export']['name']}(
         %else:
         result = getTable( version, &drv.dditable.${n}.${tbl['name']});
         %endif
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->${n}.${tbl['name']} = drv.dditable.${n}.${tbl['name']};
     }
 
     %if tbl['experimental'] is False: #//Experimental Tables may not be implemented in driver
@@ -425,24 +424,23 @@ ${tbl['export']['name']}(
         result = getTable( version, pDdiTable );
     }
 
-    %if namespace == "ze":
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ${X}_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.${n}.${tbl['name']} = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ${X}_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<${tbl['pfn']}>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "${tbl['export']['name']}") );
         if(!getTable)
             return ${X}_RESULT_ERROR_UNINITIALIZED;
-        ${tbl['type']} dditable;
-        memcpy(&dditable, pDdiTable, sizeof(${tbl['type']}));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.${n}.${tbl['name']} = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.${n}.${tbl['name']} );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
     }
 
-    %endif
     return result;
 }
 
@@ -451,3 +449,30 @@ ${tbl['export']['name']}(
 #if defined(__cplusplus)
 };
 #endif
+
+namespace loader
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercepts the loader's DDIs kept in tracing_dditable with the
+    ///        API tracing layer's DDIs, once the layer has been loaded on demand
+    __zedlllocal ${x}_result_t ZE_APICALL
+    ${n}TracingLayerGetProcAddrTables(
+        ${x}_api_version_t version                       ///< [in] API version requested
+        )
+    {
+        ${x}_result_t result = ${X}_RESULT_SUCCESS;
+
+        %for tbl in th.get_pfntables(specs, meta, n, tags):
+        if( ${X}_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<${tbl['pfn']}>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "${tbl['export']['name']}") );
+            if(!getTable)
+                return ${X}_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.${n}.${tbl['name']} );
+        }
+
+        %endfor
+        return result;
+    }
+} // namespace loader
@@ -15,6 +15,9 @@ def define_dbg(obj, tags):
 
     x=tags['$x']
     X=x.upper()
+
+    ## calls read the table of threads which enabled tracing for themselves
+    ddi_table = "%s_lib::context->get%sDdiTable()" % (x, n.capitalize())
 %>/*
  *
  * Copyright (C) 2019-2024 Intel Corporation
@@ -153,7 +156,7 @@ ${th.make_func_name(n, tags, obj)}(
     }
 
 %endif
-    auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::context->${n}DdiTable.load()->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+    auto ${th.make_pfn_name(n, tags, obj)} = ${ddi_table}->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
     if( nullptr == ${th.make_pfn_name(n, tags, obj)} ) {
         if(!ze_lib::context->isInitialized)
             return ${X}_RESULT_ERROR_UNINITIALIZED;
@@ -48,6 +48,8 @@ namespace driver
         {
             // generic implementation
             %if re.match("Init", obj['name']):
+            context.init_once();
+
             %if re.match("InitDrivers", obj['name']):
             auto driver_type = getenv_string( "ZEL_TEST_NULL_DRIVER_TYPE" );
             if (std::strcmp(driver_type.c_str(), "GPU") == 0) {
@@ -7,6 +7,8 @@ from templates import helper as th
 
     x=tags['$x']
     X=x.upper()
+
+    container=th.get_callback_container_name(n, tags)
 %>/*
  *
  * Copyright (C) 2021-2022 Intel Corporation
@@ -22,8 +24,14 @@ from templates import helper as th
 #pragma once
 #endif
 
-#include "${x}_api.h"
+#include "${n}_api.h"
+%if container:
+#include "layers/${n}_tracing_register_cb.h"
+%else:
 #include "layers/zel_tracing_register_cb.h"
+#include "zet_tracing_cb_structs.h"
+#include "zes_tracing_cb_structs.h"
+%endif
 
 
 
@@ -38,14 +46,28 @@ typedef struct _${tbl['type']}
 } ${tbl['type']};
 
 %endfor
+%if container:
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Container for all ${container.lower()} callbacks
+typedef struct _zel_all_${container.lower()}_callbacks_t
+{
+%for tbl in th.get_zel_pfncbtables(specs, meta, n, tags):
+    ${th.append_ws(tbl['type'], 35)} ${tbl['name']};
+%endfor
+} zel_all_${container.lower()}_callbacks_t;
+%else:
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Container for all callbacks
-typedef struct _zel_all_core_callbacks_t
+/// @brief Container for all callbacks; the core callbacks come first, so
+///        that the tools and sysman APIs do not move the core APIs
+typedef struct _zel_all_callbacks_t
 {
 %for tbl in th.get_zel_pfncbtables(specs, meta, n, tags):
     ${th.append_ws(tbl['type'], 35)} ${tbl['name']};
 %endfor
-} zel_all_core_callbacks_t;
+    ${th.append_ws("zel_all_tools_callbacks_t", 35)} Tools;
+    ${th.append_ws("zel_all_sysman_callbacks_t", 35)} Sysman;
+} zel_all_callbacks_t;
+%endif
 
 
 
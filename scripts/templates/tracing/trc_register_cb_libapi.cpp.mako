@@ -21,7 +21,7 @@ from templates import helper as th
 #include "layers/zel_tracing_api.h"
 #include "layers/zel_tracing_ddi.h"
 #include "layers/zel_tracing_register_cb.h"
-#include "${x}_api.h"
+#include "${n}_api.h"
 
 extern "C" { 
 
@@ -7,6 +7,10 @@ from templates import helper as th
 
     x=tags['$x']
     X=x.upper()
+
+    core=(n == x)
+    ## the core APIs of spec 1.0 have their callbacks in ze_api.h
+    cbtables=th.get_new_pfncbtables(specs, meta, n, tags) if core else th.get_zel_pfncbtables(specs, meta, n, tags)
 %>/*
  *
  * Copyright (C) 2021-2022 Intel Corporation
@@ -22,21 +26,28 @@ from templates import helper as th
 #pragma once
 #endif
 
-#include "../${x}_api.h"
+#include "../${n}_api.h"
+%if not core:
+#include "zel_tracing_register_cb.h"
+%endif
 
 
 #if defined(__cplusplus)
 extern "C" {
 #endif
 
+%if core:
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Handle of tracer object
 typedef struct _zel_tracer_handle_t *zel_tracer_handle_t;
 
 /// Callback definitions for all API released in LevelZero spec 1.1 or newer
 /// Callbacks for APIs included in spec 1.0 are contained in ze_api.helper
+%else:
+/// Callback definitions for all ${n} APIs
+%endif
 
-%for tbl in th.get_new_pfncbtables(specs, meta, n, tags):
+%for tbl in cbtables:
 %for obj in tbl['functions']:
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Callback function parameters for ${th.make_func_name(n, tags, obj)}
@@ -67,6 +78,7 @@ typedef void (${X}_APICALL *${th.make_pfncb_type(n, tags, obj)})(
 
 %endfor
 %endfor
+%if core:
 
 typedef enum _zel_tracer_reg_t
 {
@@ -75,6 +87,9 @@ typedef enum _zel_tracer_reg_t
 } zel_tracer_reg_t;
 
 /// APIs to register callbacks for each core API
+%else:
+/// APIs to register callbacks for each ${n} API
+%endif
 %for s in specs:
 %for obj in th.filter_items(s['objects'], 'type', 'function'):
 
@@ -87,13 +102,21 @@ ${th.make_tracing_func_name(n, tags, obj)}(
 
 %endfor
 %endfor #s in specs:
+%if core:
 
 ${X}_APIEXPORT ${x}_result_t ${X}_APICALL
 zelTracerResetAllCallbacks(zel_tracer_handle_t hTracer);
+%endif
 
 
 #if defined(__cplusplus)
 } // extern "C"
 #endif
+%if core:
+
+// Callbacks of the tools and sysman APIs
+#include "zet_tracing_register_cb.h"
+#include "zes_tracing_register_cb.h"
+%endif
 
 #endif // ${name}_H
@@ -20,14 +20,65 @@ from templates import helper as th
 #include <iostream>
 #include "${x}_tracing_layer.h"
 
+<%def name="record_args(obj)"><%
+    ## handles and sizes passed by value, followed by as many events waited on as fit
+    args = [p for p in obj['params']
+            if th.param_traits.is_input(p) and not th.type_traits.is_pointer(p['type'])
+            and ((th.type_traits.is_handle(p['type']) and not th.type_traits.is_ipc_handle(p['type']))
+                 or p['type'] in ['uint32_t', 'uint64_t', 'size_t'])][:8]
+    waits = [p for p in obj['params']
+             if (p['name'] == 'phWaitEvents' or (p['name'] == 'phEvents' and 'events to wait on' in p['desc']))
+             and th.param_traits.is_range(p) and len(args) < 8]
+    return (args, waits)
+%></%def>
+<%def name="async_out_args(obj)"><%
+    ## positions of the single [out] handles and pointers, whose values deferred epilogues copy
+    return [i for i, p in enumerate(obj['params'])
+            if th.param_traits.is_output(p) and not th.param_traits.is_range(p)
+            and (p['type'] == 'void**'
+                 or (th.type_traits.is_handle(p['type']) and not th.type_traits.is_ipc_handle(p['type'])
+                     and p['type'].count('*') == 1))]
+%></%def>
 namespace tracing_layer
 {
     %for obj in th.extract_objs(specs, r"function"):
-    ///////////////////////////////////////////////////////////////////////////////
-    /// @brief Intercept function for ${th.make_func_name(n, tags, obj)}
+<%
+    recordArgs, recordWaits = record_args(obj)
+    asyncOutArgs = async_out_args(obj)
+%>\
     %if 'condition' in obj:
     #if ${th.subt(n, tags, obj['condition'])}
     %endif
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for ${th.make_func_name(n, tags, obj)}
+    template <>
+    struct APIRecordArgs<${th.make_pfncb_param_type(n, tags, obj)}>
+    {
+        static uint32_t get(const ${th.make_pfncb_param_type(n, tags, obj)} *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            %for p in recordArgs:
+            args[count++] = recordArg(*params->p${p['name']});
+            %endfor
+            %for p in recordWaits:
+            count = recordArgArray(*params->p${th.param_traits.range_end(p)}, *params->p${p['name']}, args, count);
+            %endfor
+            return count;
+        }
+    };
+
+    %if asyncOutArgs:
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of ${th.make_func_name(n, tags, obj)}
+    template <>
+    struct AsyncEpilogueOutArgs<${th.make_pfncb_param_type(n, tags, obj)}>
+    {
+        static constexpr uint32_t mask = ${" | ".join("(1u << %d)" % i for i in asyncOutArgs)};
+    };
+
+    %endif
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for ${th.make_func_name(n, tags, obj)}
     __${x}dlllocal ${x}_result_t ${X}_APICALL
     ${th.make_func_name(n, tags, obj)}(
         %for line in th.make_param_lines(n, tags, obj):
@@ -40,6 +91,10 @@ namespace tracing_layer
         if( nullptr == ${th.make_pfn_name(n, tags, obj)})
             return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(${th.get_callback_table_name(n, tags, obj)}, ${th.make_pfncb_name(n, tags, obj)}, context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))});
+
+        ZE_HANDLE_UNSAMPLED_API(${th.get_callback_table_name(n, tags, obj)}, ${th.make_pfncb_name(n, tags, obj)}, context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))});
+
         ZE_HANDLE_TRACER_RECURSION(context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))});
 
         // capture parameters
@@ -54,9 +109,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)},
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.p${",\n                                                  *tracerParams.p".join(th.make_param_lines(n, tags, obj, format=["name"]))});
     }
     %if 'condition' in obj:
@@ -64,6 +117,26 @@ namespace tracing_layer
     %endif
 
     %endfor
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Names of the traced APIs and of their recorded arguments
+    const api_record_desc_t ${n}ApiRecordDescs[] = {
+        %for obj in th.extract_objs(specs, r"function"):
+<%
+    recordArgs, recordWaits = record_args(obj)
+    asyncOutArgs = async_out_args(obj)
+%>\
+        %if 'condition' in obj:
+    #if ${th.subt(n, tags, obj['condition'])}
+        %endif
+        {ZE_TRACER_API_INDEX(${th.get_callback_table_name(n, tags, obj)}, ${th.make_pfncb_name(n, tags, obj)}), "${th.make_func_name(n, tags, obj)}", "${",".join([p['name'] for p in recordArgs + recordWaits])}"},
+        %if 'condition' in obj:
+    #endif // ${th.subt(n, tags, obj['condition'])}
+        %endif
+        %endfor
+    };
+
+    const size_t ${n}ApiRecordDescCount = sizeof(${n}ApiRecordDescs) / sizeof(${n}ApiRecordDescs[0]);
+
 } // namespace tracing_layer
 
 #if defined(__cplusplus)
@@ -20,6 +20,9 @@ from templates import helper as th
  */
 #pragma once
 #include "${n}_api.h"
+#include <bitset>
+#include <cstdint>
+#include <type_traits>
 
 namespace validation_layer
 {
@@ -34,10 +37,33 @@ ${line} \
 ) {return ZE_RESULT_SUCCESS;}
     virtual ${x}_result_t ${th.make_func_name(n, tags, obj)}Epilogue( \
 %for line in th.make_param_lines(n, tags, obj, format=["type", "name", "delim"]):
-${line} \
+${line}${"," if loop.last else ""} \
 %endfor
-) {return ZE_RESULT_SUCCESS;}
+${x}_result_t result ) {return ZE_RESULT_SUCCESS;}
     %endfor
     virtual ~${N}ValidationEntryPoints() {}
 };
+
+// Index of each entry point, for the lists of checkers overriding it.
+namespace ${N}EntryPoint {
+enum : uint32_t {
+    %for obj in th.extract_objs(specs, r"function"):
+    ${th.make_func_name(n, tags, obj)}Prologue,
+    ${th.make_func_name(n, tags, obj)}Epilogue,
+    %endfor
+    Count
+};
+}
+
+// Entry points a checker class overrides, told apart from the defaults
+// above by the class their member pointers belong to.
+template <typename TChecker>
+std::bitset<${N}EntryPoint::Count> get${N}OverriddenEntryPoints() {
+    std::bitset<${N}EntryPoint::Count> overrides;
+    %for obj in th.extract_objs(specs, r"function"):
+    overrides[${N}EntryPoint::${th.make_func_name(n, tags, obj)}Prologue] = !std::is_same<decltype(&TChecker::${th.make_func_name(n, tags, obj)}Prologue), decltype(&${N}ValidationEntryPoints::${th.make_func_name(n, tags, obj)}Prologue)>::value;
+    overrides[${N}EntryPoint::${th.make_func_name(n, tags, obj)}Epilogue] = !std::is_same<decltype(&TChecker::${th.make_func_name(n, tags, obj)}Epilogue), decltype(&${N}ValidationEntryPoints::${th.make_func_name(n, tags, obj)}Epilogue)>::value;
+    %endfor
+    return overrides;
+}
 }
\ No newline at end of file
@@ -40,9 +40,8 @@ namespace validation_layer
         if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
             return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->${n}Validation->${th.make_func_name(n, tags, obj)}Prologue( \
+        for( auto checker : context.${n}Checkers[ ${N}EntryPoint::${th.make_func_name(n, tags, obj)}Prologue ] ) {
+            auto result = checker->${th.make_func_name(n, tags, obj)}Prologue( \
 % for line in th.make_param_lines(n, tags, obj, format=['name','delim']):
 ${line} \
 %endfor
@@ -50,11 +49,33 @@ ${line} \
             if(result!=${X}_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+<%
+        func_name = th.make_func_name(n, tags, obj)
+        ## a call uses exclusively the handle its thread-safety note says must
+        ## not be used from simultaneous threads; it shares any other command
+        ## list or kernel
+        exclusive = None
+        for detail in obj.get('details', []):
+            match = re.search(r"not\**\s+(?:call this function|be called) from simultaneous threads with the same (command list|kernel) handle", str(detail), re.IGNORECASE)
+            if match:
+                exclusive = match.group(1).lower()
+        threading_params = []
+        for line in th.make_param_lines(n, tags, obj, format=['type', 'name']):
+            words = line.split()
+            if words[0] in ["ze_command_list_handle_t", "zet_command_list_handle_t"]:
+                threading_params.append(("acquire" if exclusive == "command list" else "share", words[1]))
+            elif words[0] in ["ze_kernel_handle_t", "zet_kernel_handle_t"]:
+                threading_params.append(("acquire" if exclusive == "kernel" else "share", words[1]))
+%>\
+        %if threading_params:
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            %for use, param in threading_params:
+            context.threadingValidation->${use}( threadingGuard, ${param}, "${func_name}" );
+            %endfor
         }
 
+        %endif
         <% 
         func_name = th.make_func_name(n, tags, obj)
         generate_post_call = re.match(r"\w+Create\w*$|\w+Get$|\w+Get\w*Exp$|\w+GetIpcHandle$|\w+GetSubDevices$", func_name)
@@ -70,26 +91,24 @@ ${line} \
 
         auto result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->${n}Validation->${th.make_func_name(n, tags, obj)}Epilogue( \
-% for line in th.make_param_lines(n, tags, obj, format=['name','delim']):
-${line} \
-%endfor
-);
-            if(result!=${X}_RESULT_SUCCESS) return result;
+        for( auto checker : context.${n}Checkers[ ${N}EntryPoint::${th.make_func_name(n, tags, obj)}Epilogue ] ) {
+            auto epilogueResult = checker->${th.make_func_name(n, tags, obj)}Epilogue( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]) + ["result"])} );
+            if(epilogueResult!=${X}_RESULT_SUCCESS) return epilogueResult;
         }
 
         %if generate_post_call:
 
         if( result == ${X}_RESULT_SUCCESS && context.enableHandleLifetime ){
-            ## Add 'Created' handles/objects to dependent maps
+            ## Add 'Created' handles/objects to the registry, owned by the context of
+            ## the first parameter, and to dependent maps
             <% lines = th.make_param_lines(n, tags, obj, format=['name','delim'])
+            %><% parent = th.make_param_lines(n, tags, obj, format=['name'])[0]
             %>
             %for i, item in enumerate(th.get_loader_epilogue(n, tags, obj, meta)):
             %if 'range' in item:
             for (size_t i = ${item['range'][0]}; ( nullptr != ${item['name']}) && (i < ${item['range'][1]}); ++i){
                 if (${item['name']}[i]){
-                    context.handleLifetime->addHandle( ${item['name']}[i] );
+                    context.handleLifetime->addHandle( ${item['name']}[i], ${parent} );
                     %if th.type_traits.is_handle(item['type']):
                     context.handleLifetime->addDependent( ${lines[0]} ${item['name']}[i] );
                     %endif
@@ -98,9 +117,9 @@ ${line} \
             %else:
             if (${item['name']}){
                 %if re.match(r"\w+Immediate$", func_name):
-                context.handleLifetime->addHandle( *${item['name']} , false);
+                context.handleLifetime->addHandle( *${item['name']}, ${parent}, false );
                 %else:
-                context.handleLifetime->addHandle( *${item['name']} );
+                context.handleLifetime->addHandle( *${item['name']}, ${parent} );
                 %if th.type_traits.is_handle(item['type']):
                 context.handleLifetime->addDependent( ${lines[0]} *${item['name']} );
                 %endif
@@ -17,6 +17,15 @@ namespace driver
     //////////////////////////////////////////////////////////////////////////
     context_t::context_t()
     {
+        auto initDelay = getenv_string( "ZEL_TEST_NULL_DRIVER_INIT_DELAY_MS" );
+        if( !initDelay.empty() )
+            initDelayMs = static_cast<uint32_t>( std::strtoul( initDelay.c_str(), nullptr, 10 ) );
+        auto hostSynchronizeDelay = getenv_string( "ZEL_TEST_NULL_DRIVER_HOST_SYNCHRONIZE_DELAY_MS" );
+        if( !hostSynchronizeDelay.empty() )
+            hostSynchronizeDelayMs = static_cast<uint32_t>( std::strtoul( hostSynchronizeDelay.c_str(), nullptr, 10 ) );
+        hostSynchronizeSignalFile = getenv_string( "ZEL_TEST_NULL_DRIVER_HOST_SYNCHRONIZE_SIGNAL_FILE" );
+
+        //////////////////////////////////////////////////////////////////////////
         zesDdiTable.Driver.pfnGet = [](
             uint32_t* pCount,
             ze_driver_handle_t* phDrivers )
@@ -83,6 +92,8 @@ namespace driver
             ze_device_handle_t,
             void** pptr)
         {
+            if( alignment & ( alignment - 1 ) )
+                return ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT;
             *pptr = malloc(size);
             return ZE_RESULT_SUCCESS;
         };
@@ -96,6 +107,8 @@ namespace driver
             ze_device_handle_t,
             void** pptr)
         {
+            if( alignment & ( alignment - 1 ) )
+                return ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT;
             *pptr = malloc(size);
             return ZE_RESULT_SUCCESS;
         };
@@ -108,6 +121,8 @@ namespace driver
             size_t alignment,
             void** pptr)
         {
+            if( alignment & ( alignment - 1 ) )
+                return ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT;
             *pptr = malloc(size);
             return ZE_RESULT_SUCCESS;
         };
@@ -261,6 +276,28 @@ namespace driver
             return ZE_RESULT_SUCCESS;
         };
 
+        //////////////////////////////////////////////////////////////////////////
+        zeDdiTable.CommandList.pfnHostSynchronize = [](
+            ze_command_list_handle_t,
+            uint64_t )
+        {
+            if( context.hostSynchronizeSignalFile.empty() )
+            {
+                if( 0 < context.hostSynchronizeDelayMs )
+                    std::this_thread::sleep_for( std::chrono::milliseconds( context.hostSynchronizeDelayMs ) );
+                return ZE_RESULT_SUCCESS;
+            }
+
+            // tell the test the command list is synchronizing, with a byte per
+            // synchronizing call, and keep it so until the test removes the file
+            std::ofstream( context.hostSynchronizeSignalFile, std::ios::app ) << '.';
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds( context.hostSynchronizeDelayMs );
+            while( std::ifstream( context.hostSynchronizeSignalFile ).good()
+                && std::chrono::steady_clock::now() < deadline )
+                std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+            return ZE_RESULT_SUCCESS;
+        };
+
         //////////////////////////////////////////////////////////////////////////
         zetDdiTable.MetricGroup.pfnGet = [](
             zet_device_handle_t,
@@ -428,3 +465,31 @@ namespace instrumented
         }
     }
 } // namespace instrumented
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for handing the loader's dispatch table to the
+///        driver, which then stores it as the first word of every handle.
+///        Only accepted when ZEL_TEST_NULL_DRIVER_DDI_HANDLES=1, so that the
+///        loader's handle wrapping stays covered by default.
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelDriverSetLoaderDdiTable(
+    void* pLoaderDdiTable                           ///< [in] loader dispatch table
+    )
+{
+    if( nullptr == pLoaderDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if( !getenv_tobool( "ZEL_TEST_NULL_DRIVER_DDI_HANDLES" ) )
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+    driver::context.pLoaderDdiTable = pLoaderDdiTable;
+    return ZE_RESULT_SUCCESS;
+}
+
+#if defined(__cplusplus)
+};
+#endif
@@ -9,11 +9,18 @@
  */
 #pragma once
 #include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 #include "ze_ddi.h"
 #include "zet_ddi.h"
 #include "zes_ddi.h"
 #include "ze_util.h"
+#include "ze_slab.h"
 
 namespace driver
 {
@@ -26,14 +33,48 @@ namespace driver
         ze_dditable_t   zeDdiTable = {};
         zet_dditable_t  zetDdiTable = {};
         zes_dditable_t  zesDdiTable = {};
+        void* pLoaderDdiTable = nullptr;    ///< set once the loader accepts table-carrying handles
+        uint32_t initDelayMs = 0;           ///< ZEL_TEST_NULL_DRIVER_INIT_DELAY_MS, cost of the first init
+        uint32_t hostSynchronizeDelayMs = 0; ///< ZEL_TEST_NULL_DRIVER_HOST_SYNCHRONIZE_DELAY_MS, time a command list takes to complete
+        std::string hostSynchronizeSignalFile; ///< ZEL_TEST_NULL_DRIVER_HOST_SYNCHRONIZE_SIGNAL_FILE, grown by a byte on entering host synchronize,
+                                               ///< which then completes once the file is removed or the delay passes
+
         context_t();
         ~context_t() = default;
 
+        //////////////////////////////////////////////////////////////////////////
+        /// one-time work of the first init, modelled by a delay
+        void init_once( void )
+        {
+            std::call_once( initOnceFlag, [this]() {
+                if( 0 < initDelayMs )
+                    std::this_thread::sleep_for( std::chrono::milliseconds( initDelayMs ) );
+            } );
+        }
+
         void* get( void )
         {
-            static uint64_t count = 0x80800000;
+            if( nullptr != pLoaderDdiTable )
+            {
+                std::lock_guard<std::mutex> lk( handleMutex );
+                return handleSlab.create( pLoaderDdiTable );
+            }
+            static std::atomic<uint64_t> count{ 0x80800000 };
             return reinterpret_cast<void*>( ++count );
         }
+
+    protected:
+        //////////////////////////////////////////////////////////////////////////
+        /// handle whose first word is the loader's dispatch table
+        struct ddi_handle_t
+        {
+            void* pLoaderDdiTable;
+            ddi_handle_t( void* _pLoaderDdiTable ) : pLoaderDdiTable( _pLoaderDdiTable ) {}
+        };
+
+        std::once_flag initOnceFlag;
+        std::mutex handleMutex;
+        slab_allocator_t<ddi_handle_t> handleSlab;
     };
 
     extern context_t context;
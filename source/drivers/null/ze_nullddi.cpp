@@ -31,6 +31,8 @@ namespace driver
         else
         {
             // generic implementation
+            context.init_once();
+
             auto driver_type = getenv_string( "ZEL_TEST_NULL_DRIVER_TYPE" );
             if (std::strcmp(driver_type.c_str(), "GPU") == 0) {
                 if (!(flags & ZE_INIT_FLAG_GPU_ONLY)) {
@@ -107,6 +109,8 @@ namespace driver
         else
         {
             // generic implementation
+            context.init_once();
+
             auto driver_type = getenv_string( "ZEL_TEST_NULL_DRIVER_TYPE" );
             if (std::strcmp(driver_type.c_str(), "GPU") == 0) {
                 if (!(desc->flags & ZE_INIT_DRIVER_TYPE_FLAG_GPU)) {
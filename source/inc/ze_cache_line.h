@@ -0,0 +1,65 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+/// size of the cache lines that state used by different threads is kept
+/// apart by
+constexpr size_t ze_cache_line_size = 64;
+
+//////////////////////////////////////////////////////////////////////////
+/// an element of an array on cache lines of its own, so that threads
+/// locking or updating neighbouring elements never share a line
+template<typename _value_t>
+struct alignas( ze_cache_line_size ) cache_line_t : _value_t
+{
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// base of the classes holding cache_line_t members which are allocated
+/// with new; the global new only honours their alignment from C++17
+struct cache_line_allocated_t
+{
+    static void* operator new( size_t size )
+    {
+        void* ptr = nullptr;
+#if defined(_WIN32)
+        ptr = _aligned_malloc( size, ze_cache_line_size );
+#else
+        if( 0 != posix_memalign( &ptr, ze_cache_line_size, size ) )
+            ptr = nullptr;
+#endif
+        if( nullptr == ptr )
+            throw std::bad_alloc();
+        return ptr;
+    }
+
+    static void operator delete( void* ptr )
+    {
+#if defined(_WIN32)
+        _aligned_free( ptr );
+#else
+        free( ptr );
+#endif
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Fibonacci hashing of a handle: handles are usually aligned addresses or
+/// sequential values, and the top bits of the product mix all their bits
+inline uint64_t hash_handle( uint64_t key )
+{
+    return key * 0x9E3779B97F4A7C15ull;
+}
@@ -1,29 +1,70 @@
 /*
  *
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <unordered_map>
 #include <mutex>
 
+#include "ze_cache_line.h"
+#include "ze_slab.h"
+
 //////////////////////////////////////////////////////////////////////////
 /// a abstract factory for creation of singleton objects
-template<typename _singleton_t, typename _key_t>
+/// the instances are spread over _shard_count independently locked shards,
+/// selected by a hash of the key, so that threads creating or releasing
+/// different handles of the same type rarely contend on the same lock.
+/// each shard allocates its instances from a slab and indexes them in an
+/// open-addressing table, so neither creation nor release touches the heap
+/// once the shard has grown to the working set.
+/// an _addressable factory can tell its instances from other pointers,
+/// see slab_allocator_t::owns.
+template<typename _singleton_t, typename _key_t, size_t _shard_count = 16, bool _addressable = false>
 class singleton_factory_t
 {
+    static_assert( ( _shard_count & ( _shard_count - 1 ) ) == 0, "shard count must be a power of two" );
+
 protected:
     using singleton_t = _singleton_t;
     using key_t = typename std::conditional<std::is_pointer<_key_t>::value, size_t, _key_t>::type;
 
-    using ptr_t = std::unique_ptr < singleton_t >;
-    using map_t = std::unordered_map < key_t, ptr_t >;
+    //////////////////////////////////////////////////////////////////////////
+    /// table slot; a zero key marks an empty slot, a null value with a
+    /// non-zero key marks a released slot which inserts may reuse
+    struct entry_t
+    {
+        key_t key;
+        singleton_t* value;
+    };
+
+    static constexpr size_t min_capacity = 16;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// instances, index and lock of one shard
+    struct shard_t
+    {
+        std::mutex mut;                             ///< lock for thread-safety
+        slab_allocator_t<singleton_t, _addressable> slab;   ///< storage of the instances of this shard
+        std::unique_ptr<entry_t[]> entries;         ///< single instance of singleton for each unique key in this shard
+        std::unique_ptr<entry_t[]> spare;           ///< same-sized table kept for rehashing out released slots
+        size_t capacity = 0;                        ///< number of entries, zero or a power of two
+        size_t used = 0;                            ///< live and released entries
+        size_t live = 0;                            ///< live entries
+
+        ~shard_t()
+        {
+            for( size_t i = 0; i < capacity; ++i )
+                if( entries[ i ].value )
+                    slab.destroy( entries[ i ].value );
+        }
+    };
 
-    std::mutex mut; ///< lock for thread-safety
-    map_t map;      ///< single instance of singleton for each unique key
+    cache_line_t<shard_t> shards[ _shard_count ];
 
     //////////////////////////////////////////////////////////////////////////
     /// extract the key from parameter list and if necessary, convert type
@@ -33,6 +74,102 @@ protected:
         return reinterpret_cast<key_t>( _key );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// the top bits of the hash select the shard, the middle bits the slot
+    static uint64_t getHash( key_t key )
+    {
+        return hash_handle( static_cast<uint64_t>( key ) );
+    }
+
+    shard_t& getShard( uint64_t hash )
+    {
+        return shards[ ( hash >> 32 ) & ( _shard_count - 1 ) ];
+    }
+
+    static size_t getSlot( uint64_t hash, size_t capacity )
+    {
+        return static_cast<size_t>( hash >> 16 ) & ( capacity - 1 );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// index of the live entry for key, or capacity if there is none
+    static size_t find( shard_t& shard, key_t key, uint64_t hash )
+    {
+        if( 0 == shard.capacity )
+            return 0;
+
+        for( size_t i = getSlot( hash, shard.capacity ); ; i = ( i + 1 ) & ( shard.capacity - 1 ) )
+        {
+            auto& entry = shard.entries[ i ];
+            if( 0 == entry.key )
+                return shard.capacity;
+            if( ( key == entry.key ) && entry.value )
+                return i;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// make room for one more entry, keeping the table at most 3/4 full
+    /// released entries are dropped by rehashing into a table sized for the
+    /// live entries; a same-sized table is reused from the previous rehash
+    static void reserve( shard_t& shard )
+    {
+        if( ( shard.used + 1 ) * 4 <= shard.capacity * 3 )
+            return;
+
+        size_t capacity = min_capacity;
+        while( capacity < ( shard.live + 1 ) * 2 )
+            capacity *= 2;
+        // only shrink once most of the table has been released
+        if( ( capacity < shard.capacity ) && ( ( shard.live + 1 ) * 8 > shard.capacity ) )
+            capacity = shard.capacity;
+
+        std::unique_ptr<entry_t[]> entries;
+        if( ( capacity == shard.capacity ) && shard.spare )
+            entries = std::move( shard.spare );
+        else
+            entries.reset( new entry_t[ capacity ] );
+        for( size_t i = 0; i < capacity; ++i )
+            entries[ i ] = entry_t{ 0, nullptr };
+
+        for( size_t i = 0; i < shard.capacity; ++i )
+        {
+            auto& entry = shard.entries[ i ];
+            if( nullptr == entry.value )
+                continue;
+            size_t j = getSlot( getHash( entry.key ), capacity );
+            while( 0 != entries[ j ].key )
+                j = ( j + 1 ) & ( capacity - 1 );
+            entries[ j ] = entry;
+        }
+
+        if( capacity == shard.capacity )
+            shard.spare = std::move( shard.entries );
+        else
+            shard.spare.reset();
+        shard.entries = std::move( entries );
+        shard.capacity = capacity;
+        shard.used = shard.live;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// add an entry for a key known not to be live; reuses the first
+    /// released slot on the probe sequence
+    static void insert( shard_t& shard, key_t key, uint64_t hash, singleton_t* value )
+    {
+        for( size_t i = getSlot( hash, shard.capacity ); ; i = ( i + 1 ) & ( shard.capacity - 1 ) )
+        {
+            auto& entry = shard.entries[ i ];
+            if( 0 == entry.key )
+                ++shard.used;
+            else if( entry.value )
+                continue;
+            entry = entry_t{ key, value };
+            ++shard.live;
+            return;
+        }
+    }
+
 public:
     //////////////////////////////////////////////////////////////////////////
     /// default ctor/dtor
@@ -52,22 +189,46 @@ public:
         if(key == 0) // No zero keys allowed in map
             return static_cast<_singleton_t*>(0);
 
-        std::lock_guard<std::mutex> lk( mut );
-        auto iter = map.find( key );
+        auto hash = getHash( key );
+        auto& shard = getShard( hash );
+        std::lock_guard<std::mutex> lk( shard.mut );
 
-        if( map.end() == iter )
-        {
-            auto ptr = std::make_unique<singleton_t>( std::forward<Ts>( _params )... );
-            iter = map.emplace( key, std::move( ptr ) ).first;
-        }
-        return iter->second.get();
+        auto index = find( shard, key, hash );
+        if( index != shard.capacity )
+            return shard.entries[ index ].value;
+
+        reserve( shard );
+        auto ptr = shard.slab.create( std::forward<Ts>( _params )... );
+        insert( shard, key, hash, ptr );
+        return ptr;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// whether the pointer is an instance of this factory, without a lock
+    bool owns( const void* _ptr ) const
+    {
+        for( auto& shard : shards )
+            if( shard.slab.owns( _ptr ) )
+                return true;
+        return false;
     }
 
     //////////////////////////////////////////////////////////////////////////
     /// once the key is no longer valid, release the singleton
     void release( _key_t _key )
     {
-        std::lock_guard<std::mutex> lk( mut );
-        map.erase( getKey( _key ) );
+        auto key = getKey( _key );
+        auto hash = getHash( key );
+        auto& shard = getShard( hash );
+        std::lock_guard<std::mutex> lk( shard.mut );
+
+        auto index = find( shard, key, hash );
+        if( index == shard.capacity )
+            return;
+
+        auto& entry = shard.entries[ index ];
+        shard.slab.destroy( entry.value );
+        entry.value = nullptr;
+        --shard.live;
     }
 };
@@ -0,0 +1,126 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+/// allocator for objects of a single type
+/// objects are packed contiguously into page-sized slabs; destroyed objects
+/// go onto a free list and their slots are reused by the next create, so
+/// once a slab exists creation and destruction never reach the heap.
+/// slabs are only returned to the heap when the allocator is destroyed.
+/// not thread-safe; callers are expected to hold their own lock.
+/// an _addressable allocator doubles the size of each new slab and records
+/// the slab ranges, so that owns() can tell its objects from other pointers
+/// from any thread without a lock and without dereferencing the pointer.
+template<typename _object_t, bool _addressable = false>
+class slab_allocator_t
+{
+protected:
+    union slot_t
+    {
+        slot_t* next;
+        alignas( _object_t ) unsigned char storage[ sizeof( _object_t ) ];
+    };
+
+    static constexpr size_t slab_bytes = 4096;
+    static constexpr size_t slots_per_slab = ( sizeof( slot_t ) < slab_bytes ) ? slab_bytes / sizeof( slot_t ) : 1;
+
+    std::vector< std::unique_ptr< slot_t[] > > slabs;
+    slot_t* free_list = nullptr;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// slab ranges of an addressable allocator; with doubling slab sizes the
+    /// address space runs out long before the ranges do
+    static constexpr size_t max_ranges = _addressable ? 48 : 1;
+    struct range_t
+    {
+        std::atomic<uintptr_t> begin{ 0 };
+        std::atomic<uintptr_t> bytes{ 0 };
+    };
+    range_t ranges[ max_ranges ];
+    std::atomic<size_t> range_count{ 0 };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// add a slab and thread its slots onto the free list
+    void grow()
+    {
+        size_t slot_count = _addressable ? slots_per_slab << slabs.size() : slots_per_slab;
+        std::unique_ptr< slot_t[] > slab( new slot_t[ slot_count ] );
+        for( size_t i = 0; i < slot_count; ++i )
+            slab[ i ].next = ( i + 1 < slot_count ) ? &slab[ i + 1 ] : free_list;
+        free_list = &slab[ 0 ];
+
+        if( _addressable )
+        {
+            // publish the range once it is complete; readers only scan up to range_count
+            size_t index = range_count.load( std::memory_order_relaxed );
+            if( index >= max_ranges )
+                throw std::bad_alloc();
+            ranges[ index ].begin.store( reinterpret_cast<uintptr_t>( slab.get() ), std::memory_order_relaxed );
+            ranges[ index ].bytes.store( slot_count * sizeof( slot_t ), std::memory_order_relaxed );
+            range_count.store( index + 1, std::memory_order_release );
+        }
+        slabs.push_back( std::move( slab ) );
+    }
+
+public:
+    slab_allocator_t() = default;
+    ~slab_allocator_t() = default;
+
+    slab_allocator_t( const slab_allocator_t& ) = delete;
+    slab_allocator_t& operator=( const slab_allocator_t& ) = delete;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// construct a new object in a free slot
+    template<typename... Ts>
+    _object_t* create( Ts&&... _params )
+    {
+        if( nullptr == free_list )
+            grow();
+
+        slot_t* slot = free_list;
+        slot_t* next = slot->next;
+        auto object = new( slot->storage ) _object_t( std::forward<Ts>( _params )... );
+        free_list = next;
+        return object;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// whether the pointer is the address of a slot of this allocator, i.e.
+    /// of an object it created; thread-safe and lock-free
+    bool owns( const void* _ptr ) const
+    {
+        static_assert( _addressable, "only addressable allocators record their slabs" );
+        auto address = reinterpret_cast<uintptr_t>( _ptr );
+        size_t count = range_count.load( std::memory_order_acquire );
+        for( size_t i = 0; i < count; ++i )
+        {
+            uintptr_t offset = address - ranges[ i ].begin.load( std::memory_order_relaxed );
+            if( offset < ranges[ i ].bytes.load( std::memory_order_relaxed ) )
+                return 0 == offset % sizeof( slot_t );
+        }
+        return false;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// destroy an object returned by create and recycle its slot
+    void destroy( _object_t* _object )
+    {
+        _object->~_object_t();
+        auto slot = reinterpret_cast<slot_t*>( _object );
+        slot->next = free_list;
+        free_list = slot;
+    }
+};
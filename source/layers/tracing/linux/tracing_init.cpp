@@ -10,10 +10,16 @@
 namespace tracing_layer
 {
     void __attribute__((constructor)) createAPITracerContextImp() {
+        pGlobalAPIRecorder = APIRecorder::create();
+        pGlobalAPIStats = APIStats::create(tracerApiCount);
+        pGlobalAsyncEpilogueWorker = new AsyncEpilogueWorker;
         pGlobalAPITracerContextImp = new struct APITracerContextImp;
     }
 
     void __attribute__((destructor)) deleteAPITracerContextImp() {
+        if (pGlobalAPIRecorder != nullptr)
+            pGlobalAPIRecorder->stop();
+        pGlobalAsyncEpilogueWorker->stop();
         delete pGlobalAPITracerContextImp;
     }
 }
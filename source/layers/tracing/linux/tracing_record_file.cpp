@@ -0,0 +1,77 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "../tracing_record.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace tracing_layer
+{
+    // The file is mapped and grown in steps of this size, then truncated to
+    // the recorded size when closed.
+    static const size_t mapStep = 64 * 1024 * 1024;
+
+    struct APIRecordFile::Imp {
+        int fd = -1;
+        char *map = nullptr;
+        size_t mapSize = 0;
+        size_t size = 0;
+    };
+
+    APIRecordFile::APIRecordFile() : imp(new Imp) {}
+
+    APIRecordFile::~APIRecordFile() {
+        close();
+        delete imp;
+    }
+
+    bool APIRecordFile::open(const std::string &path) {
+        imp->fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        return imp->fd >= 0;
+    }
+
+    bool APIRecordFile::write(const void *data, size_t size) {
+        if (imp->fd < 0) {
+            return false;
+        }
+        if (imp->size + size > imp->mapSize) {
+            size_t mapSize = imp->mapSize + std::max(mapStep, size);
+            if (ftruncate(imp->fd, mapSize) != 0) {
+                return false;
+            }
+            void *map = (imp->map == nullptr)
+                ? mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, imp->fd, 0)
+                : mremap(imp->map, imp->mapSize, mapSize, MREMAP_MAYMOVE);
+            if (map == MAP_FAILED) {
+                return false;
+            }
+            imp->map = static_cast<char *>(map);
+            imp->mapSize = mapSize;
+        }
+        memcpy(imp->map + imp->size, data, size);
+        imp->size += size;
+        return true;
+    }
+
+    void APIRecordFile::close() {
+        if (imp->fd < 0) {
+            return;
+        }
+        if (imp->map != nullptr) {
+            munmap(imp->map, imp->mapSize);
+            imp->map = nullptr;
+        }
+        if (ftruncate(imp->fd, imp->size) != 0) {
+            // the records are complete, followed by zeros up to the mapped size
+        }
+        ::close(imp->fd);
+        imp->fd = -1;
+    }
+}
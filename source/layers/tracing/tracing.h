@@ -25,9 +25,11 @@ struct APITracer : _zel_tracer_handle_t {
     virtual ze_result_t destroyTracer(zel_tracer_handle_t phTracer) = 0;
     virtual ze_result_t setPrologues(zel_core_callbacks_t *pCoreCbs) = 0;
     virtual ze_result_t setEpilogues(zel_core_callbacks_t *pCoreCbs) = 0;
-    virtual zel_all_core_callbacks_t& getProEpilogues(zel_tracer_reg_t callback_type, ze_result_t& result) = 0;
+    virtual zel_all_callbacks_t& getProEpilogues(zel_tracer_reg_t callback_type, ze_result_t& result) = 0;
     virtual ze_result_t resetAllCallbacks() = 0;
     virtual ze_result_t enableTracer(ze_bool_t enable) = 0;
+    virtual ze_result_t getDroppedEpilogueCount(uint64_t *pCount) = 0;
+    virtual ze_result_t flushEpilogues() = 0;
 };
 
 ze_result_t createAPITracer(const zel_tracer_desc_t *desc, zel_tracer_handle_t *phTracer);
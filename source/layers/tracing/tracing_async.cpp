@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tracing_imp.h"
+
+#include <chrono>
+
+namespace tracing_layer {
+
+AsyncEpilogueWorker *pGlobalAsyncEpilogueWorker = nullptr;
+
+thread_local AsyncEpilogueRingOwner AsyncEpilogueWorker::myEpilogueRing;
+
+// Set on the worker thread, whose epilogues cannot wait for themselves.
+static thread_local bool onDrainThread = false;
+
+// How often the worker drains the rings when not woken early.
+static const std::chrono::milliseconds drainInterval(10);
+
+ze_result_t getTracerAsyncFlags(const zel_tracer_desc_t *desc,
+                                zel_tracer_async_flags_t &flags) {
+    flags = 0;
+    // every extension structure starts with its type and next pointer
+    for (const void *pNext = desc->pNext; pNext != nullptr;) {
+        auto ext = static_cast<const zel_tracer_async_desc_t *>(pNext);
+        if (ext->stype == ZEL_STRUCTURE_TYPE_TRACER_ASYNC_DESC) {
+            if (ext->flags & ~ZEL_TRACER_ASYNC_FLAG_EPILOGUES)
+                return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+            flags = ext->flags;
+        }
+        pNext = ext->pNext;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+AsyncEpilogueRing *AsyncEpilogueWorker::addRing() {
+    AsyncEpilogueRing *ring = new AsyncEpilogueRing;
+    ring->next = rings.load(std::memory_order_relaxed);
+    while (!rings.compare_exchange_weak(ring->next, ring,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+    myEpilogueRing.ring = ring;
+
+    std::call_once(drainThreadStarted, [this]() {
+        std::lock_guard<std::mutex> lock(drainMutex);
+        draining = true;
+        drainer = std::thread(&AsyncEpilogueWorker::drainThread, this);
+    });
+    return ring;
+}
+
+//
+// Run the epilogues of every ring.  Rings of exited threads are freed
+// once drained, except for the first ring of the list, which threads may
+// still be linking new rings to.
+//
+void AsyncEpilogueWorker::drainRings() {
+    AsyncEpilogueRing *first = rings.load(std::memory_order_acquire);
+    AsyncEpilogueRing *previous = nullptr;
+    AsyncEpilogueRing *ring = first;
+    while (ring != nullptr) {
+        bool exited = ring->threadExited.load(std::memory_order_acquire);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        for (; tail != head; tail++) {
+            AsyncEpilogue &epilogue = ring->epilogues[tail % AsyncEpilogueRing::capacity];
+            epilogue.run(epilogue);
+        }
+        ring->tail.store(tail, std::memory_order_release);
+
+        AsyncEpilogueRing *next = ring->next;
+        if (exited && previous != nullptr &&
+            ring->head.load(std::memory_order_acquire) == tail) {
+            previous->next = next;
+            delete ring;
+        } else {
+            previous = ring;
+        }
+        ring = next;
+    }
+}
+
+//
+// The worker holds drainMutex while it drains, so that a flush which
+// takes the mutex only has to wait for the next pass.  APIs called from
+// the epilogues go straight to the driver.
+//
+void AsyncEpilogueWorker::drainThread() {
+    onDrainThread = true;
+    tracingInProgress = 1;
+    std::unique_lock<std::mutex> lock(drainMutex);
+    while (!stopping) {
+        drainWakeup.wait_for(lock, drainInterval);
+        drainRings();
+        drainPasses++;
+        drainDone.notify_all();
+    }
+    draining = false;
+    drainDone.notify_all();
+}
+
+ze_result_t AsyncEpilogueWorker::flush() {
+    if (onDrainThread) {
+        return ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
+    }
+    std::unique_lock<std::mutex> lock(drainMutex);
+    // without a ring, nothing was ever deferred
+    if (rings.load(std::memory_order_acquire) == nullptr) {
+        return ZE_RESULT_SUCCESS;
+    }
+    uint64_t pass = drainPasses + 1;
+    drainWakeup.notify_one();
+    drainDone.wait(lock, [&]() { return drainPasses >= pass || stopping; });
+    return ZE_RESULT_SUCCESS;
+}
+
+//
+// Stop the worker.  Epilogues deferred and not yet run are dropped, since
+// the tracers they belong to were never destroyed.
+//
+void AsyncEpilogueWorker::stop() {
+    {
+        std::lock_guard<std::mutex> lock(drainMutex);
+        if (stopping)
+            return;
+        stopping = true;
+    }
+    drainWakeup.notify_one();
+    drainDone.notify_all();
+    if (drainer.joinable()) {
+        drainer.join();
+    }
+}
+
+//
+// Stop the worker from DllMain, which cannot join it: the thread cannot
+// exit while the loader lock is held.  Wait for it to leave its loop
+// instead, and detach it.  At process exit the thread has already been
+// terminated, possibly holding drainMutex, so it is only detached.
+//
+void AsyncEpilogueWorker::stopWithoutJoin(bool threadTerminated) {
+    if (!threadTerminated) {
+        std::unique_lock<std::mutex> lock(drainMutex);
+        stopping = true;
+        drainWakeup.notify_one();
+        drainDone.notify_all();
+        drainDone.wait(lock, [&]() { return !draining; });
+    }
+    if (drainer.joinable()) {
+        drainer.detach();
+    }
+}
+
+} // namespace tracing_layer
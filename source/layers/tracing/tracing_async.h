@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "layers/zel_tracing_api.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace tracing_layer {
+
+// Room for the argument values of a deferred epilogue.
+constexpr size_t asyncEpilogueArgsSize = 128;
+
+//
+// An epilogue deferred to the worker thread, with the values of the
+// arguments and of the per-call instance user data at the end of the call.
+//
+struct AsyncEpilogue {
+    void (*run)(AsyncEpilogue &epilogue);
+    void (*callback)(void);
+    void *pUserData;
+    void *instanceUserData;
+    ze_result_t result;
+    alignas(8) unsigned char args[asyncEpilogueArgsSize];
+};
+
+//
+// Deferred epilogues of one thread.  The thread is the only producer and
+// the worker the only consumer; an epilogue which does not fit is dropped
+// and counted for its tracer rather than waited for.  The producer only
+// reads the tail the worker writes when the ring looks full, and the two
+// indices live on separate cache lines.
+//
+class AsyncEpilogueRing {
+  public:
+    static constexpr uint64_t capacity = 1024;
+
+    AsyncEpilogue *reserve() {
+        uint64_t head = this->head.load(std::memory_order_relaxed);
+        if (head - cachedTail == capacity) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (head - cachedTail == capacity)
+                return nullptr;
+        }
+        return &epilogues[head % capacity];
+    }
+
+    // Publish the reserved epilogue, and return the number queued.
+    uint64_t commit() {
+        uint64_t head = this->head.load(std::memory_order_relaxed) + 1;
+        this->head.store(head, std::memory_order_release);
+        return head - cachedTail;
+    }
+
+    AsyncEpilogue epilogues[capacity];
+    std::atomic<uint64_t> head{0};
+    uint64_t cachedTail = 0;
+    char padding[64 - sizeof(std::atomic<uint64_t>) - sizeof(uint64_t)];
+    std::atomic<uint64_t> tail{0};
+    std::atomic<bool> threadExited{false};
+    AsyncEpilogueRing *next = nullptr;
+};
+
+// Marks the ring of a thread as no longer written once the thread exits.
+struct AsyncEpilogueRingOwner {
+    ~AsyncEpilogueRingOwner() {
+        if (ring != nullptr)
+            ring->threadExited.store(true, std::memory_order_release);
+    }
+    AsyncEpilogueRing *ring = nullptr;
+};
+
+//
+// The parameters of an API which are single [out] handles or pointers, as a
+// mask of their positions, specialized for each API's parameter structure in
+// ze_trcddi.cpp.  The caller's variables they point to may be gone by the
+// time a deferred epilogue runs, so the epilogue gets copies of their values.
+//
+template <typename TParams>
+struct AsyncEpilogueOutArgs {
+    static constexpr uint32_t mask = 0;
+};
+
+constexpr uint32_t countAsyncEpilogueOutArgs(uint32_t mask) {
+    return mask == 0 ? 0 : (mask & 1) + countAsyncEpilogueOutArgs(mask >> 1);
+}
+
+//
+// The argument values of a call, and the values its single [out] handles
+// and pointers were set to, from which the worker rebuilds the parameter
+// structure of the API for its epilogue.
+//
+template <typename TTracer, typename TParams, typename... Args>
+struct AsyncEpilogueCall {
+    typedef typename std::remove_pointer<TParams>::type params_t;
+    static constexpr uint32_t outArgs = AsyncEpilogueOutArgs<params_t>::mask;
+    static constexpr uint32_t outArgCount = countAsyncEpilogueOutArgs(outArgs);
+
+    static_assert(sizeof(params_t) == sizeof...(Args) * sizeof(void *),
+                  "every parameter of the API is an argument of the call");
+
+    explicit AsyncEpilogueCall(const Args &... args) : args(args...) {
+        copyOutArgs(std::index_sequence_for<Args...>());
+    }
+
+    static void run(AsyncEpilogue &epilogue) {
+        auto call = reinterpret_cast<AsyncEpilogueCall *>(epilogue.args);
+        call->invoke(epilogue, std::index_sequence_for<Args...>());
+        call->~AsyncEpilogueCall();
+    }
+
+    template <size_t... I>
+    void invoke(AsyncEpilogue &epilogue, std::index_sequence<I...>) {
+        params_t params = {&std::get<I>(args)...};
+        reinterpret_cast<TTracer>(epilogue.callback)(
+            &params, epilogue.result, epilogue.pUserData, &epilogue.instanceUserData);
+    }
+
+    template <size_t... I>
+    void copyOutArgs(std::index_sequence<I...>) {
+        int expand[] = {0, (copyOutArg<I>(std::integral_constant<bool, ((outArgs >> I) & 1) != 0>()), 0)...};
+        (void)expand;
+    }
+
+    template <size_t I>
+    void copyOutArg(std::false_type) {}
+
+    // Point the argument at a copy of the value the call left behind it.
+    template <size_t I>
+    void copyOutArg(std::true_type) {
+        auto &arg = std::get<I>(args);
+        typedef typename std::remove_pointer<typename std::decay<decltype(arg)>::type>::type value_t;
+        static_assert(sizeof(value_t) == sizeof(void *), "an [out] argument copied is a handle or a pointer");
+        if (arg != nullptr) {
+            arg = new (outValues[countAsyncEpilogueOutArgs(outArgs & ((1u << I) - 1))]) value_t(*arg);
+        }
+    }
+
+    std::tuple<typename std::decay<Args>::type...> args;
+    alignas(void *) unsigned char outValues[outArgCount > 0 ? outArgCount : 1][sizeof(void *)];
+};
+
+//
+// Runs the epilogues of tracers created with ZEL_TRACER_ASYNC_FLAG_EPILOGUES
+// on a worker thread.  The calling thread copies the argument values into
+// its own ring; the worker, started with the first ring, drains the rings
+// and runs the epilogues in the order each thread called.
+//
+class AsyncEpilogueWorker {
+  public:
+    template <typename TTracer, typename TParams, typename... Args>
+    void defer(void (*callback)(void), void *pUserData, void *instanceUserData,
+               ze_result_t result, std::atomic<uint64_t> *pDropped,
+               Args &&... args) {
+        typedef AsyncEpilogueCall<TTracer, TParams, typename std::decay<Args>::type...> call_t;
+        static_assert(sizeof(call_t) <= asyncEpilogueArgsSize &&
+                          alignof(call_t) <= alignof(AsyncEpilogue),
+                      "the arguments fit in a deferred epilogue");
+
+        AsyncEpilogueRing *ring = myEpilogueRing.ring;
+        if (ring == nullptr) {
+            ring = addRing();
+        }
+        AsyncEpilogue *epilogue = ring->reserve();
+        if (epilogue == nullptr) {
+            pDropped->fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        epilogue->run = &call_t::run;
+        epilogue->callback = callback;
+        epilogue->pUserData = pUserData;
+        epilogue->instanceUserData = instanceUserData;
+        epilogue->result = result;
+        new (epilogue->args) call_t(args...);
+        // wake the worker early rather than drop epilogues of busy threads
+        if (ring->commit() == AsyncEpilogueRing::capacity / 2) {
+            drainWakeup.notify_one();
+        }
+    }
+
+    ze_result_t flush();
+    void stop();
+    void stopWithoutJoin(bool threadTerminated);
+
+  private:
+    AsyncEpilogueRing *addRing();
+    void drainThread();
+    void drainRings();
+
+    static thread_local AsyncEpilogueRingOwner myEpilogueRing;
+
+    std::atomic<AsyncEpilogueRing *> rings{nullptr};
+
+    std::once_flag drainThreadStarted;
+    std::thread drainer;
+    std::mutex drainMutex;
+    std::condition_variable drainWakeup;
+    std::condition_variable drainDone;
+    uint64_t drainPasses = 0;
+    bool draining = false;
+    bool stopping = false;
+};
+
+ze_result_t getTracerAsyncFlags(const zel_tracer_desc_t *desc,
+                                zel_tracer_async_flags_t &flags);
+
+extern AsyncEpilogueWorker *pGlobalAsyncEpilogueWorker;
+
+} // namespace tracing_layer
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define ZEL_TRACING_CLOCK_TSC
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace tracing_layer {
+
+//
+// Times API calls in ticks of the time stamp counter where there is one,
+// which is much cheaper to read than the steady clock, and converts ticks
+// to steady clock time with the tick rate measured since construction.
+//
+class TracingClock {
+  public:
+    TracingClock() : startTicks(ticks()), startTime(steadyTime()) {}
+
+    static uint64_t ticks() {
+#if defined(ZEL_TRACING_CLOCK_TSC)
+        return __rdtsc();
+#else
+        return steadyTime();
+#endif
+    }
+
+    static uint64_t steadyTime() {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+    double nsPerTick() const {
+#if defined(ZEL_TRACING_CLOCK_TSC)
+        uint64_t nowTicks = ticks();
+        uint64_t nowTime = steadyTime();
+        if (nowTicks > startTicks && nowTime > startTime)
+            return double(nowTime - startTime) / double(nowTicks - startTicks);
+#endif
+        return 1.0;
+    }
+
+    uint64_t toSteadyTime(uint64_t ticks, double nsPerTick) const {
+#if defined(ZEL_TRACING_CLOCK_TSC)
+        return startTime + static_cast<uint64_t>(static_cast<double>(
+                               static_cast<int64_t>(ticks - startTicks)) * nsPerTick);
+#else
+        (void)nsPerTick;
+        return ticks;
+#endif
+    }
+
+    uint64_t getStartTime() const { return startTime; }
+
+  private:
+    uint64_t startTicks;
+    uint64_t startTime;
+};
+
+} // namespace tracing_layer
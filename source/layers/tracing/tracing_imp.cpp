@@ -28,32 +28,40 @@ ze_result_t createAPITracer(const zel_tracer_desc_t *desc,
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
+    tracer_sampling_policy_t sampling;
+    ze_result_t result = getTracerSamplingPolicy(desc, sampling);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+
+    zel_tracer_async_flags_t asyncFlags;
+    result = getTracerAsyncFlags(desc, asyncFlags);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+
     APITracerImp *tracer = static_cast<APITracerImp *>(APITracer::create());
 
     tracer->tracerFunctions.pUserData = desc->pUserData;
+    tracer->tracerFunctions.sampling = sampling;
+    if (asyncFlags & ZEL_TRACER_ASYNC_FLAG_EPILOGUES) {
+        tracer->tracerFunctions.pDroppedEpilogues = &tracer->droppedEpilogues;
+    }
 
     *phTracer = tracer->toHandle();
     return ZE_RESULT_SUCCESS;
 }
 
-// This destructor will be called only during at-exit processing,
-// Hence, this function is executing in a single threaded environment,
-// and requires no mutex.
-APITracerContextImp::~APITracerContextImp() {
-    std::list<ThreadPrivateTracerData *>::iterator itr =
-        threadTracerDataList.begin();
-    while (itr != threadTracerDataList.end()) {
-        (*itr)->clearThreadTracerDataOnList();
-        itr = threadTracerDataList.erase(itr);
-    }
-}
-
 ze_result_t APITracerImp::destroyTracer(zel_tracer_handle_t phTracer) {
 
     APITracerImp *tracer = static_cast<APITracerImp *>(phTracer);
 
     ze_result_t result =
         pGlobalAPITracerContextImp->finalizeDisableImpTracingWait(tracer);
+    // deferred epilogues may still use the user data of the tracer
+    if (result == ZE_RESULT_SUCCESS) {
+        result = tracer->flushEpilogues();
+    }
     if (result == ZE_RESULT_SUCCESS) {
         delete tracing_layer::APITracer::fromHandle(phTracer);
     }
@@ -66,7 +74,7 @@ ze_result_t APITracerImp::setPrologues(zel_core_callbacks_t *pCoreCbs) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    copyCoreCbsToAllCbs(this->tracerFunctions.corePrologues, *pCoreCbs);
+    copyCoreCbsToAllCbs(this->tracerFunctions.prologues, *pCoreCbs);
 
     return ZE_RESULT_SUCCESS;
 }
@@ -77,12 +85,12 @@ ze_result_t APITracerImp::setEpilogues(zel_core_callbacks_t *pCoreCbs) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    copyCoreCbsToAllCbs(this->tracerFunctions.coreEpilogues, *pCoreCbs);
+    copyCoreCbsToAllCbs(this->tracerFunctions.epilogues, *pCoreCbs);
 
     return ZE_RESULT_SUCCESS;
 }
 
-zel_all_core_callbacks_t& APITracerImp::getProEpilogues(zel_tracer_reg_t callback_type, ze_result_t& result) {
+zel_all_callbacks_t& APITracerImp::getProEpilogues(zel_tracer_reg_t callback_type, ze_result_t& result) {
 
     result = ZE_RESULT_SUCCESS;
 
@@ -90,9 +98,9 @@ zel_all_core_callbacks_t& APITracerImp::getProEpilogues(zel_tracer_reg_t callbac
         result = ZE_RESULT_ERROR_INVALID_ARGUMENT;
 
     if (callback_type == ZEL_REGISTER_PROLOGUE)
-        return this->tracerFunctions.corePrologues;
+        return this->tracerFunctions.prologues;
     else
-        return this->tracerFunctions.coreEpilogues;
+        return this->tracerFunctions.epilogues;
 }
 
 ze_result_t APITracerImp::resetAllCallbacks() {
@@ -101,8 +109,8 @@ ze_result_t APITracerImp::resetAllCallbacks() {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    this->tracerFunctions.corePrologues = {};
-    this->tracerFunctions.coreEpilogues = {};
+    this->tracerFunctions.prologues = {};
+    this->tracerFunctions.epilogues = {};
 
     return ZE_RESULT_SUCCESS;
 }
@@ -111,7 +119,19 @@ ze_result_t APITracerImp::enableTracer(ze_bool_t enable) {
     return pGlobalAPITracerContextImp->enableTracingImp(this, enable);
 }
 
-void APITracerImp::copyCoreCbsToAllCbs(zel_all_core_callbacks_t& allCbs, zel_core_callbacks_t& cbs) {
+ze_result_t APITracerImp::getDroppedEpilogueCount(uint64_t *pCount) {
+    *pCount = droppedEpilogues.load(std::memory_order_relaxed);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t APITracerImp::flushEpilogues() {
+    if (this->tracerFunctions.pDroppedEpilogues == nullptr) {
+        return ZE_RESULT_SUCCESS;
+    }
+    return pGlobalAsyncEpilogueWorker->flush();
+}
+
+void APITracerImp::copyCoreCbsToAllCbs(zel_all_callbacks_t& allCbs, zel_core_callbacks_t& cbs) {
 
     allCbs.Global.pfnInitCb = cbs.Global.pfnInitCb;
     allCbs.Driver.pfnGetCb = cbs.Driver.pfnGetCb;
@@ -236,101 +256,165 @@ void APITracerImp::copyCoreCbsToAllCbs(zel_all_core_callbacks_t& allCbs, zel_cor
 
 }
     
-void APITracerContextImp::addThreadTracerDataToList(
-    ThreadPrivateTracerData *threadDataP) {
-    std::lock_guard<std::mutex> lock(threadTracerDataListMutex);
-    threadTracerDataList.push_back(threadDataP);
-}
-
-void APITracerContextImp::removeThreadTracerDataFromList(
-    ThreadPrivateTracerData *threadDataP) {
-    std::lock_guard<std::mutex> lock(threadTracerDataListMutex);
-    if (threadTracerDataList.empty())
-        return;
-    threadTracerDataList.remove(threadDataP);
-}
-
-thread_local ThreadPrivateTracerData myThreadPrivateTracerData;
+//
+// Each thread counts itself as a reader in its own shard, and remembers
+// the epoch parity it counted itself under until it leaves.
+//
+static std::atomic<size_t> nextReaderShard{0};
+thread_local size_t myReaderShard = tracerReaderShardCount;
+thread_local size_t myReaderParity = 0;
 
-ThreadPrivateTracerData::ThreadPrivateTracerData() {
-    isInitialized = false;
-    onList = false;
-    tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
-}
+// bool APITracerContextImp::isTracingEnabled() { return
+// driver_ddiTable.enableTracing; }
+bool APITracerContextImp::isTracingEnabled() { return true; }
 
-ThreadPrivateTracerData::~ThreadPrivateTracerData() {
-    if (onList) {
-        pGlobalAPITracerContextImp->removeThreadTracerDataFromList(this);
-        onList = false;
+//
+// Build the per-API callback arrays of a tracer array from its entries, so
+// that a traced call only walks the callbacks registered for its API.
+// All callbacks share one allocation, laid out API by API as the
+// prologues followed by the epilogues, and so do the sampling policies of
+// the tracers of each API.
+//
+void APITracerContextImp::buildTracerArrayApis(tracer_array_t *tracerArray) {
+    const size_t count = tracerArray->tracerArrayCount;
+    size_t callbackCount = 0;
+    size_t policyCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        const tracer_array_entry_t &entry = tracerArray->tracerArrayEntries[i];
+        const tracer_callback_pfn_t *prologues =
+            reinterpret_cast<const tracer_callback_pfn_t *>(&entry.prologues);
+        const tracer_callback_pfn_t *epilogues =
+            reinterpret_cast<const tracer_callback_pfn_t *>(&entry.epilogues);
+        for (size_t api = 0; api < tracerApiCount; api++) {
+            callbackCount += (prologues[api] != nullptr) + (epilogues[api] != nullptr);
+            policyCount += (prologues[api] != nullptr) || (epilogues[api] != nullptr);
+        }
     }
-    tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
-}
 
-void ThreadPrivateTracerData::removeThreadTracerDataFromList(void) {
-    if (onList) {
-        pGlobalAPITracerContextImp->removeThreadTracerDataFromList(this);
-        onList = false;
+    tracerArray->tracerArrayApis = new tracer_array_api_t[tracerApiCount]();
+    tracerArray->tracerArrayCallbacks = new tracer_array_callback_t[callbackCount];
+    tracerArray->tracerArrayPolicies = new tracer_sampling_policy_t[policyCount];
+    tracerArray->samplerCount = 0;
+
+    const tracer_sampling_policy_t &recordPolicy = getDefaultSamplingPolicy();
+    const bool recorded = pGlobalAPIRecorder != nullptr;
+    const bool recordSampled = recorded && recordPolicy.mode != ZEL_TRACER_SAMPLING_MODE_ALL;
+
+    tracer_array_callback_t *next = tracerArray->tracerArrayCallbacks;
+    tracer_sampling_policy_t *nextPolicy = tracerArray->tracerArrayPolicies;
+    for (size_t api = 0; api < tracerApiCount; api++) {
+        tracer_array_api_t &apiCallbacks = tracerArray->tracerArrayApis[api];
+        apiCallbacks.samplingPolicies = nextPolicy;
+        apiCallbacks.sampled = recordSampled;
+        apiCallbacks.skippable = pGlobalAPIStats == nullptr && (!recorded || recordSampled);
+        apiCallbacks.timed = recordSampled && recordPolicy.mode == ZEL_TRACER_SAMPLING_MODE_INTERVAL;
+        apiCallbacks.prologues = next;
+        for (size_t i = 0; i < count; i++) {
+            const tracer_array_entry_t &entry = tracerArray->tracerArrayEntries[i];
+            const tracer_callback_pfn_t prologue =
+                reinterpret_cast<const tracer_callback_pfn_t *>(&entry.prologues)[api];
+            const tracer_callback_pfn_t epilogue =
+                reinterpret_cast<const tracer_callback_pfn_t *>(&entry.epilogues)[api];
+            if (prologue == nullptr && epilogue == nullptr)
+                continue;
+            if (prologue != nullptr) {
+                *next++ = {prologue, entry.pUserData, apiCallbacks.instanceDataCount, nullptr};
+                apiCallbacks.prologueCount++;
+            }
+            *nextPolicy++ = entry.sampling;
+            bool tracerSampled = entry.sampling.mode != ZEL_TRACER_SAMPLING_MODE_ALL;
+            apiCallbacks.sampled |= tracerSampled;
+            apiCallbacks.skippable &= tracerSampled;
+            apiCallbacks.timed |= entry.sampling.mode == ZEL_TRACER_SAMPLING_MODE_INTERVAL;
+            apiCallbacks.instanceDataCount++;
+        }
+        apiCallbacks.skippable &= apiCallbacks.sampled;
+        apiCallbacks.samplerIndex = tracerArray->samplerCount;
+        tracerArray->samplerCount += 1 + apiCallbacks.instanceDataCount;
+
+        apiCallbacks.epilogues = next;
+        size_t instanceDataIndex = 0;
+        for (size_t i = 0; i < count; i++) {
+            const tracer_array_entry_t &entry = tracerArray->tracerArrayEntries[i];
+            const tracer_callback_pfn_t prologue =
+                reinterpret_cast<const tracer_callback_pfn_t *>(&entry.prologues)[api];
+            const tracer_callback_pfn_t epilogue =
+                reinterpret_cast<const tracer_callback_pfn_t *>(&entry.epilogues)[api];
+            if (prologue == nullptr && epilogue == nullptr)
+                continue;
+            if (epilogue != nullptr) {
+                *next++ = {epilogue, entry.pUserData, instanceDataIndex, entry.pDroppedEpilogues};
+                apiCallbacks.epilogueCount++;
+            }
+            instanceDataIndex++;
+        }
     }
-    tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
 }
 
-bool ThreadPrivateTracerData::testAndSetThreadTracerDataInitializedAndOnList(
-    void) {
-    if (!isInitialized) {
-        isInitialized = true;
-        onList = true;
-        pGlobalAPITracerContextImp->addThreadTracerDataToList(
-            &myThreadPrivateTracerData);
+void APITracerContextImp::updateArmedApis(tracer_array_t *tracerArray) {
+    for (size_t word = 0; word < (tracerApiCount + 63) / 64; word++) {
+        uint64_t armed = (pGlobalAPIRecorder != nullptr || pGlobalAPIStats != nullptr) ? ~uint64_t(0) : 0;
+        uint64_t sampled = 0;
+        for (size_t api = word * 64; api < tracerApiCount && api < (word + 1) * 64; api++) {
+            const tracer_array_api_t &apiCallbacks = tracerArray->tracerArrayApis[api];
+            if (apiCallbacks.instanceDataCount != 0)
+                armed |= uint64_t(1) << (api % 64);
+            if (apiCallbacks.skippable)
+                sampled |= uint64_t(1) << (api % 64);
+        }
+        sampledApis[word].store(sampled & armed, std::memory_order_relaxed);
+        armedApis[word].store(armed, std::memory_order_relaxed);
     }
-    return onList;
 }
 
-// bool APITracerContextImp::isTracingEnabled() { return
-// driver_ddiTable.enableTracing; }
-bool APITracerContextImp::isTracingEnabled() { return true; }
+void APITracerContextImp::freeTracerArray(tracer_array_t *tracerArray) {
+    delete[] tracerArray->tracerArrayPolicies;
+    delete[] tracerArray->tracerArrayCallbacks;
+    delete[] tracerArray->tracerArrayApis;
+    delete[] tracerArray->tracerArrayEntries;
+    delete tracerArray;
+}
 
 //
-// Walk the list of per-thread private data structures, testing
-// whether any of them reference this array.
-//
-// Return 1 if a reference is found.  Otherwise return 0.
+// Wait until every thread which may have read the active tracer array
+// before this call has released it.  The wait only depends on the readers
+// in flight, not on the number of threads.
 //
-ze_bool_t
-APITracerContextImp::testForTracerArrayReferences(tracer_array_t *tracerArray) {
-    std::lock_guard<std::mutex> lock(threadTracerDataListMutex);
-    std::list<ThreadPrivateTracerData *>::iterator itr;
-    for (itr = threadTracerDataList.begin(); itr != threadTracerDataList.end();
-         itr++) {
-        if ((*itr)->tracerArrayPointer.load(std::memory_order_relaxed) ==
-            tracerArray)
-            return 1;
+void APITracerContextImp::waitForTracerReaders() {
+    std::lock_guard<std::mutex> lock(readerWaitMutex);
+    //
+    // A reader may have read the epoch before the first advance and counted
+    // itself under the old parity after the wait for it, so it is only
+    // known to have left after the second advance and wait.
+    //
+    for (int advance = 0; advance < 2; advance++) {
+        size_t parity = readerEpoch.fetch_add(1, std::memory_order_seq_cst) & 1;
+        for (size_t shard = 0; shard < tracerReaderShardCount; shard++) {
+            while (readerCounts[parity][shard].count.load(std::memory_order_seq_cst) != 0) {
+                std::this_thread::yield();
+            }
+        }
     }
-    return 0;
 }
 
 //
-// Walk the retiring_tracer_array_list, checking each member of the list for
-// references by per thread tracer array pointer. Delete and free
-// each tracer array that has no per-thread references.
+// Free the tracer arrays retired so far, once their readers have left.
+// This must not be called while holding traceTableMutex, since a reader
+// may be a callback waiting for it to enable or disable a tracer.
 //
-// Return the number of entries on the retiring tracer array list.
-//
-size_t APITracerContextImp::testAndFreeRetiredTracers() {
-    std::list<tracer_array_t *>::iterator itr =
-        this->retiringTracerArrayList.begin();
-    while (itr != this->retiringTracerArrayList.end()) {
-        tracer_array_t *retiringTracerArray = *itr;
-        itr++;
-        if (testForTracerArrayReferences(retiringTracerArray))
-            continue;
-        this->retiringTracerArrayList.remove(retiringTracerArray);
-        delete[] retiringTracerArray->tracerArrayEntries;
-        delete retiringTracerArray;
+void APITracerContextImp::reclaimRetiredTracerArrays() {
+    std::vector<tracer_array_t *> tracerArrays;
+    {
+        std::lock_guard<std::mutex> lock(traceTableMutex);
+        tracerArrays.swap(retiredTracerArrays);
+    }
+    waitForTracerReaders();
+    for (auto tracerArray : tracerArrays) {
+        freeTracerArray(tracerArray);
     }
-    return this->retiringTracerArrayList.size();
 }
 
-size_t APITracerContextImp::updateTracerArrays() {
+void APITracerContextImp::updateTracerArrays() {
     tracer_array_t *newTracerArray;
     size_t newTracerArrayCount = this->enabledTracerImpList.size();
 
@@ -352,6 +436,8 @@ size_t APITracerContextImp::updateTracerArrays() {
             newTracerArray->tracerArrayEntries[i] = (*itr)->tracerFunctions;
             i++;
         }
+        buildTracerArrayApis(newTracerArray);
+        newTracerArray->generation = nextGeneration++;
 
     } else {
         newTracerArray = &emptyTracerArray;
@@ -364,21 +450,21 @@ size_t APITracerContextImp::updateTracerArrays() {
     tracer_array_t *active_tracer_array_shadow =
         activeTracerArray.load(std::memory_order_relaxed);
     if (active_tracer_array_shadow != &emptyTracerArray) {
-        retiringTracerArrayList.push_back(active_tracer_array_shadow);
+        retiredTracerArrays.push_back(active_tracer_array_shadow);
     }
     //
-    // This active_tracer_array.store must use memory_order_release.
-    // This store DOES signal a logical transfer of tracer state information
-    // from this thread to the tracing threads.
+    // This store must be ordered before the reader epoch advances, and
+    // also signals a logical transfer of tracer state information from
+    // this thread to the tracing threads.
     //
-    activeTracerArray.store(newTracerArray, std::memory_order_release);
-    return testAndFreeRetiredTracers();
+    activeTracerArray.store(newTracerArray, std::memory_order_seq_cst);
+    updateArmedApis(newTracerArray);
 }
 
 ze_result_t
 APITracerContextImp::enableTracingImp(struct APITracerImp *tracerImp,
                                       ze_bool_t enable) {
-    std::lock_guard<std::mutex> lock(traceTableMutex);
+    std::unique_lock<std::mutex> lock(traceTableMutex);
     ze_result_t result;
     switch (tracerImp->tracingState) {
     case disabledState:
@@ -394,8 +480,7 @@ APITracerContextImp::enableTracingImp(struct APITracerImp *tracerImp,
         if (!enable) {
             enabledTracerImpList.remove(tracerImp);
             tracerImp->tracingState = disabledWaitingState;
-            if (updateTracerArrays() == 0)
-                tracerImp->tracingState = disabledState;
+            updateTracerArrays();
         }
         result = ZE_RESULT_SUCCESS;
         break;
@@ -409,6 +494,21 @@ APITracerContextImp::enableTracingImp(struct APITracerImp *tracerImp,
         UNRECOVERABLE_IF(true);
         break;
     }
+    bool retired = !retiredTracerArrays.empty();
+    lock.unlock();
+
+    //
+    // A thread tracing an API is itself a reader, and cannot wait for the
+    // readers to leave.  The arrays it retired are freed by the next wait.
+    //
+    if (tracingInProgress || !retired) {
+        return result;
+    }
+    reclaimRetiredTracerArrays();
+
+    lock.lock();
+    if (tracerImp->tracingState == disabledWaitingState)
+        tracerImp->tracingState = disabledState;
     return result;
 }
 
@@ -421,14 +521,16 @@ APITracerContextImp::enableTracingImp(struct APITracerImp *tracerImp,
 // On ZE_RESULT_SUCESS, the destroy tracer method
 // can free the tracer's memory.
 //
-// ZE_RESULT_ERROR_UNINITIALIZED is returned
+// ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE is returned
 // if the tracer has been enabled but not
-// disabled.  The destroy tracer method
-// should NOT free this tracer's memory.
+// disabled, or if it is destroyed from a callback
+// before the callbacks in flight have completed.
+// The destroy tracer method should NOT free this
+// tracer's memory.
 //
 ze_result_t APITracerContextImp::finalizeDisableImpTracingWait(
     struct APITracerImp *tracerImp) {
-    std::lock_guard<std::mutex> lock(traceTableMutex);
+    std::unique_lock<std::mutex> lock(traceTableMutex);
     ze_result_t result;
     switch (tracerImp->tracingState) {
     case disabledState:
@@ -440,9 +542,13 @@ ze_result_t APITracerContextImp::finalizeDisableImpTracingWait(
         break;
 
     case disabledWaitingState:
-        while (testAndFreeRetiredTracers() != 0) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (tracingInProgress) {
+            result = ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
+            break;
         }
+        lock.unlock();
+        reclaimRetiredTracerArrays();
+        lock.lock();
         tracerImp->tracingState = disabledState;
         result = ZE_RESULT_SUCCESS;
         break;
@@ -457,29 +563,23 @@ ze_result_t APITracerContextImp::finalizeDisableImpTracingWait(
 }
 
 void *APITracerContextImp::getActiveTracersList() {
-    tracer_array_t *stableTracerArray = nullptr;
-
-    if (!myThreadPrivateTracerData
-             .testAndSetThreadTracerDataInitializedAndOnList()) {
-        return nullptr;
+    if (myReaderShard == tracerReaderShardCount) {
+        myReaderShard = nextReaderShard.fetch_add(1, std::memory_order_relaxed) %
+                        tracerReaderShardCount;
     }
-
-    do {
-        stableTracerArray = pGlobalAPITracerContextImp->activeTracerArray.load(
-            std::memory_order_acquire);
-        myThreadPrivateTracerData.tracerArrayPointer.store(
-            stableTracerArray, std::memory_order_relaxed);
-    } while (stableTracerArray !=
-             pGlobalAPITracerContextImp->activeTracerArray.load(
-                 std::memory_order_relaxed));
-    return (void *)stableTracerArray;
+    //
+    // A stale parity is harmless: the writer waits for both parities in
+    // turn, and a reader counted after a wait reads the newer array.
+    //
+    myReaderParity = readerEpoch.load(std::memory_order_relaxed) & 1;
+    readerCounts[myReaderParity][myReaderShard].count.fetch_add(
+        1, std::memory_order_seq_cst);
+    return (void *)activeTracerArray.load(std::memory_order_seq_cst);
 }
 
 void APITracerContextImp::releaseActivetracersList() {
-    if (myThreadPrivateTracerData
-            .testAndSetThreadTracerDataInitializedAndOnList())
-        myThreadPrivateTracerData.tracerArrayPointer.store(
-            nullptr, std::memory_order_relaxed);
+    readerCounts[myReaderParity][myReaderShard].count.fetch_sub(
+        1, std::memory_order_release);
 }
 
 } // namespace tracing_layer
@@ -8,15 +8,23 @@
 #pragma once
 
 #include "tracing.h"
+#include "tracing_async.h"
+#include "tracing_record.h"
+#include "tracing_sampling.h"
+#include "tracing_stats.h"
 #include "ze_api.h"
 #include "ze_tracing_cb_structs.h"
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 #define UNRECOVERABLE_IF(expression)                             \
@@ -33,62 +41,133 @@ extern thread_local ze_bool_t tracingInProgress;
 extern struct APITracerContextImp *pGlobalAPITracerContextImp;
 
 typedef struct tracer_array_entry {
-    zel_all_core_callbacks_t corePrologues;
-    zel_all_core_callbacks_t coreEpilogues;
+    zel_all_callbacks_t prologues;
+    zel_all_callbacks_t epilogues;
     void *pUserData;
+    tracer_sampling_policy_t sampling;
+    std::atomic<uint64_t> *pDroppedEpilogues; // null unless epilogues are deferred
 } tracer_array_entry_t;
 
+//
+// Callbacks of one API, as registered by the enabled tracers.  Only
+// non-null callbacks are present.  Each callback names the per-call
+// instance user data slot shared by the prologue and epilogue of its
+// tracer, so that a traced call needs instanceDataCount slots.  Deferred
+// epilogues count the epilogues dropped for their tracer.
+//
+typedef void (*tracer_callback_pfn_t)(void);
+
+typedef struct tracer_array_callback {
+    tracer_callback_pfn_t callback;
+    void *pUserData;
+    size_t instanceDataIndex;
+    std::atomic<uint64_t> *pDropped;
+} tracer_array_callback_t;
+
+//
+// Calls of an API are sampled by the recorder and by each of its tracers,
+// in instance data order, with the per-thread sampler states starting at
+// samplerIndex.  An API is skippable when everything tracing it samples
+// calls, so that the calls in between can bypass tracing altogether.
+//
+typedef struct tracer_array_api {
+    tracer_array_callback_t *prologues;
+    size_t prologueCount;
+    tracer_array_callback_t *epilogues;
+    size_t epilogueCount;
+    size_t instanceDataCount;
+    const tracer_sampling_policy_t *samplingPolicies; // instanceDataCount entries
+    size_t samplerIndex;
+    bool sampled;   // the recorder or a tracer samples calls
+    bool skippable; // the recorder and every tracer sample calls
+    bool timed;     // the recorder or a tracer samples calls by time
+} tracer_array_api_t;
+
+// Every member of zel_all_callbacks_t, down to the tables of the tools
+// and sysman APIs, is a callback pointer, so an API is identified by the
+// index of its callback in that structure.
+constexpr size_t tracerApiCount =
+    sizeof(zel_all_callbacks_t) / sizeof(tracer_callback_pfn_t);
+
+#define ZE_TRACER_API_INDEX(callbackCategory, callbackFunction)         \
+    (offsetof(zel_all_callbacks_t, callbackCategory.callbackFunction) / \
+     sizeof(tracing_layer::tracer_callback_pfn_t))
+
 typedef struct tracerArray {
     size_t tracerArrayCount;
     tracer_array_entry_t *tracerArrayEntries;
+    tracer_array_api_t *tracerArrayApis;         // tracerApiCount entries
+    tracer_array_callback_t *tracerArrayCallbacks; // storage for tracerArrayApis
+    tracer_sampling_policy_t *tracerArrayPolicies; // storage for tracerArrayApis
+    size_t samplerCount;
+    uint64_t generation;
 } tracer_array_t;
 
+//
+// Calls left before the next call of each API on this thread which goes
+// through the sampling decision, while the API is skippable.
+//
+extern thread_local int64_t samplingCountdown[tracerApiCount];
+
+//
+// Decide which tracers of an API sample a call, and return whether the
+// call is recorded.  Also sets the calls to skip before the next decision.
+//
+bool sampleCall(size_t api, const tracer_array_t &tracerArray, bool *sampledTracers);
+
 typedef enum tracingState {
     disabledState,        // tracing has never been enabled
     enabledState,         // tracing is enabled.
-    disabledWaitingState, // tracing has been disabled, but not waited for
+    disabledWaitingState, // tracing has been disabled from within a callback,
+                          // but not waited for
 } tracingState_t;
 
 struct APITracerImp : APITracer {
     ze_result_t destroyTracer(zel_tracer_handle_t phTracer) override;
     ze_result_t setPrologues(zel_core_callbacks_t *pCoreCbs) override;
     ze_result_t setEpilogues(zel_core_callbacks_t *pCoreCbs) override;
-    zel_all_core_callbacks_t& getProEpilogues(zel_tracer_reg_t callback_type, ze_result_t& result) override;
+    zel_all_callbacks_t& getProEpilogues(zel_tracer_reg_t callback_type, ze_result_t& result) override;
     ze_result_t resetAllCallbacks() override;
     ze_result_t enableTracer(ze_bool_t enable) override;
+    ze_result_t getDroppedEpilogueCount(uint64_t *pCount) override;
+    ze_result_t flushEpilogues() override;
 
     tracer_array_entry_t tracerFunctions;
     tracingState_t tracingState;
+    std::atomic<uint64_t> droppedEpilogues{0};
 
   private:
 
-    void copyCoreCbsToAllCbs(zel_all_core_callbacks_t& allCbs, zel_core_callbacks_t& Cbs);
+    void copyCoreCbsToAllCbs(zel_all_callbacks_t& allCbs, zel_core_callbacks_t& Cbs);
 };
 
-class ThreadPrivateTracerData {
-  public:
-    void clearThreadTracerDataOnList(void) { onList = false; }
-    void removeThreadTracerDataFromList(void);
-    bool testAndSetThreadTracerDataInitializedAndOnList(void);
-    bool onList;
-    bool isInitialized;
-    ThreadPrivateTracerData();
-    ~ThreadPrivateTracerData();
-
-    std::atomic<tracer_array_t *> tracerArrayPointer;
-
-  private:
-    ThreadPrivateTracerData(const ThreadPrivateTracerData &);
-    ThreadPrivateTracerData &operator=(const ThreadPrivateTracerData &);
+//
+// Readers of the active tracer array count themselves in one of two sets
+// of counters, selected by the parity of the reader epoch.  A writer
+// retires an array by advancing the epoch twice, each time waiting for
+// the readers counted under the previous parity to leave.  Readers are
+// spread over shards so that they rarely share a counter.
+//
+constexpr size_t tracerReaderShardCount = 64;
+
+struct TracerReaderCount {
+    std::atomic<int64_t> count;
+    char padding[64 - sizeof(std::atomic<int64_t>)];
 };
 
 struct APITracerContextImp : APITracerContext {
   public:
     APITracerContextImp() {
+        buildTracerArrayApis(&emptyTracerArray);
         activeTracerArray.store(&emptyTracerArray, std::memory_order_relaxed);
+        updateArmedApis(&emptyTracerArray);
     };
 
-    ~APITracerContextImp() override;
+    ~APITracerContextImp() {
+        delete[] emptyTracerArray.tracerArrayPolicies;
+        delete[] emptyTracerArray.tracerArrayCallbacks;
+        delete[] emptyTracerArray.tracerArrayApis;
+    }
 
     static void apiTracingEnable(ze_init_flag_t flag);
 
@@ -101,50 +180,83 @@ struct APITracerContextImp : APITracerContext {
 
     bool isTracingEnabled();
 
-    void addThreadTracerDataToList(ThreadPrivateTracerData *threadDataP);
-    void removeThreadTracerDataFromList(ThreadPrivateTracerData *threadDataP);
+    // An API is armed while an enabled tracer has a callback for it, or
+    // while API calls are recorded.
+    bool isApiArmed(size_t api) const {
+        return (armedApis[api / 64].load(std::memory_order_relaxed) >> (api % 64)) & 1;
+    }
+
+    // An API is sampled while the recorder and every enabled tracer with a
+    // callback for it sample its calls.
+    bool isApiSampled(size_t api) const {
+        return (sampledApis[api / 64].load(std::memory_order_relaxed) >> (api % 64)) & 1;
+    }
 
   private:
     std::mutex traceTableMutex;
-    tracer_array_t emptyTracerArray = {0, NULL};
+    tracer_array_t emptyTracerArray = {};
     std::atomic<tracer_array_t *> activeTracerArray;
+    std::atomic<uint64_t> armedApis[(tracerApiCount + 63) / 64] = {};
+    std::atomic<uint64_t> sampledApis[(tracerApiCount + 63) / 64] = {};
+    uint64_t nextGeneration = 1;
+
+    std::atomic<uint64_t> readerEpoch{0};
+    TracerReaderCount readerCounts[2][tracerReaderShardCount] = {};
 
     //
-    // a list of tracer arrays that were once active, but
-    // have been replaced by a new active array.  These
-    // once-active tracer arrays may continue for some time
-    // to have references to them among the per-thread
-    // tracer array pointers.
+    // tracer arrays replaced by a thread that was itself tracing an API,
+    // and so could not wait for the readers.  They are freed after the
+    // next wait.
     //
-    std::list<tracer_array_t *> retiringTracerArrayList;
+    std::vector<tracer_array_t *> retiredTracerArrays;
 
     std::list<struct APITracerImp *> enabledTracerImpList;
 
-    ze_bool_t testForTracerArrayReferences(tracer_array_t *tracerArray);
-    size_t testAndFreeRetiredTracers();
-    size_t updateTracerArrays();
-
-    std::list<ThreadPrivateTracerData *> threadTracerDataList;
-    std::mutex threadTracerDataListMutex;
-};
-
-extern thread_local ThreadPrivateTracerData myThreadPrivateTracerData;
+    std::mutex readerWaitMutex;
 
-template <class T>
-class APITracerCallbackStateImp {
-  public:
-    T current_api_callback;
-    void *pUserData;
+    void waitForTracerReaders();
+    void reclaimRetiredTracerArrays();
+    void updateTracerArrays();
+    static void buildTracerArrayApis(tracer_array_t *tracerArray);
+    void updateArmedApis(tracer_array_t *tracerArray);
+    static void freeTracerArray(tracer_array_t *tracerArray);
 };
 
 template <class T>
 class APITracerCallbackDataImp {
   public:
-    T apiOrdinal = nullptr;
-    std::vector<tracing_layer::APITracerCallbackStateImp<T>> prologCallbacks;
-    std::vector<tracing_layer::APITracerCallbackStateImp<T>> epilogCallbacks;
+    size_t api = 0;
+    const tracer_array_t *tracerArray = nullptr;
+    const tracer_array_api_t *apiCallbacks = nullptr;
 };
 
+//
+// Calls to APIs without callbacks go straight to the driver.  A tracer
+// enabled concurrently with such a call does not see it, just as with
+// calls which already passed the tracing wrapper.
+//
+#define ZE_HANDLE_UNARMED_API(callbackCategory, callbackFunction, ze_api_ptr, ...) \
+    do {                                                                          \
+        if (!tracing_layer::pGlobalAPITracerContextImp->isApiArmed(               \
+                ZE_TRACER_API_INDEX(callbackCategory, callbackFunction))) {       \
+            return ze_api_ptr(__VA_ARGS__);                                       \
+        }                                                                         \
+    } while (0)
+
+//
+// Calls of a sampled API between sampled calls only count down, and go
+// straight to the driver.
+//
+#define ZE_HANDLE_UNSAMPLED_API(callbackCategory, callbackFunction, ze_api_ptr, ...) \
+    do {                                                                            \
+        if (tracing_layer::pGlobalAPITracerContextImp->isApiSampled(                \
+                ZE_TRACER_API_INDEX(callbackCategory, callbackFunction)) &&         \
+            --tracing_layer::samplingCountdown[ZE_TRACER_API_INDEX(                 \
+                callbackCategory, callbackFunction)] > 0) {                         \
+            return ze_api_ptr(__VA_ARGS__);                                         \
+        }                                                                           \
+    } while (0)
+
 #define ZE_HANDLE_TRACER_RECURSION(ze_api_ptr, ...) \
     do {                                            \
         if (tracing_layer::tracingInProgress) {     \
@@ -153,73 +265,121 @@ class APITracerCallbackDataImp {
         tracing_layer::tracingInProgress = 1;       \
     } while (0)
 
-#define ZE_GEN_TRACER_ARRAY_ENTRY(callbackPtr, tracerArray, tracerArrayIndex, \
-                                  callbackType, callbackCategory,             \
-                                  callbackFunction)                           \
-    do {                                                                      \
-        callbackPtr = tracerArray->tracerArrayEntries[tracerArrayIndex]       \
-                          .callbackType.callbackCategory.callbackFunction;    \
-    } while (0)
-
 #define ZE_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType,               \
                                       callbackCategory, callbackFunctionType)       \
+    perApiCallbackData.api =                                                        \
+        ZE_TRACER_API_INDEX(callbackCategory, callbackFunctionType);                \
     tracing_layer::tracer_array_t *currentTracerArray;                              \
     currentTracerArray =                                                            \
         (tracing_layer::tracer_array_t *)                                           \
             tracing_layer::pGlobalAPITracerContextImp->getActiveTracersList();      \
-    if (currentTracerArray) {                                                       \
-        for (size_t i = 0; i < currentTracerArray->tracerArrayCount; i++) {         \
-            tracerType prologueCallbackPtr;                                         \
-            tracerType epilogue_callback_ptr;                                       \
-            ZE_GEN_TRACER_ARRAY_ENTRY(prologueCallbackPtr, currentTracerArray, i,   \
-                                      corePrologues, callbackCategory,              \
-                                      callbackFunctionType);                        \
-            ZE_GEN_TRACER_ARRAY_ENTRY(epilogue_callback_ptr, currentTracerArray, i, \
-                                      coreEpilogues, callbackCategory,              \
-                                      callbackFunctionType);                        \
-                                                                                    \
-            tracing_layer::APITracerCallbackStateImp<tracerType> prologCallback;    \
-            prologCallback.current_api_callback = prologueCallbackPtr;              \
-            prologCallback.pUserData =                                              \
-                currentTracerArray->tracerArrayEntries[i].pUserData;                \
-            perApiCallbackData.prologCallbacks.push_back(prologCallback);           \
-                                                                                    \
-            tracing_layer::APITracerCallbackStateImp<tracerType> epilogCallback;    \
-            epilogCallback.current_api_callback = epilogue_callback_ptr;            \
-            epilogCallback.pUserData =                                              \
-                currentTracerArray->tracerArrayEntries[i].pUserData;                \
-            perApiCallbackData.epilogCallbacks.push_back(epilogCallback);           \
-        }                                                                           \
+    if (currentTracerArray && currentTracerArray->tracerArrayApis) {                \
+        perApiCallbackData.tracerArray = currentTracerArray;                        \
+        perApiCallbackData.apiCallbacks =                                           \
+            &currentTracerArray->tracerArrayApis[ZE_TRACER_API_INDEX(               \
+                callbackCategory, callbackFunctionType)];                           \
     }
 
+//
+// Call the driver, timing the call if it is recorded or API calls are
+// counted.
+//
+template <typename TFunction_pointer, typename TParams, typename... Args>
+ze_result_t APICallWrapperImp(size_t api, bool record, TFunction_pointer zeApiPtr,
+                              TParams paramsStruct, Args &&... args) {
+    APIRecorder *recorder = record ? pGlobalAPIRecorder : nullptr;
+    APIStats *stats = pGlobalAPIStats;
+    if (recorder == nullptr && stats == nullptr) {
+        return zeApiPtr(args...);
+    }
+
+    uint64_t begin = TracingClock::ticks();
+    ze_result_t ret = zeApiPtr(args...);
+    uint64_t end = TracingClock::ticks();
+    if (stats != nullptr) {
+        stats->record(api, end - begin);
+    }
+    if (recorder != nullptr) {
+        typedef typename std::remove_pointer<TParams>::type params_t;
+        zel_api_record_t record = {};
+        record.api = static_cast<uint32_t>(api);
+        record.argCount = APIRecordArgs<params_t>::get(paramsStruct, record.args);
+        record.begin = begin;
+        record.end = end;
+        record.result = ret;
+        recorder->record(record);
+    }
+    return ret;
+}
+
+// Per-call instance user data lives on the stack unless an API has more
+// tracers than this.
+constexpr size_t tracerInstanceDataOnStack = 16;
+
 template <typename TFunction_pointer, typename TParams, typename TTracer,
-          typename TTracerPrologCallbacks, typename TTracerEpilogCallbacks,
           typename... Args>
 ze_result_t
 APITracerWrapperImp(TFunction_pointer zeApiPtr, TParams paramsStruct,
-                    TTracer apiOrdinal, TTracerPrologCallbacks prologCallbacks,
-                    TTracerEpilogCallbacks epilogCallbacks, Args &&... args) {
+                    const APITracerCallbackDataImp<TTracer> &apiCallbackData,
+                    Args &&... args) {
     ze_result_t ret = ZE_RESULT_SUCCESS;
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacks_prologs =
-        &prologCallbacks;
+    const tracer_array_api_t *apiCallbacks = apiCallbackData.apiCallbacks;
+
+    if (apiCallbacks == nullptr || apiCallbacks->instanceDataCount == 0) {
+        bool record = apiCallbacks == nullptr || !apiCallbacks->sampled ||
+                      sampleCall(apiCallbackData.api, *apiCallbackData.tracerArray, nullptr);
+        ret = APICallWrapperImp(apiCallbackData.api, record, zeApiPtr, paramsStruct,
+                                args...);
+        tracing_layer::tracingInProgress = 0;
+        tracing_layer::pGlobalAPITracerContextImp->releaseActivetracersList();
+        return ret;
+    }
 
-    std::vector<void *> ppTracerInstanceUserData;
-    ppTracerInstanceUserData.resize(callbacks_prologs->size());
+    void *stackInstanceUserData[tracerInstanceDataOnStack];
+    bool stackSampledTracers[tracerInstanceDataOnStack];
+    std::unique_ptr<void *[]> heapInstanceUserData;
+    std::unique_ptr<bool[]> heapSampledTracers;
+    void **ppTracerInstanceUserData = stackInstanceUserData;
+    bool *sampledTracers = stackSampledTracers;
+    if (apiCallbacks->instanceDataCount > tracerInstanceDataOnStack) {
+        heapInstanceUserData.reset(new void *[apiCallbacks->instanceDataCount]);
+        heapSampledTracers.reset(new bool[apiCallbacks->instanceDataCount]);
+        ppTracerInstanceUserData = heapInstanceUserData.get();
+        sampledTracers = heapSampledTracers.get();
+    }
+    for (size_t i = 0; i < apiCallbacks->instanceDataCount; i++) {
+        ppTracerInstanceUserData[i] = nullptr;
+        sampledTracers[i] = true;
+    }
+    bool record = true;
+    if (apiCallbacks->sampled) {
+        record = sampleCall(apiCallbackData.api, *apiCallbackData.tracerArray, sampledTracers);
+    }
 
-    for (size_t i = 0; i < callbacks_prologs->size(); i++) {
-        if (callbacks_prologs->at(i).current_api_callback != nullptr)
-            callbacks_prologs->at(i).current_api_callback(
-                paramsStruct, ret, callbacks_prologs->at(i).pUserData,
-                &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < apiCallbacks->prologueCount; i++) {
+        const tracer_array_callback_t &prologue = apiCallbacks->prologues[i];
+        if (!sampledTracers[prologue.instanceDataIndex])
+            continue;
+        reinterpret_cast<TTracer>(prologue.callback)(
+            paramsStruct, ret, prologue.pUserData,
+            &ppTracerInstanceUserData[prologue.instanceDataIndex]);
     }
-    ret = zeApiPtr(args...);
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacksEpilogs =
-        &epilogCallbacks;
-    for (size_t i = 0; i < callbacksEpilogs->size(); i++) {
-        if (callbacksEpilogs->at(i).current_api_callback != nullptr)
-            callbacksEpilogs->at(i).current_api_callback(
-                paramsStruct, ret, callbacksEpilogs->at(i).pUserData,
-                &ppTracerInstanceUserData[i]);
+    ret = APICallWrapperImp(apiCallbackData.api, record, zeApiPtr, paramsStruct,
+                            args...);
+    for (size_t i = 0; i < apiCallbacks->epilogueCount; i++) {
+        const tracer_array_callback_t &epilogue = apiCallbacks->epilogues[i];
+        if (!sampledTracers[epilogue.instanceDataIndex])
+            continue;
+        if (epilogue.pDropped != nullptr) {
+            pGlobalAsyncEpilogueWorker->defer<TTracer, TParams>(
+                epilogue.callback, epilogue.pUserData,
+                ppTracerInstanceUserData[epilogue.instanceDataIndex], ret,
+                epilogue.pDropped, args...);
+            continue;
+        }
+        reinterpret_cast<TTracer>(epilogue.callback)(
+            paramsStruct, ret, epilogue.pUserData,
+            &ppTracerInstanceUserData[epilogue.instanceDataIndex]);
     }
     tracing_layer::tracingInProgress = 0;
     tracing_layer::pGlobalAPITracerContextImp->releaseActivetracersList();
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tracing_record.h"
+#include "ze_util.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace tracing_layer {
+
+APIRecorder *pGlobalAPIRecorder = nullptr;
+
+thread_local APIRecordRingOwner APIRecorder::myRecordRing;
+
+// How often the flusher streams the rings to the file.
+static const std::chrono::milliseconds flushInterval(10);
+
+const std::vector<const api_record_desc_t *> &getAPIRecordDescs() {
+    static const std::vector<const api_record_desc_t *> descs = []() {
+        std::vector<const api_record_desc_t *> all;
+        for (size_t i = 0; i < zeApiRecordDescCount; i++)
+            all.push_back(&zeApiRecordDescs[i]);
+        for (size_t i = 0; i < zetApiRecordDescCount; i++)
+            all.push_back(&zetApiRecordDescs[i]);
+        for (size_t i = 0; i < zesApiRecordDescCount; i++)
+            all.push_back(&zesApiRecordDescs[i]);
+        return all;
+    }();
+    return descs;
+}
+
+APIRecorder *APIRecorder::create() {
+    std::string path = getenv_string("ZEL_TRACE_RECORD");
+    if (path.empty()) {
+        return nullptr;
+    }
+
+    APIRecorder *recorder = new APIRecorder;
+    if (!recorder->file.open(path)) {
+        std::cerr << "ZEL_TRACE_RECORD: cannot open " << path << std::endl;
+        delete recorder;
+        return nullptr;
+    }
+
+    zel_api_record_header_t header = {};
+    memcpy(header.magic, ZEL_API_RECORD_MAGIC, sizeof(header.magic));
+    header.version = ZEL_API_RECORD_VERSION;
+    header.recordSize = sizeof(zel_api_record_t);
+    header.startTime = recorder->clock.getStartTime();
+    const std::vector<const api_record_desc_t *> &descs = getAPIRecordDescs();
+    header.apiCount = static_cast<uint32_t>(descs.size());
+    header.argCount = ZEL_API_RECORD_ARG_COUNT;
+    bool written = recorder->file.write(&header, sizeof(header));
+
+    for (const api_record_desc_t *pDesc : descs) {
+        const api_record_desc_t &desc = *pDesc;
+        zel_api_record_api_desc_t apiDesc = {};
+        apiDesc.api = static_cast<uint32_t>(desc.api);
+        apiDesc.nameSize = static_cast<uint32_t>(strlen(desc.name));
+        apiDesc.argNamesSize = static_cast<uint32_t>(strlen(desc.argNames));
+        const uint64_t padding = 0;
+        size_t size = apiDesc.nameSize + apiDesc.argNamesSize;
+        written = written && recorder->file.write(&apiDesc, sizeof(apiDesc)) &&
+                  recorder->file.write(desc.name, apiDesc.nameSize) &&
+                  recorder->file.write(desc.argNames, apiDesc.argNamesSize) &&
+                  recorder->file.write(&padding, (8 - size % 8) % 8);
+    }
+    if (!written) {
+        std::cerr << "ZEL_TRACE_RECORD: cannot write " << path << std::endl;
+        recorder->file.close();
+        delete recorder;
+        return nullptr;
+    }
+    return recorder;
+}
+
+APIRecordRing *APIRecorder::addRing() {
+    APIRecordRing *ring = new APIRecordRing;
+    ring->thread = nextThread.fetch_add(1, std::memory_order_relaxed);
+    ring->next = rings.load(std::memory_order_relaxed);
+    while (!rings.compare_exchange_weak(ring->next, ring,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+    myRecordRing.ring = ring;
+
+    std::call_once(flushThreadStarted, [this]() {
+        std::lock_guard<std::mutex> lock(flushMutex);
+        flushing = true;
+        flusher = std::thread(&APIRecorder::flushThread, this);
+    });
+    return ring;
+}
+
+//
+// Copy the records of every ring to the file.  Rings of exited threads
+// are freed once drained, except for the first ring of the list, which
+// threads may still be linking new rings to.
+//
+void APIRecorder::flushRings() {
+    // the tick rate is measured over the whole recording so far
+    double nsPerTick = clock.nsPerTick();
+    uint64_t nowTime = TracingClock::steadyTime();
+
+    zel_api_record_t records[256];
+    APIRecordRing *first = rings.load(std::memory_order_acquire);
+    APIRecordRing *previous = nullptr;
+    APIRecordRing *ring = first;
+    while (ring != nullptr) {
+        bool exited = ring->threadExited.load(std::memory_order_acquire);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        while (tail != head) {
+            size_t count = static_cast<size_t>(std::min<uint64_t>(head - tail, sizeof(records) / sizeof(records[0])));
+            for (size_t i = 0; i < count; i++) {
+                records[i] = ring->records[(tail + i) % APIRecordRing::capacity];
+                records[i].begin = clock.toSteadyTime(records[i].begin, nsPerTick);
+                records[i].end = clock.toSteadyTime(records[i].end, nsPerTick);
+            }
+            file.write(records, count * sizeof(zel_api_record_t));
+            tail += count;
+            ring->tail.store(tail, std::memory_order_release);
+        }
+
+        uint64_t dropped = ring->dropped.load(std::memory_order_relaxed);
+        if (dropped != ring->droppedReported) {
+            zel_api_record_t record = {};
+            record.api = ZEL_API_RECORD_DROPPED;
+            record.thread = ring->thread;
+            record.argCount = 1;
+            record.begin = record.end = nowTime;
+            record.args[0] = dropped - ring->droppedReported;
+            file.write(&record, sizeof(record));
+            ring->droppedReported = dropped;
+        }
+
+        APIRecordRing *next = ring->next;
+        if (exited && previous != nullptr &&
+            ring->head.load(std::memory_order_acquire) == tail) {
+            previous->next = next;
+            delete ring;
+        } else {
+            previous = ring;
+        }
+        ring = next;
+    }
+}
+
+void APIRecorder::flushThread() {
+    std::unique_lock<std::mutex> lock(flushMutex);
+    while (!stopping) {
+        flushWakeup.wait_for(lock, flushInterval);
+        flushRings();
+    }
+    flushing = false;
+    flushStopped.notify_all();
+}
+
+//
+// Flush what has been recorded so far and close the file.  Calls
+// recorded afterwards are dropped.
+//
+void APIRecorder::stop() {
+    {
+        std::lock_guard<std::mutex> lock(flushMutex);
+        if (stopping)
+            return;
+        stopping = true;
+    }
+    flushWakeup.notify_one();
+    if (flusher.joinable()) {
+        flusher.join();
+    }
+    std::lock_guard<std::mutex> lock(flushMutex);
+    flushRings();
+    file.close();
+}
+
+//
+// Stop from DllMain, which cannot join the flusher: the thread cannot
+// exit while the loader lock is held.  Wait for it to leave its loop
+// instead, detach it, and flush the rest here.  At process exit the
+// flusher has already been terminated; if it held flushMutex, the rings
+// may be mid-flush and are left as they are.
+//
+void APIRecorder::stopWithoutJoin(bool threadTerminated) {
+    std::unique_lock<std::mutex> lock(flushMutex, std::defer_lock);
+    if (threadTerminated) {
+        if (!lock.try_lock())
+            return;
+    } else {
+        lock.lock();
+    }
+    if (stopping)
+        return;
+    stopping = true;
+    if (!threadTerminated) {
+        flushWakeup.notify_one();
+        flushStopped.wait(lock, [&]() { return !flushing; });
+    }
+    if (flusher.joinable()) {
+        flusher.detach();
+    }
+    flushRings();
+    file.close();
+}
+
+} // namespace tracing_layer
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "layers/zel_tracing_record.h"
+#include "tracing_clock.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tracing_layer {
+
+//
+// Arguments recorded for an API, specialized for each API's parameter
+// structure in ze_trcddi.cpp.  APIs without a specialization record no
+// arguments.
+//
+template <typename TParams>
+struct APIRecordArgs {
+    static uint32_t get(const TParams *, uint64_t *) { return 0; }
+};
+
+inline uint64_t recordArg(const void *handle) {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+}
+
+inline uint64_t recordArg(uint64_t value) { return value; }
+
+// Record as many handles of an array as there are argument slots left.
+template <typename THandle>
+inline uint32_t recordArgArray(uint32_t handleCount, THandle *handles,
+                               uint64_t *args, uint32_t argCount) {
+    for (uint32_t i = 0; handles != nullptr && i < handleCount &&
+                         argCount < ZEL_API_RECORD_ARG_COUNT;
+         i++) {
+        args[argCount++] = recordArg(handles[i]);
+    }
+    return argCount;
+}
+
+// Name and recorded argument names of an API, generated in ze_trcddi.cpp,
+// zet_trcddi.cpp and zes_trcddi.cpp.
+typedef struct api_record_desc {
+    size_t api;
+    const char *name;
+    const char *argNames;
+} api_record_desc_t;
+
+extern const api_record_desc_t zeApiRecordDescs[];
+extern const size_t zeApiRecordDescCount;
+extern const api_record_desc_t zetApiRecordDescs[];
+extern const size_t zetApiRecordDescCount;
+extern const api_record_desc_t zesApiRecordDescs[];
+extern const size_t zesApiRecordDescCount;
+
+// Descriptions of all traced APIs, the core APIs first.
+const std::vector<const api_record_desc_t *> &getAPIRecordDescs();
+
+//
+// Records of one thread.  The thread is the only producer and the
+// flusher the only consumer; a record which does not fit is dropped
+// and counted rather than waited for.
+//
+class APIRecordRing {
+  public:
+    static constexpr uint64_t capacity = 4096;
+
+    bool push(const zel_api_record_t &record) {
+        uint64_t head = this->head.load(std::memory_order_relaxed);
+        if (head - tail.load(std::memory_order_acquire) == capacity) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        records[head % capacity] = record;
+        this->head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    zel_api_record_t records[capacity];
+    std::atomic<uint64_t> head{0};
+    std::atomic<uint64_t> tail{0};
+    std::atomic<uint64_t> dropped{0};
+    uint64_t droppedReported = 0;
+    std::atomic<bool> threadExited{false};
+    uint32_t thread = 0;
+    APIRecordRing *next = nullptr;
+};
+
+// Marks the ring of a thread as no longer written once the thread exits.
+struct APIRecordRingOwner {
+    ~APIRecordRingOwner() {
+        if (ring != nullptr)
+            ring->threadExited.store(true, std::memory_order_release);
+    }
+    APIRecordRing *ring = nullptr;
+};
+
+//
+// Stream of recorded API calls into a file, opened from ZEL_TRACE_RECORD.
+// Platform specific, in linux/ and windows/.
+//
+class APIRecordFile {
+  public:
+    APIRecordFile();
+    ~APIRecordFile();
+    bool open(const std::string &path);
+    bool write(const void *data, size_t size);
+    void close();
+
+  private:
+    APIRecordFile(const APIRecordFile &);
+    APIRecordFile &operator=(const APIRecordFile &);
+
+    struct Imp;
+    Imp *imp;
+};
+
+//
+// Records every traced API call when ZEL_TRACE_RECORD names a file.  The
+// calling thread writes a fixed-size record into its own ring; a
+// background thread, started with the first ring, streams the rings to
+// the file.
+//
+class APIRecorder {
+  public:
+    static APIRecorder *create();
+
+    void record(zel_api_record_t &record) {
+        APIRecordRing *ring = myRecordRing.ring;
+        if (ring == nullptr) {
+            ring = addRing();
+        }
+        record.thread = ring->thread;
+        ring->push(record);
+        // wake the flusher early rather than drop records of busy threads
+        if (ring->head.load(std::memory_order_relaxed) -
+                ring->tail.load(std::memory_order_relaxed) ==
+            APIRecordRing::capacity / 2) {
+            flushWakeup.notify_one();
+        }
+    }
+
+    void stop();
+    void stopWithoutJoin(bool threadTerminated);
+
+  private:
+    APIRecorder() = default;
+
+    APIRecordRing *addRing();
+    void flushThread();
+    void flushRings();
+
+    static thread_local APIRecordRingOwner myRecordRing;
+
+    APIRecordFile file;
+    TracingClock clock;
+    std::atomic<APIRecordRing *> rings{nullptr};
+    std::atomic<uint32_t> nextThread{0};
+
+    std::once_flag flushThreadStarted;
+    std::thread flusher;
+    std::mutex flushMutex;
+    std::condition_variable flushWakeup;
+    std::condition_variable flushStopped;
+    bool flushing = false;
+    bool stopping = false;
+};
+
+extern APIRecorder *pGlobalAPIRecorder;
+
+} // namespace tracing_layer
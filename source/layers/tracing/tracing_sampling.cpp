@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tracing_imp.h"
+#include "ze_util.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace tracing_layer {
+
+thread_local int64_t samplingCountdown[tracerApiCount] = {};
+static thread_local ThreadSamplingState myThreadSampling;
+
+static tracer_sampling_policy_t readDefaultSamplingPolicy() {
+    tracer_sampling_policy_t policy = {ZEL_TRACER_SAMPLING_MODE_ALL, 0, 0};
+    uint64_t count = strtoull(getenv_string("ZEL_TRACING_SAMPLE_EVERY").c_str(), nullptr, 10);
+    uint64_t interval = strtoull(getenv_string("ZEL_TRACING_SAMPLE_INTERVAL_US").c_str(), nullptr, 10);
+    if (count > 1) {
+        policy.mode = ZEL_TRACER_SAMPLING_MODE_EVERY_NTH;
+        policy.count = count;
+    } else if (interval != 0) {
+        policy.mode = ZEL_TRACER_SAMPLING_MODE_INTERVAL;
+        policy.interval = interval * 1000;
+    }
+    return policy;
+}
+
+const tracer_sampling_policy_t &getDefaultSamplingPolicy() {
+    static const tracer_sampling_policy_t policy = readDefaultSamplingPolicy();
+    return policy;
+}
+
+ze_result_t getTracerSamplingPolicy(const zel_tracer_desc_t *desc,
+                                    tracer_sampling_policy_t &policy) {
+    policy = getDefaultSamplingPolicy();
+    // every extension structure starts with its type and next pointer
+    for (const void *pNext = desc->pNext; pNext != nullptr;) {
+        auto ext = static_cast<const zel_tracer_sampling_desc_t *>(pNext);
+        if (ext->stype == ZEL_STRUCTURE_TYPE_TRACER_SAMPLING_DESC) {
+            switch (ext->mode) {
+            case ZEL_TRACER_SAMPLING_MODE_ALL:
+                break;
+            case ZEL_TRACER_SAMPLING_MODE_EVERY_NTH:
+                if (ext->count == 0)
+                    return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+                break;
+            case ZEL_TRACER_SAMPLING_MODE_INTERVAL:
+                if (ext->interval == 0)
+                    return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+                break;
+            default:
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            policy = {ext->mode, ext->count, ext->interval};
+        }
+        pNext = ext->pNext;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+//
+// Calls a timed sampler skips at most before deciding again, which bounds
+// how late it samples once calls slow down.
+//
+static const uint64_t timedSamplingMaxSkip = 256;
+
+//
+// Decide whether a sampler samples this call, and lower next to the
+// number of calls after which it must decide again.  A timed sampler
+// guesses that number from the call rate since the last decision, and
+// decides again halfway there so as not to overshoot its interval.
+//
+static bool sampleNext(const tracer_sampling_policy_t &policy, SamplerState &state,
+                       uint64_t calls, uint64_t now, uint64_t checkTime, uint64_t &next) {
+    switch (policy.mode) {
+    case ZEL_TRACER_SAMPLING_MODE_EVERY_NTH: {
+        bool sampled = state.callsLeft <= calls;
+        state.callsLeft = sampled ? policy.count : state.callsLeft - calls;
+        next = std::min(next, state.callsLeft);
+        return sampled;
+    }
+    case ZEL_TRACER_SAMPLING_MODE_INTERVAL: {
+        bool sampled = now >= state.nextTime;
+        if (sampled)
+            state.nextTime = now + policy.interval;
+        uint64_t expected = 0;
+        if (checkTime != 0 && now > checkTime) {
+            expected = static_cast<uint64_t>(static_cast<double>(state.nextTime - now) *
+                                             static_cast<double>(calls) /
+                                             static_cast<double>(now - checkTime));
+        }
+        next = std::min(next, std::max<uint64_t>(1, std::min(expected / 2, timedSamplingMaxSkip)));
+        return sampled;
+    }
+    default:
+        next = 1;
+        return true;
+    }
+}
+
+bool sampleCall(size_t api, const tracer_array_t &tracerArray, bool *sampledTracers) {
+    ThreadSamplingState &thread = myThreadSampling;
+    if (thread.generation != tracerArray.generation) {
+        thread.generation = tracerArray.generation;
+        thread.apis.assign(tracerApiCount, APISamplingState());
+        thread.samplers.assign(tracerArray.samplerCount, SamplerState());
+    }
+
+    const tracer_array_api_t &apiCallbacks = tracerArray.tracerArrayApis[api];
+    APISamplingState &apiState = thread.apis[api];
+    SamplerState *samplers = &thread.samplers[apiCallbacks.samplerIndex];
+    // calls of an API which is not skippable all come here
+    uint64_t calls = apiCallbacks.skippable ? apiState.calls : 1;
+    uint64_t now = apiCallbacks.timed ? TracingClock::steadyTime() : 0;
+    uint64_t next = UINT64_MAX;
+
+    // the first sampler is the recorder's, followed by the tracers'
+    bool record = pGlobalAPIRecorder != nullptr &&
+                  sampleNext(getDefaultSamplingPolicy(), samplers[0], calls, now,
+                             apiState.checkTime, next);
+    for (size_t i = 0; i < apiCallbacks.instanceDataCount; i++) {
+        sampledTracers[i] = sampleNext(apiCallbacks.samplingPolicies[i], samplers[i + 1],
+                                       calls, now, apiState.checkTime, next);
+    }
+
+    next = std::min<uint64_t>(next, INT64_MAX);
+    apiState.calls = next;
+    if (now != 0)
+        apiState.checkTime = now;
+    samplingCountdown[api] = static_cast<int64_t>(next);
+    return record;
+}
+
+} // namespace tracing_layer
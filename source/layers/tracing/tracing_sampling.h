@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "layers/zel_tracing_api.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace tracing_layer {
+
+// How a tracer, or the recorder, samples the calls of each API on a thread.
+typedef struct tracer_sampling_policy {
+    zel_tracer_sampling_mode_t mode;
+    uint64_t count;    // calls per sampled call
+    uint64_t interval; // nanoseconds between sampled calls
+} tracer_sampling_policy_t;
+
+//
+// Policy of tracers created without a sampling descriptor, and of recorded
+// calls, from ZEL_TRACING_SAMPLE_EVERY or ZEL_TRACING_SAMPLE_INTERVAL_US.
+//
+const tracer_sampling_policy_t &getDefaultSamplingPolicy();
+
+ze_result_t getTracerSamplingPolicy(const zel_tracer_desc_t *desc,
+                                    tracer_sampling_policy_t &policy);
+
+// Sampling state of one tracer, or of the recorder, for one API on a thread.
+struct SamplerState {
+    uint64_t callsLeft = 0; // calls until the next sampled call, this one included
+    uint64_t nextTime = 0;  // time from which the next call is sampled
+};
+
+// Sampling state of one API on a thread.
+struct APISamplingState {
+    uint64_t calls = 1;     // calls since the last sampling decision
+    uint64_t checkTime = 0; // time of the last sampling decision, if timed
+};
+
+//
+// Sampling state of a thread, for the tracer array of the given
+// generation.  The state starts over whenever the tracer array changes.
+//
+struct ThreadSamplingState {
+    uint64_t generation = UINT64_MAX;
+    std::vector<APISamplingState> apis;
+    std::vector<SamplerState> samplers;
+};
+
+} // namespace tracing_layer
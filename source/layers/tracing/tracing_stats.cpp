@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tracing_stats.h"
+#include "tracing_record.h"
+#include "ze_util.h"
+
+#include <algorithm>
+
+namespace tracing_layer {
+
+APIStats *pGlobalAPIStats = nullptr;
+
+thread_local APIThreadStats *APIStats::myThreadStats = nullptr;
+thread_local APIThreadStatsOwner APIStats::myThreadStatsOwner;
+
+void APICallStats::clear() {
+    count.store(0, std::memory_order_relaxed);
+    total.store(0, std::memory_order_relaxed);
+    min.store(UINT64_MAX, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+    for (auto &bucket : buckets)
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+APIThreadStats::APIThreadStats(size_t apiCount)
+    : apis(new std::atomic<APICallStats *>[apiCount]), apiCount(apiCount) {
+    for (size_t api = 0; api < apiCount; api++)
+        apis[api].store(nullptr, std::memory_order_relaxed);
+}
+
+APIThreadStats::~APIThreadStats() {
+    for (size_t api = 0; api < apiCount; api++)
+        delete apis[api].load(std::memory_order_relaxed);
+}
+
+APIStats *APIStats::create(size_t apiCount) {
+    if (!getenv_tobool("ZEL_ENABLE_API_STATS")) {
+        return nullptr;
+    }
+    return new APIStats(apiCount);
+}
+
+//
+// Give a thread the counters of an exited thread, or new ones, and clear
+// them if the statistics were reset since the thread last counted a call.
+//
+APIThreadStats *APIStats::updateThread(APIThreadStats *thread) {
+    if (thread == nullptr) {
+        std::lock_guard<std::mutex> lock(threadsMutex);
+        for (auto &stats : threads) {
+            bool inUse = false;
+            if (stats->inUse.compare_exchange_strong(inUse, true, std::memory_order_acquire)) {
+                thread = stats.get();
+                break;
+            }
+        }
+        if (thread == nullptr) {
+            threads.emplace_back(new APIThreadStats(apiCount));
+            thread = threads.back().get();
+        }
+        myThreadStats = thread;
+        myThreadStatsOwner.stats = thread;
+    }
+
+    uint64_t current = epoch.load(std::memory_order_acquire);
+    if (thread->epoch.load(std::memory_order_relaxed) != current) {
+        for (size_t api = 0; api < apiCount; api++) {
+            APICallStats *call = thread->apis[api].load(std::memory_order_relaxed);
+            if (call != nullptr)
+                call->clear();
+        }
+        thread->epoch.store(current, std::memory_order_release);
+    }
+    return thread;
+}
+
+namespace {
+
+struct MergedCallStats {
+    uint64_t count = 0;
+    uint64_t total = 0;
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+    std::vector<uint64_t> buckets;
+};
+
+// Ticks of the call at the given fraction of the calls, capped by the longest call.
+uint64_t percentile(const MergedCallStats &merged, double fraction) {
+    uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(fraction * merged.count + 0.999999));
+    uint64_t calls = 0;
+    for (size_t bucket = 0; bucket < merged.buckets.size(); bucket++) {
+        calls += merged.buckets[bucket];
+        if (calls >= rank)
+            return std::max(merged.min, std::min(merged.max, apiStatsBucketLimit(bucket)));
+    }
+    return merged.max;
+}
+
+uint64_t toNs(uint64_t ticks, double nsPerTick) {
+    return static_cast<uint64_t>(static_cast<double>(ticks) * nsPerTick);
+}
+
+} // namespace
+
+ze_result_t APIStats::get(uint32_t *pCount, zel_api_stats_t *pStats) {
+    if (pCount == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    std::vector<MergedCallStats> merged(apiCount);
+    {
+        std::lock_guard<std::mutex> lock(threadsMutex);
+        uint64_t current = epoch.load(std::memory_order_acquire);
+        for (auto &thread : threads) {
+            if (thread->epoch.load(std::memory_order_acquire) != current)
+                continue;
+            for (size_t api = 0; api < apiCount; api++) {
+                APICallStats *call = thread->apis[api].load(std::memory_order_acquire);
+                if (call == nullptr || call->count.load(std::memory_order_relaxed) == 0)
+                    continue;
+                MergedCallStats &stats = merged[api];
+                stats.count += call->count.load(std::memory_order_relaxed);
+                stats.total += call->total.load(std::memory_order_relaxed);
+                stats.min = std::min(stats.min, call->min.load(std::memory_order_relaxed));
+                stats.max = std::max(stats.max, call->max.load(std::memory_order_relaxed));
+                stats.buckets.resize(apiStatsBucketCount);
+                for (size_t bucket = 0; bucket < apiStatsBucketCount; bucket++)
+                    stats.buckets[bucket] += call->buckets[bucket].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    uint32_t count = 0;
+    double nsPerTick = clock.nsPerTick();
+    for (const api_record_desc_t *pDesc : getAPIRecordDescs()) {
+        const api_record_desc_t &desc = *pDesc;
+        const MergedCallStats &stats = merged[desc.api];
+        if (stats.count == 0)
+            continue;
+        if (pStats != nullptr && *pCount != 0) {
+            if (count == *pCount)
+                break;
+            zel_api_stats_t &apiStats = pStats[count];
+            apiStats.name = desc.name;
+            apiStats.callCount = stats.count;
+            apiStats.totalTime = toNs(stats.total, nsPerTick);
+            apiStats.minTime = toNs(stats.min, nsPerTick);
+            apiStats.maxTime = toNs(stats.max, nsPerTick);
+            apiStats.p50Time = toNs(percentile(stats, 0.5), nsPerTick);
+            apiStats.p90Time = toNs(percentile(stats, 0.9), nsPerTick);
+            apiStats.p99Time = toNs(percentile(stats, 0.99), nsPerTick);
+            apiStats.p999Time = toNs(percentile(stats, 0.999), nsPerTick);
+        }
+        count++;
+    }
+    *pCount = count;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t APIStats::reset() {
+    epoch.fetch_add(1, std::memory_order_acq_rel);
+    return ZE_RESULT_SUCCESS;
+}
+
+} // namespace tracing_layer
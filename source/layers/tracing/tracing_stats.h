@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "layers/zel_tracing_api.h"
+#include "tracing_clock.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace tracing_layer {
+
+//
+// Call times are counted in log buckets: every power of two range of
+// ticks is split into apiStatsSubBuckets linear buckets, so a bucket is
+// never wider than an eighth of the times it holds.
+//
+constexpr uint32_t apiStatsSubBucketBits = 3;
+constexpr uint32_t apiStatsSubBuckets = 1 << apiStatsSubBucketBits;
+constexpr size_t apiStatsBucketCount = (64 - apiStatsSubBucketBits + 1) * apiStatsSubBuckets;
+
+inline uint32_t highestBit(uint64_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return index;
+#else
+    return 63 - __builtin_clzll(value);
+#endif
+}
+
+inline size_t apiStatsBucket(uint64_t ticks) {
+    if (ticks < apiStatsSubBuckets)
+        return static_cast<size_t>(ticks);
+    uint32_t shift = highestBit(ticks) - apiStatsSubBucketBits;
+    return (shift + 1) * apiStatsSubBuckets + ((ticks >> shift) & (apiStatsSubBuckets - 1));
+}
+
+// Largest number of ticks counted in a bucket.
+inline uint64_t apiStatsBucketLimit(size_t bucket) {
+    if (bucket < apiStatsSubBuckets)
+        return bucket;
+    uint32_t shift = static_cast<uint32_t>(bucket / apiStatsSubBuckets) - 1;
+    uint64_t base = (apiStatsSubBuckets + bucket % apiStatsSubBuckets) << shift;
+    return base + ((uint64_t(1) << shift) - 1);
+}
+
+//
+// Calls of one API on one thread.  Only the owning thread writes, so the
+// counters are updated with plain loads and stores; merging threads read
+// them concurrently.
+//
+struct APICallStats {
+    APICallStats() {
+        for (auto &bucket : buckets)
+            bucket.store(0, std::memory_order_relaxed);
+    }
+
+    void add(uint64_t ticks) {
+        count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        total.store(total.load(std::memory_order_relaxed) + ticks, std::memory_order_relaxed);
+        if (ticks < min.load(std::memory_order_relaxed))
+            min.store(ticks, std::memory_order_relaxed);
+        if (ticks > max.load(std::memory_order_relaxed))
+            max.store(ticks, std::memory_order_relaxed);
+        std::atomic<uint64_t> &bucket = buckets[apiStatsBucket(ticks)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    void clear();
+
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> total{0};
+    std::atomic<uint64_t> min{UINT64_MAX};
+    std::atomic<uint64_t> max{0};
+    std::atomic<uint64_t> buckets[apiStatsBucketCount];
+};
+
+// Calls of one thread, kept for the next thread once the thread exits.
+struct APIThreadStats {
+    explicit APIThreadStats(size_t apiCount);
+    ~APIThreadStats();
+
+    std::unique_ptr<std::atomic<APICallStats *>[]> apis;
+    size_t apiCount;
+    std::atomic<uint64_t> epoch{0};
+    std::atomic<bool> inUse{true};
+};
+
+struct APIThreadStatsOwner {
+    ~APIThreadStatsOwner() {
+        if (stats != nullptr)
+            stats->inUse.store(false, std::memory_order_release);
+    }
+    APIThreadStats *stats = nullptr;
+};
+
+//
+// Per-API call counts and latency histograms, collected when
+// ZEL_ENABLE_API_STATS is set and merged over all threads on demand.
+// Resetting starts a new epoch; each thread clears its own counters on
+// its next call, and counters of older epochs are not merged.
+//
+class APIStats {
+  public:
+    static APIStats *create(size_t apiCount);
+
+    void record(size_t api, uint64_t ticks) {
+        APIThreadStats *thread = myThreadStats;
+        if (thread == nullptr ||
+            thread->epoch.load(std::memory_order_relaxed) != epoch.load(std::memory_order_relaxed)) {
+            thread = updateThread(thread);
+        }
+        APICallStats *call = thread->apis[api].load(std::memory_order_relaxed);
+        if (call == nullptr) {
+            call = new APICallStats;
+            thread->apis[api].store(call, std::memory_order_release);
+        }
+        call->add(ticks);
+    }
+
+    ze_result_t get(uint32_t *pCount, zel_api_stats_t *pStats);
+    ze_result_t reset();
+
+  private:
+    explicit APIStats(size_t apiCount) : apiCount(apiCount) {}
+
+    APIThreadStats *updateThread(APIThreadStats *thread);
+
+    // Trivially destructible, so that reading it is a plain thread local
+    // access; myThreadStatsOwner releases the counters at thread exit.
+    static thread_local APIThreadStats *myThreadStats;
+    static thread_local APIThreadStatsOwner myThreadStatsOwner;
+
+    size_t apiCount;
+    TracingClock clock;
+    std::atomic<uint64_t> epoch{0};
+    std::mutex threadsMutex;
+    std::vector<std::unique_ptr<APIThreadStats>> threads;
+};
+
+extern APIStats *pGlobalAPIStats;
+
+} // namespace tracing_layer
@@ -11,8 +11,15 @@
 namespace tracing_layer {
 extern "C" BOOL APIENTRY DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) {
     if (fdwReason == DLL_PROCESS_DETACH) {
+      // lpvReserved is set at process exit, once the other threads are gone
+      if (pGlobalAPIRecorder != nullptr)
+        pGlobalAPIRecorder->stopWithoutJoin(lpvReserved != nullptr);
+      pGlobalAsyncEpilogueWorker->stopWithoutJoin(lpvReserved != nullptr);
       delete pGlobalAPITracerContextImp;
     } else if (fdwReason == DLL_PROCESS_ATTACH) {
+      pGlobalAPIRecorder = APIRecorder::create();
+      pGlobalAPIStats = APIStats::create(tracerApiCount);
+      pGlobalAsyncEpilogueWorker = new AsyncEpilogueWorker;
       pGlobalAPITracerContextImp = new APITracerContextImp;
     }
    return TRUE;
@@ -0,0 +1,39 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "../tracing_record.h"
+
+#include <cstdio>
+
+namespace tracing_layer
+{
+    struct APIRecordFile::Imp {
+        FILE *file = nullptr;
+    };
+
+    APIRecordFile::APIRecordFile() : imp(new Imp) {}
+
+    APIRecordFile::~APIRecordFile() {
+        close();
+        delete imp;
+    }
+
+    bool APIRecordFile::open(const std::string &path) {
+        return fopen_s(&imp->file, path.c_str(), "wb") == 0 && imp->file != nullptr;
+    }
+
+    bool APIRecordFile::write(const void *data, size_t size) {
+        return imp->file != nullptr && fwrite(data, 1, size, imp->file) == size;
+    }
+
+    void APIRecordFile::close() {
+        if (imp->file != nullptr) {
+            fclose(imp->file);
+            imp->file = nullptr;
+        }
+    }
+}
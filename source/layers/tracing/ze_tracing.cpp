@@ -46,6 +46,41 @@ zelTracerSetEnabled(
     return tracing_layer::APITracer::fromHandle(hTracer)->enableTracer(enable);
 }
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerGetDroppedEpilogueCount(
+    zel_tracer_handle_t hTracer,
+    uint64_t *pCount) {
+    if (hTracer == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    if (pCount == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    return tracing_layer::APITracer::fromHandle(hTracer)->getDroppedEpilogueCount(pCount);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracerFlushEpilogues(
+    zel_tracer_handle_t hTracer) {
+    if (hTracer == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    return tracing_layer::APITracer::fromHandle(hTracer)->flushEpilogues();
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracingGetApiStats(
+    uint32_t *pCount,
+    zel_api_stats_t *pStats) {
+    if (tracing_layer::pGlobalAPIStats == nullptr)
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    return tracing_layer::pGlobalAPIStats->get(pCount, pStats);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zelTracingResetApiStats(void) {
+    if (tracing_layer::pGlobalAPIStats == nullptr)
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    return tracing_layer::pGlobalAPIStats->reset();
+}
+
 }
 #if defined(__cplusplus)
 extern "C" {
@@ -86,6 +121,60 @@ zelGetTracerApiProcAddrTable(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's API statistics table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelGetTracingStatsProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zel_tracing_stats_dditable_t* pDdiTable        ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if( tracing_layer::context.version < version )
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    pDdiTable->pfnGetApiStats                            = tracing::zelTracingGetApiStats;
+
+    pDdiTable->pfnResetApiStats                          = tracing::zelTracingResetApiStats;
+
+    return ZE_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's deferred epilogue
+///        table with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelGetTracerAsyncProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zel_tracer_async_dditable_t* pDdiTable         ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if( tracing_layer::context.version < version )
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    pDdiTable->pfnGetDroppedEpilogueCount                = tracing::zelTracerGetDroppedEpilogueCount;
+
+    pDdiTable->pfnFlushEpilogues                         = tracing::zelTracerFlushEpilogues;
+
+    return ZE_RESULT_SUCCESS;
+}
+
 ZE_DLLEXPORT ze_result_t ZE_APICALL
 zelLoaderGetVersion(zel_component_version_t *version)    
 {
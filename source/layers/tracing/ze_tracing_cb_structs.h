@@ -15,6 +15,8 @@
 
 #include "ze_api.h"
 #include "layers/zel_tracing_register_cb.h"
+#include "zet_tracing_cb_structs.h"
+#include "zes_tracing_cb_structs.h"
 
 
 
@@ -332,8 +334,9 @@ typedef struct _zel_fabric_vertex_callbacks_t
 } zel_fabric_vertex_callbacks_t;
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Container for all callbacks
-typedef struct _zel_all_core_callbacks_t
+/// @brief Container for all callbacks; the core callbacks come first, so
+///        that the tools and sysman APIs do not move the core APIs
+typedef struct _zel_all_callbacks_t
 {
     zel_global_callbacks_t              Global;
     zel_rtas_builder_callbacks_t        RTASBuilder;
@@ -356,7 +359,9 @@ typedef struct _zel_all_core_callbacks_t
     zel_virtual_mem_callbacks_t         VirtualMem;
     zel_fabric_edge_callbacks_t         FabricEdge;
     zel_fabric_vertex_callbacks_t       FabricVertex;
-} zel_all_core_callbacks_t;
+    zel_all_tools_callbacks_t           Tools;
+    zel_all_sysman_callbacks_t          Sysman;
+} zel_all_callbacks_t;
 
 
 
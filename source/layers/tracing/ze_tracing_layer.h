@@ -8,6 +8,8 @@
  */
 #pragma once
 #include "ze_ddi.h"
+#include "zet_ddi.h"
+#include "zes_ddi.h"
 #include "ze_util.h"
 #include "tracing_imp.h"
 
@@ -20,6 +22,8 @@ namespace tracing_layer
         ze_api_version_t version = ZE_API_VERSION_CURRENT;
 
         ze_dditable_t   zeDdiTable = {};
+        zet_dditable_t  zetDdiTable = {};
+        zes_dditable_t  zesDdiTable = {};
 
         context_t();
         ~context_t();
@@ -11,8 +11,21 @@
 #include <iostream>
 #include "ze_tracing_layer.h"
 
+
 namespace tracing_layer
 {
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeInit
+    template <>
+    struct APIRecordArgs<ze_init_params_t>
+    {
+        static uint32_t get(const ze_init_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeInit
     __zedlllocal ze_result_t ZE_APICALL
@@ -26,6 +39,10 @@ namespace tracing_layer
         if( nullptr == pfnInit)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Global, pfnInitCb, context.zeDdiTable.Global.pfnInit, flags);
+
+        ZE_HANDLE_UNSAMPLED_API(Global, pfnInitCb, context.zeDdiTable.Global.pfnInit, flags);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Global.pfnInit, flags);
 
         // capture parameters
@@ -40,12 +57,22 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Global.pfnInit,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.pflags);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDriverGet
+    template <>
+    struct APIRecordArgs<ze_driver_get_params_t>
+    {
+        static uint32_t get(const ze_driver_get_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDriverGet
     __zedlllocal ze_result_t ZE_APICALL
@@ -65,6 +92,10 @@ namespace tracing_layer
         if( nullptr == pfnGet)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Driver, pfnGetCb, context.zeDdiTable.Driver.pfnGet, pCount, phDrivers);
+
+        ZE_HANDLE_UNSAMPLED_API(Driver, pfnGetCb, context.zeDdiTable.Driver.pfnGet, pCount, phDrivers);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGet, pCount, phDrivers);
 
         // capture parameters
@@ -80,13 +111,23 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGet,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphDrivers);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeInitDrivers
+    template <>
+    struct APIRecordArgs<ze_init_drivers_params_t>
+    {
+        static uint32_t get(const ze_init_drivers_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeInitDrivers
     __zedlllocal ze_result_t ZE_APICALL
@@ -108,6 +149,10 @@ namespace tracing_layer
         if( nullptr == pfnInitDrivers)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Global, pfnInitDriversCb, context.zeDdiTable.Global.pfnInitDrivers, pCount, phDrivers, desc);
+
+        ZE_HANDLE_UNSAMPLED_API(Global, pfnInitDriversCb, context.zeDdiTable.Global.pfnInitDrivers, pCount, phDrivers, desc);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Global.pfnInitDrivers, pCount, phDrivers, desc);
 
         // capture parameters
@@ -124,14 +169,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Global.pfnInitDrivers,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphDrivers,
                                                   *tracerParams.pdesc);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDriverGetApiVersion
+    template <>
+    struct APIRecordArgs<ze_driver_get_api_version_params_t>
+    {
+        static uint32_t get(const ze_driver_get_api_version_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDriverGetApiVersion
     __zedlllocal ze_result_t ZE_APICALL
@@ -145,6 +201,10 @@ namespace tracing_layer
         if( nullptr == pfnGetApiVersion)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Driver, pfnGetApiVersionCb, context.zeDdiTable.Driver.pfnGetApiVersion, hDriver, version);
+
+        ZE_HANDLE_UNSAMPLED_API(Driver, pfnGetApiVersionCb, context.zeDdiTable.Driver.pfnGetApiVersion, hDriver, version);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetApiVersion, hDriver, version);
 
         // capture parameters
@@ -160,13 +220,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetApiVersion,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pversion);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDriverGetProperties
+    template <>
+    struct APIRecordArgs<ze_driver_get_properties_params_t>
+    {
+        static uint32_t get(const ze_driver_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDriverGetProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -180,6 +251,10 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Driver, pfnGetPropertiesCb, context.zeDdiTable.Driver.pfnGetProperties, hDriver, pDriverProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Driver, pfnGetPropertiesCb, context.zeDdiTable.Driver.pfnGetProperties, hDriver, pDriverProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetProperties, hDriver, pDriverProperties);
 
         // capture parameters
@@ -195,13 +270,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppDriverProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDriverGetIpcProperties
+    template <>
+    struct APIRecordArgs<ze_driver_get_ipc_properties_params_t>
+    {
+        static uint32_t get(const ze_driver_get_ipc_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDriverGetIpcProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -215,6 +301,10 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Driver, pfnGetIpcPropertiesCb, context.zeDdiTable.Driver.pfnGetIpcProperties, hDriver, pIpcProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Driver, pfnGetIpcPropertiesCb, context.zeDdiTable.Driver.pfnGetIpcProperties, hDriver, pIpcProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetIpcProperties, hDriver, pIpcProperties);
 
         // capture parameters
@@ -230,13 +320,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetIpcProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppIpcProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDriverGetExtensionProperties
+    template <>
+    struct APIRecordArgs<ze_driver_get_extension_properties_params_t>
+    {
+        static uint32_t get(const ze_driver_get_extension_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDriverGetExtensionProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -259,6 +360,10 @@ namespace tracing_layer
         if( nullptr == pfnGetExtensionProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Driver, pfnGetExtensionPropertiesCb, context.zeDdiTable.Driver.pfnGetExtensionProperties, hDriver, pCount, pExtensionProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Driver, pfnGetExtensionPropertiesCb, context.zeDdiTable.Driver.pfnGetExtensionProperties, hDriver, pCount, pExtensionProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetExtensionProperties, hDriver, pCount, pExtensionProperties);
 
         // capture parameters
@@ -275,14 +380,33 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetExtensionProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppExtensionProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDriverGetExtensionFunctionAddress
+    template <>
+    struct APIRecordArgs<ze_driver_get_extension_function_address_params_t>
+    {
+        static uint32_t get(const ze_driver_get_extension_function_address_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeDriverGetExtensionFunctionAddress
+    template <>
+    struct AsyncEpilogueOutArgs<ze_driver_get_extension_function_address_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 2);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDriverGetExtensionFunctionAddress
     __zedlllocal ze_result_t ZE_APICALL
@@ -297,6 +421,10 @@ namespace tracing_layer
         if( nullptr == pfnGetExtensionFunctionAddress)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Driver, pfnGetExtensionFunctionAddressCb, context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress, hDriver, name, ppFunctionAddress);
+
+        ZE_HANDLE_UNSAMPLED_API(Driver, pfnGetExtensionFunctionAddressCb, context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress, hDriver, name, ppFunctionAddress);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress, hDriver, name, ppFunctionAddress);
 
         // capture parameters
@@ -313,14 +441,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pname,
                                                   *tracerParams.pppFunctionAddress);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDriverGetLastErrorDescription
+    template <>
+    struct APIRecordArgs<ze_driver_get_last_error_description_params_t>
+    {
+        static uint32_t get(const ze_driver_get_last_error_description_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDriverGetLastErrorDescription
     __zedlllocal ze_result_t ZE_APICALL
@@ -335,6 +474,10 @@ namespace tracing_layer
         if( nullptr == pfnGetLastErrorDescription)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Driver, pfnGetLastErrorDescriptionCb, context.zeDdiTable.Driver.pfnGetLastErrorDescription, hDriver, ppString);
+
+        ZE_HANDLE_UNSAMPLED_API(Driver, pfnGetLastErrorDescriptionCb, context.zeDdiTable.Driver.pfnGetLastErrorDescription, hDriver, ppString);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetLastErrorDescription, hDriver, ppString);
 
         // capture parameters
@@ -350,13 +493,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetLastErrorDescription,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pppString);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGet
+    template <>
+    struct APIRecordArgs<ze_device_get_params_t>
+    {
+        static uint32_t get(const ze_device_get_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGet
     __zedlllocal ze_result_t ZE_APICALL
@@ -377,6 +531,10 @@ namespace tracing_layer
         if( nullptr == pfnGet)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetCb, context.zeDdiTable.Device.pfnGet, hDriver, pCount, phDevices);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetCb, context.zeDdiTable.Device.pfnGet, hDriver, pCount, phDevices);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGet, hDriver, pCount, phDevices);
 
         // capture parameters
@@ -393,14 +551,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGet,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphDevices);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetRootDevice
+    template <>
+    struct APIRecordArgs<ze_device_get_root_device_params_t>
+    {
+        static uint32_t get(const ze_device_get_root_device_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetRootDevice
     __zedlllocal ze_result_t ZE_APICALL
@@ -414,6 +583,10 @@ namespace tracing_layer
         if( nullptr == pfnGetRootDevice)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetRootDeviceCb, context.zeDdiTable.Device.pfnGetRootDevice, hDevice, phRootDevice);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetRootDeviceCb, context.zeDdiTable.Device.pfnGetRootDevice, hDevice, phRootDevice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetRootDevice, hDevice, phRootDevice);
 
         // capture parameters
@@ -429,13 +602,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetRootDevice,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pphRootDevice);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetSubDevices
+    template <>
+    struct APIRecordArgs<ze_device_get_sub_devices_params_t>
+    {
+        static uint32_t get(const ze_device_get_sub_devices_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetSubDevices
     __zedlllocal ze_result_t ZE_APICALL
@@ -456,6 +640,10 @@ namespace tracing_layer
         if( nullptr == pfnGetSubDevices)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetSubDevicesCb, context.zeDdiTable.Device.pfnGetSubDevices, hDevice, pCount, phSubdevices);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetSubDevicesCb, context.zeDdiTable.Device.pfnGetSubDevices, hDevice, pCount, phSubdevices);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetSubDevices, hDevice, pCount, phSubdevices);
 
         // capture parameters
@@ -472,14 +660,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetSubDevices,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphSubdevices);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetProperties
+    template <>
+    struct APIRecordArgs<ze_device_get_properties_params_t>
+    {
+        static uint32_t get(const ze_device_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -493,6 +692,10 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetPropertiesCb, context.zeDdiTable.Device.pfnGetProperties, hDevice, pDeviceProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetPropertiesCb, context.zeDdiTable.Device.pfnGetProperties, hDevice, pDeviceProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetProperties, hDevice, pDeviceProperties);
 
         // capture parameters
@@ -508,13 +711,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppDeviceProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetComputeProperties
+    template <>
+    struct APIRecordArgs<ze_device_get_compute_properties_params_t>
+    {
+        static uint32_t get(const ze_device_get_compute_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetComputeProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -528,6 +742,10 @@ namespace tracing_layer
         if( nullptr == pfnGetComputeProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetComputePropertiesCb, context.zeDdiTable.Device.pfnGetComputeProperties, hDevice, pComputeProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetComputePropertiesCb, context.zeDdiTable.Device.pfnGetComputeProperties, hDevice, pComputeProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetComputeProperties, hDevice, pComputeProperties);
 
         // capture parameters
@@ -543,13 +761,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetComputeProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppComputeProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetModuleProperties
+    template <>
+    struct APIRecordArgs<ze_device_get_module_properties_params_t>
+    {
+        static uint32_t get(const ze_device_get_module_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetModuleProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -563,6 +792,10 @@ namespace tracing_layer
         if( nullptr == pfnGetModuleProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetModulePropertiesCb, context.zeDdiTable.Device.pfnGetModuleProperties, hDevice, pModuleProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetModulePropertiesCb, context.zeDdiTable.Device.pfnGetModuleProperties, hDevice, pModuleProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetModuleProperties, hDevice, pModuleProperties);
 
         // capture parameters
@@ -578,13 +811,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetModuleProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppModuleProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetCommandQueueGroupProperties
+    template <>
+    struct APIRecordArgs<ze_device_get_command_queue_group_properties_params_t>
+    {
+        static uint32_t get(const ze_device_get_command_queue_group_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetCommandQueueGroupProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -608,6 +852,10 @@ namespace tracing_layer
         if( nullptr == pfnGetCommandQueueGroupProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetCommandQueueGroupPropertiesCb, context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties, hDevice, pCount, pCommandQueueGroupProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetCommandQueueGroupPropertiesCb, context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties, hDevice, pCount, pCommandQueueGroupProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties, hDevice, pCount, pCommandQueueGroupProperties);
 
         // capture parameters
@@ -624,14 +872,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppCommandQueueGroupProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetMemoryProperties
+    template <>
+    struct APIRecordArgs<ze_device_get_memory_properties_params_t>
+    {
+        static uint32_t get(const ze_device_get_memory_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetMemoryProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -654,6 +913,10 @@ namespace tracing_layer
         if( nullptr == pfnGetMemoryProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetMemoryPropertiesCb, context.zeDdiTable.Device.pfnGetMemoryProperties, hDevice, pCount, pMemProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetMemoryPropertiesCb, context.zeDdiTable.Device.pfnGetMemoryProperties, hDevice, pCount, pMemProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetMemoryProperties, hDevice, pCount, pMemProperties);
 
         // capture parameters
@@ -670,14 +933,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetMemoryProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppMemProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetMemoryAccessProperties
+    template <>
+    struct APIRecordArgs<ze_device_get_memory_access_properties_params_t>
+    {
+        static uint32_t get(const ze_device_get_memory_access_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetMemoryAccessProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -691,6 +965,10 @@ namespace tracing_layer
         if( nullptr == pfnGetMemoryAccessProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetMemoryAccessPropertiesCb, context.zeDdiTable.Device.pfnGetMemoryAccessProperties, hDevice, pMemAccessProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetMemoryAccessPropertiesCb, context.zeDdiTable.Device.pfnGetMemoryAccessProperties, hDevice, pMemAccessProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetMemoryAccessProperties, hDevice, pMemAccessProperties);
 
         // capture parameters
@@ -706,13 +984,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetMemoryAccessProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppMemAccessProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetCacheProperties
+    template <>
+    struct APIRecordArgs<ze_device_get_cache_properties_params_t>
+    {
+        static uint32_t get(const ze_device_get_cache_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetCacheProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -734,6 +1023,10 @@ namespace tracing_layer
         if( nullptr == pfnGetCacheProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetCachePropertiesCb, context.zeDdiTable.Device.pfnGetCacheProperties, hDevice, pCount, pCacheProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetCachePropertiesCb, context.zeDdiTable.Device.pfnGetCacheProperties, hDevice, pCount, pCacheProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetCacheProperties, hDevice, pCount, pCacheProperties);
 
         // capture parameters
@@ -750,14 +1043,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetCacheProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppCacheProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetImageProperties
+    template <>
+    struct APIRecordArgs<ze_device_get_image_properties_params_t>
+    {
+        static uint32_t get(const ze_device_get_image_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetImageProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -771,6 +1075,10 @@ namespace tracing_layer
         if( nullptr == pfnGetImageProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetImagePropertiesCb, context.zeDdiTable.Device.pfnGetImageProperties, hDevice, pImageProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetImagePropertiesCb, context.zeDdiTable.Device.pfnGetImageProperties, hDevice, pImageProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetImageProperties, hDevice, pImageProperties);
 
         // capture parameters
@@ -786,13 +1094,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetImageProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppImageProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetExternalMemoryProperties
+    template <>
+    struct APIRecordArgs<ze_device_get_external_memory_properties_params_t>
+    {
+        static uint32_t get(const ze_device_get_external_memory_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetExternalMemoryProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -806,6 +1125,10 @@ namespace tracing_layer
         if( nullptr == pfnGetExternalMemoryProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetExternalMemoryPropertiesCb, context.zeDdiTable.Device.pfnGetExternalMemoryProperties, hDevice, pExternalMemoryProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetExternalMemoryPropertiesCb, context.zeDdiTable.Device.pfnGetExternalMemoryProperties, hDevice, pExternalMemoryProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetExternalMemoryProperties, hDevice, pExternalMemoryProperties);
 
         // capture parameters
@@ -821,13 +1144,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetExternalMemoryProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppExternalMemoryProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetP2PProperties
+    template <>
+    struct APIRecordArgs<ze_device_get_p2_p_properties_params_t>
+    {
+        static uint32_t get(const ze_device_get_p2_p_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->phPeerDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetP2PProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -842,6 +1177,10 @@ namespace tracing_layer
         if( nullptr == pfnGetP2PProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetP2PPropertiesCb, context.zeDdiTable.Device.pfnGetP2PProperties, hDevice, hPeerDevice, pP2PProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetP2PPropertiesCb, context.zeDdiTable.Device.pfnGetP2PProperties, hDevice, hPeerDevice, pP2PProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetP2PProperties, hDevice, hPeerDevice, pP2PProperties);
 
         // capture parameters
@@ -858,14 +1197,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetP2PProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phPeerDevice,
                                                   *tracerParams.ppP2PProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceCanAccessPeer
+    template <>
+    struct APIRecordArgs<ze_device_can_access_peer_params_t>
+    {
+        static uint32_t get(const ze_device_can_access_peer_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->phPeerDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceCanAccessPeer
     __zedlllocal ze_result_t ZE_APICALL
@@ -880,6 +1231,10 @@ namespace tracing_layer
         if( nullptr == pfnCanAccessPeer)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnCanAccessPeerCb, context.zeDdiTable.Device.pfnCanAccessPeer, hDevice, hPeerDevice, value);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnCanAccessPeerCb, context.zeDdiTable.Device.pfnCanAccessPeer, hDevice, hPeerDevice, value);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnCanAccessPeer, hDevice, hPeerDevice, value);
 
         // capture parameters
@@ -896,14 +1251,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnCanAccessPeer,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phPeerDevice,
                                                   *tracerParams.pvalue);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetStatus
+    template <>
+    struct APIRecordArgs<ze_device_get_status_params_t>
+    {
+        static uint32_t get(const ze_device_get_status_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetStatus
     __zedlllocal ze_result_t ZE_APICALL
@@ -916,6 +1282,10 @@ namespace tracing_layer
         if( nullptr == pfnGetStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetStatusCb, context.zeDdiTable.Device.pfnGetStatus, hDevice);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetStatusCb, context.zeDdiTable.Device.pfnGetStatus, hDevice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetStatus, hDevice);
 
         // capture parameters
@@ -930,12 +1300,23 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetStatus,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetGlobalTimestamps
+    template <>
+    struct APIRecordArgs<ze_device_get_global_timestamps_params_t>
+    {
+        static uint32_t get(const ze_device_get_global_timestamps_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetGlobalTimestamps
     __zedlllocal ze_result_t ZE_APICALL
@@ -952,6 +1333,10 @@ namespace tracing_layer
         if( nullptr == pfnGetGlobalTimestamps)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetGlobalTimestampsCb, context.zeDdiTable.Device.pfnGetGlobalTimestamps, hDevice, hostTimestamp, deviceTimestamp);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetGlobalTimestampsCb, context.zeDdiTable.Device.pfnGetGlobalTimestamps, hDevice, hostTimestamp, deviceTimestamp);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetGlobalTimestamps, hDevice, hostTimestamp, deviceTimestamp);
 
         // capture parameters
@@ -968,14 +1353,33 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetGlobalTimestamps,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phostTimestamp,
                                                   *tracerParams.pdeviceTimestamp);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeContextCreate
+    template <>
+    struct APIRecordArgs<ze_context_create_params_t>
+    {
+        static uint32_t get(const ze_context_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeContextCreate
+    template <>
+    struct AsyncEpilogueOutArgs<ze_context_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 2);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeContextCreate
     __zedlllocal ze_result_t ZE_APICALL
@@ -990,6 +1394,10 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Context, pfnCreateCb, context.zeDdiTable.Context.pfnCreate, hDriver, desc, phContext);
+
+        ZE_HANDLE_UNSAMPLED_API(Context, pfnCreateCb, context.zeDdiTable.Context.pfnCreate, hDriver, desc, phContext);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnCreate, hDriver, desc, phContext);
 
         // capture parameters
@@ -1006,14 +1414,34 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphContext);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeContextCreateEx
+    template <>
+    struct APIRecordArgs<ze_context_create_ex_params_t>
+    {
+        static uint32_t get(const ze_context_create_ex_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            args[count++] = recordArg(*params->pnumDevices);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeContextCreateEx
+    template <>
+    struct AsyncEpilogueOutArgs<ze_context_create_ex_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 4);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeContextCreateEx
     __zedlllocal ze_result_t ZE_APICALL
@@ -1038,6 +1466,10 @@ namespace tracing_layer
         if( nullptr == pfnCreateEx)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Context, pfnCreateExCb, context.zeDdiTable.Context.pfnCreateEx, hDriver, desc, numDevices, phDevices, phContext);
+
+        ZE_HANDLE_UNSAMPLED_API(Context, pfnCreateExCb, context.zeDdiTable.Context.pfnCreateEx, hDriver, desc, numDevices, phDevices, phContext);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnCreateEx, hDriver, desc, numDevices, phDevices, phContext);
 
         // capture parameters
@@ -1056,9 +1488,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnCreateEx,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pnumDevices,
@@ -1066,6 +1496,19 @@ namespace tracing_layer
                                                   *tracerParams.pphContext);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeContextDestroy
+    template <>
+    struct APIRecordArgs<ze_context_destroy_params_t>
+    {
+        static uint32_t get(const ze_context_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeContextDestroy
     __zedlllocal ze_result_t ZE_APICALL
@@ -1078,6 +1521,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Context, pfnDestroyCb, context.zeDdiTable.Context.pfnDestroy, hContext);
+
+        ZE_HANDLE_UNSAMPLED_API(Context, pfnDestroyCb, context.zeDdiTable.Context.pfnDestroy, hContext);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnDestroy, hContext);
 
         // capture parameters
@@ -1092,12 +1539,23 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeContextGetStatus
+    template <>
+    struct APIRecordArgs<ze_context_get_status_params_t>
+    {
+        static uint32_t get(const ze_context_get_status_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeContextGetStatus
     __zedlllocal ze_result_t ZE_APICALL
@@ -1110,6 +1568,10 @@ namespace tracing_layer
         if( nullptr == pfnGetStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Context, pfnGetStatusCb, context.zeDdiTable.Context.pfnGetStatus, hContext);
+
+        ZE_HANDLE_UNSAMPLED_API(Context, pfnGetStatusCb, context.zeDdiTable.Context.pfnGetStatus, hContext);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnGetStatus, hContext);
 
         // capture parameters
@@ -1124,12 +1586,32 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnGetStatus,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandQueueCreate
+    template <>
+    struct APIRecordArgs<ze_command_queue_create_params_t>
+    {
+        static uint32_t get(const ze_command_queue_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeCommandQueueCreate
+    template <>
+    struct AsyncEpilogueOutArgs<ze_command_queue_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 3);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandQueueCreate
     __zedlllocal ze_result_t ZE_APICALL
@@ -1145,6 +1627,10 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandQueue, pfnCreateCb, context.zeDdiTable.CommandQueue.pfnCreate, hContext, hDevice, desc, phCommandQueue);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandQueue, pfnCreateCb, context.zeDdiTable.CommandQueue.pfnCreate, hContext, hDevice, desc, phCommandQueue);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnCreate, hContext, hDevice, desc, phCommandQueue);
 
         // capture parameters
@@ -1162,15 +1648,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphCommandQueue);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandQueueDestroy
+    template <>
+    struct APIRecordArgs<ze_command_queue_destroy_params_t>
+    {
+        static uint32_t get(const ze_command_queue_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandQueue);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandQueueDestroy
     __zedlllocal ze_result_t ZE_APICALL
@@ -1183,6 +1680,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandQueue, pfnDestroyCb, context.zeDdiTable.CommandQueue.pfnDestroy, hCommandQueue);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandQueue, pfnDestroyCb, context.zeDdiTable.CommandQueue.pfnDestroy, hCommandQueue);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnDestroy, hCommandQueue);
 
         // capture parameters
@@ -1197,12 +1698,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandQueueExecuteCommandLists
+    template <>
+    struct APIRecordArgs<ze_command_queue_execute_command_lists_params_t>
+    {
+        static uint32_t get(const ze_command_queue_execute_command_lists_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandQueue);
+            args[count++] = recordArg(*params->pnumCommandLists);
+            args[count++] = recordArg(*params->phFence);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandQueueExecuteCommandLists
     __zedlllocal ze_result_t ZE_APICALL
@@ -1219,6 +1733,10 @@ namespace tracing_layer
         if( nullptr == pfnExecuteCommandLists)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandQueue, pfnExecuteCommandListsCb, context.zeDdiTable.CommandQueue.pfnExecuteCommandLists, hCommandQueue, numCommandLists, phCommandLists, hFence);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandQueue, pfnExecuteCommandListsCb, context.zeDdiTable.CommandQueue.pfnExecuteCommandLists, hCommandQueue, numCommandLists, phCommandLists, hFence);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnExecuteCommandLists, hCommandQueue, numCommandLists, phCommandLists, hFence);
 
         // capture parameters
@@ -1236,15 +1754,27 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnExecuteCommandLists,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
                                                   *tracerParams.pnumCommandLists,
                                                   *tracerParams.pphCommandLists,
                                                   *tracerParams.phFence);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandQueueSynchronize
+    template <>
+    struct APIRecordArgs<ze_command_queue_synchronize_params_t>
+    {
+        static uint32_t get(const ze_command_queue_synchronize_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandQueue);
+            args[count++] = recordArg(*params->ptimeout);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandQueueSynchronize
     __zedlllocal ze_result_t ZE_APICALL
@@ -1264,6 +1794,10 @@ namespace tracing_layer
         if( nullptr == pfnSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandQueue, pfnSynchronizeCb, context.zeDdiTable.CommandQueue.pfnSynchronize, hCommandQueue, timeout);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandQueue, pfnSynchronizeCb, context.zeDdiTable.CommandQueue.pfnSynchronize, hCommandQueue, timeout);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnSynchronize, hCommandQueue, timeout);
 
         // capture parameters
@@ -1279,13 +1813,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
                                                   *tracerParams.ptimeout);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandQueueGetOrdinal
+    template <>
+    struct APIRecordArgs<ze_command_queue_get_ordinal_params_t>
+    {
+        static uint32_t get(const ze_command_queue_get_ordinal_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandQueue);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandQueueGetOrdinal
     __zedlllocal ze_result_t ZE_APICALL
@@ -1299,6 +1844,10 @@ namespace tracing_layer
         if( nullptr == pfnGetOrdinal)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandQueue, pfnGetOrdinalCb, context.zeDdiTable.CommandQueue.pfnGetOrdinal, hCommandQueue, pOrdinal);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandQueue, pfnGetOrdinalCb, context.zeDdiTable.CommandQueue.pfnGetOrdinal, hCommandQueue, pOrdinal);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnGetOrdinal, hCommandQueue, pOrdinal);
 
         // capture parameters
@@ -1314,13 +1863,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnGetOrdinal,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
                                                   *tracerParams.ppOrdinal);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandQueueGetIndex
+    template <>
+    struct APIRecordArgs<ze_command_queue_get_index_params_t>
+    {
+        static uint32_t get(const ze_command_queue_get_index_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandQueue);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandQueueGetIndex
     __zedlllocal ze_result_t ZE_APICALL
@@ -1334,6 +1894,10 @@ namespace tracing_layer
         if( nullptr == pfnGetIndex)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandQueue, pfnGetIndexCb, context.zeDdiTable.CommandQueue.pfnGetIndex, hCommandQueue, pIndex);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandQueue, pfnGetIndexCb, context.zeDdiTable.CommandQueue.pfnGetIndex, hCommandQueue, pIndex);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnGetIndex, hCommandQueue, pIndex);
 
         // capture parameters
@@ -1349,13 +1913,33 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnGetIndex,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
                                                   *tracerParams.ppIndex);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListCreate
+    template <>
+    struct APIRecordArgs<ze_command_list_create_params_t>
+    {
+        static uint32_t get(const ze_command_list_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeCommandListCreate
+    template <>
+    struct AsyncEpilogueOutArgs<ze_command_list_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 3);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListCreate
     __zedlllocal ze_result_t ZE_APICALL
@@ -1371,6 +1955,10 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnCreateCb, context.zeDdiTable.CommandList.pfnCreate, hContext, hDevice, desc, phCommandList);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnCreateCb, context.zeDdiTable.CommandList.pfnCreate, hContext, hDevice, desc, phCommandList);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnCreate, hContext, hDevice, desc, phCommandList);
 
         // capture parameters
@@ -1388,15 +1976,35 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphCommandList);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListCreateImmediate
+    template <>
+    struct APIRecordArgs<ze_command_list_create_immediate_params_t>
+    {
+        static uint32_t get(const ze_command_list_create_immediate_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeCommandListCreateImmediate
+    template <>
+    struct AsyncEpilogueOutArgs<ze_command_list_create_immediate_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 3);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListCreateImmediate
     __zedlllocal ze_result_t ZE_APICALL
@@ -1412,6 +2020,10 @@ namespace tracing_layer
         if( nullptr == pfnCreateImmediate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnCreateImmediateCb, context.zeDdiTable.CommandList.pfnCreateImmediate, hContext, hDevice, altdesc, phCommandList);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnCreateImmediateCb, context.zeDdiTable.CommandList.pfnCreateImmediate, hContext, hDevice, altdesc, phCommandList);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnCreateImmediate, hContext, hDevice, altdesc, phCommandList);
 
         // capture parameters
@@ -1429,15 +2041,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnCreateImmediate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.paltdesc,
                                                   *tracerParams.pphCommandList);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListDestroy
+    template <>
+    struct APIRecordArgs<ze_command_list_destroy_params_t>
+    {
+        static uint32_t get(const ze_command_list_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListDestroy
     __zedlllocal ze_result_t ZE_APICALL
@@ -1450,6 +2073,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnDestroyCb, context.zeDdiTable.CommandList.pfnDestroy, hCommandList);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnDestroyCb, context.zeDdiTable.CommandList.pfnDestroy, hCommandList);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnDestroy, hCommandList);
 
         // capture parameters
@@ -1464,12 +2091,23 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListClose
+    template <>
+    struct APIRecordArgs<ze_command_list_close_params_t>
+    {
+        static uint32_t get(const ze_command_list_close_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListClose
     __zedlllocal ze_result_t ZE_APICALL
@@ -1482,6 +2120,10 @@ namespace tracing_layer
         if( nullptr == pfnClose)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnCloseCb, context.zeDdiTable.CommandList.pfnClose, hCommandList);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnCloseCb, context.zeDdiTable.CommandList.pfnClose, hCommandList);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnClose, hCommandList);
 
         // capture parameters
@@ -1496,12 +2138,23 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnClose,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListReset
+    template <>
+    struct APIRecordArgs<ze_command_list_reset_params_t>
+    {
+        static uint32_t get(const ze_command_list_reset_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListReset
     __zedlllocal ze_result_t ZE_APICALL
@@ -1514,6 +2167,10 @@ namespace tracing_layer
         if( nullptr == pfnReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnResetCb, context.zeDdiTable.CommandList.pfnReset, hCommandList);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnResetCb, context.zeDdiTable.CommandList.pfnReset, hCommandList);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnReset, hCommandList);
 
         // capture parameters
@@ -1528,12 +2185,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnReset,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendWriteGlobalTimestamp
+    template <>
+    struct APIRecordArgs<ze_command_list_append_write_global_timestamp_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_write_global_timestamp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendWriteGlobalTimestamp
     __zedlllocal ze_result_t ZE_APICALL
@@ -1553,6 +2224,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendWriteGlobalTimestamp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendWriteGlobalTimestampCb, context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp, hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendWriteGlobalTimestampCb, context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp, hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp, hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -1571,9 +2246,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.phSignalEvent,
@@ -1581,6 +2254,20 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListHostSynchronize
+    template <>
+    struct APIRecordArgs<ze_command_list_host_synchronize_params_t>
+    {
+        static uint32_t get(const ze_command_list_host_synchronize_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->ptimeout);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListHostSynchronize
     __zedlllocal ze_result_t ZE_APICALL
@@ -1600,6 +2287,10 @@ namespace tracing_layer
         if( nullptr == pfnHostSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnHostSynchronizeCb, context.zeDdiTable.CommandList.pfnHostSynchronize, hCommandList, timeout);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnHostSynchronizeCb, context.zeDdiTable.CommandList.pfnHostSynchronize, hCommandList, timeout);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnHostSynchronize, hCommandList, timeout);
 
         // capture parameters
@@ -1615,13 +2306,32 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnHostSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ptimeout);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListGetDeviceHandle
+    template <>
+    struct APIRecordArgs<ze_command_list_get_device_handle_params_t>
+    {
+        static uint32_t get(const ze_command_list_get_device_handle_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeCommandListGetDeviceHandle
+    template <>
+    struct AsyncEpilogueOutArgs<ze_command_list_get_device_handle_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 1);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListGetDeviceHandle
     __zedlllocal ze_result_t ZE_APICALL
@@ -1635,6 +2345,10 @@ namespace tracing_layer
         if( nullptr == pfnGetDeviceHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnGetDeviceHandleCb, context.zeDdiTable.CommandList.pfnGetDeviceHandle, hCommandList, phDevice);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnGetDeviceHandleCb, context.zeDdiTable.CommandList.pfnGetDeviceHandle, hCommandList, phDevice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnGetDeviceHandle, hCommandList, phDevice);
 
         // capture parameters
@@ -1650,13 +2364,32 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnGetDeviceHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pphDevice);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListGetContextHandle
+    template <>
+    struct APIRecordArgs<ze_command_list_get_context_handle_params_t>
+    {
+        static uint32_t get(const ze_command_list_get_context_handle_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeCommandListGetContextHandle
+    template <>
+    struct AsyncEpilogueOutArgs<ze_command_list_get_context_handle_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 1);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListGetContextHandle
     __zedlllocal ze_result_t ZE_APICALL
@@ -1670,6 +2403,10 @@ namespace tracing_layer
         if( nullptr == pfnGetContextHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnGetContextHandleCb, context.zeDdiTable.CommandList.pfnGetContextHandle, hCommandList, phContext);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnGetContextHandleCb, context.zeDdiTable.CommandList.pfnGetContextHandle, hCommandList, phContext);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnGetContextHandle, hCommandList, phContext);
 
         // capture parameters
@@ -1685,13 +2422,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnGetContextHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pphContext);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListGetOrdinal
+    template <>
+    struct APIRecordArgs<ze_command_list_get_ordinal_params_t>
+    {
+        static uint32_t get(const ze_command_list_get_ordinal_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListGetOrdinal
     __zedlllocal ze_result_t ZE_APICALL
@@ -1705,6 +2453,10 @@ namespace tracing_layer
         if( nullptr == pfnGetOrdinal)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnGetOrdinalCb, context.zeDdiTable.CommandList.pfnGetOrdinal, hCommandList, pOrdinal);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnGetOrdinalCb, context.zeDdiTable.CommandList.pfnGetOrdinal, hCommandList, pOrdinal);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnGetOrdinal, hCommandList, pOrdinal);
 
         // capture parameters
@@ -1720,13 +2472,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnGetOrdinal,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ppOrdinal);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListImmediateGetIndex
+    template <>
+    struct APIRecordArgs<ze_command_list_immediate_get_index_params_t>
+    {
+        static uint32_t get(const ze_command_list_immediate_get_index_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandListImmediate);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListImmediateGetIndex
     __zedlllocal ze_result_t ZE_APICALL
@@ -1741,6 +2504,10 @@ namespace tracing_layer
         if( nullptr == pfnImmediateGetIndex)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnImmediateGetIndexCb, context.zeDdiTable.CommandList.pfnImmediateGetIndex, hCommandListImmediate, pIndex);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnImmediateGetIndexCb, context.zeDdiTable.CommandList.pfnImmediateGetIndex, hCommandListImmediate, pIndex);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnImmediateGetIndex, hCommandListImmediate, pIndex);
 
         // capture parameters
@@ -1756,13 +2523,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnImmediateGetIndex,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandListImmediate,
                                                   *tracerParams.ppIndex);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListIsImmediate
+    template <>
+    struct APIRecordArgs<ze_command_list_is_immediate_params_t>
+    {
+        static uint32_t get(const ze_command_list_is_immediate_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListIsImmediate
     __zedlllocal ze_result_t ZE_APICALL
@@ -1777,6 +2555,10 @@ namespace tracing_layer
         if( nullptr == pfnIsImmediate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnIsImmediateCb, context.zeDdiTable.CommandList.pfnIsImmediate, hCommandList, pIsImmediate);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnIsImmediateCb, context.zeDdiTable.CommandList.pfnIsImmediate, hCommandList, pIsImmediate);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnIsImmediate, hCommandList, pIsImmediate);
 
         // capture parameters
@@ -1792,13 +2574,27 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnIsImmediate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.ppIsImmediate);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendBarrier
+    template <>
+    struct APIRecordArgs<ze_command_list_append_barrier_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_barrier_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendBarrier
     __zedlllocal ze_result_t ZE_APICALL
@@ -1816,6 +2612,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendBarrier)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendBarrierCb, context.zeDdiTable.CommandList.pfnAppendBarrier, hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendBarrierCb, context.zeDdiTable.CommandList.pfnAppendBarrier, hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendBarrier, hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -1833,15 +2633,30 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendBarrier,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendMemoryRangesBarrier
+    template <>
+    struct APIRecordArgs<ze_command_list_append_memory_ranges_barrier_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_memory_ranges_barrier_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->pnumRanges);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendMemoryRangesBarrier
     __zedlllocal ze_result_t ZE_APICALL
@@ -1862,6 +2677,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryRangesBarrier)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendMemoryRangesBarrierCb, context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier, hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendMemoryRangesBarrierCb, context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier, hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier, hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -1882,9 +2701,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumRanges,
                                                   *tracerParams.ppRangeSizes,
@@ -1894,6 +2711,20 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeContextSystemBarrier
+    template <>
+    struct APIRecordArgs<ze_context_system_barrier_params_t>
+    {
+        static uint32_t get(const ze_context_system_barrier_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeContextSystemBarrier
     __zedlllocal ze_result_t ZE_APICALL
@@ -1907,6 +2738,10 @@ namespace tracing_layer
         if( nullptr == pfnSystemBarrier)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Context, pfnSystemBarrierCb, context.zeDdiTable.Context.pfnSystemBarrier, hContext, hDevice);
+
+        ZE_HANDLE_UNSAMPLED_API(Context, pfnSystemBarrierCb, context.zeDdiTable.Context.pfnSystemBarrier, hContext, hDevice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnSystemBarrier, hContext, hDevice);
 
         // capture parameters
@@ -1922,13 +2757,28 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnSystemBarrier,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendMemoryCopy
+    template <>
+    struct APIRecordArgs<ze_command_list_append_memory_copy_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_memory_copy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->psize);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendMemoryCopy
     __zedlllocal ze_result_t ZE_APICALL
@@ -1949,6 +2799,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryCopy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendMemoryCopyCb, context.zeDdiTable.CommandList.pfnAppendMemoryCopy, hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendMemoryCopyCb, context.zeDdiTable.CommandList.pfnAppendMemoryCopy, hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryCopy, hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -1969,9 +2823,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryCopy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.psrcptr,
@@ -1981,6 +2833,24 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendMemoryFill
+    template <>
+    struct APIRecordArgs<ze_command_list_append_memory_fill_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_memory_fill_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->ppattern_size);
+            args[count++] = recordArg(*params->psize);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendMemoryFill
     __zedlllocal ze_result_t ZE_APICALL
@@ -2002,6 +2872,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryFill)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendMemoryFillCb, context.zeDdiTable.CommandList.pfnAppendMemoryFill, hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendMemoryFillCb, context.zeDdiTable.CommandList.pfnAppendMemoryFill, hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryFill, hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2023,9 +2897,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryFill,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppattern,
@@ -2036,6 +2908,26 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendMemoryCopyRegion
+    template <>
+    struct APIRecordArgs<ze_command_list_append_memory_copy_region_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_memory_copy_region_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->pdstPitch);
+            args[count++] = recordArg(*params->pdstSlicePitch);
+            args[count++] = recordArg(*params->psrcPitch);
+            args[count++] = recordArg(*params->psrcSlicePitch);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendMemoryCopyRegion
     __zedlllocal ze_result_t ZE_APICALL
@@ -2065,6 +2957,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryCopyRegion)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendMemoryCopyRegionCb, context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion, hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendMemoryCopyRegionCb, context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion, hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion, hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2090,9 +2986,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.pdstRegion,
@@ -2107,6 +3001,24 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendMemoryCopyFromContext
+    template <>
+    struct APIRecordArgs<ze_command_list_append_memory_copy_from_context_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_memory_copy_from_context_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phContextSrc);
+            args[count++] = recordArg(*params->psize);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendMemoryCopyFromContext
     __zedlllocal ze_result_t ZE_APICALL
@@ -2128,6 +3040,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryCopyFromContext)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendMemoryCopyFromContextCb, context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext, hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendMemoryCopyFromContextCb, context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext, hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext, hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2149,9 +3065,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.phContextSrc,
@@ -2162,6 +3076,24 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendImageCopy
+    template <>
+    struct APIRecordArgs<ze_command_list_append_image_copy_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_image_copy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phDstImage);
+            args[count++] = recordArg(*params->phSrcImage);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendImageCopy
     __zedlllocal ze_result_t ZE_APICALL
@@ -2181,6 +3113,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendImageCopyCb, context.zeDdiTable.CommandList.pfnAppendImageCopy, hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendImageCopyCb, context.zeDdiTable.CommandList.pfnAppendImageCopy, hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopy, hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2200,9 +3136,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDstImage,
                                                   *tracerParams.phSrcImage,
@@ -2211,6 +3145,24 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendImageCopyRegion
+    template <>
+    struct APIRecordArgs<ze_command_list_append_image_copy_region_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_image_copy_region_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phDstImage);
+            args[count++] = recordArg(*params->phSrcImage);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendImageCopyRegion
     __zedlllocal ze_result_t ZE_APICALL
@@ -2232,6 +3184,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyRegion)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendImageCopyRegionCb, context.zeDdiTable.CommandList.pfnAppendImageCopyRegion, hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendImageCopyRegionCb, context.zeDdiTable.CommandList.pfnAppendImageCopyRegion, hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyRegion, hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2253,9 +3209,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyRegion,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDstImage,
                                                   *tracerParams.phSrcImage,
@@ -2266,6 +3220,23 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendImageCopyToMemory
+    template <>
+    struct APIRecordArgs<ze_command_list_append_image_copy_to_memory_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_image_copy_to_memory_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phSrcImage);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendImageCopyToMemory
     __zedlllocal ze_result_t ZE_APICALL
@@ -2286,6 +3257,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyToMemory)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendImageCopyToMemoryCb, context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory, hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendImageCopyToMemoryCb, context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory, hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory, hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2306,9 +3281,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.phSrcImage,
@@ -2318,6 +3291,23 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendImageCopyFromMemory
+    template <>
+    struct APIRecordArgs<ze_command_list_append_image_copy_from_memory_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_image_copy_from_memory_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phDstImage);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendImageCopyFromMemory
     __zedlllocal ze_result_t ZE_APICALL
@@ -2338,6 +3328,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyFromMemory)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendImageCopyFromMemoryCb, context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory, hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendImageCopyFromMemoryCb, context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory, hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory, hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2358,9 +3352,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDstImage,
                                                   *tracerParams.psrcptr,
@@ -2370,6 +3362,20 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendMemoryPrefetch
+    template <>
+    struct APIRecordArgs<ze_command_list_append_memory_prefetch_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_memory_prefetch_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendMemoryPrefetch
     __zedlllocal ze_result_t ZE_APICALL
@@ -2384,6 +3390,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryPrefetch)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendMemoryPrefetchCb, context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch, hCommandList, ptr, size);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendMemoryPrefetchCb, context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch, hCommandList, ptr, size);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch, hCommandList, ptr, size);
 
         // capture parameters
@@ -2400,14 +3410,27 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendMemAdvise
+    template <>
+    struct APIRecordArgs<ze_command_list_append_mem_advise_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_mem_advise_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendMemAdvise
     __zedlllocal ze_result_t ZE_APICALL
@@ -2424,6 +3447,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemAdvise)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendMemAdviseCb, context.zeDdiTable.CommandList.pfnAppendMemAdvise, hCommandList, hDevice, ptr, size, advice);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendMemAdviseCb, context.zeDdiTable.CommandList.pfnAppendMemAdvise, hCommandList, hDevice, ptr, size, advice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemAdvise, hCommandList, hDevice, ptr, size, advice);
 
         // capture parameters
@@ -2442,9 +3469,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemAdvise,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
@@ -2452,6 +3477,28 @@ namespace tracing_layer
                                                   *tracerParams.padvice);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventPoolCreate
+    template <>
+    struct APIRecordArgs<ze_event_pool_create_params_t>
+    {
+        static uint32_t get(const ze_event_pool_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->pnumDevices);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeEventPoolCreate
+    template <>
+    struct AsyncEpilogueOutArgs<ze_event_pool_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 4);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventPoolCreate
     __zedlllocal ze_result_t ZE_APICALL
@@ -2472,6 +3519,10 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(EventPool, pfnCreateCb, context.zeDdiTable.EventPool.pfnCreate, hContext, desc, numDevices, phDevices, phEventPool);
+
+        ZE_HANDLE_UNSAMPLED_API(EventPool, pfnCreateCb, context.zeDdiTable.EventPool.pfnCreate, hContext, desc, numDevices, phDevices, phEventPool);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnCreate, hContext, desc, numDevices, phDevices, phEventPool);
 
         // capture parameters
@@ -2490,9 +3541,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pnumDevices,
@@ -2500,6 +3549,19 @@ namespace tracing_layer
                                                   *tracerParams.pphEventPool);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventPoolDestroy
+    template <>
+    struct APIRecordArgs<ze_event_pool_destroy_params_t>
+    {
+        static uint32_t get(const ze_event_pool_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEventPool);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventPoolDestroy
     __zedlllocal ze_result_t ZE_APICALL
@@ -2512,6 +3574,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(EventPool, pfnDestroyCb, context.zeDdiTable.EventPool.pfnDestroy, hEventPool);
+
+        ZE_HANDLE_UNSAMPLED_API(EventPool, pfnDestroyCb, context.zeDdiTable.EventPool.pfnDestroy, hEventPool);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnDestroy, hEventPool);
 
         // capture parameters
@@ -2526,12 +3592,31 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventCreate
+    template <>
+    struct APIRecordArgs<ze_event_create_params_t>
+    {
+        static uint32_t get(const ze_event_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEventPool);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeEventCreate
+    template <>
+    struct AsyncEpilogueOutArgs<ze_event_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 2);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventCreate
     __zedlllocal ze_result_t ZE_APICALL
@@ -2546,6 +3631,10 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Event, pfnCreateCb, context.zeDdiTable.Event.pfnCreate, hEventPool, desc, phEvent);
+
+        ZE_HANDLE_UNSAMPLED_API(Event, pfnCreateCb, context.zeDdiTable.Event.pfnCreate, hEventPool, desc, phEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnCreate, hEventPool, desc, phEvent);
 
         // capture parameters
@@ -2562,14 +3651,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphEvent);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventDestroy
+    template <>
+    struct APIRecordArgs<ze_event_destroy_params_t>
+    {
+        static uint32_t get(const ze_event_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEvent);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventDestroy
     __zedlllocal ze_result_t ZE_APICALL
@@ -2582,6 +3682,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Event, pfnDestroyCb, context.zeDdiTable.Event.pfnDestroy, hEvent);
+
+        ZE_HANDLE_UNSAMPLED_API(Event, pfnDestroyCb, context.zeDdiTable.Event.pfnDestroy, hEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnDestroy, hEvent);
 
         // capture parameters
@@ -2596,12 +3700,23 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventPoolGetIpcHandle
+    template <>
+    struct APIRecordArgs<ze_event_pool_get_ipc_handle_params_t>
+    {
+        static uint32_t get(const ze_event_pool_get_ipc_handle_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEventPool);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventPoolGetIpcHandle
     __zedlllocal ze_result_t ZE_APICALL
@@ -2615,6 +3730,10 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(EventPool, pfnGetIpcHandleCb, context.zeDdiTable.EventPool.pfnGetIpcHandle, hEventPool, phIpc);
+
+        ZE_HANDLE_UNSAMPLED_API(EventPool, pfnGetIpcHandleCb, context.zeDdiTable.EventPool.pfnGetIpcHandle, hEventPool, phIpc);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnGetIpcHandle, hEventPool, phIpc);
 
         // capture parameters
@@ -2630,13 +3749,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnGetIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool,
                                                   *tracerParams.pphIpc);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventPoolPutIpcHandle
+    template <>
+    struct APIRecordArgs<ze_event_pool_put_ipc_handle_params_t>
+    {
+        static uint32_t get(const ze_event_pool_put_ipc_handle_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventPoolPutIpcHandle
     __zedlllocal ze_result_t ZE_APICALL
@@ -2651,6 +3781,10 @@ namespace tracing_layer
         if( nullptr == pfnPutIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(EventPool, pfnPutIpcHandleCb, context.zeDdiTable.EventPool.pfnPutIpcHandle, hContext, hIpc);
+
+        ZE_HANDLE_UNSAMPLED_API(EventPool, pfnPutIpcHandleCb, context.zeDdiTable.EventPool.pfnPutIpcHandle, hContext, hIpc);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnPutIpcHandle, hContext, hIpc);
 
         // capture parameters
@@ -2666,13 +3800,32 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnPutIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phIpc);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventPoolOpenIpcHandle
+    template <>
+    struct APIRecordArgs<ze_event_pool_open_ipc_handle_params_t>
+    {
+        static uint32_t get(const ze_event_pool_open_ipc_handle_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeEventPoolOpenIpcHandle
+    template <>
+    struct AsyncEpilogueOutArgs<ze_event_pool_open_ipc_handle_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 2);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventPoolOpenIpcHandle
     __zedlllocal ze_result_t ZE_APICALL
@@ -2688,6 +3841,10 @@ namespace tracing_layer
         if( nullptr == pfnOpenIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(EventPool, pfnOpenIpcHandleCb, context.zeDdiTable.EventPool.pfnOpenIpcHandle, hContext, hIpc, phEventPool);
+
+        ZE_HANDLE_UNSAMPLED_API(EventPool, pfnOpenIpcHandleCb, context.zeDdiTable.EventPool.pfnOpenIpcHandle, hContext, hIpc, phEventPool);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnOpenIpcHandle, hContext, hIpc, phEventPool);
 
         // capture parameters
@@ -2704,14 +3861,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnOpenIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phIpc,
                                                   *tracerParams.pphEventPool);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventPoolCloseIpcHandle
+    template <>
+    struct APIRecordArgs<ze_event_pool_close_ipc_handle_params_t>
+    {
+        static uint32_t get(const ze_event_pool_close_ipc_handle_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEventPool);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventPoolCloseIpcHandle
     __zedlllocal ze_result_t ZE_APICALL
@@ -2724,6 +3892,10 @@ namespace tracing_layer
         if( nullptr == pfnCloseIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(EventPool, pfnCloseIpcHandleCb, context.zeDdiTable.EventPool.pfnCloseIpcHandle, hEventPool);
+
+        ZE_HANDLE_UNSAMPLED_API(EventPool, pfnCloseIpcHandleCb, context.zeDdiTable.EventPool.pfnCloseIpcHandle, hEventPool);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnCloseIpcHandle, hEventPool);
 
         // capture parameters
@@ -2738,12 +3910,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnCloseIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendSignalEvent
+    template <>
+    struct APIRecordArgs<ze_command_list_append_signal_event_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_signal_event_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phEvent);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendSignalEvent
     __zedlllocal ze_result_t ZE_APICALL
@@ -2757,6 +3941,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendSignalEvent)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendSignalEventCb, context.zeDdiTable.CommandList.pfnAppendSignalEvent, hCommandList, hEvent);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendSignalEventCb, context.zeDdiTable.CommandList.pfnAppendSignalEvent, hCommandList, hEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendSignalEvent, hCommandList, hEvent);
 
         // capture parameters
@@ -2772,13 +3960,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendSignalEvent,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phEvent);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendWaitOnEvents
+    template <>
+    struct APIRecordArgs<ze_command_list_append_wait_on_events_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_wait_on_events_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->pnumEvents);
+            count = recordArgArray(*params->pnumEvents, *params->pphEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendWaitOnEvents
     __zedlllocal ze_result_t ZE_APICALL
@@ -2794,6 +3995,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendWaitOnEvents)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendWaitOnEventsCb, context.zeDdiTable.CommandList.pfnAppendWaitOnEvents, hCommandList, numEvents, phEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendWaitOnEventsCb, context.zeDdiTable.CommandList.pfnAppendWaitOnEvents, hCommandList, numEvents, phEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendWaitOnEvents, hCommandList, numEvents, phEvents);
 
         // capture parameters
@@ -2810,14 +4015,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendWaitOnEvents,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumEvents,
                                                   *tracerParams.pphEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventHostSignal
+    template <>
+    struct APIRecordArgs<ze_event_host_signal_params_t>
+    {
+        static uint32_t get(const ze_event_host_signal_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEvent);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventHostSignal
     __zedlllocal ze_result_t ZE_APICALL
@@ -2830,6 +4046,10 @@ namespace tracing_layer
         if( nullptr == pfnHostSignal)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Event, pfnHostSignalCb, context.zeDdiTable.Event.pfnHostSignal, hEvent);
+
+        ZE_HANDLE_UNSAMPLED_API(Event, pfnHostSignalCb, context.zeDdiTable.Event.pfnHostSignal, hEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnHostSignal, hEvent);
 
         // capture parameters
@@ -2844,12 +4064,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnHostSignal,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventHostSynchronize
+    template <>
+    struct APIRecordArgs<ze_event_host_synchronize_params_t>
+    {
+        static uint32_t get(const ze_event_host_synchronize_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEvent);
+            args[count++] = recordArg(*params->ptimeout);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventHostSynchronize
     __zedlllocal ze_result_t ZE_APICALL
@@ -2869,6 +4101,10 @@ namespace tracing_layer
         if( nullptr == pfnHostSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Event, pfnHostSynchronizeCb, context.zeDdiTable.Event.pfnHostSynchronize, hEvent, timeout);
+
+        ZE_HANDLE_UNSAMPLED_API(Event, pfnHostSynchronizeCb, context.zeDdiTable.Event.pfnHostSynchronize, hEvent, timeout);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnHostSynchronize, hEvent, timeout);
 
         // capture parameters
@@ -2884,13 +4120,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnHostSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.ptimeout);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventQueryStatus
+    template <>
+    struct APIRecordArgs<ze_event_query_status_params_t>
+    {
+        static uint32_t get(const ze_event_query_status_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEvent);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventQueryStatus
     __zedlllocal ze_result_t ZE_APICALL
@@ -2903,6 +4150,10 @@ namespace tracing_layer
         if( nullptr == pfnQueryStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Event, pfnQueryStatusCb, context.zeDdiTable.Event.pfnQueryStatus, hEvent);
+
+        ZE_HANDLE_UNSAMPLED_API(Event, pfnQueryStatusCb, context.zeDdiTable.Event.pfnQueryStatus, hEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnQueryStatus, hEvent);
 
         // capture parameters
@@ -2917,12 +4168,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnQueryStatus,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendEventReset
+    template <>
+    struct APIRecordArgs<ze_command_list_append_event_reset_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_event_reset_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phEvent);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendEventReset
     __zedlllocal ze_result_t ZE_APICALL
@@ -2936,6 +4199,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendEventReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendEventResetCb, context.zeDdiTable.CommandList.pfnAppendEventReset, hCommandList, hEvent);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendEventResetCb, context.zeDdiTable.CommandList.pfnAppendEventReset, hCommandList, hEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendEventReset, hCommandList, hEvent);
 
         // capture parameters
@@ -2951,13 +4218,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendEventReset,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phEvent);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventHostReset
+    template <>
+    struct APIRecordArgs<ze_event_host_reset_params_t>
+    {
+        static uint32_t get(const ze_event_host_reset_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEvent);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventHostReset
     __zedlllocal ze_result_t ZE_APICALL
@@ -2970,6 +4248,10 @@ namespace tracing_layer
         if( nullptr == pfnHostReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Event, pfnHostResetCb, context.zeDdiTable.Event.pfnHostReset, hEvent);
+
+        ZE_HANDLE_UNSAMPLED_API(Event, pfnHostResetCb, context.zeDdiTable.Event.pfnHostReset, hEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnHostReset, hEvent);
 
         // capture parameters
@@ -2984,12 +4266,23 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnHostReset,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventQueryKernelTimestamp
+    template <>
+    struct APIRecordArgs<ze_event_query_kernel_timestamp_params_t>
+    {
+        static uint32_t get(const ze_event_query_kernel_timestamp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEvent);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventQueryKernelTimestamp
     __zedlllocal ze_result_t ZE_APICALL
@@ -3003,6 +4296,10 @@ namespace tracing_layer
         if( nullptr == pfnQueryKernelTimestamp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Event, pfnQueryKernelTimestampCb, context.zeDdiTable.Event.pfnQueryKernelTimestamp, hEvent, dstptr);
+
+        ZE_HANDLE_UNSAMPLED_API(Event, pfnQueryKernelTimestampCb, context.zeDdiTable.Event.pfnQueryKernelTimestamp, hEvent, dstptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnQueryKernelTimestamp, hEvent, dstptr);
 
         // capture parameters
@@ -3018,13 +4315,28 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnQueryKernelTimestamp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.pdstptr);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendQueryKernelTimestamps
+    template <>
+    struct APIRecordArgs<ze_command_list_append_query_kernel_timestamps_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_query_kernel_timestamps_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->pnumEvents);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendQueryKernelTimestamps
     __zedlllocal ze_result_t ZE_APICALL
@@ -3049,6 +4361,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendQueryKernelTimestamps)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendQueryKernelTimestampsCb, context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps, hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendQueryKernelTimestampsCb, context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps, hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps, hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -3070,9 +4386,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumEvents,
                                                   *tracerParams.pphEvents,
@@ -3083,6 +4397,27 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventGetEventPool
+    template <>
+    struct APIRecordArgs<ze_event_get_event_pool_params_t>
+    {
+        static uint32_t get(const ze_event_get_event_pool_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEvent);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeEventGetEventPool
+    template <>
+    struct AsyncEpilogueOutArgs<ze_event_get_event_pool_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 1);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventGetEventPool
     __zedlllocal ze_result_t ZE_APICALL
@@ -3096,6 +4431,10 @@ namespace tracing_layer
         if( nullptr == pfnGetEventPool)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Event, pfnGetEventPoolCb, context.zeDdiTable.Event.pfnGetEventPool, hEvent, phEventPool);
+
+        ZE_HANDLE_UNSAMPLED_API(Event, pfnGetEventPoolCb, context.zeDdiTable.Event.pfnGetEventPool, hEvent, phEventPool);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnGetEventPool, hEvent, phEventPool);
 
         // capture parameters
@@ -3111,13 +4450,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnGetEventPool,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.pphEventPool);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventGetSignalScope
+    template <>
+    struct APIRecordArgs<ze_event_get_signal_scope_params_t>
+    {
+        static uint32_t get(const ze_event_get_signal_scope_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEvent);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventGetSignalScope
     __zedlllocal ze_result_t ZE_APICALL
@@ -3133,6 +4483,10 @@ namespace tracing_layer
         if( nullptr == pfnGetSignalScope)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Event, pfnGetSignalScopeCb, context.zeDdiTable.Event.pfnGetSignalScope, hEvent, pSignalScope);
+
+        ZE_HANDLE_UNSAMPLED_API(Event, pfnGetSignalScopeCb, context.zeDdiTable.Event.pfnGetSignalScope, hEvent, pSignalScope);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnGetSignalScope, hEvent, pSignalScope);
 
         // capture parameters
@@ -3148,13 +4502,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnGetSignalScope,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.ppSignalScope);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventGetWaitScope
+    template <>
+    struct APIRecordArgs<ze_event_get_wait_scope_params_t>
+    {
+        static uint32_t get(const ze_event_get_wait_scope_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEvent);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventGetWaitScope
     __zedlllocal ze_result_t ZE_APICALL
@@ -3170,6 +4535,10 @@ namespace tracing_layer
         if( nullptr == pfnGetWaitScope)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Event, pfnGetWaitScopeCb, context.zeDdiTable.Event.pfnGetWaitScope, hEvent, pWaitScope);
+
+        ZE_HANDLE_UNSAMPLED_API(Event, pfnGetWaitScopeCb, context.zeDdiTable.Event.pfnGetWaitScope, hEvent, pWaitScope);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnGetWaitScope, hEvent, pWaitScope);
 
         // capture parameters
@@ -3185,13 +4554,32 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnGetWaitScope,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.ppWaitScope);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventPoolGetContextHandle
+    template <>
+    struct APIRecordArgs<ze_event_pool_get_context_handle_params_t>
+    {
+        static uint32_t get(const ze_event_pool_get_context_handle_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEventPool);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeEventPoolGetContextHandle
+    template <>
+    struct AsyncEpilogueOutArgs<ze_event_pool_get_context_handle_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 1);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventPoolGetContextHandle
     __zedlllocal ze_result_t ZE_APICALL
@@ -3205,6 +4593,10 @@ namespace tracing_layer
         if( nullptr == pfnGetContextHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(EventPool, pfnGetContextHandleCb, context.zeDdiTable.EventPool.pfnGetContextHandle, hEventPool, phContext);
+
+        ZE_HANDLE_UNSAMPLED_API(EventPool, pfnGetContextHandleCb, context.zeDdiTable.EventPool.pfnGetContextHandle, hEventPool, phContext);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnGetContextHandle, hEventPool, phContext);
 
         // capture parameters
@@ -3220,13 +4612,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnGetContextHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool,
                                                   *tracerParams.pphContext);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventPoolGetFlags
+    template <>
+    struct APIRecordArgs<ze_event_pool_get_flags_params_t>
+    {
+        static uint32_t get(const ze_event_pool_get_flags_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEventPool);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventPoolGetFlags
     __zedlllocal ze_result_t ZE_APICALL
@@ -3241,6 +4644,10 @@ namespace tracing_layer
         if( nullptr == pfnGetFlags)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(EventPool, pfnGetFlagsCb, context.zeDdiTable.EventPool.pfnGetFlags, hEventPool, pFlags);
+
+        ZE_HANDLE_UNSAMPLED_API(EventPool, pfnGetFlagsCb, context.zeDdiTable.EventPool.pfnGetFlags, hEventPool, pFlags);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnGetFlags, hEventPool, pFlags);
 
         // capture parameters
@@ -3256,13 +4663,32 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnGetFlags,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool,
                                                   *tracerParams.ppFlags);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeFenceCreate
+    template <>
+    struct APIRecordArgs<ze_fence_create_params_t>
+    {
+        static uint32_t get(const ze_fence_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandQueue);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeFenceCreate
+    template <>
+    struct AsyncEpilogueOutArgs<ze_fence_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 2);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeFenceCreate
     __zedlllocal ze_result_t ZE_APICALL
@@ -3277,6 +4703,10 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Fence, pfnCreateCb, context.zeDdiTable.Fence.pfnCreate, hCommandQueue, desc, phFence);
+
+        ZE_HANDLE_UNSAMPLED_API(Fence, pfnCreateCb, context.zeDdiTable.Fence.pfnCreate, hCommandQueue, desc, phFence);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnCreate, hCommandQueue, desc, phFence);
 
         // capture parameters
@@ -3293,14 +4723,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphFence);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeFenceDestroy
+    template <>
+    struct APIRecordArgs<ze_fence_destroy_params_t>
+    {
+        static uint32_t get(const ze_fence_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFence);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeFenceDestroy
     __zedlllocal ze_result_t ZE_APICALL
@@ -3313,6 +4754,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Fence, pfnDestroyCb, context.zeDdiTable.Fence.pfnDestroy, hFence);
+
+        ZE_HANDLE_UNSAMPLED_API(Fence, pfnDestroyCb, context.zeDdiTable.Fence.pfnDestroy, hFence);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnDestroy, hFence);
 
         // capture parameters
@@ -3327,12 +4772,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phFence);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeFenceHostSynchronize
+    template <>
+    struct APIRecordArgs<ze_fence_host_synchronize_params_t>
+    {
+        static uint32_t get(const ze_fence_host_synchronize_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFence);
+            args[count++] = recordArg(*params->ptimeout);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeFenceHostSynchronize
     __zedlllocal ze_result_t ZE_APICALL
@@ -3352,6 +4809,10 @@ namespace tracing_layer
         if( nullptr == pfnHostSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Fence, pfnHostSynchronizeCb, context.zeDdiTable.Fence.pfnHostSynchronize, hFence, timeout);
+
+        ZE_HANDLE_UNSAMPLED_API(Fence, pfnHostSynchronizeCb, context.zeDdiTable.Fence.pfnHostSynchronize, hFence, timeout);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnHostSynchronize, hFence, timeout);
 
         // capture parameters
@@ -3367,13 +4828,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnHostSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phFence,
                                                   *tracerParams.ptimeout);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeFenceQueryStatus
+    template <>
+    struct APIRecordArgs<ze_fence_query_status_params_t>
+    {
+        static uint32_t get(const ze_fence_query_status_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFence);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeFenceQueryStatus
     __zedlllocal ze_result_t ZE_APICALL
@@ -3386,6 +4858,10 @@ namespace tracing_layer
         if( nullptr == pfnQueryStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Fence, pfnQueryStatusCb, context.zeDdiTable.Fence.pfnQueryStatus, hFence);
+
+        ZE_HANDLE_UNSAMPLED_API(Fence, pfnQueryStatusCb, context.zeDdiTable.Fence.pfnQueryStatus, hFence);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnQueryStatus, hFence);
 
         // capture parameters
@@ -3400,12 +4876,23 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnQueryStatus,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phFence);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeFenceReset
+    template <>
+    struct APIRecordArgs<ze_fence_reset_params_t>
+    {
+        static uint32_t get(const ze_fence_reset_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFence);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeFenceReset
     __zedlllocal ze_result_t ZE_APICALL
@@ -3418,6 +4905,10 @@ namespace tracing_layer
         if( nullptr == pfnReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Fence, pfnResetCb, context.zeDdiTable.Fence.pfnReset, hFence);
+
+        ZE_HANDLE_UNSAMPLED_API(Fence, pfnResetCb, context.zeDdiTable.Fence.pfnReset, hFence);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnReset, hFence);
 
         // capture parameters
@@ -3432,12 +4923,23 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnReset,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phFence);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeImageGetProperties
+    template <>
+    struct APIRecordArgs<ze_image_get_properties_params_t>
+    {
+        static uint32_t get(const ze_image_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeImageGetProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -3452,6 +4954,10 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Image, pfnGetPropertiesCb, context.zeDdiTable.Image.pfnGetProperties, hDevice, desc, pImageProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Image, pfnGetPropertiesCb, context.zeDdiTable.Image.pfnGetProperties, hDevice, desc, pImageProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnGetProperties, hDevice, desc, pImageProperties);
 
         // capture parameters
@@ -3468,14 +4974,34 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.ppImageProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeImageCreate
+    template <>
+    struct APIRecordArgs<ze_image_create_params_t>
+    {
+        static uint32_t get(const ze_image_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeImageCreate
+    template <>
+    struct AsyncEpilogueOutArgs<ze_image_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 3);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeImageCreate
     __zedlllocal ze_result_t ZE_APICALL
@@ -3491,6 +5017,10 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Image, pfnCreateCb, context.zeDdiTable.Image.pfnCreate, hContext, hDevice, desc, phImage);
+
+        ZE_HANDLE_UNSAMPLED_API(Image, pfnCreateCb, context.zeDdiTable.Image.pfnCreate, hContext, hDevice, desc, phImage);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnCreate, hContext, hDevice, desc, phImage);
 
         // capture parameters
@@ -3508,15 +5038,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphImage);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeImageDestroy
+    template <>
+    struct APIRecordArgs<ze_image_destroy_params_t>
+    {
+        static uint32_t get(const ze_image_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phImage);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeImageDestroy
     __zedlllocal ze_result_t ZE_APICALL
@@ -3529,6 +5070,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Image, pfnDestroyCb, context.zeDdiTable.Image.pfnDestroy, hImage);
+
+        ZE_HANDLE_UNSAMPLED_API(Image, pfnDestroyCb, context.zeDdiTable.Image.pfnDestroy, hImage);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnDestroy, hImage);
 
         // capture parameters
@@ -3543,12 +5088,34 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phImage);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemAllocShared
+    template <>
+    struct APIRecordArgs<ze_mem_alloc_shared_params_t>
+    {
+        static uint32_t get(const ze_mem_alloc_shared_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->psize);
+            args[count++] = recordArg(*params->palignment);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeMemAllocShared
+    template <>
+    struct AsyncEpilogueOutArgs<ze_mem_alloc_shared_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 6);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemAllocShared
     __zedlllocal ze_result_t ZE_APICALL
@@ -3569,6 +5136,10 @@ namespace tracing_layer
         if( nullptr == pfnAllocShared)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnAllocSharedCb, context.zeDdiTable.Mem.pfnAllocShared, hContext, device_desc, host_desc, size, alignment, hDevice, pptr);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnAllocSharedCb, context.zeDdiTable.Mem.pfnAllocShared, hContext, device_desc, host_desc, size, alignment, hDevice, pptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnAllocShared, hContext, device_desc, host_desc, size, alignment, hDevice, pptr);
 
         // capture parameters
@@ -3589,9 +5160,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnAllocShared,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pdevice_desc,
                                                   *tracerParams.phost_desc,
@@ -3601,6 +5170,30 @@ namespace tracing_layer
                                                   *tracerParams.ppptr);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemAllocDevice
+    template <>
+    struct APIRecordArgs<ze_mem_alloc_device_params_t>
+    {
+        static uint32_t get(const ze_mem_alloc_device_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->psize);
+            args[count++] = recordArg(*params->palignment);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeMemAllocDevice
+    template <>
+    struct AsyncEpilogueOutArgs<ze_mem_alloc_device_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 5);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemAllocDevice
     __zedlllocal ze_result_t ZE_APICALL
@@ -3620,6 +5213,10 @@ namespace tracing_layer
         if( nullptr == pfnAllocDevice)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnAllocDeviceCb, context.zeDdiTable.Mem.pfnAllocDevice, hContext, device_desc, size, alignment, hDevice, pptr);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnAllocDeviceCb, context.zeDdiTable.Mem.pfnAllocDevice, hContext, device_desc, size, alignment, hDevice, pptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnAllocDevice, hContext, device_desc, size, alignment, hDevice, pptr);
 
         // capture parameters
@@ -3639,9 +5236,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnAllocDevice,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pdevice_desc,
                                                   *tracerParams.psize,
@@ -3650,6 +5245,29 @@ namespace tracing_layer
                                                   *tracerParams.ppptr);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemAllocHost
+    template <>
+    struct APIRecordArgs<ze_mem_alloc_host_params_t>
+    {
+        static uint32_t get(const ze_mem_alloc_host_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->psize);
+            args[count++] = recordArg(*params->palignment);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeMemAllocHost
+    template <>
+    struct AsyncEpilogueOutArgs<ze_mem_alloc_host_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 4);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemAllocHost
     __zedlllocal ze_result_t ZE_APICALL
@@ -3668,6 +5286,10 @@ namespace tracing_layer
         if( nullptr == pfnAllocHost)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnAllocHostCb, context.zeDdiTable.Mem.pfnAllocHost, hContext, host_desc, size, alignment, pptr);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnAllocHostCb, context.zeDdiTable.Mem.pfnAllocHost, hContext, host_desc, size, alignment, pptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnAllocHost, hContext, host_desc, size, alignment, pptr);
 
         // capture parameters
@@ -3686,9 +5308,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnAllocHost,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phost_desc,
                                                   *tracerParams.psize,
@@ -3696,6 +5316,19 @@ namespace tracing_layer
                                                   *tracerParams.ppptr);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemFree
+    template <>
+    struct APIRecordArgs<ze_mem_free_params_t>
+    {
+        static uint32_t get(const ze_mem_free_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemFree
     __zedlllocal ze_result_t ZE_APICALL
@@ -3709,6 +5342,10 @@ namespace tracing_layer
         if( nullptr == pfnFree)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnFreeCb, context.zeDdiTable.Mem.pfnFree, hContext, ptr);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnFreeCb, context.zeDdiTable.Mem.pfnFree, hContext, ptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnFree, hContext, ptr);
 
         // capture parameters
@@ -3724,13 +5361,32 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnFree,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemGetAllocProperties
+    template <>
+    struct APIRecordArgs<ze_mem_get_alloc_properties_params_t>
+    {
+        static uint32_t get(const ze_mem_get_alloc_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeMemGetAllocProperties
+    template <>
+    struct AsyncEpilogueOutArgs<ze_mem_get_alloc_properties_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 3);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemGetAllocProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -3746,6 +5402,10 @@ namespace tracing_layer
         if( nullptr == pfnGetAllocProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnGetAllocPropertiesCb, context.zeDdiTable.Mem.pfnGetAllocProperties, hContext, ptr, pMemAllocProperties, phDevice);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnGetAllocPropertiesCb, context.zeDdiTable.Mem.pfnGetAllocProperties, hContext, ptr, pMemAllocProperties, phDevice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetAllocProperties, hContext, ptr, pMemAllocProperties, phDevice);
 
         // capture parameters
@@ -3763,15 +5423,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnGetAllocProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppMemAllocProperties,
                                                   *tracerParams.pphDevice);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemGetAddressRange
+    template <>
+    struct APIRecordArgs<ze_mem_get_address_range_params_t>
+    {
+        static uint32_t get(const ze_mem_get_address_range_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemGetAddressRange
     __zedlllocal ze_result_t ZE_APICALL
@@ -3787,6 +5458,10 @@ namespace tracing_layer
         if( nullptr == pfnGetAddressRange)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnGetAddressRangeCb, context.zeDdiTable.Mem.pfnGetAddressRange, hContext, ptr, pBase, pSize);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnGetAddressRangeCb, context.zeDdiTable.Mem.pfnGetAddressRange, hContext, ptr, pBase, pSize);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetAddressRange, hContext, ptr, pBase, pSize);
 
         // capture parameters
@@ -3804,15 +5479,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnGetAddressRange,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppBase,
                                                   *tracerParams.ppSize);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemGetIpcHandle
+    template <>
+    struct APIRecordArgs<ze_mem_get_ipc_handle_params_t>
+    {
+        static uint32_t get(const ze_mem_get_ipc_handle_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemGetIpcHandle
     __zedlllocal ze_result_t ZE_APICALL
@@ -3827,6 +5513,10 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnGetIpcHandleCb, context.zeDdiTable.Mem.pfnGetIpcHandle, hContext, ptr, pIpcHandle);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnGetIpcHandleCb, context.zeDdiTable.Mem.pfnGetIpcHandle, hContext, ptr, pIpcHandle);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetIpcHandle, hContext, ptr, pIpcHandle);
 
         // capture parameters
@@ -3843,14 +5533,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnGetIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppIpcHandle);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemGetIpcHandleFromFileDescriptorExp
+    template <>
+    struct APIRecordArgs<ze_mem_get_ipc_handle_from_file_descriptor_exp_params_t>
+    {
+        static uint32_t get(const ze_mem_get_ipc_handle_from_file_descriptor_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phandle);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemGetIpcHandleFromFileDescriptorExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -3865,6 +5567,10 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandleFromFileDescriptorExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnGetIpcHandleFromFileDescriptorExpCb, context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp, hContext, handle, pIpcHandle);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnGetIpcHandleFromFileDescriptorExpCb, context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp, hContext, handle, pIpcHandle);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp, hContext, handle, pIpcHandle);
 
         // capture parameters
@@ -3881,14 +5587,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phandle,
                                                   *tracerParams.ppIpcHandle);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemGetFileDescriptorFromIpcHandleExp
+    template <>
+    struct APIRecordArgs<ze_mem_get_file_descriptor_from_ipc_handle_exp_params_t>
+    {
+        static uint32_t get(const ze_mem_get_file_descriptor_from_ipc_handle_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemGetFileDescriptorFromIpcHandleExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -3903,6 +5620,10 @@ namespace tracing_layer
         if( nullptr == pfnGetFileDescriptorFromIpcHandleExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnGetFileDescriptorFromIpcHandleExpCb, context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp, hContext, ipcHandle, pHandle);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnGetFileDescriptorFromIpcHandleExpCb, context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp, hContext, ipcHandle, pHandle);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp, hContext, ipcHandle, pHandle);
 
         // capture parameters
@@ -3919,14 +5640,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pipcHandle,
                                                   *tracerParams.ppHandle);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemPutIpcHandle
+    template <>
+    struct APIRecordArgs<ze_mem_put_ipc_handle_params_t>
+    {
+        static uint32_t get(const ze_mem_put_ipc_handle_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemPutIpcHandle
     __zedlllocal ze_result_t ZE_APICALL
@@ -3940,6 +5672,10 @@ namespace tracing_layer
         if( nullptr == pfnPutIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnPutIpcHandleCb, context.zeDdiTable.Mem.pfnPutIpcHandle, hContext, handle);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnPutIpcHandleCb, context.zeDdiTable.Mem.pfnPutIpcHandle, hContext, handle);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnPutIpcHandle, hContext, handle);
 
         // capture parameters
@@ -3955,13 +5691,33 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnPutIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phandle);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemOpenIpcHandle
+    template <>
+    struct APIRecordArgs<ze_mem_open_ipc_handle_params_t>
+    {
+        static uint32_t get(const ze_mem_open_ipc_handle_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeMemOpenIpcHandle
+    template <>
+    struct AsyncEpilogueOutArgs<ze_mem_open_ipc_handle_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 4);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemOpenIpcHandle
     __zedlllocal ze_result_t ZE_APICALL
@@ -3979,6 +5735,10 @@ namespace tracing_layer
         if( nullptr == pfnOpenIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnOpenIpcHandleCb, context.zeDdiTable.Mem.pfnOpenIpcHandle, hContext, hDevice, handle, flags, pptr);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnOpenIpcHandleCb, context.zeDdiTable.Mem.pfnOpenIpcHandle, hContext, hDevice, handle, flags, pptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnOpenIpcHandle, hContext, hDevice, handle, flags, pptr);
 
         // capture parameters
@@ -3997,9 +5757,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnOpenIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phandle,
@@ -4007,6 +5765,19 @@ namespace tracing_layer
                                                   *tracerParams.ppptr);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemCloseIpcHandle
+    template <>
+    struct APIRecordArgs<ze_mem_close_ipc_handle_params_t>
+    {
+        static uint32_t get(const ze_mem_close_ipc_handle_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemCloseIpcHandle
     __zedlllocal ze_result_t ZE_APICALL
@@ -4020,6 +5791,10 @@ namespace tracing_layer
         if( nullptr == pfnCloseIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnCloseIpcHandleCb, context.zeDdiTable.Mem.pfnCloseIpcHandle, hContext, ptr);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnCloseIpcHandleCb, context.zeDdiTable.Mem.pfnCloseIpcHandle, hContext, ptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnCloseIpcHandle, hContext, ptr);
 
         // capture parameters
@@ -4035,13 +5810,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnCloseIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemSetAtomicAccessAttributeExp
+    template <>
+    struct APIRecordArgs<ze_mem_set_atomic_access_attribute_exp_params_t>
+    {
+        static uint32_t get(const ze_mem_set_atomic_access_attribute_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemSetAtomicAccessAttributeExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -4059,6 +5847,10 @@ namespace tracing_layer
         if( nullptr == pfnSetAtomicAccessAttributeExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnSetAtomicAccessAttributeExpCb, context.zeDdiTable.MemExp.pfnSetAtomicAccessAttributeExp, hContext, hDevice, ptr, size, attr);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnSetAtomicAccessAttributeExpCb, context.zeDdiTable.MemExp.pfnSetAtomicAccessAttributeExp, hContext, hDevice, ptr, size, attr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnSetAtomicAccessAttributeExp, hContext, hDevice, ptr, size, attr);
 
         // capture parameters
@@ -4077,9 +5869,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.MemExp.pfnSetAtomicAccessAttributeExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
@@ -4087,6 +5877,21 @@ namespace tracing_layer
                                                   *tracerParams.pattr);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemGetAtomicAccessAttributeExp
+    template <>
+    struct APIRecordArgs<ze_mem_get_atomic_access_attribute_exp_params_t>
+    {
+        static uint32_t get(const ze_mem_get_atomic_access_attribute_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemGetAtomicAccessAttributeExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -4103,6 +5908,10 @@ namespace tracing_layer
         if( nullptr == pfnGetAtomicAccessAttributeExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnGetAtomicAccessAttributeExpCb, context.zeDdiTable.MemExp.pfnGetAtomicAccessAttributeExp, hContext, hDevice, ptr, size, pAttr);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnGetAtomicAccessAttributeExpCb, context.zeDdiTable.MemExp.pfnGetAtomicAccessAttributeExp, hContext, hDevice, ptr, size, pAttr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnGetAtomicAccessAttributeExp, hContext, hDevice, ptr, size, pAttr);
 
         // capture parameters
@@ -4121,9 +5930,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.MemExp.pfnGetAtomicAccessAttributeExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
@@ -4131,6 +5938,28 @@ namespace tracing_layer
                                                   *tracerParams.ppAttr);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeModuleCreate
+    template <>
+    struct APIRecordArgs<ze_module_create_params_t>
+    {
+        static uint32_t get(const ze_module_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeModuleCreate
+    template <>
+    struct AsyncEpilogueOutArgs<ze_module_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 3) | (1u << 4);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeModuleCreate
     __zedlllocal ze_result_t ZE_APICALL
@@ -4147,6 +5976,10 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Module, pfnCreateCb, context.zeDdiTable.Module.pfnCreate, hContext, hDevice, desc, phModule, phBuildLog);
+
+        ZE_HANDLE_UNSAMPLED_API(Module, pfnCreateCb, context.zeDdiTable.Module.pfnCreate, hContext, hDevice, desc, phModule, phBuildLog);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnCreate, hContext, hDevice, desc, phModule, phBuildLog);
 
         // capture parameters
@@ -4165,9 +5998,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
@@ -4175,6 +6006,19 @@ namespace tracing_layer
                                                   *tracerParams.pphBuildLog);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeModuleDestroy
+    template <>
+    struct APIRecordArgs<ze_module_destroy_params_t>
+    {
+        static uint32_t get(const ze_module_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phModule);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeModuleDestroy
     __zedlllocal ze_result_t ZE_APICALL
@@ -4187,6 +6031,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Module, pfnDestroyCb, context.zeDdiTable.Module.pfnDestroy, hModule);
+
+        ZE_HANDLE_UNSAMPLED_API(Module, pfnDestroyCb, context.zeDdiTable.Module.pfnDestroy, hModule);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnDestroy, hModule);
 
         // capture parameters
@@ -4201,12 +6049,31 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeModuleDynamicLink
+    template <>
+    struct APIRecordArgs<ze_module_dynamic_link_params_t>
+    {
+        static uint32_t get(const ze_module_dynamic_link_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->pnumModules);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeModuleDynamicLink
+    template <>
+    struct AsyncEpilogueOutArgs<ze_module_dynamic_link_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 2);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeModuleDynamicLink
     __zedlllocal ze_result_t ZE_APICALL
@@ -4222,6 +6089,10 @@ namespace tracing_layer
         if( nullptr == pfnDynamicLink)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Module, pfnDynamicLinkCb, context.zeDdiTable.Module.pfnDynamicLink, numModules, phModules, phLinkLog);
+
+        ZE_HANDLE_UNSAMPLED_API(Module, pfnDynamicLinkCb, context.zeDdiTable.Module.pfnDynamicLink, numModules, phModules, phLinkLog);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnDynamicLink, numModules, phModules, phLinkLog);
 
         // capture parameters
@@ -4238,14 +6109,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnDynamicLink,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.pnumModules,
                                                   *tracerParams.pphModules,
                                                   *tracerParams.pphLinkLog);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeModuleBuildLogDestroy
+    template <>
+    struct APIRecordArgs<ze_module_build_log_destroy_params_t>
+    {
+        static uint32_t get(const ze_module_build_log_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phModuleBuildLog);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeModuleBuildLogDestroy
     __zedlllocal ze_result_t ZE_APICALL
@@ -4258,6 +6140,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(ModuleBuildLog, pfnDestroyCb, context.zeDdiTable.ModuleBuildLog.pfnDestroy, hModuleBuildLog);
+
+        ZE_HANDLE_UNSAMPLED_API(ModuleBuildLog, pfnDestroyCb, context.zeDdiTable.ModuleBuildLog.pfnDestroy, hModuleBuildLog);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ModuleBuildLog.pfnDestroy, hModuleBuildLog);
 
         // capture parameters
@@ -4272,12 +6158,23 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ModuleBuildLog.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModuleBuildLog);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeModuleBuildLogGetString
+    template <>
+    struct APIRecordArgs<ze_module_build_log_get_string_params_t>
+    {
+        static uint32_t get(const ze_module_build_log_get_string_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phModuleBuildLog);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeModuleBuildLogGetString
     __zedlllocal ze_result_t ZE_APICALL
@@ -4292,6 +6189,10 @@ namespace tracing_layer
         if( nullptr == pfnGetString)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(ModuleBuildLog, pfnGetStringCb, context.zeDdiTable.ModuleBuildLog.pfnGetString, hModuleBuildLog, pSize, pBuildLog);
+
+        ZE_HANDLE_UNSAMPLED_API(ModuleBuildLog, pfnGetStringCb, context.zeDdiTable.ModuleBuildLog.pfnGetString, hModuleBuildLog, pSize, pBuildLog);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ModuleBuildLog.pfnGetString, hModuleBuildLog, pSize, pBuildLog);
 
         // capture parameters
@@ -4308,14 +6209,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ModuleBuildLog.pfnGetString,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModuleBuildLog,
                                                   *tracerParams.ppSize,
                                                   *tracerParams.ppBuildLog);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeModuleGetNativeBinary
+    template <>
+    struct APIRecordArgs<ze_module_get_native_binary_params_t>
+    {
+        static uint32_t get(const ze_module_get_native_binary_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phModule);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeModuleGetNativeBinary
     __zedlllocal ze_result_t ZE_APICALL
@@ -4330,6 +6242,10 @@ namespace tracing_layer
         if( nullptr == pfnGetNativeBinary)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Module, pfnGetNativeBinaryCb, context.zeDdiTable.Module.pfnGetNativeBinary, hModule, pSize, pModuleNativeBinary);
+
+        ZE_HANDLE_UNSAMPLED_API(Module, pfnGetNativeBinaryCb, context.zeDdiTable.Module.pfnGetNativeBinary, hModule, pSize, pModuleNativeBinary);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetNativeBinary, hModule, pSize, pModuleNativeBinary);
 
         // capture parameters
@@ -4346,14 +6262,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetNativeBinary,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppSize,
                                                   *tracerParams.ppModuleNativeBinary);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeModuleGetGlobalPointer
+    template <>
+    struct APIRecordArgs<ze_module_get_global_pointer_params_t>
+    {
+        static uint32_t get(const ze_module_get_global_pointer_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phModule);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeModuleGetGlobalPointer
     __zedlllocal ze_result_t ZE_APICALL
@@ -4369,6 +6296,10 @@ namespace tracing_layer
         if( nullptr == pfnGetGlobalPointer)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Module, pfnGetGlobalPointerCb, context.zeDdiTable.Module.pfnGetGlobalPointer, hModule, pGlobalName, pSize, pptr);
+
+        ZE_HANDLE_UNSAMPLED_API(Module, pfnGetGlobalPointerCb, context.zeDdiTable.Module.pfnGetGlobalPointer, hModule, pGlobalName, pSize, pptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetGlobalPointer, hModule, pGlobalName, pSize, pptr);
 
         // capture parameters
@@ -4386,15 +6317,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetGlobalPointer,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppGlobalName,
                                                   *tracerParams.ppSize,
                                                   *tracerParams.ppptr);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeModuleGetKernelNames
+    template <>
+    struct APIRecordArgs<ze_module_get_kernel_names_params_t>
+    {
+        static uint32_t get(const ze_module_get_kernel_names_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phModule);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeModuleGetKernelNames
     __zedlllocal ze_result_t ZE_APICALL
@@ -4415,6 +6357,10 @@ namespace tracing_layer
         if( nullptr == pfnGetKernelNames)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Module, pfnGetKernelNamesCb, context.zeDdiTable.Module.pfnGetKernelNames, hModule, pCount, pNames);
+
+        ZE_HANDLE_UNSAMPLED_API(Module, pfnGetKernelNamesCb, context.zeDdiTable.Module.pfnGetKernelNames, hModule, pCount, pNames);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetKernelNames, hModule, pCount, pNames);
 
         // capture parameters
@@ -4431,14 +6377,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetKernelNames,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppNames);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeModuleGetProperties
+    template <>
+    struct APIRecordArgs<ze_module_get_properties_params_t>
+    {
+        static uint32_t get(const ze_module_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phModule);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeModuleGetProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -4452,6 +6409,10 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Module, pfnGetPropertiesCb, context.zeDdiTable.Module.pfnGetProperties, hModule, pModuleProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Module, pfnGetPropertiesCb, context.zeDdiTable.Module.pfnGetProperties, hModule, pModuleProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetProperties, hModule, pModuleProperties);
 
         // capture parameters
@@ -4467,13 +6428,32 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppModuleProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelCreate
+    template <>
+    struct APIRecordArgs<ze_kernel_create_params_t>
+    {
+        static uint32_t get(const ze_kernel_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phModule);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeKernelCreate
+    template <>
+    struct AsyncEpilogueOutArgs<ze_kernel_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 2);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelCreate
     __zedlllocal ze_result_t ZE_APICALL
@@ -4488,6 +6468,10 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnCreateCb, context.zeDdiTable.Kernel.pfnCreate, hModule, desc, phKernel);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnCreateCb, context.zeDdiTable.Kernel.pfnCreate, hModule, desc, phKernel);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnCreate, hModule, desc, phKernel);
 
         // capture parameters
@@ -4504,14 +6488,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphKernel);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelDestroy
+    template <>
+    struct APIRecordArgs<ze_kernel_destroy_params_t>
+    {
+        static uint32_t get(const ze_kernel_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelDestroy
     __zedlllocal ze_result_t ZE_APICALL
@@ -4524,6 +6519,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnDestroyCb, context.zeDdiTable.Kernel.pfnDestroy, hKernel);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnDestroyCb, context.zeDdiTable.Kernel.pfnDestroy, hKernel);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnDestroy, hKernel);
 
         // capture parameters
@@ -4538,12 +6537,31 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeModuleGetFunctionPointer
+    template <>
+    struct APIRecordArgs<ze_module_get_function_pointer_params_t>
+    {
+        static uint32_t get(const ze_module_get_function_pointer_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phModule);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeModuleGetFunctionPointer
+    template <>
+    struct AsyncEpilogueOutArgs<ze_module_get_function_pointer_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 2);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeModuleGetFunctionPointer
     __zedlllocal ze_result_t ZE_APICALL
@@ -4558,6 +6576,10 @@ namespace tracing_layer
         if( nullptr == pfnGetFunctionPointer)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Module, pfnGetFunctionPointerCb, context.zeDdiTable.Module.pfnGetFunctionPointer, hModule, pFunctionName, pfnFunction);
+
+        ZE_HANDLE_UNSAMPLED_API(Module, pfnGetFunctionPointerCb, context.zeDdiTable.Module.pfnGetFunctionPointer, hModule, pFunctionName, pfnFunction);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetFunctionPointer, hModule, pFunctionName, pfnFunction);
 
         // capture parameters
@@ -4574,14 +6596,28 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetFunctionPointer,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppFunctionName,
                                                   *tracerParams.ppfnFunction);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelSetGroupSize
+    template <>
+    struct APIRecordArgs<ze_kernel_set_group_size_params_t>
+    {
+        static uint32_t get(const ze_kernel_set_group_size_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            args[count++] = recordArg(*params->pgroupSizeX);
+            args[count++] = recordArg(*params->pgroupSizeY);
+            args[count++] = recordArg(*params->pgroupSizeZ);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelSetGroupSize
     __zedlllocal ze_result_t ZE_APICALL
@@ -4597,6 +6633,10 @@ namespace tracing_layer
         if( nullptr == pfnSetGroupSize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnSetGroupSizeCb, context.zeDdiTable.Kernel.pfnSetGroupSize, hKernel, groupSizeX, groupSizeY, groupSizeZ);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnSetGroupSizeCb, context.zeDdiTable.Kernel.pfnSetGroupSize, hKernel, groupSizeX, groupSizeY, groupSizeZ);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetGroupSize, hKernel, groupSizeX, groupSizeY, groupSizeZ);
 
         // capture parameters
@@ -4614,15 +6654,29 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSetGroupSize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pgroupSizeX,
                                                   *tracerParams.pgroupSizeY,
                                                   *tracerParams.pgroupSizeZ);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelSuggestGroupSize
+    template <>
+    struct APIRecordArgs<ze_kernel_suggest_group_size_params_t>
+    {
+        static uint32_t get(const ze_kernel_suggest_group_size_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            args[count++] = recordArg(*params->pglobalSizeX);
+            args[count++] = recordArg(*params->pglobalSizeY);
+            args[count++] = recordArg(*params->pglobalSizeZ);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelSuggestGroupSize
     __zedlllocal ze_result_t ZE_APICALL
@@ -4641,6 +6695,10 @@ namespace tracing_layer
         if( nullptr == pfnSuggestGroupSize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnSuggestGroupSizeCb, context.zeDdiTable.Kernel.pfnSuggestGroupSize, hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnSuggestGroupSizeCb, context.zeDdiTable.Kernel.pfnSuggestGroupSize, hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSuggestGroupSize, hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ);
 
         // capture parameters
@@ -4661,9 +6719,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSuggestGroupSize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pglobalSizeX,
                                                   *tracerParams.pglobalSizeY,
@@ -4673,6 +6729,19 @@ namespace tracing_layer
                                                   *tracerParams.pgroupSizeZ);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelSuggestMaxCooperativeGroupCount
+    template <>
+    struct APIRecordArgs<ze_kernel_suggest_max_cooperative_group_count_params_t>
+    {
+        static uint32_t get(const ze_kernel_suggest_max_cooperative_group_count_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelSuggestMaxCooperativeGroupCount
     __zedlllocal ze_result_t ZE_APICALL
@@ -4686,6 +6755,10 @@ namespace tracing_layer
         if( nullptr == pfnSuggestMaxCooperativeGroupCount)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnSuggestMaxCooperativeGroupCountCb, context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount, hKernel, totalGroupCount);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnSuggestMaxCooperativeGroupCountCb, context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount, hKernel, totalGroupCount);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount, hKernel, totalGroupCount);
 
         // capture parameters
@@ -4701,13 +6774,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ptotalGroupCount);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelSetArgumentValue
+    template <>
+    struct APIRecordArgs<ze_kernel_set_argument_value_params_t>
+    {
+        static uint32_t get(const ze_kernel_set_argument_value_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            args[count++] = recordArg(*params->pargIndex);
+            args[count++] = recordArg(*params->pargSize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelSetArgumentValue
     __zedlllocal ze_result_t ZE_APICALL
@@ -4724,6 +6810,10 @@ namespace tracing_layer
         if( nullptr == pfnSetArgumentValue)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnSetArgumentValueCb, context.zeDdiTable.Kernel.pfnSetArgumentValue, hKernel, argIndex, argSize, pArgValue);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnSetArgumentValueCb, context.zeDdiTable.Kernel.pfnSetArgumentValue, hKernel, argIndex, argSize, pArgValue);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetArgumentValue, hKernel, argIndex, argSize, pArgValue);
 
         // capture parameters
@@ -4741,15 +6831,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSetArgumentValue,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pargIndex,
                                                   *tracerParams.pargSize,
                                                   *tracerParams.ppArgValue);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelSetIndirectAccess
+    template <>
+    struct APIRecordArgs<ze_kernel_set_indirect_access_params_t>
+    {
+        static uint32_t get(const ze_kernel_set_indirect_access_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelSetIndirectAccess
     __zedlllocal ze_result_t ZE_APICALL
@@ -4763,6 +6864,10 @@ namespace tracing_layer
         if( nullptr == pfnSetIndirectAccess)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnSetIndirectAccessCb, context.zeDdiTable.Kernel.pfnSetIndirectAccess, hKernel, flags);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnSetIndirectAccessCb, context.zeDdiTable.Kernel.pfnSetIndirectAccess, hKernel, flags);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetIndirectAccess, hKernel, flags);
 
         // capture parameters
@@ -4778,13 +6883,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSetIndirectAccess,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pflags);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelGetIndirectAccess
+    template <>
+    struct APIRecordArgs<ze_kernel_get_indirect_access_params_t>
+    {
+        static uint32_t get(const ze_kernel_get_indirect_access_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelGetIndirectAccess
     __zedlllocal ze_result_t ZE_APICALL
@@ -4798,6 +6914,10 @@ namespace tracing_layer
         if( nullptr == pfnGetIndirectAccess)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnGetIndirectAccessCb, context.zeDdiTable.Kernel.pfnGetIndirectAccess, hKernel, pFlags);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnGetIndirectAccessCb, context.zeDdiTable.Kernel.pfnGetIndirectAccess, hKernel, pFlags);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetIndirectAccess, hKernel, pFlags);
 
         // capture parameters
@@ -4813,13 +6933,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnGetIndirectAccess,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppFlags);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelGetSourceAttributes
+    template <>
+    struct APIRecordArgs<ze_kernel_get_source_attributes_params_t>
+    {
+        static uint32_t get(const ze_kernel_get_source_attributes_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelGetSourceAttributes
     __zedlllocal ze_result_t ZE_APICALL
@@ -4841,6 +6972,10 @@ namespace tracing_layer
         if( nullptr == pfnGetSourceAttributes)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnGetSourceAttributesCb, context.zeDdiTable.Kernel.pfnGetSourceAttributes, hKernel, pSize, pString);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnGetSourceAttributesCb, context.zeDdiTable.Kernel.pfnGetSourceAttributes, hKernel, pSize, pString);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetSourceAttributes, hKernel, pSize, pString);
 
         // capture parameters
@@ -4857,14 +6992,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnGetSourceAttributes,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppSize,
                                                   *tracerParams.ppString);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelSetCacheConfig
+    template <>
+    struct APIRecordArgs<ze_kernel_set_cache_config_params_t>
+    {
+        static uint32_t get(const ze_kernel_set_cache_config_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelSetCacheConfig
     __zedlllocal ze_result_t ZE_APICALL
@@ -4879,6 +7025,10 @@ namespace tracing_layer
         if( nullptr == pfnSetCacheConfig)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnSetCacheConfigCb, context.zeDdiTable.Kernel.pfnSetCacheConfig, hKernel, flags);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnSetCacheConfigCb, context.zeDdiTable.Kernel.pfnSetCacheConfig, hKernel, flags);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetCacheConfig, hKernel, flags);
 
         // capture parameters
@@ -4894,13 +7044,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSetCacheConfig,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pflags);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelGetProperties
+    template <>
+    struct APIRecordArgs<ze_kernel_get_properties_params_t>
+    {
+        static uint32_t get(const ze_kernel_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelGetProperties
     __zedlllocal ze_result_t ZE_APICALL
@@ -4914,6 +7075,10 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnGetPropertiesCb, context.zeDdiTable.Kernel.pfnGetProperties, hKernel, pKernelProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnGetPropertiesCb, context.zeDdiTable.Kernel.pfnGetProperties, hKernel, pKernelProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetProperties, hKernel, pKernelProperties);
 
         // capture parameters
@@ -4929,13 +7094,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppKernelProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelGetName
+    template <>
+    struct APIRecordArgs<ze_kernel_get_name_params_t>
+    {
+        static uint32_t get(const ze_kernel_get_name_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelGetName
     __zedlllocal ze_result_t ZE_APICALL
@@ -4951,6 +7127,10 @@ namespace tracing_layer
         if( nullptr == pfnGetName)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnGetNameCb, context.zeDdiTable.Kernel.pfnGetName, hKernel, pSize, pName);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnGetNameCb, context.zeDdiTable.Kernel.pfnGetName, hKernel, pSize, pName);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetName, hKernel, pSize, pName);
 
         // capture parameters
@@ -4967,14 +7147,29 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnGetName,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppSize,
                                                   *tracerParams.ppName);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendLaunchKernel
+    template <>
+    struct APIRecordArgs<ze_command_list_append_launch_kernel_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_launch_kernel_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phKernel);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendLaunchKernel
     __zedlllocal ze_result_t ZE_APICALL
@@ -4994,6 +7189,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchKernel)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendLaunchKernelCb, context.zeDdiTable.CommandList.pfnAppendLaunchKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendLaunchKernelCb, context.zeDdiTable.CommandList.pfnAppendLaunchKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5013,9 +7212,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendLaunchKernel,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppLaunchFuncArgs,
@@ -5024,6 +7221,23 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendLaunchCooperativeKernel
+    template <>
+    struct APIRecordArgs<ze_command_list_append_launch_cooperative_kernel_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_launch_cooperative_kernel_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phKernel);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendLaunchCooperativeKernel
     __zedlllocal ze_result_t ZE_APICALL
@@ -5043,6 +7257,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchCooperativeKernel)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendLaunchCooperativeKernelCb, context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendLaunchCooperativeKernelCb, context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5062,9 +7280,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppLaunchFuncArgs,
@@ -5073,6 +7289,23 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendLaunchKernelIndirect
+    template <>
+    struct APIRecordArgs<ze_command_list_append_launch_kernel_indirect_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_launch_kernel_indirect_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phKernel);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendLaunchKernelIndirect
     __zedlllocal ze_result_t ZE_APICALL
@@ -5093,6 +7326,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchKernelIndirect)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendLaunchKernelIndirectCb, context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect, hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendLaunchKernelIndirectCb, context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect, hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect, hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5112,9 +7349,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppLaunchArgumentsBuffer,
@@ -5123,6 +7358,23 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendLaunchMultipleKernelsIndirect
+    template <>
+    struct APIRecordArgs<ze_command_list_append_launch_multiple_kernels_indirect_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_launch_multiple_kernels_indirect_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->pnumKernels);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendLaunchMultipleKernelsIndirect
     __zedlllocal ze_result_t ZE_APICALL
@@ -5147,6 +7399,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchMultipleKernelsIndirect)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendLaunchMultipleKernelsIndirectCb, context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect, hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendLaunchMultipleKernelsIndirectCb, context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect, hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect, hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5168,9 +7424,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumKernels,
                                                   *tracerParams.pphKernels,
@@ -5181,6 +7435,21 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeContextMakeMemoryResident
+    template <>
+    struct APIRecordArgs<ze_context_make_memory_resident_params_t>
+    {
+        static uint32_t get(const ze_context_make_memory_resident_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeContextMakeMemoryResident
     __zedlllocal ze_result_t ZE_APICALL
@@ -5196,6 +7465,10 @@ namespace tracing_layer
         if( nullptr == pfnMakeMemoryResident)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Context, pfnMakeMemoryResidentCb, context.zeDdiTable.Context.pfnMakeMemoryResident, hContext, hDevice, ptr, size);
+
+        ZE_HANDLE_UNSAMPLED_API(Context, pfnMakeMemoryResidentCb, context.zeDdiTable.Context.pfnMakeMemoryResident, hContext, hDevice, ptr, size);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnMakeMemoryResident, hContext, hDevice, ptr, size);
 
         // capture parameters
@@ -5213,15 +7486,28 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnMakeMemoryResident,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeContextEvictMemory
+    template <>
+    struct APIRecordArgs<ze_context_evict_memory_params_t>
+    {
+        static uint32_t get(const ze_context_evict_memory_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeContextEvictMemory
     __zedlllocal ze_result_t ZE_APICALL
@@ -5237,6 +7523,10 @@ namespace tracing_layer
         if( nullptr == pfnEvictMemory)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Context, pfnEvictMemoryCb, context.zeDdiTable.Context.pfnEvictMemory, hContext, hDevice, ptr, size);
+
+        ZE_HANDLE_UNSAMPLED_API(Context, pfnEvictMemoryCb, context.zeDdiTable.Context.pfnEvictMemory, hContext, hDevice, ptr, size);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnEvictMemory, hContext, hDevice, ptr, size);
 
         // capture parameters
@@ -5254,15 +7544,28 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnEvictMemory,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeContextMakeImageResident
+    template <>
+    struct APIRecordArgs<ze_context_make_image_resident_params_t>
+    {
+        static uint32_t get(const ze_context_make_image_resident_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->phImage);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeContextMakeImageResident
     __zedlllocal ze_result_t ZE_APICALL
@@ -5277,6 +7580,10 @@ namespace tracing_layer
         if( nullptr == pfnMakeImageResident)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Context, pfnMakeImageResidentCb, context.zeDdiTable.Context.pfnMakeImageResident, hContext, hDevice, hImage);
+
+        ZE_HANDLE_UNSAMPLED_API(Context, pfnMakeImageResidentCb, context.zeDdiTable.Context.pfnMakeImageResident, hContext, hDevice, hImage);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnMakeImageResident, hContext, hDevice, hImage);
 
         // capture parameters
@@ -5293,14 +7600,27 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnMakeImageResident,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phImage);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeContextEvictImage
+    template <>
+    struct APIRecordArgs<ze_context_evict_image_params_t>
+    {
+        static uint32_t get(const ze_context_evict_image_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->phImage);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeContextEvictImage
     __zedlllocal ze_result_t ZE_APICALL
@@ -5315,6 +7635,10 @@ namespace tracing_layer
         if( nullptr == pfnEvictImage)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Context, pfnEvictImageCb, context.zeDdiTable.Context.pfnEvictImage, hContext, hDevice, hImage);
+
+        ZE_HANDLE_UNSAMPLED_API(Context, pfnEvictImageCb, context.zeDdiTable.Context.pfnEvictImage, hContext, hDevice, hImage);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnEvictImage, hContext, hDevice, hImage);
 
         // capture parameters
@@ -5331,14 +7655,34 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnEvictImage,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phImage);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeSamplerCreate
+    template <>
+    struct APIRecordArgs<ze_sampler_create_params_t>
+    {
+        static uint32_t get(const ze_sampler_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeSamplerCreate
+    template <>
+    struct AsyncEpilogueOutArgs<ze_sampler_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 3);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeSamplerCreate
     __zedlllocal ze_result_t ZE_APICALL
@@ -5354,6 +7698,10 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Sampler, pfnCreateCb, context.zeDdiTable.Sampler.pfnCreate, hContext, hDevice, desc, phSampler);
+
+        ZE_HANDLE_UNSAMPLED_API(Sampler, pfnCreateCb, context.zeDdiTable.Sampler.pfnCreate, hContext, hDevice, desc, phSampler);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Sampler.pfnCreate, hContext, hDevice, desc, phSampler);
 
         // capture parameters
@@ -5371,15 +7719,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Sampler.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphSampler);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeSamplerDestroy
+    template <>
+    struct APIRecordArgs<ze_sampler_destroy_params_t>
+    {
+        static uint32_t get(const ze_sampler_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phSampler);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeSamplerDestroy
     __zedlllocal ze_result_t ZE_APICALL
@@ -5392,6 +7751,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Sampler, pfnDestroyCb, context.zeDdiTable.Sampler.pfnDestroy, hSampler);
+
+        ZE_HANDLE_UNSAMPLED_API(Sampler, pfnDestroyCb, context.zeDdiTable.Sampler.pfnDestroy, hSampler);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Sampler.pfnDestroy, hSampler);
 
         // capture parameters
@@ -5406,12 +7769,32 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Sampler.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phSampler);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeVirtualMemReserve
+    template <>
+    struct APIRecordArgs<ze_virtual_mem_reserve_params_t>
+    {
+        static uint32_t get(const ze_virtual_mem_reserve_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeVirtualMemReserve
+    template <>
+    struct AsyncEpilogueOutArgs<ze_virtual_mem_reserve_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 3);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeVirtualMemReserve
     __zedlllocal ze_result_t ZE_APICALL
@@ -5428,6 +7811,10 @@ namespace tracing_layer
         if( nullptr == pfnReserve)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(VirtualMem, pfnReserveCb, context.zeDdiTable.VirtualMem.pfnReserve, hContext, pStart, size, pptr);
+
+        ZE_HANDLE_UNSAMPLED_API(VirtualMem, pfnReserveCb, context.zeDdiTable.VirtualMem.pfnReserve, hContext, pStart, size, pptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnReserve, hContext, pStart, size, pptr);
 
         // capture parameters
@@ -5445,15 +7832,27 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnReserve,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.ppStart,
                                                   *tracerParams.psize,
                                                   *tracerParams.ppptr);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeVirtualMemFree
+    template <>
+    struct APIRecordArgs<ze_virtual_mem_free_params_t>
+    {
+        static uint32_t get(const ze_virtual_mem_free_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeVirtualMemFree
     __zedlllocal ze_result_t ZE_APICALL
@@ -5468,6 +7867,10 @@ namespace tracing_layer
         if( nullptr == pfnFree)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(VirtualMem, pfnFreeCb, context.zeDdiTable.VirtualMem.pfnFree, hContext, ptr, size);
+
+        ZE_HANDLE_UNSAMPLED_API(VirtualMem, pfnFreeCb, context.zeDdiTable.VirtualMem.pfnFree, hContext, ptr, size);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnFree, hContext, ptr, size);
 
         // capture parameters
@@ -5484,14 +7887,27 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnFree,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeVirtualMemQueryPageSize
+    template <>
+    struct APIRecordArgs<ze_virtual_mem_query_page_size_params_t>
+    {
+        static uint32_t get(const ze_virtual_mem_query_page_size_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeVirtualMemQueryPageSize
     __zedlllocal ze_result_t ZE_APICALL
@@ -5508,6 +7924,10 @@ namespace tracing_layer
         if( nullptr == pfnQueryPageSize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(VirtualMem, pfnQueryPageSizeCb, context.zeDdiTable.VirtualMem.pfnQueryPageSize, hContext, hDevice, size, pagesize);
+
+        ZE_HANDLE_UNSAMPLED_API(VirtualMem, pfnQueryPageSizeCb, context.zeDdiTable.VirtualMem.pfnQueryPageSize, hContext, hDevice, size, pagesize);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnQueryPageSize, hContext, hDevice, size, pagesize);
 
         // capture parameters
@@ -5525,15 +7945,35 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnQueryPageSize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.psize,
                                                   *tracerParams.ppagesize);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zePhysicalMemCreate
+    template <>
+    struct APIRecordArgs<ze_physical_mem_create_params_t>
+    {
+        static uint32_t get(const ze_physical_mem_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zePhysicalMemCreate
+    template <>
+    struct AsyncEpilogueOutArgs<ze_physical_mem_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 3);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zePhysicalMemCreate
     __zedlllocal ze_result_t ZE_APICALL
@@ -5550,6 +7990,10 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(PhysicalMem, pfnCreateCb, context.zeDdiTable.PhysicalMem.pfnCreate, hContext, hDevice, desc, phPhysicalMemory);
+
+        ZE_HANDLE_UNSAMPLED_API(PhysicalMem, pfnCreateCb, context.zeDdiTable.PhysicalMem.pfnCreate, hContext, hDevice, desc, phPhysicalMemory);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.PhysicalMem.pfnCreate, hContext, hDevice, desc, phPhysicalMemory);
 
         // capture parameters
@@ -5567,15 +8011,27 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.PhysicalMem.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphPhysicalMemory);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zePhysicalMemDestroy
+    template <>
+    struct APIRecordArgs<ze_physical_mem_destroy_params_t>
+    {
+        static uint32_t get(const ze_physical_mem_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phPhysicalMemory);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zePhysicalMemDestroy
     __zedlllocal ze_result_t ZE_APICALL
@@ -5589,6 +8045,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(PhysicalMem, pfnDestroyCb, context.zeDdiTable.PhysicalMem.pfnDestroy, hContext, hPhysicalMemory);
+
+        ZE_HANDLE_UNSAMPLED_API(PhysicalMem, pfnDestroyCb, context.zeDdiTable.PhysicalMem.pfnDestroy, hContext, hPhysicalMemory);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.PhysicalMem.pfnDestroy, hContext, hPhysicalMemory);
 
         // capture parameters
@@ -5604,13 +8064,27 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.PhysicalMem.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phPhysicalMemory);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeVirtualMemMap
+    template <>
+    struct APIRecordArgs<ze_virtual_mem_map_params_t>
+    {
+        static uint32_t get(const ze_virtual_mem_map_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->psize);
+            args[count++] = recordArg(*params->phPhysicalMemory);
+            args[count++] = recordArg(*params->poffset);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeVirtualMemMap
     __zedlllocal ze_result_t ZE_APICALL
@@ -5631,6 +8105,10 @@ namespace tracing_layer
         if( nullptr == pfnMap)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(VirtualMem, pfnMapCb, context.zeDdiTable.VirtualMem.pfnMap, hContext, ptr, size, hPhysicalMemory, offset, access);
+
+        ZE_HANDLE_UNSAMPLED_API(VirtualMem, pfnMapCb, context.zeDdiTable.VirtualMem.pfnMap, hContext, ptr, size, hPhysicalMemory, offset, access);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnMap, hContext, ptr, size, hPhysicalMemory, offset, access);
 
         // capture parameters
@@ -5650,9 +8128,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnMap,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize,
@@ -5661,6 +8137,20 @@ namespace tracing_layer
                                                   *tracerParams.paccess);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeVirtualMemUnmap
+    template <>
+    struct APIRecordArgs<ze_virtual_mem_unmap_params_t>
+    {
+        static uint32_t get(const ze_virtual_mem_unmap_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeVirtualMemUnmap
     __zedlllocal ze_result_t ZE_APICALL
@@ -5675,6 +8165,10 @@ namespace tracing_layer
         if( nullptr == pfnUnmap)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(VirtualMem, pfnUnmapCb, context.zeDdiTable.VirtualMem.pfnUnmap, hContext, ptr, size);
+
+        ZE_HANDLE_UNSAMPLED_API(VirtualMem, pfnUnmapCb, context.zeDdiTable.VirtualMem.pfnUnmap, hContext, ptr, size);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnUnmap, hContext, ptr, size);
 
         // capture parameters
@@ -5691,14 +8185,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnUnmap,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeVirtualMemSetAccessAttribute
+    template <>
+    struct APIRecordArgs<ze_virtual_mem_set_access_attribute_params_t>
+    {
+        static uint32_t get(const ze_virtual_mem_set_access_attribute_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeVirtualMemSetAccessAttribute
     __zedlllocal ze_result_t ZE_APICALL
@@ -5715,6 +8221,10 @@ namespace tracing_layer
         if( nullptr == pfnSetAccessAttribute)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(VirtualMem, pfnSetAccessAttributeCb, context.zeDdiTable.VirtualMem.pfnSetAccessAttribute, hContext, ptr, size, access);
+
+        ZE_HANDLE_UNSAMPLED_API(VirtualMem, pfnSetAccessAttributeCb, context.zeDdiTable.VirtualMem.pfnSetAccessAttribute, hContext, ptr, size, access);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnSetAccessAttribute, hContext, ptr, size, access);
 
         // capture parameters
@@ -5732,15 +8242,27 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnSetAccessAttribute,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize,
                                                   *tracerParams.paccess);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeVirtualMemGetAccessAttribute
+    template <>
+    struct APIRecordArgs<ze_virtual_mem_get_access_attribute_params_t>
+    {
+        static uint32_t get(const ze_virtual_mem_get_access_attribute_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeVirtualMemGetAccessAttribute
     __zedlllocal ze_result_t ZE_APICALL
@@ -5758,6 +8280,10 @@ namespace tracing_layer
         if( nullptr == pfnGetAccessAttribute)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(VirtualMem, pfnGetAccessAttributeCb, context.zeDdiTable.VirtualMem.pfnGetAccessAttribute, hContext, ptr, size, access, outSize);
+
+        ZE_HANDLE_UNSAMPLED_API(VirtualMem, pfnGetAccessAttributeCb, context.zeDdiTable.VirtualMem.pfnGetAccessAttribute, hContext, ptr, size, access, outSize);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnGetAccessAttribute, hContext, ptr, size, access, outSize);
 
         // capture parameters
@@ -5776,9 +8302,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnGetAccessAttribute,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize,
@@ -5786,6 +8310,22 @@ namespace tracing_layer
                                                   *tracerParams.poutSize);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelSetGlobalOffsetExp
+    template <>
+    struct APIRecordArgs<ze_kernel_set_global_offset_exp_params_t>
+    {
+        static uint32_t get(const ze_kernel_set_global_offset_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            args[count++] = recordArg(*params->poffsetX);
+            args[count++] = recordArg(*params->poffsetY);
+            args[count++] = recordArg(*params->poffsetZ);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelSetGlobalOffsetExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -5801,6 +8341,10 @@ namespace tracing_layer
         if( nullptr == pfnSetGlobalOffsetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnSetGlobalOffsetExpCb, context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp, hKernel, offsetX, offsetY, offsetZ);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnSetGlobalOffsetExpCb, context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp, hKernel, offsetX, offsetY, offsetZ);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp, hKernel, offsetX, offsetY, offsetZ);
 
         // capture parameters
@@ -5818,15 +8362,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.poffsetX,
                                                   *tracerParams.poffsetY,
                                                   *tracerParams.poffsetZ);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListGetNextCommandIdExp
+    template <>
+    struct APIRecordArgs<ze_command_list_get_next_command_id_exp_params_t>
+    {
+        static uint32_t get(const ze_command_list_get_next_command_id_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListGetNextCommandIdExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -5841,6 +8396,10 @@ namespace tracing_layer
         if( nullptr == pfnGetNextCommandIdExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnGetNextCommandIdExpCb, context.zeDdiTable.CommandListExp.pfnGetNextCommandIdExp, hCommandList, desc, pCommandId);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnGetNextCommandIdExpCb, context.zeDdiTable.CommandListExp.pfnGetNextCommandIdExp, hCommandList, desc, pCommandId);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnGetNextCommandIdExp, hCommandList, desc, pCommandId);
 
         // capture parameters
@@ -5857,14 +8416,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnGetNextCommandIdExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.ppCommandId);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListGetNextCommandIdWithKernelsExp
+    template <>
+    struct APIRecordArgs<ze_command_list_get_next_command_id_with_kernels_exp_params_t>
+    {
+        static uint32_t get(const ze_command_list_get_next_command_id_with_kernels_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->pnumKernels);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListGetNextCommandIdWithKernelsExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -5883,6 +8454,10 @@ namespace tracing_layer
         if( nullptr == pfnGetNextCommandIdWithKernelsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnGetNextCommandIdWithKernelsExpCb, context.zeDdiTable.CommandListExp.pfnGetNextCommandIdWithKernelsExp, hCommandList, desc, numKernels, phKernels, pCommandId);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnGetNextCommandIdWithKernelsExpCb, context.zeDdiTable.CommandListExp.pfnGetNextCommandIdWithKernelsExp, hCommandList, desc, numKernels, phKernels, pCommandId);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnGetNextCommandIdWithKernelsExp, hCommandList, desc, numKernels, phKernels, pCommandId);
 
         // capture parameters
@@ -5901,9 +8476,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnGetNextCommandIdWithKernelsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pnumKernels,
@@ -5911,6 +8484,19 @@ namespace tracing_layer
                                                   *tracerParams.ppCommandId);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListUpdateMutableCommandsExp
+    template <>
+    struct APIRecordArgs<ze_command_list_update_mutable_commands_exp_params_t>
+    {
+        static uint32_t get(const ze_command_list_update_mutable_commands_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListUpdateMutableCommandsExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -5925,6 +8511,10 @@ namespace tracing_layer
         if( nullptr == pfnUpdateMutableCommandsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnUpdateMutableCommandsExpCb, context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandsExp, hCommandList, desc);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnUpdateMutableCommandsExpCb, context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandsExp, hCommandList, desc);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandsExp, hCommandList, desc);
 
         // capture parameters
@@ -5940,13 +8530,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdesc);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListUpdateMutableCommandSignalEventExp
+    template <>
+    struct APIRecordArgs<ze_command_list_update_mutable_command_signal_event_exp_params_t>
+    {
+        static uint32_t get(const ze_command_list_update_mutable_command_signal_event_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->pcommandId);
+            args[count++] = recordArg(*params->phSignalEvent);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListUpdateMutableCommandSignalEventExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -5961,6 +8564,10 @@ namespace tracing_layer
         if( nullptr == pfnUpdateMutableCommandSignalEventExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnUpdateMutableCommandSignalEventExpCb, context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandSignalEventExp, hCommandList, commandId, hSignalEvent);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnUpdateMutableCommandSignalEventExpCb, context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandSignalEventExp, hCommandList, commandId, hSignalEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandSignalEventExp, hCommandList, commandId, hSignalEvent);
 
         // capture parameters
@@ -5977,14 +8584,28 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandSignalEventExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pcommandId,
                                                   *tracerParams.phSignalEvent);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListUpdateMutableCommandWaitEventsExp
+    template <>
+    struct APIRecordArgs<ze_command_list_update_mutable_command_wait_events_exp_params_t>
+    {
+        static uint32_t get(const ze_command_list_update_mutable_command_wait_events_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->pcommandId);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListUpdateMutableCommandWaitEventsExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6001,6 +8622,10 @@ namespace tracing_layer
         if( nullptr == pfnUpdateMutableCommandWaitEventsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnUpdateMutableCommandWaitEventsExpCb, context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandWaitEventsExp, hCommandList, commandId, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnUpdateMutableCommandWaitEventsExpCb, context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandWaitEventsExp, hCommandList, commandId, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandWaitEventsExp, hCommandList, commandId, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -6018,15 +8643,27 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandWaitEventsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pcommandId,
                                                   *tracerParams.pnumWaitEvents,
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListUpdateMutableCommandKernelsExp
+    template <>
+    struct APIRecordArgs<ze_command_list_update_mutable_command_kernels_exp_params_t>
+    {
+        static uint32_t get(const ze_command_list_update_mutable_command_kernels_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->pnumKernels);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListUpdateMutableCommandKernelsExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6043,6 +8680,10 @@ namespace tracing_layer
         if( nullptr == pfnUpdateMutableCommandKernelsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnUpdateMutableCommandKernelsExpCb, context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandKernelsExp, hCommandList, numKernels, pCommandId, phKernels);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnUpdateMutableCommandKernelsExpCb, context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandKernelsExp, hCommandList, numKernels, pCommandId, phKernels);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandKernelsExp, hCommandList, numKernels, pCommandId, phKernels);
 
         // capture parameters
@@ -6060,15 +8701,28 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandKernelsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumKernels,
                                                   *tracerParams.ppCommandId,
                                                   *tracerParams.pphKernels);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceReserveCacheExt
+    template <>
+    struct APIRecordArgs<ze_device_reserve_cache_ext_params_t>
+    {
+        static uint32_t get(const ze_device_reserve_cache_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->pcacheLevel);
+            args[count++] = recordArg(*params->pcacheReservationSize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceReserveCacheExt
     __zedlllocal ze_result_t ZE_APICALL
@@ -6086,6 +8740,10 @@ namespace tracing_layer
         if( nullptr == pfnReserveCacheExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnReserveCacheExtCb, context.zeDdiTable.Device.pfnReserveCacheExt, hDevice, cacheLevel, cacheReservationSize);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnReserveCacheExtCb, context.zeDdiTable.Device.pfnReserveCacheExt, hDevice, cacheLevel, cacheReservationSize);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnReserveCacheExt, hDevice, cacheLevel, cacheReservationSize);
 
         // capture parameters
@@ -6102,14 +8760,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnReserveCacheExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pcacheLevel,
                                                   *tracerParams.pcacheReservationSize);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceSetCacheAdviceExt
+    template <>
+    struct APIRecordArgs<ze_device_set_cache_advice_ext_params_t>
+    {
+        static uint32_t get(const ze_device_set_cache_advice_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->pregionSize);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceSetCacheAdviceExt
     __zedlllocal ze_result_t ZE_APICALL
@@ -6125,6 +8795,10 @@ namespace tracing_layer
         if( nullptr == pfnSetCacheAdviceExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnSetCacheAdviceExtCb, context.zeDdiTable.Device.pfnSetCacheAdviceExt, hDevice, ptr, regionSize, cacheRegion);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnSetCacheAdviceExtCb, context.zeDdiTable.Device.pfnSetCacheAdviceExt, hDevice, ptr, regionSize, cacheRegion);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnSetCacheAdviceExt, hDevice, ptr, regionSize, cacheRegion);
 
         // capture parameters
@@ -6142,15 +8816,27 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnSetCacheAdviceExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
                                                   *tracerParams.pregionSize,
                                                   *tracerParams.pcacheRegion);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventQueryTimestampsExp
+    template <>
+    struct APIRecordArgs<ze_event_query_timestamps_exp_params_t>
+    {
+        static uint32_t get(const ze_event_query_timestamps_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEvent);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventQueryTimestampsExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6172,6 +8858,10 @@ namespace tracing_layer
         if( nullptr == pfnQueryTimestampsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Event, pfnQueryTimestampsExpCb, context.zeDdiTable.EventExp.pfnQueryTimestampsExp, hEvent, hDevice, pCount, pTimestamps);
+
+        ZE_HANDLE_UNSAMPLED_API(Event, pfnQueryTimestampsExpCb, context.zeDdiTable.EventExp.pfnQueryTimestampsExp, hEvent, hDevice, pCount, pTimestamps);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventExp.pfnQueryTimestampsExp, hEvent, hDevice, pCount, pTimestamps);
 
         // capture parameters
@@ -6189,15 +8879,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventExp.pfnQueryTimestampsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppTimestamps);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeImageGetMemoryPropertiesExp
+    template <>
+    struct APIRecordArgs<ze_image_get_memory_properties_exp_params_t>
+    {
+        static uint32_t get(const ze_image_get_memory_properties_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phImage);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeImageGetMemoryPropertiesExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6211,6 +8912,10 @@ namespace tracing_layer
         if( nullptr == pfnGetMemoryPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Image, pfnGetMemoryPropertiesExpCb, context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp, hImage, pMemoryProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Image, pfnGetMemoryPropertiesExpCb, context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp, hImage, pMemoryProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp, hImage, pMemoryProperties);
 
         // capture parameters
@@ -6226,13 +8931,34 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phImage,
                                                   *tracerParams.ppMemoryProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeImageViewCreateExt
+    template <>
+    struct APIRecordArgs<ze_image_view_create_ext_params_t>
+    {
+        static uint32_t get(const ze_image_view_create_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->phImage);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeImageViewCreateExt
+    template <>
+    struct AsyncEpilogueOutArgs<ze_image_view_create_ext_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 4);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeImageViewCreateExt
     __zedlllocal ze_result_t ZE_APICALL
@@ -6249,6 +8975,10 @@ namespace tracing_layer
         if( nullptr == pfnViewCreateExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Image, pfnViewCreateExtCb, context.zeDdiTable.Image.pfnViewCreateExt, hContext, hDevice, desc, hImage, phImageView);
+
+        ZE_HANDLE_UNSAMPLED_API(Image, pfnViewCreateExtCb, context.zeDdiTable.Image.pfnViewCreateExt, hContext, hDevice, desc, hImage, phImageView);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnViewCreateExt, hContext, hDevice, desc, hImage, phImageView);
 
         // capture parameters
@@ -6267,9 +8997,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnViewCreateExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
@@ -6277,6 +9005,29 @@ namespace tracing_layer
                                                   *tracerParams.pphImageView);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeImageViewCreateExp
+    template <>
+    struct APIRecordArgs<ze_image_view_create_exp_params_t>
+    {
+        static uint32_t get(const ze_image_view_create_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->phImage);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeImageViewCreateExp
+    template <>
+    struct AsyncEpilogueOutArgs<ze_image_view_create_exp_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 4);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeImageViewCreateExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6293,6 +9044,10 @@ namespace tracing_layer
         if( nullptr == pfnViewCreateExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Image, pfnViewCreateExpCb, context.zeDdiTable.ImageExp.pfnViewCreateExp, hContext, hDevice, desc, hImage, phImageView);
+
+        ZE_HANDLE_UNSAMPLED_API(Image, pfnViewCreateExpCb, context.zeDdiTable.ImageExp.pfnViewCreateExp, hContext, hDevice, desc, hImage, phImageView);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ImageExp.pfnViewCreateExp, hContext, hDevice, desc, hImage, phImageView);
 
         // capture parameters
@@ -6311,9 +9066,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ImageExp.pfnViewCreateExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
@@ -6321,6 +9074,19 @@ namespace tracing_layer
                                                   *tracerParams.pphImageView);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeKernelSchedulingHintExp
+    template <>
+    struct APIRecordArgs<ze_kernel_scheduling_hint_exp_params_t>
+    {
+        static uint32_t get(const ze_kernel_scheduling_hint_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeKernelSchedulingHintExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6334,6 +9100,10 @@ namespace tracing_layer
         if( nullptr == pfnSchedulingHintExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Kernel, pfnSchedulingHintExpCb, context.zeDdiTable.KernelExp.pfnSchedulingHintExp, hKernel, pHint);
+
+        ZE_HANDLE_UNSAMPLED_API(Kernel, pfnSchedulingHintExpCb, context.zeDdiTable.KernelExp.pfnSchedulingHintExp, hKernel, pHint);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.KernelExp.pfnSchedulingHintExp, hKernel, pHint);
 
         // capture parameters
@@ -6349,13 +9119,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.KernelExp.pfnSchedulingHintExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppHint);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDevicePciGetPropertiesExt
+    template <>
+    struct APIRecordArgs<ze_device_pci_get_properties_ext_params_t>
+    {
+        static uint32_t get(const ze_device_pci_get_properties_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDevicePciGetPropertiesExt
     __zedlllocal ze_result_t ZE_APICALL
@@ -6369,6 +9150,10 @@ namespace tracing_layer
         if( nullptr == pfnPciGetPropertiesExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnPciGetPropertiesExtCb, context.zeDdiTable.Device.pfnPciGetPropertiesExt, hDevice, pPciProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnPciGetPropertiesExtCb, context.zeDdiTable.Device.pfnPciGetPropertiesExt, hDevice, pPciProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnPciGetPropertiesExt, hDevice, pPciProperties);
 
         // capture parameters
@@ -6384,13 +9169,30 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnPciGetPropertiesExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppPciProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendImageCopyToMemoryExt
+    template <>
+    struct APIRecordArgs<ze_command_list_append_image_copy_to_memory_ext_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_image_copy_to_memory_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phSrcImage);
+            args[count++] = recordArg(*params->pdestRowPitch);
+            args[count++] = recordArg(*params->pdestSlicePitch);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendImageCopyToMemoryExt
     __zedlllocal ze_result_t ZE_APICALL
@@ -6415,6 +9217,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyToMemoryExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendImageCopyToMemoryExtCb, context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt, hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendImageCopyToMemoryExtCb, context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt, hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt, hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -6437,9 +9243,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.phSrcImage,
@@ -6451,6 +9255,25 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListAppendImageCopyFromMemoryExt
+    template <>
+    struct APIRecordArgs<ze_command_list_append_image_copy_from_memory_ext_params_t>
+    {
+        static uint32_t get(const ze_command_list_append_image_copy_from_memory_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phDstImage);
+            args[count++] = recordArg(*params->psrcRowPitch);
+            args[count++] = recordArg(*params->psrcSlicePitch);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListAppendImageCopyFromMemoryExt
     __zedlllocal ze_result_t ZE_APICALL
@@ -6475,6 +9298,10 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyFromMemoryExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnAppendImageCopyFromMemoryExtCb, context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt, hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnAppendImageCopyFromMemoryExtCb, context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt, hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt, hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -6497,9 +9324,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDstImage,
                                                   *tracerParams.psrcptr,
@@ -6511,6 +9336,20 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeImageGetAllocPropertiesExt
+    template <>
+    struct APIRecordArgs<ze_image_get_alloc_properties_ext_params_t>
+    {
+        static uint32_t get(const ze_image_get_alloc_properties_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phImage);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeImageGetAllocPropertiesExt
     __zedlllocal ze_result_t ZE_APICALL
@@ -6525,6 +9364,10 @@ namespace tracing_layer
         if( nullptr == pfnGetAllocPropertiesExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Image, pfnGetAllocPropertiesExtCb, context.zeDdiTable.Image.pfnGetAllocPropertiesExt, hContext, hImage, pImageAllocProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Image, pfnGetAllocPropertiesExtCb, context.zeDdiTable.Image.pfnGetAllocPropertiesExt, hContext, hImage, pImageAllocProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnGetAllocPropertiesExt, hContext, hImage, pImageAllocProperties);
 
         // capture parameters
@@ -6541,14 +9384,33 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnGetAllocPropertiesExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phImage,
                                                   *tracerParams.ppImageAllocProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeModuleInspectLinkageExt
+    template <>
+    struct APIRecordArgs<ze_module_inspect_linkage_ext_params_t>
+    {
+        static uint32_t get(const ze_module_inspect_linkage_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->pnumModules);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeModuleInspectLinkageExt
+    template <>
+    struct AsyncEpilogueOutArgs<ze_module_inspect_linkage_ext_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 3);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeModuleInspectLinkageExt
     __zedlllocal ze_result_t ZE_APICALL
@@ -6566,6 +9428,10 @@ namespace tracing_layer
         if( nullptr == pfnInspectLinkageExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Module, pfnInspectLinkageExtCb, context.zeDdiTable.Module.pfnInspectLinkageExt, pInspectDesc, numModules, phModules, phLog);
+
+        ZE_HANDLE_UNSAMPLED_API(Module, pfnInspectLinkageExtCb, context.zeDdiTable.Module.pfnInspectLinkageExt, pInspectDesc, numModules, phModules, phLog);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnInspectLinkageExt, pInspectDesc, numModules, phModules, phLog);
 
         // capture parameters
@@ -6583,15 +9449,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnInspectLinkageExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.ppInspectDesc,
                                                   *tracerParams.pnumModules,
                                                   *tracerParams.pphModules,
                                                   *tracerParams.pphLog);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemFreeExt
+    template <>
+    struct APIRecordArgs<ze_mem_free_ext_params_t>
+    {
+        static uint32_t get(const ze_mem_free_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemFreeExt
     __zedlllocal ze_result_t ZE_APICALL
@@ -6606,6 +9483,10 @@ namespace tracing_layer
         if( nullptr == pfnFreeExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnFreeExtCb, context.zeDdiTable.Mem.pfnFreeExt, hContext, pMemFreeDesc, ptr);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnFreeExtCb, context.zeDdiTable.Mem.pfnFreeExt, hContext, pMemFreeDesc, ptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnFreeExt, hContext, pMemFreeDesc, ptr);
 
         // capture parameters
@@ -6622,14 +9503,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnFreeExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.ppMemFreeDesc,
                                                   *tracerParams.pptr);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeFabricVertexGetExp
+    template <>
+    struct APIRecordArgs<ze_fabric_vertex_get_exp_params_t>
+    {
+        static uint32_t get(const ze_fabric_vertex_get_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeFabricVertexGetExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6651,6 +9543,10 @@ namespace tracing_layer
         if( nullptr == pfnGetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(FabricVertex, pfnGetExpCb, context.zeDdiTable.FabricVertexExp.pfnGetExp, hDriver, pCount, phVertices);
+
+        ZE_HANDLE_UNSAMPLED_API(FabricVertex, pfnGetExpCb, context.zeDdiTable.FabricVertexExp.pfnGetExp, hDriver, pCount, phVertices);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetExp, hDriver, pCount, phVertices);
 
         // capture parameters
@@ -6667,14 +9563,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricVertexExp.pfnGetExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphVertices);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeFabricVertexGetSubVerticesExp
+    template <>
+    struct APIRecordArgs<ze_fabric_vertex_get_sub_vertices_exp_params_t>
+    {
+        static uint32_t get(const ze_fabric_vertex_get_sub_vertices_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phVertex);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeFabricVertexGetSubVerticesExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6696,6 +9603,10 @@ namespace tracing_layer
         if( nullptr == pfnGetSubVerticesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(FabricVertex, pfnGetSubVerticesExpCb, context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp, hVertex, pCount, phSubvertices);
+
+        ZE_HANDLE_UNSAMPLED_API(FabricVertex, pfnGetSubVerticesExpCb, context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp, hVertex, pCount, phSubvertices);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp, hVertex, pCount, phSubvertices);
 
         // capture parameters
@@ -6712,14 +9623,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phVertex,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphSubvertices);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeFabricVertexGetPropertiesExp
+    template <>
+    struct APIRecordArgs<ze_fabric_vertex_get_properties_exp_params_t>
+    {
+        static uint32_t get(const ze_fabric_vertex_get_properties_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phVertex);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeFabricVertexGetPropertiesExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6733,6 +9655,10 @@ namespace tracing_layer
         if( nullptr == pfnGetPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(FabricVertex, pfnGetPropertiesExpCb, context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp, hVertex, pVertexProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(FabricVertex, pfnGetPropertiesExpCb, context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp, hVertex, pVertexProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp, hVertex, pVertexProperties);
 
         // capture parameters
@@ -6748,13 +9674,32 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phVertex,
                                                   *tracerParams.ppVertexProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeFabricVertexGetDeviceExp
+    template <>
+    struct APIRecordArgs<ze_fabric_vertex_get_device_exp_params_t>
+    {
+        static uint32_t get(const ze_fabric_vertex_get_device_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phVertex);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeFabricVertexGetDeviceExp
+    template <>
+    struct AsyncEpilogueOutArgs<ze_fabric_vertex_get_device_exp_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 1);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeFabricVertexGetDeviceExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6768,6 +9713,10 @@ namespace tracing_layer
         if( nullptr == pfnGetDeviceExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(FabricVertex, pfnGetDeviceExpCb, context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp, hVertex, phDevice);
+
+        ZE_HANDLE_UNSAMPLED_API(FabricVertex, pfnGetDeviceExpCb, context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp, hVertex, phDevice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp, hVertex, phDevice);
 
         // capture parameters
@@ -6783,13 +9732,32 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phVertex,
                                                   *tracerParams.pphDevice);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDeviceGetFabricVertexExp
+    template <>
+    struct APIRecordArgs<ze_device_get_fabric_vertex_exp_params_t>
+    {
+        static uint32_t get(const ze_device_get_fabric_vertex_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeDeviceGetFabricVertexExp
+    template <>
+    struct AsyncEpilogueOutArgs<ze_device_get_fabric_vertex_exp_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 1);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDeviceGetFabricVertexExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6803,6 +9771,10 @@ namespace tracing_layer
         if( nullptr == pfnGetFabricVertexExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Device, pfnGetFabricVertexExpCb, context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp, hDevice, phVertex);
+
+        ZE_HANDLE_UNSAMPLED_API(Device, pfnGetFabricVertexExpCb, context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp, hDevice, phVertex);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp, hDevice, phVertex);
 
         // capture parameters
@@ -6818,13 +9790,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pphVertex);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeFabricEdgeGetExp
+    template <>
+    struct APIRecordArgs<ze_fabric_edge_get_exp_params_t>
+    {
+        static uint32_t get(const ze_fabric_edge_get_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phVertexA);
+            args[count++] = recordArg(*params->phVertexB);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeFabricEdgeGetExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6847,6 +9831,10 @@ namespace tracing_layer
         if( nullptr == pfnGetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(FabricEdge, pfnGetExpCb, context.zeDdiTable.FabricEdgeExp.pfnGetExp, hVertexA, hVertexB, pCount, phEdges);
+
+        ZE_HANDLE_UNSAMPLED_API(FabricEdge, pfnGetExpCb, context.zeDdiTable.FabricEdgeExp.pfnGetExp, hVertexA, hVertexB, pCount, phEdges);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricEdgeExp.pfnGetExp, hVertexA, hVertexB, pCount, phEdges);
 
         // capture parameters
@@ -6864,15 +9852,34 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricEdgeExp.pfnGetExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phVertexA,
                                                   *tracerParams.phVertexB,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.pphEdges);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeFabricEdgeGetVerticesExp
+    template <>
+    struct APIRecordArgs<ze_fabric_edge_get_vertices_exp_params_t>
+    {
+        static uint32_t get(const ze_fabric_edge_get_vertices_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEdge);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeFabricEdgeGetVerticesExp
+    template <>
+    struct AsyncEpilogueOutArgs<ze_fabric_edge_get_vertices_exp_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 1) | (1u << 2);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeFabricEdgeGetVerticesExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6887,6 +9894,10 @@ namespace tracing_layer
         if( nullptr == pfnGetVerticesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(FabricEdge, pfnGetVerticesExpCb, context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp, hEdge, phVertexA, phVertexB);
+
+        ZE_HANDLE_UNSAMPLED_API(FabricEdge, pfnGetVerticesExpCb, context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp, hEdge, phVertexA, phVertexB);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp, hEdge, phVertexA, phVertexB);
 
         // capture parameters
@@ -6903,14 +9914,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEdge,
                                                   *tracerParams.pphVertexA,
                                                   *tracerParams.pphVertexB);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeFabricEdgeGetPropertiesExp
+    template <>
+    struct APIRecordArgs<ze_fabric_edge_get_properties_exp_params_t>
+    {
+        static uint32_t get(const ze_fabric_edge_get_properties_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEdge);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeFabricEdgeGetPropertiesExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -6924,6 +9946,10 @@ namespace tracing_layer
         if( nullptr == pfnGetPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(FabricEdge, pfnGetPropertiesExpCb, context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp, hEdge, pEdgeProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(FabricEdge, pfnGetPropertiesExpCb, context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp, hEdge, pEdgeProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp, hEdge, pEdgeProperties);
 
         // capture parameters
@@ -6939,13 +9965,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEdge,
                                                   *tracerParams.ppEdgeProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeEventQueryKernelTimestampsExt
+    template <>
+    struct APIRecordArgs<ze_event_query_kernel_timestamps_ext_params_t>
+    {
+        static uint32_t get(const ze_event_query_kernel_timestamps_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEvent);
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeEventQueryKernelTimestampsExt
     __zedlllocal ze_result_t ZE_APICALL
@@ -6974,6 +10012,10 @@ namespace tracing_layer
         if( nullptr == pfnQueryKernelTimestampsExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Event, pfnQueryKernelTimestampsExtCb, context.zeDdiTable.Event.pfnQueryKernelTimestampsExt, hEvent, hDevice, pCount, pResults);
+
+        ZE_HANDLE_UNSAMPLED_API(Event, pfnQueryKernelTimestampsExtCb, context.zeDdiTable.Event.pfnQueryKernelTimestampsExt, hEvent, hDevice, pCount, pResults);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnQueryKernelTimestampsExt, hEvent, hDevice, pCount, pResults);
 
         // capture parameters
@@ -6991,15 +10033,34 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnQueryKernelTimestampsExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
                                                   *tracerParams.ppResults);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeRTASBuilderCreateExp
+    template <>
+    struct APIRecordArgs<ze_rtas_builder_create_exp_params_t>
+    {
+        static uint32_t get(const ze_rtas_builder_create_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeRTASBuilderCreateExp
+    template <>
+    struct AsyncEpilogueOutArgs<ze_rtas_builder_create_exp_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 2);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeRTASBuilderCreateExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -7014,6 +10075,10 @@ namespace tracing_layer
         if( nullptr == pfnCreateExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(RTASBuilder, pfnCreateExpCb, context.zeDdiTable.RTASBuilderExp.pfnCreateExp, hDriver, pDescriptor, phBuilder);
+
+        ZE_HANDLE_UNSAMPLED_API(RTASBuilder, pfnCreateExpCb, context.zeDdiTable.RTASBuilderExp.pfnCreateExp, hDriver, pDescriptor, phBuilder);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilderExp.pfnCreateExp, hDriver, pDescriptor, phBuilder);
 
         // capture parameters
@@ -7030,14 +10095,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASBuilderExp.pfnCreateExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppDescriptor,
                                                   *tracerParams.pphBuilder);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeRTASBuilderGetBuildPropertiesExp
+    template <>
+    struct APIRecordArgs<ze_rtas_builder_get_build_properties_exp_params_t>
+    {
+        static uint32_t get(const ze_rtas_builder_get_build_properties_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phBuilder);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeRTASBuilderGetBuildPropertiesExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -7052,6 +10128,10 @@ namespace tracing_layer
         if( nullptr == pfnGetBuildPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(RTASBuilder, pfnGetBuildPropertiesExpCb, context.zeDdiTable.RTASBuilderExp.pfnGetBuildPropertiesExp, hBuilder, pBuildOpDescriptor, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(RTASBuilder, pfnGetBuildPropertiesExpCb, context.zeDdiTable.RTASBuilderExp.pfnGetBuildPropertiesExp, hBuilder, pBuildOpDescriptor, pProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilderExp.pfnGetBuildPropertiesExp, hBuilder, pBuildOpDescriptor, pProperties);
 
         // capture parameters
@@ -7068,14 +10148,25 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASBuilderExp.pfnGetBuildPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phBuilder,
                                                   *tracerParams.ppBuildOpDescriptor,
                                                   *tracerParams.ppProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeDriverRTASFormatCompatibilityCheckExp
+    template <>
+    struct APIRecordArgs<ze_driver_rtas_format_compatibility_check_exp_params_t>
+    {
+        static uint32_t get(const ze_driver_rtas_format_compatibility_check_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeDriverRTASFormatCompatibilityCheckExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -7090,6 +10181,10 @@ namespace tracing_layer
         if( nullptr == pfnRTASFormatCompatibilityCheckExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Driver, pfnRTASFormatCompatibilityCheckExpCb, context.zeDdiTable.DriverExp.pfnRTASFormatCompatibilityCheckExp, hDriver, rtasFormatA, rtasFormatB);
+
+        ZE_HANDLE_UNSAMPLED_API(Driver, pfnRTASFormatCompatibilityCheckExpCb, context.zeDdiTable.DriverExp.pfnRTASFormatCompatibilityCheckExp, hDriver, rtasFormatA, rtasFormatB);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.DriverExp.pfnRTASFormatCompatibilityCheckExp, hDriver, rtasFormatA, rtasFormatB);
 
         // capture parameters
@@ -7106,14 +10201,28 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.DriverExp.pfnRTASFormatCompatibilityCheckExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.prtasFormatA,
                                                   *tracerParams.prtasFormatB);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeRTASBuilderBuildExp
+    template <>
+    struct APIRecordArgs<ze_rtas_builder_build_exp_params_t>
+    {
+        static uint32_t get(const ze_rtas_builder_build_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phBuilder);
+            args[count++] = recordArg(*params->pscratchBufferSizeBytes);
+            args[count++] = recordArg(*params->prtasBufferSizeBytes);
+            args[count++] = recordArg(*params->phParallelOperation);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeRTASBuilderBuildExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -7138,6 +10247,10 @@ namespace tracing_layer
         if( nullptr == pfnBuildExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(RTASBuilder, pfnBuildExpCb, context.zeDdiTable.RTASBuilderExp.pfnBuildExp, hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes);
+
+        ZE_HANDLE_UNSAMPLED_API(RTASBuilder, pfnBuildExpCb, context.zeDdiTable.RTASBuilderExp.pfnBuildExp, hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilderExp.pfnBuildExp, hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes);
 
         // capture parameters
@@ -7161,9 +10274,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASBuilderExp.pfnBuildExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phBuilder,
                                                   *tracerParams.ppBuildOpDescriptor,
                                                   *tracerParams.ppScratchBuffer,
@@ -7176,6 +10287,19 @@ namespace tracing_layer
                                                   *tracerParams.ppRtasBufferSizeBytes);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeRTASBuilderDestroyExp
+    template <>
+    struct APIRecordArgs<ze_rtas_builder_destroy_exp_params_t>
+    {
+        static uint32_t get(const ze_rtas_builder_destroy_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phBuilder);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeRTASBuilderDestroyExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -7188,6 +10312,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroyExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(RTASBuilder, pfnDestroyExpCb, context.zeDdiTable.RTASBuilderExp.pfnDestroyExp, hBuilder);
+
+        ZE_HANDLE_UNSAMPLED_API(RTASBuilder, pfnDestroyExpCb, context.zeDdiTable.RTASBuilderExp.pfnDestroyExp, hBuilder);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilderExp.pfnDestroyExp, hBuilder);
 
         // capture parameters
@@ -7202,12 +10330,31 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASBuilderExp.pfnDestroyExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phBuilder);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeRTASParallelOperationCreateExp
+    template <>
+    struct APIRecordArgs<ze_rtas_parallel_operation_create_exp_params_t>
+    {
+        static uint32_t get(const ze_rtas_parallel_operation_create_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeRTASParallelOperationCreateExp
+    template <>
+    struct AsyncEpilogueOutArgs<ze_rtas_parallel_operation_create_exp_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 1);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeRTASParallelOperationCreateExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -7221,6 +10368,10 @@ namespace tracing_layer
         if( nullptr == pfnCreateExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(RTASParallelOperation, pfnCreateExpCb, context.zeDdiTable.RTASParallelOperationExp.pfnCreateExp, hDriver, phParallelOperation);
+
+        ZE_HANDLE_UNSAMPLED_API(RTASParallelOperation, pfnCreateExpCb, context.zeDdiTable.RTASParallelOperationExp.pfnCreateExp, hDriver, phParallelOperation);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperationExp.pfnCreateExp, hDriver, phParallelOperation);
 
         // capture parameters
@@ -7236,13 +10387,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASParallelOperationExp.pfnCreateExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pphParallelOperation);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeRTASParallelOperationGetPropertiesExp
+    template <>
+    struct APIRecordArgs<ze_rtas_parallel_operation_get_properties_exp_params_t>
+    {
+        static uint32_t get(const ze_rtas_parallel_operation_get_properties_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phParallelOperation);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeRTASParallelOperationGetPropertiesExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -7256,6 +10418,10 @@ namespace tracing_layer
         if( nullptr == pfnGetPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(RTASParallelOperation, pfnGetPropertiesExpCb, context.zeDdiTable.RTASParallelOperationExp.pfnGetPropertiesExp, hParallelOperation, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(RTASParallelOperation, pfnGetPropertiesExpCb, context.zeDdiTable.RTASParallelOperationExp.pfnGetPropertiesExp, hParallelOperation, pProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperationExp.pfnGetPropertiesExp, hParallelOperation, pProperties);
 
         // capture parameters
@@ -7271,13 +10437,24 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASParallelOperationExp.pfnGetPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phParallelOperation,
                                                   *tracerParams.ppProperties);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeRTASParallelOperationJoinExp
+    template <>
+    struct APIRecordArgs<ze_rtas_parallel_operation_join_exp_params_t>
+    {
+        static uint32_t get(const ze_rtas_parallel_operation_join_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phParallelOperation);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeRTASParallelOperationJoinExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -7290,6 +10467,10 @@ namespace tracing_layer
         if( nullptr == pfnJoinExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(RTASParallelOperation, pfnJoinExpCb, context.zeDdiTable.RTASParallelOperationExp.pfnJoinExp, hParallelOperation);
+
+        ZE_HANDLE_UNSAMPLED_API(RTASParallelOperation, pfnJoinExpCb, context.zeDdiTable.RTASParallelOperationExp.pfnJoinExp, hParallelOperation);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperationExp.pfnJoinExp, hParallelOperation);
 
         // capture parameters
@@ -7304,12 +10485,23 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASParallelOperationExp.pfnJoinExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phParallelOperation);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeRTASParallelOperationDestroyExp
+    template <>
+    struct APIRecordArgs<ze_rtas_parallel_operation_destroy_exp_params_t>
+    {
+        static uint32_t get(const ze_rtas_parallel_operation_destroy_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phParallelOperation);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeRTASParallelOperationDestroyExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -7322,6 +10514,10 @@ namespace tracing_layer
         if( nullptr == pfnDestroyExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(RTASParallelOperation, pfnDestroyExpCb, context.zeDdiTable.RTASParallelOperationExp.pfnDestroyExp, hParallelOperation);
+
+        ZE_HANDLE_UNSAMPLED_API(RTASParallelOperation, pfnDestroyExpCb, context.zeDdiTable.RTASParallelOperationExp.pfnDestroyExp, hParallelOperation);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperationExp.pfnDestroyExp, hParallelOperation);
 
         // capture parameters
@@ -7336,12 +10532,26 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASParallelOperationExp.pfnDestroyExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phParallelOperation);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeMemGetPitchFor2dImage
+    template <>
+    struct APIRecordArgs<ze_mem_get_pitch_for2d_image_params_t>
+    {
+        static uint32_t get(const ze_mem_get_pitch_for2d_image_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->pimageWidth);
+            args[count++] = recordArg(*params->pimageHeight);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeMemGetPitchFor2dImage
     __zedlllocal ze_result_t ZE_APICALL
@@ -7359,6 +10569,10 @@ namespace tracing_layer
         if( nullptr == pfnGetPitchFor2dImage)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Mem, pfnGetPitchFor2dImageCb, context.zeDdiTable.Mem.pfnGetPitchFor2dImage, hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch);
+
+        ZE_HANDLE_UNSAMPLED_API(Mem, pfnGetPitchFor2dImageCb, context.zeDdiTable.Mem.pfnGetPitchFor2dImage, hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetPitchFor2dImage, hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch);
 
         // capture parameters
@@ -7378,9 +10592,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnGetPitchFor2dImage,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pimageWidth,
@@ -7389,6 +10601,19 @@ namespace tracing_layer
                                                   *tracerParams.prowPitch);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeImageGetDeviceOffsetExp
+    template <>
+    struct APIRecordArgs<ze_image_get_device_offset_exp_params_t>
+    {
+        static uint32_t get(const ze_image_get_device_offset_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phImage);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeImageGetDeviceOffsetExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -7402,6 +10627,10 @@ namespace tracing_layer
         if( nullptr == pfnGetDeviceOffsetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(Image, pfnGetDeviceOffsetExpCb, context.zeDdiTable.ImageExp.pfnGetDeviceOffsetExp, hImage, pDeviceOffset);
+
+        ZE_HANDLE_UNSAMPLED_API(Image, pfnGetDeviceOffsetExpCb, context.zeDdiTable.ImageExp.pfnGetDeviceOffsetExp, hImage, pDeviceOffset);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ImageExp.pfnGetDeviceOffsetExp, hImage, pDeviceOffset);
 
         // capture parameters
@@ -7417,13 +10646,32 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ImageExp.pfnGetDeviceOffsetExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phImage,
                                                   *tracerParams.ppDeviceOffset);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListCreateCloneExp
+    template <>
+    struct APIRecordArgs<ze_command_list_create_clone_exp_params_t>
+    {
+        static uint32_t get(const ze_command_list_create_clone_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zeCommandListCreateCloneExp
+    template <>
+    struct AsyncEpilogueOutArgs<ze_command_list_create_clone_exp_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 1);
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListCreateCloneExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -7437,6 +10685,10 @@ namespace tracing_layer
         if( nullptr == pfnCreateCloneExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnCreateCloneExpCb, context.zeDdiTable.CommandListExp.pfnCreateCloneExp, hCommandList, phClonedCommandList);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnCreateCloneExpCb, context.zeDdiTable.CommandListExp.pfnCreateCloneExp, hCommandList, phClonedCommandList);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnCreateCloneExp, hCommandList, phClonedCommandList);
 
         // capture parameters
@@ -7452,13 +10704,28 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnCreateCloneExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pphClonedCommandList);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zeCommandListImmediateAppendCommandListsExp
+    template <>
+    struct APIRecordArgs<ze_command_list_immediate_append_command_lists_exp_params_t>
+    {
+        static uint32_t get(const ze_command_list_immediate_append_command_lists_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandListImmediate);
+            args[count++] = recordArg(*params->pnumCommandLists);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            count = recordArgArray(*params->pnumWaitEvents, *params->pphWaitEvents, args, count);
+            return count;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeCommandListImmediateAppendCommandListsExp
     __zedlllocal ze_result_t ZE_APICALL
@@ -7482,6 +10749,10 @@ namespace tracing_layer
         if( nullptr == pfnImmediateAppendCommandListsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_UNARMED_API(CommandList, pfnImmediateAppendCommandListsExpCb, context.zeDdiTable.CommandListExp.pfnImmediateAppendCommandListsExp, hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(CommandList, pfnImmediateAppendCommandListsExpCb, context.zeDdiTable.CommandListExp.pfnImmediateAppendCommandListsExp, hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnImmediateAppendCommandListsExp, hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -7501,9 +10772,7 @@ namespace tracing_layer
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnImmediateAppendCommandListsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandListImmediate,
                                                   *tracerParams.pnumCommandLists,
                                                   *tracerParams.pphCommandLists,
@@ -7512,6 +10781,200 @@ namespace tracing_layer
                                                   *tracerParams.pphWaitEvents);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Names of the traced APIs and of their recorded arguments
+    const api_record_desc_t zeApiRecordDescs[] = {
+        {ZE_TRACER_API_INDEX(Global, pfnInitCb), "zeInit", ""},
+        {ZE_TRACER_API_INDEX(Driver, pfnGetCb), "zeDriverGet", ""},
+        {ZE_TRACER_API_INDEX(Global, pfnInitDriversCb), "zeInitDrivers", ""},
+        {ZE_TRACER_API_INDEX(Driver, pfnGetApiVersionCb), "zeDriverGetApiVersion", "hDriver"},
+        {ZE_TRACER_API_INDEX(Driver, pfnGetPropertiesCb), "zeDriverGetProperties", "hDriver"},
+        {ZE_TRACER_API_INDEX(Driver, pfnGetIpcPropertiesCb), "zeDriverGetIpcProperties", "hDriver"},
+        {ZE_TRACER_API_INDEX(Driver, pfnGetExtensionPropertiesCb), "zeDriverGetExtensionProperties", "hDriver"},
+        {ZE_TRACER_API_INDEX(Driver, pfnGetExtensionFunctionAddressCb), "zeDriverGetExtensionFunctionAddress", "hDriver"},
+        {ZE_TRACER_API_INDEX(Driver, pfnGetLastErrorDescriptionCb), "zeDriverGetLastErrorDescription", "hDriver"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetCb), "zeDeviceGet", "hDriver"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetRootDeviceCb), "zeDeviceGetRootDevice", "hDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetSubDevicesCb), "zeDeviceGetSubDevices", "hDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetPropertiesCb), "zeDeviceGetProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetComputePropertiesCb), "zeDeviceGetComputeProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetModulePropertiesCb), "zeDeviceGetModuleProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetCommandQueueGroupPropertiesCb), "zeDeviceGetCommandQueueGroupProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetMemoryPropertiesCb), "zeDeviceGetMemoryProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetMemoryAccessPropertiesCb), "zeDeviceGetMemoryAccessProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetCachePropertiesCb), "zeDeviceGetCacheProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetImagePropertiesCb), "zeDeviceGetImageProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetExternalMemoryPropertiesCb), "zeDeviceGetExternalMemoryProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetP2PPropertiesCb), "zeDeviceGetP2PProperties", "hDevice,hPeerDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnCanAccessPeerCb), "zeDeviceCanAccessPeer", "hDevice,hPeerDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetStatusCb), "zeDeviceGetStatus", "hDevice"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetGlobalTimestampsCb), "zeDeviceGetGlobalTimestamps", "hDevice"},
+        {ZE_TRACER_API_INDEX(Context, pfnCreateCb), "zeContextCreate", "hDriver"},
+        {ZE_TRACER_API_INDEX(Context, pfnCreateExCb), "zeContextCreateEx", "hDriver,numDevices"},
+        {ZE_TRACER_API_INDEX(Context, pfnDestroyCb), "zeContextDestroy", "hContext"},
+        {ZE_TRACER_API_INDEX(Context, pfnGetStatusCb), "zeContextGetStatus", "hContext"},
+        {ZE_TRACER_API_INDEX(CommandQueue, pfnCreateCb), "zeCommandQueueCreate", "hContext,hDevice"},
+        {ZE_TRACER_API_INDEX(CommandQueue, pfnDestroyCb), "zeCommandQueueDestroy", "hCommandQueue"},
+        {ZE_TRACER_API_INDEX(CommandQueue, pfnExecuteCommandListsCb), "zeCommandQueueExecuteCommandLists", "hCommandQueue,numCommandLists,hFence"},
+        {ZE_TRACER_API_INDEX(CommandQueue, pfnSynchronizeCb), "zeCommandQueueSynchronize", "hCommandQueue,timeout"},
+        {ZE_TRACER_API_INDEX(CommandQueue, pfnGetOrdinalCb), "zeCommandQueueGetOrdinal", "hCommandQueue"},
+        {ZE_TRACER_API_INDEX(CommandQueue, pfnGetIndexCb), "zeCommandQueueGetIndex", "hCommandQueue"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnCreateCb), "zeCommandListCreate", "hContext,hDevice"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnCreateImmediateCb), "zeCommandListCreateImmediate", "hContext,hDevice"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnDestroyCb), "zeCommandListDestroy", "hCommandList"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnCloseCb), "zeCommandListClose", "hCommandList"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnResetCb), "zeCommandListReset", "hCommandList"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendWriteGlobalTimestampCb), "zeCommandListAppendWriteGlobalTimestamp", "hCommandList,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnHostSynchronizeCb), "zeCommandListHostSynchronize", "hCommandList,timeout"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnGetDeviceHandleCb), "zeCommandListGetDeviceHandle", "hCommandList"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnGetContextHandleCb), "zeCommandListGetContextHandle", "hCommandList"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnGetOrdinalCb), "zeCommandListGetOrdinal", "hCommandList"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnImmediateGetIndexCb), "zeCommandListImmediateGetIndex", "hCommandListImmediate"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnIsImmediateCb), "zeCommandListIsImmediate", "hCommandList"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendBarrierCb), "zeCommandListAppendBarrier", "hCommandList,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryRangesBarrierCb), "zeCommandListAppendMemoryRangesBarrier", "hCommandList,numRanges,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(Context, pfnSystemBarrierCb), "zeContextSystemBarrier", "hContext,hDevice"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryCopyCb), "zeCommandListAppendMemoryCopy", "hCommandList,size,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryFillCb), "zeCommandListAppendMemoryFill", "hCommandList,pattern_size,size,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryCopyRegionCb), "zeCommandListAppendMemoryCopyRegion", "hCommandList,dstPitch,dstSlicePitch,srcPitch,srcSlicePitch,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryCopyFromContextCb), "zeCommandListAppendMemoryCopyFromContext", "hCommandList,hContextSrc,size,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyCb), "zeCommandListAppendImageCopy", "hCommandList,hDstImage,hSrcImage,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyRegionCb), "zeCommandListAppendImageCopyRegion", "hCommandList,hDstImage,hSrcImage,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyToMemoryCb), "zeCommandListAppendImageCopyToMemory", "hCommandList,hSrcImage,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyFromMemoryCb), "zeCommandListAppendImageCopyFromMemory", "hCommandList,hDstImage,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryPrefetchCb), "zeCommandListAppendMemoryPrefetch", "hCommandList,size"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendMemAdviseCb), "zeCommandListAppendMemAdvise", "hCommandList,hDevice,size"},
+        {ZE_TRACER_API_INDEX(EventPool, pfnCreateCb), "zeEventPoolCreate", "hContext,numDevices"},
+        {ZE_TRACER_API_INDEX(EventPool, pfnDestroyCb), "zeEventPoolDestroy", "hEventPool"},
+        {ZE_TRACER_API_INDEX(Event, pfnCreateCb), "zeEventCreate", "hEventPool"},
+        {ZE_TRACER_API_INDEX(Event, pfnDestroyCb), "zeEventDestroy", "hEvent"},
+        {ZE_TRACER_API_INDEX(EventPool, pfnGetIpcHandleCb), "zeEventPoolGetIpcHandle", "hEventPool"},
+        {ZE_TRACER_API_INDEX(EventPool, pfnPutIpcHandleCb), "zeEventPoolPutIpcHandle", "hContext"},
+        {ZE_TRACER_API_INDEX(EventPool, pfnOpenIpcHandleCb), "zeEventPoolOpenIpcHandle", "hContext"},
+        {ZE_TRACER_API_INDEX(EventPool, pfnCloseIpcHandleCb), "zeEventPoolCloseIpcHandle", "hEventPool"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendSignalEventCb), "zeCommandListAppendSignalEvent", "hCommandList,hEvent"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendWaitOnEventsCb), "zeCommandListAppendWaitOnEvents", "hCommandList,numEvents,phEvents"},
+        {ZE_TRACER_API_INDEX(Event, pfnHostSignalCb), "zeEventHostSignal", "hEvent"},
+        {ZE_TRACER_API_INDEX(Event, pfnHostSynchronizeCb), "zeEventHostSynchronize", "hEvent,timeout"},
+        {ZE_TRACER_API_INDEX(Event, pfnQueryStatusCb), "zeEventQueryStatus", "hEvent"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendEventResetCb), "zeCommandListAppendEventReset", "hCommandList,hEvent"},
+        {ZE_TRACER_API_INDEX(Event, pfnHostResetCb), "zeEventHostReset", "hEvent"},
+        {ZE_TRACER_API_INDEX(Event, pfnQueryKernelTimestampCb), "zeEventQueryKernelTimestamp", "hEvent"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendQueryKernelTimestampsCb), "zeCommandListAppendQueryKernelTimestamps", "hCommandList,numEvents,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(Event, pfnGetEventPoolCb), "zeEventGetEventPool", "hEvent"},
+        {ZE_TRACER_API_INDEX(Event, pfnGetSignalScopeCb), "zeEventGetSignalScope", "hEvent"},
+        {ZE_TRACER_API_INDEX(Event, pfnGetWaitScopeCb), "zeEventGetWaitScope", "hEvent"},
+        {ZE_TRACER_API_INDEX(EventPool, pfnGetContextHandleCb), "zeEventPoolGetContextHandle", "hEventPool"},
+        {ZE_TRACER_API_INDEX(EventPool, pfnGetFlagsCb), "zeEventPoolGetFlags", "hEventPool"},
+        {ZE_TRACER_API_INDEX(Fence, pfnCreateCb), "zeFenceCreate", "hCommandQueue"},
+        {ZE_TRACER_API_INDEX(Fence, pfnDestroyCb), "zeFenceDestroy", "hFence"},
+        {ZE_TRACER_API_INDEX(Fence, pfnHostSynchronizeCb), "zeFenceHostSynchronize", "hFence,timeout"},
+        {ZE_TRACER_API_INDEX(Fence, pfnQueryStatusCb), "zeFenceQueryStatus", "hFence"},
+        {ZE_TRACER_API_INDEX(Fence, pfnResetCb), "zeFenceReset", "hFence"},
+        {ZE_TRACER_API_INDEX(Image, pfnGetPropertiesCb), "zeImageGetProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Image, pfnCreateCb), "zeImageCreate", "hContext,hDevice"},
+        {ZE_TRACER_API_INDEX(Image, pfnDestroyCb), "zeImageDestroy", "hImage"},
+        {ZE_TRACER_API_INDEX(Mem, pfnAllocSharedCb), "zeMemAllocShared", "hContext,size,alignment,hDevice"},
+        {ZE_TRACER_API_INDEX(Mem, pfnAllocDeviceCb), "zeMemAllocDevice", "hContext,size,alignment,hDevice"},
+        {ZE_TRACER_API_INDEX(Mem, pfnAllocHostCb), "zeMemAllocHost", "hContext,size,alignment"},
+        {ZE_TRACER_API_INDEX(Mem, pfnFreeCb), "zeMemFree", "hContext"},
+        {ZE_TRACER_API_INDEX(Mem, pfnGetAllocPropertiesCb), "zeMemGetAllocProperties", "hContext"},
+        {ZE_TRACER_API_INDEX(Mem, pfnGetAddressRangeCb), "zeMemGetAddressRange", "hContext"},
+        {ZE_TRACER_API_INDEX(Mem, pfnGetIpcHandleCb), "zeMemGetIpcHandle", "hContext"},
+        {ZE_TRACER_API_INDEX(Mem, pfnGetIpcHandleFromFileDescriptorExpCb), "zeMemGetIpcHandleFromFileDescriptorExp", "hContext,handle"},
+        {ZE_TRACER_API_INDEX(Mem, pfnGetFileDescriptorFromIpcHandleExpCb), "zeMemGetFileDescriptorFromIpcHandleExp", "hContext"},
+        {ZE_TRACER_API_INDEX(Mem, pfnPutIpcHandleCb), "zeMemPutIpcHandle", "hContext"},
+        {ZE_TRACER_API_INDEX(Mem, pfnOpenIpcHandleCb), "zeMemOpenIpcHandle", "hContext,hDevice"},
+        {ZE_TRACER_API_INDEX(Mem, pfnCloseIpcHandleCb), "zeMemCloseIpcHandle", "hContext"},
+        {ZE_TRACER_API_INDEX(Mem, pfnSetAtomicAccessAttributeExpCb), "zeMemSetAtomicAccessAttributeExp", "hContext,hDevice,size"},
+        {ZE_TRACER_API_INDEX(Mem, pfnGetAtomicAccessAttributeExpCb), "zeMemGetAtomicAccessAttributeExp", "hContext,hDevice,size"},
+        {ZE_TRACER_API_INDEX(Module, pfnCreateCb), "zeModuleCreate", "hContext,hDevice"},
+        {ZE_TRACER_API_INDEX(Module, pfnDestroyCb), "zeModuleDestroy", "hModule"},
+        {ZE_TRACER_API_INDEX(Module, pfnDynamicLinkCb), "zeModuleDynamicLink", "numModules"},
+        {ZE_TRACER_API_INDEX(ModuleBuildLog, pfnDestroyCb), "zeModuleBuildLogDestroy", "hModuleBuildLog"},
+        {ZE_TRACER_API_INDEX(ModuleBuildLog, pfnGetStringCb), "zeModuleBuildLogGetString", "hModuleBuildLog"},
+        {ZE_TRACER_API_INDEX(Module, pfnGetNativeBinaryCb), "zeModuleGetNativeBinary", "hModule"},
+        {ZE_TRACER_API_INDEX(Module, pfnGetGlobalPointerCb), "zeModuleGetGlobalPointer", "hModule"},
+        {ZE_TRACER_API_INDEX(Module, pfnGetKernelNamesCb), "zeModuleGetKernelNames", "hModule"},
+        {ZE_TRACER_API_INDEX(Module, pfnGetPropertiesCb), "zeModuleGetProperties", "hModule"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnCreateCb), "zeKernelCreate", "hModule"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnDestroyCb), "zeKernelDestroy", "hKernel"},
+        {ZE_TRACER_API_INDEX(Module, pfnGetFunctionPointerCb), "zeModuleGetFunctionPointer", "hModule"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnSetGroupSizeCb), "zeKernelSetGroupSize", "hKernel,groupSizeX,groupSizeY,groupSizeZ"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnSuggestGroupSizeCb), "zeKernelSuggestGroupSize", "hKernel,globalSizeX,globalSizeY,globalSizeZ"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnSuggestMaxCooperativeGroupCountCb), "zeKernelSuggestMaxCooperativeGroupCount", "hKernel"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnSetArgumentValueCb), "zeKernelSetArgumentValue", "hKernel,argIndex,argSize"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnSetIndirectAccessCb), "zeKernelSetIndirectAccess", "hKernel"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnGetIndirectAccessCb), "zeKernelGetIndirectAccess", "hKernel"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnGetSourceAttributesCb), "zeKernelGetSourceAttributes", "hKernel"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnSetCacheConfigCb), "zeKernelSetCacheConfig", "hKernel"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnGetPropertiesCb), "zeKernelGetProperties", "hKernel"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnGetNameCb), "zeKernelGetName", "hKernel"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendLaunchKernelCb), "zeCommandListAppendLaunchKernel", "hCommandList,hKernel,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendLaunchCooperativeKernelCb), "zeCommandListAppendLaunchCooperativeKernel", "hCommandList,hKernel,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendLaunchKernelIndirectCb), "zeCommandListAppendLaunchKernelIndirect", "hCommandList,hKernel,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendLaunchMultipleKernelsIndirectCb), "zeCommandListAppendLaunchMultipleKernelsIndirect", "hCommandList,numKernels,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(Context, pfnMakeMemoryResidentCb), "zeContextMakeMemoryResident", "hContext,hDevice,size"},
+        {ZE_TRACER_API_INDEX(Context, pfnEvictMemoryCb), "zeContextEvictMemory", "hContext,hDevice,size"},
+        {ZE_TRACER_API_INDEX(Context, pfnMakeImageResidentCb), "zeContextMakeImageResident", "hContext,hDevice,hImage"},
+        {ZE_TRACER_API_INDEX(Context, pfnEvictImageCb), "zeContextEvictImage", "hContext,hDevice,hImage"},
+        {ZE_TRACER_API_INDEX(Sampler, pfnCreateCb), "zeSamplerCreate", "hContext,hDevice"},
+        {ZE_TRACER_API_INDEX(Sampler, pfnDestroyCb), "zeSamplerDestroy", "hSampler"},
+        {ZE_TRACER_API_INDEX(VirtualMem, pfnReserveCb), "zeVirtualMemReserve", "hContext,size"},
+        {ZE_TRACER_API_INDEX(VirtualMem, pfnFreeCb), "zeVirtualMemFree", "hContext,size"},
+        {ZE_TRACER_API_INDEX(VirtualMem, pfnQueryPageSizeCb), "zeVirtualMemQueryPageSize", "hContext,hDevice,size"},
+        {ZE_TRACER_API_INDEX(PhysicalMem, pfnCreateCb), "zePhysicalMemCreate", "hContext,hDevice"},
+        {ZE_TRACER_API_INDEX(PhysicalMem, pfnDestroyCb), "zePhysicalMemDestroy", "hContext,hPhysicalMemory"},
+        {ZE_TRACER_API_INDEX(VirtualMem, pfnMapCb), "zeVirtualMemMap", "hContext,size,hPhysicalMemory,offset"},
+        {ZE_TRACER_API_INDEX(VirtualMem, pfnUnmapCb), "zeVirtualMemUnmap", "hContext,size"},
+        {ZE_TRACER_API_INDEX(VirtualMem, pfnSetAccessAttributeCb), "zeVirtualMemSetAccessAttribute", "hContext,size"},
+        {ZE_TRACER_API_INDEX(VirtualMem, pfnGetAccessAttributeCb), "zeVirtualMemGetAccessAttribute", "hContext,size"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnSetGlobalOffsetExpCb), "zeKernelSetGlobalOffsetExp", "hKernel,offsetX,offsetY,offsetZ"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnGetNextCommandIdExpCb), "zeCommandListGetNextCommandIdExp", "hCommandList"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnGetNextCommandIdWithKernelsExpCb), "zeCommandListGetNextCommandIdWithKernelsExp", "hCommandList,numKernels"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnUpdateMutableCommandsExpCb), "zeCommandListUpdateMutableCommandsExp", "hCommandList"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnUpdateMutableCommandSignalEventExpCb), "zeCommandListUpdateMutableCommandSignalEventExp", "hCommandList,commandId,hSignalEvent"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnUpdateMutableCommandWaitEventsExpCb), "zeCommandListUpdateMutableCommandWaitEventsExp", "hCommandList,commandId,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnUpdateMutableCommandKernelsExpCb), "zeCommandListUpdateMutableCommandKernelsExp", "hCommandList,numKernels"},
+        {ZE_TRACER_API_INDEX(Device, pfnReserveCacheExtCb), "zeDeviceReserveCacheExt", "hDevice,cacheLevel,cacheReservationSize"},
+        {ZE_TRACER_API_INDEX(Device, pfnSetCacheAdviceExtCb), "zeDeviceSetCacheAdviceExt", "hDevice,regionSize"},
+        {ZE_TRACER_API_INDEX(Event, pfnQueryTimestampsExpCb), "zeEventQueryTimestampsExp", "hEvent,hDevice"},
+        {ZE_TRACER_API_INDEX(Image, pfnGetMemoryPropertiesExpCb), "zeImageGetMemoryPropertiesExp", "hImage"},
+        {ZE_TRACER_API_INDEX(Image, pfnViewCreateExtCb), "zeImageViewCreateExt", "hContext,hDevice,hImage"},
+        {ZE_TRACER_API_INDEX(Image, pfnViewCreateExpCb), "zeImageViewCreateExp", "hContext,hDevice,hImage"},
+        {ZE_TRACER_API_INDEX(Kernel, pfnSchedulingHintExpCb), "zeKernelSchedulingHintExp", "hKernel"},
+        {ZE_TRACER_API_INDEX(Device, pfnPciGetPropertiesExtCb), "zeDevicePciGetPropertiesExt", "hDevice"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyToMemoryExtCb), "zeCommandListAppendImageCopyToMemoryExt", "hCommandList,hSrcImage,destRowPitch,destSlicePitch,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyFromMemoryExtCb), "zeCommandListAppendImageCopyFromMemoryExt", "hCommandList,hDstImage,srcRowPitch,srcSlicePitch,hSignalEvent,numWaitEvents,phWaitEvents"},
+        {ZE_TRACER_API_INDEX(Image, pfnGetAllocPropertiesExtCb), "zeImageGetAllocPropertiesExt", "hContext,hImage"},
+        {ZE_TRACER_API_INDEX(Module, pfnInspectLinkageExtCb), "zeModuleInspectLinkageExt", "numModules"},
+        {ZE_TRACER_API_INDEX(Mem, pfnFreeExtCb), "zeMemFreeExt", "hContext"},
+        {ZE_TRACER_API_INDEX(FabricVertex, pfnGetExpCb), "zeFabricVertexGetExp", "hDriver"},
+        {ZE_TRACER_API_INDEX(FabricVertex, pfnGetSubVerticesExpCb), "zeFabricVertexGetSubVerticesExp", "hVertex"},
+        {ZE_TRACER_API_INDEX(FabricVertex, pfnGetPropertiesExpCb), "zeFabricVertexGetPropertiesExp", "hVertex"},
+        {ZE_TRACER_API_INDEX(FabricVertex, pfnGetDeviceExpCb), "zeFabricVertexGetDeviceExp", "hVertex"},
+        {ZE_TRACER_API_INDEX(Device, pfnGetFabricVertexExpCb), "zeDeviceGetFabricVertexExp", "hDevice"},
+        {ZE_TRACER_API_INDEX(FabricEdge, pfnGetExpCb), "zeFabricEdgeGetExp", "hVertexA,hVertexB"},
+        {ZE_TRACER_API_INDEX(FabricEdge, pfnGetVerticesExpCb), "zeFabricEdgeGetVerticesExp", "hEdge"},
+        {ZE_TRACER_API_INDEX(FabricEdge, pfnGetPropertiesExpCb), "zeFabricEdgeGetPropertiesExp", "hEdge"},
+        {ZE_TRACER_API_INDEX(Event, pfnQueryKernelTimestampsExtCb), "zeEventQueryKernelTimestampsExt", "hEvent,hDevice"},
+        {ZE_TRACER_API_INDEX(RTASBuilder, pfnCreateExpCb), "zeRTASBuilderCreateExp", "hDriver"},
+        {ZE_TRACER_API_INDEX(RTASBuilder, pfnGetBuildPropertiesExpCb), "zeRTASBuilderGetBuildPropertiesExp", "hBuilder"},
+        {ZE_TRACER_API_INDEX(Driver, pfnRTASFormatCompatibilityCheckExpCb), "zeDriverRTASFormatCompatibilityCheckExp", "hDriver"},
+        {ZE_TRACER_API_INDEX(RTASBuilder, pfnBuildExpCb), "zeRTASBuilderBuildExp", "hBuilder,scratchBufferSizeBytes,rtasBufferSizeBytes,hParallelOperation"},
+        {ZE_TRACER_API_INDEX(RTASBuilder, pfnDestroyExpCb), "zeRTASBuilderDestroyExp", "hBuilder"},
+        {ZE_TRACER_API_INDEX(RTASParallelOperation, pfnCreateExpCb), "zeRTASParallelOperationCreateExp", "hDriver"},
+        {ZE_TRACER_API_INDEX(RTASParallelOperation, pfnGetPropertiesExpCb), "zeRTASParallelOperationGetPropertiesExp", "hParallelOperation"},
+        {ZE_TRACER_API_INDEX(RTASParallelOperation, pfnJoinExpCb), "zeRTASParallelOperationJoinExp", "hParallelOperation"},
+        {ZE_TRACER_API_INDEX(RTASParallelOperation, pfnDestroyExpCb), "zeRTASParallelOperationDestroyExp", "hParallelOperation"},
+        {ZE_TRACER_API_INDEX(Mem, pfnGetPitchFor2dImageCb), "zeMemGetPitchFor2dImage", "hContext,hDevice,imageWidth,imageHeight"},
+        {ZE_TRACER_API_INDEX(Image, pfnGetDeviceOffsetExpCb), "zeImageGetDeviceOffsetExp", "hImage"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnCreateCloneExpCb), "zeCommandListCreateCloneExp", "hCommandList"},
+        {ZE_TRACER_API_INDEX(CommandList, pfnImmediateAppendCommandListsExpCb), "zeCommandListImmediateAppendCommandListsExp", "hCommandListImmediate,numCommandLists,hSignalEvent,numWaitEvents,phWaitEvents"},
+    };
+
+    const size_t zeApiRecordDescCount = sizeof(zeApiRecordDescs) / sizeof(zeApiRecordDescs[0]);
+
 } // namespace tracing_layer
 
 #if defined(__cplusplus)
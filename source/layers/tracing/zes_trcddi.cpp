@@ -0,0 +1,8113 @@
+/*
+ *
+ * Copyright (C) 2020-2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zes_trcddi.cpp
+ *
+ */
+
+#include <iostream>
+#include "ze_tracing_layer.h"
+
+
+namespace tracing_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesInit
+    template <>
+    struct APIRecordArgs<zes_init_params_t>
+    {
+        static uint32_t get(const zes_init_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesInit
+    __zedlllocal ze_result_t ZE_APICALL
+    zesInit(
+        zes_init_flags_t flags                          ///< [in] initialization flags.
+                                                        ///< currently unused, must be 0 (default).
+        )
+    {
+        auto pfnInit = context.zesDdiTable.Global.pfnInit;
+
+        if( nullptr == pfnInit)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Global, pfnInitCb, context.zesDdiTable.Global.pfnInit, flags);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Global, pfnInitCb, context.zesDdiTable.Global.pfnInit, flags);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Global.pfnInit, flags);
+
+        // capture parameters
+        zes_init_params_t tracerParams = {
+            &flags
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnInitCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnInitCb_t, Sysman.Global, pfnInitCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Global.pfnInit,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.pflags);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDriverGet
+    template <>
+    struct APIRecordArgs<zes_driver_get_params_t>
+    {
+        static uint32_t get(const zes_driver_get_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDriverGet
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDriverGet(
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of sysman driver instances.
+                                                        ///< if count is zero, then the loader shall update the value with the
+                                                        ///< total number of sysman drivers available.
+                                                        ///< if count is greater than the number of sysman drivers available, then
+                                                        ///< the loader shall update the value with the correct number of sysman
+                                                        ///< drivers available.
+        zes_driver_handle_t* phDrivers                  ///< [in,out][optional][range(0, *pCount)] array of sysman driver instance handles.
+                                                        ///< if count is less than the number of sysman drivers available, then the
+                                                        ///< loader shall only retrieve that number of sysman drivers.
+        )
+    {
+        auto pfnGet = context.zesDdiTable.Driver.pfnGet;
+
+        if( nullptr == pfnGet)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Driver, pfnGetCb, context.zesDdiTable.Driver.pfnGet, pCount, phDrivers);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Driver, pfnGetCb, context.zesDdiTable.Driver.pfnGet, pCount, phDrivers);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Driver.pfnGet, pCount, phDrivers);
+
+        // capture parameters
+        zes_driver_get_params_t tracerParams = {
+            &pCount,
+            &phDrivers
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDriverGetCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDriverGetCb_t, Sysman.Driver, pfnGetCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Driver.pfnGet,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphDrivers);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceGet
+    template <>
+    struct APIRecordArgs<zes_device_get_params_t>
+    {
+        static uint32_t get(const zes_device_get_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceGet
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceGet(
+        zes_driver_handle_t hDriver,                    ///< [in] handle of the sysman driver instance
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of sysman devices.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of sysman devices available.
+                                                        ///< if count is greater than the number of sysman devices available, then
+                                                        ///< the driver shall update the value with the correct number of sysman
+                                                        ///< devices available.
+        zes_device_handle_t* phDevices                  ///< [in,out][optional][range(0, *pCount)] array of handle of sysman devices.
+                                                        ///< if count is less than the number of sysman devices available, then
+                                                        ///< driver shall only retrieve that number of sysman devices.
+        )
+    {
+        auto pfnGet = context.zesDdiTable.Device.pfnGet;
+
+        if( nullptr == pfnGet)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnGetCb, context.zesDdiTable.Device.pfnGet, hDriver, pCount, phDevices);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnGetCb, context.zesDdiTable.Device.pfnGet, hDriver, pCount, phDevices);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnGet, hDriver, pCount, phDevices);
+
+        // capture parameters
+        zes_device_get_params_t tracerParams = {
+            &hDriver,
+            &pCount,
+            &phDevices
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceGetCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceGetCb_t, Sysman.Device, pfnGetCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnGet,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDriver,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphDevices);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceGetProperties
+    template <>
+    struct APIRecordArgs<zes_device_get_properties_params_t>
+    {
+        static uint32_t get(const zes_device_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceGetProperties(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        zes_device_properties_t* pProperties            ///< [in,out] Structure that will contain information about the device.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Device.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnGetPropertiesCb, context.zesDdiTable.Device.pfnGetProperties, hDevice, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnGetPropertiesCb, context.zesDdiTable.Device.pfnGetProperties, hDevice, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnGetProperties, hDevice, pProperties);
+
+        // capture parameters
+        zes_device_get_properties_params_t tracerParams = {
+            &hDevice,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceGetPropertiesCb_t, Sysman.Device, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceGetState
+    template <>
+    struct APIRecordArgs<zes_device_get_state_params_t>
+    {
+        static uint32_t get(const zes_device_get_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceGetState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceGetState(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        zes_device_state_t* pState                      ///< [in,out] Structure that will contain information about the device.
+        )
+    {
+        auto pfnGetState = context.zesDdiTable.Device.pfnGetState;
+
+        if( nullptr == pfnGetState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnGetStateCb, context.zesDdiTable.Device.pfnGetState, hDevice, pState);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnGetStateCb, context.zesDdiTable.Device.pfnGetState, hDevice, pState);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnGetState, hDevice, pState);
+
+        // capture parameters
+        zes_device_get_state_params_t tracerParams = {
+            &hDevice,
+            &pState
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceGetStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceGetStateCb_t, Sysman.Device, pfnGetStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnGetState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppState);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceReset
+    template <>
+    struct APIRecordArgs<zes_device_reset_params_t>
+    {
+        static uint32_t get(const zes_device_reset_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceReset
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceReset(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle for the device
+        ze_bool_t force                                 ///< [in] If set to true, all applications that are currently using the
+                                                        ///< device will be forcibly killed.
+        )
+    {
+        auto pfnReset = context.zesDdiTable.Device.pfnReset;
+
+        if( nullptr == pfnReset)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnResetCb, context.zesDdiTable.Device.pfnReset, hDevice, force);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnResetCb, context.zesDdiTable.Device.pfnReset, hDevice, force);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnReset, hDevice, force);
+
+        // capture parameters
+        zes_device_reset_params_t tracerParams = {
+            &hDevice,
+            &force
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceResetCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceResetCb_t, Sysman.Device, pfnResetCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnReset,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.pforce);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceResetExt
+    template <>
+    struct APIRecordArgs<zes_device_reset_ext_params_t>
+    {
+        static uint32_t get(const zes_device_reset_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceResetExt
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceResetExt(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle for the device
+        zes_reset_properties_t* pProperties             ///< [in] Device reset properties to apply
+        )
+    {
+        auto pfnResetExt = context.zesDdiTable.Device.pfnResetExt;
+
+        if( nullptr == pfnResetExt)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnResetExtCb, context.zesDdiTable.Device.pfnResetExt, hDevice, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnResetExtCb, context.zesDdiTable.Device.pfnResetExt, hDevice, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnResetExt, hDevice, pProperties);
+
+        // capture parameters
+        zes_device_reset_ext_params_t tracerParams = {
+            &hDevice,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceResetExtCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceResetExtCb_t, Sysman.Device, pfnResetExtCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnResetExt,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceProcessesGetState
+    template <>
+    struct APIRecordArgs<zes_device_processes_get_state_params_t>
+    {
+        static uint32_t get(const zes_device_processes_get_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceProcessesGetState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceProcessesGetState(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle for the device
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of processes.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of processes currently attached to the device.
+                                                        ///< if count is greater than the number of processes currently attached to
+                                                        ///< the device, then the driver shall update the value with the correct
+                                                        ///< number of processes.
+        zes_process_state_t* pProcesses                 ///< [in,out][optional][range(0, *pCount)] array of process information.
+                                                        ///< if count is less than the number of processes currently attached to
+                                                        ///< the device, then the driver shall only retrieve information about that
+                                                        ///< number of processes. In this case, the return code will ::ZE_RESULT_ERROR_INVALID_SIZE.
+        )
+    {
+        auto pfnProcessesGetState = context.zesDdiTable.Device.pfnProcessesGetState;
+
+        if( nullptr == pfnProcessesGetState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnProcessesGetStateCb, context.zesDdiTable.Device.pfnProcessesGetState, hDevice, pCount, pProcesses);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnProcessesGetStateCb, context.zesDdiTable.Device.pfnProcessesGetState, hDevice, pCount, pProcesses);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnProcessesGetState, hDevice, pCount, pProcesses);
+
+        // capture parameters
+        zes_device_processes_get_state_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &pProcesses
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceProcessesGetStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceProcessesGetStateCb_t, Sysman.Device, pfnProcessesGetStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnProcessesGetState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.ppProcesses);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDevicePciGetProperties
+    template <>
+    struct APIRecordArgs<zes_device_pci_get_properties_params_t>
+    {
+        static uint32_t get(const zes_device_pci_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDevicePciGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDevicePciGetProperties(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        zes_pci_properties_t* pProperties               ///< [in,out] Will contain the PCI properties.
+        )
+    {
+        auto pfnPciGetProperties = context.zesDdiTable.Device.pfnPciGetProperties;
+
+        if( nullptr == pfnPciGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnPciGetPropertiesCb, context.zesDdiTable.Device.pfnPciGetProperties, hDevice, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnPciGetPropertiesCb, context.zesDdiTable.Device.pfnPciGetProperties, hDevice, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnPciGetProperties, hDevice, pProperties);
+
+        // capture parameters
+        zes_device_pci_get_properties_params_t tracerParams = {
+            &hDevice,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDevicePciGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDevicePciGetPropertiesCb_t, Sysman.Device, pfnPciGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnPciGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDevicePciGetState
+    template <>
+    struct APIRecordArgs<zes_device_pci_get_state_params_t>
+    {
+        static uint32_t get(const zes_device_pci_get_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDevicePciGetState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDevicePciGetState(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        zes_pci_state_t* pState                         ///< [in,out] Will contain the PCI properties.
+        )
+    {
+        auto pfnPciGetState = context.zesDdiTable.Device.pfnPciGetState;
+
+        if( nullptr == pfnPciGetState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnPciGetStateCb, context.zesDdiTable.Device.pfnPciGetState, hDevice, pState);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnPciGetStateCb, context.zesDdiTable.Device.pfnPciGetState, hDevice, pState);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnPciGetState, hDevice, pState);
+
+        // capture parameters
+        zes_device_pci_get_state_params_t tracerParams = {
+            &hDevice,
+            &pState
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDevicePciGetStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDevicePciGetStateCb_t, Sysman.Device, pfnPciGetStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnPciGetState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppState);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDevicePciGetBars
+    template <>
+    struct APIRecordArgs<zes_device_pci_get_bars_params_t>
+    {
+        static uint32_t get(const zes_device_pci_get_bars_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDevicePciGetBars
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDevicePciGetBars(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of PCI bars.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of PCI bars that are setup.
+                                                        ///< if count is greater than the number of PCI bars that are setup, then
+                                                        ///< the driver shall update the value with the correct number of PCI bars.
+        zes_pci_bar_properties_t* pProperties           ///< [in,out][optional][range(0, *pCount)] array of information about setup
+                                                        ///< PCI bars.
+                                                        ///< if count is less than the number of PCI bars that are setup, then the
+                                                        ///< driver shall only retrieve information about that number of PCI bars.
+        )
+    {
+        auto pfnPciGetBars = context.zesDdiTable.Device.pfnPciGetBars;
+
+        if( nullptr == pfnPciGetBars)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnPciGetBarsCb, context.zesDdiTable.Device.pfnPciGetBars, hDevice, pCount, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnPciGetBarsCb, context.zesDdiTable.Device.pfnPciGetBars, hDevice, pCount, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnPciGetBars, hDevice, pCount, pProperties);
+
+        // capture parameters
+        zes_device_pci_get_bars_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDevicePciGetBarsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDevicePciGetBarsCb_t, Sysman.Device, pfnPciGetBarsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnPciGetBars,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDevicePciGetStats
+    template <>
+    struct APIRecordArgs<zes_device_pci_get_stats_params_t>
+    {
+        static uint32_t get(const zes_device_pci_get_stats_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDevicePciGetStats
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDevicePciGetStats(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        zes_pci_stats_t* pStats                         ///< [in,out] Will contain a snapshot of the latest stats.
+        )
+    {
+        auto pfnPciGetStats = context.zesDdiTable.Device.pfnPciGetStats;
+
+        if( nullptr == pfnPciGetStats)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnPciGetStatsCb, context.zesDdiTable.Device.pfnPciGetStats, hDevice, pStats);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnPciGetStatsCb, context.zesDdiTable.Device.pfnPciGetStats, hDevice, pStats);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnPciGetStats, hDevice, pStats);
+
+        // capture parameters
+        zes_device_pci_get_stats_params_t tracerParams = {
+            &hDevice,
+            &pStats
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDevicePciGetStatsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDevicePciGetStatsCb_t, Sysman.Device, pfnPciGetStatsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnPciGetStats,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppStats);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceSetOverclockWaiver
+    template <>
+    struct APIRecordArgs<zes_device_set_overclock_waiver_params_t>
+    {
+        static uint32_t get(const zes_device_set_overclock_waiver_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceSetOverclockWaiver
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceSetOverclockWaiver(
+        zes_device_handle_t hDevice                     ///< [in] Sysman handle of the device.
+        )
+    {
+        auto pfnSetOverclockWaiver = context.zesDdiTable.Device.pfnSetOverclockWaiver;
+
+        if( nullptr == pfnSetOverclockWaiver)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnSetOverclockWaiverCb, context.zesDdiTable.Device.pfnSetOverclockWaiver, hDevice);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnSetOverclockWaiverCb, context.zesDdiTable.Device.pfnSetOverclockWaiver, hDevice);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnSetOverclockWaiver, hDevice);
+
+        // capture parameters
+        zes_device_set_overclock_waiver_params_t tracerParams = {
+            &hDevice
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceSetOverclockWaiverCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceSetOverclockWaiverCb_t, Sysman.Device, pfnSetOverclockWaiverCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnSetOverclockWaiver,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceGetOverclockDomains
+    template <>
+    struct APIRecordArgs<zes_device_get_overclock_domains_params_t>
+    {
+        static uint32_t get(const zes_device_get_overclock_domains_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceGetOverclockDomains
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceGetOverclockDomains(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pOverclockDomains                     ///< [in,out] Returns the overclock domains that are supported (a bit for
+                                                        ///< each of enum ::zes_overclock_domain_t). If no bits are set, the device
+                                                        ///< doesn't support overclocking.
+        )
+    {
+        auto pfnGetOverclockDomains = context.zesDdiTable.Device.pfnGetOverclockDomains;
+
+        if( nullptr == pfnGetOverclockDomains)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnGetOverclockDomainsCb, context.zesDdiTable.Device.pfnGetOverclockDomains, hDevice, pOverclockDomains);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnGetOverclockDomainsCb, context.zesDdiTable.Device.pfnGetOverclockDomains, hDevice, pOverclockDomains);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnGetOverclockDomains, hDevice, pOverclockDomains);
+
+        // capture parameters
+        zes_device_get_overclock_domains_params_t tracerParams = {
+            &hDevice,
+            &pOverclockDomains
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceGetOverclockDomainsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceGetOverclockDomainsCb_t, Sysman.Device, pfnGetOverclockDomainsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnGetOverclockDomains,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppOverclockDomains);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceGetOverclockControls
+    template <>
+    struct APIRecordArgs<zes_device_get_overclock_controls_params_t>
+    {
+        static uint32_t get(const zes_device_get_overclock_controls_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceGetOverclockControls
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceGetOverclockControls(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        zes_overclock_domain_t domainType,              ///< [in] Domain type.
+        uint32_t* pAvailableControls                    ///< [in,out] Returns the overclock controls that are supported for the
+                                                        ///< specified overclock domain (a bit for each of enum
+                                                        ///< ::zes_overclock_control_t).
+        )
+    {
+        auto pfnGetOverclockControls = context.zesDdiTable.Device.pfnGetOverclockControls;
+
+        if( nullptr == pfnGetOverclockControls)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnGetOverclockControlsCb, context.zesDdiTable.Device.pfnGetOverclockControls, hDevice, domainType, pAvailableControls);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnGetOverclockControlsCb, context.zesDdiTable.Device.pfnGetOverclockControls, hDevice, domainType, pAvailableControls);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnGetOverclockControls, hDevice, domainType, pAvailableControls);
+
+        // capture parameters
+        zes_device_get_overclock_controls_params_t tracerParams = {
+            &hDevice,
+            &domainType,
+            &pAvailableControls
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceGetOverclockControlsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceGetOverclockControlsCb_t, Sysman.Device, pfnGetOverclockControlsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnGetOverclockControls,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.pdomainType,
+                                                  *tracerParams.ppAvailableControls);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceResetOverclockSettings
+    template <>
+    struct APIRecordArgs<zes_device_reset_overclock_settings_params_t>
+    {
+        static uint32_t get(const zes_device_reset_overclock_settings_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceResetOverclockSettings
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceResetOverclockSettings(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        ze_bool_t onShippedState                        ///< [in] True will reset to shipped state; false will reset to
+                                                        ///< manufacturing state
+        )
+    {
+        auto pfnResetOverclockSettings = context.zesDdiTable.Device.pfnResetOverclockSettings;
+
+        if( nullptr == pfnResetOverclockSettings)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnResetOverclockSettingsCb, context.zesDdiTable.Device.pfnResetOverclockSettings, hDevice, onShippedState);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnResetOverclockSettingsCb, context.zesDdiTable.Device.pfnResetOverclockSettings, hDevice, onShippedState);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnResetOverclockSettings, hDevice, onShippedState);
+
+        // capture parameters
+        zes_device_reset_overclock_settings_params_t tracerParams = {
+            &hDevice,
+            &onShippedState
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceResetOverclockSettingsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceResetOverclockSettingsCb_t, Sysman.Device, pfnResetOverclockSettingsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnResetOverclockSettings,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ponShippedState);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceReadOverclockState
+    template <>
+    struct APIRecordArgs<zes_device_read_overclock_state_params_t>
+    {
+        static uint32_t get(const zes_device_read_overclock_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceReadOverclockState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceReadOverclockState(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        zes_overclock_mode_t* pOverclockMode,           ///< [out] One of overclock mode.
+        ze_bool_t* pWaiverSetting,                      ///< [out] Waiver setting: 0 = Waiver not set, 1 = waiver has been set.
+        ze_bool_t* pOverclockState,                     ///< [out] Current settings 0 =manufacturing state, 1= shipped state)..
+        zes_pending_action_t* pPendingAction,           ///< [out] This enum is returned when the driver attempts to set an
+                                                        ///< overclock control or reset overclock settings.
+        ze_bool_t* pPendingReset                        ///< [out] Pending reset 0 =manufacturing state, 1= shipped state)..
+        )
+    {
+        auto pfnReadOverclockState = context.zesDdiTable.Device.pfnReadOverclockState;
+
+        if( nullptr == pfnReadOverclockState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnReadOverclockStateCb, context.zesDdiTable.Device.pfnReadOverclockState, hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnReadOverclockStateCb, context.zesDdiTable.Device.pfnReadOverclockState, hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnReadOverclockState, hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset);
+
+        // capture parameters
+        zes_device_read_overclock_state_params_t tracerParams = {
+            &hDevice,
+            &pOverclockMode,
+            &pWaiverSetting,
+            &pOverclockState,
+            &pPendingAction,
+            &pPendingReset
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceReadOverclockStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceReadOverclockStateCb_t, Sysman.Device, pfnReadOverclockStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnReadOverclockState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppOverclockMode,
+                                                  *tracerParams.ppWaiverSetting,
+                                                  *tracerParams.ppOverclockState,
+                                                  *tracerParams.ppPendingAction,
+                                                  *tracerParams.ppPendingReset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumOverclockDomains
+    template <>
+    struct APIRecordArgs<zes_device_enum_overclock_domains_params_t>
+    {
+        static uint32_t get(const zes_device_enum_overclock_domains_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumOverclockDomains
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumOverclockDomains(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_overclock_handle_t* phDomainHandle          ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumOverclockDomains = context.zesDdiTable.Device.pfnEnumOverclockDomains;
+
+        if( nullptr == pfnEnumOverclockDomains)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumOverclockDomainsCb, context.zesDdiTable.Device.pfnEnumOverclockDomains, hDevice, pCount, phDomainHandle);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumOverclockDomainsCb, context.zesDdiTable.Device.pfnEnumOverclockDomains, hDevice, pCount, phDomainHandle);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumOverclockDomains, hDevice, pCount, phDomainHandle);
+
+        // capture parameters
+        zes_device_enum_overclock_domains_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phDomainHandle
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumOverclockDomainsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumOverclockDomainsCb_t, Sysman.Device, pfnEnumOverclockDomainsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumOverclockDomains,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphDomainHandle);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesOverclockGetDomainProperties
+    template <>
+    struct APIRecordArgs<zes_overclock_get_domain_properties_params_t>
+    {
+        static uint32_t get(const zes_overclock_get_domain_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDomainHandle);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesOverclockGetDomainProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesOverclockGetDomainProperties(
+        zes_overclock_handle_t hDomainHandle,           ///< [in] Handle for the component domain.
+        zes_overclock_properties_t* pDomainProperties   ///< [in,out] The overclock properties for the specified domain.
+        )
+    {
+        auto pfnGetDomainProperties = context.zesDdiTable.Overclock.pfnGetDomainProperties;
+
+        if( nullptr == pfnGetDomainProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Overclock, pfnGetDomainPropertiesCb, context.zesDdiTable.Overclock.pfnGetDomainProperties, hDomainHandle, pDomainProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Overclock, pfnGetDomainPropertiesCb, context.zesDdiTable.Overclock.pfnGetDomainProperties, hDomainHandle, pDomainProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Overclock.pfnGetDomainProperties, hDomainHandle, pDomainProperties);
+
+        // capture parameters
+        zes_overclock_get_domain_properties_params_t tracerParams = {
+            &hDomainHandle,
+            &pDomainProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnOverclockGetDomainPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnOverclockGetDomainPropertiesCb_t, Sysman.Overclock, pfnGetDomainPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Overclock.pfnGetDomainProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDomainHandle,
+                                                  *tracerParams.ppDomainProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesOverclockGetDomainVFProperties
+    template <>
+    struct APIRecordArgs<zes_overclock_get_domain_vf_properties_params_t>
+    {
+        static uint32_t get(const zes_overclock_get_domain_vf_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDomainHandle);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesOverclockGetDomainVFProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesOverclockGetDomainVFProperties(
+        zes_overclock_handle_t hDomainHandle,           ///< [in] Handle for the component domain.
+        zes_vf_property_t* pVFProperties                ///< [in,out] The VF min,max,step for a specified domain.
+        )
+    {
+        auto pfnGetDomainVFProperties = context.zesDdiTable.Overclock.pfnGetDomainVFProperties;
+
+        if( nullptr == pfnGetDomainVFProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Overclock, pfnGetDomainVFPropertiesCb, context.zesDdiTable.Overclock.pfnGetDomainVFProperties, hDomainHandle, pVFProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Overclock, pfnGetDomainVFPropertiesCb, context.zesDdiTable.Overclock.pfnGetDomainVFProperties, hDomainHandle, pVFProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Overclock.pfnGetDomainVFProperties, hDomainHandle, pVFProperties);
+
+        // capture parameters
+        zes_overclock_get_domain_vf_properties_params_t tracerParams = {
+            &hDomainHandle,
+            &pVFProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnOverclockGetDomainVFPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnOverclockGetDomainVFPropertiesCb_t, Sysman.Overclock, pfnGetDomainVFPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Overclock.pfnGetDomainVFProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDomainHandle,
+                                                  *tracerParams.ppVFProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesOverclockGetDomainControlProperties
+    template <>
+    struct APIRecordArgs<zes_overclock_get_domain_control_properties_params_t>
+    {
+        static uint32_t get(const zes_overclock_get_domain_control_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDomainHandle);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesOverclockGetDomainControlProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesOverclockGetDomainControlProperties(
+        zes_overclock_handle_t hDomainHandle,           ///< [in] Handle for the component domain.
+        zes_overclock_control_t DomainControl,          ///< [in] Handle for the component.
+        zes_control_property_t* pControlProperties      ///< [in,out] overclock control values.
+        )
+    {
+        auto pfnGetDomainControlProperties = context.zesDdiTable.Overclock.pfnGetDomainControlProperties;
+
+        if( nullptr == pfnGetDomainControlProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Overclock, pfnGetDomainControlPropertiesCb, context.zesDdiTable.Overclock.pfnGetDomainControlProperties, hDomainHandle, DomainControl, pControlProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Overclock, pfnGetDomainControlPropertiesCb, context.zesDdiTable.Overclock.pfnGetDomainControlProperties, hDomainHandle, DomainControl, pControlProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Overclock.pfnGetDomainControlProperties, hDomainHandle, DomainControl, pControlProperties);
+
+        // capture parameters
+        zes_overclock_get_domain_control_properties_params_t tracerParams = {
+            &hDomainHandle,
+            &DomainControl,
+            &pControlProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnOverclockGetDomainControlPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnOverclockGetDomainControlPropertiesCb_t, Sysman.Overclock, pfnGetDomainControlPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Overclock.pfnGetDomainControlProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDomainHandle,
+                                                  *tracerParams.pDomainControl,
+                                                  *tracerParams.ppControlProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesOverclockGetControlCurrentValue
+    template <>
+    struct APIRecordArgs<zes_overclock_get_control_current_value_params_t>
+    {
+        static uint32_t get(const zes_overclock_get_control_current_value_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDomainHandle);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesOverclockGetControlCurrentValue
+    __zedlllocal ze_result_t ZE_APICALL
+    zesOverclockGetControlCurrentValue(
+        zes_overclock_handle_t hDomainHandle,           ///< [in] Handle for the component.
+        zes_overclock_control_t DomainControl,          ///< [in] Overclock Control.
+        double* pValue                                  ///< [in,out] Getting overclock control value for the specified control.
+        )
+    {
+        auto pfnGetControlCurrentValue = context.zesDdiTable.Overclock.pfnGetControlCurrentValue;
+
+        if( nullptr == pfnGetControlCurrentValue)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Overclock, pfnGetControlCurrentValueCb, context.zesDdiTable.Overclock.pfnGetControlCurrentValue, hDomainHandle, DomainControl, pValue);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Overclock, pfnGetControlCurrentValueCb, context.zesDdiTable.Overclock.pfnGetControlCurrentValue, hDomainHandle, DomainControl, pValue);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Overclock.pfnGetControlCurrentValue, hDomainHandle, DomainControl, pValue);
+
+        // capture parameters
+        zes_overclock_get_control_current_value_params_t tracerParams = {
+            &hDomainHandle,
+            &DomainControl,
+            &pValue
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnOverclockGetControlCurrentValueCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnOverclockGetControlCurrentValueCb_t, Sysman.Overclock, pfnGetControlCurrentValueCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Overclock.pfnGetControlCurrentValue,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDomainHandle,
+                                                  *tracerParams.pDomainControl,
+                                                  *tracerParams.ppValue);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesOverclockGetControlPendingValue
+    template <>
+    struct APIRecordArgs<zes_overclock_get_control_pending_value_params_t>
+    {
+        static uint32_t get(const zes_overclock_get_control_pending_value_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDomainHandle);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesOverclockGetControlPendingValue
+    __zedlllocal ze_result_t ZE_APICALL
+    zesOverclockGetControlPendingValue(
+        zes_overclock_handle_t hDomainHandle,           ///< [in] Handle for the component domain.
+        zes_overclock_control_t DomainControl,          ///< [in] Overclock Control.
+        double* pValue                                  ///< [out] Returns the pending value for a given control. The units and
+                                                        ///< format of the value depend on the control type.
+        )
+    {
+        auto pfnGetControlPendingValue = context.zesDdiTable.Overclock.pfnGetControlPendingValue;
+
+        if( nullptr == pfnGetControlPendingValue)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Overclock, pfnGetControlPendingValueCb, context.zesDdiTable.Overclock.pfnGetControlPendingValue, hDomainHandle, DomainControl, pValue);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Overclock, pfnGetControlPendingValueCb, context.zesDdiTable.Overclock.pfnGetControlPendingValue, hDomainHandle, DomainControl, pValue);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Overclock.pfnGetControlPendingValue, hDomainHandle, DomainControl, pValue);
+
+        // capture parameters
+        zes_overclock_get_control_pending_value_params_t tracerParams = {
+            &hDomainHandle,
+            &DomainControl,
+            &pValue
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnOverclockGetControlPendingValueCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnOverclockGetControlPendingValueCb_t, Sysman.Overclock, pfnGetControlPendingValueCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Overclock.pfnGetControlPendingValue,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDomainHandle,
+                                                  *tracerParams.pDomainControl,
+                                                  *tracerParams.ppValue);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesOverclockSetControlUserValue
+    template <>
+    struct APIRecordArgs<zes_overclock_set_control_user_value_params_t>
+    {
+        static uint32_t get(const zes_overclock_set_control_user_value_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDomainHandle);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesOverclockSetControlUserValue
+    __zedlllocal ze_result_t ZE_APICALL
+    zesOverclockSetControlUserValue(
+        zes_overclock_handle_t hDomainHandle,           ///< [in] Handle for the component domain.
+        zes_overclock_control_t DomainControl,          ///< [in] Domain Control.
+        double pValue,                                  ///< [in] The new value of the control. The units and format of the value
+                                                        ///< depend on the control type.
+        zes_pending_action_t* pPendingAction            ///< [out] Pending overclock setting.
+        )
+    {
+        auto pfnSetControlUserValue = context.zesDdiTable.Overclock.pfnSetControlUserValue;
+
+        if( nullptr == pfnSetControlUserValue)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Overclock, pfnSetControlUserValueCb, context.zesDdiTable.Overclock.pfnSetControlUserValue, hDomainHandle, DomainControl, pValue, pPendingAction);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Overclock, pfnSetControlUserValueCb, context.zesDdiTable.Overclock.pfnSetControlUserValue, hDomainHandle, DomainControl, pValue, pPendingAction);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Overclock.pfnSetControlUserValue, hDomainHandle, DomainControl, pValue, pPendingAction);
+
+        // capture parameters
+        zes_overclock_set_control_user_value_params_t tracerParams = {
+            &hDomainHandle,
+            &DomainControl,
+            &pValue,
+            &pPendingAction
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnOverclockSetControlUserValueCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnOverclockSetControlUserValueCb_t, Sysman.Overclock, pfnSetControlUserValueCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Overclock.pfnSetControlUserValue,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDomainHandle,
+                                                  *tracerParams.pDomainControl,
+                                                  *tracerParams.ppValue,
+                                                  *tracerParams.ppPendingAction);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesOverclockGetControlState
+    template <>
+    struct APIRecordArgs<zes_overclock_get_control_state_params_t>
+    {
+        static uint32_t get(const zes_overclock_get_control_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDomainHandle);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesOverclockGetControlState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesOverclockGetControlState(
+        zes_overclock_handle_t hDomainHandle,           ///< [in] Handle for the component domain.
+        zes_overclock_control_t DomainControl,          ///< [in] Domain Control.
+        zes_control_state_t* pControlState,             ///< [out] Current overclock control state.
+        zes_pending_action_t* pPendingAction            ///< [out] Pending overclock setting.
+        )
+    {
+        auto pfnGetControlState = context.zesDdiTable.Overclock.pfnGetControlState;
+
+        if( nullptr == pfnGetControlState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Overclock, pfnGetControlStateCb, context.zesDdiTable.Overclock.pfnGetControlState, hDomainHandle, DomainControl, pControlState, pPendingAction);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Overclock, pfnGetControlStateCb, context.zesDdiTable.Overclock.pfnGetControlState, hDomainHandle, DomainControl, pControlState, pPendingAction);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Overclock.pfnGetControlState, hDomainHandle, DomainControl, pControlState, pPendingAction);
+
+        // capture parameters
+        zes_overclock_get_control_state_params_t tracerParams = {
+            &hDomainHandle,
+            &DomainControl,
+            &pControlState,
+            &pPendingAction
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnOverclockGetControlStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnOverclockGetControlStateCb_t, Sysman.Overclock, pfnGetControlStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Overclock.pfnGetControlState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDomainHandle,
+                                                  *tracerParams.pDomainControl,
+                                                  *tracerParams.ppControlState,
+                                                  *tracerParams.ppPendingAction);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesOverclockGetVFPointValues
+    template <>
+    struct APIRecordArgs<zes_overclock_get_vf_point_values_params_t>
+    {
+        static uint32_t get(const zes_overclock_get_vf_point_values_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDomainHandle);
+            args[count++] = recordArg(*params->pPointIndex);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesOverclockGetVFPointValues
+    __zedlllocal ze_result_t ZE_APICALL
+    zesOverclockGetVFPointValues(
+        zes_overclock_handle_t hDomainHandle,           ///< [in] Handle for the component domain.
+        zes_vf_type_t VFType,                           ///< [in] Voltage or Freqency point to read.
+        zes_vf_array_type_t VFArrayType,                ///< [in] User,Default or Live VF array to read from
+        uint32_t PointIndex,                            ///< [in] Point index - number between (0, max_num_points - 1).
+        uint32_t* PointValue                            ///< [out] Returns the frequency in 1kHz units or voltage in millivolt
+                                                        ///< units from the custom V-F curve at the specified zero-based index 
+        )
+    {
+        auto pfnGetVFPointValues = context.zesDdiTable.Overclock.pfnGetVFPointValues;
+
+        if( nullptr == pfnGetVFPointValues)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Overclock, pfnGetVFPointValuesCb, context.zesDdiTable.Overclock.pfnGetVFPointValues, hDomainHandle, VFType, VFArrayType, PointIndex, PointValue);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Overclock, pfnGetVFPointValuesCb, context.zesDdiTable.Overclock.pfnGetVFPointValues, hDomainHandle, VFType, VFArrayType, PointIndex, PointValue);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Overclock.pfnGetVFPointValues, hDomainHandle, VFType, VFArrayType, PointIndex, PointValue);
+
+        // capture parameters
+        zes_overclock_get_vf_point_values_params_t tracerParams = {
+            &hDomainHandle,
+            &VFType,
+            &VFArrayType,
+            &PointIndex,
+            &PointValue
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnOverclockGetVFPointValuesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnOverclockGetVFPointValuesCb_t, Sysman.Overclock, pfnGetVFPointValuesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Overclock.pfnGetVFPointValues,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDomainHandle,
+                                                  *tracerParams.pVFType,
+                                                  *tracerParams.pVFArrayType,
+                                                  *tracerParams.pPointIndex,
+                                                  *tracerParams.pPointValue);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesOverclockSetVFPointValues
+    template <>
+    struct APIRecordArgs<zes_overclock_set_vf_point_values_params_t>
+    {
+        static uint32_t get(const zes_overclock_set_vf_point_values_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDomainHandle);
+            args[count++] = recordArg(*params->pPointIndex);
+            args[count++] = recordArg(*params->pPointValue);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesOverclockSetVFPointValues
+    __zedlllocal ze_result_t ZE_APICALL
+    zesOverclockSetVFPointValues(
+        zes_overclock_handle_t hDomainHandle,           ///< [in] Handle for the component domain.
+        zes_vf_type_t VFType,                           ///< [in] Voltage or Freqency point to read.
+        uint32_t PointIndex,                            ///< [in] Point index - number between (0, max_num_points - 1).
+        uint32_t PointValue                             ///< [in] Writes frequency in 1kHz units or voltage in millivolt units to
+                                                        ///< custom V-F curve at the specified zero-based index 
+        )
+    {
+        auto pfnSetVFPointValues = context.zesDdiTable.Overclock.pfnSetVFPointValues;
+
+        if( nullptr == pfnSetVFPointValues)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Overclock, pfnSetVFPointValuesCb, context.zesDdiTable.Overclock.pfnSetVFPointValues, hDomainHandle, VFType, PointIndex, PointValue);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Overclock, pfnSetVFPointValuesCb, context.zesDdiTable.Overclock.pfnSetVFPointValues, hDomainHandle, VFType, PointIndex, PointValue);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Overclock.pfnSetVFPointValues, hDomainHandle, VFType, PointIndex, PointValue);
+
+        // capture parameters
+        zes_overclock_set_vf_point_values_params_t tracerParams = {
+            &hDomainHandle,
+            &VFType,
+            &PointIndex,
+            &PointValue
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnOverclockSetVFPointValuesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnOverclockSetVFPointValuesCb_t, Sysman.Overclock, pfnSetVFPointValuesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Overclock.pfnSetVFPointValues,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDomainHandle,
+                                                  *tracerParams.pVFType,
+                                                  *tracerParams.pPointIndex,
+                                                  *tracerParams.pPointValue);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumDiagnosticTestSuites
+    template <>
+    struct APIRecordArgs<zes_device_enum_diagnostic_test_suites_params_t>
+    {
+        static uint32_t get(const zes_device_enum_diagnostic_test_suites_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumDiagnosticTestSuites
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumDiagnosticTestSuites(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_diag_handle_t* phDiagnostics                ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumDiagnosticTestSuites = context.zesDdiTable.Device.pfnEnumDiagnosticTestSuites;
+
+        if( nullptr == pfnEnumDiagnosticTestSuites)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumDiagnosticTestSuitesCb, context.zesDdiTable.Device.pfnEnumDiagnosticTestSuites, hDevice, pCount, phDiagnostics);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumDiagnosticTestSuitesCb, context.zesDdiTable.Device.pfnEnumDiagnosticTestSuites, hDevice, pCount, phDiagnostics);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumDiagnosticTestSuites, hDevice, pCount, phDiagnostics);
+
+        // capture parameters
+        zes_device_enum_diagnostic_test_suites_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phDiagnostics
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumDiagnosticTestSuitesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumDiagnosticTestSuitesCb_t, Sysman.Device, pfnEnumDiagnosticTestSuitesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumDiagnosticTestSuites,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphDiagnostics);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDiagnosticsGetProperties
+    template <>
+    struct APIRecordArgs<zes_diagnostics_get_properties_params_t>
+    {
+        static uint32_t get(const zes_diagnostics_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDiagnostics);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDiagnosticsGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDiagnosticsGetProperties(
+        zes_diag_handle_t hDiagnostics,                 ///< [in] Handle for the component.
+        zes_diag_properties_t* pProperties              ///< [in,out] Structure describing the properties of a diagnostics test
+                                                        ///< suite
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Diagnostics.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Diagnostics, pfnGetPropertiesCb, context.zesDdiTable.Diagnostics.pfnGetProperties, hDiagnostics, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Diagnostics, pfnGetPropertiesCb, context.zesDdiTable.Diagnostics.pfnGetProperties, hDiagnostics, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Diagnostics.pfnGetProperties, hDiagnostics, pProperties);
+
+        // capture parameters
+        zes_diagnostics_get_properties_params_t tracerParams = {
+            &hDiagnostics,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDiagnosticsGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDiagnosticsGetPropertiesCb_t, Sysman.Diagnostics, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Diagnostics.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDiagnostics,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDiagnosticsGetTests
+    template <>
+    struct APIRecordArgs<zes_diagnostics_get_tests_params_t>
+    {
+        static uint32_t get(const zes_diagnostics_get_tests_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDiagnostics);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDiagnosticsGetTests
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDiagnosticsGetTests(
+        zes_diag_handle_t hDiagnostics,                 ///< [in] Handle for the component.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of tests.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of tests that are available.
+                                                        ///< if count is greater than the number of tests that are available, then
+                                                        ///< the driver shall update the value with the correct number of tests.
+        zes_diag_test_t* pTests                         ///< [in,out][optional][range(0, *pCount)] array of information about
+                                                        ///< individual tests sorted by increasing value of the `index` member of ::zes_diag_test_t.
+                                                        ///< if count is less than the number of tests that are available, then the
+                                                        ///< driver shall only retrieve that number of tests.
+        )
+    {
+        auto pfnGetTests = context.zesDdiTable.Diagnostics.pfnGetTests;
+
+        if( nullptr == pfnGetTests)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Diagnostics, pfnGetTestsCb, context.zesDdiTable.Diagnostics.pfnGetTests, hDiagnostics, pCount, pTests);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Diagnostics, pfnGetTestsCb, context.zesDdiTable.Diagnostics.pfnGetTests, hDiagnostics, pCount, pTests);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Diagnostics.pfnGetTests, hDiagnostics, pCount, pTests);
+
+        // capture parameters
+        zes_diagnostics_get_tests_params_t tracerParams = {
+            &hDiagnostics,
+            &pCount,
+            &pTests
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDiagnosticsGetTestsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDiagnosticsGetTestsCb_t, Sysman.Diagnostics, pfnGetTestsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Diagnostics.pfnGetTests,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDiagnostics,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.ppTests);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDiagnosticsRunTests
+    template <>
+    struct APIRecordArgs<zes_diagnostics_run_tests_params_t>
+    {
+        static uint32_t get(const zes_diagnostics_run_tests_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDiagnostics);
+            args[count++] = recordArg(*params->pstartIndex);
+            args[count++] = recordArg(*params->pendIndex);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDiagnosticsRunTests
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDiagnosticsRunTests(
+        zes_diag_handle_t hDiagnostics,                 ///< [in] Handle for the component.
+        uint32_t startIndex,                            ///< [in] The index of the first test to run. Set to
+                                                        ///< ::ZES_DIAG_FIRST_TEST_INDEX to start from the beginning.
+        uint32_t endIndex,                              ///< [in] The index of the last test to run. Set to
+                                                        ///< ::ZES_DIAG_LAST_TEST_INDEX to complete all tests after the start test.
+        zes_diag_result_t* pResult                      ///< [in,out] The result of the diagnostics
+        )
+    {
+        auto pfnRunTests = context.zesDdiTable.Diagnostics.pfnRunTests;
+
+        if( nullptr == pfnRunTests)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Diagnostics, pfnRunTestsCb, context.zesDdiTable.Diagnostics.pfnRunTests, hDiagnostics, startIndex, endIndex, pResult);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Diagnostics, pfnRunTestsCb, context.zesDdiTable.Diagnostics.pfnRunTests, hDiagnostics, startIndex, endIndex, pResult);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Diagnostics.pfnRunTests, hDiagnostics, startIndex, endIndex, pResult);
+
+        // capture parameters
+        zes_diagnostics_run_tests_params_t tracerParams = {
+            &hDiagnostics,
+            &startIndex,
+            &endIndex,
+            &pResult
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDiagnosticsRunTestsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDiagnosticsRunTestsCb_t, Sysman.Diagnostics, pfnRunTestsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Diagnostics.pfnRunTests,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDiagnostics,
+                                                  *tracerParams.pstartIndex,
+                                                  *tracerParams.pendIndex,
+                                                  *tracerParams.ppResult);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEccAvailable
+    template <>
+    struct APIRecordArgs<zes_device_ecc_available_params_t>
+    {
+        static uint32_t get(const zes_device_ecc_available_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEccAvailable
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEccAvailable(
+        zes_device_handle_t hDevice,                    ///< [in] Handle for the component.
+        ze_bool_t* pAvailable                           ///< [out] ECC functionality is available (true)/unavailable (false).
+        )
+    {
+        auto pfnEccAvailable = context.zesDdiTable.Device.pfnEccAvailable;
+
+        if( nullptr == pfnEccAvailable)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEccAvailableCb, context.zesDdiTable.Device.pfnEccAvailable, hDevice, pAvailable);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEccAvailableCb, context.zesDdiTable.Device.pfnEccAvailable, hDevice, pAvailable);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEccAvailable, hDevice, pAvailable);
+
+        // capture parameters
+        zes_device_ecc_available_params_t tracerParams = {
+            &hDevice,
+            &pAvailable
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEccAvailableCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEccAvailableCb_t, Sysman.Device, pfnEccAvailableCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEccAvailable,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppAvailable);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEccConfigurable
+    template <>
+    struct APIRecordArgs<zes_device_ecc_configurable_params_t>
+    {
+        static uint32_t get(const zes_device_ecc_configurable_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEccConfigurable
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEccConfigurable(
+        zes_device_handle_t hDevice,                    ///< [in] Handle for the component.
+        ze_bool_t* pConfigurable                        ///< [out] ECC can be enabled/disabled (true)/enabled/disabled (false).
+        )
+    {
+        auto pfnEccConfigurable = context.zesDdiTable.Device.pfnEccConfigurable;
+
+        if( nullptr == pfnEccConfigurable)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEccConfigurableCb, context.zesDdiTable.Device.pfnEccConfigurable, hDevice, pConfigurable);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEccConfigurableCb, context.zesDdiTable.Device.pfnEccConfigurable, hDevice, pConfigurable);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEccConfigurable, hDevice, pConfigurable);
+
+        // capture parameters
+        zes_device_ecc_configurable_params_t tracerParams = {
+            &hDevice,
+            &pConfigurable
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEccConfigurableCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEccConfigurableCb_t, Sysman.Device, pfnEccConfigurableCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEccConfigurable,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppConfigurable);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceGetEccState
+    template <>
+    struct APIRecordArgs<zes_device_get_ecc_state_params_t>
+    {
+        static uint32_t get(const zes_device_get_ecc_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceGetEccState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceGetEccState(
+        zes_device_handle_t hDevice,                    ///< [in] Handle for the component.
+        zes_device_ecc_properties_t* pState             ///< [out] ECC state, pending state, and pending action for state change.
+        )
+    {
+        auto pfnGetEccState = context.zesDdiTable.Device.pfnGetEccState;
+
+        if( nullptr == pfnGetEccState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnGetEccStateCb, context.zesDdiTable.Device.pfnGetEccState, hDevice, pState);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnGetEccStateCb, context.zesDdiTable.Device.pfnGetEccState, hDevice, pState);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnGetEccState, hDevice, pState);
+
+        // capture parameters
+        zes_device_get_ecc_state_params_t tracerParams = {
+            &hDevice,
+            &pState
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceGetEccStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceGetEccStateCb_t, Sysman.Device, pfnGetEccStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnGetEccState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppState);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceSetEccState
+    template <>
+    struct APIRecordArgs<zes_device_set_ecc_state_params_t>
+    {
+        static uint32_t get(const zes_device_set_ecc_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceSetEccState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceSetEccState(
+        zes_device_handle_t hDevice,                    ///< [in] Handle for the component.
+        const zes_device_ecc_desc_t* newState,          ///< [in] Pointer to desired ECC state.
+        zes_device_ecc_properties_t* pState             ///< [out] ECC state, pending state, and pending action for state change.
+        )
+    {
+        auto pfnSetEccState = context.zesDdiTable.Device.pfnSetEccState;
+
+        if( nullptr == pfnSetEccState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnSetEccStateCb, context.zesDdiTable.Device.pfnSetEccState, hDevice, newState, pState);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnSetEccStateCb, context.zesDdiTable.Device.pfnSetEccState, hDevice, newState, pState);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnSetEccState, hDevice, newState, pState);
+
+        // capture parameters
+        zes_device_set_ecc_state_params_t tracerParams = {
+            &hDevice,
+            &newState,
+            &pState
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceSetEccStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceSetEccStateCb_t, Sysman.Device, pfnSetEccStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnSetEccState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.pnewState,
+                                                  *tracerParams.ppState);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumEngineGroups
+    template <>
+    struct APIRecordArgs<zes_device_enum_engine_groups_params_t>
+    {
+        static uint32_t get(const zes_device_enum_engine_groups_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumEngineGroups
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumEngineGroups(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_engine_handle_t* phEngine                   ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumEngineGroups = context.zesDdiTable.Device.pfnEnumEngineGroups;
+
+        if( nullptr == pfnEnumEngineGroups)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumEngineGroupsCb, context.zesDdiTable.Device.pfnEnumEngineGroups, hDevice, pCount, phEngine);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumEngineGroupsCb, context.zesDdiTable.Device.pfnEnumEngineGroups, hDevice, pCount, phEngine);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumEngineGroups, hDevice, pCount, phEngine);
+
+        // capture parameters
+        zes_device_enum_engine_groups_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phEngine
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumEngineGroupsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumEngineGroupsCb_t, Sysman.Device, pfnEnumEngineGroupsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumEngineGroups,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphEngine);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesEngineGetProperties
+    template <>
+    struct APIRecordArgs<zes_engine_get_properties_params_t>
+    {
+        static uint32_t get(const zes_engine_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEngine);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesEngineGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesEngineGetProperties(
+        zes_engine_handle_t hEngine,                    ///< [in] Handle for the component.
+        zes_engine_properties_t* pProperties            ///< [in,out] The properties for the specified engine group.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Engine.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Engine, pfnGetPropertiesCb, context.zesDdiTable.Engine.pfnGetProperties, hEngine, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Engine, pfnGetPropertiesCb, context.zesDdiTable.Engine.pfnGetProperties, hEngine, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Engine.pfnGetProperties, hEngine, pProperties);
+
+        // capture parameters
+        zes_engine_get_properties_params_t tracerParams = {
+            &hEngine,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnEngineGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnEngineGetPropertiesCb_t, Sysman.Engine, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Engine.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phEngine,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesEngineGetActivity
+    template <>
+    struct APIRecordArgs<zes_engine_get_activity_params_t>
+    {
+        static uint32_t get(const zes_engine_get_activity_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEngine);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesEngineGetActivity
+    __zedlllocal ze_result_t ZE_APICALL
+    zesEngineGetActivity(
+        zes_engine_handle_t hEngine,                    ///< [in] Handle for the component.
+        zes_engine_stats_t* pStats                      ///< [in,out] Will contain a snapshot of the engine group activity
+                                                        ///< counters.
+        )
+    {
+        auto pfnGetActivity = context.zesDdiTable.Engine.pfnGetActivity;
+
+        if( nullptr == pfnGetActivity)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Engine, pfnGetActivityCb, context.zesDdiTable.Engine.pfnGetActivity, hEngine, pStats);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Engine, pfnGetActivityCb, context.zesDdiTable.Engine.pfnGetActivity, hEngine, pStats);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Engine.pfnGetActivity, hEngine, pStats);
+
+        // capture parameters
+        zes_engine_get_activity_params_t tracerParams = {
+            &hEngine,
+            &pStats
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnEngineGetActivityCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnEngineGetActivityCb_t, Sysman.Engine, pfnGetActivityCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Engine.pfnGetActivity,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phEngine,
+                                                  *tracerParams.ppStats);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEventRegister
+    template <>
+    struct APIRecordArgs<zes_device_event_register_params_t>
+    {
+        static uint32_t get(const zes_device_event_register_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEventRegister
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEventRegister(
+        zes_device_handle_t hDevice,                    ///< [in] The device handle.
+        zes_event_type_flags_t events                   ///< [in] List of events to listen to.
+        )
+    {
+        auto pfnEventRegister = context.zesDdiTable.Device.pfnEventRegister;
+
+        if( nullptr == pfnEventRegister)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEventRegisterCb, context.zesDdiTable.Device.pfnEventRegister, hDevice, events);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEventRegisterCb, context.zesDdiTable.Device.pfnEventRegister, hDevice, events);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEventRegister, hDevice, events);
+
+        // capture parameters
+        zes_device_event_register_params_t tracerParams = {
+            &hDevice,
+            &events
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEventRegisterCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEventRegisterCb_t, Sysman.Device, pfnEventRegisterCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEventRegister,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.pevents);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDriverEventListen
+    template <>
+    struct APIRecordArgs<zes_driver_event_listen_params_t>
+    {
+        static uint32_t get(const zes_driver_event_listen_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            args[count++] = recordArg(*params->ptimeout);
+            args[count++] = recordArg(*params->pcount);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDriverEventListen
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDriverEventListen(
+        ze_driver_handle_t hDriver,                     ///< [in] handle of the driver instance
+        uint32_t timeout,                               ///< [in] if non-zero, then indicates the maximum time (in milliseconds) to
+                                                        ///< yield before returning ::ZE_RESULT_SUCCESS or ::ZE_RESULT_NOT_READY;
+                                                        ///< if zero, then will check status and return immediately;
+                                                        ///< if `UINT32_MAX`, then function will not return until events arrive.
+        uint32_t count,                                 ///< [in] Number of device handles in phDevices.
+        zes_device_handle_t* phDevices,                 ///< [in][range(0, count)] Device handles to listen to for events. Only
+                                                        ///< devices from the provided driver handle can be specified in this list.
+        uint32_t* pNumDeviceEvents,                     ///< [in,out] Will contain the actual number of devices in phDevices that
+                                                        ///< generated events. If non-zero, check pEvents to determine the devices
+                                                        ///< and events that were received.
+        zes_event_type_flags_t* pEvents                 ///< [in,out] An array that will continue the list of events for each
+                                                        ///< device listened in phDevices.
+                                                        ///< This array must be at least as big as count.
+                                                        ///< For every device handle in phDevices, this will provide the events
+                                                        ///< that occurred for that device at the same position in this array. If
+                                                        ///< no event was received for a given device, the corresponding array
+                                                        ///< entry will be zero.
+        )
+    {
+        auto pfnEventListen = context.zesDdiTable.Driver.pfnEventListen;
+
+        if( nullptr == pfnEventListen)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Driver, pfnEventListenCb, context.zesDdiTable.Driver.pfnEventListen, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Driver, pfnEventListenCb, context.zesDdiTable.Driver.pfnEventListen, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Driver.pfnEventListen, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
+
+        // capture parameters
+        zes_driver_event_listen_params_t tracerParams = {
+            &hDriver,
+            &timeout,
+            &count,
+            &phDevices,
+            &pNumDeviceEvents,
+            &pEvents
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDriverEventListenCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDriverEventListenCb_t, Sysman.Driver, pfnEventListenCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Driver.pfnEventListen,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDriver,
+                                                  *tracerParams.ptimeout,
+                                                  *tracerParams.pcount,
+                                                  *tracerParams.pphDevices,
+                                                  *tracerParams.ppNumDeviceEvents,
+                                                  *tracerParams.ppEvents);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDriverEventListenEx
+    template <>
+    struct APIRecordArgs<zes_driver_event_listen_ex_params_t>
+    {
+        static uint32_t get(const zes_driver_event_listen_ex_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            args[count++] = recordArg(*params->ptimeout);
+            args[count++] = recordArg(*params->pcount);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDriverEventListenEx
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDriverEventListenEx(
+        ze_driver_handle_t hDriver,                     ///< [in] handle of the driver instance
+        uint64_t timeout,                               ///< [in] if non-zero, then indicates the maximum time (in milliseconds) to
+                                                        ///< yield before returning ::ZE_RESULT_SUCCESS or ::ZE_RESULT_NOT_READY;
+                                                        ///< if zero, then will check status and return immediately;
+                                                        ///< if `UINT64_MAX`, then function will not return until events arrive.
+        uint32_t count,                                 ///< [in] Number of device handles in phDevices.
+        zes_device_handle_t* phDevices,                 ///< [in][range(0, count)] Device handles to listen to for events. Only
+                                                        ///< devices from the provided driver handle can be specified in this list.
+        uint32_t* pNumDeviceEvents,                     ///< [in,out] Will contain the actual number of devices in phDevices that
+                                                        ///< generated events. If non-zero, check pEvents to determine the devices
+                                                        ///< and events that were received.
+        zes_event_type_flags_t* pEvents                 ///< [in,out] An array that will continue the list of events for each
+                                                        ///< device listened in phDevices.
+                                                        ///< This array must be at least as big as count.
+                                                        ///< For every device handle in phDevices, this will provide the events
+                                                        ///< that occurred for that device at the same position in this array. If
+                                                        ///< no event was received for a given device, the corresponding array
+                                                        ///< entry will be zero.
+        )
+    {
+        auto pfnEventListenEx = context.zesDdiTable.Driver.pfnEventListenEx;
+
+        if( nullptr == pfnEventListenEx)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Driver, pfnEventListenExCb, context.zesDdiTable.Driver.pfnEventListenEx, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Driver, pfnEventListenExCb, context.zesDdiTable.Driver.pfnEventListenEx, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Driver.pfnEventListenEx, hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents);
+
+        // capture parameters
+        zes_driver_event_listen_ex_params_t tracerParams = {
+            &hDriver,
+            &timeout,
+            &count,
+            &phDevices,
+            &pNumDeviceEvents,
+            &pEvents
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDriverEventListenExCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDriverEventListenExCb_t, Sysman.Driver, pfnEventListenExCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Driver.pfnEventListenEx,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDriver,
+                                                  *tracerParams.ptimeout,
+                                                  *tracerParams.pcount,
+                                                  *tracerParams.pphDevices,
+                                                  *tracerParams.ppNumDeviceEvents,
+                                                  *tracerParams.ppEvents);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumFabricPorts
+    template <>
+    struct APIRecordArgs<zes_device_enum_fabric_ports_params_t>
+    {
+        static uint32_t get(const zes_device_enum_fabric_ports_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumFabricPorts
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumFabricPorts(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_fabric_port_handle_t* phPort                ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumFabricPorts = context.zesDdiTable.Device.pfnEnumFabricPorts;
+
+        if( nullptr == pfnEnumFabricPorts)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumFabricPortsCb, context.zesDdiTable.Device.pfnEnumFabricPorts, hDevice, pCount, phPort);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumFabricPortsCb, context.zesDdiTable.Device.pfnEnumFabricPorts, hDevice, pCount, phPort);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumFabricPorts, hDevice, pCount, phPort);
+
+        // capture parameters
+        zes_device_enum_fabric_ports_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phPort
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumFabricPortsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumFabricPortsCb_t, Sysman.Device, pfnEnumFabricPortsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumFabricPorts,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphPort);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFabricPortGetProperties
+    template <>
+    struct APIRecordArgs<zes_fabric_port_get_properties_params_t>
+    {
+        static uint32_t get(const zes_fabric_port_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPort);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFabricPortGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFabricPortGetProperties(
+        zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
+        zes_fabric_port_properties_t* pProperties       ///< [in,out] Will contain properties of the Fabric Port.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.FabricPort.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.FabricPort, pfnGetPropertiesCb, context.zesDdiTable.FabricPort.pfnGetProperties, hPort, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.FabricPort, pfnGetPropertiesCb, context.zesDdiTable.FabricPort.pfnGetProperties, hPort, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.FabricPort.pfnGetProperties, hPort, pProperties);
+
+        // capture parameters
+        zes_fabric_port_get_properties_params_t tracerParams = {
+            &hPort,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFabricPortGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFabricPortGetPropertiesCb_t, Sysman.FabricPort, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.FabricPort.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPort,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFabricPortGetLinkType
+    template <>
+    struct APIRecordArgs<zes_fabric_port_get_link_type_params_t>
+    {
+        static uint32_t get(const zes_fabric_port_get_link_type_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPort);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFabricPortGetLinkType
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFabricPortGetLinkType(
+        zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
+        zes_fabric_link_type_t* pLinkType               ///< [in,out] Will contain details about the link attached to the Fabric
+                                                        ///< port.
+        )
+    {
+        auto pfnGetLinkType = context.zesDdiTable.FabricPort.pfnGetLinkType;
+
+        if( nullptr == pfnGetLinkType)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.FabricPort, pfnGetLinkTypeCb, context.zesDdiTable.FabricPort.pfnGetLinkType, hPort, pLinkType);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.FabricPort, pfnGetLinkTypeCb, context.zesDdiTable.FabricPort.pfnGetLinkType, hPort, pLinkType);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.FabricPort.pfnGetLinkType, hPort, pLinkType);
+
+        // capture parameters
+        zes_fabric_port_get_link_type_params_t tracerParams = {
+            &hPort,
+            &pLinkType
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFabricPortGetLinkTypeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFabricPortGetLinkTypeCb_t, Sysman.FabricPort, pfnGetLinkTypeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.FabricPort.pfnGetLinkType,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPort,
+                                                  *tracerParams.ppLinkType);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFabricPortGetConfig
+    template <>
+    struct APIRecordArgs<zes_fabric_port_get_config_params_t>
+    {
+        static uint32_t get(const zes_fabric_port_get_config_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPort);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFabricPortGetConfig
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFabricPortGetConfig(
+        zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
+        zes_fabric_port_config_t* pConfig               ///< [in,out] Will contain configuration of the Fabric Port.
+        )
+    {
+        auto pfnGetConfig = context.zesDdiTable.FabricPort.pfnGetConfig;
+
+        if( nullptr == pfnGetConfig)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.FabricPort, pfnGetConfigCb, context.zesDdiTable.FabricPort.pfnGetConfig, hPort, pConfig);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.FabricPort, pfnGetConfigCb, context.zesDdiTable.FabricPort.pfnGetConfig, hPort, pConfig);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.FabricPort.pfnGetConfig, hPort, pConfig);
+
+        // capture parameters
+        zes_fabric_port_get_config_params_t tracerParams = {
+            &hPort,
+            &pConfig
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFabricPortGetConfigCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFabricPortGetConfigCb_t, Sysman.FabricPort, pfnGetConfigCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.FabricPort.pfnGetConfig,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPort,
+                                                  *tracerParams.ppConfig);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFabricPortSetConfig
+    template <>
+    struct APIRecordArgs<zes_fabric_port_set_config_params_t>
+    {
+        static uint32_t get(const zes_fabric_port_set_config_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPort);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFabricPortSetConfig
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFabricPortSetConfig(
+        zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
+        const zes_fabric_port_config_t* pConfig         ///< [in] Contains new configuration of the Fabric Port.
+        )
+    {
+        auto pfnSetConfig = context.zesDdiTable.FabricPort.pfnSetConfig;
+
+        if( nullptr == pfnSetConfig)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.FabricPort, pfnSetConfigCb, context.zesDdiTable.FabricPort.pfnSetConfig, hPort, pConfig);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.FabricPort, pfnSetConfigCb, context.zesDdiTable.FabricPort.pfnSetConfig, hPort, pConfig);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.FabricPort.pfnSetConfig, hPort, pConfig);
+
+        // capture parameters
+        zes_fabric_port_set_config_params_t tracerParams = {
+            &hPort,
+            &pConfig
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFabricPortSetConfigCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFabricPortSetConfigCb_t, Sysman.FabricPort, pfnSetConfigCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.FabricPort.pfnSetConfig,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPort,
+                                                  *tracerParams.ppConfig);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFabricPortGetState
+    template <>
+    struct APIRecordArgs<zes_fabric_port_get_state_params_t>
+    {
+        static uint32_t get(const zes_fabric_port_get_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPort);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFabricPortGetState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFabricPortGetState(
+        zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
+        zes_fabric_port_state_t* pState                 ///< [in,out] Will contain the current state of the Fabric Port
+        )
+    {
+        auto pfnGetState = context.zesDdiTable.FabricPort.pfnGetState;
+
+        if( nullptr == pfnGetState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.FabricPort, pfnGetStateCb, context.zesDdiTable.FabricPort.pfnGetState, hPort, pState);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.FabricPort, pfnGetStateCb, context.zesDdiTable.FabricPort.pfnGetState, hPort, pState);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.FabricPort.pfnGetState, hPort, pState);
+
+        // capture parameters
+        zes_fabric_port_get_state_params_t tracerParams = {
+            &hPort,
+            &pState
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFabricPortGetStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFabricPortGetStateCb_t, Sysman.FabricPort, pfnGetStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.FabricPort.pfnGetState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPort,
+                                                  *tracerParams.ppState);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFabricPortGetThroughput
+    template <>
+    struct APIRecordArgs<zes_fabric_port_get_throughput_params_t>
+    {
+        static uint32_t get(const zes_fabric_port_get_throughput_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPort);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFabricPortGetThroughput
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFabricPortGetThroughput(
+        zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
+        zes_fabric_port_throughput_t* pThroughput       ///< [in,out] Will contain the Fabric port throughput counters.
+        )
+    {
+        auto pfnGetThroughput = context.zesDdiTable.FabricPort.pfnGetThroughput;
+
+        if( nullptr == pfnGetThroughput)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.FabricPort, pfnGetThroughputCb, context.zesDdiTable.FabricPort.pfnGetThroughput, hPort, pThroughput);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.FabricPort, pfnGetThroughputCb, context.zesDdiTable.FabricPort.pfnGetThroughput, hPort, pThroughput);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.FabricPort.pfnGetThroughput, hPort, pThroughput);
+
+        // capture parameters
+        zes_fabric_port_get_throughput_params_t tracerParams = {
+            &hPort,
+            &pThroughput
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFabricPortGetThroughputCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFabricPortGetThroughputCb_t, Sysman.FabricPort, pfnGetThroughputCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.FabricPort.pfnGetThroughput,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPort,
+                                                  *tracerParams.ppThroughput);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFabricPortGetFabricErrorCounters
+    template <>
+    struct APIRecordArgs<zes_fabric_port_get_fabric_error_counters_params_t>
+    {
+        static uint32_t get(const zes_fabric_port_get_fabric_error_counters_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPort);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFabricPortGetFabricErrorCounters
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFabricPortGetFabricErrorCounters(
+        zes_fabric_port_handle_t hPort,                 ///< [in] Handle for the component.
+        zes_fabric_port_error_counters_t* pErrors       ///< [in,out] Will contain the Fabric port Error counters.
+        )
+    {
+        auto pfnGetFabricErrorCounters = context.zesDdiTable.FabricPort.pfnGetFabricErrorCounters;
+
+        if( nullptr == pfnGetFabricErrorCounters)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.FabricPort, pfnGetFabricErrorCountersCb, context.zesDdiTable.FabricPort.pfnGetFabricErrorCounters, hPort, pErrors);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.FabricPort, pfnGetFabricErrorCountersCb, context.zesDdiTable.FabricPort.pfnGetFabricErrorCounters, hPort, pErrors);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.FabricPort.pfnGetFabricErrorCounters, hPort, pErrors);
+
+        // capture parameters
+        zes_fabric_port_get_fabric_error_counters_params_t tracerParams = {
+            &hPort,
+            &pErrors
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFabricPortGetFabricErrorCountersCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFabricPortGetFabricErrorCountersCb_t, Sysman.FabricPort, pfnGetFabricErrorCountersCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.FabricPort.pfnGetFabricErrorCounters,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPort,
+                                                  *tracerParams.ppErrors);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFabricPortGetMultiPortThroughput
+    template <>
+    struct APIRecordArgs<zes_fabric_port_get_multi_port_throughput_params_t>
+    {
+        static uint32_t get(const zes_fabric_port_get_multi_port_throughput_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->pnumPorts);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFabricPortGetMultiPortThroughput
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFabricPortGetMultiPortThroughput(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t numPorts,                              ///< [in] Number of ports enumerated in function ::zesDeviceEnumFabricPorts
+        zes_fabric_port_handle_t* phPort,               ///< [in][range(0, numPorts)] array of fabric port handles provided by user
+                                                        ///< to gather throughput values. 
+        zes_fabric_port_throughput_t** pThroughput      ///< [out][range(0, numPorts)] array of fabric port throughput counters
+                                                        ///< from multiple ports of type ::zes_fabric_port_throughput_t.
+        )
+    {
+        auto pfnGetMultiPortThroughput = context.zesDdiTable.FabricPort.pfnGetMultiPortThroughput;
+
+        if( nullptr == pfnGetMultiPortThroughput)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.FabricPort, pfnGetMultiPortThroughputCb, context.zesDdiTable.FabricPort.pfnGetMultiPortThroughput, hDevice, numPorts, phPort, pThroughput);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.FabricPort, pfnGetMultiPortThroughputCb, context.zesDdiTable.FabricPort.pfnGetMultiPortThroughput, hDevice, numPorts, phPort, pThroughput);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.FabricPort.pfnGetMultiPortThroughput, hDevice, numPorts, phPort, pThroughput);
+
+        // capture parameters
+        zes_fabric_port_get_multi_port_throughput_params_t tracerParams = {
+            &hDevice,
+            &numPorts,
+            &phPort,
+            &pThroughput
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFabricPortGetMultiPortThroughputCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFabricPortGetMultiPortThroughputCb_t, Sysman.FabricPort, pfnGetMultiPortThroughputCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.FabricPort.pfnGetMultiPortThroughput,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.pnumPorts,
+                                                  *tracerParams.pphPort,
+                                                  *tracerParams.ppThroughput);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumFans
+    template <>
+    struct APIRecordArgs<zes_device_enum_fans_params_t>
+    {
+        static uint32_t get(const zes_device_enum_fans_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumFans
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumFans(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_fan_handle_t* phFan                         ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumFans = context.zesDdiTable.Device.pfnEnumFans;
+
+        if( nullptr == pfnEnumFans)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumFansCb, context.zesDdiTable.Device.pfnEnumFans, hDevice, pCount, phFan);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumFansCb, context.zesDdiTable.Device.pfnEnumFans, hDevice, pCount, phFan);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumFans, hDevice, pCount, phFan);
+
+        // capture parameters
+        zes_device_enum_fans_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phFan
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumFansCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumFansCb_t, Sysman.Device, pfnEnumFansCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumFans,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphFan);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFanGetProperties
+    template <>
+    struct APIRecordArgs<zes_fan_get_properties_params_t>
+    {
+        static uint32_t get(const zes_fan_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFan);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFanGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFanGetProperties(
+        zes_fan_handle_t hFan,                          ///< [in] Handle for the component.
+        zes_fan_properties_t* pProperties               ///< [in,out] Will contain the properties of the fan.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Fan.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Fan, pfnGetPropertiesCb, context.zesDdiTable.Fan.pfnGetProperties, hFan, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Fan, pfnGetPropertiesCb, context.zesDdiTable.Fan.pfnGetProperties, hFan, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Fan.pfnGetProperties, hFan, pProperties);
+
+        // capture parameters
+        zes_fan_get_properties_params_t tracerParams = {
+            &hFan,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFanGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFanGetPropertiesCb_t, Sysman.Fan, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Fan.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFan,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFanGetConfig
+    template <>
+    struct APIRecordArgs<zes_fan_get_config_params_t>
+    {
+        static uint32_t get(const zes_fan_get_config_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFan);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFanGetConfig
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFanGetConfig(
+        zes_fan_handle_t hFan,                          ///< [in] Handle for the component.
+        zes_fan_config_t* pConfig                       ///< [in,out] Will contain the current configuration of the fan.
+        )
+    {
+        auto pfnGetConfig = context.zesDdiTable.Fan.pfnGetConfig;
+
+        if( nullptr == pfnGetConfig)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Fan, pfnGetConfigCb, context.zesDdiTable.Fan.pfnGetConfig, hFan, pConfig);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Fan, pfnGetConfigCb, context.zesDdiTable.Fan.pfnGetConfig, hFan, pConfig);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Fan.pfnGetConfig, hFan, pConfig);
+
+        // capture parameters
+        zes_fan_get_config_params_t tracerParams = {
+            &hFan,
+            &pConfig
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFanGetConfigCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFanGetConfigCb_t, Sysman.Fan, pfnGetConfigCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Fan.pfnGetConfig,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFan,
+                                                  *tracerParams.ppConfig);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFanSetDefaultMode
+    template <>
+    struct APIRecordArgs<zes_fan_set_default_mode_params_t>
+    {
+        static uint32_t get(const zes_fan_set_default_mode_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFan);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFanSetDefaultMode
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFanSetDefaultMode(
+        zes_fan_handle_t hFan                           ///< [in] Handle for the component.
+        )
+    {
+        auto pfnSetDefaultMode = context.zesDdiTable.Fan.pfnSetDefaultMode;
+
+        if( nullptr == pfnSetDefaultMode)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Fan, pfnSetDefaultModeCb, context.zesDdiTable.Fan.pfnSetDefaultMode, hFan);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Fan, pfnSetDefaultModeCb, context.zesDdiTable.Fan.pfnSetDefaultMode, hFan);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Fan.pfnSetDefaultMode, hFan);
+
+        // capture parameters
+        zes_fan_set_default_mode_params_t tracerParams = {
+            &hFan
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFanSetDefaultModeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFanSetDefaultModeCb_t, Sysman.Fan, pfnSetDefaultModeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Fan.pfnSetDefaultMode,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFan);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFanSetFixedSpeedMode
+    template <>
+    struct APIRecordArgs<zes_fan_set_fixed_speed_mode_params_t>
+    {
+        static uint32_t get(const zes_fan_set_fixed_speed_mode_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFan);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFanSetFixedSpeedMode
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFanSetFixedSpeedMode(
+        zes_fan_handle_t hFan,                          ///< [in] Handle for the component.
+        const zes_fan_speed_t* speed                    ///< [in] The fixed fan speed setting
+        )
+    {
+        auto pfnSetFixedSpeedMode = context.zesDdiTable.Fan.pfnSetFixedSpeedMode;
+
+        if( nullptr == pfnSetFixedSpeedMode)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Fan, pfnSetFixedSpeedModeCb, context.zesDdiTable.Fan.pfnSetFixedSpeedMode, hFan, speed);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Fan, pfnSetFixedSpeedModeCb, context.zesDdiTable.Fan.pfnSetFixedSpeedMode, hFan, speed);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Fan.pfnSetFixedSpeedMode, hFan, speed);
+
+        // capture parameters
+        zes_fan_set_fixed_speed_mode_params_t tracerParams = {
+            &hFan,
+            &speed
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFanSetFixedSpeedModeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFanSetFixedSpeedModeCb_t, Sysman.Fan, pfnSetFixedSpeedModeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Fan.pfnSetFixedSpeedMode,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFan,
+                                                  *tracerParams.pspeed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFanSetSpeedTableMode
+    template <>
+    struct APIRecordArgs<zes_fan_set_speed_table_mode_params_t>
+    {
+        static uint32_t get(const zes_fan_set_speed_table_mode_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFan);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFanSetSpeedTableMode
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFanSetSpeedTableMode(
+        zes_fan_handle_t hFan,                          ///< [in] Handle for the component.
+        const zes_fan_speed_table_t* speedTable         ///< [in] A table containing temperature/speed pairs.
+        )
+    {
+        auto pfnSetSpeedTableMode = context.zesDdiTable.Fan.pfnSetSpeedTableMode;
+
+        if( nullptr == pfnSetSpeedTableMode)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Fan, pfnSetSpeedTableModeCb, context.zesDdiTable.Fan.pfnSetSpeedTableMode, hFan, speedTable);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Fan, pfnSetSpeedTableModeCb, context.zesDdiTable.Fan.pfnSetSpeedTableMode, hFan, speedTable);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Fan.pfnSetSpeedTableMode, hFan, speedTable);
+
+        // capture parameters
+        zes_fan_set_speed_table_mode_params_t tracerParams = {
+            &hFan,
+            &speedTable
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFanSetSpeedTableModeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFanSetSpeedTableModeCb_t, Sysman.Fan, pfnSetSpeedTableModeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Fan.pfnSetSpeedTableMode,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFan,
+                                                  *tracerParams.pspeedTable);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFanGetState
+    template <>
+    struct APIRecordArgs<zes_fan_get_state_params_t>
+    {
+        static uint32_t get(const zes_fan_get_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFan);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFanGetState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFanGetState(
+        zes_fan_handle_t hFan,                          ///< [in] Handle for the component.
+        zes_fan_speed_units_t units,                    ///< [in] The units in which the fan speed should be returned.
+        int32_t* pSpeed                                 ///< [in,out] Will contain the current speed of the fan in the units
+                                                        ///< requested. A value of -1 indicates that the fan speed cannot be
+                                                        ///< measured.
+        )
+    {
+        auto pfnGetState = context.zesDdiTable.Fan.pfnGetState;
+
+        if( nullptr == pfnGetState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Fan, pfnGetStateCb, context.zesDdiTable.Fan.pfnGetState, hFan, units, pSpeed);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Fan, pfnGetStateCb, context.zesDdiTable.Fan.pfnGetState, hFan, units, pSpeed);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Fan.pfnGetState, hFan, units, pSpeed);
+
+        // capture parameters
+        zes_fan_get_state_params_t tracerParams = {
+            &hFan,
+            &units,
+            &pSpeed
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFanGetStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFanGetStateCb_t, Sysman.Fan, pfnGetStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Fan.pfnGetState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFan,
+                                                  *tracerParams.punits,
+                                                  *tracerParams.ppSpeed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumFirmwares
+    template <>
+    struct APIRecordArgs<zes_device_enum_firmwares_params_t>
+    {
+        static uint32_t get(const zes_device_enum_firmwares_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumFirmwares
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumFirmwares(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_firmware_handle_t* phFirmware               ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumFirmwares = context.zesDdiTable.Device.pfnEnumFirmwares;
+
+        if( nullptr == pfnEnumFirmwares)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumFirmwaresCb, context.zesDdiTable.Device.pfnEnumFirmwares, hDevice, pCount, phFirmware);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumFirmwaresCb, context.zesDdiTable.Device.pfnEnumFirmwares, hDevice, pCount, phFirmware);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumFirmwares, hDevice, pCount, phFirmware);
+
+        // capture parameters
+        zes_device_enum_firmwares_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phFirmware
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumFirmwaresCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumFirmwaresCb_t, Sysman.Device, pfnEnumFirmwaresCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumFirmwares,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphFirmware);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFirmwareGetProperties
+    template <>
+    struct APIRecordArgs<zes_firmware_get_properties_params_t>
+    {
+        static uint32_t get(const zes_firmware_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFirmware);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFirmwareGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFirmwareGetProperties(
+        zes_firmware_handle_t hFirmware,                ///< [in] Handle for the component.
+        zes_firmware_properties_t* pProperties          ///< [in,out] Pointer to an array that will hold the properties of the
+                                                        ///< firmware
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Firmware.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Firmware, pfnGetPropertiesCb, context.zesDdiTable.Firmware.pfnGetProperties, hFirmware, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Firmware, pfnGetPropertiesCb, context.zesDdiTable.Firmware.pfnGetProperties, hFirmware, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Firmware.pfnGetProperties, hFirmware, pProperties);
+
+        // capture parameters
+        zes_firmware_get_properties_params_t tracerParams = {
+            &hFirmware,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFirmwareGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFirmwareGetPropertiesCb_t, Sysman.Firmware, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Firmware.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFirmware,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFirmwareFlash
+    template <>
+    struct APIRecordArgs<zes_firmware_flash_params_t>
+    {
+        static uint32_t get(const zes_firmware_flash_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFirmware);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFirmwareFlash
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFirmwareFlash(
+        zes_firmware_handle_t hFirmware,                ///< [in] Handle for the component.
+        void* pImage,                                   ///< [in] Image of the new firmware to flash.
+        uint32_t size                                   ///< [in] Size of the flash image.
+        )
+    {
+        auto pfnFlash = context.zesDdiTable.Firmware.pfnFlash;
+
+        if( nullptr == pfnFlash)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Firmware, pfnFlashCb, context.zesDdiTable.Firmware.pfnFlash, hFirmware, pImage, size);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Firmware, pfnFlashCb, context.zesDdiTable.Firmware.pfnFlash, hFirmware, pImage, size);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Firmware.pfnFlash, hFirmware, pImage, size);
+
+        // capture parameters
+        zes_firmware_flash_params_t tracerParams = {
+            &hFirmware,
+            &pImage,
+            &size
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFirmwareFlashCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFirmwareFlashCb_t, Sysman.Firmware, pfnFlashCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Firmware.pfnFlash,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFirmware,
+                                                  *tracerParams.ppImage,
+                                                  *tracerParams.psize);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumFrequencyDomains
+    template <>
+    struct APIRecordArgs<zes_device_enum_frequency_domains_params_t>
+    {
+        static uint32_t get(const zes_device_enum_frequency_domains_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumFrequencyDomains
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumFrequencyDomains(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_freq_handle_t* phFrequency                  ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumFrequencyDomains = context.zesDdiTable.Device.pfnEnumFrequencyDomains;
+
+        if( nullptr == pfnEnumFrequencyDomains)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumFrequencyDomainsCb, context.zesDdiTable.Device.pfnEnumFrequencyDomains, hDevice, pCount, phFrequency);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumFrequencyDomainsCb, context.zesDdiTable.Device.pfnEnumFrequencyDomains, hDevice, pCount, phFrequency);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumFrequencyDomains, hDevice, pCount, phFrequency);
+
+        // capture parameters
+        zes_device_enum_frequency_domains_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phFrequency
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumFrequencyDomainsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumFrequencyDomainsCb_t, Sysman.Device, pfnEnumFrequencyDomainsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumFrequencyDomains,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphFrequency);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyGetProperties
+    template <>
+    struct APIRecordArgs<zes_frequency_get_properties_params_t>
+    {
+        static uint32_t get(const zes_frequency_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyGetProperties(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        zes_freq_properties_t* pProperties              ///< [in,out] The frequency properties for the specified domain.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Frequency.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnGetPropertiesCb, context.zesDdiTable.Frequency.pfnGetProperties, hFrequency, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnGetPropertiesCb, context.zesDdiTable.Frequency.pfnGetProperties, hFrequency, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnGetProperties, hFrequency, pProperties);
+
+        // capture parameters
+        zes_frequency_get_properties_params_t tracerParams = {
+            &hFrequency,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyGetPropertiesCb_t, Sysman.Frequency, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyGetAvailableClocks
+    template <>
+    struct APIRecordArgs<zes_frequency_get_available_clocks_params_t>
+    {
+        static uint32_t get(const zes_frequency_get_available_clocks_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyGetAvailableClocks
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyGetAvailableClocks(
+        zes_freq_handle_t hFrequency,                   ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of frequencies.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of frequencies that are available.
+                                                        ///< if count is greater than the number of frequencies that are available,
+                                                        ///< then the driver shall update the value with the correct number of frequencies.
+        double* phFrequency                             ///< [in,out][optional][range(0, *pCount)] array of frequencies in units of
+                                                        ///< MHz and sorted from slowest to fastest.
+                                                        ///< if count is less than the number of frequencies that are available,
+                                                        ///< then the driver shall only retrieve that number of frequencies.
+        )
+    {
+        auto pfnGetAvailableClocks = context.zesDdiTable.Frequency.pfnGetAvailableClocks;
+
+        if( nullptr == pfnGetAvailableClocks)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnGetAvailableClocksCb, context.zesDdiTable.Frequency.pfnGetAvailableClocks, hFrequency, pCount, phFrequency);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnGetAvailableClocksCb, context.zesDdiTable.Frequency.pfnGetAvailableClocks, hFrequency, pCount, phFrequency);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnGetAvailableClocks, hFrequency, pCount, phFrequency);
+
+        // capture parameters
+        zes_frequency_get_available_clocks_params_t tracerParams = {
+            &hFrequency,
+            &pCount,
+            &phFrequency
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyGetAvailableClocksCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyGetAvailableClocksCb_t, Sysman.Frequency, pfnGetAvailableClocksCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnGetAvailableClocks,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphFrequency);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyGetRange
+    template <>
+    struct APIRecordArgs<zes_frequency_get_range_params_t>
+    {
+        static uint32_t get(const zes_frequency_get_range_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyGetRange
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyGetRange(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        zes_freq_range_t* pLimits                       ///< [in,out] The range between which the hardware can operate for the
+                                                        ///< specified domain.
+        )
+    {
+        auto pfnGetRange = context.zesDdiTable.Frequency.pfnGetRange;
+
+        if( nullptr == pfnGetRange)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnGetRangeCb, context.zesDdiTable.Frequency.pfnGetRange, hFrequency, pLimits);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnGetRangeCb, context.zesDdiTable.Frequency.pfnGetRange, hFrequency, pLimits);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnGetRange, hFrequency, pLimits);
+
+        // capture parameters
+        zes_frequency_get_range_params_t tracerParams = {
+            &hFrequency,
+            &pLimits
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyGetRangeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyGetRangeCb_t, Sysman.Frequency, pfnGetRangeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnGetRange,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.ppLimits);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencySetRange
+    template <>
+    struct APIRecordArgs<zes_frequency_set_range_params_t>
+    {
+        static uint32_t get(const zes_frequency_set_range_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencySetRange
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencySetRange(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        const zes_freq_range_t* pLimits                 ///< [in] The limits between which the hardware can operate for the
+                                                        ///< specified domain.
+        )
+    {
+        auto pfnSetRange = context.zesDdiTable.Frequency.pfnSetRange;
+
+        if( nullptr == pfnSetRange)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnSetRangeCb, context.zesDdiTable.Frequency.pfnSetRange, hFrequency, pLimits);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnSetRangeCb, context.zesDdiTable.Frequency.pfnSetRange, hFrequency, pLimits);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnSetRange, hFrequency, pLimits);
+
+        // capture parameters
+        zes_frequency_set_range_params_t tracerParams = {
+            &hFrequency,
+            &pLimits
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencySetRangeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencySetRangeCb_t, Sysman.Frequency, pfnSetRangeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnSetRange,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.ppLimits);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyGetState
+    template <>
+    struct APIRecordArgs<zes_frequency_get_state_params_t>
+    {
+        static uint32_t get(const zes_frequency_get_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyGetState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyGetState(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        zes_freq_state_t* pState                        ///< [in,out] Frequency state for the specified domain.
+        )
+    {
+        auto pfnGetState = context.zesDdiTable.Frequency.pfnGetState;
+
+        if( nullptr == pfnGetState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnGetStateCb, context.zesDdiTable.Frequency.pfnGetState, hFrequency, pState);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnGetStateCb, context.zesDdiTable.Frequency.pfnGetState, hFrequency, pState);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnGetState, hFrequency, pState);
+
+        // capture parameters
+        zes_frequency_get_state_params_t tracerParams = {
+            &hFrequency,
+            &pState
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyGetStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyGetStateCb_t, Sysman.Frequency, pfnGetStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnGetState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.ppState);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyGetThrottleTime
+    template <>
+    struct APIRecordArgs<zes_frequency_get_throttle_time_params_t>
+    {
+        static uint32_t get(const zes_frequency_get_throttle_time_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyGetThrottleTime
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyGetThrottleTime(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        zes_freq_throttle_time_t* pThrottleTime         ///< [in,out] Will contain a snapshot of the throttle time counters for the
+                                                        ///< specified domain.
+        )
+    {
+        auto pfnGetThrottleTime = context.zesDdiTable.Frequency.pfnGetThrottleTime;
+
+        if( nullptr == pfnGetThrottleTime)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnGetThrottleTimeCb, context.zesDdiTable.Frequency.pfnGetThrottleTime, hFrequency, pThrottleTime);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnGetThrottleTimeCb, context.zesDdiTable.Frequency.pfnGetThrottleTime, hFrequency, pThrottleTime);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnGetThrottleTime, hFrequency, pThrottleTime);
+
+        // capture parameters
+        zes_frequency_get_throttle_time_params_t tracerParams = {
+            &hFrequency,
+            &pThrottleTime
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyGetThrottleTimeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyGetThrottleTimeCb_t, Sysman.Frequency, pfnGetThrottleTimeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnGetThrottleTime,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.ppThrottleTime);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyOcGetCapabilities
+    template <>
+    struct APIRecordArgs<zes_frequency_oc_get_capabilities_params_t>
+    {
+        static uint32_t get(const zes_frequency_oc_get_capabilities_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyOcGetCapabilities
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyOcGetCapabilities(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        zes_oc_capabilities_t* pOcCapabilities          ///< [in,out] Pointer to the capabilities structure.
+        )
+    {
+        auto pfnOcGetCapabilities = context.zesDdiTable.Frequency.pfnOcGetCapabilities;
+
+        if( nullptr == pfnOcGetCapabilities)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnOcGetCapabilitiesCb, context.zesDdiTable.Frequency.pfnOcGetCapabilities, hFrequency, pOcCapabilities);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnOcGetCapabilitiesCb, context.zesDdiTable.Frequency.pfnOcGetCapabilities, hFrequency, pOcCapabilities);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnOcGetCapabilities, hFrequency, pOcCapabilities);
+
+        // capture parameters
+        zes_frequency_oc_get_capabilities_params_t tracerParams = {
+            &hFrequency,
+            &pOcCapabilities
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyOcGetCapabilitiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyOcGetCapabilitiesCb_t, Sysman.Frequency, pfnOcGetCapabilitiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnOcGetCapabilities,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.ppOcCapabilities);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyOcGetFrequencyTarget
+    template <>
+    struct APIRecordArgs<zes_frequency_oc_get_frequency_target_params_t>
+    {
+        static uint32_t get(const zes_frequency_oc_get_frequency_target_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyOcGetFrequencyTarget
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyOcGetFrequencyTarget(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        double* pCurrentOcFrequency                     ///< [out] Overclocking Frequency in MHz, if extended moded is supported,
+                                                        ///< will returned in 1 Mhz granularity, else, in multiples of 50 Mhz. This
+                                                        ///< cannot be greater than the `maxOcFrequency` member of
+                                                        ///< ::zes_oc_capabilities_t.
+        )
+    {
+        auto pfnOcGetFrequencyTarget = context.zesDdiTable.Frequency.pfnOcGetFrequencyTarget;
+
+        if( nullptr == pfnOcGetFrequencyTarget)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnOcGetFrequencyTargetCb, context.zesDdiTable.Frequency.pfnOcGetFrequencyTarget, hFrequency, pCurrentOcFrequency);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnOcGetFrequencyTargetCb, context.zesDdiTable.Frequency.pfnOcGetFrequencyTarget, hFrequency, pCurrentOcFrequency);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnOcGetFrequencyTarget, hFrequency, pCurrentOcFrequency);
+
+        // capture parameters
+        zes_frequency_oc_get_frequency_target_params_t tracerParams = {
+            &hFrequency,
+            &pCurrentOcFrequency
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyOcGetFrequencyTargetCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyOcGetFrequencyTargetCb_t, Sysman.Frequency, pfnOcGetFrequencyTargetCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnOcGetFrequencyTarget,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.ppCurrentOcFrequency);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyOcSetFrequencyTarget
+    template <>
+    struct APIRecordArgs<zes_frequency_oc_set_frequency_target_params_t>
+    {
+        static uint32_t get(const zes_frequency_oc_set_frequency_target_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyOcSetFrequencyTarget
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyOcSetFrequencyTarget(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        double CurrentOcFrequency                       ///< [in] Overclocking Frequency in MHz, if extended moded is supported, it
+                                                        ///< could be set in 1 Mhz granularity, else, in multiples of 50 Mhz. This
+                                                        ///< cannot be greater than the `maxOcFrequency` member of
+                                                        ///< ::zes_oc_capabilities_t.
+        )
+    {
+        auto pfnOcSetFrequencyTarget = context.zesDdiTable.Frequency.pfnOcSetFrequencyTarget;
+
+        if( nullptr == pfnOcSetFrequencyTarget)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnOcSetFrequencyTargetCb, context.zesDdiTable.Frequency.pfnOcSetFrequencyTarget, hFrequency, CurrentOcFrequency);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnOcSetFrequencyTargetCb, context.zesDdiTable.Frequency.pfnOcSetFrequencyTarget, hFrequency, CurrentOcFrequency);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnOcSetFrequencyTarget, hFrequency, CurrentOcFrequency);
+
+        // capture parameters
+        zes_frequency_oc_set_frequency_target_params_t tracerParams = {
+            &hFrequency,
+            &CurrentOcFrequency
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyOcSetFrequencyTargetCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyOcSetFrequencyTargetCb_t, Sysman.Frequency, pfnOcSetFrequencyTargetCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnOcSetFrequencyTarget,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.pCurrentOcFrequency);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyOcGetVoltageTarget
+    template <>
+    struct APIRecordArgs<zes_frequency_oc_get_voltage_target_params_t>
+    {
+        static uint32_t get(const zes_frequency_oc_get_voltage_target_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyOcGetVoltageTarget
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyOcGetVoltageTarget(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        double* pCurrentVoltageTarget,                  ///< [out] Overclock voltage in Volts. This cannot be greater than the
+                                                        ///< `maxOcVoltage` member of ::zes_oc_capabilities_t.
+        double* pCurrentVoltageOffset                   ///< [out] This voltage offset is applied to all points on the
+                                                        ///< voltage/frequency curve, including the new overclock voltageTarget.
+                                                        ///< Valid range is between the `minOcVoltageOffset` and
+                                                        ///< `maxOcVoltageOffset` members of ::zes_oc_capabilities_t.
+        )
+    {
+        auto pfnOcGetVoltageTarget = context.zesDdiTable.Frequency.pfnOcGetVoltageTarget;
+
+        if( nullptr == pfnOcGetVoltageTarget)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnOcGetVoltageTargetCb, context.zesDdiTable.Frequency.pfnOcGetVoltageTarget, hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnOcGetVoltageTargetCb, context.zesDdiTable.Frequency.pfnOcGetVoltageTarget, hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnOcGetVoltageTarget, hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset);
+
+        // capture parameters
+        zes_frequency_oc_get_voltage_target_params_t tracerParams = {
+            &hFrequency,
+            &pCurrentVoltageTarget,
+            &pCurrentVoltageOffset
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyOcGetVoltageTargetCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyOcGetVoltageTargetCb_t, Sysman.Frequency, pfnOcGetVoltageTargetCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnOcGetVoltageTarget,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.ppCurrentVoltageTarget,
+                                                  *tracerParams.ppCurrentVoltageOffset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyOcSetVoltageTarget
+    template <>
+    struct APIRecordArgs<zes_frequency_oc_set_voltage_target_params_t>
+    {
+        static uint32_t get(const zes_frequency_oc_set_voltage_target_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyOcSetVoltageTarget
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyOcSetVoltageTarget(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        double CurrentVoltageTarget,                    ///< [in] Overclock voltage in Volts. This cannot be greater than the
+                                                        ///< `maxOcVoltage` member of ::zes_oc_capabilities_t.
+        double CurrentVoltageOffset                     ///< [in] This voltage offset is applied to all points on the
+                                                        ///< voltage/frequency curve, include the new overclock voltageTarget.
+                                                        ///< Valid range is between the `minOcVoltageOffset` and
+                                                        ///< `maxOcVoltageOffset` members of ::zes_oc_capabilities_t.
+        )
+    {
+        auto pfnOcSetVoltageTarget = context.zesDdiTable.Frequency.pfnOcSetVoltageTarget;
+
+        if( nullptr == pfnOcSetVoltageTarget)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnOcSetVoltageTargetCb, context.zesDdiTable.Frequency.pfnOcSetVoltageTarget, hFrequency, CurrentVoltageTarget, CurrentVoltageOffset);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnOcSetVoltageTargetCb, context.zesDdiTable.Frequency.pfnOcSetVoltageTarget, hFrequency, CurrentVoltageTarget, CurrentVoltageOffset);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnOcSetVoltageTarget, hFrequency, CurrentVoltageTarget, CurrentVoltageOffset);
+
+        // capture parameters
+        zes_frequency_oc_set_voltage_target_params_t tracerParams = {
+            &hFrequency,
+            &CurrentVoltageTarget,
+            &CurrentVoltageOffset
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyOcSetVoltageTargetCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyOcSetVoltageTargetCb_t, Sysman.Frequency, pfnOcSetVoltageTargetCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnOcSetVoltageTarget,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.pCurrentVoltageTarget,
+                                                  *tracerParams.pCurrentVoltageOffset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyOcSetMode
+    template <>
+    struct APIRecordArgs<zes_frequency_oc_set_mode_params_t>
+    {
+        static uint32_t get(const zes_frequency_oc_set_mode_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyOcSetMode
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyOcSetMode(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        zes_oc_mode_t CurrentOcMode                     ///< [in] Current Overclocking Mode ::zes_oc_mode_t.
+        )
+    {
+        auto pfnOcSetMode = context.zesDdiTable.Frequency.pfnOcSetMode;
+
+        if( nullptr == pfnOcSetMode)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnOcSetModeCb, context.zesDdiTable.Frequency.pfnOcSetMode, hFrequency, CurrentOcMode);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnOcSetModeCb, context.zesDdiTable.Frequency.pfnOcSetMode, hFrequency, CurrentOcMode);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnOcSetMode, hFrequency, CurrentOcMode);
+
+        // capture parameters
+        zes_frequency_oc_set_mode_params_t tracerParams = {
+            &hFrequency,
+            &CurrentOcMode
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyOcSetModeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyOcSetModeCb_t, Sysman.Frequency, pfnOcSetModeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnOcSetMode,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.pCurrentOcMode);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyOcGetMode
+    template <>
+    struct APIRecordArgs<zes_frequency_oc_get_mode_params_t>
+    {
+        static uint32_t get(const zes_frequency_oc_get_mode_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyOcGetMode
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyOcGetMode(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        zes_oc_mode_t* pCurrentOcMode                   ///< [out] Current Overclocking Mode ::zes_oc_mode_t.
+        )
+    {
+        auto pfnOcGetMode = context.zesDdiTable.Frequency.pfnOcGetMode;
+
+        if( nullptr == pfnOcGetMode)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnOcGetModeCb, context.zesDdiTable.Frequency.pfnOcGetMode, hFrequency, pCurrentOcMode);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnOcGetModeCb, context.zesDdiTable.Frequency.pfnOcGetMode, hFrequency, pCurrentOcMode);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnOcGetMode, hFrequency, pCurrentOcMode);
+
+        // capture parameters
+        zes_frequency_oc_get_mode_params_t tracerParams = {
+            &hFrequency,
+            &pCurrentOcMode
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyOcGetModeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyOcGetModeCb_t, Sysman.Frequency, pfnOcGetModeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnOcGetMode,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.ppCurrentOcMode);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyOcGetIccMax
+    template <>
+    struct APIRecordArgs<zes_frequency_oc_get_icc_max_params_t>
+    {
+        static uint32_t get(const zes_frequency_oc_get_icc_max_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyOcGetIccMax
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyOcGetIccMax(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        double* pOcIccMax                               ///< [in,out] Will contain the maximum current limit in Amperes on
+                                                        ///< successful return.
+        )
+    {
+        auto pfnOcGetIccMax = context.zesDdiTable.Frequency.pfnOcGetIccMax;
+
+        if( nullptr == pfnOcGetIccMax)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnOcGetIccMaxCb, context.zesDdiTable.Frequency.pfnOcGetIccMax, hFrequency, pOcIccMax);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnOcGetIccMaxCb, context.zesDdiTable.Frequency.pfnOcGetIccMax, hFrequency, pOcIccMax);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnOcGetIccMax, hFrequency, pOcIccMax);
+
+        // capture parameters
+        zes_frequency_oc_get_icc_max_params_t tracerParams = {
+            &hFrequency,
+            &pOcIccMax
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyOcGetIccMaxCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyOcGetIccMaxCb_t, Sysman.Frequency, pfnOcGetIccMaxCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnOcGetIccMax,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.ppOcIccMax);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyOcSetIccMax
+    template <>
+    struct APIRecordArgs<zes_frequency_oc_set_icc_max_params_t>
+    {
+        static uint32_t get(const zes_frequency_oc_set_icc_max_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyOcSetIccMax
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyOcSetIccMax(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        double ocIccMax                                 ///< [in] The new maximum current limit in Amperes.
+        )
+    {
+        auto pfnOcSetIccMax = context.zesDdiTable.Frequency.pfnOcSetIccMax;
+
+        if( nullptr == pfnOcSetIccMax)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnOcSetIccMaxCb, context.zesDdiTable.Frequency.pfnOcSetIccMax, hFrequency, ocIccMax);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnOcSetIccMaxCb, context.zesDdiTable.Frequency.pfnOcSetIccMax, hFrequency, ocIccMax);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnOcSetIccMax, hFrequency, ocIccMax);
+
+        // capture parameters
+        zes_frequency_oc_set_icc_max_params_t tracerParams = {
+            &hFrequency,
+            &ocIccMax
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyOcSetIccMaxCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyOcSetIccMaxCb_t, Sysman.Frequency, pfnOcSetIccMaxCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnOcSetIccMax,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.pocIccMax);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyOcGetTjMax
+    template <>
+    struct APIRecordArgs<zes_frequency_oc_get_tj_max_params_t>
+    {
+        static uint32_t get(const zes_frequency_oc_get_tj_max_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyOcGetTjMax
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyOcGetTjMax(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        double* pOcTjMax                                ///< [in,out] Will contain the maximum temperature limit in degrees Celsius
+                                                        ///< on successful return.
+        )
+    {
+        auto pfnOcGetTjMax = context.zesDdiTable.Frequency.pfnOcGetTjMax;
+
+        if( nullptr == pfnOcGetTjMax)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnOcGetTjMaxCb, context.zesDdiTable.Frequency.pfnOcGetTjMax, hFrequency, pOcTjMax);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnOcGetTjMaxCb, context.zesDdiTable.Frequency.pfnOcGetTjMax, hFrequency, pOcTjMax);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnOcGetTjMax, hFrequency, pOcTjMax);
+
+        // capture parameters
+        zes_frequency_oc_get_tj_max_params_t tracerParams = {
+            &hFrequency,
+            &pOcTjMax
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyOcGetTjMaxCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyOcGetTjMaxCb_t, Sysman.Frequency, pfnOcGetTjMaxCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnOcGetTjMax,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.ppOcTjMax);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesFrequencyOcSetTjMax
+    template <>
+    struct APIRecordArgs<zes_frequency_oc_set_tj_max_params_t>
+    {
+        static uint32_t get(const zes_frequency_oc_set_tj_max_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phFrequency);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesFrequencyOcSetTjMax
+    __zedlllocal ze_result_t ZE_APICALL
+    zesFrequencyOcSetTjMax(
+        zes_freq_handle_t hFrequency,                   ///< [in] Handle for the component.
+        double ocTjMax                                  ///< [in] The new maximum temperature limit in degrees Celsius.
+        )
+    {
+        auto pfnOcSetTjMax = context.zesDdiTable.Frequency.pfnOcSetTjMax;
+
+        if( nullptr == pfnOcSetTjMax)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Frequency, pfnOcSetTjMaxCb, context.zesDdiTable.Frequency.pfnOcSetTjMax, hFrequency, ocTjMax);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Frequency, pfnOcSetTjMaxCb, context.zesDdiTable.Frequency.pfnOcSetTjMax, hFrequency, ocTjMax);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Frequency.pfnOcSetTjMax, hFrequency, ocTjMax);
+
+        // capture parameters
+        zes_frequency_oc_set_tj_max_params_t tracerParams = {
+            &hFrequency,
+            &ocTjMax
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnFrequencyOcSetTjMaxCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnFrequencyOcSetTjMaxCb_t, Sysman.Frequency, pfnOcSetTjMaxCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Frequency.pfnOcSetTjMax,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phFrequency,
+                                                  *tracerParams.pocTjMax);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumLeds
+    template <>
+    struct APIRecordArgs<zes_device_enum_leds_params_t>
+    {
+        static uint32_t get(const zes_device_enum_leds_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumLeds
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumLeds(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_led_handle_t* phLed                         ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumLeds = context.zesDdiTable.Device.pfnEnumLeds;
+
+        if( nullptr == pfnEnumLeds)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumLedsCb, context.zesDdiTable.Device.pfnEnumLeds, hDevice, pCount, phLed);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumLedsCb, context.zesDdiTable.Device.pfnEnumLeds, hDevice, pCount, phLed);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumLeds, hDevice, pCount, phLed);
+
+        // capture parameters
+        zes_device_enum_leds_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phLed
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumLedsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumLedsCb_t, Sysman.Device, pfnEnumLedsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumLeds,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphLed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesLedGetProperties
+    template <>
+    struct APIRecordArgs<zes_led_get_properties_params_t>
+    {
+        static uint32_t get(const zes_led_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phLed);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesLedGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesLedGetProperties(
+        zes_led_handle_t hLed,                          ///< [in] Handle for the component.
+        zes_led_properties_t* pProperties               ///< [in,out] Will contain the properties of the LED.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Led.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Led, pfnGetPropertiesCb, context.zesDdiTable.Led.pfnGetProperties, hLed, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Led, pfnGetPropertiesCb, context.zesDdiTable.Led.pfnGetProperties, hLed, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Led.pfnGetProperties, hLed, pProperties);
+
+        // capture parameters
+        zes_led_get_properties_params_t tracerParams = {
+            &hLed,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnLedGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnLedGetPropertiesCb_t, Sysman.Led, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Led.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phLed,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesLedGetState
+    template <>
+    struct APIRecordArgs<zes_led_get_state_params_t>
+    {
+        static uint32_t get(const zes_led_get_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phLed);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesLedGetState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesLedGetState(
+        zes_led_handle_t hLed,                          ///< [in] Handle for the component.
+        zes_led_state_t* pState                         ///< [in,out] Will contain the current state of the LED.
+        )
+    {
+        auto pfnGetState = context.zesDdiTable.Led.pfnGetState;
+
+        if( nullptr == pfnGetState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Led, pfnGetStateCb, context.zesDdiTable.Led.pfnGetState, hLed, pState);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Led, pfnGetStateCb, context.zesDdiTable.Led.pfnGetState, hLed, pState);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Led.pfnGetState, hLed, pState);
+
+        // capture parameters
+        zes_led_get_state_params_t tracerParams = {
+            &hLed,
+            &pState
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnLedGetStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnLedGetStateCb_t, Sysman.Led, pfnGetStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Led.pfnGetState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phLed,
+                                                  *tracerParams.ppState);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesLedSetState
+    template <>
+    struct APIRecordArgs<zes_led_set_state_params_t>
+    {
+        static uint32_t get(const zes_led_set_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phLed);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesLedSetState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesLedSetState(
+        zes_led_handle_t hLed,                          ///< [in] Handle for the component.
+        ze_bool_t enable                                ///< [in] Set to TRUE to turn the LED on, FALSE to turn off.
+        )
+    {
+        auto pfnSetState = context.zesDdiTable.Led.pfnSetState;
+
+        if( nullptr == pfnSetState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Led, pfnSetStateCb, context.zesDdiTable.Led.pfnSetState, hLed, enable);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Led, pfnSetStateCb, context.zesDdiTable.Led.pfnSetState, hLed, enable);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Led.pfnSetState, hLed, enable);
+
+        // capture parameters
+        zes_led_set_state_params_t tracerParams = {
+            &hLed,
+            &enable
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnLedSetStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnLedSetStateCb_t, Sysman.Led, pfnSetStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Led.pfnSetState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phLed,
+                                                  *tracerParams.penable);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesLedSetColor
+    template <>
+    struct APIRecordArgs<zes_led_set_color_params_t>
+    {
+        static uint32_t get(const zes_led_set_color_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phLed);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesLedSetColor
+    __zedlllocal ze_result_t ZE_APICALL
+    zesLedSetColor(
+        zes_led_handle_t hLed,                          ///< [in] Handle for the component.
+        const zes_led_color_t* pColor                   ///< [in] New color of the LED.
+        )
+    {
+        auto pfnSetColor = context.zesDdiTable.Led.pfnSetColor;
+
+        if( nullptr == pfnSetColor)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Led, pfnSetColorCb, context.zesDdiTable.Led.pfnSetColor, hLed, pColor);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Led, pfnSetColorCb, context.zesDdiTable.Led.pfnSetColor, hLed, pColor);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Led.pfnSetColor, hLed, pColor);
+
+        // capture parameters
+        zes_led_set_color_params_t tracerParams = {
+            &hLed,
+            &pColor
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnLedSetColorCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnLedSetColorCb_t, Sysman.Led, pfnSetColorCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Led.pfnSetColor,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phLed,
+                                                  *tracerParams.ppColor);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumMemoryModules
+    template <>
+    struct APIRecordArgs<zes_device_enum_memory_modules_params_t>
+    {
+        static uint32_t get(const zes_device_enum_memory_modules_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumMemoryModules
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumMemoryModules(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_mem_handle_t* phMemory                      ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumMemoryModules = context.zesDdiTable.Device.pfnEnumMemoryModules;
+
+        if( nullptr == pfnEnumMemoryModules)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumMemoryModulesCb, context.zesDdiTable.Device.pfnEnumMemoryModules, hDevice, pCount, phMemory);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumMemoryModulesCb, context.zesDdiTable.Device.pfnEnumMemoryModules, hDevice, pCount, phMemory);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumMemoryModules, hDevice, pCount, phMemory);
+
+        // capture parameters
+        zes_device_enum_memory_modules_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phMemory
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumMemoryModulesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumMemoryModulesCb_t, Sysman.Device, pfnEnumMemoryModulesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumMemoryModules,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphMemory);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesMemoryGetProperties
+    template <>
+    struct APIRecordArgs<zes_memory_get_properties_params_t>
+    {
+        static uint32_t get(const zes_memory_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMemory);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesMemoryGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesMemoryGetProperties(
+        zes_mem_handle_t hMemory,                       ///< [in] Handle for the component.
+        zes_mem_properties_t* pProperties               ///< [in,out] Will contain memory properties.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Memory.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Memory, pfnGetPropertiesCb, context.zesDdiTable.Memory.pfnGetProperties, hMemory, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Memory, pfnGetPropertiesCb, context.zesDdiTable.Memory.pfnGetProperties, hMemory, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Memory.pfnGetProperties, hMemory, pProperties);
+
+        // capture parameters
+        zes_memory_get_properties_params_t tracerParams = {
+            &hMemory,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnMemoryGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnMemoryGetPropertiesCb_t, Sysman.Memory, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Memory.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMemory,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesMemoryGetState
+    template <>
+    struct APIRecordArgs<zes_memory_get_state_params_t>
+    {
+        static uint32_t get(const zes_memory_get_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMemory);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesMemoryGetState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesMemoryGetState(
+        zes_mem_handle_t hMemory,                       ///< [in] Handle for the component.
+        zes_mem_state_t* pState                         ///< [in,out] Will contain the current health and allocated memory.
+        )
+    {
+        auto pfnGetState = context.zesDdiTable.Memory.pfnGetState;
+
+        if( nullptr == pfnGetState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Memory, pfnGetStateCb, context.zesDdiTable.Memory.pfnGetState, hMemory, pState);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Memory, pfnGetStateCb, context.zesDdiTable.Memory.pfnGetState, hMemory, pState);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Memory.pfnGetState, hMemory, pState);
+
+        // capture parameters
+        zes_memory_get_state_params_t tracerParams = {
+            &hMemory,
+            &pState
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnMemoryGetStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnMemoryGetStateCb_t, Sysman.Memory, pfnGetStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Memory.pfnGetState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMemory,
+                                                  *tracerParams.ppState);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesMemoryGetBandwidth
+    template <>
+    struct APIRecordArgs<zes_memory_get_bandwidth_params_t>
+    {
+        static uint32_t get(const zes_memory_get_bandwidth_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMemory);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesMemoryGetBandwidth
+    __zedlllocal ze_result_t ZE_APICALL
+    zesMemoryGetBandwidth(
+        zes_mem_handle_t hMemory,                       ///< [in] Handle for the component.
+        zes_mem_bandwidth_t* pBandwidth                 ///< [in,out] Will contain the total number of bytes read from and written
+                                                        ///< to memory, as well as the current maximum bandwidth.
+        )
+    {
+        auto pfnGetBandwidth = context.zesDdiTable.Memory.pfnGetBandwidth;
+
+        if( nullptr == pfnGetBandwidth)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Memory, pfnGetBandwidthCb, context.zesDdiTable.Memory.pfnGetBandwidth, hMemory, pBandwidth);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Memory, pfnGetBandwidthCb, context.zesDdiTable.Memory.pfnGetBandwidth, hMemory, pBandwidth);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Memory.pfnGetBandwidth, hMemory, pBandwidth);
+
+        // capture parameters
+        zes_memory_get_bandwidth_params_t tracerParams = {
+            &hMemory,
+            &pBandwidth
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnMemoryGetBandwidthCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnMemoryGetBandwidthCb_t, Sysman.Memory, pfnGetBandwidthCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Memory.pfnGetBandwidth,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMemory,
+                                                  *tracerParams.ppBandwidth);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumPerformanceFactorDomains
+    template <>
+    struct APIRecordArgs<zes_device_enum_performance_factor_domains_params_t>
+    {
+        static uint32_t get(const zes_device_enum_performance_factor_domains_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumPerformanceFactorDomains
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumPerformanceFactorDomains(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_perf_handle_t* phPerf                       ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumPerformanceFactorDomains = context.zesDdiTable.Device.pfnEnumPerformanceFactorDomains;
+
+        if( nullptr == pfnEnumPerformanceFactorDomains)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumPerformanceFactorDomainsCb, context.zesDdiTable.Device.pfnEnumPerformanceFactorDomains, hDevice, pCount, phPerf);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumPerformanceFactorDomainsCb, context.zesDdiTable.Device.pfnEnumPerformanceFactorDomains, hDevice, pCount, phPerf);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumPerformanceFactorDomains, hDevice, pCount, phPerf);
+
+        // capture parameters
+        zes_device_enum_performance_factor_domains_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phPerf
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumPerformanceFactorDomainsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumPerformanceFactorDomainsCb_t, Sysman.Device, pfnEnumPerformanceFactorDomainsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumPerformanceFactorDomains,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphPerf);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPerformanceFactorGetProperties
+    template <>
+    struct APIRecordArgs<zes_performance_factor_get_properties_params_t>
+    {
+        static uint32_t get(const zes_performance_factor_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPerf);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPerformanceFactorGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPerformanceFactorGetProperties(
+        zes_perf_handle_t hPerf,                        ///< [in] Handle for the Performance Factor domain.
+        zes_perf_properties_t* pProperties              ///< [in,out] Will contain information about the specified Performance
+                                                        ///< Factor domain.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.PerformanceFactor.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.PerformanceFactor, pfnGetPropertiesCb, context.zesDdiTable.PerformanceFactor.pfnGetProperties, hPerf, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.PerformanceFactor, pfnGetPropertiesCb, context.zesDdiTable.PerformanceFactor.pfnGetProperties, hPerf, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.PerformanceFactor.pfnGetProperties, hPerf, pProperties);
+
+        // capture parameters
+        zes_performance_factor_get_properties_params_t tracerParams = {
+            &hPerf,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPerformanceFactorGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPerformanceFactorGetPropertiesCb_t, Sysman.PerformanceFactor, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.PerformanceFactor.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPerf,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPerformanceFactorGetConfig
+    template <>
+    struct APIRecordArgs<zes_performance_factor_get_config_params_t>
+    {
+        static uint32_t get(const zes_performance_factor_get_config_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPerf);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPerformanceFactorGetConfig
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPerformanceFactorGetConfig(
+        zes_perf_handle_t hPerf,                        ///< [in] Handle for the Performance Factor domain.
+        double* pFactor                                 ///< [in,out] Will contain the actual Performance Factor being used by the
+                                                        ///< hardware (may not be the same as the requested Performance Factor).
+        )
+    {
+        auto pfnGetConfig = context.zesDdiTable.PerformanceFactor.pfnGetConfig;
+
+        if( nullptr == pfnGetConfig)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.PerformanceFactor, pfnGetConfigCb, context.zesDdiTable.PerformanceFactor.pfnGetConfig, hPerf, pFactor);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.PerformanceFactor, pfnGetConfigCb, context.zesDdiTable.PerformanceFactor.pfnGetConfig, hPerf, pFactor);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.PerformanceFactor.pfnGetConfig, hPerf, pFactor);
+
+        // capture parameters
+        zes_performance_factor_get_config_params_t tracerParams = {
+            &hPerf,
+            &pFactor
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPerformanceFactorGetConfigCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPerformanceFactorGetConfigCb_t, Sysman.PerformanceFactor, pfnGetConfigCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.PerformanceFactor.pfnGetConfig,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPerf,
+                                                  *tracerParams.ppFactor);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPerformanceFactorSetConfig
+    template <>
+    struct APIRecordArgs<zes_performance_factor_set_config_params_t>
+    {
+        static uint32_t get(const zes_performance_factor_set_config_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPerf);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPerformanceFactorSetConfig
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPerformanceFactorSetConfig(
+        zes_perf_handle_t hPerf,                        ///< [in] Handle for the Performance Factor domain.
+        double factor                                   ///< [in] The new Performance Factor.
+        )
+    {
+        auto pfnSetConfig = context.zesDdiTable.PerformanceFactor.pfnSetConfig;
+
+        if( nullptr == pfnSetConfig)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.PerformanceFactor, pfnSetConfigCb, context.zesDdiTable.PerformanceFactor.pfnSetConfig, hPerf, factor);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.PerformanceFactor, pfnSetConfigCb, context.zesDdiTable.PerformanceFactor.pfnSetConfig, hPerf, factor);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.PerformanceFactor.pfnSetConfig, hPerf, factor);
+
+        // capture parameters
+        zes_performance_factor_set_config_params_t tracerParams = {
+            &hPerf,
+            &factor
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPerformanceFactorSetConfigCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPerformanceFactorSetConfigCb_t, Sysman.PerformanceFactor, pfnSetConfigCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.PerformanceFactor.pfnSetConfig,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPerf,
+                                                  *tracerParams.pfactor);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumPowerDomains
+    template <>
+    struct APIRecordArgs<zes_device_enum_power_domains_params_t>
+    {
+        static uint32_t get(const zes_device_enum_power_domains_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumPowerDomains
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumPowerDomains(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_pwr_handle_t* phPower                       ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumPowerDomains = context.zesDdiTable.Device.pfnEnumPowerDomains;
+
+        if( nullptr == pfnEnumPowerDomains)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumPowerDomainsCb, context.zesDdiTable.Device.pfnEnumPowerDomains, hDevice, pCount, phPower);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumPowerDomainsCb, context.zesDdiTable.Device.pfnEnumPowerDomains, hDevice, pCount, phPower);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumPowerDomains, hDevice, pCount, phPower);
+
+        // capture parameters
+        zes_device_enum_power_domains_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phPower
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumPowerDomainsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumPowerDomainsCb_t, Sysman.Device, pfnEnumPowerDomainsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumPowerDomains,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphPower);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceGetCardPowerDomain
+    template <>
+    struct APIRecordArgs<zes_device_get_card_power_domain_params_t>
+    {
+        static uint32_t get(const zes_device_get_card_power_domain_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceGetCardPowerDomain
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceGetCardPowerDomain(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        zes_pwr_handle_t* phPower                       ///< [in,out] power domain handle for the entire PCIe card.
+        )
+    {
+        auto pfnGetCardPowerDomain = context.zesDdiTable.Device.pfnGetCardPowerDomain;
+
+        if( nullptr == pfnGetCardPowerDomain)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnGetCardPowerDomainCb, context.zesDdiTable.Device.pfnGetCardPowerDomain, hDevice, phPower);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnGetCardPowerDomainCb, context.zesDdiTable.Device.pfnGetCardPowerDomain, hDevice, phPower);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnGetCardPowerDomain, hDevice, phPower);
+
+        // capture parameters
+        zes_device_get_card_power_domain_params_t tracerParams = {
+            &hDevice,
+            &phPower
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceGetCardPowerDomainCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceGetCardPowerDomainCb_t, Sysman.Device, pfnGetCardPowerDomainCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnGetCardPowerDomain,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.pphPower);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPowerGetProperties
+    template <>
+    struct APIRecordArgs<zes_power_get_properties_params_t>
+    {
+        static uint32_t get(const zes_power_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPower);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPowerGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPowerGetProperties(
+        zes_pwr_handle_t hPower,                        ///< [in] Handle for the component.
+        zes_power_properties_t* pProperties             ///< [in,out] Structure that will contain property data.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Power.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Power, pfnGetPropertiesCb, context.zesDdiTable.Power.pfnGetProperties, hPower, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Power, pfnGetPropertiesCb, context.zesDdiTable.Power.pfnGetProperties, hPower, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Power.pfnGetProperties, hPower, pProperties);
+
+        // capture parameters
+        zes_power_get_properties_params_t tracerParams = {
+            &hPower,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPowerGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPowerGetPropertiesCb_t, Sysman.Power, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Power.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPower,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPowerGetEnergyCounter
+    template <>
+    struct APIRecordArgs<zes_power_get_energy_counter_params_t>
+    {
+        static uint32_t get(const zes_power_get_energy_counter_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPower);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPowerGetEnergyCounter
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPowerGetEnergyCounter(
+        zes_pwr_handle_t hPower,                        ///< [in] Handle for the component.
+        zes_power_energy_counter_t* pEnergy             ///< [in,out] Will contain the latest snapshot of the energy counter and
+                                                        ///< timestamp when the last counter value was measured.
+        )
+    {
+        auto pfnGetEnergyCounter = context.zesDdiTable.Power.pfnGetEnergyCounter;
+
+        if( nullptr == pfnGetEnergyCounter)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Power, pfnGetEnergyCounterCb, context.zesDdiTable.Power.pfnGetEnergyCounter, hPower, pEnergy);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Power, pfnGetEnergyCounterCb, context.zesDdiTable.Power.pfnGetEnergyCounter, hPower, pEnergy);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Power.pfnGetEnergyCounter, hPower, pEnergy);
+
+        // capture parameters
+        zes_power_get_energy_counter_params_t tracerParams = {
+            &hPower,
+            &pEnergy
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPowerGetEnergyCounterCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPowerGetEnergyCounterCb_t, Sysman.Power, pfnGetEnergyCounterCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Power.pfnGetEnergyCounter,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPower,
+                                                  *tracerParams.ppEnergy);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPowerGetLimits
+    template <>
+    struct APIRecordArgs<zes_power_get_limits_params_t>
+    {
+        static uint32_t get(const zes_power_get_limits_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPower);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPowerGetLimits
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPowerGetLimits(
+        zes_pwr_handle_t hPower,                        ///< [in] Handle for the component.
+        zes_power_sustained_limit_t* pSustained,        ///< [in,out][optional] The sustained power limit. If this is null, the
+                                                        ///< current sustained power limits will not be returned.
+        zes_power_burst_limit_t* pBurst,                ///< [in,out][optional] The burst power limit. If this is null, the current
+                                                        ///< peak power limits will not be returned.
+        zes_power_peak_limit_t* pPeak                   ///< [in,out][optional] The peak power limit. If this is null, the peak
+                                                        ///< power limits will not be returned.
+        )
+    {
+        auto pfnGetLimits = context.zesDdiTable.Power.pfnGetLimits;
+
+        if( nullptr == pfnGetLimits)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Power, pfnGetLimitsCb, context.zesDdiTable.Power.pfnGetLimits, hPower, pSustained, pBurst, pPeak);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Power, pfnGetLimitsCb, context.zesDdiTable.Power.pfnGetLimits, hPower, pSustained, pBurst, pPeak);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Power.pfnGetLimits, hPower, pSustained, pBurst, pPeak);
+
+        // capture parameters
+        zes_power_get_limits_params_t tracerParams = {
+            &hPower,
+            &pSustained,
+            &pBurst,
+            &pPeak
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPowerGetLimitsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPowerGetLimitsCb_t, Sysman.Power, pfnGetLimitsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Power.pfnGetLimits,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPower,
+                                                  *tracerParams.ppSustained,
+                                                  *tracerParams.ppBurst,
+                                                  *tracerParams.ppPeak);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPowerSetLimits
+    template <>
+    struct APIRecordArgs<zes_power_set_limits_params_t>
+    {
+        static uint32_t get(const zes_power_set_limits_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPower);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPowerSetLimits
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPowerSetLimits(
+        zes_pwr_handle_t hPower,                        ///< [in] Handle for the component.
+        const zes_power_sustained_limit_t* pSustained,  ///< [in][optional] The sustained power limit. If this is null, no changes
+                                                        ///< will be made to the sustained power limits.
+        const zes_power_burst_limit_t* pBurst,          ///< [in][optional] The burst power limit. If this is null, no changes will
+                                                        ///< be made to the burst power limits.
+        const zes_power_peak_limit_t* pPeak             ///< [in][optional] The peak power limit. If this is null, no changes will
+                                                        ///< be made to the peak power limits.
+        )
+    {
+        auto pfnSetLimits = context.zesDdiTable.Power.pfnSetLimits;
+
+        if( nullptr == pfnSetLimits)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Power, pfnSetLimitsCb, context.zesDdiTable.Power.pfnSetLimits, hPower, pSustained, pBurst, pPeak);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Power, pfnSetLimitsCb, context.zesDdiTable.Power.pfnSetLimits, hPower, pSustained, pBurst, pPeak);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Power.pfnSetLimits, hPower, pSustained, pBurst, pPeak);
+
+        // capture parameters
+        zes_power_set_limits_params_t tracerParams = {
+            &hPower,
+            &pSustained,
+            &pBurst,
+            &pPeak
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPowerSetLimitsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPowerSetLimitsCb_t, Sysman.Power, pfnSetLimitsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Power.pfnSetLimits,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPower,
+                                                  *tracerParams.ppSustained,
+                                                  *tracerParams.ppBurst,
+                                                  *tracerParams.ppPeak);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPowerGetEnergyThreshold
+    template <>
+    struct APIRecordArgs<zes_power_get_energy_threshold_params_t>
+    {
+        static uint32_t get(const zes_power_get_energy_threshold_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPower);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPowerGetEnergyThreshold
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPowerGetEnergyThreshold(
+        zes_pwr_handle_t hPower,                        ///< [in] Handle for the component.
+        zes_energy_threshold_t* pThreshold              ///< [in,out] Returns information about the energy threshold setting -
+                                                        ///< enabled/energy threshold/process ID.
+        )
+    {
+        auto pfnGetEnergyThreshold = context.zesDdiTable.Power.pfnGetEnergyThreshold;
+
+        if( nullptr == pfnGetEnergyThreshold)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Power, pfnGetEnergyThresholdCb, context.zesDdiTable.Power.pfnGetEnergyThreshold, hPower, pThreshold);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Power, pfnGetEnergyThresholdCb, context.zesDdiTable.Power.pfnGetEnergyThreshold, hPower, pThreshold);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Power.pfnGetEnergyThreshold, hPower, pThreshold);
+
+        // capture parameters
+        zes_power_get_energy_threshold_params_t tracerParams = {
+            &hPower,
+            &pThreshold
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPowerGetEnergyThresholdCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPowerGetEnergyThresholdCb_t, Sysman.Power, pfnGetEnergyThresholdCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Power.pfnGetEnergyThreshold,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPower,
+                                                  *tracerParams.ppThreshold);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPowerSetEnergyThreshold
+    template <>
+    struct APIRecordArgs<zes_power_set_energy_threshold_params_t>
+    {
+        static uint32_t get(const zes_power_set_energy_threshold_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPower);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPowerSetEnergyThreshold
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPowerSetEnergyThreshold(
+        zes_pwr_handle_t hPower,                        ///< [in] Handle for the component.
+        double threshold                                ///< [in] The energy threshold to be set in joules.
+        )
+    {
+        auto pfnSetEnergyThreshold = context.zesDdiTable.Power.pfnSetEnergyThreshold;
+
+        if( nullptr == pfnSetEnergyThreshold)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Power, pfnSetEnergyThresholdCb, context.zesDdiTable.Power.pfnSetEnergyThreshold, hPower, threshold);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Power, pfnSetEnergyThresholdCb, context.zesDdiTable.Power.pfnSetEnergyThreshold, hPower, threshold);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Power.pfnSetEnergyThreshold, hPower, threshold);
+
+        // capture parameters
+        zes_power_set_energy_threshold_params_t tracerParams = {
+            &hPower,
+            &threshold
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPowerSetEnergyThresholdCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPowerSetEnergyThresholdCb_t, Sysman.Power, pfnSetEnergyThresholdCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Power.pfnSetEnergyThreshold,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPower,
+                                                  *tracerParams.pthreshold);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumPsus
+    template <>
+    struct APIRecordArgs<zes_device_enum_psus_params_t>
+    {
+        static uint32_t get(const zes_device_enum_psus_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumPsus
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumPsus(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_psu_handle_t* phPsu                         ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumPsus = context.zesDdiTable.Device.pfnEnumPsus;
+
+        if( nullptr == pfnEnumPsus)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumPsusCb, context.zesDdiTable.Device.pfnEnumPsus, hDevice, pCount, phPsu);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumPsusCb, context.zesDdiTable.Device.pfnEnumPsus, hDevice, pCount, phPsu);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumPsus, hDevice, pCount, phPsu);
+
+        // capture parameters
+        zes_device_enum_psus_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phPsu
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumPsusCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumPsusCb_t, Sysman.Device, pfnEnumPsusCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumPsus,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphPsu);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPsuGetProperties
+    template <>
+    struct APIRecordArgs<zes_psu_get_properties_params_t>
+    {
+        static uint32_t get(const zes_psu_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPsu);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPsuGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPsuGetProperties(
+        zes_psu_handle_t hPsu,                          ///< [in] Handle for the component.
+        zes_psu_properties_t* pProperties               ///< [in,out] Will contain the properties of the power supply.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Psu.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Psu, pfnGetPropertiesCb, context.zesDdiTable.Psu.pfnGetProperties, hPsu, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Psu, pfnGetPropertiesCb, context.zesDdiTable.Psu.pfnGetProperties, hPsu, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Psu.pfnGetProperties, hPsu, pProperties);
+
+        // capture parameters
+        zes_psu_get_properties_params_t tracerParams = {
+            &hPsu,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPsuGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPsuGetPropertiesCb_t, Sysman.Psu, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Psu.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPsu,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPsuGetState
+    template <>
+    struct APIRecordArgs<zes_psu_get_state_params_t>
+    {
+        static uint32_t get(const zes_psu_get_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPsu);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPsuGetState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPsuGetState(
+        zes_psu_handle_t hPsu,                          ///< [in] Handle for the component.
+        zes_psu_state_t* pState                         ///< [in,out] Will contain the current state of the power supply.
+        )
+    {
+        auto pfnGetState = context.zesDdiTable.Psu.pfnGetState;
+
+        if( nullptr == pfnGetState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Psu, pfnGetStateCb, context.zesDdiTable.Psu.pfnGetState, hPsu, pState);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Psu, pfnGetStateCb, context.zesDdiTable.Psu.pfnGetState, hPsu, pState);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Psu.pfnGetState, hPsu, pState);
+
+        // capture parameters
+        zes_psu_get_state_params_t tracerParams = {
+            &hPsu,
+            &pState
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPsuGetStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPsuGetStateCb_t, Sysman.Psu, pfnGetStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Psu.pfnGetState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPsu,
+                                                  *tracerParams.ppState);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumRasErrorSets
+    template <>
+    struct APIRecordArgs<zes_device_enum_ras_error_sets_params_t>
+    {
+        static uint32_t get(const zes_device_enum_ras_error_sets_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumRasErrorSets
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumRasErrorSets(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_ras_handle_t* phRas                         ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumRasErrorSets = context.zesDdiTable.Device.pfnEnumRasErrorSets;
+
+        if( nullptr == pfnEnumRasErrorSets)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumRasErrorSetsCb, context.zesDdiTable.Device.pfnEnumRasErrorSets, hDevice, pCount, phRas);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumRasErrorSetsCb, context.zesDdiTable.Device.pfnEnumRasErrorSets, hDevice, pCount, phRas);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumRasErrorSets, hDevice, pCount, phRas);
+
+        // capture parameters
+        zes_device_enum_ras_error_sets_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phRas
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumRasErrorSetsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumRasErrorSetsCb_t, Sysman.Device, pfnEnumRasErrorSetsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumRasErrorSets,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphRas);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesRasGetProperties
+    template <>
+    struct APIRecordArgs<zes_ras_get_properties_params_t>
+    {
+        static uint32_t get(const zes_ras_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phRas);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesRasGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesRasGetProperties(
+        zes_ras_handle_t hRas,                          ///< [in] Handle for the component.
+        zes_ras_properties_t* pProperties               ///< [in,out] Structure describing RAS properties
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Ras.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Ras, pfnGetPropertiesCb, context.zesDdiTable.Ras.pfnGetProperties, hRas, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Ras, pfnGetPropertiesCb, context.zesDdiTable.Ras.pfnGetProperties, hRas, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Ras.pfnGetProperties, hRas, pProperties);
+
+        // capture parameters
+        zes_ras_get_properties_params_t tracerParams = {
+            &hRas,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnRasGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnRasGetPropertiesCb_t, Sysman.Ras, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Ras.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phRas,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesRasGetConfig
+    template <>
+    struct APIRecordArgs<zes_ras_get_config_params_t>
+    {
+        static uint32_t get(const zes_ras_get_config_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phRas);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesRasGetConfig
+    __zedlllocal ze_result_t ZE_APICALL
+    zesRasGetConfig(
+        zes_ras_handle_t hRas,                          ///< [in] Handle for the component.
+        zes_ras_config_t* pConfig                       ///< [in,out] Will be populed with the current RAS configuration -
+                                                        ///< thresholds used to trigger events
+        )
+    {
+        auto pfnGetConfig = context.zesDdiTable.Ras.pfnGetConfig;
+
+        if( nullptr == pfnGetConfig)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Ras, pfnGetConfigCb, context.zesDdiTable.Ras.pfnGetConfig, hRas, pConfig);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Ras, pfnGetConfigCb, context.zesDdiTable.Ras.pfnGetConfig, hRas, pConfig);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Ras.pfnGetConfig, hRas, pConfig);
+
+        // capture parameters
+        zes_ras_get_config_params_t tracerParams = {
+            &hRas,
+            &pConfig
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnRasGetConfigCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnRasGetConfigCb_t, Sysman.Ras, pfnGetConfigCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Ras.pfnGetConfig,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phRas,
+                                                  *tracerParams.ppConfig);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesRasSetConfig
+    template <>
+    struct APIRecordArgs<zes_ras_set_config_params_t>
+    {
+        static uint32_t get(const zes_ras_set_config_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phRas);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesRasSetConfig
+    __zedlllocal ze_result_t ZE_APICALL
+    zesRasSetConfig(
+        zes_ras_handle_t hRas,                          ///< [in] Handle for the component.
+        const zes_ras_config_t* pConfig                 ///< [in] Change the RAS configuration - thresholds used to trigger events
+        )
+    {
+        auto pfnSetConfig = context.zesDdiTable.Ras.pfnSetConfig;
+
+        if( nullptr == pfnSetConfig)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Ras, pfnSetConfigCb, context.zesDdiTable.Ras.pfnSetConfig, hRas, pConfig);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Ras, pfnSetConfigCb, context.zesDdiTable.Ras.pfnSetConfig, hRas, pConfig);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Ras.pfnSetConfig, hRas, pConfig);
+
+        // capture parameters
+        zes_ras_set_config_params_t tracerParams = {
+            &hRas,
+            &pConfig
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnRasSetConfigCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnRasSetConfigCb_t, Sysman.Ras, pfnSetConfigCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Ras.pfnSetConfig,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phRas,
+                                                  *tracerParams.ppConfig);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesRasGetState
+    template <>
+    struct APIRecordArgs<zes_ras_get_state_params_t>
+    {
+        static uint32_t get(const zes_ras_get_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phRas);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesRasGetState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesRasGetState(
+        zes_ras_handle_t hRas,                          ///< [in] Handle for the component.
+        ze_bool_t clear,                                ///< [in] Set to 1 to clear the counters of this type
+        zes_ras_state_t* pState                         ///< [in,out] Breakdown of where errors have occurred
+        )
+    {
+        auto pfnGetState = context.zesDdiTable.Ras.pfnGetState;
+
+        if( nullptr == pfnGetState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Ras, pfnGetStateCb, context.zesDdiTable.Ras.pfnGetState, hRas, clear, pState);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Ras, pfnGetStateCb, context.zesDdiTable.Ras.pfnGetState, hRas, clear, pState);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Ras.pfnGetState, hRas, clear, pState);
+
+        // capture parameters
+        zes_ras_get_state_params_t tracerParams = {
+            &hRas,
+            &clear,
+            &pState
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnRasGetStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnRasGetStateCb_t, Sysman.Ras, pfnGetStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Ras.pfnGetState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phRas,
+                                                  *tracerParams.pclear,
+                                                  *tracerParams.ppState);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumSchedulers
+    template <>
+    struct APIRecordArgs<zes_device_enum_schedulers_params_t>
+    {
+        static uint32_t get(const zes_device_enum_schedulers_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumSchedulers
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumSchedulers(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_sched_handle_t* phScheduler                 ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumSchedulers = context.zesDdiTable.Device.pfnEnumSchedulers;
+
+        if( nullptr == pfnEnumSchedulers)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumSchedulersCb, context.zesDdiTable.Device.pfnEnumSchedulers, hDevice, pCount, phScheduler);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumSchedulersCb, context.zesDdiTable.Device.pfnEnumSchedulers, hDevice, pCount, phScheduler);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumSchedulers, hDevice, pCount, phScheduler);
+
+        // capture parameters
+        zes_device_enum_schedulers_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phScheduler
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumSchedulersCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumSchedulersCb_t, Sysman.Device, pfnEnumSchedulersCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumSchedulers,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphScheduler);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesSchedulerGetProperties
+    template <>
+    struct APIRecordArgs<zes_scheduler_get_properties_params_t>
+    {
+        static uint32_t get(const zes_scheduler_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phScheduler);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesSchedulerGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesSchedulerGetProperties(
+        zes_sched_handle_t hScheduler,                  ///< [in] Handle for the component.
+        zes_sched_properties_t* pProperties             ///< [in,out] Structure that will contain property data.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Scheduler.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Scheduler, pfnGetPropertiesCb, context.zesDdiTable.Scheduler.pfnGetProperties, hScheduler, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Scheduler, pfnGetPropertiesCb, context.zesDdiTable.Scheduler.pfnGetProperties, hScheduler, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Scheduler.pfnGetProperties, hScheduler, pProperties);
+
+        // capture parameters
+        zes_scheduler_get_properties_params_t tracerParams = {
+            &hScheduler,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnSchedulerGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnSchedulerGetPropertiesCb_t, Sysman.Scheduler, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Scheduler.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phScheduler,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesSchedulerGetCurrentMode
+    template <>
+    struct APIRecordArgs<zes_scheduler_get_current_mode_params_t>
+    {
+        static uint32_t get(const zes_scheduler_get_current_mode_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phScheduler);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesSchedulerGetCurrentMode
+    __zedlllocal ze_result_t ZE_APICALL
+    zesSchedulerGetCurrentMode(
+        zes_sched_handle_t hScheduler,                  ///< [in] Sysman handle for the component.
+        zes_sched_mode_t* pMode                         ///< [in,out] Will contain the current scheduler mode.
+        )
+    {
+        auto pfnGetCurrentMode = context.zesDdiTable.Scheduler.pfnGetCurrentMode;
+
+        if( nullptr == pfnGetCurrentMode)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Scheduler, pfnGetCurrentModeCb, context.zesDdiTable.Scheduler.pfnGetCurrentMode, hScheduler, pMode);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Scheduler, pfnGetCurrentModeCb, context.zesDdiTable.Scheduler.pfnGetCurrentMode, hScheduler, pMode);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Scheduler.pfnGetCurrentMode, hScheduler, pMode);
+
+        // capture parameters
+        zes_scheduler_get_current_mode_params_t tracerParams = {
+            &hScheduler,
+            &pMode
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnSchedulerGetCurrentModeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnSchedulerGetCurrentModeCb_t, Sysman.Scheduler, pfnGetCurrentModeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Scheduler.pfnGetCurrentMode,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phScheduler,
+                                                  *tracerParams.ppMode);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesSchedulerGetTimeoutModeProperties
+    template <>
+    struct APIRecordArgs<zes_scheduler_get_timeout_mode_properties_params_t>
+    {
+        static uint32_t get(const zes_scheduler_get_timeout_mode_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phScheduler);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesSchedulerGetTimeoutModeProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesSchedulerGetTimeoutModeProperties(
+        zes_sched_handle_t hScheduler,                  ///< [in] Sysman handle for the component.
+        ze_bool_t getDefaults,                          ///< [in] If TRUE, the driver will return the system default properties for
+                                                        ///< this mode, otherwise it will return the current properties.
+        zes_sched_timeout_properties_t* pConfig         ///< [in,out] Will contain the current parameters for this mode.
+        )
+    {
+        auto pfnGetTimeoutModeProperties = context.zesDdiTable.Scheduler.pfnGetTimeoutModeProperties;
+
+        if( nullptr == pfnGetTimeoutModeProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Scheduler, pfnGetTimeoutModePropertiesCb, context.zesDdiTable.Scheduler.pfnGetTimeoutModeProperties, hScheduler, getDefaults, pConfig);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Scheduler, pfnGetTimeoutModePropertiesCb, context.zesDdiTable.Scheduler.pfnGetTimeoutModeProperties, hScheduler, getDefaults, pConfig);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Scheduler.pfnGetTimeoutModeProperties, hScheduler, getDefaults, pConfig);
+
+        // capture parameters
+        zes_scheduler_get_timeout_mode_properties_params_t tracerParams = {
+            &hScheduler,
+            &getDefaults,
+            &pConfig
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnSchedulerGetTimeoutModePropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnSchedulerGetTimeoutModePropertiesCb_t, Sysman.Scheduler, pfnGetTimeoutModePropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Scheduler.pfnGetTimeoutModeProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phScheduler,
+                                                  *tracerParams.pgetDefaults,
+                                                  *tracerParams.ppConfig);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesSchedulerGetTimesliceModeProperties
+    template <>
+    struct APIRecordArgs<zes_scheduler_get_timeslice_mode_properties_params_t>
+    {
+        static uint32_t get(const zes_scheduler_get_timeslice_mode_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phScheduler);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesSchedulerGetTimesliceModeProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesSchedulerGetTimesliceModeProperties(
+        zes_sched_handle_t hScheduler,                  ///< [in] Sysman handle for the component.
+        ze_bool_t getDefaults,                          ///< [in] If TRUE, the driver will return the system default properties for
+                                                        ///< this mode, otherwise it will return the current properties.
+        zes_sched_timeslice_properties_t* pConfig       ///< [in,out] Will contain the current parameters for this mode.
+        )
+    {
+        auto pfnGetTimesliceModeProperties = context.zesDdiTable.Scheduler.pfnGetTimesliceModeProperties;
+
+        if( nullptr == pfnGetTimesliceModeProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Scheduler, pfnGetTimesliceModePropertiesCb, context.zesDdiTable.Scheduler.pfnGetTimesliceModeProperties, hScheduler, getDefaults, pConfig);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Scheduler, pfnGetTimesliceModePropertiesCb, context.zesDdiTable.Scheduler.pfnGetTimesliceModeProperties, hScheduler, getDefaults, pConfig);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Scheduler.pfnGetTimesliceModeProperties, hScheduler, getDefaults, pConfig);
+
+        // capture parameters
+        zes_scheduler_get_timeslice_mode_properties_params_t tracerParams = {
+            &hScheduler,
+            &getDefaults,
+            &pConfig
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnSchedulerGetTimesliceModePropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnSchedulerGetTimesliceModePropertiesCb_t, Sysman.Scheduler, pfnGetTimesliceModePropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Scheduler.pfnGetTimesliceModeProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phScheduler,
+                                                  *tracerParams.pgetDefaults,
+                                                  *tracerParams.ppConfig);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesSchedulerSetTimeoutMode
+    template <>
+    struct APIRecordArgs<zes_scheduler_set_timeout_mode_params_t>
+    {
+        static uint32_t get(const zes_scheduler_set_timeout_mode_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phScheduler);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesSchedulerSetTimeoutMode
+    __zedlllocal ze_result_t ZE_APICALL
+    zesSchedulerSetTimeoutMode(
+        zes_sched_handle_t hScheduler,                  ///< [in] Sysman handle for the component.
+        zes_sched_timeout_properties_t* pProperties,    ///< [in] The properties to use when configurating this mode.
+        ze_bool_t* pNeedReload                          ///< [in,out] Will be set to TRUE if a device driver reload is needed to
+                                                        ///< apply the new scheduler mode.
+        )
+    {
+        auto pfnSetTimeoutMode = context.zesDdiTable.Scheduler.pfnSetTimeoutMode;
+
+        if( nullptr == pfnSetTimeoutMode)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Scheduler, pfnSetTimeoutModeCb, context.zesDdiTable.Scheduler.pfnSetTimeoutMode, hScheduler, pProperties, pNeedReload);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Scheduler, pfnSetTimeoutModeCb, context.zesDdiTable.Scheduler.pfnSetTimeoutMode, hScheduler, pProperties, pNeedReload);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Scheduler.pfnSetTimeoutMode, hScheduler, pProperties, pNeedReload);
+
+        // capture parameters
+        zes_scheduler_set_timeout_mode_params_t tracerParams = {
+            &hScheduler,
+            &pProperties,
+            &pNeedReload
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnSchedulerSetTimeoutModeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnSchedulerSetTimeoutModeCb_t, Sysman.Scheduler, pfnSetTimeoutModeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Scheduler.pfnSetTimeoutMode,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phScheduler,
+                                                  *tracerParams.ppProperties,
+                                                  *tracerParams.ppNeedReload);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesSchedulerSetTimesliceMode
+    template <>
+    struct APIRecordArgs<zes_scheduler_set_timeslice_mode_params_t>
+    {
+        static uint32_t get(const zes_scheduler_set_timeslice_mode_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phScheduler);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesSchedulerSetTimesliceMode
+    __zedlllocal ze_result_t ZE_APICALL
+    zesSchedulerSetTimesliceMode(
+        zes_sched_handle_t hScheduler,                  ///< [in] Sysman handle for the component.
+        zes_sched_timeslice_properties_t* pProperties,  ///< [in] The properties to use when configurating this mode.
+        ze_bool_t* pNeedReload                          ///< [in,out] Will be set to TRUE if a device driver reload is needed to
+                                                        ///< apply the new scheduler mode.
+        )
+    {
+        auto pfnSetTimesliceMode = context.zesDdiTable.Scheduler.pfnSetTimesliceMode;
+
+        if( nullptr == pfnSetTimesliceMode)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Scheduler, pfnSetTimesliceModeCb, context.zesDdiTable.Scheduler.pfnSetTimesliceMode, hScheduler, pProperties, pNeedReload);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Scheduler, pfnSetTimesliceModeCb, context.zesDdiTable.Scheduler.pfnSetTimesliceMode, hScheduler, pProperties, pNeedReload);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Scheduler.pfnSetTimesliceMode, hScheduler, pProperties, pNeedReload);
+
+        // capture parameters
+        zes_scheduler_set_timeslice_mode_params_t tracerParams = {
+            &hScheduler,
+            &pProperties,
+            &pNeedReload
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnSchedulerSetTimesliceModeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnSchedulerSetTimesliceModeCb_t, Sysman.Scheduler, pfnSetTimesliceModeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Scheduler.pfnSetTimesliceMode,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phScheduler,
+                                                  *tracerParams.ppProperties,
+                                                  *tracerParams.ppNeedReload);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesSchedulerSetExclusiveMode
+    template <>
+    struct APIRecordArgs<zes_scheduler_set_exclusive_mode_params_t>
+    {
+        static uint32_t get(const zes_scheduler_set_exclusive_mode_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phScheduler);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesSchedulerSetExclusiveMode
+    __zedlllocal ze_result_t ZE_APICALL
+    zesSchedulerSetExclusiveMode(
+        zes_sched_handle_t hScheduler,                  ///< [in] Sysman handle for the component.
+        ze_bool_t* pNeedReload                          ///< [in,out] Will be set to TRUE if a device driver reload is needed to
+                                                        ///< apply the new scheduler mode.
+        )
+    {
+        auto pfnSetExclusiveMode = context.zesDdiTable.Scheduler.pfnSetExclusiveMode;
+
+        if( nullptr == pfnSetExclusiveMode)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Scheduler, pfnSetExclusiveModeCb, context.zesDdiTable.Scheduler.pfnSetExclusiveMode, hScheduler, pNeedReload);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Scheduler, pfnSetExclusiveModeCb, context.zesDdiTable.Scheduler.pfnSetExclusiveMode, hScheduler, pNeedReload);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Scheduler.pfnSetExclusiveMode, hScheduler, pNeedReload);
+
+        // capture parameters
+        zes_scheduler_set_exclusive_mode_params_t tracerParams = {
+            &hScheduler,
+            &pNeedReload
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnSchedulerSetExclusiveModeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnSchedulerSetExclusiveModeCb_t, Sysman.Scheduler, pfnSetExclusiveModeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Scheduler.pfnSetExclusiveMode,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phScheduler,
+                                                  *tracerParams.ppNeedReload);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesSchedulerSetComputeUnitDebugMode
+    template <>
+    struct APIRecordArgs<zes_scheduler_set_compute_unit_debug_mode_params_t>
+    {
+        static uint32_t get(const zes_scheduler_set_compute_unit_debug_mode_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phScheduler);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesSchedulerSetComputeUnitDebugMode
+    __zedlllocal ze_result_t ZE_APICALL
+    zesSchedulerSetComputeUnitDebugMode(
+        zes_sched_handle_t hScheduler,                  ///< [in] Sysman handle for the component.
+        ze_bool_t* pNeedReload                          ///< [in,out] Will be set to TRUE if a device driver reload is needed to
+                                                        ///< apply the new scheduler mode.
+        )
+    {
+        auto pfnSetComputeUnitDebugMode = context.zesDdiTable.Scheduler.pfnSetComputeUnitDebugMode;
+
+        if( nullptr == pfnSetComputeUnitDebugMode)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Scheduler, pfnSetComputeUnitDebugModeCb, context.zesDdiTable.Scheduler.pfnSetComputeUnitDebugMode, hScheduler, pNeedReload);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Scheduler, pfnSetComputeUnitDebugModeCb, context.zesDdiTable.Scheduler.pfnSetComputeUnitDebugMode, hScheduler, pNeedReload);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Scheduler.pfnSetComputeUnitDebugMode, hScheduler, pNeedReload);
+
+        // capture parameters
+        zes_scheduler_set_compute_unit_debug_mode_params_t tracerParams = {
+            &hScheduler,
+            &pNeedReload
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnSchedulerSetComputeUnitDebugModeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnSchedulerSetComputeUnitDebugModeCb_t, Sysman.Scheduler, pfnSetComputeUnitDebugModeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Scheduler.pfnSetComputeUnitDebugMode,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phScheduler,
+                                                  *tracerParams.ppNeedReload);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumStandbyDomains
+    template <>
+    struct APIRecordArgs<zes_device_enum_standby_domains_params_t>
+    {
+        static uint32_t get(const zes_device_enum_standby_domains_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumStandbyDomains
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumStandbyDomains(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_standby_handle_t* phStandby                 ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumStandbyDomains = context.zesDdiTable.Device.pfnEnumStandbyDomains;
+
+        if( nullptr == pfnEnumStandbyDomains)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumStandbyDomainsCb, context.zesDdiTable.Device.pfnEnumStandbyDomains, hDevice, pCount, phStandby);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumStandbyDomainsCb, context.zesDdiTable.Device.pfnEnumStandbyDomains, hDevice, pCount, phStandby);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumStandbyDomains, hDevice, pCount, phStandby);
+
+        // capture parameters
+        zes_device_enum_standby_domains_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phStandby
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumStandbyDomainsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumStandbyDomainsCb_t, Sysman.Device, pfnEnumStandbyDomainsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumStandbyDomains,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphStandby);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesStandbyGetProperties
+    template <>
+    struct APIRecordArgs<zes_standby_get_properties_params_t>
+    {
+        static uint32_t get(const zes_standby_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phStandby);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesStandbyGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesStandbyGetProperties(
+        zes_standby_handle_t hStandby,                  ///< [in] Handle for the component.
+        zes_standby_properties_t* pProperties           ///< [in,out] Will contain the standby hardware properties.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Standby.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Standby, pfnGetPropertiesCb, context.zesDdiTable.Standby.pfnGetProperties, hStandby, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Standby, pfnGetPropertiesCb, context.zesDdiTable.Standby.pfnGetProperties, hStandby, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Standby.pfnGetProperties, hStandby, pProperties);
+
+        // capture parameters
+        zes_standby_get_properties_params_t tracerParams = {
+            &hStandby,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnStandbyGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnStandbyGetPropertiesCb_t, Sysman.Standby, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Standby.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phStandby,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesStandbyGetMode
+    template <>
+    struct APIRecordArgs<zes_standby_get_mode_params_t>
+    {
+        static uint32_t get(const zes_standby_get_mode_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phStandby);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesStandbyGetMode
+    __zedlllocal ze_result_t ZE_APICALL
+    zesStandbyGetMode(
+        zes_standby_handle_t hStandby,                  ///< [in] Handle for the component.
+        zes_standby_promo_mode_t* pMode                 ///< [in,out] Will contain the current standby mode.
+        )
+    {
+        auto pfnGetMode = context.zesDdiTable.Standby.pfnGetMode;
+
+        if( nullptr == pfnGetMode)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Standby, pfnGetModeCb, context.zesDdiTable.Standby.pfnGetMode, hStandby, pMode);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Standby, pfnGetModeCb, context.zesDdiTable.Standby.pfnGetMode, hStandby, pMode);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Standby.pfnGetMode, hStandby, pMode);
+
+        // capture parameters
+        zes_standby_get_mode_params_t tracerParams = {
+            &hStandby,
+            &pMode
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnStandbyGetModeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnStandbyGetModeCb_t, Sysman.Standby, pfnGetModeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Standby.pfnGetMode,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phStandby,
+                                                  *tracerParams.ppMode);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesStandbySetMode
+    template <>
+    struct APIRecordArgs<zes_standby_set_mode_params_t>
+    {
+        static uint32_t get(const zes_standby_set_mode_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phStandby);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesStandbySetMode
+    __zedlllocal ze_result_t ZE_APICALL
+    zesStandbySetMode(
+        zes_standby_handle_t hStandby,                  ///< [in] Handle for the component.
+        zes_standby_promo_mode_t mode                   ///< [in] New standby mode.
+        )
+    {
+        auto pfnSetMode = context.zesDdiTable.Standby.pfnSetMode;
+
+        if( nullptr == pfnSetMode)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Standby, pfnSetModeCb, context.zesDdiTable.Standby.pfnSetMode, hStandby, mode);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Standby, pfnSetModeCb, context.zesDdiTable.Standby.pfnSetMode, hStandby, mode);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Standby.pfnSetMode, hStandby, mode);
+
+        // capture parameters
+        zes_standby_set_mode_params_t tracerParams = {
+            &hStandby,
+            &mode
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnStandbySetModeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnStandbySetModeCb_t, Sysman.Standby, pfnSetModeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Standby.pfnSetMode,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phStandby,
+                                                  *tracerParams.pmode);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesDeviceEnumTemperatureSensors
+    template <>
+    struct APIRecordArgs<zes_device_enum_temperature_sensors_params_t>
+    {
+        static uint32_t get(const zes_device_enum_temperature_sensors_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesDeviceEnumTemperatureSensors
+    __zedlllocal ze_result_t ZE_APICALL
+    zesDeviceEnumTemperatureSensors(
+        zes_device_handle_t hDevice,                    ///< [in] Sysman handle of the device.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of components of this type.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of components of this type that are available.
+                                                        ///< if count is greater than the number of components of this type that
+                                                        ///< are available, then the driver shall update the value with the correct
+                                                        ///< number of components.
+        zes_temp_handle_t* phTemperature                ///< [in,out][optional][range(0, *pCount)] array of handle of components of
+                                                        ///< this type.
+                                                        ///< if count is less than the number of components of this type that are
+                                                        ///< available, then the driver shall only retrieve that number of
+                                                        ///< component handles.
+        )
+    {
+        auto pfnEnumTemperatureSensors = context.zesDdiTable.Device.pfnEnumTemperatureSensors;
+
+        if( nullptr == pfnEnumTemperatureSensors)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Device, pfnEnumTemperatureSensorsCb, context.zesDdiTable.Device.pfnEnumTemperatureSensors, hDevice, pCount, phTemperature);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Device, pfnEnumTemperatureSensorsCb, context.zesDdiTable.Device.pfnEnumTemperatureSensors, hDevice, pCount, phTemperature);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Device.pfnEnumTemperatureSensors, hDevice, pCount, phTemperature);
+
+        // capture parameters
+        zes_device_enum_temperature_sensors_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phTemperature
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnDeviceEnumTemperatureSensorsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnDeviceEnumTemperatureSensorsCb_t, Sysman.Device, pfnEnumTemperatureSensorsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Device.pfnEnumTemperatureSensors,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphTemperature);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesTemperatureGetProperties
+    template <>
+    struct APIRecordArgs<zes_temperature_get_properties_params_t>
+    {
+        static uint32_t get(const zes_temperature_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phTemperature);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesTemperatureGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zesTemperatureGetProperties(
+        zes_temp_handle_t hTemperature,                 ///< [in] Handle for the component.
+        zes_temp_properties_t* pProperties              ///< [in,out] Will contain the temperature sensor properties.
+        )
+    {
+        auto pfnGetProperties = context.zesDdiTable.Temperature.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Temperature, pfnGetPropertiesCb, context.zesDdiTable.Temperature.pfnGetProperties, hTemperature, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Temperature, pfnGetPropertiesCb, context.zesDdiTable.Temperature.pfnGetProperties, hTemperature, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Temperature.pfnGetProperties, hTemperature, pProperties);
+
+        // capture parameters
+        zes_temperature_get_properties_params_t tracerParams = {
+            &hTemperature,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnTemperatureGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnTemperatureGetPropertiesCb_t, Sysman.Temperature, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Temperature.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phTemperature,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesTemperatureGetConfig
+    template <>
+    struct APIRecordArgs<zes_temperature_get_config_params_t>
+    {
+        static uint32_t get(const zes_temperature_get_config_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phTemperature);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesTemperatureGetConfig
+    __zedlllocal ze_result_t ZE_APICALL
+    zesTemperatureGetConfig(
+        zes_temp_handle_t hTemperature,                 ///< [in] Handle for the component.
+        zes_temp_config_t* pConfig                      ///< [in,out] Returns current configuration.
+        )
+    {
+        auto pfnGetConfig = context.zesDdiTable.Temperature.pfnGetConfig;
+
+        if( nullptr == pfnGetConfig)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Temperature, pfnGetConfigCb, context.zesDdiTable.Temperature.pfnGetConfig, hTemperature, pConfig);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Temperature, pfnGetConfigCb, context.zesDdiTable.Temperature.pfnGetConfig, hTemperature, pConfig);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Temperature.pfnGetConfig, hTemperature, pConfig);
+
+        // capture parameters
+        zes_temperature_get_config_params_t tracerParams = {
+            &hTemperature,
+            &pConfig
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnTemperatureGetConfigCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnTemperatureGetConfigCb_t, Sysman.Temperature, pfnGetConfigCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Temperature.pfnGetConfig,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phTemperature,
+                                                  *tracerParams.ppConfig);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesTemperatureSetConfig
+    template <>
+    struct APIRecordArgs<zes_temperature_set_config_params_t>
+    {
+        static uint32_t get(const zes_temperature_set_config_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phTemperature);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesTemperatureSetConfig
+    __zedlllocal ze_result_t ZE_APICALL
+    zesTemperatureSetConfig(
+        zes_temp_handle_t hTemperature,                 ///< [in] Handle for the component.
+        const zes_temp_config_t* pConfig                ///< [in] New configuration.
+        )
+    {
+        auto pfnSetConfig = context.zesDdiTable.Temperature.pfnSetConfig;
+
+        if( nullptr == pfnSetConfig)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Temperature, pfnSetConfigCb, context.zesDdiTable.Temperature.pfnSetConfig, hTemperature, pConfig);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Temperature, pfnSetConfigCb, context.zesDdiTable.Temperature.pfnSetConfig, hTemperature, pConfig);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Temperature.pfnSetConfig, hTemperature, pConfig);
+
+        // capture parameters
+        zes_temperature_set_config_params_t tracerParams = {
+            &hTemperature,
+            &pConfig
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnTemperatureSetConfigCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnTemperatureSetConfigCb_t, Sysman.Temperature, pfnSetConfigCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Temperature.pfnSetConfig,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phTemperature,
+                                                  *tracerParams.ppConfig);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesTemperatureGetState
+    template <>
+    struct APIRecordArgs<zes_temperature_get_state_params_t>
+    {
+        static uint32_t get(const zes_temperature_get_state_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phTemperature);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesTemperatureGetState
+    __zedlllocal ze_result_t ZE_APICALL
+    zesTemperatureGetState(
+        zes_temp_handle_t hTemperature,                 ///< [in] Handle for the component.
+        double* pTemperature                            ///< [in,out] Will contain the temperature read from the specified sensor
+                                                        ///< in degrees Celsius.
+        )
+    {
+        auto pfnGetState = context.zesDdiTable.Temperature.pfnGetState;
+
+        if( nullptr == pfnGetState)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Temperature, pfnGetStateCb, context.zesDdiTable.Temperature.pfnGetState, hTemperature, pTemperature);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Temperature, pfnGetStateCb, context.zesDdiTable.Temperature.pfnGetState, hTemperature, pTemperature);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Temperature.pfnGetState, hTemperature, pTemperature);
+
+        // capture parameters
+        zes_temperature_get_state_params_t tracerParams = {
+            &hTemperature,
+            &pTemperature
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnTemperatureGetStateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnTemperatureGetStateCb_t, Sysman.Temperature, pfnGetStateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Temperature.pfnGetState,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phTemperature,
+                                                  *tracerParams.ppTemperature);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPowerGetLimitsExt
+    template <>
+    struct APIRecordArgs<zes_power_get_limits_ext_params_t>
+    {
+        static uint32_t get(const zes_power_get_limits_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPower);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPowerGetLimitsExt
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPowerGetLimitsExt(
+        zes_pwr_handle_t hPower,                        ///< [in] Power domain handle instance.
+        uint32_t* pCount,                               ///< [in,out] Pointer to the number of power limit descriptors. If count is
+                                                        ///< zero, then the driver shall update the value with the total number of
+                                                        ///< components of this type that are available. If count is greater than
+                                                        ///< the number of components of this type that are available, then the
+                                                        ///< driver shall update the value with the correct number of components.
+        zes_power_limit_ext_desc_t* pSustained          ///< [in,out][optional][range(0, *pCount)] Array of query results for power
+                                                        ///< limit descriptors. If count is less than the number of components of
+                                                        ///< this type that are available, then the driver shall only retrieve that
+                                                        ///< number of components.
+        )
+    {
+        auto pfnGetLimitsExt = context.zesDdiTable.Power.pfnGetLimitsExt;
+
+        if( nullptr == pfnGetLimitsExt)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Power, pfnGetLimitsExtCb, context.zesDdiTable.Power.pfnGetLimitsExt, hPower, pCount, pSustained);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Power, pfnGetLimitsExtCb, context.zesDdiTable.Power.pfnGetLimitsExt, hPower, pCount, pSustained);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Power.pfnGetLimitsExt, hPower, pCount, pSustained);
+
+        // capture parameters
+        zes_power_get_limits_ext_params_t tracerParams = {
+            &hPower,
+            &pCount,
+            &pSustained
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPowerGetLimitsExtCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPowerGetLimitsExtCb_t, Sysman.Power, pfnGetLimitsExtCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Power.pfnGetLimitsExt,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPower,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.ppSustained);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesPowerSetLimitsExt
+    template <>
+    struct APIRecordArgs<zes_power_set_limits_ext_params_t>
+    {
+        static uint32_t get(const zes_power_set_limits_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phPower);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesPowerSetLimitsExt
+    __zedlllocal ze_result_t ZE_APICALL
+    zesPowerSetLimitsExt(
+        zes_pwr_handle_t hPower,                        ///< [in] Handle for the component.
+        uint32_t* pCount,                               ///< [in] Pointer to the number of power limit descriptors.
+        zes_power_limit_ext_desc_t* pSustained          ///< [in][optional][range(0, *pCount)] Array of power limit descriptors.
+        )
+    {
+        auto pfnSetLimitsExt = context.zesDdiTable.Power.pfnSetLimitsExt;
+
+        if( nullptr == pfnSetLimitsExt)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Power, pfnSetLimitsExtCb, context.zesDdiTable.Power.pfnSetLimitsExt, hPower, pCount, pSustained);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Power, pfnSetLimitsExtCb, context.zesDdiTable.Power.pfnSetLimitsExt, hPower, pCount, pSustained);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Power.pfnSetLimitsExt, hPower, pCount, pSustained);
+
+        // capture parameters
+        zes_power_set_limits_ext_params_t tracerParams = {
+            &hPower,
+            &pCount,
+            &pSustained
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnPowerSetLimitsExtCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnPowerSetLimitsExtCb_t, Sysman.Power, pfnSetLimitsExtCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Power.pfnSetLimitsExt,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phPower,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.ppSustained);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesEngineGetActivityExt
+    template <>
+    struct APIRecordArgs<zes_engine_get_activity_ext_params_t>
+    {
+        static uint32_t get(const zes_engine_get_activity_ext_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phEngine);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesEngineGetActivityExt
+    __zedlllocal ze_result_t ZE_APICALL
+    zesEngineGetActivityExt(
+        zes_engine_handle_t hEngine,                    ///< [in] Handle for the component.
+        uint32_t* pCount,                               ///< [in,out] Pointer to the number of VF engine stats descriptors.
+                                                        ///<  - if count is zero, the driver shall update the value with the total
+                                                        ///< number of engine stats available.
+                                                        ///<  - if count is greater than the total number of engine stats
+                                                        ///< available, the driver shall update the value with the correct number
+                                                        ///< of engine stats available.
+                                                        ///<  - The count returned is the sum of number of VF instances currently
+                                                        ///< available and the PF instance.
+        zes_engine_stats_t* pStats                      ///< [in,out][optional][range(0, *pCount)] array of engine group activity counters.
+                                                        ///<  - if count is less than the total number of engine stats available,
+                                                        ///< then driver shall only retrieve that number of stats.
+                                                        ///<  - the implementation shall populate the vector with engine stat for
+                                                        ///< PF at index 0 of the vector followed by user provided pCount-1 number
+                                                        ///< of VF engine stats.
+        )
+    {
+        auto pfnGetActivityExt = context.zesDdiTable.Engine.pfnGetActivityExt;
+
+        if( nullptr == pfnGetActivityExt)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Engine, pfnGetActivityExtCb, context.zesDdiTable.Engine.pfnGetActivityExt, hEngine, pCount, pStats);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Engine, pfnGetActivityExtCb, context.zesDdiTable.Engine.pfnGetActivityExt, hEngine, pCount, pStats);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.Engine.pfnGetActivityExt, hEngine, pCount, pStats);
+
+        // capture parameters
+        zes_engine_get_activity_ext_params_t tracerParams = {
+            &hEngine,
+            &pCount,
+            &pStats
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnEngineGetActivityExtCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnEngineGetActivityExtCb_t, Sysman.Engine, pfnGetActivityExtCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.Engine.pfnGetActivityExt,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phEngine,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.ppStats);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesRasGetStateExp
+    template <>
+    struct APIRecordArgs<zes_ras_get_state_exp_params_t>
+    {
+        static uint32_t get(const zes_ras_get_state_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phRas);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesRasGetStateExp
+    __zedlllocal ze_result_t ZE_APICALL
+    zesRasGetStateExp(
+        zes_ras_handle_t hRas,                          ///< [in] Handle for the component.
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of RAS state structures that can be retrieved.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of error categories for which state can be retrieved.
+                                                        ///< if count is greater than the number of RAS states available, then the
+                                                        ///< driver shall update the value with the correct number of RAS states available.
+        zes_ras_state_exp_t* pState                     ///< [in,out][optional][range(0, *pCount)] array of query results for RAS
+                                                        ///< error states for different categories.
+                                                        ///< if count is less than the number of RAS states available, then driver
+                                                        ///< shall only retrieve that number of RAS states.
+        )
+    {
+        auto pfnGetStateExp = context.zesDdiTable.RasExp.pfnGetStateExp;
+
+        if( nullptr == pfnGetStateExp)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Ras, pfnGetStateExpCb, context.zesDdiTable.RasExp.pfnGetStateExp, hRas, pCount, pState);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Ras, pfnGetStateExpCb, context.zesDdiTable.RasExp.pfnGetStateExp, hRas, pCount, pState);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.RasExp.pfnGetStateExp, hRas, pCount, pState);
+
+        // capture parameters
+        zes_ras_get_state_exp_params_t tracerParams = {
+            &hRas,
+            &pCount,
+            &pState
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnRasGetStateExpCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnRasGetStateExpCb_t, Sysman.Ras, pfnGetStateExpCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.RasExp.pfnGetStateExp,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phRas,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.ppState);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zesRasClearStateExp
+    template <>
+    struct APIRecordArgs<zes_ras_clear_state_exp_params_t>
+    {
+        static uint32_t get(const zes_ras_clear_state_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phRas);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zesRasClearStateExp
+    __zedlllocal ze_result_t ZE_APICALL
+    zesRasClearStateExp(
+        zes_ras_handle_t hRas,                          ///< [in] Handle for the component.
+        zes_ras_error_category_exp_t category           ///< [in] category for which error counter is to be cleared.
+        )
+    {
+        auto pfnClearStateExp = context.zesDdiTable.RasExp.pfnClearStateExp;
+
+        if( nullptr == pfnClearStateExp)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Sysman.Ras, pfnClearStateExpCb, context.zesDdiTable.RasExp.pfnClearStateExp, hRas, category);
+
+        ZE_HANDLE_UNSAMPLED_API(Sysman.Ras, pfnClearStateExpCb, context.zesDdiTable.RasExp.pfnClearStateExp, hRas, category);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zesDdiTable.RasExp.pfnClearStateExp, hRas, category);
+
+        // capture parameters
+        zes_ras_clear_state_exp_params_t tracerParams = {
+            &hRas,
+            &category
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zes_pfnRasClearStateExpCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zes_pfnRasClearStateExpCb_t, Sysman.Ras, pfnClearStateExpCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zesDdiTable.RasExp.pfnClearStateExp,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phRas,
+                                                  *tracerParams.pcategory);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Names of the traced APIs and of their recorded arguments
+    const api_record_desc_t zesApiRecordDescs[] = {
+        {ZE_TRACER_API_INDEX(Sysman.Global, pfnInitCb), "zesInit", ""},
+        {ZE_TRACER_API_INDEX(Sysman.Driver, pfnGetCb), "zesDriverGet", ""},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnGetCb), "zesDeviceGet", "hDriver"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnGetPropertiesCb), "zesDeviceGetProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnGetStateCb), "zesDeviceGetState", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnResetCb), "zesDeviceReset", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnResetExtCb), "zesDeviceResetExt", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnProcessesGetStateCb), "zesDeviceProcessesGetState", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnPciGetPropertiesCb), "zesDevicePciGetProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnPciGetStateCb), "zesDevicePciGetState", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnPciGetBarsCb), "zesDevicePciGetBars", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnPciGetStatsCb), "zesDevicePciGetStats", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnSetOverclockWaiverCb), "zesDeviceSetOverclockWaiver", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnGetOverclockDomainsCb), "zesDeviceGetOverclockDomains", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnGetOverclockControlsCb), "zesDeviceGetOverclockControls", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnResetOverclockSettingsCb), "zesDeviceResetOverclockSettings", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnReadOverclockStateCb), "zesDeviceReadOverclockState", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumOverclockDomainsCb), "zesDeviceEnumOverclockDomains", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Overclock, pfnGetDomainPropertiesCb), "zesOverclockGetDomainProperties", "hDomainHandle"},
+        {ZE_TRACER_API_INDEX(Sysman.Overclock, pfnGetDomainVFPropertiesCb), "zesOverclockGetDomainVFProperties", "hDomainHandle"},
+        {ZE_TRACER_API_INDEX(Sysman.Overclock, pfnGetDomainControlPropertiesCb), "zesOverclockGetDomainControlProperties", "hDomainHandle"},
+        {ZE_TRACER_API_INDEX(Sysman.Overclock, pfnGetControlCurrentValueCb), "zesOverclockGetControlCurrentValue", "hDomainHandle"},
+        {ZE_TRACER_API_INDEX(Sysman.Overclock, pfnGetControlPendingValueCb), "zesOverclockGetControlPendingValue", "hDomainHandle"},
+        {ZE_TRACER_API_INDEX(Sysman.Overclock, pfnSetControlUserValueCb), "zesOverclockSetControlUserValue", "hDomainHandle"},
+        {ZE_TRACER_API_INDEX(Sysman.Overclock, pfnGetControlStateCb), "zesOverclockGetControlState", "hDomainHandle"},
+        {ZE_TRACER_API_INDEX(Sysman.Overclock, pfnGetVFPointValuesCb), "zesOverclockGetVFPointValues", "hDomainHandle,PointIndex"},
+        {ZE_TRACER_API_INDEX(Sysman.Overclock, pfnSetVFPointValuesCb), "zesOverclockSetVFPointValues", "hDomainHandle,PointIndex,PointValue"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumDiagnosticTestSuitesCb), "zesDeviceEnumDiagnosticTestSuites", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Diagnostics, pfnGetPropertiesCb), "zesDiagnosticsGetProperties", "hDiagnostics"},
+        {ZE_TRACER_API_INDEX(Sysman.Diagnostics, pfnGetTestsCb), "zesDiagnosticsGetTests", "hDiagnostics"},
+        {ZE_TRACER_API_INDEX(Sysman.Diagnostics, pfnRunTestsCb), "zesDiagnosticsRunTests", "hDiagnostics,startIndex,endIndex"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEccAvailableCb), "zesDeviceEccAvailable", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEccConfigurableCb), "zesDeviceEccConfigurable", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnGetEccStateCb), "zesDeviceGetEccState", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnSetEccStateCb), "zesDeviceSetEccState", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumEngineGroupsCb), "zesDeviceEnumEngineGroups", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Engine, pfnGetPropertiesCb), "zesEngineGetProperties", "hEngine"},
+        {ZE_TRACER_API_INDEX(Sysman.Engine, pfnGetActivityCb), "zesEngineGetActivity", "hEngine"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEventRegisterCb), "zesDeviceEventRegister", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Driver, pfnEventListenCb), "zesDriverEventListen", "hDriver,timeout,count"},
+        {ZE_TRACER_API_INDEX(Sysman.Driver, pfnEventListenExCb), "zesDriverEventListenEx", "hDriver,timeout,count"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumFabricPortsCb), "zesDeviceEnumFabricPorts", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.FabricPort, pfnGetPropertiesCb), "zesFabricPortGetProperties", "hPort"},
+        {ZE_TRACER_API_INDEX(Sysman.FabricPort, pfnGetLinkTypeCb), "zesFabricPortGetLinkType", "hPort"},
+        {ZE_TRACER_API_INDEX(Sysman.FabricPort, pfnGetConfigCb), "zesFabricPortGetConfig", "hPort"},
+        {ZE_TRACER_API_INDEX(Sysman.FabricPort, pfnSetConfigCb), "zesFabricPortSetConfig", "hPort"},
+        {ZE_TRACER_API_INDEX(Sysman.FabricPort, pfnGetStateCb), "zesFabricPortGetState", "hPort"},
+        {ZE_TRACER_API_INDEX(Sysman.FabricPort, pfnGetThroughputCb), "zesFabricPortGetThroughput", "hPort"},
+        {ZE_TRACER_API_INDEX(Sysman.FabricPort, pfnGetFabricErrorCountersCb), "zesFabricPortGetFabricErrorCounters", "hPort"},
+        {ZE_TRACER_API_INDEX(Sysman.FabricPort, pfnGetMultiPortThroughputCb), "zesFabricPortGetMultiPortThroughput", "hDevice,numPorts"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumFansCb), "zesDeviceEnumFans", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Fan, pfnGetPropertiesCb), "zesFanGetProperties", "hFan"},
+        {ZE_TRACER_API_INDEX(Sysman.Fan, pfnGetConfigCb), "zesFanGetConfig", "hFan"},
+        {ZE_TRACER_API_INDEX(Sysman.Fan, pfnSetDefaultModeCb), "zesFanSetDefaultMode", "hFan"},
+        {ZE_TRACER_API_INDEX(Sysman.Fan, pfnSetFixedSpeedModeCb), "zesFanSetFixedSpeedMode", "hFan"},
+        {ZE_TRACER_API_INDEX(Sysman.Fan, pfnSetSpeedTableModeCb), "zesFanSetSpeedTableMode", "hFan"},
+        {ZE_TRACER_API_INDEX(Sysman.Fan, pfnGetStateCb), "zesFanGetState", "hFan"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumFirmwaresCb), "zesDeviceEnumFirmwares", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Firmware, pfnGetPropertiesCb), "zesFirmwareGetProperties", "hFirmware"},
+        {ZE_TRACER_API_INDEX(Sysman.Firmware, pfnFlashCb), "zesFirmwareFlash", "hFirmware,size"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumFrequencyDomainsCb), "zesDeviceEnumFrequencyDomains", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnGetPropertiesCb), "zesFrequencyGetProperties", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnGetAvailableClocksCb), "zesFrequencyGetAvailableClocks", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnGetRangeCb), "zesFrequencyGetRange", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnSetRangeCb), "zesFrequencySetRange", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnGetStateCb), "zesFrequencyGetState", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnGetThrottleTimeCb), "zesFrequencyGetThrottleTime", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnOcGetCapabilitiesCb), "zesFrequencyOcGetCapabilities", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnOcGetFrequencyTargetCb), "zesFrequencyOcGetFrequencyTarget", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnOcSetFrequencyTargetCb), "zesFrequencyOcSetFrequencyTarget", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnOcGetVoltageTargetCb), "zesFrequencyOcGetVoltageTarget", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnOcSetVoltageTargetCb), "zesFrequencyOcSetVoltageTarget", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnOcSetModeCb), "zesFrequencyOcSetMode", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnOcGetModeCb), "zesFrequencyOcGetMode", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnOcGetIccMaxCb), "zesFrequencyOcGetIccMax", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnOcSetIccMaxCb), "zesFrequencyOcSetIccMax", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnOcGetTjMaxCb), "zesFrequencyOcGetTjMax", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Frequency, pfnOcSetTjMaxCb), "zesFrequencyOcSetTjMax", "hFrequency"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumLedsCb), "zesDeviceEnumLeds", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Led, pfnGetPropertiesCb), "zesLedGetProperties", "hLed"},
+        {ZE_TRACER_API_INDEX(Sysman.Led, pfnGetStateCb), "zesLedGetState", "hLed"},
+        {ZE_TRACER_API_INDEX(Sysman.Led, pfnSetStateCb), "zesLedSetState", "hLed"},
+        {ZE_TRACER_API_INDEX(Sysman.Led, pfnSetColorCb), "zesLedSetColor", "hLed"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumMemoryModulesCb), "zesDeviceEnumMemoryModules", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Memory, pfnGetPropertiesCb), "zesMemoryGetProperties", "hMemory"},
+        {ZE_TRACER_API_INDEX(Sysman.Memory, pfnGetStateCb), "zesMemoryGetState", "hMemory"},
+        {ZE_TRACER_API_INDEX(Sysman.Memory, pfnGetBandwidthCb), "zesMemoryGetBandwidth", "hMemory"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumPerformanceFactorDomainsCb), "zesDeviceEnumPerformanceFactorDomains", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.PerformanceFactor, pfnGetPropertiesCb), "zesPerformanceFactorGetProperties", "hPerf"},
+        {ZE_TRACER_API_INDEX(Sysman.PerformanceFactor, pfnGetConfigCb), "zesPerformanceFactorGetConfig", "hPerf"},
+        {ZE_TRACER_API_INDEX(Sysman.PerformanceFactor, pfnSetConfigCb), "zesPerformanceFactorSetConfig", "hPerf"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumPowerDomainsCb), "zesDeviceEnumPowerDomains", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnGetCardPowerDomainCb), "zesDeviceGetCardPowerDomain", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Power, pfnGetPropertiesCb), "zesPowerGetProperties", "hPower"},
+        {ZE_TRACER_API_INDEX(Sysman.Power, pfnGetEnergyCounterCb), "zesPowerGetEnergyCounter", "hPower"},
+        {ZE_TRACER_API_INDEX(Sysman.Power, pfnGetLimitsCb), "zesPowerGetLimits", "hPower"},
+        {ZE_TRACER_API_INDEX(Sysman.Power, pfnSetLimitsCb), "zesPowerSetLimits", "hPower"},
+        {ZE_TRACER_API_INDEX(Sysman.Power, pfnGetEnergyThresholdCb), "zesPowerGetEnergyThreshold", "hPower"},
+        {ZE_TRACER_API_INDEX(Sysman.Power, pfnSetEnergyThresholdCb), "zesPowerSetEnergyThreshold", "hPower"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumPsusCb), "zesDeviceEnumPsus", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Psu, pfnGetPropertiesCb), "zesPsuGetProperties", "hPsu"},
+        {ZE_TRACER_API_INDEX(Sysman.Psu, pfnGetStateCb), "zesPsuGetState", "hPsu"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumRasErrorSetsCb), "zesDeviceEnumRasErrorSets", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Ras, pfnGetPropertiesCb), "zesRasGetProperties", "hRas"},
+        {ZE_TRACER_API_INDEX(Sysman.Ras, pfnGetConfigCb), "zesRasGetConfig", "hRas"},
+        {ZE_TRACER_API_INDEX(Sysman.Ras, pfnSetConfigCb), "zesRasSetConfig", "hRas"},
+        {ZE_TRACER_API_INDEX(Sysman.Ras, pfnGetStateCb), "zesRasGetState", "hRas"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumSchedulersCb), "zesDeviceEnumSchedulers", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Scheduler, pfnGetPropertiesCb), "zesSchedulerGetProperties", "hScheduler"},
+        {ZE_TRACER_API_INDEX(Sysman.Scheduler, pfnGetCurrentModeCb), "zesSchedulerGetCurrentMode", "hScheduler"},
+        {ZE_TRACER_API_INDEX(Sysman.Scheduler, pfnGetTimeoutModePropertiesCb), "zesSchedulerGetTimeoutModeProperties", "hScheduler"},
+        {ZE_TRACER_API_INDEX(Sysman.Scheduler, pfnGetTimesliceModePropertiesCb), "zesSchedulerGetTimesliceModeProperties", "hScheduler"},
+        {ZE_TRACER_API_INDEX(Sysman.Scheduler, pfnSetTimeoutModeCb), "zesSchedulerSetTimeoutMode", "hScheduler"},
+        {ZE_TRACER_API_INDEX(Sysman.Scheduler, pfnSetTimesliceModeCb), "zesSchedulerSetTimesliceMode", "hScheduler"},
+        {ZE_TRACER_API_INDEX(Sysman.Scheduler, pfnSetExclusiveModeCb), "zesSchedulerSetExclusiveMode", "hScheduler"},
+        {ZE_TRACER_API_INDEX(Sysman.Scheduler, pfnSetComputeUnitDebugModeCb), "zesSchedulerSetComputeUnitDebugMode", "hScheduler"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumStandbyDomainsCb), "zesDeviceEnumStandbyDomains", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Standby, pfnGetPropertiesCb), "zesStandbyGetProperties", "hStandby"},
+        {ZE_TRACER_API_INDEX(Sysman.Standby, pfnGetModeCb), "zesStandbyGetMode", "hStandby"},
+        {ZE_TRACER_API_INDEX(Sysman.Standby, pfnSetModeCb), "zesStandbySetMode", "hStandby"},
+        {ZE_TRACER_API_INDEX(Sysman.Device, pfnEnumTemperatureSensorsCb), "zesDeviceEnumTemperatureSensors", "hDevice"},
+        {ZE_TRACER_API_INDEX(Sysman.Temperature, pfnGetPropertiesCb), "zesTemperatureGetProperties", "hTemperature"},
+        {ZE_TRACER_API_INDEX(Sysman.Temperature, pfnGetConfigCb), "zesTemperatureGetConfig", "hTemperature"},
+        {ZE_TRACER_API_INDEX(Sysman.Temperature, pfnSetConfigCb), "zesTemperatureSetConfig", "hTemperature"},
+        {ZE_TRACER_API_INDEX(Sysman.Temperature, pfnGetStateCb), "zesTemperatureGetState", "hTemperature"},
+        {ZE_TRACER_API_INDEX(Sysman.Power, pfnGetLimitsExtCb), "zesPowerGetLimitsExt", "hPower"},
+        {ZE_TRACER_API_INDEX(Sysman.Power, pfnSetLimitsExtCb), "zesPowerSetLimitsExt", "hPower"},
+        {ZE_TRACER_API_INDEX(Sysman.Engine, pfnGetActivityExtCb), "zesEngineGetActivityExt", "hEngine"},
+        {ZE_TRACER_API_INDEX(Sysman.Ras, pfnGetStateExpCb), "zesRasGetStateExp", "hRas"},
+        {ZE_TRACER_API_INDEX(Sysman.Ras, pfnClearStateExpCb), "zesRasClearStateExp", "hRas"},
+    };
+
+    const size_t zesApiRecordDescCount = sizeof(zesApiRecordDescs) / sizeof(zesApiRecordDescs[0]);
+
+} // namespace tracing_layer
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Global table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetGlobalProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_global_dditable_t* pDdiTable                ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Global;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnInit                                     = pDdiTable->pfnInit;
+    pDdiTable->pfnInit                                   = tracing_layer::zesInit;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Device table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetDeviceProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_device_dditable_t* pDdiTable                ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Device;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesDeviceGetProperties;
+
+    dditable.pfnGetState                                 = pDdiTable->pfnGetState;
+    pDdiTable->pfnGetState                               = tracing_layer::zesDeviceGetState;
+
+    dditable.pfnReset                                    = pDdiTable->pfnReset;
+    pDdiTable->pfnReset                                  = tracing_layer::zesDeviceReset;
+
+    dditable.pfnProcessesGetState                        = pDdiTable->pfnProcessesGetState;
+    pDdiTable->pfnProcessesGetState                      = tracing_layer::zesDeviceProcessesGetState;
+
+    dditable.pfnPciGetProperties                         = pDdiTable->pfnPciGetProperties;
+    pDdiTable->pfnPciGetProperties                       = tracing_layer::zesDevicePciGetProperties;
+
+    dditable.pfnPciGetState                              = pDdiTable->pfnPciGetState;
+    pDdiTable->pfnPciGetState                            = tracing_layer::zesDevicePciGetState;
+
+    dditable.pfnPciGetBars                               = pDdiTable->pfnPciGetBars;
+    pDdiTable->pfnPciGetBars                             = tracing_layer::zesDevicePciGetBars;
+
+    dditable.pfnPciGetStats                              = pDdiTable->pfnPciGetStats;
+    pDdiTable->pfnPciGetStats                            = tracing_layer::zesDevicePciGetStats;
+
+    dditable.pfnEnumDiagnosticTestSuites                 = pDdiTable->pfnEnumDiagnosticTestSuites;
+    pDdiTable->pfnEnumDiagnosticTestSuites               = tracing_layer::zesDeviceEnumDiagnosticTestSuites;
+
+    dditable.pfnEnumEngineGroups                         = pDdiTable->pfnEnumEngineGroups;
+    pDdiTable->pfnEnumEngineGroups                       = tracing_layer::zesDeviceEnumEngineGroups;
+
+    dditable.pfnEventRegister                            = pDdiTable->pfnEventRegister;
+    pDdiTable->pfnEventRegister                          = tracing_layer::zesDeviceEventRegister;
+
+    dditable.pfnEnumFabricPorts                          = pDdiTable->pfnEnumFabricPorts;
+    pDdiTable->pfnEnumFabricPorts                        = tracing_layer::zesDeviceEnumFabricPorts;
+
+    dditable.pfnEnumFans                                 = pDdiTable->pfnEnumFans;
+    pDdiTable->pfnEnumFans                               = tracing_layer::zesDeviceEnumFans;
+
+    dditable.pfnEnumFirmwares                            = pDdiTable->pfnEnumFirmwares;
+    pDdiTable->pfnEnumFirmwares                          = tracing_layer::zesDeviceEnumFirmwares;
+
+    dditable.pfnEnumFrequencyDomains                     = pDdiTable->pfnEnumFrequencyDomains;
+    pDdiTable->pfnEnumFrequencyDomains                   = tracing_layer::zesDeviceEnumFrequencyDomains;
+
+    dditable.pfnEnumLeds                                 = pDdiTable->pfnEnumLeds;
+    pDdiTable->pfnEnumLeds                               = tracing_layer::zesDeviceEnumLeds;
+
+    dditable.pfnEnumMemoryModules                        = pDdiTable->pfnEnumMemoryModules;
+    pDdiTable->pfnEnumMemoryModules                      = tracing_layer::zesDeviceEnumMemoryModules;
+
+    dditable.pfnEnumPerformanceFactorDomains             = pDdiTable->pfnEnumPerformanceFactorDomains;
+    pDdiTable->pfnEnumPerformanceFactorDomains           = tracing_layer::zesDeviceEnumPerformanceFactorDomains;
+
+    dditable.pfnEnumPowerDomains                         = pDdiTable->pfnEnumPowerDomains;
+    pDdiTable->pfnEnumPowerDomains                       = tracing_layer::zesDeviceEnumPowerDomains;
+
+    dditable.pfnGetCardPowerDomain                       = pDdiTable->pfnGetCardPowerDomain;
+    pDdiTable->pfnGetCardPowerDomain                     = tracing_layer::zesDeviceGetCardPowerDomain;
+
+    dditable.pfnEnumPsus                                 = pDdiTable->pfnEnumPsus;
+    pDdiTable->pfnEnumPsus                               = tracing_layer::zesDeviceEnumPsus;
+
+    dditable.pfnEnumRasErrorSets                         = pDdiTable->pfnEnumRasErrorSets;
+    pDdiTable->pfnEnumRasErrorSets                       = tracing_layer::zesDeviceEnumRasErrorSets;
+
+    dditable.pfnEnumSchedulers                           = pDdiTable->pfnEnumSchedulers;
+    pDdiTable->pfnEnumSchedulers                         = tracing_layer::zesDeviceEnumSchedulers;
+
+    dditable.pfnEnumStandbyDomains                       = pDdiTable->pfnEnumStandbyDomains;
+    pDdiTable->pfnEnumStandbyDomains                     = tracing_layer::zesDeviceEnumStandbyDomains;
+
+    dditable.pfnEnumTemperatureSensors                   = pDdiTable->pfnEnumTemperatureSensors;
+    pDdiTable->pfnEnumTemperatureSensors                 = tracing_layer::zesDeviceEnumTemperatureSensors;
+
+    dditable.pfnEccAvailable                             = pDdiTable->pfnEccAvailable;
+    pDdiTable->pfnEccAvailable                           = tracing_layer::zesDeviceEccAvailable;
+
+    dditable.pfnEccConfigurable                          = pDdiTable->pfnEccConfigurable;
+    pDdiTable->pfnEccConfigurable                        = tracing_layer::zesDeviceEccConfigurable;
+
+    dditable.pfnGetEccState                              = pDdiTable->pfnGetEccState;
+    pDdiTable->pfnGetEccState                            = tracing_layer::zesDeviceGetEccState;
+
+    dditable.pfnSetEccState                              = pDdiTable->pfnSetEccState;
+    pDdiTable->pfnSetEccState                            = tracing_layer::zesDeviceSetEccState;
+
+    dditable.pfnGet                                      = pDdiTable->pfnGet;
+    pDdiTable->pfnGet                                    = tracing_layer::zesDeviceGet;
+
+    dditable.pfnSetOverclockWaiver                       = pDdiTable->pfnSetOverclockWaiver;
+    pDdiTable->pfnSetOverclockWaiver                     = tracing_layer::zesDeviceSetOverclockWaiver;
+
+    dditable.pfnGetOverclockDomains                      = pDdiTable->pfnGetOverclockDomains;
+    pDdiTable->pfnGetOverclockDomains                    = tracing_layer::zesDeviceGetOverclockDomains;
+
+    dditable.pfnGetOverclockControls                     = pDdiTable->pfnGetOverclockControls;
+    pDdiTable->pfnGetOverclockControls                   = tracing_layer::zesDeviceGetOverclockControls;
+
+    dditable.pfnResetOverclockSettings                   = pDdiTable->pfnResetOverclockSettings;
+    pDdiTable->pfnResetOverclockSettings                 = tracing_layer::zesDeviceResetOverclockSettings;
+
+    dditable.pfnReadOverclockState                       = pDdiTable->pfnReadOverclockState;
+    pDdiTable->pfnReadOverclockState                     = tracing_layer::zesDeviceReadOverclockState;
+
+    dditable.pfnEnumOverclockDomains                     = pDdiTable->pfnEnumOverclockDomains;
+    pDdiTable->pfnEnumOverclockDomains                   = tracing_layer::zesDeviceEnumOverclockDomains;
+
+    dditable.pfnResetExt                                 = pDdiTable->pfnResetExt;
+    pDdiTable->pfnResetExt                               = tracing_layer::zesDeviceResetExt;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Driver table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetDriverProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_driver_dditable_t* pDdiTable                ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Driver;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnEventListen                              = pDdiTable->pfnEventListen;
+    pDdiTable->pfnEventListen                            = tracing_layer::zesDriverEventListen;
+
+    dditable.pfnEventListenEx                            = pDdiTable->pfnEventListenEx;
+    pDdiTable->pfnEventListenEx                          = tracing_layer::zesDriverEventListenEx;
+
+    dditable.pfnGet                                      = pDdiTable->pfnGet;
+    pDdiTable->pfnGet                                    = tracing_layer::zesDriverGet;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Diagnostics table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetDiagnosticsProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_diagnostics_dditable_t* pDdiTable           ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Diagnostics;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesDiagnosticsGetProperties;
+
+    dditable.pfnGetTests                                 = pDdiTable->pfnGetTests;
+    pDdiTable->pfnGetTests                               = tracing_layer::zesDiagnosticsGetTests;
+
+    dditable.pfnRunTests                                 = pDdiTable->pfnRunTests;
+    pDdiTable->pfnRunTests                               = tracing_layer::zesDiagnosticsRunTests;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Engine table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetEngineProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_engine_dditable_t* pDdiTable                ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Engine;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesEngineGetProperties;
+
+    dditable.pfnGetActivity                              = pDdiTable->pfnGetActivity;
+    pDdiTable->pfnGetActivity                            = tracing_layer::zesEngineGetActivity;
+
+    dditable.pfnGetActivityExt                           = pDdiTable->pfnGetActivityExt;
+    pDdiTable->pfnGetActivityExt                         = tracing_layer::zesEngineGetActivityExt;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's FabricPort table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetFabricPortProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_fabric_port_dditable_t* pDdiTable           ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.FabricPort;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesFabricPortGetProperties;
+
+    dditable.pfnGetLinkType                              = pDdiTable->pfnGetLinkType;
+    pDdiTable->pfnGetLinkType                            = tracing_layer::zesFabricPortGetLinkType;
+
+    dditable.pfnGetConfig                                = pDdiTable->pfnGetConfig;
+    pDdiTable->pfnGetConfig                              = tracing_layer::zesFabricPortGetConfig;
+
+    dditable.pfnSetConfig                                = pDdiTable->pfnSetConfig;
+    pDdiTable->pfnSetConfig                              = tracing_layer::zesFabricPortSetConfig;
+
+    dditable.pfnGetState                                 = pDdiTable->pfnGetState;
+    pDdiTable->pfnGetState                               = tracing_layer::zesFabricPortGetState;
+
+    dditable.pfnGetThroughput                            = pDdiTable->pfnGetThroughput;
+    pDdiTable->pfnGetThroughput                          = tracing_layer::zesFabricPortGetThroughput;
+
+    dditable.pfnGetFabricErrorCounters                   = pDdiTable->pfnGetFabricErrorCounters;
+    pDdiTable->pfnGetFabricErrorCounters                 = tracing_layer::zesFabricPortGetFabricErrorCounters;
+
+    dditable.pfnGetMultiPortThroughput                   = pDdiTable->pfnGetMultiPortThroughput;
+    pDdiTable->pfnGetMultiPortThroughput                 = tracing_layer::zesFabricPortGetMultiPortThroughput;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Fan table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetFanProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_fan_dditable_t* pDdiTable                   ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Fan;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesFanGetProperties;
+
+    dditable.pfnGetConfig                                = pDdiTable->pfnGetConfig;
+    pDdiTable->pfnGetConfig                              = tracing_layer::zesFanGetConfig;
+
+    dditable.pfnSetDefaultMode                           = pDdiTable->pfnSetDefaultMode;
+    pDdiTable->pfnSetDefaultMode                         = tracing_layer::zesFanSetDefaultMode;
+
+    dditable.pfnSetFixedSpeedMode                        = pDdiTable->pfnSetFixedSpeedMode;
+    pDdiTable->pfnSetFixedSpeedMode                      = tracing_layer::zesFanSetFixedSpeedMode;
+
+    dditable.pfnSetSpeedTableMode                        = pDdiTable->pfnSetSpeedTableMode;
+    pDdiTable->pfnSetSpeedTableMode                      = tracing_layer::zesFanSetSpeedTableMode;
+
+    dditable.pfnGetState                                 = pDdiTable->pfnGetState;
+    pDdiTable->pfnGetState                               = tracing_layer::zesFanGetState;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Firmware table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetFirmwareProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_firmware_dditable_t* pDdiTable              ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Firmware;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesFirmwareGetProperties;
+
+    dditable.pfnFlash                                    = pDdiTable->pfnFlash;
+    pDdiTable->pfnFlash                                  = tracing_layer::zesFirmwareFlash;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Frequency table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetFrequencyProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_frequency_dditable_t* pDdiTable             ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Frequency;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesFrequencyGetProperties;
+
+    dditable.pfnGetAvailableClocks                       = pDdiTable->pfnGetAvailableClocks;
+    pDdiTable->pfnGetAvailableClocks                     = tracing_layer::zesFrequencyGetAvailableClocks;
+
+    dditable.pfnGetRange                                 = pDdiTable->pfnGetRange;
+    pDdiTable->pfnGetRange                               = tracing_layer::zesFrequencyGetRange;
+
+    dditable.pfnSetRange                                 = pDdiTable->pfnSetRange;
+    pDdiTable->pfnSetRange                               = tracing_layer::zesFrequencySetRange;
+
+    dditable.pfnGetState                                 = pDdiTable->pfnGetState;
+    pDdiTable->pfnGetState                               = tracing_layer::zesFrequencyGetState;
+
+    dditable.pfnGetThrottleTime                          = pDdiTable->pfnGetThrottleTime;
+    pDdiTable->pfnGetThrottleTime                        = tracing_layer::zesFrequencyGetThrottleTime;
+
+    dditable.pfnOcGetCapabilities                        = pDdiTable->pfnOcGetCapabilities;
+    pDdiTable->pfnOcGetCapabilities                      = tracing_layer::zesFrequencyOcGetCapabilities;
+
+    dditable.pfnOcGetFrequencyTarget                     = pDdiTable->pfnOcGetFrequencyTarget;
+    pDdiTable->pfnOcGetFrequencyTarget                   = tracing_layer::zesFrequencyOcGetFrequencyTarget;
+
+    dditable.pfnOcSetFrequencyTarget                     = pDdiTable->pfnOcSetFrequencyTarget;
+    pDdiTable->pfnOcSetFrequencyTarget                   = tracing_layer::zesFrequencyOcSetFrequencyTarget;
+
+    dditable.pfnOcGetVoltageTarget                       = pDdiTable->pfnOcGetVoltageTarget;
+    pDdiTable->pfnOcGetVoltageTarget                     = tracing_layer::zesFrequencyOcGetVoltageTarget;
+
+    dditable.pfnOcSetVoltageTarget                       = pDdiTable->pfnOcSetVoltageTarget;
+    pDdiTable->pfnOcSetVoltageTarget                     = tracing_layer::zesFrequencyOcSetVoltageTarget;
+
+    dditable.pfnOcSetMode                                = pDdiTable->pfnOcSetMode;
+    pDdiTable->pfnOcSetMode                              = tracing_layer::zesFrequencyOcSetMode;
+
+    dditable.pfnOcGetMode                                = pDdiTable->pfnOcGetMode;
+    pDdiTable->pfnOcGetMode                              = tracing_layer::zesFrequencyOcGetMode;
+
+    dditable.pfnOcGetIccMax                              = pDdiTable->pfnOcGetIccMax;
+    pDdiTable->pfnOcGetIccMax                            = tracing_layer::zesFrequencyOcGetIccMax;
+
+    dditable.pfnOcSetIccMax                              = pDdiTable->pfnOcSetIccMax;
+    pDdiTable->pfnOcSetIccMax                            = tracing_layer::zesFrequencyOcSetIccMax;
+
+    dditable.pfnOcGetTjMax                               = pDdiTable->pfnOcGetTjMax;
+    pDdiTable->pfnOcGetTjMax                             = tracing_layer::zesFrequencyOcGetTjMax;
+
+    dditable.pfnOcSetTjMax                               = pDdiTable->pfnOcSetTjMax;
+    pDdiTable->pfnOcSetTjMax                             = tracing_layer::zesFrequencyOcSetTjMax;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Led table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetLedProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_led_dditable_t* pDdiTable                   ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Led;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesLedGetProperties;
+
+    dditable.pfnGetState                                 = pDdiTable->pfnGetState;
+    pDdiTable->pfnGetState                               = tracing_layer::zesLedGetState;
+
+    dditable.pfnSetState                                 = pDdiTable->pfnSetState;
+    pDdiTable->pfnSetState                               = tracing_layer::zesLedSetState;
+
+    dditable.pfnSetColor                                 = pDdiTable->pfnSetColor;
+    pDdiTable->pfnSetColor                               = tracing_layer::zesLedSetColor;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Memory table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetMemoryProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_memory_dditable_t* pDdiTable                ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Memory;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesMemoryGetProperties;
+
+    dditable.pfnGetState                                 = pDdiTable->pfnGetState;
+    pDdiTable->pfnGetState                               = tracing_layer::zesMemoryGetState;
+
+    dditable.pfnGetBandwidth                             = pDdiTable->pfnGetBandwidth;
+    pDdiTable->pfnGetBandwidth                           = tracing_layer::zesMemoryGetBandwidth;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Overclock table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetOverclockProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_overclock_dditable_t* pDdiTable             ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Overclock;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetDomainProperties                      = pDdiTable->pfnGetDomainProperties;
+    pDdiTable->pfnGetDomainProperties                    = tracing_layer::zesOverclockGetDomainProperties;
+
+    dditable.pfnGetDomainVFProperties                    = pDdiTable->pfnGetDomainVFProperties;
+    pDdiTable->pfnGetDomainVFProperties                  = tracing_layer::zesOverclockGetDomainVFProperties;
+
+    dditable.pfnGetDomainControlProperties               = pDdiTable->pfnGetDomainControlProperties;
+    pDdiTable->pfnGetDomainControlProperties             = tracing_layer::zesOverclockGetDomainControlProperties;
+
+    dditable.pfnGetControlCurrentValue                   = pDdiTable->pfnGetControlCurrentValue;
+    pDdiTable->pfnGetControlCurrentValue                 = tracing_layer::zesOverclockGetControlCurrentValue;
+
+    dditable.pfnGetControlPendingValue                   = pDdiTable->pfnGetControlPendingValue;
+    pDdiTable->pfnGetControlPendingValue                 = tracing_layer::zesOverclockGetControlPendingValue;
+
+    dditable.pfnSetControlUserValue                      = pDdiTable->pfnSetControlUserValue;
+    pDdiTable->pfnSetControlUserValue                    = tracing_layer::zesOverclockSetControlUserValue;
+
+    dditable.pfnGetControlState                          = pDdiTable->pfnGetControlState;
+    pDdiTable->pfnGetControlState                        = tracing_layer::zesOverclockGetControlState;
+
+    dditable.pfnGetVFPointValues                         = pDdiTable->pfnGetVFPointValues;
+    pDdiTable->pfnGetVFPointValues                       = tracing_layer::zesOverclockGetVFPointValues;
+
+    dditable.pfnSetVFPointValues                         = pDdiTable->pfnSetVFPointValues;
+    pDdiTable->pfnSetVFPointValues                       = tracing_layer::zesOverclockSetVFPointValues;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's PerformanceFactor table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetPerformanceFactorProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_performance_factor_dditable_t* pDdiTable    ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.PerformanceFactor;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesPerformanceFactorGetProperties;
+
+    dditable.pfnGetConfig                                = pDdiTable->pfnGetConfig;
+    pDdiTable->pfnGetConfig                              = tracing_layer::zesPerformanceFactorGetConfig;
+
+    dditable.pfnSetConfig                                = pDdiTable->pfnSetConfig;
+    pDdiTable->pfnSetConfig                              = tracing_layer::zesPerformanceFactorSetConfig;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Power table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetPowerProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_power_dditable_t* pDdiTable                 ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Power;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesPowerGetProperties;
+
+    dditable.pfnGetEnergyCounter                         = pDdiTable->pfnGetEnergyCounter;
+    pDdiTable->pfnGetEnergyCounter                       = tracing_layer::zesPowerGetEnergyCounter;
+
+    dditable.pfnGetLimits                                = pDdiTable->pfnGetLimits;
+    pDdiTable->pfnGetLimits                              = tracing_layer::zesPowerGetLimits;
+
+    dditable.pfnSetLimits                                = pDdiTable->pfnSetLimits;
+    pDdiTable->pfnSetLimits                              = tracing_layer::zesPowerSetLimits;
+
+    dditable.pfnGetEnergyThreshold                       = pDdiTable->pfnGetEnergyThreshold;
+    pDdiTable->pfnGetEnergyThreshold                     = tracing_layer::zesPowerGetEnergyThreshold;
+
+    dditable.pfnSetEnergyThreshold                       = pDdiTable->pfnSetEnergyThreshold;
+    pDdiTable->pfnSetEnergyThreshold                     = tracing_layer::zesPowerSetEnergyThreshold;
+
+    dditable.pfnGetLimitsExt                             = pDdiTable->pfnGetLimitsExt;
+    pDdiTable->pfnGetLimitsExt                           = tracing_layer::zesPowerGetLimitsExt;
+
+    dditable.pfnSetLimitsExt                             = pDdiTable->pfnSetLimitsExt;
+    pDdiTable->pfnSetLimitsExt                           = tracing_layer::zesPowerSetLimitsExt;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Psu table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetPsuProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_psu_dditable_t* pDdiTable                   ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Psu;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesPsuGetProperties;
+
+    dditable.pfnGetState                                 = pDdiTable->pfnGetState;
+    pDdiTable->pfnGetState                               = tracing_layer::zesPsuGetState;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Ras table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetRasProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_ras_dditable_t* pDdiTable                   ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Ras;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesRasGetProperties;
+
+    dditable.pfnGetConfig                                = pDdiTable->pfnGetConfig;
+    pDdiTable->pfnGetConfig                              = tracing_layer::zesRasGetConfig;
+
+    dditable.pfnSetConfig                                = pDdiTable->pfnSetConfig;
+    pDdiTable->pfnSetConfig                              = tracing_layer::zesRasSetConfig;
+
+    dditable.pfnGetState                                 = pDdiTable->pfnGetState;
+    pDdiTable->pfnGetState                               = tracing_layer::zesRasGetState;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's RasExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetRasExpProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_ras_exp_dditable_t* pDdiTable               ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.RasExp;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetStateExp                              = pDdiTable->pfnGetStateExp;
+    pDdiTable->pfnGetStateExp                            = tracing_layer::zesRasGetStateExp;
+
+    dditable.pfnClearStateExp                            = pDdiTable->pfnClearStateExp;
+    pDdiTable->pfnClearStateExp                          = tracing_layer::zesRasClearStateExp;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Scheduler table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetSchedulerProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_scheduler_dditable_t* pDdiTable             ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Scheduler;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesSchedulerGetProperties;
+
+    dditable.pfnGetCurrentMode                           = pDdiTable->pfnGetCurrentMode;
+    pDdiTable->pfnGetCurrentMode                         = tracing_layer::zesSchedulerGetCurrentMode;
+
+    dditable.pfnGetTimeoutModeProperties                 = pDdiTable->pfnGetTimeoutModeProperties;
+    pDdiTable->pfnGetTimeoutModeProperties               = tracing_layer::zesSchedulerGetTimeoutModeProperties;
+
+    dditable.pfnGetTimesliceModeProperties               = pDdiTable->pfnGetTimesliceModeProperties;
+    pDdiTable->pfnGetTimesliceModeProperties             = tracing_layer::zesSchedulerGetTimesliceModeProperties;
+
+    dditable.pfnSetTimeoutMode                           = pDdiTable->pfnSetTimeoutMode;
+    pDdiTable->pfnSetTimeoutMode                         = tracing_layer::zesSchedulerSetTimeoutMode;
+
+    dditable.pfnSetTimesliceMode                         = pDdiTable->pfnSetTimesliceMode;
+    pDdiTable->pfnSetTimesliceMode                       = tracing_layer::zesSchedulerSetTimesliceMode;
+
+    dditable.pfnSetExclusiveMode                         = pDdiTable->pfnSetExclusiveMode;
+    pDdiTable->pfnSetExclusiveMode                       = tracing_layer::zesSchedulerSetExclusiveMode;
+
+    dditable.pfnSetComputeUnitDebugMode                  = pDdiTable->pfnSetComputeUnitDebugMode;
+    pDdiTable->pfnSetComputeUnitDebugMode                = tracing_layer::zesSchedulerSetComputeUnitDebugMode;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Standby table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetStandbyProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_standby_dditable_t* pDdiTable               ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Standby;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesStandbyGetProperties;
+
+    dditable.pfnGetMode                                  = pDdiTable->pfnGetMode;
+    pDdiTable->pfnGetMode                                = tracing_layer::zesStandbyGetMode;
+
+    dditable.pfnSetMode                                  = pDdiTable->pfnSetMode;
+    pDdiTable->pfnSetMode                                = tracing_layer::zesStandbySetMode;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Temperature table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetTemperatureProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zes_temperature_dditable_t* pDdiTable           ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zesDdiTable.Temperature;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zesTemperatureGetProperties;
+
+    dditable.pfnGetConfig                                = pDdiTable->pfnGetConfig;
+    pDdiTable->pfnGetConfig                              = tracing_layer::zesTemperatureGetConfig;
+
+    dditable.pfnSetConfig                                = pDdiTable->pfnSetConfig;
+    pDdiTable->pfnSetConfig                              = tracing_layer::zesTemperatureSetConfig;
+
+    dditable.pfnGetState                                 = pDdiTable->pfnGetState;
+    pDdiTable->pfnGetState                               = tracing_layer::zesTemperatureGetState;
+
+    return result;
+}
+
+#if defined(__cplusplus)
+};
+#endif
@@ -0,0 +1,3057 @@
+/*
+ *
+ * Copyright (C) 2020-2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zet_trcddi.cpp
+ *
+ */
+
+#include <iostream>
+#include "ze_tracing_layer.h"
+
+
+namespace tracing_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetModuleGetDebugInfo
+    template <>
+    struct APIRecordArgs<zet_module_get_debug_info_params_t>
+    {
+        static uint32_t get(const zet_module_get_debug_info_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phModule);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetModuleGetDebugInfo
+    __zedlllocal ze_result_t ZE_APICALL
+    zetModuleGetDebugInfo(
+        zet_module_handle_t hModule,                    ///< [in] handle of the module
+        zet_module_debug_info_format_t format,          ///< [in] debug info format requested
+        size_t* pSize,                                  ///< [in,out] size of debug info in bytes
+        uint8_t* pDebugInfo                             ///< [in,out][optional] byte pointer to debug info
+        )
+    {
+        auto pfnGetDebugInfo = context.zetDdiTable.Module.pfnGetDebugInfo;
+
+        if( nullptr == pfnGetDebugInfo)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Module, pfnGetDebugInfoCb, context.zetDdiTable.Module.pfnGetDebugInfo, hModule, format, pSize, pDebugInfo);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Module, pfnGetDebugInfoCb, context.zetDdiTable.Module.pfnGetDebugInfo, hModule, format, pSize, pDebugInfo);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Module.pfnGetDebugInfo, hModule, format, pSize, pDebugInfo);
+
+        // capture parameters
+        zet_module_get_debug_info_params_t tracerParams = {
+            &hModule,
+            &format,
+            &pSize,
+            &pDebugInfo
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnModuleGetDebugInfoCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnModuleGetDebugInfoCb_t, Tools.Module, pfnGetDebugInfoCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Module.pfnGetDebugInfo,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phModule,
+                                                  *tracerParams.pformat,
+                                                  *tracerParams.ppSize,
+                                                  *tracerParams.ppDebugInfo);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDeviceGetDebugProperties
+    template <>
+    struct APIRecordArgs<zet_device_get_debug_properties_params_t>
+    {
+        static uint32_t get(const zet_device_get_debug_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDeviceGetDebugProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDeviceGetDebugProperties(
+        zet_device_handle_t hDevice,                    ///< [in] device handle
+        zet_device_debug_properties_t* pDebugProperties ///< [in,out] query result for debug properties
+        )
+    {
+        auto pfnGetDebugProperties = context.zetDdiTable.Device.pfnGetDebugProperties;
+
+        if( nullptr == pfnGetDebugProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Device, pfnGetDebugPropertiesCb, context.zetDdiTable.Device.pfnGetDebugProperties, hDevice, pDebugProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Device, pfnGetDebugPropertiesCb, context.zetDdiTable.Device.pfnGetDebugProperties, hDevice, pDebugProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Device.pfnGetDebugProperties, hDevice, pDebugProperties);
+
+        // capture parameters
+        zet_device_get_debug_properties_params_t tracerParams = {
+            &hDevice,
+            &pDebugProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDeviceGetDebugPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDeviceGetDebugPropertiesCb_t, Tools.Device, pfnGetDebugPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Device.pfnGetDebugProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppDebugProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDebugAttach
+    template <>
+    struct APIRecordArgs<zet_debug_attach_params_t>
+    {
+        static uint32_t get(const zet_debug_attach_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zetDebugAttach
+    template <>
+    struct AsyncEpilogueOutArgs<zet_debug_attach_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 2);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDebugAttach
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDebugAttach(
+        zet_device_handle_t hDevice,                    ///< [in] device handle
+        const zet_debug_config_t* config,               ///< [in] the debug configuration
+        zet_debug_session_handle_t* phDebug             ///< [out] debug session handle
+        )
+    {
+        auto pfnAttach = context.zetDdiTable.Debug.pfnAttach;
+
+        if( nullptr == pfnAttach)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Debug, pfnAttachCb, context.zetDdiTable.Debug.pfnAttach, hDevice, config, phDebug);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Debug, pfnAttachCb, context.zetDdiTable.Debug.pfnAttach, hDevice, config, phDebug);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Debug.pfnAttach, hDevice, config, phDebug);
+
+        // capture parameters
+        zet_debug_attach_params_t tracerParams = {
+            &hDevice,
+            &config,
+            &phDebug
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDebugAttachCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDebugAttachCb_t, Tools.Debug, pfnAttachCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Debug.pfnAttach,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.pconfig,
+                                                  *tracerParams.pphDebug);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDebugDetach
+    template <>
+    struct APIRecordArgs<zet_debug_detach_params_t>
+    {
+        static uint32_t get(const zet_debug_detach_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDebug);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDebugDetach
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDebugDetach(
+        zet_debug_session_handle_t hDebug               ///< [in][release] debug session handle
+        )
+    {
+        auto pfnDetach = context.zetDdiTable.Debug.pfnDetach;
+
+        if( nullptr == pfnDetach)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Debug, pfnDetachCb, context.zetDdiTable.Debug.pfnDetach, hDebug);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Debug, pfnDetachCb, context.zetDdiTable.Debug.pfnDetach, hDebug);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Debug.pfnDetach, hDebug);
+
+        // capture parameters
+        zet_debug_detach_params_t tracerParams = {
+            &hDebug
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDebugDetachCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDebugDetachCb_t, Tools.Debug, pfnDetachCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Debug.pfnDetach,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDebug);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDebugReadEvent
+    template <>
+    struct APIRecordArgs<zet_debug_read_event_params_t>
+    {
+        static uint32_t get(const zet_debug_read_event_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDebug);
+            args[count++] = recordArg(*params->ptimeout);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDebugReadEvent
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDebugReadEvent(
+        zet_debug_session_handle_t hDebug,              ///< [in] debug session handle
+        uint64_t timeout,                               ///< [in] if non-zero, then indicates the maximum time (in milliseconds) to
+                                                        ///< yield before returning ::ZE_RESULT_SUCCESS or ::ZE_RESULT_NOT_READY;
+                                                        ///< if zero, then immediately returns the status of the event;
+                                                        ///< if `UINT64_MAX`, then function will not return until complete or
+                                                        ///< device is lost.
+                                                        ///< Due to external dependencies, timeout may be rounded to the closest
+                                                        ///< value allowed by the accuracy of those dependencies.
+        zet_debug_event_t* event                        ///< [in,out] a pointer to a ::zet_debug_event_t.
+        )
+    {
+        auto pfnReadEvent = context.zetDdiTable.Debug.pfnReadEvent;
+
+        if( nullptr == pfnReadEvent)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Debug, pfnReadEventCb, context.zetDdiTable.Debug.pfnReadEvent, hDebug, timeout, event);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Debug, pfnReadEventCb, context.zetDdiTable.Debug.pfnReadEvent, hDebug, timeout, event);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Debug.pfnReadEvent, hDebug, timeout, event);
+
+        // capture parameters
+        zet_debug_read_event_params_t tracerParams = {
+            &hDebug,
+            &timeout,
+            &event
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDebugReadEventCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDebugReadEventCb_t, Tools.Debug, pfnReadEventCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Debug.pfnReadEvent,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDebug,
+                                                  *tracerParams.ptimeout,
+                                                  *tracerParams.pevent);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDebugAcknowledgeEvent
+    template <>
+    struct APIRecordArgs<zet_debug_acknowledge_event_params_t>
+    {
+        static uint32_t get(const zet_debug_acknowledge_event_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDebug);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDebugAcknowledgeEvent
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDebugAcknowledgeEvent(
+        zet_debug_session_handle_t hDebug,              ///< [in] debug session handle
+        const zet_debug_event_t* event                  ///< [in] a pointer to a ::zet_debug_event_t.
+        )
+    {
+        auto pfnAcknowledgeEvent = context.zetDdiTable.Debug.pfnAcknowledgeEvent;
+
+        if( nullptr == pfnAcknowledgeEvent)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Debug, pfnAcknowledgeEventCb, context.zetDdiTable.Debug.pfnAcknowledgeEvent, hDebug, event);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Debug, pfnAcknowledgeEventCb, context.zetDdiTable.Debug.pfnAcknowledgeEvent, hDebug, event);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Debug.pfnAcknowledgeEvent, hDebug, event);
+
+        // capture parameters
+        zet_debug_acknowledge_event_params_t tracerParams = {
+            &hDebug,
+            &event
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDebugAcknowledgeEventCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDebugAcknowledgeEventCb_t, Tools.Debug, pfnAcknowledgeEventCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Debug.pfnAcknowledgeEvent,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDebug,
+                                                  *tracerParams.pevent);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDebugInterrupt
+    template <>
+    struct APIRecordArgs<zet_debug_interrupt_params_t>
+    {
+        static uint32_t get(const zet_debug_interrupt_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDebug);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDebugInterrupt
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDebugInterrupt(
+        zet_debug_session_handle_t hDebug,              ///< [in] debug session handle
+        ze_device_thread_t thread                       ///< [in] the thread to interrupt
+        )
+    {
+        auto pfnInterrupt = context.zetDdiTable.Debug.pfnInterrupt;
+
+        if( nullptr == pfnInterrupt)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Debug, pfnInterruptCb, context.zetDdiTable.Debug.pfnInterrupt, hDebug, thread);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Debug, pfnInterruptCb, context.zetDdiTable.Debug.pfnInterrupt, hDebug, thread);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Debug.pfnInterrupt, hDebug, thread);
+
+        // capture parameters
+        zet_debug_interrupt_params_t tracerParams = {
+            &hDebug,
+            &thread
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDebugInterruptCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDebugInterruptCb_t, Tools.Debug, pfnInterruptCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Debug.pfnInterrupt,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDebug,
+                                                  *tracerParams.pthread);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDebugResume
+    template <>
+    struct APIRecordArgs<zet_debug_resume_params_t>
+    {
+        static uint32_t get(const zet_debug_resume_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDebug);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDebugResume
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDebugResume(
+        zet_debug_session_handle_t hDebug,              ///< [in] debug session handle
+        ze_device_thread_t thread                       ///< [in] the thread to resume
+        )
+    {
+        auto pfnResume = context.zetDdiTable.Debug.pfnResume;
+
+        if( nullptr == pfnResume)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Debug, pfnResumeCb, context.zetDdiTable.Debug.pfnResume, hDebug, thread);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Debug, pfnResumeCb, context.zetDdiTable.Debug.pfnResume, hDebug, thread);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Debug.pfnResume, hDebug, thread);
+
+        // capture parameters
+        zet_debug_resume_params_t tracerParams = {
+            &hDebug,
+            &thread
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDebugResumeCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDebugResumeCb_t, Tools.Debug, pfnResumeCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Debug.pfnResume,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDebug,
+                                                  *tracerParams.pthread);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDebugReadMemory
+    template <>
+    struct APIRecordArgs<zet_debug_read_memory_params_t>
+    {
+        static uint32_t get(const zet_debug_read_memory_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDebug);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDebugReadMemory
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDebugReadMemory(
+        zet_debug_session_handle_t hDebug,              ///< [in] debug session handle
+        ze_device_thread_t thread,                      ///< [in] the thread identifier.
+        const zet_debug_memory_space_desc_t* desc,      ///< [in] memory space descriptor
+        size_t size,                                    ///< [in] the number of bytes to read
+        void* buffer                                    ///< [in,out] a buffer to hold a copy of the memory
+        )
+    {
+        auto pfnReadMemory = context.zetDdiTable.Debug.pfnReadMemory;
+
+        if( nullptr == pfnReadMemory)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Debug, pfnReadMemoryCb, context.zetDdiTable.Debug.pfnReadMemory, hDebug, thread, desc, size, buffer);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Debug, pfnReadMemoryCb, context.zetDdiTable.Debug.pfnReadMemory, hDebug, thread, desc, size, buffer);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Debug.pfnReadMemory, hDebug, thread, desc, size, buffer);
+
+        // capture parameters
+        zet_debug_read_memory_params_t tracerParams = {
+            &hDebug,
+            &thread,
+            &desc,
+            &size,
+            &buffer
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDebugReadMemoryCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDebugReadMemoryCb_t, Tools.Debug, pfnReadMemoryCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Debug.pfnReadMemory,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDebug,
+                                                  *tracerParams.pthread,
+                                                  *tracerParams.pdesc,
+                                                  *tracerParams.psize,
+                                                  *tracerParams.pbuffer);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDebugWriteMemory
+    template <>
+    struct APIRecordArgs<zet_debug_write_memory_params_t>
+    {
+        static uint32_t get(const zet_debug_write_memory_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDebug);
+            args[count++] = recordArg(*params->psize);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDebugWriteMemory
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDebugWriteMemory(
+        zet_debug_session_handle_t hDebug,              ///< [in] debug session handle
+        ze_device_thread_t thread,                      ///< [in] the thread identifier.
+        const zet_debug_memory_space_desc_t* desc,      ///< [in] memory space descriptor
+        size_t size,                                    ///< [in] the number of bytes to write
+        const void* buffer                              ///< [in] a buffer holding the pattern to write
+        )
+    {
+        auto pfnWriteMemory = context.zetDdiTable.Debug.pfnWriteMemory;
+
+        if( nullptr == pfnWriteMemory)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Debug, pfnWriteMemoryCb, context.zetDdiTable.Debug.pfnWriteMemory, hDebug, thread, desc, size, buffer);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Debug, pfnWriteMemoryCb, context.zetDdiTable.Debug.pfnWriteMemory, hDebug, thread, desc, size, buffer);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Debug.pfnWriteMemory, hDebug, thread, desc, size, buffer);
+
+        // capture parameters
+        zet_debug_write_memory_params_t tracerParams = {
+            &hDebug,
+            &thread,
+            &desc,
+            &size,
+            &buffer
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDebugWriteMemoryCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDebugWriteMemoryCb_t, Tools.Debug, pfnWriteMemoryCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Debug.pfnWriteMemory,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDebug,
+                                                  *tracerParams.pthread,
+                                                  *tracerParams.pdesc,
+                                                  *tracerParams.psize,
+                                                  *tracerParams.pbuffer);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDebugGetRegisterSetProperties
+    template <>
+    struct APIRecordArgs<zet_debug_get_register_set_properties_params_t>
+    {
+        static uint32_t get(const zet_debug_get_register_set_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDebugGetRegisterSetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDebugGetRegisterSetProperties(
+        zet_device_handle_t hDevice,                    ///< [in] device handle
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of register set properties.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of register set properties available.
+                                                        ///< if count is greater than the number of register set properties
+                                                        ///< available, then the driver shall update the value with the correct
+                                                        ///< number of registry set properties available.
+        zet_debug_regset_properties_t* pRegisterSetProperties   ///< [in,out][optional][range(0, *pCount)] array of query results for
+                                                        ///< register set properties.
+                                                        ///< if count is less than the number of register set properties available,
+                                                        ///< then driver shall only retrieve that number of register set properties.
+        )
+    {
+        auto pfnGetRegisterSetProperties = context.zetDdiTable.Debug.pfnGetRegisterSetProperties;
+
+        if( nullptr == pfnGetRegisterSetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Debug, pfnGetRegisterSetPropertiesCb, context.zetDdiTable.Debug.pfnGetRegisterSetProperties, hDevice, pCount, pRegisterSetProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Debug, pfnGetRegisterSetPropertiesCb, context.zetDdiTable.Debug.pfnGetRegisterSetProperties, hDevice, pCount, pRegisterSetProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Debug.pfnGetRegisterSetProperties, hDevice, pCount, pRegisterSetProperties);
+
+        // capture parameters
+        zet_debug_get_register_set_properties_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &pRegisterSetProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDebugGetRegisterSetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDebugGetRegisterSetPropertiesCb_t, Tools.Debug, pfnGetRegisterSetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Debug.pfnGetRegisterSetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.ppRegisterSetProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDebugGetThreadRegisterSetProperties
+    template <>
+    struct APIRecordArgs<zet_debug_get_thread_register_set_properties_params_t>
+    {
+        static uint32_t get(const zet_debug_get_thread_register_set_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDebug);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDebugGetThreadRegisterSetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDebugGetThreadRegisterSetProperties(
+        zet_debug_session_handle_t hDebug,              ///< [in] debug session handle
+        ze_device_thread_t thread,                      ///< [in] the thread identifier specifying a single stopped thread
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of register set properties.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of register set properties available.
+                                                        ///< if count is greater than the number of register set properties
+                                                        ///< available, then the driver shall update the value with the correct
+                                                        ///< number of registry set properties available.
+        zet_debug_regset_properties_t* pRegisterSetProperties   ///< [in,out][optional][range(0, *pCount)] array of query results for
+                                                        ///< register set properties.
+                                                        ///< if count is less than the number of register set properties available,
+                                                        ///< then driver shall only retrieve that number of register set properties.
+        )
+    {
+        auto pfnGetThreadRegisterSetProperties = context.zetDdiTable.Debug.pfnGetThreadRegisterSetProperties;
+
+        if( nullptr == pfnGetThreadRegisterSetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Debug, pfnGetThreadRegisterSetPropertiesCb, context.zetDdiTable.Debug.pfnGetThreadRegisterSetProperties, hDebug, thread, pCount, pRegisterSetProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Debug, pfnGetThreadRegisterSetPropertiesCb, context.zetDdiTable.Debug.pfnGetThreadRegisterSetProperties, hDebug, thread, pCount, pRegisterSetProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Debug.pfnGetThreadRegisterSetProperties, hDebug, thread, pCount, pRegisterSetProperties);
+
+        // capture parameters
+        zet_debug_get_thread_register_set_properties_params_t tracerParams = {
+            &hDebug,
+            &thread,
+            &pCount,
+            &pRegisterSetProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDebugGetThreadRegisterSetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDebugGetThreadRegisterSetPropertiesCb_t, Tools.Debug, pfnGetThreadRegisterSetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Debug.pfnGetThreadRegisterSetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDebug,
+                                                  *tracerParams.pthread,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.ppRegisterSetProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDebugReadRegisters
+    template <>
+    struct APIRecordArgs<zet_debug_read_registers_params_t>
+    {
+        static uint32_t get(const zet_debug_read_registers_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDebug);
+            args[count++] = recordArg(*params->ptype);
+            args[count++] = recordArg(*params->pstart);
+            args[count++] = recordArg(*params->pcount);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDebugReadRegisters
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDebugReadRegisters(
+        zet_debug_session_handle_t hDebug,              ///< [in] debug session handle
+        ze_device_thread_t thread,                      ///< [in] the thread identifier
+        uint32_t type,                                  ///< [in] register set type
+        uint32_t start,                                 ///< [in] the starting offset into the register state area; must be less
+                                                        ///< than the `count` member of ::zet_debug_regset_properties_t for the
+                                                        ///< type
+        uint32_t count,                                 ///< [in] the number of registers to read; start+count must be less than or
+                                                        ///< equal to the `count` member of ::zet_debug_register_group_properties_t
+                                                        ///< for the type
+        void* pRegisterValues                           ///< [in,out][optional][range(0, count)] buffer of register values
+        )
+    {
+        auto pfnReadRegisters = context.zetDdiTable.Debug.pfnReadRegisters;
+
+        if( nullptr == pfnReadRegisters)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Debug, pfnReadRegistersCb, context.zetDdiTable.Debug.pfnReadRegisters, hDebug, thread, type, start, count, pRegisterValues);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Debug, pfnReadRegistersCb, context.zetDdiTable.Debug.pfnReadRegisters, hDebug, thread, type, start, count, pRegisterValues);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Debug.pfnReadRegisters, hDebug, thread, type, start, count, pRegisterValues);
+
+        // capture parameters
+        zet_debug_read_registers_params_t tracerParams = {
+            &hDebug,
+            &thread,
+            &type,
+            &start,
+            &count,
+            &pRegisterValues
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDebugReadRegistersCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDebugReadRegistersCb_t, Tools.Debug, pfnReadRegistersCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Debug.pfnReadRegisters,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDebug,
+                                                  *tracerParams.pthread,
+                                                  *tracerParams.ptype,
+                                                  *tracerParams.pstart,
+                                                  *tracerParams.pcount,
+                                                  *tracerParams.ppRegisterValues);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetDebugWriteRegisters
+    template <>
+    struct APIRecordArgs<zet_debug_write_registers_params_t>
+    {
+        static uint32_t get(const zet_debug_write_registers_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDebug);
+            args[count++] = recordArg(*params->ptype);
+            args[count++] = recordArg(*params->pstart);
+            args[count++] = recordArg(*params->pcount);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetDebugWriteRegisters
+    __zedlllocal ze_result_t ZE_APICALL
+    zetDebugWriteRegisters(
+        zet_debug_session_handle_t hDebug,              ///< [in] debug session handle
+        ze_device_thread_t thread,                      ///< [in] the thread identifier
+        uint32_t type,                                  ///< [in] register set type
+        uint32_t start,                                 ///< [in] the starting offset into the register state area; must be less
+                                                        ///< than the `count` member of ::zet_debug_regset_properties_t for the
+                                                        ///< type
+        uint32_t count,                                 ///< [in] the number of registers to write; start+count must be less than
+                                                        ///< or equal to the `count` member of
+                                                        ///< ::zet_debug_register_group_properties_t for the type
+        void* pRegisterValues                           ///< [in,out][optional][range(0, count)] buffer of register values
+        )
+    {
+        auto pfnWriteRegisters = context.zetDdiTable.Debug.pfnWriteRegisters;
+
+        if( nullptr == pfnWriteRegisters)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Debug, pfnWriteRegistersCb, context.zetDdiTable.Debug.pfnWriteRegisters, hDebug, thread, type, start, count, pRegisterValues);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Debug, pfnWriteRegistersCb, context.zetDdiTable.Debug.pfnWriteRegisters, hDebug, thread, type, start, count, pRegisterValues);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Debug.pfnWriteRegisters, hDebug, thread, type, start, count, pRegisterValues);
+
+        // capture parameters
+        zet_debug_write_registers_params_t tracerParams = {
+            &hDebug,
+            &thread,
+            &type,
+            &start,
+            &count,
+            &pRegisterValues
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnDebugWriteRegistersCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnDebugWriteRegistersCb_t, Tools.Debug, pfnWriteRegistersCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Debug.pfnWriteRegisters,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDebug,
+                                                  *tracerParams.pthread,
+                                                  *tracerParams.ptype,
+                                                  *tracerParams.pstart,
+                                                  *tracerParams.pcount,
+                                                  *tracerParams.ppRegisterValues);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricGroupGet
+    template <>
+    struct APIRecordArgs<zet_metric_group_get_params_t>
+    {
+        static uint32_t get(const zet_metric_group_get_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDevice);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricGroupGet
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricGroupGet(
+        zet_device_handle_t hDevice,                    ///< [in] handle of the device
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of metric groups.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of metric groups available.
+                                                        ///< if count is greater than the number of metric groups available, then
+                                                        ///< the driver shall update the value with the correct number of metric
+                                                        ///< groups available.
+        zet_metric_group_handle_t* phMetricGroups       ///< [in,out][optional][range(0, *pCount)] array of handle of metric groups.
+                                                        ///< if count is less than the number of metric groups available, then
+                                                        ///< driver shall only retrieve that number of metric groups.
+        )
+    {
+        auto pfnGet = context.zetDdiTable.MetricGroup.pfnGet;
+
+        if( nullptr == pfnGet)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricGroup, pfnGetCb, context.zetDdiTable.MetricGroup.pfnGet, hDevice, pCount, phMetricGroups);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricGroup, pfnGetCb, context.zetDdiTable.MetricGroup.pfnGet, hDevice, pCount, phMetricGroups);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricGroup.pfnGet, hDevice, pCount, phMetricGroups);
+
+        // capture parameters
+        zet_metric_group_get_params_t tracerParams = {
+            &hDevice,
+            &pCount,
+            &phMetricGroups
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricGroupGetCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricGroupGetCb_t, Tools.MetricGroup, pfnGetCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricGroup.pfnGet,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphMetricGroups);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricGroupGetProperties
+    template <>
+    struct APIRecordArgs<zet_metric_group_get_properties_params_t>
+    {
+        static uint32_t get(const zet_metric_group_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricGroup);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricGroupGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricGroupGetProperties(
+        zet_metric_group_handle_t hMetricGroup,         ///< [in] handle of the metric group
+        zet_metric_group_properties_t* pProperties      ///< [in,out] metric group properties
+        )
+    {
+        auto pfnGetProperties = context.zetDdiTable.MetricGroup.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricGroup, pfnGetPropertiesCb, context.zetDdiTable.MetricGroup.pfnGetProperties, hMetricGroup, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricGroup, pfnGetPropertiesCb, context.zetDdiTable.MetricGroup.pfnGetProperties, hMetricGroup, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricGroup.pfnGetProperties, hMetricGroup, pProperties);
+
+        // capture parameters
+        zet_metric_group_get_properties_params_t tracerParams = {
+            &hMetricGroup,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricGroupGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricGroupGetPropertiesCb_t, Tools.MetricGroup, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricGroup.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricGroup,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricGroupCalculateMetricValues
+    template <>
+    struct APIRecordArgs<zet_metric_group_calculate_metric_values_params_t>
+    {
+        static uint32_t get(const zet_metric_group_calculate_metric_values_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricGroup);
+            args[count++] = recordArg(*params->prawDataSize);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricGroupCalculateMetricValues
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricGroupCalculateMetricValues(
+        zet_metric_group_handle_t hMetricGroup,         ///< [in] handle of the metric group
+        zet_metric_group_calculation_type_t type,       ///< [in] calculation type to be applied on raw data
+        size_t rawDataSize,                             ///< [in] size in bytes of raw data buffer
+        const uint8_t* pRawData,                        ///< [in][range(0, rawDataSize)] buffer of raw data to calculate
+        uint32_t* pMetricValueCount,                    ///< [in,out] pointer to number of metric values calculated.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of metric values to be calculated.
+                                                        ///< if count is greater than the number available in the raw data buffer,
+                                                        ///< then the driver shall update the value with the actual number of
+                                                        ///< metric values to be calculated.
+        zet_typed_value_t* pMetricValues                ///< [in,out][optional][range(0, *pMetricValueCount)] buffer of calculated metrics.
+                                                        ///< if count is less than the number available in the raw data buffer,
+                                                        ///< then driver shall only calculate that number of metric values.
+        )
+    {
+        auto pfnCalculateMetricValues = context.zetDdiTable.MetricGroup.pfnCalculateMetricValues;
+
+        if( nullptr == pfnCalculateMetricValues)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricGroup, pfnCalculateMetricValuesCb, context.zetDdiTable.MetricGroup.pfnCalculateMetricValues, hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricGroup, pfnCalculateMetricValuesCb, context.zetDdiTable.MetricGroup.pfnCalculateMetricValues, hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricGroup.pfnCalculateMetricValues, hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues);
+
+        // capture parameters
+        zet_metric_group_calculate_metric_values_params_t tracerParams = {
+            &hMetricGroup,
+            &type,
+            &rawDataSize,
+            &pRawData,
+            &pMetricValueCount,
+            &pMetricValues
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricGroupCalculateMetricValuesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricGroupCalculateMetricValuesCb_t, Tools.MetricGroup, pfnCalculateMetricValuesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricGroup.pfnCalculateMetricValues,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricGroup,
+                                                  *tracerParams.ptype,
+                                                  *tracerParams.prawDataSize,
+                                                  *tracerParams.ppRawData,
+                                                  *tracerParams.ppMetricValueCount,
+                                                  *tracerParams.ppMetricValues);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricGet
+    template <>
+    struct APIRecordArgs<zet_metric_get_params_t>
+    {
+        static uint32_t get(const zet_metric_get_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricGroup);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricGet
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricGet(
+        zet_metric_group_handle_t hMetricGroup,         ///< [in] handle of the metric group
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of metrics.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of metrics available.
+                                                        ///< if count is greater than the number of metrics available, then the
+                                                        ///< driver shall update the value with the correct number of metrics available.
+        zet_metric_handle_t* phMetrics                  ///< [in,out][optional][range(0, *pCount)] array of handle of metrics.
+                                                        ///< if count is less than the number of metrics available, then driver
+                                                        ///< shall only retrieve that number of metrics.
+        )
+    {
+        auto pfnGet = context.zetDdiTable.Metric.pfnGet;
+
+        if( nullptr == pfnGet)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Metric, pfnGetCb, context.zetDdiTable.Metric.pfnGet, hMetricGroup, pCount, phMetrics);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Metric, pfnGetCb, context.zetDdiTable.Metric.pfnGet, hMetricGroup, pCount, phMetrics);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Metric.pfnGet, hMetricGroup, pCount, phMetrics);
+
+        // capture parameters
+        zet_metric_get_params_t tracerParams = {
+            &hMetricGroup,
+            &pCount,
+            &phMetrics
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricGetCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricGetCb_t, Tools.Metric, pfnGetCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Metric.pfnGet,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricGroup,
+                                                  *tracerParams.ppCount,
+                                                  *tracerParams.pphMetrics);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricGetProperties
+    template <>
+    struct APIRecordArgs<zet_metric_get_properties_params_t>
+    {
+        static uint32_t get(const zet_metric_get_properties_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetric);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricGetProperties(
+        zet_metric_handle_t hMetric,                    ///< [in] handle of the metric
+        zet_metric_properties_t* pProperties            ///< [in,out] metric properties
+        )
+    {
+        auto pfnGetProperties = context.zetDdiTable.Metric.pfnGetProperties;
+
+        if( nullptr == pfnGetProperties)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Metric, pfnGetPropertiesCb, context.zetDdiTable.Metric.pfnGetProperties, hMetric, pProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Metric, pfnGetPropertiesCb, context.zetDdiTable.Metric.pfnGetProperties, hMetric, pProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Metric.pfnGetProperties, hMetric, pProperties);
+
+        // capture parameters
+        zet_metric_get_properties_params_t tracerParams = {
+            &hMetric,
+            &pProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricGetPropertiesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricGetPropertiesCb_t, Tools.Metric, pfnGetPropertiesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Metric.pfnGetProperties,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetric,
+                                                  *tracerParams.ppProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetContextActivateMetricGroups
+    template <>
+    struct APIRecordArgs<zet_context_activate_metric_groups_params_t>
+    {
+        static uint32_t get(const zet_context_activate_metric_groups_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->pcount);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetContextActivateMetricGroups
+    __zedlllocal ze_result_t ZE_APICALL
+    zetContextActivateMetricGroups(
+        zet_context_handle_t hContext,                  ///< [in] handle of the context object
+        zet_device_handle_t hDevice,                    ///< [in] handle of the device
+        uint32_t count,                                 ///< [in] metric group count to activate; must be 0 if `nullptr ==
+                                                        ///< phMetricGroups`
+        zet_metric_group_handle_t* phMetricGroups       ///< [in][optional][range(0, count)] handles of the metric groups to activate.
+                                                        ///< nullptr deactivates all previously used metric groups.
+                                                        ///< all metrics groups must come from a different domains.
+                                                        ///< metric query and metric stream must use activated metric groups.
+        )
+    {
+        auto pfnActivateMetricGroups = context.zetDdiTable.Context.pfnActivateMetricGroups;
+
+        if( nullptr == pfnActivateMetricGroups)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Context, pfnActivateMetricGroupsCb, context.zetDdiTable.Context.pfnActivateMetricGroups, hContext, hDevice, count, phMetricGroups);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Context, pfnActivateMetricGroupsCb, context.zetDdiTable.Context.pfnActivateMetricGroups, hContext, hDevice, count, phMetricGroups);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Context.pfnActivateMetricGroups, hContext, hDevice, count, phMetricGroups);
+
+        // capture parameters
+        zet_context_activate_metric_groups_params_t tracerParams = {
+            &hContext,
+            &hDevice,
+            &count,
+            &phMetricGroups
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnContextActivateMetricGroupsCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnContextActivateMetricGroupsCb_t, Tools.Context, pfnActivateMetricGroupsCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Context.pfnActivateMetricGroups,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phContext,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.pcount,
+                                                  *tracerParams.pphMetricGroups);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricStreamerOpen
+    template <>
+    struct APIRecordArgs<zet_metric_streamer_open_params_t>
+    {
+        static uint32_t get(const zet_metric_streamer_open_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->phMetricGroup);
+            args[count++] = recordArg(*params->phNotificationEvent);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zetMetricStreamerOpen
+    template <>
+    struct AsyncEpilogueOutArgs<zet_metric_streamer_open_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 5);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricStreamerOpen
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricStreamerOpen(
+        zet_context_handle_t hContext,                  ///< [in] handle of the context object
+        zet_device_handle_t hDevice,                    ///< [in] handle of the device
+        zet_metric_group_handle_t hMetricGroup,         ///< [in] handle of the metric group
+        zet_metric_streamer_desc_t* desc,               ///< [in,out] metric streamer descriptor
+        ze_event_handle_t hNotificationEvent,           ///< [in][optional] event used for report availability notification
+        zet_metric_streamer_handle_t* phMetricStreamer  ///< [out] handle of metric streamer
+        )
+    {
+        auto pfnOpen = context.zetDdiTable.MetricStreamer.pfnOpen;
+
+        if( nullptr == pfnOpen)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricStreamer, pfnOpenCb, context.zetDdiTable.MetricStreamer.pfnOpen, hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricStreamer, pfnOpenCb, context.zetDdiTable.MetricStreamer.pfnOpen, hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricStreamer.pfnOpen, hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer);
+
+        // capture parameters
+        zet_metric_streamer_open_params_t tracerParams = {
+            &hContext,
+            &hDevice,
+            &hMetricGroup,
+            &desc,
+            &hNotificationEvent,
+            &phMetricStreamer
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricStreamerOpenCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricStreamerOpenCb_t, Tools.MetricStreamer, pfnOpenCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricStreamer.pfnOpen,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phContext,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.phMetricGroup,
+                                                  *tracerParams.pdesc,
+                                                  *tracerParams.phNotificationEvent,
+                                                  *tracerParams.pphMetricStreamer);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetCommandListAppendMetricStreamerMarker
+    template <>
+    struct APIRecordArgs<zet_command_list_append_metric_streamer_marker_params_t>
+    {
+        static uint32_t get(const zet_command_list_append_metric_streamer_marker_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phMetricStreamer);
+            args[count++] = recordArg(*params->pvalue);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetCommandListAppendMetricStreamerMarker
+    __zedlllocal ze_result_t ZE_APICALL
+    zetCommandListAppendMetricStreamerMarker(
+        zet_command_list_handle_t hCommandList,         ///< [in] handle of the command list
+        zet_metric_streamer_handle_t hMetricStreamer,   ///< [in] handle of the metric streamer
+        uint32_t value                                  ///< [in] streamer marker value
+        )
+    {
+        auto pfnAppendMetricStreamerMarker = context.zetDdiTable.CommandList.pfnAppendMetricStreamerMarker;
+
+        if( nullptr == pfnAppendMetricStreamerMarker)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.CommandList, pfnAppendMetricStreamerMarkerCb, context.zetDdiTable.CommandList.pfnAppendMetricStreamerMarker, hCommandList, hMetricStreamer, value);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.CommandList, pfnAppendMetricStreamerMarkerCb, context.zetDdiTable.CommandList.pfnAppendMetricStreamerMarker, hCommandList, hMetricStreamer, value);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.CommandList.pfnAppendMetricStreamerMarker, hCommandList, hMetricStreamer, value);
+
+        // capture parameters
+        zet_command_list_append_metric_streamer_marker_params_t tracerParams = {
+            &hCommandList,
+            &hMetricStreamer,
+            &value
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnCommandListAppendMetricStreamerMarkerCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnCommandListAppendMetricStreamerMarkerCb_t, Tools.CommandList, pfnAppendMetricStreamerMarkerCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.CommandList.pfnAppendMetricStreamerMarker,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phCommandList,
+                                                  *tracerParams.phMetricStreamer,
+                                                  *tracerParams.pvalue);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricStreamerClose
+    template <>
+    struct APIRecordArgs<zet_metric_streamer_close_params_t>
+    {
+        static uint32_t get(const zet_metric_streamer_close_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricStreamer);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricStreamerClose
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricStreamerClose(
+        zet_metric_streamer_handle_t hMetricStreamer    ///< [in][release] handle of the metric streamer
+        )
+    {
+        auto pfnClose = context.zetDdiTable.MetricStreamer.pfnClose;
+
+        if( nullptr == pfnClose)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricStreamer, pfnCloseCb, context.zetDdiTable.MetricStreamer.pfnClose, hMetricStreamer);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricStreamer, pfnCloseCb, context.zetDdiTable.MetricStreamer.pfnClose, hMetricStreamer);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricStreamer.pfnClose, hMetricStreamer);
+
+        // capture parameters
+        zet_metric_streamer_close_params_t tracerParams = {
+            &hMetricStreamer
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricStreamerCloseCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricStreamerCloseCb_t, Tools.MetricStreamer, pfnCloseCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricStreamer.pfnClose,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricStreamer);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricStreamerReadData
+    template <>
+    struct APIRecordArgs<zet_metric_streamer_read_data_params_t>
+    {
+        static uint32_t get(const zet_metric_streamer_read_data_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricStreamer);
+            args[count++] = recordArg(*params->pmaxReportCount);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricStreamerReadData
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricStreamerReadData(
+        zet_metric_streamer_handle_t hMetricStreamer,   ///< [in] handle of the metric streamer
+        uint32_t maxReportCount,                        ///< [in] the maximum number of reports the application wants to receive.
+                                                        ///< if `UINT32_MAX`, then function will retrieve all reports available
+        size_t* pRawDataSize,                           ///< [in,out] pointer to size in bytes of raw data requested to read.
+                                                        ///< if size is zero, then the driver will update the value with the total
+                                                        ///< size in bytes needed for all reports available.
+                                                        ///< if size is non-zero, then driver will only retrieve the number of
+                                                        ///< reports that fit into the buffer.
+                                                        ///< if size is larger than size needed for all reports, then driver will
+                                                        ///< update the value with the actual size needed.
+        uint8_t* pRawData                               ///< [in,out][optional][range(0, *pRawDataSize)] buffer containing streamer
+                                                        ///< reports in raw format
+        )
+    {
+        auto pfnReadData = context.zetDdiTable.MetricStreamer.pfnReadData;
+
+        if( nullptr == pfnReadData)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricStreamer, pfnReadDataCb, context.zetDdiTable.MetricStreamer.pfnReadData, hMetricStreamer, maxReportCount, pRawDataSize, pRawData);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricStreamer, pfnReadDataCb, context.zetDdiTable.MetricStreamer.pfnReadData, hMetricStreamer, maxReportCount, pRawDataSize, pRawData);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricStreamer.pfnReadData, hMetricStreamer, maxReportCount, pRawDataSize, pRawData);
+
+        // capture parameters
+        zet_metric_streamer_read_data_params_t tracerParams = {
+            &hMetricStreamer,
+            &maxReportCount,
+            &pRawDataSize,
+            &pRawData
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricStreamerReadDataCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricStreamerReadDataCb_t, Tools.MetricStreamer, pfnReadDataCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricStreamer.pfnReadData,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricStreamer,
+                                                  *tracerParams.pmaxReportCount,
+                                                  *tracerParams.ppRawDataSize,
+                                                  *tracerParams.ppRawData);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricQueryPoolCreate
+    template <>
+    struct APIRecordArgs<zet_metric_query_pool_create_params_t>
+    {
+        static uint32_t get(const zet_metric_query_pool_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            args[count++] = recordArg(*params->phDevice);
+            args[count++] = recordArg(*params->phMetricGroup);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zetMetricQueryPoolCreate
+    template <>
+    struct AsyncEpilogueOutArgs<zet_metric_query_pool_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 4);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricQueryPoolCreate
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricQueryPoolCreate(
+        zet_context_handle_t hContext,                  ///< [in] handle of the context object
+        zet_device_handle_t hDevice,                    ///< [in] handle of the device
+        zet_metric_group_handle_t hMetricGroup,         ///< [in] metric group associated with the query object.
+        const zet_metric_query_pool_desc_t* desc,       ///< [in] metric query pool descriptor
+        zet_metric_query_pool_handle_t* phMetricQueryPool   ///< [out] handle of metric query pool
+        )
+    {
+        auto pfnCreate = context.zetDdiTable.MetricQueryPool.pfnCreate;
+
+        if( nullptr == pfnCreate)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricQueryPool, pfnCreateCb, context.zetDdiTable.MetricQueryPool.pfnCreate, hContext, hDevice, hMetricGroup, desc, phMetricQueryPool);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricQueryPool, pfnCreateCb, context.zetDdiTable.MetricQueryPool.pfnCreate, hContext, hDevice, hMetricGroup, desc, phMetricQueryPool);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricQueryPool.pfnCreate, hContext, hDevice, hMetricGroup, desc, phMetricQueryPool);
+
+        // capture parameters
+        zet_metric_query_pool_create_params_t tracerParams = {
+            &hContext,
+            &hDevice,
+            &hMetricGroup,
+            &desc,
+            &phMetricQueryPool
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricQueryPoolCreateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricQueryPoolCreateCb_t, Tools.MetricQueryPool, pfnCreateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricQueryPool.pfnCreate,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phContext,
+                                                  *tracerParams.phDevice,
+                                                  *tracerParams.phMetricGroup,
+                                                  *tracerParams.pdesc,
+                                                  *tracerParams.pphMetricQueryPool);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricQueryPoolDestroy
+    template <>
+    struct APIRecordArgs<zet_metric_query_pool_destroy_params_t>
+    {
+        static uint32_t get(const zet_metric_query_pool_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricQueryPool);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricQueryPoolDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricQueryPoolDestroy(
+        zet_metric_query_pool_handle_t hMetricQueryPool ///< [in][release] handle of the metric query pool
+        )
+    {
+        auto pfnDestroy = context.zetDdiTable.MetricQueryPool.pfnDestroy;
+
+        if( nullptr == pfnDestroy)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricQueryPool, pfnDestroyCb, context.zetDdiTable.MetricQueryPool.pfnDestroy, hMetricQueryPool);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricQueryPool, pfnDestroyCb, context.zetDdiTable.MetricQueryPool.pfnDestroy, hMetricQueryPool);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricQueryPool.pfnDestroy, hMetricQueryPool);
+
+        // capture parameters
+        zet_metric_query_pool_destroy_params_t tracerParams = {
+            &hMetricQueryPool
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricQueryPoolDestroyCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricQueryPoolDestroyCb_t, Tools.MetricQueryPool, pfnDestroyCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricQueryPool.pfnDestroy,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricQueryPool);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricQueryCreate
+    template <>
+    struct APIRecordArgs<zet_metric_query_create_params_t>
+    {
+        static uint32_t get(const zet_metric_query_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricQueryPool);
+            args[count++] = recordArg(*params->pindex);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zetMetricQueryCreate
+    template <>
+    struct AsyncEpilogueOutArgs<zet_metric_query_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 2);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricQueryCreate
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricQueryCreate(
+        zet_metric_query_pool_handle_t hMetricQueryPool,///< [in] handle of the metric query pool
+        uint32_t index,                                 ///< [in] index of the query within the pool
+        zet_metric_query_handle_t* phMetricQuery        ///< [out] handle of metric query
+        )
+    {
+        auto pfnCreate = context.zetDdiTable.MetricQuery.pfnCreate;
+
+        if( nullptr == pfnCreate)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricQuery, pfnCreateCb, context.zetDdiTable.MetricQuery.pfnCreate, hMetricQueryPool, index, phMetricQuery);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricQuery, pfnCreateCb, context.zetDdiTable.MetricQuery.pfnCreate, hMetricQueryPool, index, phMetricQuery);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricQuery.pfnCreate, hMetricQueryPool, index, phMetricQuery);
+
+        // capture parameters
+        zet_metric_query_create_params_t tracerParams = {
+            &hMetricQueryPool,
+            &index,
+            &phMetricQuery
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricQueryCreateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricQueryCreateCb_t, Tools.MetricQuery, pfnCreateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricQuery.pfnCreate,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricQueryPool,
+                                                  *tracerParams.pindex,
+                                                  *tracerParams.pphMetricQuery);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricQueryDestroy
+    template <>
+    struct APIRecordArgs<zet_metric_query_destroy_params_t>
+    {
+        static uint32_t get(const zet_metric_query_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricQuery);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricQueryDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricQueryDestroy(
+        zet_metric_query_handle_t hMetricQuery          ///< [in][release] handle of metric query
+        )
+    {
+        auto pfnDestroy = context.zetDdiTable.MetricQuery.pfnDestroy;
+
+        if( nullptr == pfnDestroy)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricQuery, pfnDestroyCb, context.zetDdiTable.MetricQuery.pfnDestroy, hMetricQuery);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricQuery, pfnDestroyCb, context.zetDdiTable.MetricQuery.pfnDestroy, hMetricQuery);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricQuery.pfnDestroy, hMetricQuery);
+
+        // capture parameters
+        zet_metric_query_destroy_params_t tracerParams = {
+            &hMetricQuery
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricQueryDestroyCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricQueryDestroyCb_t, Tools.MetricQuery, pfnDestroyCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricQuery.pfnDestroy,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricQuery);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricQueryReset
+    template <>
+    struct APIRecordArgs<zet_metric_query_reset_params_t>
+    {
+        static uint32_t get(const zet_metric_query_reset_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricQuery);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricQueryReset
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricQueryReset(
+        zet_metric_query_handle_t hMetricQuery          ///< [in] handle of metric query
+        )
+    {
+        auto pfnReset = context.zetDdiTable.MetricQuery.pfnReset;
+
+        if( nullptr == pfnReset)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricQuery, pfnResetCb, context.zetDdiTable.MetricQuery.pfnReset, hMetricQuery);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricQuery, pfnResetCb, context.zetDdiTable.MetricQuery.pfnReset, hMetricQuery);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricQuery.pfnReset, hMetricQuery);
+
+        // capture parameters
+        zet_metric_query_reset_params_t tracerParams = {
+            &hMetricQuery
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricQueryResetCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricQueryResetCb_t, Tools.MetricQuery, pfnResetCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricQuery.pfnReset,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricQuery);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetCommandListAppendMetricQueryBegin
+    template <>
+    struct APIRecordArgs<zet_command_list_append_metric_query_begin_params_t>
+    {
+        static uint32_t get(const zet_command_list_append_metric_query_begin_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phMetricQuery);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetCommandListAppendMetricQueryBegin
+    __zedlllocal ze_result_t ZE_APICALL
+    zetCommandListAppendMetricQueryBegin(
+        zet_command_list_handle_t hCommandList,         ///< [in] handle of the command list
+        zet_metric_query_handle_t hMetricQuery          ///< [in] handle of the metric query
+        )
+    {
+        auto pfnAppendMetricQueryBegin = context.zetDdiTable.CommandList.pfnAppendMetricQueryBegin;
+
+        if( nullptr == pfnAppendMetricQueryBegin)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.CommandList, pfnAppendMetricQueryBeginCb, context.zetDdiTable.CommandList.pfnAppendMetricQueryBegin, hCommandList, hMetricQuery);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.CommandList, pfnAppendMetricQueryBeginCb, context.zetDdiTable.CommandList.pfnAppendMetricQueryBegin, hCommandList, hMetricQuery);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.CommandList.pfnAppendMetricQueryBegin, hCommandList, hMetricQuery);
+
+        // capture parameters
+        zet_command_list_append_metric_query_begin_params_t tracerParams = {
+            &hCommandList,
+            &hMetricQuery
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnCommandListAppendMetricQueryBeginCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnCommandListAppendMetricQueryBeginCb_t, Tools.CommandList, pfnAppendMetricQueryBeginCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.CommandList.pfnAppendMetricQueryBegin,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phCommandList,
+                                                  *tracerParams.phMetricQuery);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetCommandListAppendMetricQueryEnd
+    template <>
+    struct APIRecordArgs<zet_command_list_append_metric_query_end_params_t>
+    {
+        static uint32_t get(const zet_command_list_append_metric_query_end_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            args[count++] = recordArg(*params->phMetricQuery);
+            args[count++] = recordArg(*params->phSignalEvent);
+            args[count++] = recordArg(*params->pnumWaitEvents);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetCommandListAppendMetricQueryEnd
+    __zedlllocal ze_result_t ZE_APICALL
+    zetCommandListAppendMetricQueryEnd(
+        zet_command_list_handle_t hCommandList,         ///< [in] handle of the command list
+        zet_metric_query_handle_t hMetricQuery,         ///< [in] handle of the metric query
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in] must be zero
+        ze_event_handle_t* phWaitEvents                 ///< [in][mbz] must be nullptr
+        )
+    {
+        auto pfnAppendMetricQueryEnd = context.zetDdiTable.CommandList.pfnAppendMetricQueryEnd;
+
+        if( nullptr == pfnAppendMetricQueryEnd)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.CommandList, pfnAppendMetricQueryEndCb, context.zetDdiTable.CommandList.pfnAppendMetricQueryEnd, hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.CommandList, pfnAppendMetricQueryEndCb, context.zetDdiTable.CommandList.pfnAppendMetricQueryEnd, hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.CommandList.pfnAppendMetricQueryEnd, hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        // capture parameters
+        zet_command_list_append_metric_query_end_params_t tracerParams = {
+            &hCommandList,
+            &hMetricQuery,
+            &hSignalEvent,
+            &numWaitEvents,
+            &phWaitEvents
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnCommandListAppendMetricQueryEndCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnCommandListAppendMetricQueryEndCb_t, Tools.CommandList, pfnAppendMetricQueryEndCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.CommandList.pfnAppendMetricQueryEnd,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phCommandList,
+                                                  *tracerParams.phMetricQuery,
+                                                  *tracerParams.phSignalEvent,
+                                                  *tracerParams.pnumWaitEvents,
+                                                  *tracerParams.pphWaitEvents);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetCommandListAppendMetricMemoryBarrier
+    template <>
+    struct APIRecordArgs<zet_command_list_append_metric_memory_barrier_params_t>
+    {
+        static uint32_t get(const zet_command_list_append_metric_memory_barrier_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phCommandList);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetCommandListAppendMetricMemoryBarrier
+    __zedlllocal ze_result_t ZE_APICALL
+    zetCommandListAppendMetricMemoryBarrier(
+        zet_command_list_handle_t hCommandList          ///< [in] handle of the command list
+        )
+    {
+        auto pfnAppendMetricMemoryBarrier = context.zetDdiTable.CommandList.pfnAppendMetricMemoryBarrier;
+
+        if( nullptr == pfnAppendMetricMemoryBarrier)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.CommandList, pfnAppendMetricMemoryBarrierCb, context.zetDdiTable.CommandList.pfnAppendMetricMemoryBarrier, hCommandList);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.CommandList, pfnAppendMetricMemoryBarrierCb, context.zetDdiTable.CommandList.pfnAppendMetricMemoryBarrier, hCommandList);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.CommandList.pfnAppendMetricMemoryBarrier, hCommandList);
+
+        // capture parameters
+        zet_command_list_append_metric_memory_barrier_params_t tracerParams = {
+            &hCommandList
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnCommandListAppendMetricMemoryBarrierCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnCommandListAppendMetricMemoryBarrierCb_t, Tools.CommandList, pfnAppendMetricMemoryBarrierCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.CommandList.pfnAppendMetricMemoryBarrier,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phCommandList);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricQueryGetData
+    template <>
+    struct APIRecordArgs<zet_metric_query_get_data_params_t>
+    {
+        static uint32_t get(const zet_metric_query_get_data_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricQuery);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricQueryGetData
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricQueryGetData(
+        zet_metric_query_handle_t hMetricQuery,         ///< [in] handle of the metric query
+        size_t* pRawDataSize,                           ///< [in,out] pointer to size in bytes of raw data requested to read.
+                                                        ///< if size is zero, then the driver will update the value with the total
+                                                        ///< size in bytes needed for all reports available.
+                                                        ///< if size is non-zero, then driver will only retrieve the number of
+                                                        ///< reports that fit into the buffer.
+                                                        ///< if size is larger than size needed for all reports, then driver will
+                                                        ///< update the value with the actual size needed.
+        uint8_t* pRawData                               ///< [in,out][optional][range(0, *pRawDataSize)] buffer containing query
+                                                        ///< reports in raw format
+        )
+    {
+        auto pfnGetData = context.zetDdiTable.MetricQuery.pfnGetData;
+
+        if( nullptr == pfnGetData)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricQuery, pfnGetDataCb, context.zetDdiTable.MetricQuery.pfnGetData, hMetricQuery, pRawDataSize, pRawData);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricQuery, pfnGetDataCb, context.zetDdiTable.MetricQuery.pfnGetData, hMetricQuery, pRawDataSize, pRawData);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricQuery.pfnGetData, hMetricQuery, pRawDataSize, pRawData);
+
+        // capture parameters
+        zet_metric_query_get_data_params_t tracerParams = {
+            &hMetricQuery,
+            &pRawDataSize,
+            &pRawData
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricQueryGetDataCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricQueryGetDataCb_t, Tools.MetricQuery, pfnGetDataCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricQuery.pfnGetData,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricQuery,
+                                                  *tracerParams.ppRawDataSize,
+                                                  *tracerParams.ppRawData);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetKernelGetProfileInfo
+    template <>
+    struct APIRecordArgs<zet_kernel_get_profile_info_params_t>
+    {
+        static uint32_t get(const zet_kernel_get_profile_info_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phKernel);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetKernelGetProfileInfo
+    __zedlllocal ze_result_t ZE_APICALL
+    zetKernelGetProfileInfo(
+        zet_kernel_handle_t hKernel,                    ///< [in] handle to kernel
+        zet_profile_properties_t* pProfileProperties    ///< [out] pointer to profile properties
+        )
+    {
+        auto pfnGetProfileInfo = context.zetDdiTable.Kernel.pfnGetProfileInfo;
+
+        if( nullptr == pfnGetProfileInfo)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.Kernel, pfnGetProfileInfoCb, context.zetDdiTable.Kernel.pfnGetProfileInfo, hKernel, pProfileProperties);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.Kernel, pfnGetProfileInfoCb, context.zetDdiTable.Kernel.pfnGetProfileInfo, hKernel, pProfileProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.Kernel.pfnGetProfileInfo, hKernel, pProfileProperties);
+
+        // capture parameters
+        zet_kernel_get_profile_info_params_t tracerParams = {
+            &hKernel,
+            &pProfileProperties
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnKernelGetProfileInfoCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnKernelGetProfileInfoCb_t, Tools.Kernel, pfnGetProfileInfoCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.Kernel.pfnGetProfileInfo,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phKernel,
+                                                  *tracerParams.ppProfileProperties);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetTracerExpCreate
+    template <>
+    struct APIRecordArgs<zet_tracer_exp_create_params_t>
+    {
+        static uint32_t get(const zet_tracer_exp_create_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phContext);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief [out] handles and pointers copied for deferred epilogues of zetTracerExpCreate
+    template <>
+    struct AsyncEpilogueOutArgs<zet_tracer_exp_create_params_t>
+    {
+        static constexpr uint32_t mask = (1u << 2);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetTracerExpCreate
+    __zedlllocal ze_result_t ZE_APICALL
+    zetTracerExpCreate(
+        zet_context_handle_t hContext,                  ///< [in] handle of the context object
+        const zet_tracer_exp_desc_t* desc,              ///< [in] pointer to tracer descriptor
+        zet_tracer_exp_handle_t* phTracer               ///< [out] pointer to handle of tracer object created
+        )
+    {
+        auto pfnCreate = context.zetDdiTable.TracerExp.pfnCreate;
+
+        if( nullptr == pfnCreate)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.TracerExp, pfnCreateCb, context.zetDdiTable.TracerExp.pfnCreate, hContext, desc, phTracer);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.TracerExp, pfnCreateCb, context.zetDdiTable.TracerExp.pfnCreate, hContext, desc, phTracer);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.TracerExp.pfnCreate, hContext, desc, phTracer);
+
+        // capture parameters
+        zet_tracer_exp_create_params_t tracerParams = {
+            &hContext,
+            &desc,
+            &phTracer
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnTracerExpCreateCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnTracerExpCreateCb_t, Tools.TracerExp, pfnCreateCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.TracerExp.pfnCreate,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phContext,
+                                                  *tracerParams.pdesc,
+                                                  *tracerParams.pphTracer);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetTracerExpDestroy
+    template <>
+    struct APIRecordArgs<zet_tracer_exp_destroy_params_t>
+    {
+        static uint32_t get(const zet_tracer_exp_destroy_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phTracer);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetTracerExpDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zetTracerExpDestroy(
+        zet_tracer_exp_handle_t hTracer                 ///< [in][release] handle of tracer object to destroy
+        )
+    {
+        auto pfnDestroy = context.zetDdiTable.TracerExp.pfnDestroy;
+
+        if( nullptr == pfnDestroy)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.TracerExp, pfnDestroyCb, context.zetDdiTable.TracerExp.pfnDestroy, hTracer);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.TracerExp, pfnDestroyCb, context.zetDdiTable.TracerExp.pfnDestroy, hTracer);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.TracerExp.pfnDestroy, hTracer);
+
+        // capture parameters
+        zet_tracer_exp_destroy_params_t tracerParams = {
+            &hTracer
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnTracerExpDestroyCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnTracerExpDestroyCb_t, Tools.TracerExp, pfnDestroyCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.TracerExp.pfnDestroy,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phTracer);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetTracerExpSetPrologues
+    template <>
+    struct APIRecordArgs<zet_tracer_exp_set_prologues_params_t>
+    {
+        static uint32_t get(const zet_tracer_exp_set_prologues_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phTracer);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetTracerExpSetPrologues
+    __zedlllocal ze_result_t ZE_APICALL
+    zetTracerExpSetPrologues(
+        zet_tracer_exp_handle_t hTracer,                ///< [in] handle of the tracer
+        zet_core_callbacks_t* pCoreCbs                  ///< [in] pointer to table of 'core' callback function pointers
+        )
+    {
+        auto pfnSetPrologues = context.zetDdiTable.TracerExp.pfnSetPrologues;
+
+        if( nullptr == pfnSetPrologues)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.TracerExp, pfnSetProloguesCb, context.zetDdiTable.TracerExp.pfnSetPrologues, hTracer, pCoreCbs);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.TracerExp, pfnSetProloguesCb, context.zetDdiTable.TracerExp.pfnSetPrologues, hTracer, pCoreCbs);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.TracerExp.pfnSetPrologues, hTracer, pCoreCbs);
+
+        // capture parameters
+        zet_tracer_exp_set_prologues_params_t tracerParams = {
+            &hTracer,
+            &pCoreCbs
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnTracerExpSetProloguesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnTracerExpSetProloguesCb_t, Tools.TracerExp, pfnSetProloguesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.TracerExp.pfnSetPrologues,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phTracer,
+                                                  *tracerParams.ppCoreCbs);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetTracerExpSetEpilogues
+    template <>
+    struct APIRecordArgs<zet_tracer_exp_set_epilogues_params_t>
+    {
+        static uint32_t get(const zet_tracer_exp_set_epilogues_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phTracer);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetTracerExpSetEpilogues
+    __zedlllocal ze_result_t ZE_APICALL
+    zetTracerExpSetEpilogues(
+        zet_tracer_exp_handle_t hTracer,                ///< [in] handle of the tracer
+        zet_core_callbacks_t* pCoreCbs                  ///< [in] pointer to table of 'core' callback function pointers
+        )
+    {
+        auto pfnSetEpilogues = context.zetDdiTable.TracerExp.pfnSetEpilogues;
+
+        if( nullptr == pfnSetEpilogues)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.TracerExp, pfnSetEpiloguesCb, context.zetDdiTable.TracerExp.pfnSetEpilogues, hTracer, pCoreCbs);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.TracerExp, pfnSetEpiloguesCb, context.zetDdiTable.TracerExp.pfnSetEpilogues, hTracer, pCoreCbs);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.TracerExp.pfnSetEpilogues, hTracer, pCoreCbs);
+
+        // capture parameters
+        zet_tracer_exp_set_epilogues_params_t tracerParams = {
+            &hTracer,
+            &pCoreCbs
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnTracerExpSetEpiloguesCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnTracerExpSetEpiloguesCb_t, Tools.TracerExp, pfnSetEpiloguesCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.TracerExp.pfnSetEpilogues,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phTracer,
+                                                  *tracerParams.ppCoreCbs);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetTracerExpSetEnabled
+    template <>
+    struct APIRecordArgs<zet_tracer_exp_set_enabled_params_t>
+    {
+        static uint32_t get(const zet_tracer_exp_set_enabled_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phTracer);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetTracerExpSetEnabled
+    __zedlllocal ze_result_t ZE_APICALL
+    zetTracerExpSetEnabled(
+        zet_tracer_exp_handle_t hTracer,                ///< [in] handle of the tracer
+        ze_bool_t enable                                ///< [in] enable the tracer if true; disable if false
+        )
+    {
+        auto pfnSetEnabled = context.zetDdiTable.TracerExp.pfnSetEnabled;
+
+        if( nullptr == pfnSetEnabled)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.TracerExp, pfnSetEnabledCb, context.zetDdiTable.TracerExp.pfnSetEnabled, hTracer, enable);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.TracerExp, pfnSetEnabledCb, context.zetDdiTable.TracerExp.pfnSetEnabled, hTracer, enable);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.TracerExp.pfnSetEnabled, hTracer, enable);
+
+        // capture parameters
+        zet_tracer_exp_set_enabled_params_t tracerParams = {
+            &hTracer,
+            &enable
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnTracerExpSetEnabledCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnTracerExpSetEnabledCb_t, Tools.TracerExp, pfnSetEnabledCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.TracerExp.pfnSetEnabled,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phTracer,
+                                                  *tracerParams.penable);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricGroupCalculateMultipleMetricValuesExp
+    template <>
+    struct APIRecordArgs<zet_metric_group_calculate_multiple_metric_values_exp_params_t>
+    {
+        static uint32_t get(const zet_metric_group_calculate_multiple_metric_values_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricGroup);
+            args[count++] = recordArg(*params->prawDataSize);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricGroupCalculateMultipleMetricValuesExp
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricGroupCalculateMultipleMetricValuesExp(
+        zet_metric_group_handle_t hMetricGroup,         ///< [in] handle of the metric group
+        zet_metric_group_calculation_type_t type,       ///< [in] calculation type to be applied on raw data
+        size_t rawDataSize,                             ///< [in] size in bytes of raw data buffer
+        const uint8_t* pRawData,                        ///< [in][range(0, rawDataSize)] buffer of raw data to calculate
+        uint32_t* pSetCount,                            ///< [in,out] pointer to number of metric sets.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of metric sets to be calculated.
+                                                        ///< if count is greater than the number available in the raw data buffer,
+                                                        ///< then the driver shall update the value with the actual number of
+                                                        ///< metric sets to be calculated.
+        uint32_t* pTotalMetricValueCount,               ///< [in,out] pointer to number of the total number of metric values
+                                                        ///< calculated, for all metric sets.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of metric values to be calculated.
+                                                        ///< if count is greater than the number available in the raw data buffer,
+                                                        ///< then the driver shall update the value with the actual number of
+                                                        ///< metric values to be calculated.
+        uint32_t* pMetricCounts,                        ///< [in,out][optional][range(0, *pSetCount)] buffer of metric counts per
+                                                        ///< metric set.
+        zet_typed_value_t* pMetricValues                ///< [in,out][optional][range(0, *pTotalMetricValueCount)] buffer of
+                                                        ///< calculated metrics.
+                                                        ///< if count is less than the number available in the raw data buffer,
+                                                        ///< then driver shall only calculate that number of metric values.
+        )
+    {
+        auto pfnCalculateMultipleMetricValuesExp = context.zetDdiTable.MetricGroupExp.pfnCalculateMultipleMetricValuesExp;
+
+        if( nullptr == pfnCalculateMultipleMetricValuesExp)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricGroup, pfnCalculateMultipleMetricValuesExpCb, context.zetDdiTable.MetricGroupExp.pfnCalculateMultipleMetricValuesExp, hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricGroup, pfnCalculateMultipleMetricValuesExpCb, context.zetDdiTable.MetricGroupExp.pfnCalculateMultipleMetricValuesExp, hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricGroupExp.pfnCalculateMultipleMetricValuesExp, hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
+
+        // capture parameters
+        zet_metric_group_calculate_multiple_metric_values_exp_params_t tracerParams = {
+            &hMetricGroup,
+            &type,
+            &rawDataSize,
+            &pRawData,
+            &pSetCount,
+            &pTotalMetricValueCount,
+            &pMetricCounts,
+            &pMetricValues
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricGroupCalculateMultipleMetricValuesExpCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricGroupCalculateMultipleMetricValuesExpCb_t, Tools.MetricGroup, pfnCalculateMultipleMetricValuesExpCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricGroupExp.pfnCalculateMultipleMetricValuesExp,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricGroup,
+                                                  *tracerParams.ptype,
+                                                  *tracerParams.prawDataSize,
+                                                  *tracerParams.ppRawData,
+                                                  *tracerParams.ppSetCount,
+                                                  *tracerParams.ppTotalMetricValueCount,
+                                                  *tracerParams.ppMetricCounts,
+                                                  *tracerParams.ppMetricValues);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricGroupGetGlobalTimestampsExp
+    template <>
+    struct APIRecordArgs<zet_metric_group_get_global_timestamps_exp_params_t>
+    {
+        static uint32_t get(const zet_metric_group_get_global_timestamps_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricGroup);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricGroupGetGlobalTimestampsExp
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricGroupGetGlobalTimestampsExp(
+        zet_metric_group_handle_t hMetricGroup,         ///< [in] handle of the metric group
+        ze_bool_t synchronizedWithHost,                 ///< [in] Returns the timestamps synchronized to the host or the device.
+        uint64_t* globalTimestamp,                      ///< [out] Device timestamp.
+        uint64_t* metricTimestamp                       ///< [out] Metric timestamp.
+        )
+    {
+        auto pfnGetGlobalTimestampsExp = context.zetDdiTable.MetricGroupExp.pfnGetGlobalTimestampsExp;
+
+        if( nullptr == pfnGetGlobalTimestampsExp)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricGroup, pfnGetGlobalTimestampsExpCb, context.zetDdiTable.MetricGroupExp.pfnGetGlobalTimestampsExp, hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricGroup, pfnGetGlobalTimestampsExpCb, context.zetDdiTable.MetricGroupExp.pfnGetGlobalTimestampsExp, hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricGroupExp.pfnGetGlobalTimestampsExp, hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp);
+
+        // capture parameters
+        zet_metric_group_get_global_timestamps_exp_params_t tracerParams = {
+            &hMetricGroup,
+            &synchronizedWithHost,
+            &globalTimestamp,
+            &metricTimestamp
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricGroupGetGlobalTimestampsExpCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricGroupGetGlobalTimestampsExpCb_t, Tools.MetricGroup, pfnGetGlobalTimestampsExpCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricGroupExp.pfnGetGlobalTimestampsExp,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricGroup,
+                                                  *tracerParams.psynchronizedWithHost,
+                                                  *tracerParams.pglobalTimestamp,
+                                                  *tracerParams.pmetricTimestamp);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricGroupGetExportDataExp
+    template <>
+    struct APIRecordArgs<zet_metric_group_get_export_data_exp_params_t>
+    {
+        static uint32_t get(const zet_metric_group_get_export_data_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phMetricGroup);
+            args[count++] = recordArg(*params->prawDataSize);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricGroupGetExportDataExp
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricGroupGetExportDataExp(
+        zet_metric_group_handle_t hMetricGroup,         ///< [in] handle of the metric group
+        const uint8_t* pRawData,                        ///< [in] buffer of raw data
+        size_t rawDataSize,                             ///< [in] size in bytes of raw data buffer
+        size_t* pExportDataSize,                        ///< [in,out] size in bytes of export data buffer
+                                                        ///< if size is zero, then the driver shall update the value with the
+                                                        ///< number of bytes necessary to store the exported data.
+                                                        ///< if size is greater than required, then the driver shall update the
+                                                        ///< value with the actual number of bytes necessary to store the exported data.
+        uint8_t * pExportData                           ///< [in,out][optional][range(0, *pExportDataSize)] buffer of exported data.
+        )
+    {
+        auto pfnGetExportDataExp = context.zetDdiTable.MetricGroupExp.pfnGetExportDataExp;
+
+        if( nullptr == pfnGetExportDataExp)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricGroup, pfnGetExportDataExpCb, context.zetDdiTable.MetricGroupExp.pfnGetExportDataExp, hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricGroup, pfnGetExportDataExpCb, context.zetDdiTable.MetricGroupExp.pfnGetExportDataExp, hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricGroupExp.pfnGetExportDataExp, hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData);
+
+        // capture parameters
+        zet_metric_group_get_export_data_exp_params_t tracerParams = {
+            &hMetricGroup,
+            &pRawData,
+            &rawDataSize,
+            &pExportDataSize,
+            &pExportData
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricGroupGetExportDataExpCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricGroupGetExportDataExpCb_t, Tools.MetricGroup, pfnGetExportDataExpCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricGroupExp.pfnGetExportDataExp,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phMetricGroup,
+                                                  *tracerParams.ppRawData,
+                                                  *tracerParams.prawDataSize,
+                                                  *tracerParams.ppExportDataSize,
+                                                  *tracerParams.ppExportData);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Arguments recorded for zetMetricGroupCalculateMetricExportDataExp
+    template <>
+    struct APIRecordArgs<zet_metric_group_calculate_metric_export_data_exp_params_t>
+    {
+        static uint32_t get(const zet_metric_group_calculate_metric_export_data_exp_params_t *params, uint64_t *args)
+        {
+            uint32_t count = 0;
+            args[count++] = recordArg(*params->phDriver);
+            args[count++] = recordArg(*params->pexportDataSize);
+            return count;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetMetricGroupCalculateMetricExportDataExp
+    __zedlllocal ze_result_t ZE_APICALL
+    zetMetricGroupCalculateMetricExportDataExp(
+        ze_driver_handle_t hDriver,                     ///< [in] handle of the driver instance
+        zet_metric_group_calculation_type_t type,       ///< [in] calculation type to be applied on raw data
+        size_t exportDataSize,                          ///< [in] size in bytes of exported data buffer
+        const uint8_t* pExportData,                     ///< [in][range(0, exportDataSize)] buffer of exported data to calculate
+        zet_metric_calculate_exp_desc_t* pCalculateDescriptor,  ///< [in] descriptor specifying calculation specific parameters
+        uint32_t* pSetCount,                            ///< [in,out] pointer to number of metric sets.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of metric sets to be calculated.
+                                                        ///< if count is greater than the number available in the raw data buffer,
+                                                        ///< then the driver shall update the value with the actual number of
+                                                        ///< metric sets to be calculated.
+        uint32_t* pTotalMetricValueCount,               ///< [in,out] pointer to number of the total number of metric values
+                                                        ///< calculated, for all metric sets.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of metric values to be calculated.
+                                                        ///< if count is greater than the number available in the raw data buffer,
+                                                        ///< then the driver shall update the value with the actual number of
+                                                        ///< metric values to be calculated.
+        uint32_t* pMetricCounts,                        ///< [in,out][optional][range(0, *pSetCount)] buffer of metric counts per
+                                                        ///< metric set.
+        zet_typed_value_t* pMetricValues                ///< [in,out][optional][range(0, *pTotalMetricValueCount)] buffer of
+                                                        ///< calculated metrics.
+                                                        ///< if count is less than the number available in the raw data buffer,
+                                                        ///< then driver shall only calculate that number of metric values.
+        )
+    {
+        auto pfnCalculateMetricExportDataExp = context.zetDdiTable.MetricGroupExp.pfnCalculateMetricExportDataExp;
+
+        if( nullptr == pfnCalculateMetricExportDataExp)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        ZE_HANDLE_UNARMED_API(Tools.MetricGroup, pfnCalculateMetricExportDataExpCb, context.zetDdiTable.MetricGroupExp.pfnCalculateMetricExportDataExp, hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
+
+        ZE_HANDLE_UNSAMPLED_API(Tools.MetricGroup, pfnCalculateMetricExportDataExpCb, context.zetDdiTable.MetricGroupExp.pfnCalculateMetricExportDataExp, hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
+
+        ZE_HANDLE_TRACER_RECURSION(context.zetDdiTable.MetricGroupExp.pfnCalculateMetricExportDataExp, hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues);
+
+        // capture parameters
+        zet_metric_group_calculate_metric_export_data_exp_params_t tracerParams = {
+            &hDriver,
+            &type,
+            &exportDataSize,
+            &pExportData,
+            &pCalculateDescriptor,
+            &pSetCount,
+            &pTotalMetricValueCount,
+            &pMetricCounts,
+            &pMetricValues
+        };
+
+        tracing_layer::APITracerCallbackDataImp<zet_pfnMetricGroupCalculateMetricExportDataExpCb_t> apiCallbackData;
+
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, zet_pfnMetricGroupCalculateMetricExportDataExpCb_t, Tools.MetricGroup, pfnCalculateMetricExportDataExpCb);
+
+
+        return tracing_layer::APITracerWrapperImp(context.zetDdiTable.MetricGroupExp.pfnCalculateMetricExportDataExp,
+                                                  &tracerParams,
+                                                  apiCallbackData,
+                                                  *tracerParams.phDriver,
+                                                  *tracerParams.ptype,
+                                                  *tracerParams.pexportDataSize,
+                                                  *tracerParams.ppExportData,
+                                                  *tracerParams.ppCalculateDescriptor,
+                                                  *tracerParams.ppSetCount,
+                                                  *tracerParams.ppTotalMetricValueCount,
+                                                  *tracerParams.ppMetricCounts,
+                                                  *tracerParams.ppMetricValues);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Names of the traced APIs and of their recorded arguments
+    const api_record_desc_t zetApiRecordDescs[] = {
+        {ZE_TRACER_API_INDEX(Tools.Module, pfnGetDebugInfoCb), "zetModuleGetDebugInfo", "hModule"},
+        {ZE_TRACER_API_INDEX(Tools.Device, pfnGetDebugPropertiesCb), "zetDeviceGetDebugProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Tools.Debug, pfnAttachCb), "zetDebugAttach", "hDevice"},
+        {ZE_TRACER_API_INDEX(Tools.Debug, pfnDetachCb), "zetDebugDetach", "hDebug"},
+        {ZE_TRACER_API_INDEX(Tools.Debug, pfnReadEventCb), "zetDebugReadEvent", "hDebug,timeout"},
+        {ZE_TRACER_API_INDEX(Tools.Debug, pfnAcknowledgeEventCb), "zetDebugAcknowledgeEvent", "hDebug"},
+        {ZE_TRACER_API_INDEX(Tools.Debug, pfnInterruptCb), "zetDebugInterrupt", "hDebug"},
+        {ZE_TRACER_API_INDEX(Tools.Debug, pfnResumeCb), "zetDebugResume", "hDebug"},
+        {ZE_TRACER_API_INDEX(Tools.Debug, pfnReadMemoryCb), "zetDebugReadMemory", "hDebug,size"},
+        {ZE_TRACER_API_INDEX(Tools.Debug, pfnWriteMemoryCb), "zetDebugWriteMemory", "hDebug,size"},
+        {ZE_TRACER_API_INDEX(Tools.Debug, pfnGetRegisterSetPropertiesCb), "zetDebugGetRegisterSetProperties", "hDevice"},
+        {ZE_TRACER_API_INDEX(Tools.Debug, pfnGetThreadRegisterSetPropertiesCb), "zetDebugGetThreadRegisterSetProperties", "hDebug"},
+        {ZE_TRACER_API_INDEX(Tools.Debug, pfnReadRegistersCb), "zetDebugReadRegisters", "hDebug,type,start,count"},
+        {ZE_TRACER_API_INDEX(Tools.Debug, pfnWriteRegistersCb), "zetDebugWriteRegisters", "hDebug,type,start,count"},
+        {ZE_TRACER_API_INDEX(Tools.MetricGroup, pfnGetCb), "zetMetricGroupGet", "hDevice"},
+        {ZE_TRACER_API_INDEX(Tools.MetricGroup, pfnGetPropertiesCb), "zetMetricGroupGetProperties", "hMetricGroup"},
+        {ZE_TRACER_API_INDEX(Tools.MetricGroup, pfnCalculateMetricValuesCb), "zetMetricGroupCalculateMetricValues", "hMetricGroup,rawDataSize"},
+        {ZE_TRACER_API_INDEX(Tools.Metric, pfnGetCb), "zetMetricGet", "hMetricGroup"},
+        {ZE_TRACER_API_INDEX(Tools.Metric, pfnGetPropertiesCb), "zetMetricGetProperties", "hMetric"},
+        {ZE_TRACER_API_INDEX(Tools.Context, pfnActivateMetricGroupsCb), "zetContextActivateMetricGroups", "hContext,hDevice,count"},
+        {ZE_TRACER_API_INDEX(Tools.MetricStreamer, pfnOpenCb), "zetMetricStreamerOpen", "hContext,hDevice,hMetricGroup,hNotificationEvent"},
+        {ZE_TRACER_API_INDEX(Tools.CommandList, pfnAppendMetricStreamerMarkerCb), "zetCommandListAppendMetricStreamerMarker", "hCommandList,hMetricStreamer,value"},
+        {ZE_TRACER_API_INDEX(Tools.MetricStreamer, pfnCloseCb), "zetMetricStreamerClose", "hMetricStreamer"},
+        {ZE_TRACER_API_INDEX(Tools.MetricStreamer, pfnReadDataCb), "zetMetricStreamerReadData", "hMetricStreamer,maxReportCount"},
+        {ZE_TRACER_API_INDEX(Tools.MetricQueryPool, pfnCreateCb), "zetMetricQueryPoolCreate", "hContext,hDevice,hMetricGroup"},
+        {ZE_TRACER_API_INDEX(Tools.MetricQueryPool, pfnDestroyCb), "zetMetricQueryPoolDestroy", "hMetricQueryPool"},
+        {ZE_TRACER_API_INDEX(Tools.MetricQuery, pfnCreateCb), "zetMetricQueryCreate", "hMetricQueryPool,index"},
+        {ZE_TRACER_API_INDEX(Tools.MetricQuery, pfnDestroyCb), "zetMetricQueryDestroy", "hMetricQuery"},
+        {ZE_TRACER_API_INDEX(Tools.MetricQuery, pfnResetCb), "zetMetricQueryReset", "hMetricQuery"},
+        {ZE_TRACER_API_INDEX(Tools.CommandList, pfnAppendMetricQueryBeginCb), "zetCommandListAppendMetricQueryBegin", "hCommandList,hMetricQuery"},
+        {ZE_TRACER_API_INDEX(Tools.CommandList, pfnAppendMetricQueryEndCb), "zetCommandListAppendMetricQueryEnd", "hCommandList,hMetricQuery,hSignalEvent,numWaitEvents"},
+        {ZE_TRACER_API_INDEX(Tools.CommandList, pfnAppendMetricMemoryBarrierCb), "zetCommandListAppendMetricMemoryBarrier", "hCommandList"},
+        {ZE_TRACER_API_INDEX(Tools.MetricQuery, pfnGetDataCb), "zetMetricQueryGetData", "hMetricQuery"},
+        {ZE_TRACER_API_INDEX(Tools.Kernel, pfnGetProfileInfoCb), "zetKernelGetProfileInfo", "hKernel"},
+        {ZE_TRACER_API_INDEX(Tools.TracerExp, pfnCreateCb), "zetTracerExpCreate", "hContext"},
+        {ZE_TRACER_API_INDEX(Tools.TracerExp, pfnDestroyCb), "zetTracerExpDestroy", "hTracer"},
+        {ZE_TRACER_API_INDEX(Tools.TracerExp, pfnSetProloguesCb), "zetTracerExpSetPrologues", "hTracer"},
+        {ZE_TRACER_API_INDEX(Tools.TracerExp, pfnSetEpiloguesCb), "zetTracerExpSetEpilogues", "hTracer"},
+        {ZE_TRACER_API_INDEX(Tools.TracerExp, pfnSetEnabledCb), "zetTracerExpSetEnabled", "hTracer"},
+        {ZE_TRACER_API_INDEX(Tools.MetricGroup, pfnCalculateMultipleMetricValuesExpCb), "zetMetricGroupCalculateMultipleMetricValuesExp", "hMetricGroup,rawDataSize"},
+        {ZE_TRACER_API_INDEX(Tools.MetricGroup, pfnGetGlobalTimestampsExpCb), "zetMetricGroupGetGlobalTimestampsExp", "hMetricGroup"},
+        {ZE_TRACER_API_INDEX(Tools.MetricGroup, pfnGetExportDataExpCb), "zetMetricGroupGetExportDataExp", "hMetricGroup,rawDataSize"},
+        {ZE_TRACER_API_INDEX(Tools.MetricGroup, pfnCalculateMetricExportDataExpCb), "zetMetricGroupCalculateMetricExportDataExp", "hDriver,exportDataSize"},
+    };
+
+    const size_t zetApiRecordDescCount = sizeof(zetApiRecordDescs) / sizeof(zetApiRecordDescs[0]);
+
+} // namespace tracing_layer
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Device table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetDeviceProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_device_dditable_t* pDdiTable                ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.Device;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetDebugProperties                       = pDdiTable->pfnGetDebugProperties;
+    pDdiTable->pfnGetDebugProperties                     = tracing_layer::zetDeviceGetDebugProperties;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Context table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetContextProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_context_dditable_t* pDdiTable               ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.Context;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnActivateMetricGroups                     = pDdiTable->pfnActivateMetricGroups;
+    pDdiTable->pfnActivateMetricGroups                   = tracing_layer::zetContextActivateMetricGroups;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's CommandList table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetCommandListProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_command_list_dditable_t* pDdiTable          ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.CommandList;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnAppendMetricStreamerMarker               = pDdiTable->pfnAppendMetricStreamerMarker;
+    pDdiTable->pfnAppendMetricStreamerMarker             = tracing_layer::zetCommandListAppendMetricStreamerMarker;
+
+    dditable.pfnAppendMetricQueryBegin                   = pDdiTable->pfnAppendMetricQueryBegin;
+    pDdiTable->pfnAppendMetricQueryBegin                 = tracing_layer::zetCommandListAppendMetricQueryBegin;
+
+    dditable.pfnAppendMetricQueryEnd                     = pDdiTable->pfnAppendMetricQueryEnd;
+    pDdiTable->pfnAppendMetricQueryEnd                   = tracing_layer::zetCommandListAppendMetricQueryEnd;
+
+    dditable.pfnAppendMetricMemoryBarrier                = pDdiTable->pfnAppendMetricMemoryBarrier;
+    pDdiTable->pfnAppendMetricMemoryBarrier              = tracing_layer::zetCommandListAppendMetricMemoryBarrier;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Kernel table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetKernelProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_kernel_dditable_t* pDdiTable                ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.Kernel;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetProfileInfo                           = pDdiTable->pfnGetProfileInfo;
+    pDdiTable->pfnGetProfileInfo                         = tracing_layer::zetKernelGetProfileInfo;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Module table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetModuleProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_module_dditable_t* pDdiTable                ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.Module;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGetDebugInfo                             = pDdiTable->pfnGetDebugInfo;
+    pDdiTable->pfnGetDebugInfo                           = tracing_layer::zetModuleGetDebugInfo;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Debug table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetDebugProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_debug_dditable_t* pDdiTable                 ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.Debug;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnAttach                                   = pDdiTable->pfnAttach;
+    pDdiTable->pfnAttach                                 = tracing_layer::zetDebugAttach;
+
+    dditable.pfnDetach                                   = pDdiTable->pfnDetach;
+    pDdiTable->pfnDetach                                 = tracing_layer::zetDebugDetach;
+
+    dditable.pfnReadEvent                                = pDdiTable->pfnReadEvent;
+    pDdiTable->pfnReadEvent                              = tracing_layer::zetDebugReadEvent;
+
+    dditable.pfnAcknowledgeEvent                         = pDdiTable->pfnAcknowledgeEvent;
+    pDdiTable->pfnAcknowledgeEvent                       = tracing_layer::zetDebugAcknowledgeEvent;
+
+    dditable.pfnInterrupt                                = pDdiTable->pfnInterrupt;
+    pDdiTable->pfnInterrupt                              = tracing_layer::zetDebugInterrupt;
+
+    dditable.pfnResume                                   = pDdiTable->pfnResume;
+    pDdiTable->pfnResume                                 = tracing_layer::zetDebugResume;
+
+    dditable.pfnReadMemory                               = pDdiTable->pfnReadMemory;
+    pDdiTable->pfnReadMemory                             = tracing_layer::zetDebugReadMemory;
+
+    dditable.pfnWriteMemory                              = pDdiTable->pfnWriteMemory;
+    pDdiTable->pfnWriteMemory                            = tracing_layer::zetDebugWriteMemory;
+
+    dditable.pfnGetRegisterSetProperties                 = pDdiTable->pfnGetRegisterSetProperties;
+    pDdiTable->pfnGetRegisterSetProperties               = tracing_layer::zetDebugGetRegisterSetProperties;
+
+    dditable.pfnReadRegisters                            = pDdiTable->pfnReadRegisters;
+    pDdiTable->pfnReadRegisters                          = tracing_layer::zetDebugReadRegisters;
+
+    dditable.pfnWriteRegisters                           = pDdiTable->pfnWriteRegisters;
+    pDdiTable->pfnWriteRegisters                         = tracing_layer::zetDebugWriteRegisters;
+
+    dditable.pfnGetThreadRegisterSetProperties           = pDdiTable->pfnGetThreadRegisterSetProperties;
+    pDdiTable->pfnGetThreadRegisterSetProperties         = tracing_layer::zetDebugGetThreadRegisterSetProperties;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Metric table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetMetricProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_metric_dditable_t* pDdiTable                ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.Metric;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGet                                      = pDdiTable->pfnGet;
+    pDdiTable->pfnGet                                    = tracing_layer::zetMetricGet;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zetMetricGetProperties;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's MetricGroup table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetMetricGroupProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_metric_group_dditable_t* pDdiTable          ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.MetricGroup;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnGet                                      = pDdiTable->pfnGet;
+    pDdiTable->pfnGet                                    = tracing_layer::zetMetricGroupGet;
+
+    dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    pDdiTable->pfnGetProperties                          = tracing_layer::zetMetricGroupGetProperties;
+
+    dditable.pfnCalculateMetricValues                    = pDdiTable->pfnCalculateMetricValues;
+    pDdiTable->pfnCalculateMetricValues                  = tracing_layer::zetMetricGroupCalculateMetricValues;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's MetricGroupExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetMetricGroupExpProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_metric_group_exp_dditable_t* pDdiTable      ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.MetricGroupExp;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnCalculateMultipleMetricValuesExp         = pDdiTable->pfnCalculateMultipleMetricValuesExp;
+    pDdiTable->pfnCalculateMultipleMetricValuesExp       = tracing_layer::zetMetricGroupCalculateMultipleMetricValuesExp;
+
+    dditable.pfnGetGlobalTimestampsExp                   = pDdiTable->pfnGetGlobalTimestampsExp;
+    pDdiTable->pfnGetGlobalTimestampsExp                 = tracing_layer::zetMetricGroupGetGlobalTimestampsExp;
+
+    dditable.pfnGetExportDataExp                         = pDdiTable->pfnGetExportDataExp;
+    pDdiTable->pfnGetExportDataExp                       = tracing_layer::zetMetricGroupGetExportDataExp;
+
+    dditable.pfnCalculateMetricExportDataExp             = pDdiTable->pfnCalculateMetricExportDataExp;
+    pDdiTable->pfnCalculateMetricExportDataExp           = tracing_layer::zetMetricGroupCalculateMetricExportDataExp;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's MetricQuery table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetMetricQueryProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_metric_query_dditable_t* pDdiTable          ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.MetricQuery;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnCreate                                   = pDdiTable->pfnCreate;
+    pDdiTable->pfnCreate                                 = tracing_layer::zetMetricQueryCreate;
+
+    dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+    pDdiTable->pfnDestroy                                = tracing_layer::zetMetricQueryDestroy;
+
+    dditable.pfnReset                                    = pDdiTable->pfnReset;
+    pDdiTable->pfnReset                                  = tracing_layer::zetMetricQueryReset;
+
+    dditable.pfnGetData                                  = pDdiTable->pfnGetData;
+    pDdiTable->pfnGetData                                = tracing_layer::zetMetricQueryGetData;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's MetricQueryPool table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetMetricQueryPoolProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_metric_query_pool_dditable_t* pDdiTable     ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.MetricQueryPool;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnCreate                                   = pDdiTable->pfnCreate;
+    pDdiTable->pfnCreate                                 = tracing_layer::zetMetricQueryPoolCreate;
+
+    dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+    pDdiTable->pfnDestroy                                = tracing_layer::zetMetricQueryPoolDestroy;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's MetricStreamer table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetMetricStreamerProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_metric_streamer_dditable_t* pDdiTable       ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.MetricStreamer;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnOpen                                     = pDdiTable->pfnOpen;
+    pDdiTable->pfnOpen                                   = tracing_layer::zetMetricStreamerOpen;
+
+    dditable.pfnClose                                    = pDdiTable->pfnClose;
+    pDdiTable->pfnClose                                  = tracing_layer::zetMetricStreamerClose;
+
+    dditable.pfnReadData                                 = pDdiTable->pfnReadData;
+    pDdiTable->pfnReadData                               = tracing_layer::zetMetricStreamerReadData;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's TracerExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetTracerExpProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_tracer_exp_dditable_t* pDdiTable            ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = tracing_layer::context.zetDdiTable.TracerExp;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(tracing_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(tracing_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    dditable.pfnCreate                                   = pDdiTable->pfnCreate;
+    pDdiTable->pfnCreate                                 = tracing_layer::zetTracerExpCreate;
+
+    dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+    pDdiTable->pfnDestroy                                = tracing_layer::zetTracerExpDestroy;
+
+    dditable.pfnSetPrologues                             = pDdiTable->pfnSetPrologues;
+    pDdiTable->pfnSetPrologues                           = tracing_layer::zetTracerExpSetPrologues;
+
+    dditable.pfnSetEpilogues                             = pDdiTable->pfnSetEpilogues;
+    pDdiTable->pfnSetEpilogues                           = tracing_layer::zetTracerExpSetEpilogues;
+
+    dditable.pfnSetEnabled                               = pDdiTable->pfnSetEnabled;
+    pDdiTable->pfnSetEnabled                             = tracing_layer::zetTracerExpSetEnabled;
+
+    return result;
+}
+
+#if defined(__cplusplus)
+};
+#endif
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
+#include "ze_cache_line.h"
+
+namespace validation_layer {
+
+// Address range of a live allocation.
+struct zel_allocation_t {
+  uintptr_t base;
+  size_t size;
+};
+
+//
+// Live USM allocations by address range.  The address space is cut into
+// regions, and each allocation is kept in an ordered map of the shard of
+// every region it overlaps, so that the allocation containing an address is
+// the one in the shard of the address's region starting closest below it:
+// live allocations never overlap, so no other allocation can start between
+// the two.  Lookups are O(log n) in the allocations of a shard and take its
+// lock shared; only allocating and freeing take shards exclusively.
+//
+class AllocationIndex {
+public:
+  void insert(const void *ptr, size_t size) {
+    uintptr_t base = reinterpret_cast<uintptr_t>(ptr);
+    if (base == 0) {
+      return;
+    }
+    forEachShard(base, size, [&](Shard &shard) {
+      std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+      shard.allocations[base] = size;
+    });
+  }
+
+  void erase(const void *ptr) {
+    zel_allocation_t allocation;
+    if (!find(ptr, allocation) ||
+        allocation.base != reinterpret_cast<uintptr_t>(ptr)) {
+      return;
+    }
+    forEachShard(allocation.base, allocation.size, [&](Shard &shard) {
+      std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+      shard.allocations.erase(allocation.base);
+    });
+  }
+
+  // Find the live allocation containing the address.
+  bool find(const void *ptr, zel_allocation_t &allocation) {
+    uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+    Shard &shard = shards[(address >> regionShift) & (shardCount - 1)];
+    std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+    auto next = shard.allocations.upper_bound(address);
+    if (next == shard.allocations.begin()) {
+      return false;
+    }
+    auto it = std::prev(next);
+    if (address - it->first >= it->second) {
+      return false;
+    }
+    allocation = {it->first, it->second};
+    return true;
+  }
+
+private:
+  static constexpr uint32_t shardCount = 16;
+  // 2MB regions, so that small allocations spread over the shards
+  static constexpr uint32_t regionShift = 21;
+
+  struct Shard {
+    std::shared_timed_mutex mutex;
+    std::map<uintptr_t, size_t> allocations;
+  };
+
+  // Visit the shard of every region the range overlaps, each once.
+  template <typename F> void forEachShard(uintptr_t base, size_t size, F f) {
+    uintptr_t first = base >> regionShift;
+    uintptr_t last = (base + std::max<size_t>(size, 1) - 1) >> regionShift;
+    uintptr_t count = std::min<uintptr_t>(last - first + 1, shardCount);
+    for (uintptr_t region = first; region < first + count; region++) {
+      f(shards[region & (shardCount - 1)]);
+    }
+  }
+
+  cache_line_t<Shard> shards[shardCount];
+};
+
+} // namespace validation_layer
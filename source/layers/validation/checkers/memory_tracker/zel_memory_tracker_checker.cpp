@@ -0,0 +1,381 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zel_memory_tracker_checker.cpp
+ *
+ */
+#include "zel_memory_tracker_checker.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace validation_layer
+{
+    class memoryTrackerChecker memoryChecker;
+
+    memoryTrackerChecker::memoryTrackerChecker() {
+        enableMemoryTracker = getenv_tobool( "ZE_ENABLE_MEMORY_TRACKER" );
+        if(enableMemoryTracker) {
+            memoryTrackerChecker::ZEmemoryTrackerChecker *zeChecker = new memoryTrackerChecker::ZEmemoryTrackerChecker;
+            memoryChecker.zeValidation = zeChecker;
+            memoryChecker.zetValidation = new ZETValidationEntryPoints;
+            memoryChecker.zesValidation = new ZESValidationEntryPoints;
+            memoryChecker.zeEntryPoints = getZEOverriddenEntryPoints<memoryTrackerChecker::ZEmemoryTrackerChecker>();
+            memoryChecker.zetEntryPoints = getZETOverriddenEntryPoints<ZETValidationEntryPoints>();
+            memoryChecker.zesEntryPoints = getZESOverriddenEntryPoints<ZESValidationEntryPoints>();
+            validation_layer::context.getInstance().addValidationChecker(&memoryChecker);
+        }
+    }
+
+    memoryTrackerChecker::~memoryTrackerChecker() {
+        if(enableMemoryTracker) {
+            delete memoryChecker.zeValidation;
+            delete memoryChecker.zetValidation;
+            delete memoryChecker.zesValidation;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Check that the bytes [begin, end) from ptr, if ptr is inside a
+    ///        live allocation, stay inside it.
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::checkRange(
+        const char* api,
+        const char* name,
+        const void* ptr,
+        size_t begin,
+        size_t end
+        )
+    {
+        if( nullptr == ptr || begin >= end )
+            return ZE_RESULT_SUCCESS;
+
+        zel_allocation_t allocation;
+        uintptr_t first = reinterpret_cast<uintptr_t>( ptr ) + begin;
+        if( !allocations.find( reinterpret_cast<const void*>( first ), allocation ) )
+            return ZE_RESULT_SUCCESS;
+        if( end - begin <= allocation.base + allocation.size - first )
+            return ZE_RESULT_SUCCESS;
+
+        std::ostringstream message;
+        message << api << ": " << name << " range [" << reinterpret_cast<const void*>( first )
+                << ", " << reinterpret_cast<const void*>( first + ( end - begin ) )
+                << ") overruns the allocation [" << reinterpret_cast<const void*>( allocation.base )
+                << ", " << reinterpret_cast<const void*>( allocation.base + allocation.size ) << ")";
+        context.log( message.str() );
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Check that the allocations the pointer arguments of a kernel
+    ///        pointed into when set have not been freed since.
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::checkKernelArguments(
+        const char* api,
+        ze_kernel_handle_t hKernel
+        )
+    {
+        auto& shard = getKernelShard( hKernel );
+        if( 0 == shard.count.load( std::memory_order_acquire ) )
+            return ZE_RESULT_SUCCESS;
+
+        std::shared_lock<std::shared_timed_mutex> lock( shard.mutex );
+        auto it = shard.kernels.find( hKernel );
+        if( it == shard.kernels.end() )
+            return ZE_RESULT_SUCCESS;
+
+        for( auto& argument : it->second )
+        {
+            zel_allocation_t allocation;
+            if( allocations.find( argument.second, allocation ) )
+                continue;
+
+            std::ostringstream message;
+            message << api << ": argument " << argument.first << " of kernel " << hKernel
+                    << " points to " << argument.second << ", which has been freed";
+            context.log( message.str() );
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeMemAllocSharedEpilogue(
+        ze_context_handle_t hContext,
+        const ze_device_mem_alloc_desc_t* device_desc,
+        const ze_host_mem_alloc_desc_t* host_desc,
+        size_t size,
+        size_t alignment,
+        ze_device_handle_t hDevice,
+        void** pptr,
+        ze_result_t result
+        )
+    {
+        if( ZE_RESULT_SUCCESS == result && nullptr != pptr )
+            allocations.insert( *pptr, size );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeMemAllocDeviceEpilogue(
+        ze_context_handle_t hContext,
+        const ze_device_mem_alloc_desc_t* device_desc,
+        size_t size,
+        size_t alignment,
+        ze_device_handle_t hDevice,
+        void** pptr,
+        ze_result_t result
+        )
+    {
+        if( ZE_RESULT_SUCCESS == result && nullptr != pptr )
+            allocations.insert( *pptr, size );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeMemAllocHostEpilogue(
+        ze_context_handle_t hContext,
+        const ze_host_mem_alloc_desc_t* host_desc,
+        size_t size,
+        size_t alignment,
+        void** pptr,
+        ze_result_t result
+        )
+    {
+        if( ZE_RESULT_SUCCESS == result && nullptr != pptr )
+            allocations.insert( *pptr, size );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    // Allocations are forgotten before they are freed, so that the driver
+    // cannot hand the same address to another thread while it is still indexed.
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeMemFreePrologue(
+        ze_context_handle_t hContext,
+        void* ptr
+        )
+    {
+        allocations.erase( ptr );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeMemFreeExtPrologue(
+        ze_context_handle_t hContext,
+        const ze_memory_free_ext_desc_t* pMemFreeDesc,
+        void* ptr
+        )
+    {
+        allocations.erase( ptr );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeCommandListAppendMemoryCopyPrologue(
+        ze_command_list_handle_t hCommandList,
+        void* dstptr,
+        const void* srcptr,
+        size_t size,
+        ze_event_handle_t hSignalEvent,
+        uint32_t numWaitEvents,
+        ze_event_handle_t* phWaitEvents
+        )
+    {
+        auto result = checkRange( "zeCommandListAppendMemoryCopy", "destination", dstptr, 0, size );
+        if( result != ZE_RESULT_SUCCESS )
+            return result;
+        return checkRange( "zeCommandListAppendMemoryCopy", "source", srcptr, 0, size );
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeCommandListAppendMemoryFillPrologue(
+        ze_command_list_handle_t hCommandList,
+        void* ptr,
+        const void* pattern,
+        size_t pattern_size,
+        size_t size,
+        ze_event_handle_t hSignalEvent,
+        uint32_t numWaitEvents,
+        ze_event_handle_t* phWaitEvents
+        )
+    {
+        auto result = checkRange( "zeCommandListAppendMemoryFill", "destination", ptr, 0, size );
+        if( result != ZE_RESULT_SUCCESS )
+            return result;
+        return checkRange( "zeCommandListAppendMemoryFill", "pattern", pattern, 0, pattern_size );
+    }
+
+    // Offsets of the first byte and one past the last byte of a copy region.
+    static std::pair<size_t, size_t> getRegionRange(
+        const ze_copy_region_t* region,
+        uint32_t pitch,
+        uint32_t slicePitch
+        )
+    {
+        if( nullptr == region || 0 == region->width || 0 == region->height || 0 == region->depth )
+            return { 0, 0 };
+        size_t begin = size_t( region->originZ ) * slicePitch + size_t( region->originY ) * pitch + region->originX;
+        size_t end = size_t( region->originZ + region->depth - 1 ) * slicePitch +
+            size_t( region->originY + region->height - 1 ) * pitch + region->originX + region->width;
+        return { begin, end };
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeCommandListAppendMemoryCopyRegionPrologue(
+        ze_command_list_handle_t hCommandList,
+        void* dstptr,
+        const ze_copy_region_t* dstRegion,
+        uint32_t dstPitch,
+        uint32_t dstSlicePitch,
+        const void* srcptr,
+        const ze_copy_region_t* srcRegion,
+        uint32_t srcPitch,
+        uint32_t srcSlicePitch,
+        ze_event_handle_t hSignalEvent,
+        uint32_t numWaitEvents,
+        ze_event_handle_t* phWaitEvents
+        )
+    {
+        auto dst = getRegionRange( dstRegion, dstPitch, dstSlicePitch );
+        auto result = checkRange( "zeCommandListAppendMemoryCopyRegion", "destination", dstptr, dst.first, dst.second );
+        if( result != ZE_RESULT_SUCCESS )
+            return result;
+        auto src = getRegionRange( srcRegion, srcPitch, srcSlicePitch );
+        return checkRange( "zeCommandListAppendMemoryCopyRegion", "source", srcptr, src.first, src.second );
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeKernelDestroyPrologue(
+        ze_kernel_handle_t hKernel
+        )
+    {
+        auto& shard = getKernelShard( hKernel );
+        if( 0 == shard.count.load( std::memory_order_acquire ) )
+            return ZE_RESULT_SUCCESS;
+
+        std::lock_guard<std::shared_timed_mutex> lock( shard.mutex );
+        if( shard.kernels.erase( hKernel ) )
+            shard.count.fetch_sub( 1, std::memory_order_release );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeKernelSetArgumentValueEpilogue(
+        ze_kernel_handle_t hKernel,
+        uint32_t argIndex,
+        size_t argSize,
+        const void* pArgValue,
+        ze_result_t result
+        )
+    {
+        // a failed call leaves the argument as it was
+        if( ZE_RESULT_SUCCESS != result )
+            return ZE_RESULT_SUCCESS;
+
+        // any argument the size of a pointer may be one
+        const void* value = nullptr;
+        zel_allocation_t allocation;
+        bool isPointer = sizeof( void* ) == argSize && nullptr != pArgValue &&
+            allocations.find( value = *static_cast<const void* const*>( pArgValue ), allocation );
+
+        // a kernel with no pointer arguments has nothing to forget
+        auto& shard = getKernelShard( hKernel );
+        if( !isPointer )
+        {
+            if( 0 == shard.count.load( std::memory_order_acquire ) )
+                return ZE_RESULT_SUCCESS;
+            std::shared_lock<std::shared_timed_mutex> lock( shard.mutex );
+            if( shard.kernels.end() == shard.kernels.find( hKernel ) )
+                return ZE_RESULT_SUCCESS;
+        }
+
+        std::lock_guard<std::shared_timed_mutex> lock( shard.mutex );
+        auto kernel = shard.kernels.find( hKernel );
+        if( kernel == shard.kernels.end() )
+        {
+            if( isPointer )
+            {
+                shard.kernels[ hKernel ].emplace_back( argIndex, value );
+                shard.count.fetch_add( 1, std::memory_order_release );
+            }
+            return ZE_RESULT_SUCCESS;
+        }
+
+        auto& arguments = kernel->second;
+        auto it = std::find_if( arguments.begin(), arguments.end(),
+            [argIndex]( const std::pair<uint32_t, const void*>& argument ) { return argument.first == argIndex; } );
+        if( it != arguments.end() )
+            arguments.erase( it );
+        if( isPointer )
+            arguments.emplace_back( argIndex, value );
+        if( arguments.empty() )
+        {
+            shard.kernels.erase( kernel );
+            shard.count.fetch_sub( 1, std::memory_order_release );
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeCommandListAppendLaunchKernelPrologue(
+        ze_command_list_handle_t hCommandList,
+        ze_kernel_handle_t hKernel,
+        const ze_group_count_t* pLaunchFuncArgs,
+        ze_event_handle_t hSignalEvent,
+        uint32_t numWaitEvents,
+        ze_event_handle_t* phWaitEvents
+        )
+    {
+        return checkKernelArguments( "zeCommandListAppendLaunchKernel", hKernel );
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeCommandListAppendLaunchCooperativeKernelPrologue(
+        ze_command_list_handle_t hCommandList,
+        ze_kernel_handle_t hKernel,
+        const ze_group_count_t* pLaunchFuncArgs,
+        ze_event_handle_t hSignalEvent,
+        uint32_t numWaitEvents,
+        ze_event_handle_t* phWaitEvents
+        )
+    {
+        return checkKernelArguments( "zeCommandListAppendLaunchCooperativeKernel", hKernel );
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeCommandListAppendLaunchKernelIndirectPrologue(
+        ze_command_list_handle_t hCommandList,
+        ze_kernel_handle_t hKernel,
+        const ze_group_count_t* pLaunchArgumentsBuffer,
+        ze_event_handle_t hSignalEvent,
+        uint32_t numWaitEvents,
+        ze_event_handle_t* phWaitEvents
+        )
+    {
+        return checkKernelArguments( "zeCommandListAppendLaunchKernelIndirect", hKernel );
+    }
+
+    ze_result_t
+    memoryTrackerChecker::ZEmemoryTrackerChecker::zeCommandListAppendLaunchMultipleKernelsIndirectPrologue(
+        ze_command_list_handle_t hCommandList,
+        uint32_t numKernels,
+        ze_kernel_handle_t* phKernels,
+        const uint32_t* pCountBuffer,
+        const ze_group_count_t* pLaunchArgumentsBuffer,
+        ze_event_handle_t hSignalEvent,
+        uint32_t numWaitEvents,
+        ze_event_handle_t* phWaitEvents
+        )
+    {
+        for( uint32_t i = 0; nullptr != phKernels && i < numKernels; i++ )
+        {
+            auto result = checkKernelArguments( "zeCommandListAppendLaunchMultipleKernelsIndirect", phKernels[ i ] );
+            if( result != ZE_RESULT_SUCCESS )
+                return result;
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+}
@@ -0,0 +1,72 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zel_memory_tracker_checker.h
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "ze_api.h"
+#include "ze_cache_line.h"
+#include "ze_validation_layer.h"
+#include "allocation_index.h"
+
+namespace validation_layer
+{
+    class __zedlllocal memoryTrackerChecker : public validationChecker{
+        public:
+            memoryTrackerChecker();
+            ~memoryTrackerChecker();
+
+            class ZEmemoryTrackerChecker : public ZEValidationEntryPoints, public cache_line_allocated_t {
+            public:
+                ze_result_t zeMemAllocSharedEpilogue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr, ze_result_t result ) override;
+                ze_result_t zeMemAllocDeviceEpilogue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr, ze_result_t result ) override;
+                ze_result_t zeMemAllocHostEpilogue( ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr, ze_result_t result ) override;
+                ze_result_t zeMemFreePrologue( ze_context_handle_t hContext, void* ptr ) override;
+                ze_result_t zeMemFreeExtPrologue( ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr ) override;
+                ze_result_t zeCommandListAppendMemoryCopyPrologue( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override;
+                ze_result_t zeCommandListAppendMemoryFillPrologue( ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override;
+                ze_result_t zeCommandListAppendMemoryCopyRegionPrologue( ze_command_list_handle_t hCommandList, void* dstptr, const ze_copy_region_t* dstRegion, uint32_t dstPitch, uint32_t dstSlicePitch, const void* srcptr, const ze_copy_region_t* srcRegion, uint32_t srcPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override;
+                ze_result_t zeKernelDestroyPrologue( ze_kernel_handle_t hKernel ) override;
+                ze_result_t zeKernelSetArgumentValueEpilogue( ze_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize, const void* pArgValue, ze_result_t result ) override;
+                ze_result_t zeCommandListAppendLaunchKernelPrologue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override;
+                ze_result_t zeCommandListAppendLaunchCooperativeKernelPrologue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override;
+                ze_result_t zeCommandListAppendLaunchKernelIndirectPrologue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override;
+                ze_result_t zeCommandListAppendLaunchMultipleKernelsIndirectPrologue( ze_command_list_handle_t hCommandList, uint32_t numKernels, ze_kernel_handle_t* phKernels, const uint32_t* pCountBuffer, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override;
+
+            private:
+                ze_result_t checkRange( const char* api, const char* name, const void* ptr, size_t begin, size_t end );
+                ze_result_t checkKernelArguments( const char* api, ze_kernel_handle_t hKernel );
+
+                // Arguments of the kernels of a shard pointing into a live
+                // allocation when set, and how many kernels have any.
+                struct KernelArgumentsShard {
+                    std::shared_timed_mutex mutex;
+                    std::unordered_map<ze_kernel_handle_t, std::vector<std::pair<uint32_t, const void*>>> kernels;
+                    std::atomic<size_t> count{0};
+                };
+                static constexpr uint32_t kernelShardBits = 4;
+                static constexpr uint32_t kernelShardCount = 1u << kernelShardBits;
+
+                KernelArgumentsShard &getKernelShard( ze_kernel_handle_t hKernel ) {
+                    return kernelShards[ hash_handle( reinterpret_cast<uintptr_t>( hKernel ) ) >> ( 64 - kernelShardBits ) ];
+                }
+
+                AllocationIndex allocations;
+                cache_line_t<KernelArgumentsShard> kernelShards[kernelShardCount];
+            };
+        bool enableMemoryTracker = false;
+    };
+    extern class memoryTrackerChecker memoryChecker;
+}
@@ -25,7 +25,10 @@ namespace validation_layer
             parameterChecker.zeValidation = zeChecker;
             parameterChecker.zetValidation = zetChecker;
             parameterChecker.zesValidation = zesChecker;
-            validation_layer::context.getInstance().validationHandlers.push_back(&parameterChecker);
+            parameterChecker.zeEntryPoints = getZEOverriddenEntryPoints<ZEParameterValidation>();
+            parameterChecker.zetEntryPoints = getZETOverriddenEntryPoints<ZETParameterValidation>();
+            parameterChecker.zesEntryPoints = getZESOverriddenEntryPoints<ZESParameterValidation>();
+            validation_layer::context.getInstance().addValidationChecker(&parameterChecker);
         }
     }
 
@@ -21,7 +21,10 @@ namespace validation_layer
             templateChecker.zeValidation = zeChecker;
             templateChecker.zetValidation = zetChecker;
             templateChecker.zesValidation = zesChecker;
-            validation_layer::context.getInstance().validationHandlers.push_back(&templateChecker);
+            templateChecker.zeEntryPoints = getZEOverriddenEntryPoints<validationCheckerTemplate::ZEvalidationCheckerTemplate>();
+            templateChecker.zetEntryPoints = getZETOverriddenEntryPoints<validationCheckerTemplate::ZETvalidationCheckerTemplate>();
+            templateChecker.zesEntryPoints = getZESOverriddenEntryPoints<validationCheckerTemplate::ZESvalidationCheckerTemplate>();
+            validation_layer::context.getInstance().addValidationChecker(&templateChecker);
         }
     }
 
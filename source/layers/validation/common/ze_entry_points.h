@@ -11,6 +11,9 @@
  */
 #pragma once
 #include "ze_api.h"
+#include <bitset>
+#include <cstdint>
+#include <type_traits>
 
 namespace validation_layer
 {
@@ -18,379 +21,1142 @@ namespace validation_layer
 class ZEValidationEntryPoints {
 public:
     virtual ze_result_t zeInitPrologue( ze_init_flags_t flags ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeInitEpilogue( ze_init_flags_t flags ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeInitEpilogue( ze_init_flags_t flags, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDriverGetPrologue( uint32_t* pCount, ze_driver_handle_t* phDrivers ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDriverGetEpilogue( uint32_t* pCount, ze_driver_handle_t* phDrivers ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDriverGetEpilogue( uint32_t* pCount, ze_driver_handle_t* phDrivers, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeInitDriversPrologue( uint32_t* pCount, ze_driver_handle_t* phDrivers, ze_init_driver_type_desc_t* desc ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeInitDriversEpilogue( uint32_t* pCount, ze_driver_handle_t* phDrivers, ze_init_driver_type_desc_t* desc ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeInitDriversEpilogue( uint32_t* pCount, ze_driver_handle_t* phDrivers, ze_init_driver_type_desc_t* desc, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDriverGetApiVersionPrologue( ze_driver_handle_t hDriver, ze_api_version_t* version ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDriverGetApiVersionEpilogue( ze_driver_handle_t hDriver, ze_api_version_t* version ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDriverGetApiVersionEpilogue( ze_driver_handle_t hDriver, ze_api_version_t* version, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDriverGetPropertiesPrologue( ze_driver_handle_t hDriver, ze_driver_properties_t* pDriverProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDriverGetPropertiesEpilogue( ze_driver_handle_t hDriver, ze_driver_properties_t* pDriverProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDriverGetPropertiesEpilogue( ze_driver_handle_t hDriver, ze_driver_properties_t* pDriverProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDriverGetIpcPropertiesPrologue( ze_driver_handle_t hDriver, ze_driver_ipc_properties_t* pIpcProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDriverGetIpcPropertiesEpilogue( ze_driver_handle_t hDriver, ze_driver_ipc_properties_t* pIpcProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDriverGetIpcPropertiesEpilogue( ze_driver_handle_t hDriver, ze_driver_ipc_properties_t* pIpcProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDriverGetExtensionPropertiesPrologue( ze_driver_handle_t hDriver, uint32_t* pCount, ze_driver_extension_properties_t* pExtensionProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDriverGetExtensionPropertiesEpilogue( ze_driver_handle_t hDriver, uint32_t* pCount, ze_driver_extension_properties_t* pExtensionProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDriverGetExtensionPropertiesEpilogue( ze_driver_handle_t hDriver, uint32_t* pCount, ze_driver_extension_properties_t* pExtensionProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDriverGetExtensionFunctionAddressPrologue( ze_driver_handle_t hDriver, const char* name, void** ppFunctionAddress ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDriverGetExtensionFunctionAddressEpilogue( ze_driver_handle_t hDriver, const char* name, void** ppFunctionAddress ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDriverGetExtensionFunctionAddressEpilogue( ze_driver_handle_t hDriver, const char* name, void** ppFunctionAddress, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDriverGetLastErrorDescriptionPrologue( ze_driver_handle_t hDriver, const char** ppString ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDriverGetLastErrorDescriptionEpilogue( ze_driver_handle_t hDriver, const char** ppString ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDriverGetLastErrorDescriptionEpilogue( ze_driver_handle_t hDriver, const char** ppString, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetPrologue( ze_driver_handle_t hDriver, uint32_t* pCount, ze_device_handle_t* phDevices ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetEpilogue( ze_driver_handle_t hDriver, uint32_t* pCount, ze_device_handle_t* phDevices ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetEpilogue( ze_driver_handle_t hDriver, uint32_t* pCount, ze_device_handle_t* phDevices, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetRootDevicePrologue( ze_device_handle_t hDevice, ze_device_handle_t* phRootDevice ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetRootDeviceEpilogue( ze_device_handle_t hDevice, ze_device_handle_t* phRootDevice ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetRootDeviceEpilogue( ze_device_handle_t hDevice, ze_device_handle_t* phRootDevice, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetSubDevicesPrologue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_handle_t* phSubdevices ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetSubDevicesEpilogue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_handle_t* phSubdevices ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetSubDevicesEpilogue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_handle_t* phSubdevices, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetPropertiesPrologue( ze_device_handle_t hDevice, ze_device_properties_t* pDeviceProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetPropertiesEpilogue( ze_device_handle_t hDevice, ze_device_properties_t* pDeviceProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetPropertiesEpilogue( ze_device_handle_t hDevice, ze_device_properties_t* pDeviceProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetComputePropertiesPrologue( ze_device_handle_t hDevice, ze_device_compute_properties_t* pComputeProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetComputePropertiesEpilogue( ze_device_handle_t hDevice, ze_device_compute_properties_t* pComputeProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetComputePropertiesEpilogue( ze_device_handle_t hDevice, ze_device_compute_properties_t* pComputeProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetModulePropertiesPrologue( ze_device_handle_t hDevice, ze_device_module_properties_t* pModuleProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetModulePropertiesEpilogue( ze_device_handle_t hDevice, ze_device_module_properties_t* pModuleProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetModulePropertiesEpilogue( ze_device_handle_t hDevice, ze_device_module_properties_t* pModuleProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetCommandQueueGroupPropertiesPrologue( ze_device_handle_t hDevice, uint32_t* pCount, ze_command_queue_group_properties_t* pCommandQueueGroupProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetCommandQueueGroupPropertiesEpilogue( ze_device_handle_t hDevice, uint32_t* pCount, ze_command_queue_group_properties_t* pCommandQueueGroupProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetCommandQueueGroupPropertiesEpilogue( ze_device_handle_t hDevice, uint32_t* pCount, ze_command_queue_group_properties_t* pCommandQueueGroupProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetMemoryPropertiesPrologue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_memory_properties_t* pMemProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetMemoryPropertiesEpilogue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_memory_properties_t* pMemProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetMemoryPropertiesEpilogue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_memory_properties_t* pMemProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetMemoryAccessPropertiesPrologue( ze_device_handle_t hDevice, ze_device_memory_access_properties_t* pMemAccessProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetMemoryAccessPropertiesEpilogue( ze_device_handle_t hDevice, ze_device_memory_access_properties_t* pMemAccessProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetMemoryAccessPropertiesEpilogue( ze_device_handle_t hDevice, ze_device_memory_access_properties_t* pMemAccessProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetCachePropertiesPrologue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_cache_properties_t* pCacheProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetCachePropertiesEpilogue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_cache_properties_t* pCacheProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetCachePropertiesEpilogue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_cache_properties_t* pCacheProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetImagePropertiesPrologue( ze_device_handle_t hDevice, ze_device_image_properties_t* pImageProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetImagePropertiesEpilogue( ze_device_handle_t hDevice, ze_device_image_properties_t* pImageProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetImagePropertiesEpilogue( ze_device_handle_t hDevice, ze_device_image_properties_t* pImageProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetExternalMemoryPropertiesPrologue( ze_device_handle_t hDevice, ze_device_external_memory_properties_t* pExternalMemoryProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetExternalMemoryPropertiesEpilogue( ze_device_handle_t hDevice, ze_device_external_memory_properties_t* pExternalMemoryProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetExternalMemoryPropertiesEpilogue( ze_device_handle_t hDevice, ze_device_external_memory_properties_t* pExternalMemoryProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetP2PPropertiesPrologue( ze_device_handle_t hDevice, ze_device_handle_t hPeerDevice, ze_device_p2p_properties_t* pP2PProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetP2PPropertiesEpilogue( ze_device_handle_t hDevice, ze_device_handle_t hPeerDevice, ze_device_p2p_properties_t* pP2PProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetP2PPropertiesEpilogue( ze_device_handle_t hDevice, ze_device_handle_t hPeerDevice, ze_device_p2p_properties_t* pP2PProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceCanAccessPeerPrologue( ze_device_handle_t hDevice, ze_device_handle_t hPeerDevice, ze_bool_t* value ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceCanAccessPeerEpilogue( ze_device_handle_t hDevice, ze_device_handle_t hPeerDevice, ze_bool_t* value ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceCanAccessPeerEpilogue( ze_device_handle_t hDevice, ze_device_handle_t hPeerDevice, ze_bool_t* value, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetStatusPrologue( ze_device_handle_t hDevice ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetStatusEpilogue( ze_device_handle_t hDevice ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetStatusEpilogue( ze_device_handle_t hDevice, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetGlobalTimestampsPrologue( ze_device_handle_t hDevice, uint64_t* hostTimestamp, uint64_t* deviceTimestamp ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetGlobalTimestampsEpilogue( ze_device_handle_t hDevice, uint64_t* hostTimestamp, uint64_t* deviceTimestamp ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetGlobalTimestampsEpilogue( ze_device_handle_t hDevice, uint64_t* hostTimestamp, uint64_t* deviceTimestamp, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeContextCreatePrologue( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, ze_context_handle_t* phContext ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeContextCreateEpilogue( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, ze_context_handle_t* phContext ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeContextCreateEpilogue( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, ze_context_handle_t* phContext, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeContextCreateExPrologue( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_context_handle_t* phContext ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeContextCreateExEpilogue( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_context_handle_t* phContext ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeContextCreateExEpilogue( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_context_handle_t* phContext, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeContextDestroyPrologue( ze_context_handle_t hContext ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeContextDestroyEpilogue( ze_context_handle_t hContext ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeContextDestroyEpilogue( ze_context_handle_t hContext, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeContextGetStatusPrologue( ze_context_handle_t hContext ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeContextGetStatusEpilogue( ze_context_handle_t hContext ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeContextGetStatusEpilogue( ze_context_handle_t hContext, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandQueueCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* desc, ze_command_queue_handle_t* phCommandQueue ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandQueueCreateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* desc, ze_command_queue_handle_t* phCommandQueue ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandQueueCreateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* desc, ze_command_queue_handle_t* phCommandQueue, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandQueueDestroyPrologue( ze_command_queue_handle_t hCommandQueue ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandQueueDestroyEpilogue( ze_command_queue_handle_t hCommandQueue ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandQueueDestroyEpilogue( ze_command_queue_handle_t hCommandQueue, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandQueueExecuteCommandListsPrologue( ze_command_queue_handle_t hCommandQueue, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_fence_handle_t hFence ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandQueueExecuteCommandListsEpilogue( ze_command_queue_handle_t hCommandQueue, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_fence_handle_t hFence ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandQueueExecuteCommandListsEpilogue( ze_command_queue_handle_t hCommandQueue, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_fence_handle_t hFence, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandQueueSynchronizePrologue( ze_command_queue_handle_t hCommandQueue, uint64_t timeout ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandQueueSynchronizeEpilogue( ze_command_queue_handle_t hCommandQueue, uint64_t timeout ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandQueueSynchronizeEpilogue( ze_command_queue_handle_t hCommandQueue, uint64_t timeout, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandQueueGetOrdinalPrologue( ze_command_queue_handle_t hCommandQueue, uint32_t* pOrdinal ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandQueueGetOrdinalEpilogue( ze_command_queue_handle_t hCommandQueue, uint32_t* pOrdinal ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandQueueGetOrdinalEpilogue( ze_command_queue_handle_t hCommandQueue, uint32_t* pOrdinal, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandQueueGetIndexPrologue( ze_command_queue_handle_t hCommandQueue, uint32_t* pIndex ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandQueueGetIndexEpilogue( ze_command_queue_handle_t hCommandQueue, uint32_t* pIndex ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandQueueGetIndexEpilogue( ze_command_queue_handle_t hCommandQueue, uint32_t* pIndex, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_list_desc_t* desc, ze_command_list_handle_t* phCommandList ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListCreateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_list_desc_t* desc, ze_command_list_handle_t* phCommandList ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListCreateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_list_desc_t* desc, ze_command_list_handle_t* phCommandList, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListCreateImmediatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* altdesc, ze_command_list_handle_t* phCommandList ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListCreateImmediateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* altdesc, ze_command_list_handle_t* phCommandList ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListCreateImmediateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* altdesc, ze_command_list_handle_t* phCommandList, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListDestroyPrologue( ze_command_list_handle_t hCommandList ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListDestroyEpilogue( ze_command_list_handle_t hCommandList ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListDestroyEpilogue( ze_command_list_handle_t hCommandList, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListClosePrologue( ze_command_list_handle_t hCommandList ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListCloseEpilogue( ze_command_list_handle_t hCommandList ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListCloseEpilogue( ze_command_list_handle_t hCommandList, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListResetPrologue( ze_command_list_handle_t hCommandList ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListResetEpilogue( ze_command_list_handle_t hCommandList ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListResetEpilogue( ze_command_list_handle_t hCommandList, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendWriteGlobalTimestampPrologue( ze_command_list_handle_t hCommandList, uint64_t* dstptr, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendWriteGlobalTimestampEpilogue( ze_command_list_handle_t hCommandList, uint64_t* dstptr, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendWriteGlobalTimestampEpilogue( ze_command_list_handle_t hCommandList, uint64_t* dstptr, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListHostSynchronizePrologue( ze_command_list_handle_t hCommandList, uint64_t timeout ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListHostSynchronizeEpilogue( ze_command_list_handle_t hCommandList, uint64_t timeout ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListHostSynchronizeEpilogue( ze_command_list_handle_t hCommandList, uint64_t timeout, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListGetDeviceHandlePrologue( ze_command_list_handle_t hCommandList, ze_device_handle_t* phDevice ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListGetDeviceHandleEpilogue( ze_command_list_handle_t hCommandList, ze_device_handle_t* phDevice ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListGetDeviceHandleEpilogue( ze_command_list_handle_t hCommandList, ze_device_handle_t* phDevice, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListGetContextHandlePrologue( ze_command_list_handle_t hCommandList, ze_context_handle_t* phContext ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListGetContextHandleEpilogue( ze_command_list_handle_t hCommandList, ze_context_handle_t* phContext ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListGetContextHandleEpilogue( ze_command_list_handle_t hCommandList, ze_context_handle_t* phContext, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListGetOrdinalPrologue( ze_command_list_handle_t hCommandList, uint32_t* pOrdinal ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListGetOrdinalEpilogue( ze_command_list_handle_t hCommandList, uint32_t* pOrdinal ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListGetOrdinalEpilogue( ze_command_list_handle_t hCommandList, uint32_t* pOrdinal, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListImmediateGetIndexPrologue( ze_command_list_handle_t hCommandListImmediate, uint32_t* pIndex ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListImmediateGetIndexEpilogue( ze_command_list_handle_t hCommandListImmediate, uint32_t* pIndex ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListImmediateGetIndexEpilogue( ze_command_list_handle_t hCommandListImmediate, uint32_t* pIndex, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListIsImmediatePrologue( ze_command_list_handle_t hCommandList, ze_bool_t* pIsImmediate ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListIsImmediateEpilogue( ze_command_list_handle_t hCommandList, ze_bool_t* pIsImmediate ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListIsImmediateEpilogue( ze_command_list_handle_t hCommandList, ze_bool_t* pIsImmediate, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendBarrierPrologue( ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendBarrierEpilogue( ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendBarrierEpilogue( ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendMemoryRangesBarrierPrologue( ze_command_list_handle_t hCommandList, uint32_t numRanges, const size_t* pRangeSizes, const void** pRanges, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendMemoryRangesBarrierEpilogue( ze_command_list_handle_t hCommandList, uint32_t numRanges, const size_t* pRangeSizes, const void** pRanges, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendMemoryRangesBarrierEpilogue( ze_command_list_handle_t hCommandList, uint32_t numRanges, const size_t* pRangeSizes, const void** pRanges, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeContextSystemBarrierPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeContextSystemBarrierEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeContextSystemBarrierEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendMemoryCopyPrologue( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendMemoryCopyEpilogue( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendMemoryCopyEpilogue( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendMemoryFillPrologue( ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendMemoryFillEpilogue( ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendMemoryFillEpilogue( ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendMemoryCopyRegionPrologue( ze_command_list_handle_t hCommandList, void* dstptr, const ze_copy_region_t* dstRegion, uint32_t dstPitch, uint32_t dstSlicePitch, const void* srcptr, const ze_copy_region_t* srcRegion, uint32_t srcPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendMemoryCopyRegionEpilogue( ze_command_list_handle_t hCommandList, void* dstptr, const ze_copy_region_t* dstRegion, uint32_t dstPitch, uint32_t dstSlicePitch, const void* srcptr, const ze_copy_region_t* srcRegion, uint32_t srcPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendMemoryCopyRegionEpilogue( ze_command_list_handle_t hCommandList, void* dstptr, const ze_copy_region_t* dstRegion, uint32_t dstPitch, uint32_t dstSlicePitch, const void* srcptr, const ze_copy_region_t* srcRegion, uint32_t srcPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendMemoryCopyFromContextPrologue( ze_command_list_handle_t hCommandList, void* dstptr, ze_context_handle_t hContextSrc, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendMemoryCopyFromContextEpilogue( ze_command_list_handle_t hCommandList, void* dstptr, ze_context_handle_t hContextSrc, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendMemoryCopyFromContextEpilogue( ze_command_list_handle_t hCommandList, void* dstptr, ze_context_handle_t hContextSrc, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendImageCopyPrologue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendImageCopyEpilogue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendImageCopyEpilogue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendImageCopyRegionPrologue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, const ze_image_region_t* pDstRegion, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendImageCopyRegionEpilogue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, const ze_image_region_t* pDstRegion, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendImageCopyRegionEpilogue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, const ze_image_region_t* pDstRegion, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendImageCopyToMemoryPrologue( ze_command_list_handle_t hCommandList, void* dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendImageCopyToMemoryEpilogue( ze_command_list_handle_t hCommandList, void* dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendImageCopyToMemoryEpilogue( ze_command_list_handle_t hCommandList, void* dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendImageCopyFromMemoryPrologue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void* srcptr, const ze_image_region_t* pDstRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendImageCopyFromMemoryEpilogue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void* srcptr, const ze_image_region_t* pDstRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendImageCopyFromMemoryEpilogue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void* srcptr, const ze_image_region_t* pDstRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendMemoryPrefetchPrologue( ze_command_list_handle_t hCommandList, const void* ptr, size_t size ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendMemoryPrefetchEpilogue( ze_command_list_handle_t hCommandList, const void* ptr, size_t size ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendMemoryPrefetchEpilogue( ze_command_list_handle_t hCommandList, const void* ptr, size_t size, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendMemAdvisePrologue( ze_command_list_handle_t hCommandList, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_advice_t advice ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendMemAdviseEpilogue( ze_command_list_handle_t hCommandList, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_advice_t advice ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendMemAdviseEpilogue( ze_command_list_handle_t hCommandList, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_advice_t advice, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventPoolCreatePrologue( ze_context_handle_t hContext, const ze_event_pool_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_event_pool_handle_t* phEventPool ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventPoolCreateEpilogue( ze_context_handle_t hContext, const ze_event_pool_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_event_pool_handle_t* phEventPool ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventPoolCreateEpilogue( ze_context_handle_t hContext, const ze_event_pool_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_event_pool_handle_t* phEventPool, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventPoolDestroyPrologue( ze_event_pool_handle_t hEventPool ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventPoolDestroyEpilogue( ze_event_pool_handle_t hEventPool ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventPoolDestroyEpilogue( ze_event_pool_handle_t hEventPool, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventCreatePrologue( ze_event_pool_handle_t hEventPool, const ze_event_desc_t* desc, ze_event_handle_t* phEvent ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventCreateEpilogue( ze_event_pool_handle_t hEventPool, const ze_event_desc_t* desc, ze_event_handle_t* phEvent ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventCreateEpilogue( ze_event_pool_handle_t hEventPool, const ze_event_desc_t* desc, ze_event_handle_t* phEvent, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventDestroyPrologue( ze_event_handle_t hEvent ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventDestroyEpilogue( ze_event_handle_t hEvent ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventDestroyEpilogue( ze_event_handle_t hEvent, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventPoolGetIpcHandlePrologue( ze_event_pool_handle_t hEventPool, ze_ipc_event_pool_handle_t* phIpc ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventPoolGetIpcHandleEpilogue( ze_event_pool_handle_t hEventPool, ze_ipc_event_pool_handle_t* phIpc ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventPoolGetIpcHandleEpilogue( ze_event_pool_handle_t hEventPool, ze_ipc_event_pool_handle_t* phIpc, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventPoolPutIpcHandlePrologue( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventPoolPutIpcHandleEpilogue( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventPoolPutIpcHandleEpilogue( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventPoolOpenIpcHandlePrologue( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc, ze_event_pool_handle_t* phEventPool ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventPoolOpenIpcHandleEpilogue( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc, ze_event_pool_handle_t* phEventPool ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventPoolOpenIpcHandleEpilogue( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc, ze_event_pool_handle_t* phEventPool, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventPoolCloseIpcHandlePrologue( ze_event_pool_handle_t hEventPool ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventPoolCloseIpcHandleEpilogue( ze_event_pool_handle_t hEventPool ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventPoolCloseIpcHandleEpilogue( ze_event_pool_handle_t hEventPool, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendSignalEventPrologue( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendSignalEventEpilogue( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendSignalEventEpilogue( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendWaitOnEventsPrologue( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendWaitOnEventsEpilogue( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendWaitOnEventsEpilogue( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventHostSignalPrologue( ze_event_handle_t hEvent ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventHostSignalEpilogue( ze_event_handle_t hEvent ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventHostSignalEpilogue( ze_event_handle_t hEvent, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventHostSynchronizePrologue( ze_event_handle_t hEvent, uint64_t timeout ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventHostSynchronizeEpilogue( ze_event_handle_t hEvent, uint64_t timeout ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventHostSynchronizeEpilogue( ze_event_handle_t hEvent, uint64_t timeout, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventQueryStatusPrologue( ze_event_handle_t hEvent ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventQueryStatusEpilogue( ze_event_handle_t hEvent ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventQueryStatusEpilogue( ze_event_handle_t hEvent, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendEventResetPrologue( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendEventResetEpilogue( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendEventResetEpilogue( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventHostResetPrologue( ze_event_handle_t hEvent ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventHostResetEpilogue( ze_event_handle_t hEvent ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventHostResetEpilogue( ze_event_handle_t hEvent, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventQueryKernelTimestampPrologue( ze_event_handle_t hEvent, ze_kernel_timestamp_result_t* dstptr ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventQueryKernelTimestampEpilogue( ze_event_handle_t hEvent, ze_kernel_timestamp_result_t* dstptr ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventQueryKernelTimestampEpilogue( ze_event_handle_t hEvent, ze_kernel_timestamp_result_t* dstptr, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendQueryKernelTimestampsPrologue( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents, void* dstptr, const size_t* pOffsets, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendQueryKernelTimestampsEpilogue( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents, void* dstptr, const size_t* pOffsets, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendQueryKernelTimestampsEpilogue( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents, void* dstptr, const size_t* pOffsets, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventGetEventPoolPrologue( ze_event_handle_t hEvent, ze_event_pool_handle_t* phEventPool ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventGetEventPoolEpilogue( ze_event_handle_t hEvent, ze_event_pool_handle_t* phEventPool ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventGetEventPoolEpilogue( ze_event_handle_t hEvent, ze_event_pool_handle_t* phEventPool, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventGetSignalScopePrologue( ze_event_handle_t hEvent, ze_event_scope_flags_t* pSignalScope ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventGetSignalScopeEpilogue( ze_event_handle_t hEvent, ze_event_scope_flags_t* pSignalScope ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventGetSignalScopeEpilogue( ze_event_handle_t hEvent, ze_event_scope_flags_t* pSignalScope, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventGetWaitScopePrologue( ze_event_handle_t hEvent, ze_event_scope_flags_t* pWaitScope ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventGetWaitScopeEpilogue( ze_event_handle_t hEvent, ze_event_scope_flags_t* pWaitScope ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventGetWaitScopeEpilogue( ze_event_handle_t hEvent, ze_event_scope_flags_t* pWaitScope, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventPoolGetContextHandlePrologue( ze_event_pool_handle_t hEventPool, ze_context_handle_t* phContext ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventPoolGetContextHandleEpilogue( ze_event_pool_handle_t hEventPool, ze_context_handle_t* phContext ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventPoolGetContextHandleEpilogue( ze_event_pool_handle_t hEventPool, ze_context_handle_t* phContext, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventPoolGetFlagsPrologue( ze_event_pool_handle_t hEventPool, ze_event_pool_flags_t* pFlags ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventPoolGetFlagsEpilogue( ze_event_pool_handle_t hEventPool, ze_event_pool_flags_t* pFlags ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventPoolGetFlagsEpilogue( ze_event_pool_handle_t hEventPool, ze_event_pool_flags_t* pFlags, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeFenceCreatePrologue( ze_command_queue_handle_t hCommandQueue, const ze_fence_desc_t* desc, ze_fence_handle_t* phFence ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeFenceCreateEpilogue( ze_command_queue_handle_t hCommandQueue, const ze_fence_desc_t* desc, ze_fence_handle_t* phFence ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeFenceCreateEpilogue( ze_command_queue_handle_t hCommandQueue, const ze_fence_desc_t* desc, ze_fence_handle_t* phFence, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeFenceDestroyPrologue( ze_fence_handle_t hFence ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeFenceDestroyEpilogue( ze_fence_handle_t hFence ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeFenceDestroyEpilogue( ze_fence_handle_t hFence, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeFenceHostSynchronizePrologue( ze_fence_handle_t hFence, uint64_t timeout ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeFenceHostSynchronizeEpilogue( ze_fence_handle_t hFence, uint64_t timeout ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeFenceHostSynchronizeEpilogue( ze_fence_handle_t hFence, uint64_t timeout, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeFenceQueryStatusPrologue( ze_fence_handle_t hFence ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeFenceQueryStatusEpilogue( ze_fence_handle_t hFence ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeFenceQueryStatusEpilogue( ze_fence_handle_t hFence, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeFenceResetPrologue( ze_fence_handle_t hFence ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeFenceResetEpilogue( ze_fence_handle_t hFence ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeFenceResetEpilogue( ze_fence_handle_t hFence, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeImageGetPropertiesPrologue( ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_properties_t* pImageProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeImageGetPropertiesEpilogue( ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_properties_t* pImageProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeImageGetPropertiesEpilogue( ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_properties_t* pImageProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeImageCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t* phImage ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeImageCreateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t* phImage ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeImageCreateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t* phImage, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeImageDestroyPrologue( ze_image_handle_t hImage ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeImageDestroyEpilogue( ze_image_handle_t hImage ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeImageDestroyEpilogue( ze_image_handle_t hImage, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemAllocSharedPrologue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemAllocSharedEpilogue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemAllocSharedEpilogue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemAllocDevicePrologue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemAllocDeviceEpilogue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemAllocDeviceEpilogue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemAllocHostPrologue( ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemAllocHostEpilogue( ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemAllocHostEpilogue( ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemFreePrologue( ze_context_handle_t hContext, void* ptr ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemFreeEpilogue( ze_context_handle_t hContext, void* ptr ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemFreeEpilogue( ze_context_handle_t hContext, void* ptr, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemGetAllocPropertiesPrologue( ze_context_handle_t hContext, const void* ptr, ze_memory_allocation_properties_t* pMemAllocProperties, ze_device_handle_t* phDevice ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemGetAllocPropertiesEpilogue( ze_context_handle_t hContext, const void* ptr, ze_memory_allocation_properties_t* pMemAllocProperties, ze_device_handle_t* phDevice ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemGetAllocPropertiesEpilogue( ze_context_handle_t hContext, const void* ptr, ze_memory_allocation_properties_t* pMemAllocProperties, ze_device_handle_t* phDevice, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemGetAddressRangePrologue( ze_context_handle_t hContext, const void* ptr, void** pBase, size_t* pSize ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemGetAddressRangeEpilogue( ze_context_handle_t hContext, const void* ptr, void** pBase, size_t* pSize ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemGetAddressRangeEpilogue( ze_context_handle_t hContext, const void* ptr, void** pBase, size_t* pSize, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemGetIpcHandlePrologue( ze_context_handle_t hContext, const void* ptr, ze_ipc_mem_handle_t* pIpcHandle ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemGetIpcHandleEpilogue( ze_context_handle_t hContext, const void* ptr, ze_ipc_mem_handle_t* pIpcHandle ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemGetIpcHandleEpilogue( ze_context_handle_t hContext, const void* ptr, ze_ipc_mem_handle_t* pIpcHandle, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemGetIpcHandleFromFileDescriptorExpPrologue( ze_context_handle_t hContext, uint64_t handle, ze_ipc_mem_handle_t* pIpcHandle ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemGetIpcHandleFromFileDescriptorExpEpilogue( ze_context_handle_t hContext, uint64_t handle, ze_ipc_mem_handle_t* pIpcHandle ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemGetIpcHandleFromFileDescriptorExpEpilogue( ze_context_handle_t hContext, uint64_t handle, ze_ipc_mem_handle_t* pIpcHandle, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemGetFileDescriptorFromIpcHandleExpPrologue( ze_context_handle_t hContext, ze_ipc_mem_handle_t ipcHandle, uint64_t* pHandle ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemGetFileDescriptorFromIpcHandleExpEpilogue( ze_context_handle_t hContext, ze_ipc_mem_handle_t ipcHandle, uint64_t* pHandle ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemGetFileDescriptorFromIpcHandleExpEpilogue( ze_context_handle_t hContext, ze_ipc_mem_handle_t ipcHandle, uint64_t* pHandle, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemPutIpcHandlePrologue( ze_context_handle_t hContext, ze_ipc_mem_handle_t handle ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemPutIpcHandleEpilogue( ze_context_handle_t hContext, ze_ipc_mem_handle_t handle ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemPutIpcHandleEpilogue( ze_context_handle_t hContext, ze_ipc_mem_handle_t handle, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemOpenIpcHandlePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_ipc_mem_handle_t handle, ze_ipc_memory_flags_t flags, void** pptr ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemOpenIpcHandleEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_ipc_mem_handle_t handle, ze_ipc_memory_flags_t flags, void** pptr ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemOpenIpcHandleEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_ipc_mem_handle_t handle, ze_ipc_memory_flags_t flags, void** pptr, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemCloseIpcHandlePrologue( ze_context_handle_t hContext, const void* ptr ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemCloseIpcHandleEpilogue( ze_context_handle_t hContext, const void* ptr ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemCloseIpcHandleEpilogue( ze_context_handle_t hContext, const void* ptr, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemSetAtomicAccessAttributeExpPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_atomic_attr_exp_flags_t attr ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemSetAtomicAccessAttributeExpEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_atomic_attr_exp_flags_t attr ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemSetAtomicAccessAttributeExpEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_atomic_attr_exp_flags_t attr, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemGetAtomicAccessAttributeExpPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_atomic_attr_exp_flags_t* pAttr ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemGetAtomicAccessAttributeExpEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_atomic_attr_exp_flags_t* pAttr ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemGetAtomicAccessAttributeExpEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_atomic_attr_exp_flags_t* pAttr, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeModuleCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t* desc, ze_module_handle_t* phModule, ze_module_build_log_handle_t* phBuildLog ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeModuleCreateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t* desc, ze_module_handle_t* phModule, ze_module_build_log_handle_t* phBuildLog ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeModuleCreateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t* desc, ze_module_handle_t* phModule, ze_module_build_log_handle_t* phBuildLog, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeModuleDestroyPrologue( ze_module_handle_t hModule ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeModuleDestroyEpilogue( ze_module_handle_t hModule ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeModuleDestroyEpilogue( ze_module_handle_t hModule, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeModuleDynamicLinkPrologue( uint32_t numModules, ze_module_handle_t* phModules, ze_module_build_log_handle_t* phLinkLog ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeModuleDynamicLinkEpilogue( uint32_t numModules, ze_module_handle_t* phModules, ze_module_build_log_handle_t* phLinkLog ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeModuleDynamicLinkEpilogue( uint32_t numModules, ze_module_handle_t* phModules, ze_module_build_log_handle_t* phLinkLog, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeModuleBuildLogDestroyPrologue( ze_module_build_log_handle_t hModuleBuildLog ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeModuleBuildLogDestroyEpilogue( ze_module_build_log_handle_t hModuleBuildLog ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeModuleBuildLogDestroyEpilogue( ze_module_build_log_handle_t hModuleBuildLog, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeModuleBuildLogGetStringPrologue( ze_module_build_log_handle_t hModuleBuildLog, size_t* pSize, char* pBuildLog ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeModuleBuildLogGetStringEpilogue( ze_module_build_log_handle_t hModuleBuildLog, size_t* pSize, char* pBuildLog ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeModuleBuildLogGetStringEpilogue( ze_module_build_log_handle_t hModuleBuildLog, size_t* pSize, char* pBuildLog, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeModuleGetNativeBinaryPrologue( ze_module_handle_t hModule, size_t* pSize, uint8_t* pModuleNativeBinary ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeModuleGetNativeBinaryEpilogue( ze_module_handle_t hModule, size_t* pSize, uint8_t* pModuleNativeBinary ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeModuleGetNativeBinaryEpilogue( ze_module_handle_t hModule, size_t* pSize, uint8_t* pModuleNativeBinary, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeModuleGetGlobalPointerPrologue( ze_module_handle_t hModule, const char* pGlobalName, size_t* pSize, void** pptr ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeModuleGetGlobalPointerEpilogue( ze_module_handle_t hModule, const char* pGlobalName, size_t* pSize, void** pptr ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeModuleGetGlobalPointerEpilogue( ze_module_handle_t hModule, const char* pGlobalName, size_t* pSize, void** pptr, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeModuleGetKernelNamesPrologue( ze_module_handle_t hModule, uint32_t* pCount, const char** pNames ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeModuleGetKernelNamesEpilogue( ze_module_handle_t hModule, uint32_t* pCount, const char** pNames ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeModuleGetKernelNamesEpilogue( ze_module_handle_t hModule, uint32_t* pCount, const char** pNames, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeModuleGetPropertiesPrologue( ze_module_handle_t hModule, ze_module_properties_t* pModuleProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeModuleGetPropertiesEpilogue( ze_module_handle_t hModule, ze_module_properties_t* pModuleProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeModuleGetPropertiesEpilogue( ze_module_handle_t hModule, ze_module_properties_t* pModuleProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelCreatePrologue( ze_module_handle_t hModule, const ze_kernel_desc_t* desc, ze_kernel_handle_t* phKernel ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelCreateEpilogue( ze_module_handle_t hModule, const ze_kernel_desc_t* desc, ze_kernel_handle_t* phKernel ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelCreateEpilogue( ze_module_handle_t hModule, const ze_kernel_desc_t* desc, ze_kernel_handle_t* phKernel, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelDestroyPrologue( ze_kernel_handle_t hKernel ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelDestroyEpilogue( ze_kernel_handle_t hKernel ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelDestroyEpilogue( ze_kernel_handle_t hKernel, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeModuleGetFunctionPointerPrologue( ze_module_handle_t hModule, const char* pFunctionName, void** pfnFunction ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeModuleGetFunctionPointerEpilogue( ze_module_handle_t hModule, const char* pFunctionName, void** pfnFunction ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeModuleGetFunctionPointerEpilogue( ze_module_handle_t hModule, const char* pFunctionName, void** pfnFunction, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelSetGroupSizePrologue( ze_kernel_handle_t hKernel, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelSetGroupSizeEpilogue( ze_kernel_handle_t hKernel, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelSetGroupSizeEpilogue( ze_kernel_handle_t hKernel, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelSuggestGroupSizePrologue( ze_kernel_handle_t hKernel, uint32_t globalSizeX, uint32_t globalSizeY, uint32_t globalSizeZ, uint32_t* groupSizeX, uint32_t* groupSizeY, uint32_t* groupSizeZ ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelSuggestGroupSizeEpilogue( ze_kernel_handle_t hKernel, uint32_t globalSizeX, uint32_t globalSizeY, uint32_t globalSizeZ, uint32_t* groupSizeX, uint32_t* groupSizeY, uint32_t* groupSizeZ ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelSuggestGroupSizeEpilogue( ze_kernel_handle_t hKernel, uint32_t globalSizeX, uint32_t globalSizeY, uint32_t globalSizeZ, uint32_t* groupSizeX, uint32_t* groupSizeY, uint32_t* groupSizeZ, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelSuggestMaxCooperativeGroupCountPrologue( ze_kernel_handle_t hKernel, uint32_t* totalGroupCount ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelSuggestMaxCooperativeGroupCountEpilogue( ze_kernel_handle_t hKernel, uint32_t* totalGroupCount ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelSuggestMaxCooperativeGroupCountEpilogue( ze_kernel_handle_t hKernel, uint32_t* totalGroupCount, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelSetArgumentValuePrologue( ze_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize, const void* pArgValue ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelSetArgumentValueEpilogue( ze_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize, const void* pArgValue ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelSetArgumentValueEpilogue( ze_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize, const void* pArgValue, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelSetIndirectAccessPrologue( ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t flags ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelSetIndirectAccessEpilogue( ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t flags ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelSetIndirectAccessEpilogue( ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t flags, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelGetIndirectAccessPrologue( ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t* pFlags ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelGetIndirectAccessEpilogue( ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t* pFlags ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelGetIndirectAccessEpilogue( ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t* pFlags, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelGetSourceAttributesPrologue( ze_kernel_handle_t hKernel, uint32_t* pSize, char** pString ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelGetSourceAttributesEpilogue( ze_kernel_handle_t hKernel, uint32_t* pSize, char** pString ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelGetSourceAttributesEpilogue( ze_kernel_handle_t hKernel, uint32_t* pSize, char** pString, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelSetCacheConfigPrologue( ze_kernel_handle_t hKernel, ze_cache_config_flags_t flags ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelSetCacheConfigEpilogue( ze_kernel_handle_t hKernel, ze_cache_config_flags_t flags ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelSetCacheConfigEpilogue( ze_kernel_handle_t hKernel, ze_cache_config_flags_t flags, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelGetPropertiesPrologue( ze_kernel_handle_t hKernel, ze_kernel_properties_t* pKernelProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelGetPropertiesEpilogue( ze_kernel_handle_t hKernel, ze_kernel_properties_t* pKernelProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelGetPropertiesEpilogue( ze_kernel_handle_t hKernel, ze_kernel_properties_t* pKernelProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelGetNamePrologue( ze_kernel_handle_t hKernel, size_t* pSize, char* pName ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelGetNameEpilogue( ze_kernel_handle_t hKernel, size_t* pSize, char* pName ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelGetNameEpilogue( ze_kernel_handle_t hKernel, size_t* pSize, char* pName, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendLaunchKernelPrologue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendLaunchKernelEpilogue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendLaunchKernelEpilogue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendLaunchCooperativeKernelPrologue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendLaunchCooperativeKernelEpilogue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendLaunchCooperativeKernelEpilogue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendLaunchKernelIndirectPrologue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendLaunchKernelIndirectEpilogue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendLaunchKernelIndirectEpilogue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendLaunchMultipleKernelsIndirectPrologue( ze_command_list_handle_t hCommandList, uint32_t numKernels, ze_kernel_handle_t* phKernels, const uint32_t* pCountBuffer, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue( ze_command_list_handle_t hCommandList, uint32_t numKernels, ze_kernel_handle_t* phKernels, const uint32_t* pCountBuffer, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue( ze_command_list_handle_t hCommandList, uint32_t numKernels, ze_kernel_handle_t* phKernels, const uint32_t* pCountBuffer, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeContextMakeMemoryResidentPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, void* ptr, size_t size ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeContextMakeMemoryResidentEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, void* ptr, size_t size ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeContextMakeMemoryResidentEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, void* ptr, size_t size, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeContextEvictMemoryPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, void* ptr, size_t size ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeContextEvictMemoryEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, void* ptr, size_t size ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeContextEvictMemoryEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, void* ptr, size_t size, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeContextMakeImageResidentPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_image_handle_t hImage ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeContextMakeImageResidentEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_image_handle_t hImage ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeContextMakeImageResidentEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_image_handle_t hImage, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeContextEvictImagePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_image_handle_t hImage ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeContextEvictImageEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_image_handle_t hImage ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeContextEvictImageEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_image_handle_t hImage, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeSamplerCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_sampler_desc_t* desc, ze_sampler_handle_t* phSampler ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeSamplerCreateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_sampler_desc_t* desc, ze_sampler_handle_t* phSampler ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeSamplerCreateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_sampler_desc_t* desc, ze_sampler_handle_t* phSampler, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeSamplerDestroyPrologue( ze_sampler_handle_t hSampler ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeSamplerDestroyEpilogue( ze_sampler_handle_t hSampler ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeSamplerDestroyEpilogue( ze_sampler_handle_t hSampler, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeVirtualMemReservePrologue( ze_context_handle_t hContext, const void* pStart, size_t size, void** pptr ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeVirtualMemReserveEpilogue( ze_context_handle_t hContext, const void* pStart, size_t size, void** pptr ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeVirtualMemReserveEpilogue( ze_context_handle_t hContext, const void* pStart, size_t size, void** pptr, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeVirtualMemFreePrologue( ze_context_handle_t hContext, const void* ptr, size_t size ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeVirtualMemFreeEpilogue( ze_context_handle_t hContext, const void* ptr, size_t size ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeVirtualMemFreeEpilogue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeVirtualMemQueryPageSizePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, size_t size, size_t* pagesize ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeVirtualMemQueryPageSizeEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, size_t size, size_t* pagesize ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeVirtualMemQueryPageSizeEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, size_t size, size_t* pagesize, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zePhysicalMemCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_physical_mem_desc_t* desc, ze_physical_mem_handle_t* phPhysicalMemory ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zePhysicalMemCreateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_physical_mem_desc_t* desc, ze_physical_mem_handle_t* phPhysicalMemory ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zePhysicalMemCreateEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_physical_mem_desc_t* desc, ze_physical_mem_handle_t* phPhysicalMemory, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zePhysicalMemDestroyPrologue( ze_context_handle_t hContext, ze_physical_mem_handle_t hPhysicalMemory ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zePhysicalMemDestroyEpilogue( ze_context_handle_t hContext, ze_physical_mem_handle_t hPhysicalMemory ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zePhysicalMemDestroyEpilogue( ze_context_handle_t hContext, ze_physical_mem_handle_t hPhysicalMemory, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeVirtualMemMapPrologue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_physical_mem_handle_t hPhysicalMemory, size_t offset, ze_memory_access_attribute_t access ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeVirtualMemMapEpilogue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_physical_mem_handle_t hPhysicalMemory, size_t offset, ze_memory_access_attribute_t access ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeVirtualMemMapEpilogue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_physical_mem_handle_t hPhysicalMemory, size_t offset, ze_memory_access_attribute_t access, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeVirtualMemUnmapPrologue( ze_context_handle_t hContext, const void* ptr, size_t size ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeVirtualMemUnmapEpilogue( ze_context_handle_t hContext, const void* ptr, size_t size ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeVirtualMemUnmapEpilogue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeVirtualMemSetAccessAttributePrologue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_memory_access_attribute_t access ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeVirtualMemSetAccessAttributeEpilogue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_memory_access_attribute_t access ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeVirtualMemSetAccessAttributeEpilogue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_memory_access_attribute_t access, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeVirtualMemGetAccessAttributePrologue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_memory_access_attribute_t* access, size_t* outSize ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeVirtualMemGetAccessAttributeEpilogue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_memory_access_attribute_t* access, size_t* outSize ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeVirtualMemGetAccessAttributeEpilogue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_memory_access_attribute_t* access, size_t* outSize, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelSetGlobalOffsetExpPrologue( ze_kernel_handle_t hKernel, uint32_t offsetX, uint32_t offsetY, uint32_t offsetZ ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelSetGlobalOffsetExpEpilogue( ze_kernel_handle_t hKernel, uint32_t offsetX, uint32_t offsetY, uint32_t offsetZ ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelSetGlobalOffsetExpEpilogue( ze_kernel_handle_t hKernel, uint32_t offsetX, uint32_t offsetY, uint32_t offsetZ, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListGetNextCommandIdExpPrologue( ze_command_list_handle_t hCommandList, const ze_mutable_command_id_exp_desc_t* desc, uint64_t* pCommandId ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListGetNextCommandIdExpEpilogue( ze_command_list_handle_t hCommandList, const ze_mutable_command_id_exp_desc_t* desc, uint64_t* pCommandId ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListGetNextCommandIdExpEpilogue( ze_command_list_handle_t hCommandList, const ze_mutable_command_id_exp_desc_t* desc, uint64_t* pCommandId, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListGetNextCommandIdWithKernelsExpPrologue( ze_command_list_handle_t hCommandList, const ze_mutable_command_id_exp_desc_t* desc, uint32_t numKernels, ze_kernel_handle_t* phKernels, uint64_t* pCommandId ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListGetNextCommandIdWithKernelsExpEpilogue( ze_command_list_handle_t hCommandList, const ze_mutable_command_id_exp_desc_t* desc, uint32_t numKernels, ze_kernel_handle_t* phKernels, uint64_t* pCommandId ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListGetNextCommandIdWithKernelsExpEpilogue( ze_command_list_handle_t hCommandList, const ze_mutable_command_id_exp_desc_t* desc, uint32_t numKernels, ze_kernel_handle_t* phKernels, uint64_t* pCommandId, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListUpdateMutableCommandsExpPrologue( ze_command_list_handle_t hCommandList, const ze_mutable_commands_exp_desc_t* desc ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListUpdateMutableCommandsExpEpilogue( ze_command_list_handle_t hCommandList, const ze_mutable_commands_exp_desc_t* desc ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListUpdateMutableCommandsExpEpilogue( ze_command_list_handle_t hCommandList, const ze_mutable_commands_exp_desc_t* desc, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListUpdateMutableCommandSignalEventExpPrologue( ze_command_list_handle_t hCommandList, uint64_t commandId, ze_event_handle_t hSignalEvent ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListUpdateMutableCommandSignalEventExpEpilogue( ze_command_list_handle_t hCommandList, uint64_t commandId, ze_event_handle_t hSignalEvent ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListUpdateMutableCommandSignalEventExpEpilogue( ze_command_list_handle_t hCommandList, uint64_t commandId, ze_event_handle_t hSignalEvent, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListUpdateMutableCommandWaitEventsExpPrologue( ze_command_list_handle_t hCommandList, uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListUpdateMutableCommandWaitEventsExpEpilogue( ze_command_list_handle_t hCommandList, uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListUpdateMutableCommandWaitEventsExpEpilogue( ze_command_list_handle_t hCommandList, uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListUpdateMutableCommandKernelsExpPrologue( ze_command_list_handle_t hCommandList, uint32_t numKernels, uint64_t* pCommandId, ze_kernel_handle_t* phKernels ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListUpdateMutableCommandKernelsExpEpilogue( ze_command_list_handle_t hCommandList, uint32_t numKernels, uint64_t* pCommandId, ze_kernel_handle_t* phKernels ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListUpdateMutableCommandKernelsExpEpilogue( ze_command_list_handle_t hCommandList, uint32_t numKernels, uint64_t* pCommandId, ze_kernel_handle_t* phKernels, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceReserveCacheExtPrologue( ze_device_handle_t hDevice, size_t cacheLevel, size_t cacheReservationSize ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceReserveCacheExtEpilogue( ze_device_handle_t hDevice, size_t cacheLevel, size_t cacheReservationSize ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceReserveCacheExtEpilogue( ze_device_handle_t hDevice, size_t cacheLevel, size_t cacheReservationSize, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceSetCacheAdviceExtPrologue( ze_device_handle_t hDevice, void* ptr, size_t regionSize, ze_cache_ext_region_t cacheRegion ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceSetCacheAdviceExtEpilogue( ze_device_handle_t hDevice, void* ptr, size_t regionSize, ze_cache_ext_region_t cacheRegion ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceSetCacheAdviceExtEpilogue( ze_device_handle_t hDevice, void* ptr, size_t regionSize, ze_cache_ext_region_t cacheRegion, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventQueryTimestampsExpPrologue( ze_event_handle_t hEvent, ze_device_handle_t hDevice, uint32_t* pCount, ze_kernel_timestamp_result_t* pTimestamps ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventQueryTimestampsExpEpilogue( ze_event_handle_t hEvent, ze_device_handle_t hDevice, uint32_t* pCount, ze_kernel_timestamp_result_t* pTimestamps ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventQueryTimestampsExpEpilogue( ze_event_handle_t hEvent, ze_device_handle_t hDevice, uint32_t* pCount, ze_kernel_timestamp_result_t* pTimestamps, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeImageGetMemoryPropertiesExpPrologue( ze_image_handle_t hImage, ze_image_memory_properties_exp_t* pMemoryProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeImageGetMemoryPropertiesExpEpilogue( ze_image_handle_t hImage, ze_image_memory_properties_exp_t* pMemoryProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeImageGetMemoryPropertiesExpEpilogue( ze_image_handle_t hImage, ze_image_memory_properties_exp_t* pMemoryProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeImageViewCreateExtPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t hImage, ze_image_handle_t* phImageView ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeImageViewCreateExtEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t hImage, ze_image_handle_t* phImageView ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeImageViewCreateExtEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t hImage, ze_image_handle_t* phImageView, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeImageViewCreateExpPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t hImage, ze_image_handle_t* phImageView ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeImageViewCreateExpEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t hImage, ze_image_handle_t* phImageView ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeImageViewCreateExpEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t hImage, ze_image_handle_t* phImageView, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeKernelSchedulingHintExpPrologue( ze_kernel_handle_t hKernel, ze_scheduling_hint_exp_desc_t* pHint ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeKernelSchedulingHintExpEpilogue( ze_kernel_handle_t hKernel, ze_scheduling_hint_exp_desc_t* pHint ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeKernelSchedulingHintExpEpilogue( ze_kernel_handle_t hKernel, ze_scheduling_hint_exp_desc_t* pHint, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDevicePciGetPropertiesExtPrologue( ze_device_handle_t hDevice, ze_pci_ext_properties_t* pPciProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDevicePciGetPropertiesExtEpilogue( ze_device_handle_t hDevice, ze_pci_ext_properties_t* pPciProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDevicePciGetPropertiesExtEpilogue( ze_device_handle_t hDevice, ze_pci_ext_properties_t* pPciProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendImageCopyToMemoryExtPrologue( ze_command_list_handle_t hCommandList, void* dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t* pSrcRegion, uint32_t destRowPitch, uint32_t destSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendImageCopyToMemoryExtEpilogue( ze_command_list_handle_t hCommandList, void* dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t* pSrcRegion, uint32_t destRowPitch, uint32_t destSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendImageCopyToMemoryExtEpilogue( ze_command_list_handle_t hCommandList, void* dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t* pSrcRegion, uint32_t destRowPitch, uint32_t destSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListAppendImageCopyFromMemoryExtPrologue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void* srcptr, const ze_image_region_t* pDstRegion, uint32_t srcRowPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListAppendImageCopyFromMemoryExtEpilogue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void* srcptr, const ze_image_region_t* pDstRegion, uint32_t srcRowPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListAppendImageCopyFromMemoryExtEpilogue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void* srcptr, const ze_image_region_t* pDstRegion, uint32_t srcRowPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeImageGetAllocPropertiesExtPrologue( ze_context_handle_t hContext, ze_image_handle_t hImage, ze_image_allocation_ext_properties_t* pImageAllocProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeImageGetAllocPropertiesExtEpilogue( ze_context_handle_t hContext, ze_image_handle_t hImage, ze_image_allocation_ext_properties_t* pImageAllocProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeImageGetAllocPropertiesExtEpilogue( ze_context_handle_t hContext, ze_image_handle_t hImage, ze_image_allocation_ext_properties_t* pImageAllocProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeModuleInspectLinkageExtPrologue( ze_linkage_inspection_ext_desc_t* pInspectDesc, uint32_t numModules, ze_module_handle_t* phModules, ze_module_build_log_handle_t* phLog ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeModuleInspectLinkageExtEpilogue( ze_linkage_inspection_ext_desc_t* pInspectDesc, uint32_t numModules, ze_module_handle_t* phModules, ze_module_build_log_handle_t* phLog ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeModuleInspectLinkageExtEpilogue( ze_linkage_inspection_ext_desc_t* pInspectDesc, uint32_t numModules, ze_module_handle_t* phModules, ze_module_build_log_handle_t* phLog, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemFreeExtPrologue( ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemFreeExtEpilogue( ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemFreeExtEpilogue( ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeFabricVertexGetExpPrologue( ze_driver_handle_t hDriver, uint32_t* pCount, ze_fabric_vertex_handle_t* phVertices ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeFabricVertexGetExpEpilogue( ze_driver_handle_t hDriver, uint32_t* pCount, ze_fabric_vertex_handle_t* phVertices ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeFabricVertexGetExpEpilogue( ze_driver_handle_t hDriver, uint32_t* pCount, ze_fabric_vertex_handle_t* phVertices, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeFabricVertexGetSubVerticesExpPrologue( ze_fabric_vertex_handle_t hVertex, uint32_t* pCount, ze_fabric_vertex_handle_t* phSubvertices ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeFabricVertexGetSubVerticesExpEpilogue( ze_fabric_vertex_handle_t hVertex, uint32_t* pCount, ze_fabric_vertex_handle_t* phSubvertices ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeFabricVertexGetSubVerticesExpEpilogue( ze_fabric_vertex_handle_t hVertex, uint32_t* pCount, ze_fabric_vertex_handle_t* phSubvertices, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeFabricVertexGetPropertiesExpPrologue( ze_fabric_vertex_handle_t hVertex, ze_fabric_vertex_exp_properties_t* pVertexProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeFabricVertexGetPropertiesExpEpilogue( ze_fabric_vertex_handle_t hVertex, ze_fabric_vertex_exp_properties_t* pVertexProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeFabricVertexGetPropertiesExpEpilogue( ze_fabric_vertex_handle_t hVertex, ze_fabric_vertex_exp_properties_t* pVertexProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeFabricVertexGetDeviceExpPrologue( ze_fabric_vertex_handle_t hVertex, ze_device_handle_t* phDevice ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeFabricVertexGetDeviceExpEpilogue( ze_fabric_vertex_handle_t hVertex, ze_device_handle_t* phDevice ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeFabricVertexGetDeviceExpEpilogue( ze_fabric_vertex_handle_t hVertex, ze_device_handle_t* phDevice, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDeviceGetFabricVertexExpPrologue( ze_device_handle_t hDevice, ze_fabric_vertex_handle_t* phVertex ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDeviceGetFabricVertexExpEpilogue( ze_device_handle_t hDevice, ze_fabric_vertex_handle_t* phVertex ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDeviceGetFabricVertexExpEpilogue( ze_device_handle_t hDevice, ze_fabric_vertex_handle_t* phVertex, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeFabricEdgeGetExpPrologue( ze_fabric_vertex_handle_t hVertexA, ze_fabric_vertex_handle_t hVertexB, uint32_t* pCount, ze_fabric_edge_handle_t* phEdges ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeFabricEdgeGetExpEpilogue( ze_fabric_vertex_handle_t hVertexA, ze_fabric_vertex_handle_t hVertexB, uint32_t* pCount, ze_fabric_edge_handle_t* phEdges ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeFabricEdgeGetExpEpilogue( ze_fabric_vertex_handle_t hVertexA, ze_fabric_vertex_handle_t hVertexB, uint32_t* pCount, ze_fabric_edge_handle_t* phEdges, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeFabricEdgeGetVerticesExpPrologue( ze_fabric_edge_handle_t hEdge, ze_fabric_vertex_handle_t* phVertexA, ze_fabric_vertex_handle_t* phVertexB ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeFabricEdgeGetVerticesExpEpilogue( ze_fabric_edge_handle_t hEdge, ze_fabric_vertex_handle_t* phVertexA, ze_fabric_vertex_handle_t* phVertexB ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeFabricEdgeGetVerticesExpEpilogue( ze_fabric_edge_handle_t hEdge, ze_fabric_vertex_handle_t* phVertexA, ze_fabric_vertex_handle_t* phVertexB, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeFabricEdgeGetPropertiesExpPrologue( ze_fabric_edge_handle_t hEdge, ze_fabric_edge_exp_properties_t* pEdgeProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeFabricEdgeGetPropertiesExpEpilogue( ze_fabric_edge_handle_t hEdge, ze_fabric_edge_exp_properties_t* pEdgeProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeFabricEdgeGetPropertiesExpEpilogue( ze_fabric_edge_handle_t hEdge, ze_fabric_edge_exp_properties_t* pEdgeProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeEventQueryKernelTimestampsExtPrologue( ze_event_handle_t hEvent, ze_device_handle_t hDevice, uint32_t* pCount, ze_event_query_kernel_timestamps_results_ext_properties_t* pResults ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeEventQueryKernelTimestampsExtEpilogue( ze_event_handle_t hEvent, ze_device_handle_t hDevice, uint32_t* pCount, ze_event_query_kernel_timestamps_results_ext_properties_t* pResults ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeEventQueryKernelTimestampsExtEpilogue( ze_event_handle_t hEvent, ze_device_handle_t hDevice, uint32_t* pCount, ze_event_query_kernel_timestamps_results_ext_properties_t* pResults, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeRTASBuilderCreateExpPrologue( ze_driver_handle_t hDriver, const ze_rtas_builder_exp_desc_t* pDescriptor, ze_rtas_builder_exp_handle_t* phBuilder ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeRTASBuilderCreateExpEpilogue( ze_driver_handle_t hDriver, const ze_rtas_builder_exp_desc_t* pDescriptor, ze_rtas_builder_exp_handle_t* phBuilder ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeRTASBuilderCreateExpEpilogue( ze_driver_handle_t hDriver, const ze_rtas_builder_exp_desc_t* pDescriptor, ze_rtas_builder_exp_handle_t* phBuilder, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeRTASBuilderGetBuildPropertiesExpPrologue( ze_rtas_builder_exp_handle_t hBuilder, const ze_rtas_builder_build_op_exp_desc_t* pBuildOpDescriptor, ze_rtas_builder_exp_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeRTASBuilderGetBuildPropertiesExpEpilogue( ze_rtas_builder_exp_handle_t hBuilder, const ze_rtas_builder_build_op_exp_desc_t* pBuildOpDescriptor, ze_rtas_builder_exp_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeRTASBuilderGetBuildPropertiesExpEpilogue( ze_rtas_builder_exp_handle_t hBuilder, const ze_rtas_builder_build_op_exp_desc_t* pBuildOpDescriptor, ze_rtas_builder_exp_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeDriverRTASFormatCompatibilityCheckExpPrologue( ze_driver_handle_t hDriver, ze_rtas_format_exp_t rtasFormatA, ze_rtas_format_exp_t rtasFormatB ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeDriverRTASFormatCompatibilityCheckExpEpilogue( ze_driver_handle_t hDriver, ze_rtas_format_exp_t rtasFormatA, ze_rtas_format_exp_t rtasFormatB ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeDriverRTASFormatCompatibilityCheckExpEpilogue( ze_driver_handle_t hDriver, ze_rtas_format_exp_t rtasFormatA, ze_rtas_format_exp_t rtasFormatB, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeRTASBuilderBuildExpPrologue( ze_rtas_builder_exp_handle_t hBuilder, const ze_rtas_builder_build_op_exp_desc_t* pBuildOpDescriptor, void* pScratchBuffer, size_t scratchBufferSizeBytes, void* pRtasBuffer, size_t rtasBufferSizeBytes, ze_rtas_parallel_operation_exp_handle_t hParallelOperation, void* pBuildUserPtr, ze_rtas_aabb_exp_t* pBounds, size_t* pRtasBufferSizeBytes ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeRTASBuilderBuildExpEpilogue( ze_rtas_builder_exp_handle_t hBuilder, const ze_rtas_builder_build_op_exp_desc_t* pBuildOpDescriptor, void* pScratchBuffer, size_t scratchBufferSizeBytes, void* pRtasBuffer, size_t rtasBufferSizeBytes, ze_rtas_parallel_operation_exp_handle_t hParallelOperation, void* pBuildUserPtr, ze_rtas_aabb_exp_t* pBounds, size_t* pRtasBufferSizeBytes ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeRTASBuilderBuildExpEpilogue( ze_rtas_builder_exp_handle_t hBuilder, const ze_rtas_builder_build_op_exp_desc_t* pBuildOpDescriptor, void* pScratchBuffer, size_t scratchBufferSizeBytes, void* pRtasBuffer, size_t rtasBufferSizeBytes, ze_rtas_parallel_operation_exp_handle_t hParallelOperation, void* pBuildUserPtr, ze_rtas_aabb_exp_t* pBounds, size_t* pRtasBufferSizeBytes, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeRTASBuilderDestroyExpPrologue( ze_rtas_builder_exp_handle_t hBuilder ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeRTASBuilderDestroyExpEpilogue( ze_rtas_builder_exp_handle_t hBuilder ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeRTASBuilderDestroyExpEpilogue( ze_rtas_builder_exp_handle_t hBuilder, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeRTASParallelOperationCreateExpPrologue( ze_driver_handle_t hDriver, ze_rtas_parallel_operation_exp_handle_t* phParallelOperation ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeRTASParallelOperationCreateExpEpilogue( ze_driver_handle_t hDriver, ze_rtas_parallel_operation_exp_handle_t* phParallelOperation ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeRTASParallelOperationCreateExpEpilogue( ze_driver_handle_t hDriver, ze_rtas_parallel_operation_exp_handle_t* phParallelOperation, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeRTASParallelOperationGetPropertiesExpPrologue( ze_rtas_parallel_operation_exp_handle_t hParallelOperation, ze_rtas_parallel_operation_exp_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeRTASParallelOperationGetPropertiesExpEpilogue( ze_rtas_parallel_operation_exp_handle_t hParallelOperation, ze_rtas_parallel_operation_exp_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeRTASParallelOperationGetPropertiesExpEpilogue( ze_rtas_parallel_operation_exp_handle_t hParallelOperation, ze_rtas_parallel_operation_exp_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeRTASParallelOperationJoinExpPrologue( ze_rtas_parallel_operation_exp_handle_t hParallelOperation ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeRTASParallelOperationJoinExpEpilogue( ze_rtas_parallel_operation_exp_handle_t hParallelOperation ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeRTASParallelOperationJoinExpEpilogue( ze_rtas_parallel_operation_exp_handle_t hParallelOperation, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeRTASParallelOperationDestroyExpPrologue( ze_rtas_parallel_operation_exp_handle_t hParallelOperation ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeRTASParallelOperationDestroyExpEpilogue( ze_rtas_parallel_operation_exp_handle_t hParallelOperation ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeRTASParallelOperationDestroyExpEpilogue( ze_rtas_parallel_operation_exp_handle_t hParallelOperation, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeMemGetPitchFor2dImagePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, size_t imageWidth, size_t imageHeight, unsigned int elementSizeInBytes, size_t * rowPitch ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeMemGetPitchFor2dImageEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, size_t imageWidth, size_t imageHeight, unsigned int elementSizeInBytes, size_t * rowPitch ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeMemGetPitchFor2dImageEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, size_t imageWidth, size_t imageHeight, unsigned int elementSizeInBytes, size_t * rowPitch, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeImageGetDeviceOffsetExpPrologue( ze_image_handle_t hImage, uint64_t* pDeviceOffset ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeImageGetDeviceOffsetExpEpilogue( ze_image_handle_t hImage, uint64_t* pDeviceOffset ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeImageGetDeviceOffsetExpEpilogue( ze_image_handle_t hImage, uint64_t* pDeviceOffset, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListCreateCloneExpPrologue( ze_command_list_handle_t hCommandList, ze_command_list_handle_t* phClonedCommandList ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListCreateCloneExpEpilogue( ze_command_list_handle_t hCommandList, ze_command_list_handle_t* phClonedCommandList ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListCreateCloneExpEpilogue( ze_command_list_handle_t hCommandList, ze_command_list_handle_t* phClonedCommandList, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zeCommandListImmediateAppendCommandListsExpPrologue( ze_command_list_handle_t hCommandListImmediate, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zeCommandListImmediateAppendCommandListsExpEpilogue( ze_command_list_handle_t hCommandListImmediate, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zeCommandListImmediateAppendCommandListsExpEpilogue( ze_command_list_handle_t hCommandListImmediate, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ~ZEValidationEntryPoints() {}
 };
+
+// Index of each entry point, for the lists of checkers overriding it.
+namespace ZEEntryPoint {
+enum : uint32_t {
+    zeInitPrologue,
+    zeInitEpilogue,
+    zeDriverGetPrologue,
+    zeDriverGetEpilogue,
+    zeInitDriversPrologue,
+    zeInitDriversEpilogue,
+    zeDriverGetApiVersionPrologue,
+    zeDriverGetApiVersionEpilogue,
+    zeDriverGetPropertiesPrologue,
+    zeDriverGetPropertiesEpilogue,
+    zeDriverGetIpcPropertiesPrologue,
+    zeDriverGetIpcPropertiesEpilogue,
+    zeDriverGetExtensionPropertiesPrologue,
+    zeDriverGetExtensionPropertiesEpilogue,
+    zeDriverGetExtensionFunctionAddressPrologue,
+    zeDriverGetExtensionFunctionAddressEpilogue,
+    zeDriverGetLastErrorDescriptionPrologue,
+    zeDriverGetLastErrorDescriptionEpilogue,
+    zeDeviceGetPrologue,
+    zeDeviceGetEpilogue,
+    zeDeviceGetRootDevicePrologue,
+    zeDeviceGetRootDeviceEpilogue,
+    zeDeviceGetSubDevicesPrologue,
+    zeDeviceGetSubDevicesEpilogue,
+    zeDeviceGetPropertiesPrologue,
+    zeDeviceGetPropertiesEpilogue,
+    zeDeviceGetComputePropertiesPrologue,
+    zeDeviceGetComputePropertiesEpilogue,
+    zeDeviceGetModulePropertiesPrologue,
+    zeDeviceGetModulePropertiesEpilogue,
+    zeDeviceGetCommandQueueGroupPropertiesPrologue,
+    zeDeviceGetCommandQueueGroupPropertiesEpilogue,
+    zeDeviceGetMemoryPropertiesPrologue,
+    zeDeviceGetMemoryPropertiesEpilogue,
+    zeDeviceGetMemoryAccessPropertiesPrologue,
+    zeDeviceGetMemoryAccessPropertiesEpilogue,
+    zeDeviceGetCachePropertiesPrologue,
+    zeDeviceGetCachePropertiesEpilogue,
+    zeDeviceGetImagePropertiesPrologue,
+    zeDeviceGetImagePropertiesEpilogue,
+    zeDeviceGetExternalMemoryPropertiesPrologue,
+    zeDeviceGetExternalMemoryPropertiesEpilogue,
+    zeDeviceGetP2PPropertiesPrologue,
+    zeDeviceGetP2PPropertiesEpilogue,
+    zeDeviceCanAccessPeerPrologue,
+    zeDeviceCanAccessPeerEpilogue,
+    zeDeviceGetStatusPrologue,
+    zeDeviceGetStatusEpilogue,
+    zeDeviceGetGlobalTimestampsPrologue,
+    zeDeviceGetGlobalTimestampsEpilogue,
+    zeContextCreatePrologue,
+    zeContextCreateEpilogue,
+    zeContextCreateExPrologue,
+    zeContextCreateExEpilogue,
+    zeContextDestroyPrologue,
+    zeContextDestroyEpilogue,
+    zeContextGetStatusPrologue,
+    zeContextGetStatusEpilogue,
+    zeCommandQueueCreatePrologue,
+    zeCommandQueueCreateEpilogue,
+    zeCommandQueueDestroyPrologue,
+    zeCommandQueueDestroyEpilogue,
+    zeCommandQueueExecuteCommandListsPrologue,
+    zeCommandQueueExecuteCommandListsEpilogue,
+    zeCommandQueueSynchronizePrologue,
+    zeCommandQueueSynchronizeEpilogue,
+    zeCommandQueueGetOrdinalPrologue,
+    zeCommandQueueGetOrdinalEpilogue,
+    zeCommandQueueGetIndexPrologue,
+    zeCommandQueueGetIndexEpilogue,
+    zeCommandListCreatePrologue,
+    zeCommandListCreateEpilogue,
+    zeCommandListCreateImmediatePrologue,
+    zeCommandListCreateImmediateEpilogue,
+    zeCommandListDestroyPrologue,
+    zeCommandListDestroyEpilogue,
+    zeCommandListClosePrologue,
+    zeCommandListCloseEpilogue,
+    zeCommandListResetPrologue,
+    zeCommandListResetEpilogue,
+    zeCommandListAppendWriteGlobalTimestampPrologue,
+    zeCommandListAppendWriteGlobalTimestampEpilogue,
+    zeCommandListHostSynchronizePrologue,
+    zeCommandListHostSynchronizeEpilogue,
+    zeCommandListGetDeviceHandlePrologue,
+    zeCommandListGetDeviceHandleEpilogue,
+    zeCommandListGetContextHandlePrologue,
+    zeCommandListGetContextHandleEpilogue,
+    zeCommandListGetOrdinalPrologue,
+    zeCommandListGetOrdinalEpilogue,
+    zeCommandListImmediateGetIndexPrologue,
+    zeCommandListImmediateGetIndexEpilogue,
+    zeCommandListIsImmediatePrologue,
+    zeCommandListIsImmediateEpilogue,
+    zeCommandListAppendBarrierPrologue,
+    zeCommandListAppendBarrierEpilogue,
+    zeCommandListAppendMemoryRangesBarrierPrologue,
+    zeCommandListAppendMemoryRangesBarrierEpilogue,
+    zeContextSystemBarrierPrologue,
+    zeContextSystemBarrierEpilogue,
+    zeCommandListAppendMemoryCopyPrologue,
+    zeCommandListAppendMemoryCopyEpilogue,
+    zeCommandListAppendMemoryFillPrologue,
+    zeCommandListAppendMemoryFillEpilogue,
+    zeCommandListAppendMemoryCopyRegionPrologue,
+    zeCommandListAppendMemoryCopyRegionEpilogue,
+    zeCommandListAppendMemoryCopyFromContextPrologue,
+    zeCommandListAppendMemoryCopyFromContextEpilogue,
+    zeCommandListAppendImageCopyPrologue,
+    zeCommandListAppendImageCopyEpilogue,
+    zeCommandListAppendImageCopyRegionPrologue,
+    zeCommandListAppendImageCopyRegionEpilogue,
+    zeCommandListAppendImageCopyToMemoryPrologue,
+    zeCommandListAppendImageCopyToMemoryEpilogue,
+    zeCommandListAppendImageCopyFromMemoryPrologue,
+    zeCommandListAppendImageCopyFromMemoryEpilogue,
+    zeCommandListAppendMemoryPrefetchPrologue,
+    zeCommandListAppendMemoryPrefetchEpilogue,
+    zeCommandListAppendMemAdvisePrologue,
+    zeCommandListAppendMemAdviseEpilogue,
+    zeEventPoolCreatePrologue,
+    zeEventPoolCreateEpilogue,
+    zeEventPoolDestroyPrologue,
+    zeEventPoolDestroyEpilogue,
+    zeEventCreatePrologue,
+    zeEventCreateEpilogue,
+    zeEventDestroyPrologue,
+    zeEventDestroyEpilogue,
+    zeEventPoolGetIpcHandlePrologue,
+    zeEventPoolGetIpcHandleEpilogue,
+    zeEventPoolPutIpcHandlePrologue,
+    zeEventPoolPutIpcHandleEpilogue,
+    zeEventPoolOpenIpcHandlePrologue,
+    zeEventPoolOpenIpcHandleEpilogue,
+    zeEventPoolCloseIpcHandlePrologue,
+    zeEventPoolCloseIpcHandleEpilogue,
+    zeCommandListAppendSignalEventPrologue,
+    zeCommandListAppendSignalEventEpilogue,
+    zeCommandListAppendWaitOnEventsPrologue,
+    zeCommandListAppendWaitOnEventsEpilogue,
+    zeEventHostSignalPrologue,
+    zeEventHostSignalEpilogue,
+    zeEventHostSynchronizePrologue,
+    zeEventHostSynchronizeEpilogue,
+    zeEventQueryStatusPrologue,
+    zeEventQueryStatusEpilogue,
+    zeCommandListAppendEventResetPrologue,
+    zeCommandListAppendEventResetEpilogue,
+    zeEventHostResetPrologue,
+    zeEventHostResetEpilogue,
+    zeEventQueryKernelTimestampPrologue,
+    zeEventQueryKernelTimestampEpilogue,
+    zeCommandListAppendQueryKernelTimestampsPrologue,
+    zeCommandListAppendQueryKernelTimestampsEpilogue,
+    zeEventGetEventPoolPrologue,
+    zeEventGetEventPoolEpilogue,
+    zeEventGetSignalScopePrologue,
+    zeEventGetSignalScopeEpilogue,
+    zeEventGetWaitScopePrologue,
+    zeEventGetWaitScopeEpilogue,
+    zeEventPoolGetContextHandlePrologue,
+    zeEventPoolGetContextHandleEpilogue,
+    zeEventPoolGetFlagsPrologue,
+    zeEventPoolGetFlagsEpilogue,
+    zeFenceCreatePrologue,
+    zeFenceCreateEpilogue,
+    zeFenceDestroyPrologue,
+    zeFenceDestroyEpilogue,
+    zeFenceHostSynchronizePrologue,
+    zeFenceHostSynchronizeEpilogue,
+    zeFenceQueryStatusPrologue,
+    zeFenceQueryStatusEpilogue,
+    zeFenceResetPrologue,
+    zeFenceResetEpilogue,
+    zeImageGetPropertiesPrologue,
+    zeImageGetPropertiesEpilogue,
+    zeImageCreatePrologue,
+    zeImageCreateEpilogue,
+    zeImageDestroyPrologue,
+    zeImageDestroyEpilogue,
+    zeMemAllocSharedPrologue,
+    zeMemAllocSharedEpilogue,
+    zeMemAllocDevicePrologue,
+    zeMemAllocDeviceEpilogue,
+    zeMemAllocHostPrologue,
+    zeMemAllocHostEpilogue,
+    zeMemFreePrologue,
+    zeMemFreeEpilogue,
+    zeMemGetAllocPropertiesPrologue,
+    zeMemGetAllocPropertiesEpilogue,
+    zeMemGetAddressRangePrologue,
+    zeMemGetAddressRangeEpilogue,
+    zeMemGetIpcHandlePrologue,
+    zeMemGetIpcHandleEpilogue,
+    zeMemGetIpcHandleFromFileDescriptorExpPrologue,
+    zeMemGetIpcHandleFromFileDescriptorExpEpilogue,
+    zeMemGetFileDescriptorFromIpcHandleExpPrologue,
+    zeMemGetFileDescriptorFromIpcHandleExpEpilogue,
+    zeMemPutIpcHandlePrologue,
+    zeMemPutIpcHandleEpilogue,
+    zeMemOpenIpcHandlePrologue,
+    zeMemOpenIpcHandleEpilogue,
+    zeMemCloseIpcHandlePrologue,
+    zeMemCloseIpcHandleEpilogue,
+    zeMemSetAtomicAccessAttributeExpPrologue,
+    zeMemSetAtomicAccessAttributeExpEpilogue,
+    zeMemGetAtomicAccessAttributeExpPrologue,
+    zeMemGetAtomicAccessAttributeExpEpilogue,
+    zeModuleCreatePrologue,
+    zeModuleCreateEpilogue,
+    zeModuleDestroyPrologue,
+    zeModuleDestroyEpilogue,
+    zeModuleDynamicLinkPrologue,
+    zeModuleDynamicLinkEpilogue,
+    zeModuleBuildLogDestroyPrologue,
+    zeModuleBuildLogDestroyEpilogue,
+    zeModuleBuildLogGetStringPrologue,
+    zeModuleBuildLogGetStringEpilogue,
+    zeModuleGetNativeBinaryPrologue,
+    zeModuleGetNativeBinaryEpilogue,
+    zeModuleGetGlobalPointerPrologue,
+    zeModuleGetGlobalPointerEpilogue,
+    zeModuleGetKernelNamesPrologue,
+    zeModuleGetKernelNamesEpilogue,
+    zeModuleGetPropertiesPrologue,
+    zeModuleGetPropertiesEpilogue,
+    zeKernelCreatePrologue,
+    zeKernelCreateEpilogue,
+    zeKernelDestroyPrologue,
+    zeKernelDestroyEpilogue,
+    zeModuleGetFunctionPointerPrologue,
+    zeModuleGetFunctionPointerEpilogue,
+    zeKernelSetGroupSizePrologue,
+    zeKernelSetGroupSizeEpilogue,
+    zeKernelSuggestGroupSizePrologue,
+    zeKernelSuggestGroupSizeEpilogue,
+    zeKernelSuggestMaxCooperativeGroupCountPrologue,
+    zeKernelSuggestMaxCooperativeGroupCountEpilogue,
+    zeKernelSetArgumentValuePrologue,
+    zeKernelSetArgumentValueEpilogue,
+    zeKernelSetIndirectAccessPrologue,
+    zeKernelSetIndirectAccessEpilogue,
+    zeKernelGetIndirectAccessPrologue,
+    zeKernelGetIndirectAccessEpilogue,
+    zeKernelGetSourceAttributesPrologue,
+    zeKernelGetSourceAttributesEpilogue,
+    zeKernelSetCacheConfigPrologue,
+    zeKernelSetCacheConfigEpilogue,
+    zeKernelGetPropertiesPrologue,
+    zeKernelGetPropertiesEpilogue,
+    zeKernelGetNamePrologue,
+    zeKernelGetNameEpilogue,
+    zeCommandListAppendLaunchKernelPrologue,
+    zeCommandListAppendLaunchKernelEpilogue,
+    zeCommandListAppendLaunchCooperativeKernelPrologue,
+    zeCommandListAppendLaunchCooperativeKernelEpilogue,
+    zeCommandListAppendLaunchKernelIndirectPrologue,
+    zeCommandListAppendLaunchKernelIndirectEpilogue,
+    zeCommandListAppendLaunchMultipleKernelsIndirectPrologue,
+    zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue,
+    zeContextMakeMemoryResidentPrologue,
+    zeContextMakeMemoryResidentEpilogue,
+    zeContextEvictMemoryPrologue,
+    zeContextEvictMemoryEpilogue,
+    zeContextMakeImageResidentPrologue,
+    zeContextMakeImageResidentEpilogue,
+    zeContextEvictImagePrologue,
+    zeContextEvictImageEpilogue,
+    zeSamplerCreatePrologue,
+    zeSamplerCreateEpilogue,
+    zeSamplerDestroyPrologue,
+    zeSamplerDestroyEpilogue,
+    zeVirtualMemReservePrologue,
+    zeVirtualMemReserveEpilogue,
+    zeVirtualMemFreePrologue,
+    zeVirtualMemFreeEpilogue,
+    zeVirtualMemQueryPageSizePrologue,
+    zeVirtualMemQueryPageSizeEpilogue,
+    zePhysicalMemCreatePrologue,
+    zePhysicalMemCreateEpilogue,
+    zePhysicalMemDestroyPrologue,
+    zePhysicalMemDestroyEpilogue,
+    zeVirtualMemMapPrologue,
+    zeVirtualMemMapEpilogue,
+    zeVirtualMemUnmapPrologue,
+    zeVirtualMemUnmapEpilogue,
+    zeVirtualMemSetAccessAttributePrologue,
+    zeVirtualMemSetAccessAttributeEpilogue,
+    zeVirtualMemGetAccessAttributePrologue,
+    zeVirtualMemGetAccessAttributeEpilogue,
+    zeKernelSetGlobalOffsetExpPrologue,
+    zeKernelSetGlobalOffsetExpEpilogue,
+    zeCommandListGetNextCommandIdExpPrologue,
+    zeCommandListGetNextCommandIdExpEpilogue,
+    zeCommandListGetNextCommandIdWithKernelsExpPrologue,
+    zeCommandListGetNextCommandIdWithKernelsExpEpilogue,
+    zeCommandListUpdateMutableCommandsExpPrologue,
+    zeCommandListUpdateMutableCommandsExpEpilogue,
+    zeCommandListUpdateMutableCommandSignalEventExpPrologue,
+    zeCommandListUpdateMutableCommandSignalEventExpEpilogue,
+    zeCommandListUpdateMutableCommandWaitEventsExpPrologue,
+    zeCommandListUpdateMutableCommandWaitEventsExpEpilogue,
+    zeCommandListUpdateMutableCommandKernelsExpPrologue,
+    zeCommandListUpdateMutableCommandKernelsExpEpilogue,
+    zeDeviceReserveCacheExtPrologue,
+    zeDeviceReserveCacheExtEpilogue,
+    zeDeviceSetCacheAdviceExtPrologue,
+    zeDeviceSetCacheAdviceExtEpilogue,
+    zeEventQueryTimestampsExpPrologue,
+    zeEventQueryTimestampsExpEpilogue,
+    zeImageGetMemoryPropertiesExpPrologue,
+    zeImageGetMemoryPropertiesExpEpilogue,
+    zeImageViewCreateExtPrologue,
+    zeImageViewCreateExtEpilogue,
+    zeImageViewCreateExpPrologue,
+    zeImageViewCreateExpEpilogue,
+    zeKernelSchedulingHintExpPrologue,
+    zeKernelSchedulingHintExpEpilogue,
+    zeDevicePciGetPropertiesExtPrologue,
+    zeDevicePciGetPropertiesExtEpilogue,
+    zeCommandListAppendImageCopyToMemoryExtPrologue,
+    zeCommandListAppendImageCopyToMemoryExtEpilogue,
+    zeCommandListAppendImageCopyFromMemoryExtPrologue,
+    zeCommandListAppendImageCopyFromMemoryExtEpilogue,
+    zeImageGetAllocPropertiesExtPrologue,
+    zeImageGetAllocPropertiesExtEpilogue,
+    zeModuleInspectLinkageExtPrologue,
+    zeModuleInspectLinkageExtEpilogue,
+    zeMemFreeExtPrologue,
+    zeMemFreeExtEpilogue,
+    zeFabricVertexGetExpPrologue,
+    zeFabricVertexGetExpEpilogue,
+    zeFabricVertexGetSubVerticesExpPrologue,
+    zeFabricVertexGetSubVerticesExpEpilogue,
+    zeFabricVertexGetPropertiesExpPrologue,
+    zeFabricVertexGetPropertiesExpEpilogue,
+    zeFabricVertexGetDeviceExpPrologue,
+    zeFabricVertexGetDeviceExpEpilogue,
+    zeDeviceGetFabricVertexExpPrologue,
+    zeDeviceGetFabricVertexExpEpilogue,
+    zeFabricEdgeGetExpPrologue,
+    zeFabricEdgeGetExpEpilogue,
+    zeFabricEdgeGetVerticesExpPrologue,
+    zeFabricEdgeGetVerticesExpEpilogue,
+    zeFabricEdgeGetPropertiesExpPrologue,
+    zeFabricEdgeGetPropertiesExpEpilogue,
+    zeEventQueryKernelTimestampsExtPrologue,
+    zeEventQueryKernelTimestampsExtEpilogue,
+    zeRTASBuilderCreateExpPrologue,
+    zeRTASBuilderCreateExpEpilogue,
+    zeRTASBuilderGetBuildPropertiesExpPrologue,
+    zeRTASBuilderGetBuildPropertiesExpEpilogue,
+    zeDriverRTASFormatCompatibilityCheckExpPrologue,
+    zeDriverRTASFormatCompatibilityCheckExpEpilogue,
+    zeRTASBuilderBuildExpPrologue,
+    zeRTASBuilderBuildExpEpilogue,
+    zeRTASBuilderDestroyExpPrologue,
+    zeRTASBuilderDestroyExpEpilogue,
+    zeRTASParallelOperationCreateExpPrologue,
+    zeRTASParallelOperationCreateExpEpilogue,
+    zeRTASParallelOperationGetPropertiesExpPrologue,
+    zeRTASParallelOperationGetPropertiesExpEpilogue,
+    zeRTASParallelOperationJoinExpPrologue,
+    zeRTASParallelOperationJoinExpEpilogue,
+    zeRTASParallelOperationDestroyExpPrologue,
+    zeRTASParallelOperationDestroyExpEpilogue,
+    zeMemGetPitchFor2dImagePrologue,
+    zeMemGetPitchFor2dImageEpilogue,
+    zeImageGetDeviceOffsetExpPrologue,
+    zeImageGetDeviceOffsetExpEpilogue,
+    zeCommandListCreateCloneExpPrologue,
+    zeCommandListCreateCloneExpEpilogue,
+    zeCommandListImmediateAppendCommandListsExpPrologue,
+    zeCommandListImmediateAppendCommandListsExpEpilogue,
+    Count
+};
+}
+
+// Entry points a checker class overrides, told apart from the defaults
+// above by the class their member pointers belong to.
+template <typename TChecker>
+std::bitset<ZEEntryPoint::Count> getZEOverriddenEntryPoints() {
+    std::bitset<ZEEntryPoint::Count> overrides;
+    overrides[ZEEntryPoint::zeInitPrologue] = !std::is_same<decltype(&TChecker::zeInitPrologue), decltype(&ZEValidationEntryPoints::zeInitPrologue)>::value;
+    overrides[ZEEntryPoint::zeInitEpilogue] = !std::is_same<decltype(&TChecker::zeInitEpilogue), decltype(&ZEValidationEntryPoints::zeInitEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetPrologue] = !std::is_same<decltype(&TChecker::zeDriverGetPrologue), decltype(&ZEValidationEntryPoints::zeDriverGetPrologue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetEpilogue] = !std::is_same<decltype(&TChecker::zeDriverGetEpilogue), decltype(&ZEValidationEntryPoints::zeDriverGetEpilogue)>::value;
+    overrides[ZEEntryPoint::zeInitDriversPrologue] = !std::is_same<decltype(&TChecker::zeInitDriversPrologue), decltype(&ZEValidationEntryPoints::zeInitDriversPrologue)>::value;
+    overrides[ZEEntryPoint::zeInitDriversEpilogue] = !std::is_same<decltype(&TChecker::zeInitDriversEpilogue), decltype(&ZEValidationEntryPoints::zeInitDriversEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetApiVersionPrologue] = !std::is_same<decltype(&TChecker::zeDriverGetApiVersionPrologue), decltype(&ZEValidationEntryPoints::zeDriverGetApiVersionPrologue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetApiVersionEpilogue] = !std::is_same<decltype(&TChecker::zeDriverGetApiVersionEpilogue), decltype(&ZEValidationEntryPoints::zeDriverGetApiVersionEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDriverGetPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDriverGetPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDriverGetPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDriverGetPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetIpcPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDriverGetIpcPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDriverGetIpcPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetIpcPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDriverGetIpcPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDriverGetIpcPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetExtensionPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDriverGetExtensionPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDriverGetExtensionPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetExtensionPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDriverGetExtensionPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDriverGetExtensionPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetExtensionFunctionAddressPrologue] = !std::is_same<decltype(&TChecker::zeDriverGetExtensionFunctionAddressPrologue), decltype(&ZEValidationEntryPoints::zeDriverGetExtensionFunctionAddressPrologue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetExtensionFunctionAddressEpilogue] = !std::is_same<decltype(&TChecker::zeDriverGetExtensionFunctionAddressEpilogue), decltype(&ZEValidationEntryPoints::zeDriverGetExtensionFunctionAddressEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetLastErrorDescriptionPrologue] = !std::is_same<decltype(&TChecker::zeDriverGetLastErrorDescriptionPrologue), decltype(&ZEValidationEntryPoints::zeDriverGetLastErrorDescriptionPrologue)>::value;
+    overrides[ZEEntryPoint::zeDriverGetLastErrorDescriptionEpilogue] = !std::is_same<decltype(&TChecker::zeDriverGetLastErrorDescriptionEpilogue), decltype(&ZEValidationEntryPoints::zeDriverGetLastErrorDescriptionEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetRootDevicePrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetRootDevicePrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetRootDevicePrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetRootDeviceEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetRootDeviceEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetRootDeviceEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetSubDevicesPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetSubDevicesPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetSubDevicesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetSubDevicesEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetSubDevicesEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetSubDevicesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetComputePropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetComputePropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetComputePropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetComputePropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetComputePropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetComputePropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetModulePropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetModulePropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetModulePropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetModulePropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetModulePropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetModulePropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetCommandQueueGroupPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetCommandQueueGroupPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetCommandQueueGroupPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetCommandQueueGroupPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetCommandQueueGroupPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetCommandQueueGroupPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetMemoryPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetMemoryPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetMemoryPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetMemoryPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetMemoryPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetMemoryPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetMemoryAccessPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetMemoryAccessPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetMemoryAccessPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetMemoryAccessPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetMemoryAccessPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetMemoryAccessPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetCachePropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetCachePropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetCachePropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetCachePropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetCachePropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetCachePropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetImagePropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetImagePropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetImagePropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetImagePropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetImagePropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetImagePropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetExternalMemoryPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetExternalMemoryPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetExternalMemoryPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetExternalMemoryPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetExternalMemoryPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetExternalMemoryPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetP2PPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetP2PPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetP2PPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetP2PPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetP2PPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetP2PPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceCanAccessPeerPrologue] = !std::is_same<decltype(&TChecker::zeDeviceCanAccessPeerPrologue), decltype(&ZEValidationEntryPoints::zeDeviceCanAccessPeerPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceCanAccessPeerEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceCanAccessPeerEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceCanAccessPeerEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetStatusPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetStatusPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetStatusPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetStatusEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetStatusEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetStatusEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetGlobalTimestampsPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetGlobalTimestampsPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetGlobalTimestampsPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetGlobalTimestampsEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetGlobalTimestampsEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetGlobalTimestampsEpilogue)>::value;
+    overrides[ZEEntryPoint::zeContextCreatePrologue] = !std::is_same<decltype(&TChecker::zeContextCreatePrologue), decltype(&ZEValidationEntryPoints::zeContextCreatePrologue)>::value;
+    overrides[ZEEntryPoint::zeContextCreateEpilogue] = !std::is_same<decltype(&TChecker::zeContextCreateEpilogue), decltype(&ZEValidationEntryPoints::zeContextCreateEpilogue)>::value;
+    overrides[ZEEntryPoint::zeContextCreateExPrologue] = !std::is_same<decltype(&TChecker::zeContextCreateExPrologue), decltype(&ZEValidationEntryPoints::zeContextCreateExPrologue)>::value;
+    overrides[ZEEntryPoint::zeContextCreateExEpilogue] = !std::is_same<decltype(&TChecker::zeContextCreateExEpilogue), decltype(&ZEValidationEntryPoints::zeContextCreateExEpilogue)>::value;
+    overrides[ZEEntryPoint::zeContextDestroyPrologue] = !std::is_same<decltype(&TChecker::zeContextDestroyPrologue), decltype(&ZEValidationEntryPoints::zeContextDestroyPrologue)>::value;
+    overrides[ZEEntryPoint::zeContextDestroyEpilogue] = !std::is_same<decltype(&TChecker::zeContextDestroyEpilogue), decltype(&ZEValidationEntryPoints::zeContextDestroyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeContextGetStatusPrologue] = !std::is_same<decltype(&TChecker::zeContextGetStatusPrologue), decltype(&ZEValidationEntryPoints::zeContextGetStatusPrologue)>::value;
+    overrides[ZEEntryPoint::zeContextGetStatusEpilogue] = !std::is_same<decltype(&TChecker::zeContextGetStatusEpilogue), decltype(&ZEValidationEntryPoints::zeContextGetStatusEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandQueueCreatePrologue] = !std::is_same<decltype(&TChecker::zeCommandQueueCreatePrologue), decltype(&ZEValidationEntryPoints::zeCommandQueueCreatePrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandQueueCreateEpilogue] = !std::is_same<decltype(&TChecker::zeCommandQueueCreateEpilogue), decltype(&ZEValidationEntryPoints::zeCommandQueueCreateEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandQueueDestroyPrologue] = !std::is_same<decltype(&TChecker::zeCommandQueueDestroyPrologue), decltype(&ZEValidationEntryPoints::zeCommandQueueDestroyPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandQueueDestroyEpilogue] = !std::is_same<decltype(&TChecker::zeCommandQueueDestroyEpilogue), decltype(&ZEValidationEntryPoints::zeCommandQueueDestroyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandQueueExecuteCommandListsPrologue] = !std::is_same<decltype(&TChecker::zeCommandQueueExecuteCommandListsPrologue), decltype(&ZEValidationEntryPoints::zeCommandQueueExecuteCommandListsPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandQueueExecuteCommandListsEpilogue] = !std::is_same<decltype(&TChecker::zeCommandQueueExecuteCommandListsEpilogue), decltype(&ZEValidationEntryPoints::zeCommandQueueExecuteCommandListsEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandQueueSynchronizePrologue] = !std::is_same<decltype(&TChecker::zeCommandQueueSynchronizePrologue), decltype(&ZEValidationEntryPoints::zeCommandQueueSynchronizePrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandQueueSynchronizeEpilogue] = !std::is_same<decltype(&TChecker::zeCommandQueueSynchronizeEpilogue), decltype(&ZEValidationEntryPoints::zeCommandQueueSynchronizeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandQueueGetOrdinalPrologue] = !std::is_same<decltype(&TChecker::zeCommandQueueGetOrdinalPrologue), decltype(&ZEValidationEntryPoints::zeCommandQueueGetOrdinalPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandQueueGetOrdinalEpilogue] = !std::is_same<decltype(&TChecker::zeCommandQueueGetOrdinalEpilogue), decltype(&ZEValidationEntryPoints::zeCommandQueueGetOrdinalEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandQueueGetIndexPrologue] = !std::is_same<decltype(&TChecker::zeCommandQueueGetIndexPrologue), decltype(&ZEValidationEntryPoints::zeCommandQueueGetIndexPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandQueueGetIndexEpilogue] = !std::is_same<decltype(&TChecker::zeCommandQueueGetIndexEpilogue), decltype(&ZEValidationEntryPoints::zeCommandQueueGetIndexEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListCreatePrologue] = !std::is_same<decltype(&TChecker::zeCommandListCreatePrologue), decltype(&ZEValidationEntryPoints::zeCommandListCreatePrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListCreateEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListCreateEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListCreateEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListCreateImmediatePrologue] = !std::is_same<decltype(&TChecker::zeCommandListCreateImmediatePrologue), decltype(&ZEValidationEntryPoints::zeCommandListCreateImmediatePrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListCreateImmediateEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListCreateImmediateEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListCreateImmediateEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListDestroyPrologue] = !std::is_same<decltype(&TChecker::zeCommandListDestroyPrologue), decltype(&ZEValidationEntryPoints::zeCommandListDestroyPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListDestroyEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListDestroyEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListDestroyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListClosePrologue] = !std::is_same<decltype(&TChecker::zeCommandListClosePrologue), decltype(&ZEValidationEntryPoints::zeCommandListClosePrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListCloseEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListCloseEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListCloseEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListResetPrologue] = !std::is_same<decltype(&TChecker::zeCommandListResetPrologue), decltype(&ZEValidationEntryPoints::zeCommandListResetPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListResetEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListResetEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListResetEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendWriteGlobalTimestampPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendWriteGlobalTimestampPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendWriteGlobalTimestampPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendWriteGlobalTimestampEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendWriteGlobalTimestampEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendWriteGlobalTimestampEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListHostSynchronizePrologue] = !std::is_same<decltype(&TChecker::zeCommandListHostSynchronizePrologue), decltype(&ZEValidationEntryPoints::zeCommandListHostSynchronizePrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListHostSynchronizeEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListHostSynchronizeEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListHostSynchronizeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListGetDeviceHandlePrologue] = !std::is_same<decltype(&TChecker::zeCommandListGetDeviceHandlePrologue), decltype(&ZEValidationEntryPoints::zeCommandListGetDeviceHandlePrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListGetDeviceHandleEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListGetDeviceHandleEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListGetDeviceHandleEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListGetContextHandlePrologue] = !std::is_same<decltype(&TChecker::zeCommandListGetContextHandlePrologue), decltype(&ZEValidationEntryPoints::zeCommandListGetContextHandlePrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListGetContextHandleEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListGetContextHandleEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListGetContextHandleEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListGetOrdinalPrologue] = !std::is_same<decltype(&TChecker::zeCommandListGetOrdinalPrologue), decltype(&ZEValidationEntryPoints::zeCommandListGetOrdinalPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListGetOrdinalEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListGetOrdinalEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListGetOrdinalEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListImmediateGetIndexPrologue] = !std::is_same<decltype(&TChecker::zeCommandListImmediateGetIndexPrologue), decltype(&ZEValidationEntryPoints::zeCommandListImmediateGetIndexPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListImmediateGetIndexEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListImmediateGetIndexEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListImmediateGetIndexEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListIsImmediatePrologue] = !std::is_same<decltype(&TChecker::zeCommandListIsImmediatePrologue), decltype(&ZEValidationEntryPoints::zeCommandListIsImmediatePrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListIsImmediateEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListIsImmediateEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListIsImmediateEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendBarrierPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendBarrierPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendBarrierPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendBarrierEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendBarrierEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendBarrierEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemoryRangesBarrierPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemoryRangesBarrierPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemoryRangesBarrierPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemoryRangesBarrierEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemoryRangesBarrierEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemoryRangesBarrierEpilogue)>::value;
+    overrides[ZEEntryPoint::zeContextSystemBarrierPrologue] = !std::is_same<decltype(&TChecker::zeContextSystemBarrierPrologue), decltype(&ZEValidationEntryPoints::zeContextSystemBarrierPrologue)>::value;
+    overrides[ZEEntryPoint::zeContextSystemBarrierEpilogue] = !std::is_same<decltype(&TChecker::zeContextSystemBarrierEpilogue), decltype(&ZEValidationEntryPoints::zeContextSystemBarrierEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemoryCopyPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemoryCopyPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemoryCopyPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemoryCopyEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemoryCopyEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemoryCopyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemoryFillPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemoryFillPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemoryFillPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemoryFillEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemoryFillEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemoryFillEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemoryCopyRegionPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemoryCopyRegionPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemoryCopyRegionPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemoryCopyRegionEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemoryCopyRegionEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemoryCopyRegionEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemoryCopyFromContextPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemoryCopyFromContextPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemoryCopyFromContextPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemoryCopyFromContextEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemoryCopyFromContextEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemoryCopyFromContextEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendImageCopyPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendImageCopyPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendImageCopyPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendImageCopyEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendImageCopyEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendImageCopyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendImageCopyRegionPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendImageCopyRegionPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendImageCopyRegionPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendImageCopyRegionEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendImageCopyRegionEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendImageCopyRegionEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendImageCopyToMemoryPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendImageCopyToMemoryPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendImageCopyToMemoryPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendImageCopyToMemoryEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendImageCopyToMemoryEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendImageCopyToMemoryEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendImageCopyFromMemoryPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendImageCopyFromMemoryPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendImageCopyFromMemoryPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendImageCopyFromMemoryEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendImageCopyFromMemoryEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendImageCopyFromMemoryEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemoryPrefetchPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemoryPrefetchPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemoryPrefetchPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemoryPrefetchEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemoryPrefetchEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemoryPrefetchEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemAdvisePrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemAdvisePrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemAdvisePrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendMemAdviseEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendMemAdviseEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendMemAdviseEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolCreatePrologue] = !std::is_same<decltype(&TChecker::zeEventPoolCreatePrologue), decltype(&ZEValidationEntryPoints::zeEventPoolCreatePrologue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolCreateEpilogue] = !std::is_same<decltype(&TChecker::zeEventPoolCreateEpilogue), decltype(&ZEValidationEntryPoints::zeEventPoolCreateEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolDestroyPrologue] = !std::is_same<decltype(&TChecker::zeEventPoolDestroyPrologue), decltype(&ZEValidationEntryPoints::zeEventPoolDestroyPrologue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolDestroyEpilogue] = !std::is_same<decltype(&TChecker::zeEventPoolDestroyEpilogue), decltype(&ZEValidationEntryPoints::zeEventPoolDestroyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventCreatePrologue] = !std::is_same<decltype(&TChecker::zeEventCreatePrologue), decltype(&ZEValidationEntryPoints::zeEventCreatePrologue)>::value;
+    overrides[ZEEntryPoint::zeEventCreateEpilogue] = !std::is_same<decltype(&TChecker::zeEventCreateEpilogue), decltype(&ZEValidationEntryPoints::zeEventCreateEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventDestroyPrologue] = !std::is_same<decltype(&TChecker::zeEventDestroyPrologue), decltype(&ZEValidationEntryPoints::zeEventDestroyPrologue)>::value;
+    overrides[ZEEntryPoint::zeEventDestroyEpilogue] = !std::is_same<decltype(&TChecker::zeEventDestroyEpilogue), decltype(&ZEValidationEntryPoints::zeEventDestroyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolGetIpcHandlePrologue] = !std::is_same<decltype(&TChecker::zeEventPoolGetIpcHandlePrologue), decltype(&ZEValidationEntryPoints::zeEventPoolGetIpcHandlePrologue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolGetIpcHandleEpilogue] = !std::is_same<decltype(&TChecker::zeEventPoolGetIpcHandleEpilogue), decltype(&ZEValidationEntryPoints::zeEventPoolGetIpcHandleEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolPutIpcHandlePrologue] = !std::is_same<decltype(&TChecker::zeEventPoolPutIpcHandlePrologue), decltype(&ZEValidationEntryPoints::zeEventPoolPutIpcHandlePrologue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolPutIpcHandleEpilogue] = !std::is_same<decltype(&TChecker::zeEventPoolPutIpcHandleEpilogue), decltype(&ZEValidationEntryPoints::zeEventPoolPutIpcHandleEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolOpenIpcHandlePrologue] = !std::is_same<decltype(&TChecker::zeEventPoolOpenIpcHandlePrologue), decltype(&ZEValidationEntryPoints::zeEventPoolOpenIpcHandlePrologue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolOpenIpcHandleEpilogue] = !std::is_same<decltype(&TChecker::zeEventPoolOpenIpcHandleEpilogue), decltype(&ZEValidationEntryPoints::zeEventPoolOpenIpcHandleEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolCloseIpcHandlePrologue] = !std::is_same<decltype(&TChecker::zeEventPoolCloseIpcHandlePrologue), decltype(&ZEValidationEntryPoints::zeEventPoolCloseIpcHandlePrologue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolCloseIpcHandleEpilogue] = !std::is_same<decltype(&TChecker::zeEventPoolCloseIpcHandleEpilogue), decltype(&ZEValidationEntryPoints::zeEventPoolCloseIpcHandleEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendSignalEventPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendSignalEventPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendSignalEventPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendSignalEventEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendSignalEventEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendSignalEventEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendWaitOnEventsPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendWaitOnEventsPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendWaitOnEventsPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendWaitOnEventsEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendWaitOnEventsEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendWaitOnEventsEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventHostSignalPrologue] = !std::is_same<decltype(&TChecker::zeEventHostSignalPrologue), decltype(&ZEValidationEntryPoints::zeEventHostSignalPrologue)>::value;
+    overrides[ZEEntryPoint::zeEventHostSignalEpilogue] = !std::is_same<decltype(&TChecker::zeEventHostSignalEpilogue), decltype(&ZEValidationEntryPoints::zeEventHostSignalEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventHostSynchronizePrologue] = !std::is_same<decltype(&TChecker::zeEventHostSynchronizePrologue), decltype(&ZEValidationEntryPoints::zeEventHostSynchronizePrologue)>::value;
+    overrides[ZEEntryPoint::zeEventHostSynchronizeEpilogue] = !std::is_same<decltype(&TChecker::zeEventHostSynchronizeEpilogue), decltype(&ZEValidationEntryPoints::zeEventHostSynchronizeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventQueryStatusPrologue] = !std::is_same<decltype(&TChecker::zeEventQueryStatusPrologue), decltype(&ZEValidationEntryPoints::zeEventQueryStatusPrologue)>::value;
+    overrides[ZEEntryPoint::zeEventQueryStatusEpilogue] = !std::is_same<decltype(&TChecker::zeEventQueryStatusEpilogue), decltype(&ZEValidationEntryPoints::zeEventQueryStatusEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendEventResetPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendEventResetPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendEventResetPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendEventResetEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendEventResetEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendEventResetEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventHostResetPrologue] = !std::is_same<decltype(&TChecker::zeEventHostResetPrologue), decltype(&ZEValidationEntryPoints::zeEventHostResetPrologue)>::value;
+    overrides[ZEEntryPoint::zeEventHostResetEpilogue] = !std::is_same<decltype(&TChecker::zeEventHostResetEpilogue), decltype(&ZEValidationEntryPoints::zeEventHostResetEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventQueryKernelTimestampPrologue] = !std::is_same<decltype(&TChecker::zeEventQueryKernelTimestampPrologue), decltype(&ZEValidationEntryPoints::zeEventQueryKernelTimestampPrologue)>::value;
+    overrides[ZEEntryPoint::zeEventQueryKernelTimestampEpilogue] = !std::is_same<decltype(&TChecker::zeEventQueryKernelTimestampEpilogue), decltype(&ZEValidationEntryPoints::zeEventQueryKernelTimestampEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendQueryKernelTimestampsPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendQueryKernelTimestampsPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendQueryKernelTimestampsPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendQueryKernelTimestampsEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendQueryKernelTimestampsEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendQueryKernelTimestampsEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventGetEventPoolPrologue] = !std::is_same<decltype(&TChecker::zeEventGetEventPoolPrologue), decltype(&ZEValidationEntryPoints::zeEventGetEventPoolPrologue)>::value;
+    overrides[ZEEntryPoint::zeEventGetEventPoolEpilogue] = !std::is_same<decltype(&TChecker::zeEventGetEventPoolEpilogue), decltype(&ZEValidationEntryPoints::zeEventGetEventPoolEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventGetSignalScopePrologue] = !std::is_same<decltype(&TChecker::zeEventGetSignalScopePrologue), decltype(&ZEValidationEntryPoints::zeEventGetSignalScopePrologue)>::value;
+    overrides[ZEEntryPoint::zeEventGetSignalScopeEpilogue] = !std::is_same<decltype(&TChecker::zeEventGetSignalScopeEpilogue), decltype(&ZEValidationEntryPoints::zeEventGetSignalScopeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventGetWaitScopePrologue] = !std::is_same<decltype(&TChecker::zeEventGetWaitScopePrologue), decltype(&ZEValidationEntryPoints::zeEventGetWaitScopePrologue)>::value;
+    overrides[ZEEntryPoint::zeEventGetWaitScopeEpilogue] = !std::is_same<decltype(&TChecker::zeEventGetWaitScopeEpilogue), decltype(&ZEValidationEntryPoints::zeEventGetWaitScopeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolGetContextHandlePrologue] = !std::is_same<decltype(&TChecker::zeEventPoolGetContextHandlePrologue), decltype(&ZEValidationEntryPoints::zeEventPoolGetContextHandlePrologue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolGetContextHandleEpilogue] = !std::is_same<decltype(&TChecker::zeEventPoolGetContextHandleEpilogue), decltype(&ZEValidationEntryPoints::zeEventPoolGetContextHandleEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolGetFlagsPrologue] = !std::is_same<decltype(&TChecker::zeEventPoolGetFlagsPrologue), decltype(&ZEValidationEntryPoints::zeEventPoolGetFlagsPrologue)>::value;
+    overrides[ZEEntryPoint::zeEventPoolGetFlagsEpilogue] = !std::is_same<decltype(&TChecker::zeEventPoolGetFlagsEpilogue), decltype(&ZEValidationEntryPoints::zeEventPoolGetFlagsEpilogue)>::value;
+    overrides[ZEEntryPoint::zeFenceCreatePrologue] = !std::is_same<decltype(&TChecker::zeFenceCreatePrologue), decltype(&ZEValidationEntryPoints::zeFenceCreatePrologue)>::value;
+    overrides[ZEEntryPoint::zeFenceCreateEpilogue] = !std::is_same<decltype(&TChecker::zeFenceCreateEpilogue), decltype(&ZEValidationEntryPoints::zeFenceCreateEpilogue)>::value;
+    overrides[ZEEntryPoint::zeFenceDestroyPrologue] = !std::is_same<decltype(&TChecker::zeFenceDestroyPrologue), decltype(&ZEValidationEntryPoints::zeFenceDestroyPrologue)>::value;
+    overrides[ZEEntryPoint::zeFenceDestroyEpilogue] = !std::is_same<decltype(&TChecker::zeFenceDestroyEpilogue), decltype(&ZEValidationEntryPoints::zeFenceDestroyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeFenceHostSynchronizePrologue] = !std::is_same<decltype(&TChecker::zeFenceHostSynchronizePrologue), decltype(&ZEValidationEntryPoints::zeFenceHostSynchronizePrologue)>::value;
+    overrides[ZEEntryPoint::zeFenceHostSynchronizeEpilogue] = !std::is_same<decltype(&TChecker::zeFenceHostSynchronizeEpilogue), decltype(&ZEValidationEntryPoints::zeFenceHostSynchronizeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeFenceQueryStatusPrologue] = !std::is_same<decltype(&TChecker::zeFenceQueryStatusPrologue), decltype(&ZEValidationEntryPoints::zeFenceQueryStatusPrologue)>::value;
+    overrides[ZEEntryPoint::zeFenceQueryStatusEpilogue] = !std::is_same<decltype(&TChecker::zeFenceQueryStatusEpilogue), decltype(&ZEValidationEntryPoints::zeFenceQueryStatusEpilogue)>::value;
+    overrides[ZEEntryPoint::zeFenceResetPrologue] = !std::is_same<decltype(&TChecker::zeFenceResetPrologue), decltype(&ZEValidationEntryPoints::zeFenceResetPrologue)>::value;
+    overrides[ZEEntryPoint::zeFenceResetEpilogue] = !std::is_same<decltype(&TChecker::zeFenceResetEpilogue), decltype(&ZEValidationEntryPoints::zeFenceResetEpilogue)>::value;
+    overrides[ZEEntryPoint::zeImageGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeImageGetPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeImageGetPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeImageGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeImageGetPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeImageGetPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeImageCreatePrologue] = !std::is_same<decltype(&TChecker::zeImageCreatePrologue), decltype(&ZEValidationEntryPoints::zeImageCreatePrologue)>::value;
+    overrides[ZEEntryPoint::zeImageCreateEpilogue] = !std::is_same<decltype(&TChecker::zeImageCreateEpilogue), decltype(&ZEValidationEntryPoints::zeImageCreateEpilogue)>::value;
+    overrides[ZEEntryPoint::zeImageDestroyPrologue] = !std::is_same<decltype(&TChecker::zeImageDestroyPrologue), decltype(&ZEValidationEntryPoints::zeImageDestroyPrologue)>::value;
+    overrides[ZEEntryPoint::zeImageDestroyEpilogue] = !std::is_same<decltype(&TChecker::zeImageDestroyEpilogue), decltype(&ZEValidationEntryPoints::zeImageDestroyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemAllocSharedPrologue] = !std::is_same<decltype(&TChecker::zeMemAllocSharedPrologue), decltype(&ZEValidationEntryPoints::zeMemAllocSharedPrologue)>::value;
+    overrides[ZEEntryPoint::zeMemAllocSharedEpilogue] = !std::is_same<decltype(&TChecker::zeMemAllocSharedEpilogue), decltype(&ZEValidationEntryPoints::zeMemAllocSharedEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemAllocDevicePrologue] = !std::is_same<decltype(&TChecker::zeMemAllocDevicePrologue), decltype(&ZEValidationEntryPoints::zeMemAllocDevicePrologue)>::value;
+    overrides[ZEEntryPoint::zeMemAllocDeviceEpilogue] = !std::is_same<decltype(&TChecker::zeMemAllocDeviceEpilogue), decltype(&ZEValidationEntryPoints::zeMemAllocDeviceEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemAllocHostPrologue] = !std::is_same<decltype(&TChecker::zeMemAllocHostPrologue), decltype(&ZEValidationEntryPoints::zeMemAllocHostPrologue)>::value;
+    overrides[ZEEntryPoint::zeMemAllocHostEpilogue] = !std::is_same<decltype(&TChecker::zeMemAllocHostEpilogue), decltype(&ZEValidationEntryPoints::zeMemAllocHostEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemFreePrologue] = !std::is_same<decltype(&TChecker::zeMemFreePrologue), decltype(&ZEValidationEntryPoints::zeMemFreePrologue)>::value;
+    overrides[ZEEntryPoint::zeMemFreeEpilogue] = !std::is_same<decltype(&TChecker::zeMemFreeEpilogue), decltype(&ZEValidationEntryPoints::zeMemFreeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemGetAllocPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeMemGetAllocPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeMemGetAllocPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeMemGetAllocPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeMemGetAllocPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeMemGetAllocPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemGetAddressRangePrologue] = !std::is_same<decltype(&TChecker::zeMemGetAddressRangePrologue), decltype(&ZEValidationEntryPoints::zeMemGetAddressRangePrologue)>::value;
+    overrides[ZEEntryPoint::zeMemGetAddressRangeEpilogue] = !std::is_same<decltype(&TChecker::zeMemGetAddressRangeEpilogue), decltype(&ZEValidationEntryPoints::zeMemGetAddressRangeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemGetIpcHandlePrologue] = !std::is_same<decltype(&TChecker::zeMemGetIpcHandlePrologue), decltype(&ZEValidationEntryPoints::zeMemGetIpcHandlePrologue)>::value;
+    overrides[ZEEntryPoint::zeMemGetIpcHandleEpilogue] = !std::is_same<decltype(&TChecker::zeMemGetIpcHandleEpilogue), decltype(&ZEValidationEntryPoints::zeMemGetIpcHandleEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemGetIpcHandleFromFileDescriptorExpPrologue] = !std::is_same<decltype(&TChecker::zeMemGetIpcHandleFromFileDescriptorExpPrologue), decltype(&ZEValidationEntryPoints::zeMemGetIpcHandleFromFileDescriptorExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeMemGetIpcHandleFromFileDescriptorExpEpilogue] = !std::is_same<decltype(&TChecker::zeMemGetIpcHandleFromFileDescriptorExpEpilogue), decltype(&ZEValidationEntryPoints::zeMemGetIpcHandleFromFileDescriptorExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemGetFileDescriptorFromIpcHandleExpPrologue] = !std::is_same<decltype(&TChecker::zeMemGetFileDescriptorFromIpcHandleExpPrologue), decltype(&ZEValidationEntryPoints::zeMemGetFileDescriptorFromIpcHandleExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeMemGetFileDescriptorFromIpcHandleExpEpilogue] = !std::is_same<decltype(&TChecker::zeMemGetFileDescriptorFromIpcHandleExpEpilogue), decltype(&ZEValidationEntryPoints::zeMemGetFileDescriptorFromIpcHandleExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemPutIpcHandlePrologue] = !std::is_same<decltype(&TChecker::zeMemPutIpcHandlePrologue), decltype(&ZEValidationEntryPoints::zeMemPutIpcHandlePrologue)>::value;
+    overrides[ZEEntryPoint::zeMemPutIpcHandleEpilogue] = !std::is_same<decltype(&TChecker::zeMemPutIpcHandleEpilogue), decltype(&ZEValidationEntryPoints::zeMemPutIpcHandleEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemOpenIpcHandlePrologue] = !std::is_same<decltype(&TChecker::zeMemOpenIpcHandlePrologue), decltype(&ZEValidationEntryPoints::zeMemOpenIpcHandlePrologue)>::value;
+    overrides[ZEEntryPoint::zeMemOpenIpcHandleEpilogue] = !std::is_same<decltype(&TChecker::zeMemOpenIpcHandleEpilogue), decltype(&ZEValidationEntryPoints::zeMemOpenIpcHandleEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemCloseIpcHandlePrologue] = !std::is_same<decltype(&TChecker::zeMemCloseIpcHandlePrologue), decltype(&ZEValidationEntryPoints::zeMemCloseIpcHandlePrologue)>::value;
+    overrides[ZEEntryPoint::zeMemCloseIpcHandleEpilogue] = !std::is_same<decltype(&TChecker::zeMemCloseIpcHandleEpilogue), decltype(&ZEValidationEntryPoints::zeMemCloseIpcHandleEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemSetAtomicAccessAttributeExpPrologue] = !std::is_same<decltype(&TChecker::zeMemSetAtomicAccessAttributeExpPrologue), decltype(&ZEValidationEntryPoints::zeMemSetAtomicAccessAttributeExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeMemSetAtomicAccessAttributeExpEpilogue] = !std::is_same<decltype(&TChecker::zeMemSetAtomicAccessAttributeExpEpilogue), decltype(&ZEValidationEntryPoints::zeMemSetAtomicAccessAttributeExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemGetAtomicAccessAttributeExpPrologue] = !std::is_same<decltype(&TChecker::zeMemGetAtomicAccessAttributeExpPrologue), decltype(&ZEValidationEntryPoints::zeMemGetAtomicAccessAttributeExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeMemGetAtomicAccessAttributeExpEpilogue] = !std::is_same<decltype(&TChecker::zeMemGetAtomicAccessAttributeExpEpilogue), decltype(&ZEValidationEntryPoints::zeMemGetAtomicAccessAttributeExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeModuleCreatePrologue] = !std::is_same<decltype(&TChecker::zeModuleCreatePrologue), decltype(&ZEValidationEntryPoints::zeModuleCreatePrologue)>::value;
+    overrides[ZEEntryPoint::zeModuleCreateEpilogue] = !std::is_same<decltype(&TChecker::zeModuleCreateEpilogue), decltype(&ZEValidationEntryPoints::zeModuleCreateEpilogue)>::value;
+    overrides[ZEEntryPoint::zeModuleDestroyPrologue] = !std::is_same<decltype(&TChecker::zeModuleDestroyPrologue), decltype(&ZEValidationEntryPoints::zeModuleDestroyPrologue)>::value;
+    overrides[ZEEntryPoint::zeModuleDestroyEpilogue] = !std::is_same<decltype(&TChecker::zeModuleDestroyEpilogue), decltype(&ZEValidationEntryPoints::zeModuleDestroyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeModuleDynamicLinkPrologue] = !std::is_same<decltype(&TChecker::zeModuleDynamicLinkPrologue), decltype(&ZEValidationEntryPoints::zeModuleDynamicLinkPrologue)>::value;
+    overrides[ZEEntryPoint::zeModuleDynamicLinkEpilogue] = !std::is_same<decltype(&TChecker::zeModuleDynamicLinkEpilogue), decltype(&ZEValidationEntryPoints::zeModuleDynamicLinkEpilogue)>::value;
+    overrides[ZEEntryPoint::zeModuleBuildLogDestroyPrologue] = !std::is_same<decltype(&TChecker::zeModuleBuildLogDestroyPrologue), decltype(&ZEValidationEntryPoints::zeModuleBuildLogDestroyPrologue)>::value;
+    overrides[ZEEntryPoint::zeModuleBuildLogDestroyEpilogue] = !std::is_same<decltype(&TChecker::zeModuleBuildLogDestroyEpilogue), decltype(&ZEValidationEntryPoints::zeModuleBuildLogDestroyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeModuleBuildLogGetStringPrologue] = !std::is_same<decltype(&TChecker::zeModuleBuildLogGetStringPrologue), decltype(&ZEValidationEntryPoints::zeModuleBuildLogGetStringPrologue)>::value;
+    overrides[ZEEntryPoint::zeModuleBuildLogGetStringEpilogue] = !std::is_same<decltype(&TChecker::zeModuleBuildLogGetStringEpilogue), decltype(&ZEValidationEntryPoints::zeModuleBuildLogGetStringEpilogue)>::value;
+    overrides[ZEEntryPoint::zeModuleGetNativeBinaryPrologue] = !std::is_same<decltype(&TChecker::zeModuleGetNativeBinaryPrologue), decltype(&ZEValidationEntryPoints::zeModuleGetNativeBinaryPrologue)>::value;
+    overrides[ZEEntryPoint::zeModuleGetNativeBinaryEpilogue] = !std::is_same<decltype(&TChecker::zeModuleGetNativeBinaryEpilogue), decltype(&ZEValidationEntryPoints::zeModuleGetNativeBinaryEpilogue)>::value;
+    overrides[ZEEntryPoint::zeModuleGetGlobalPointerPrologue] = !std::is_same<decltype(&TChecker::zeModuleGetGlobalPointerPrologue), decltype(&ZEValidationEntryPoints::zeModuleGetGlobalPointerPrologue)>::value;
+    overrides[ZEEntryPoint::zeModuleGetGlobalPointerEpilogue] = !std::is_same<decltype(&TChecker::zeModuleGetGlobalPointerEpilogue), decltype(&ZEValidationEntryPoints::zeModuleGetGlobalPointerEpilogue)>::value;
+    overrides[ZEEntryPoint::zeModuleGetKernelNamesPrologue] = !std::is_same<decltype(&TChecker::zeModuleGetKernelNamesPrologue), decltype(&ZEValidationEntryPoints::zeModuleGetKernelNamesPrologue)>::value;
+    overrides[ZEEntryPoint::zeModuleGetKernelNamesEpilogue] = !std::is_same<decltype(&TChecker::zeModuleGetKernelNamesEpilogue), decltype(&ZEValidationEntryPoints::zeModuleGetKernelNamesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeModuleGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeModuleGetPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeModuleGetPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeModuleGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeModuleGetPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeModuleGetPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelCreatePrologue] = !std::is_same<decltype(&TChecker::zeKernelCreatePrologue), decltype(&ZEValidationEntryPoints::zeKernelCreatePrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelCreateEpilogue] = !std::is_same<decltype(&TChecker::zeKernelCreateEpilogue), decltype(&ZEValidationEntryPoints::zeKernelCreateEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelDestroyPrologue] = !std::is_same<decltype(&TChecker::zeKernelDestroyPrologue), decltype(&ZEValidationEntryPoints::zeKernelDestroyPrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelDestroyEpilogue] = !std::is_same<decltype(&TChecker::zeKernelDestroyEpilogue), decltype(&ZEValidationEntryPoints::zeKernelDestroyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeModuleGetFunctionPointerPrologue] = !std::is_same<decltype(&TChecker::zeModuleGetFunctionPointerPrologue), decltype(&ZEValidationEntryPoints::zeModuleGetFunctionPointerPrologue)>::value;
+    overrides[ZEEntryPoint::zeModuleGetFunctionPointerEpilogue] = !std::is_same<decltype(&TChecker::zeModuleGetFunctionPointerEpilogue), decltype(&ZEValidationEntryPoints::zeModuleGetFunctionPointerEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelSetGroupSizePrologue] = !std::is_same<decltype(&TChecker::zeKernelSetGroupSizePrologue), decltype(&ZEValidationEntryPoints::zeKernelSetGroupSizePrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelSetGroupSizeEpilogue] = !std::is_same<decltype(&TChecker::zeKernelSetGroupSizeEpilogue), decltype(&ZEValidationEntryPoints::zeKernelSetGroupSizeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelSuggestGroupSizePrologue] = !std::is_same<decltype(&TChecker::zeKernelSuggestGroupSizePrologue), decltype(&ZEValidationEntryPoints::zeKernelSuggestGroupSizePrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelSuggestGroupSizeEpilogue] = !std::is_same<decltype(&TChecker::zeKernelSuggestGroupSizeEpilogue), decltype(&ZEValidationEntryPoints::zeKernelSuggestGroupSizeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelSuggestMaxCooperativeGroupCountPrologue] = !std::is_same<decltype(&TChecker::zeKernelSuggestMaxCooperativeGroupCountPrologue), decltype(&ZEValidationEntryPoints::zeKernelSuggestMaxCooperativeGroupCountPrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelSuggestMaxCooperativeGroupCountEpilogue] = !std::is_same<decltype(&TChecker::zeKernelSuggestMaxCooperativeGroupCountEpilogue), decltype(&ZEValidationEntryPoints::zeKernelSuggestMaxCooperativeGroupCountEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelSetArgumentValuePrologue] = !std::is_same<decltype(&TChecker::zeKernelSetArgumentValuePrologue), decltype(&ZEValidationEntryPoints::zeKernelSetArgumentValuePrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelSetArgumentValueEpilogue] = !std::is_same<decltype(&TChecker::zeKernelSetArgumentValueEpilogue), decltype(&ZEValidationEntryPoints::zeKernelSetArgumentValueEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelSetIndirectAccessPrologue] = !std::is_same<decltype(&TChecker::zeKernelSetIndirectAccessPrologue), decltype(&ZEValidationEntryPoints::zeKernelSetIndirectAccessPrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelSetIndirectAccessEpilogue] = !std::is_same<decltype(&TChecker::zeKernelSetIndirectAccessEpilogue), decltype(&ZEValidationEntryPoints::zeKernelSetIndirectAccessEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelGetIndirectAccessPrologue] = !std::is_same<decltype(&TChecker::zeKernelGetIndirectAccessPrologue), decltype(&ZEValidationEntryPoints::zeKernelGetIndirectAccessPrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelGetIndirectAccessEpilogue] = !std::is_same<decltype(&TChecker::zeKernelGetIndirectAccessEpilogue), decltype(&ZEValidationEntryPoints::zeKernelGetIndirectAccessEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelGetSourceAttributesPrologue] = !std::is_same<decltype(&TChecker::zeKernelGetSourceAttributesPrologue), decltype(&ZEValidationEntryPoints::zeKernelGetSourceAttributesPrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelGetSourceAttributesEpilogue] = !std::is_same<decltype(&TChecker::zeKernelGetSourceAttributesEpilogue), decltype(&ZEValidationEntryPoints::zeKernelGetSourceAttributesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelSetCacheConfigPrologue] = !std::is_same<decltype(&TChecker::zeKernelSetCacheConfigPrologue), decltype(&ZEValidationEntryPoints::zeKernelSetCacheConfigPrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelSetCacheConfigEpilogue] = !std::is_same<decltype(&TChecker::zeKernelSetCacheConfigEpilogue), decltype(&ZEValidationEntryPoints::zeKernelSetCacheConfigEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zeKernelGetPropertiesPrologue), decltype(&ZEValidationEntryPoints::zeKernelGetPropertiesPrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zeKernelGetPropertiesEpilogue), decltype(&ZEValidationEntryPoints::zeKernelGetPropertiesEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelGetNamePrologue] = !std::is_same<decltype(&TChecker::zeKernelGetNamePrologue), decltype(&ZEValidationEntryPoints::zeKernelGetNamePrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelGetNameEpilogue] = !std::is_same<decltype(&TChecker::zeKernelGetNameEpilogue), decltype(&ZEValidationEntryPoints::zeKernelGetNameEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendLaunchKernelPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendLaunchKernelPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendLaunchKernelPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendLaunchKernelEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendLaunchKernelEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendLaunchKernelEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendLaunchCooperativeKernelPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendLaunchCooperativeKernelPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendLaunchCooperativeKernelPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendLaunchCooperativeKernelEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendLaunchCooperativeKernelEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendLaunchCooperativeKernelEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendLaunchKernelIndirectPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendLaunchKernelIndirectPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendLaunchKernelIndirectPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendLaunchKernelIndirectEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendLaunchKernelIndirectEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendLaunchKernelIndirectEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendLaunchMultipleKernelsIndirectPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendLaunchMultipleKernelsIndirectPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendLaunchMultipleKernelsIndirectPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue)>::value;
+    overrides[ZEEntryPoint::zeContextMakeMemoryResidentPrologue] = !std::is_same<decltype(&TChecker::zeContextMakeMemoryResidentPrologue), decltype(&ZEValidationEntryPoints::zeContextMakeMemoryResidentPrologue)>::value;
+    overrides[ZEEntryPoint::zeContextMakeMemoryResidentEpilogue] = !std::is_same<decltype(&TChecker::zeContextMakeMemoryResidentEpilogue), decltype(&ZEValidationEntryPoints::zeContextMakeMemoryResidentEpilogue)>::value;
+    overrides[ZEEntryPoint::zeContextEvictMemoryPrologue] = !std::is_same<decltype(&TChecker::zeContextEvictMemoryPrologue), decltype(&ZEValidationEntryPoints::zeContextEvictMemoryPrologue)>::value;
+    overrides[ZEEntryPoint::zeContextEvictMemoryEpilogue] = !std::is_same<decltype(&TChecker::zeContextEvictMemoryEpilogue), decltype(&ZEValidationEntryPoints::zeContextEvictMemoryEpilogue)>::value;
+    overrides[ZEEntryPoint::zeContextMakeImageResidentPrologue] = !std::is_same<decltype(&TChecker::zeContextMakeImageResidentPrologue), decltype(&ZEValidationEntryPoints::zeContextMakeImageResidentPrologue)>::value;
+    overrides[ZEEntryPoint::zeContextMakeImageResidentEpilogue] = !std::is_same<decltype(&TChecker::zeContextMakeImageResidentEpilogue), decltype(&ZEValidationEntryPoints::zeContextMakeImageResidentEpilogue)>::value;
+    overrides[ZEEntryPoint::zeContextEvictImagePrologue] = !std::is_same<decltype(&TChecker::zeContextEvictImagePrologue), decltype(&ZEValidationEntryPoints::zeContextEvictImagePrologue)>::value;
+    overrides[ZEEntryPoint::zeContextEvictImageEpilogue] = !std::is_same<decltype(&TChecker::zeContextEvictImageEpilogue), decltype(&ZEValidationEntryPoints::zeContextEvictImageEpilogue)>::value;
+    overrides[ZEEntryPoint::zeSamplerCreatePrologue] = !std::is_same<decltype(&TChecker::zeSamplerCreatePrologue), decltype(&ZEValidationEntryPoints::zeSamplerCreatePrologue)>::value;
+    overrides[ZEEntryPoint::zeSamplerCreateEpilogue] = !std::is_same<decltype(&TChecker::zeSamplerCreateEpilogue), decltype(&ZEValidationEntryPoints::zeSamplerCreateEpilogue)>::value;
+    overrides[ZEEntryPoint::zeSamplerDestroyPrologue] = !std::is_same<decltype(&TChecker::zeSamplerDestroyPrologue), decltype(&ZEValidationEntryPoints::zeSamplerDestroyPrologue)>::value;
+    overrides[ZEEntryPoint::zeSamplerDestroyEpilogue] = !std::is_same<decltype(&TChecker::zeSamplerDestroyEpilogue), decltype(&ZEValidationEntryPoints::zeSamplerDestroyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemReservePrologue] = !std::is_same<decltype(&TChecker::zeVirtualMemReservePrologue), decltype(&ZEValidationEntryPoints::zeVirtualMemReservePrologue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemReserveEpilogue] = !std::is_same<decltype(&TChecker::zeVirtualMemReserveEpilogue), decltype(&ZEValidationEntryPoints::zeVirtualMemReserveEpilogue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemFreePrologue] = !std::is_same<decltype(&TChecker::zeVirtualMemFreePrologue), decltype(&ZEValidationEntryPoints::zeVirtualMemFreePrologue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemFreeEpilogue] = !std::is_same<decltype(&TChecker::zeVirtualMemFreeEpilogue), decltype(&ZEValidationEntryPoints::zeVirtualMemFreeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemQueryPageSizePrologue] = !std::is_same<decltype(&TChecker::zeVirtualMemQueryPageSizePrologue), decltype(&ZEValidationEntryPoints::zeVirtualMemQueryPageSizePrologue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemQueryPageSizeEpilogue] = !std::is_same<decltype(&TChecker::zeVirtualMemQueryPageSizeEpilogue), decltype(&ZEValidationEntryPoints::zeVirtualMemQueryPageSizeEpilogue)>::value;
+    overrides[ZEEntryPoint::zePhysicalMemCreatePrologue] = !std::is_same<decltype(&TChecker::zePhysicalMemCreatePrologue), decltype(&ZEValidationEntryPoints::zePhysicalMemCreatePrologue)>::value;
+    overrides[ZEEntryPoint::zePhysicalMemCreateEpilogue] = !std::is_same<decltype(&TChecker::zePhysicalMemCreateEpilogue), decltype(&ZEValidationEntryPoints::zePhysicalMemCreateEpilogue)>::value;
+    overrides[ZEEntryPoint::zePhysicalMemDestroyPrologue] = !std::is_same<decltype(&TChecker::zePhysicalMemDestroyPrologue), decltype(&ZEValidationEntryPoints::zePhysicalMemDestroyPrologue)>::value;
+    overrides[ZEEntryPoint::zePhysicalMemDestroyEpilogue] = !std::is_same<decltype(&TChecker::zePhysicalMemDestroyEpilogue), decltype(&ZEValidationEntryPoints::zePhysicalMemDestroyEpilogue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemMapPrologue] = !std::is_same<decltype(&TChecker::zeVirtualMemMapPrologue), decltype(&ZEValidationEntryPoints::zeVirtualMemMapPrologue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemMapEpilogue] = !std::is_same<decltype(&TChecker::zeVirtualMemMapEpilogue), decltype(&ZEValidationEntryPoints::zeVirtualMemMapEpilogue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemUnmapPrologue] = !std::is_same<decltype(&TChecker::zeVirtualMemUnmapPrologue), decltype(&ZEValidationEntryPoints::zeVirtualMemUnmapPrologue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemUnmapEpilogue] = !std::is_same<decltype(&TChecker::zeVirtualMemUnmapEpilogue), decltype(&ZEValidationEntryPoints::zeVirtualMemUnmapEpilogue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemSetAccessAttributePrologue] = !std::is_same<decltype(&TChecker::zeVirtualMemSetAccessAttributePrologue), decltype(&ZEValidationEntryPoints::zeVirtualMemSetAccessAttributePrologue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemSetAccessAttributeEpilogue] = !std::is_same<decltype(&TChecker::zeVirtualMemSetAccessAttributeEpilogue), decltype(&ZEValidationEntryPoints::zeVirtualMemSetAccessAttributeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemGetAccessAttributePrologue] = !std::is_same<decltype(&TChecker::zeVirtualMemGetAccessAttributePrologue), decltype(&ZEValidationEntryPoints::zeVirtualMemGetAccessAttributePrologue)>::value;
+    overrides[ZEEntryPoint::zeVirtualMemGetAccessAttributeEpilogue] = !std::is_same<decltype(&TChecker::zeVirtualMemGetAccessAttributeEpilogue), decltype(&ZEValidationEntryPoints::zeVirtualMemGetAccessAttributeEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelSetGlobalOffsetExpPrologue] = !std::is_same<decltype(&TChecker::zeKernelSetGlobalOffsetExpPrologue), decltype(&ZEValidationEntryPoints::zeKernelSetGlobalOffsetExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelSetGlobalOffsetExpEpilogue] = !std::is_same<decltype(&TChecker::zeKernelSetGlobalOffsetExpEpilogue), decltype(&ZEValidationEntryPoints::zeKernelSetGlobalOffsetExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListGetNextCommandIdExpPrologue] = !std::is_same<decltype(&TChecker::zeCommandListGetNextCommandIdExpPrologue), decltype(&ZEValidationEntryPoints::zeCommandListGetNextCommandIdExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListGetNextCommandIdExpEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListGetNextCommandIdExpEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListGetNextCommandIdExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListGetNextCommandIdWithKernelsExpPrologue] = !std::is_same<decltype(&TChecker::zeCommandListGetNextCommandIdWithKernelsExpPrologue), decltype(&ZEValidationEntryPoints::zeCommandListGetNextCommandIdWithKernelsExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListGetNextCommandIdWithKernelsExpEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListGetNextCommandIdWithKernelsExpEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListGetNextCommandIdWithKernelsExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListUpdateMutableCommandsExpPrologue] = !std::is_same<decltype(&TChecker::zeCommandListUpdateMutableCommandsExpPrologue), decltype(&ZEValidationEntryPoints::zeCommandListUpdateMutableCommandsExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListUpdateMutableCommandsExpEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListUpdateMutableCommandsExpEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListUpdateMutableCommandsExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListUpdateMutableCommandSignalEventExpPrologue] = !std::is_same<decltype(&TChecker::zeCommandListUpdateMutableCommandSignalEventExpPrologue), decltype(&ZEValidationEntryPoints::zeCommandListUpdateMutableCommandSignalEventExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListUpdateMutableCommandSignalEventExpEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListUpdateMutableCommandSignalEventExpEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListUpdateMutableCommandSignalEventExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListUpdateMutableCommandWaitEventsExpPrologue] = !std::is_same<decltype(&TChecker::zeCommandListUpdateMutableCommandWaitEventsExpPrologue), decltype(&ZEValidationEntryPoints::zeCommandListUpdateMutableCommandWaitEventsExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListUpdateMutableCommandWaitEventsExpEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListUpdateMutableCommandWaitEventsExpEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListUpdateMutableCommandWaitEventsExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListUpdateMutableCommandKernelsExpPrologue] = !std::is_same<decltype(&TChecker::zeCommandListUpdateMutableCommandKernelsExpPrologue), decltype(&ZEValidationEntryPoints::zeCommandListUpdateMutableCommandKernelsExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListUpdateMutableCommandKernelsExpEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListUpdateMutableCommandKernelsExpEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListUpdateMutableCommandKernelsExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceReserveCacheExtPrologue] = !std::is_same<decltype(&TChecker::zeDeviceReserveCacheExtPrologue), decltype(&ZEValidationEntryPoints::zeDeviceReserveCacheExtPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceReserveCacheExtEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceReserveCacheExtEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceReserveCacheExtEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceSetCacheAdviceExtPrologue] = !std::is_same<decltype(&TChecker::zeDeviceSetCacheAdviceExtPrologue), decltype(&ZEValidationEntryPoints::zeDeviceSetCacheAdviceExtPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceSetCacheAdviceExtEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceSetCacheAdviceExtEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceSetCacheAdviceExtEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventQueryTimestampsExpPrologue] = !std::is_same<decltype(&TChecker::zeEventQueryTimestampsExpPrologue), decltype(&ZEValidationEntryPoints::zeEventQueryTimestampsExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeEventQueryTimestampsExpEpilogue] = !std::is_same<decltype(&TChecker::zeEventQueryTimestampsExpEpilogue), decltype(&ZEValidationEntryPoints::zeEventQueryTimestampsExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeImageGetMemoryPropertiesExpPrologue] = !std::is_same<decltype(&TChecker::zeImageGetMemoryPropertiesExpPrologue), decltype(&ZEValidationEntryPoints::zeImageGetMemoryPropertiesExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeImageGetMemoryPropertiesExpEpilogue] = !std::is_same<decltype(&TChecker::zeImageGetMemoryPropertiesExpEpilogue), decltype(&ZEValidationEntryPoints::zeImageGetMemoryPropertiesExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeImageViewCreateExtPrologue] = !std::is_same<decltype(&TChecker::zeImageViewCreateExtPrologue), decltype(&ZEValidationEntryPoints::zeImageViewCreateExtPrologue)>::value;
+    overrides[ZEEntryPoint::zeImageViewCreateExtEpilogue] = !std::is_same<decltype(&TChecker::zeImageViewCreateExtEpilogue), decltype(&ZEValidationEntryPoints::zeImageViewCreateExtEpilogue)>::value;
+    overrides[ZEEntryPoint::zeImageViewCreateExpPrologue] = !std::is_same<decltype(&TChecker::zeImageViewCreateExpPrologue), decltype(&ZEValidationEntryPoints::zeImageViewCreateExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeImageViewCreateExpEpilogue] = !std::is_same<decltype(&TChecker::zeImageViewCreateExpEpilogue), decltype(&ZEValidationEntryPoints::zeImageViewCreateExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeKernelSchedulingHintExpPrologue] = !std::is_same<decltype(&TChecker::zeKernelSchedulingHintExpPrologue), decltype(&ZEValidationEntryPoints::zeKernelSchedulingHintExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeKernelSchedulingHintExpEpilogue] = !std::is_same<decltype(&TChecker::zeKernelSchedulingHintExpEpilogue), decltype(&ZEValidationEntryPoints::zeKernelSchedulingHintExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDevicePciGetPropertiesExtPrologue] = !std::is_same<decltype(&TChecker::zeDevicePciGetPropertiesExtPrologue), decltype(&ZEValidationEntryPoints::zeDevicePciGetPropertiesExtPrologue)>::value;
+    overrides[ZEEntryPoint::zeDevicePciGetPropertiesExtEpilogue] = !std::is_same<decltype(&TChecker::zeDevicePciGetPropertiesExtEpilogue), decltype(&ZEValidationEntryPoints::zeDevicePciGetPropertiesExtEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendImageCopyToMemoryExtPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendImageCopyToMemoryExtPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendImageCopyToMemoryExtPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendImageCopyToMemoryExtEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendImageCopyToMemoryExtEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendImageCopyToMemoryExtEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendImageCopyFromMemoryExtPrologue] = !std::is_same<decltype(&TChecker::zeCommandListAppendImageCopyFromMemoryExtPrologue), decltype(&ZEValidationEntryPoints::zeCommandListAppendImageCopyFromMemoryExtPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListAppendImageCopyFromMemoryExtEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListAppendImageCopyFromMemoryExtEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListAppendImageCopyFromMemoryExtEpilogue)>::value;
+    overrides[ZEEntryPoint::zeImageGetAllocPropertiesExtPrologue] = !std::is_same<decltype(&TChecker::zeImageGetAllocPropertiesExtPrologue), decltype(&ZEValidationEntryPoints::zeImageGetAllocPropertiesExtPrologue)>::value;
+    overrides[ZEEntryPoint::zeImageGetAllocPropertiesExtEpilogue] = !std::is_same<decltype(&TChecker::zeImageGetAllocPropertiesExtEpilogue), decltype(&ZEValidationEntryPoints::zeImageGetAllocPropertiesExtEpilogue)>::value;
+    overrides[ZEEntryPoint::zeModuleInspectLinkageExtPrologue] = !std::is_same<decltype(&TChecker::zeModuleInspectLinkageExtPrologue), decltype(&ZEValidationEntryPoints::zeModuleInspectLinkageExtPrologue)>::value;
+    overrides[ZEEntryPoint::zeModuleInspectLinkageExtEpilogue] = !std::is_same<decltype(&TChecker::zeModuleInspectLinkageExtEpilogue), decltype(&ZEValidationEntryPoints::zeModuleInspectLinkageExtEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemFreeExtPrologue] = !std::is_same<decltype(&TChecker::zeMemFreeExtPrologue), decltype(&ZEValidationEntryPoints::zeMemFreeExtPrologue)>::value;
+    overrides[ZEEntryPoint::zeMemFreeExtEpilogue] = !std::is_same<decltype(&TChecker::zeMemFreeExtEpilogue), decltype(&ZEValidationEntryPoints::zeMemFreeExtEpilogue)>::value;
+    overrides[ZEEntryPoint::zeFabricVertexGetExpPrologue] = !std::is_same<decltype(&TChecker::zeFabricVertexGetExpPrologue), decltype(&ZEValidationEntryPoints::zeFabricVertexGetExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeFabricVertexGetExpEpilogue] = !std::is_same<decltype(&TChecker::zeFabricVertexGetExpEpilogue), decltype(&ZEValidationEntryPoints::zeFabricVertexGetExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeFabricVertexGetSubVerticesExpPrologue] = !std::is_same<decltype(&TChecker::zeFabricVertexGetSubVerticesExpPrologue), decltype(&ZEValidationEntryPoints::zeFabricVertexGetSubVerticesExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeFabricVertexGetSubVerticesExpEpilogue] = !std::is_same<decltype(&TChecker::zeFabricVertexGetSubVerticesExpEpilogue), decltype(&ZEValidationEntryPoints::zeFabricVertexGetSubVerticesExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeFabricVertexGetPropertiesExpPrologue] = !std::is_same<decltype(&TChecker::zeFabricVertexGetPropertiesExpPrologue), decltype(&ZEValidationEntryPoints::zeFabricVertexGetPropertiesExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeFabricVertexGetPropertiesExpEpilogue] = !std::is_same<decltype(&TChecker::zeFabricVertexGetPropertiesExpEpilogue), decltype(&ZEValidationEntryPoints::zeFabricVertexGetPropertiesExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeFabricVertexGetDeviceExpPrologue] = !std::is_same<decltype(&TChecker::zeFabricVertexGetDeviceExpPrologue), decltype(&ZEValidationEntryPoints::zeFabricVertexGetDeviceExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeFabricVertexGetDeviceExpEpilogue] = !std::is_same<decltype(&TChecker::zeFabricVertexGetDeviceExpEpilogue), decltype(&ZEValidationEntryPoints::zeFabricVertexGetDeviceExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetFabricVertexExpPrologue] = !std::is_same<decltype(&TChecker::zeDeviceGetFabricVertexExpPrologue), decltype(&ZEValidationEntryPoints::zeDeviceGetFabricVertexExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeDeviceGetFabricVertexExpEpilogue] = !std::is_same<decltype(&TChecker::zeDeviceGetFabricVertexExpEpilogue), decltype(&ZEValidationEntryPoints::zeDeviceGetFabricVertexExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeFabricEdgeGetExpPrologue] = !std::is_same<decltype(&TChecker::zeFabricEdgeGetExpPrologue), decltype(&ZEValidationEntryPoints::zeFabricEdgeGetExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeFabricEdgeGetExpEpilogue] = !std::is_same<decltype(&TChecker::zeFabricEdgeGetExpEpilogue), decltype(&ZEValidationEntryPoints::zeFabricEdgeGetExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeFabricEdgeGetVerticesExpPrologue] = !std::is_same<decltype(&TChecker::zeFabricEdgeGetVerticesExpPrologue), decltype(&ZEValidationEntryPoints::zeFabricEdgeGetVerticesExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeFabricEdgeGetVerticesExpEpilogue] = !std::is_same<decltype(&TChecker::zeFabricEdgeGetVerticesExpEpilogue), decltype(&ZEValidationEntryPoints::zeFabricEdgeGetVerticesExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeFabricEdgeGetPropertiesExpPrologue] = !std::is_same<decltype(&TChecker::zeFabricEdgeGetPropertiesExpPrologue), decltype(&ZEValidationEntryPoints::zeFabricEdgeGetPropertiesExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeFabricEdgeGetPropertiesExpEpilogue] = !std::is_same<decltype(&TChecker::zeFabricEdgeGetPropertiesExpEpilogue), decltype(&ZEValidationEntryPoints::zeFabricEdgeGetPropertiesExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeEventQueryKernelTimestampsExtPrologue] = !std::is_same<decltype(&TChecker::zeEventQueryKernelTimestampsExtPrologue), decltype(&ZEValidationEntryPoints::zeEventQueryKernelTimestampsExtPrologue)>::value;
+    overrides[ZEEntryPoint::zeEventQueryKernelTimestampsExtEpilogue] = !std::is_same<decltype(&TChecker::zeEventQueryKernelTimestampsExtEpilogue), decltype(&ZEValidationEntryPoints::zeEventQueryKernelTimestampsExtEpilogue)>::value;
+    overrides[ZEEntryPoint::zeRTASBuilderCreateExpPrologue] = !std::is_same<decltype(&TChecker::zeRTASBuilderCreateExpPrologue), decltype(&ZEValidationEntryPoints::zeRTASBuilderCreateExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeRTASBuilderCreateExpEpilogue] = !std::is_same<decltype(&TChecker::zeRTASBuilderCreateExpEpilogue), decltype(&ZEValidationEntryPoints::zeRTASBuilderCreateExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeRTASBuilderGetBuildPropertiesExpPrologue] = !std::is_same<decltype(&TChecker::zeRTASBuilderGetBuildPropertiesExpPrologue), decltype(&ZEValidationEntryPoints::zeRTASBuilderGetBuildPropertiesExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeRTASBuilderGetBuildPropertiesExpEpilogue] = !std::is_same<decltype(&TChecker::zeRTASBuilderGetBuildPropertiesExpEpilogue), decltype(&ZEValidationEntryPoints::zeRTASBuilderGetBuildPropertiesExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeDriverRTASFormatCompatibilityCheckExpPrologue] = !std::is_same<decltype(&TChecker::zeDriverRTASFormatCompatibilityCheckExpPrologue), decltype(&ZEValidationEntryPoints::zeDriverRTASFormatCompatibilityCheckExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeDriverRTASFormatCompatibilityCheckExpEpilogue] = !std::is_same<decltype(&TChecker::zeDriverRTASFormatCompatibilityCheckExpEpilogue), decltype(&ZEValidationEntryPoints::zeDriverRTASFormatCompatibilityCheckExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeRTASBuilderBuildExpPrologue] = !std::is_same<decltype(&TChecker::zeRTASBuilderBuildExpPrologue), decltype(&ZEValidationEntryPoints::zeRTASBuilderBuildExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeRTASBuilderBuildExpEpilogue] = !std::is_same<decltype(&TChecker::zeRTASBuilderBuildExpEpilogue), decltype(&ZEValidationEntryPoints::zeRTASBuilderBuildExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeRTASBuilderDestroyExpPrologue] = !std::is_same<decltype(&TChecker::zeRTASBuilderDestroyExpPrologue), decltype(&ZEValidationEntryPoints::zeRTASBuilderDestroyExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeRTASBuilderDestroyExpEpilogue] = !std::is_same<decltype(&TChecker::zeRTASBuilderDestroyExpEpilogue), decltype(&ZEValidationEntryPoints::zeRTASBuilderDestroyExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeRTASParallelOperationCreateExpPrologue] = !std::is_same<decltype(&TChecker::zeRTASParallelOperationCreateExpPrologue), decltype(&ZEValidationEntryPoints::zeRTASParallelOperationCreateExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeRTASParallelOperationCreateExpEpilogue] = !std::is_same<decltype(&TChecker::zeRTASParallelOperationCreateExpEpilogue), decltype(&ZEValidationEntryPoints::zeRTASParallelOperationCreateExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeRTASParallelOperationGetPropertiesExpPrologue] = !std::is_same<decltype(&TChecker::zeRTASParallelOperationGetPropertiesExpPrologue), decltype(&ZEValidationEntryPoints::zeRTASParallelOperationGetPropertiesExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeRTASParallelOperationGetPropertiesExpEpilogue] = !std::is_same<decltype(&TChecker::zeRTASParallelOperationGetPropertiesExpEpilogue), decltype(&ZEValidationEntryPoints::zeRTASParallelOperationGetPropertiesExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeRTASParallelOperationJoinExpPrologue] = !std::is_same<decltype(&TChecker::zeRTASParallelOperationJoinExpPrologue), decltype(&ZEValidationEntryPoints::zeRTASParallelOperationJoinExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeRTASParallelOperationJoinExpEpilogue] = !std::is_same<decltype(&TChecker::zeRTASParallelOperationJoinExpEpilogue), decltype(&ZEValidationEntryPoints::zeRTASParallelOperationJoinExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeRTASParallelOperationDestroyExpPrologue] = !std::is_same<decltype(&TChecker::zeRTASParallelOperationDestroyExpPrologue), decltype(&ZEValidationEntryPoints::zeRTASParallelOperationDestroyExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeRTASParallelOperationDestroyExpEpilogue] = !std::is_same<decltype(&TChecker::zeRTASParallelOperationDestroyExpEpilogue), decltype(&ZEValidationEntryPoints::zeRTASParallelOperationDestroyExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeMemGetPitchFor2dImagePrologue] = !std::is_same<decltype(&TChecker::zeMemGetPitchFor2dImagePrologue), decltype(&ZEValidationEntryPoints::zeMemGetPitchFor2dImagePrologue)>::value;
+    overrides[ZEEntryPoint::zeMemGetPitchFor2dImageEpilogue] = !std::is_same<decltype(&TChecker::zeMemGetPitchFor2dImageEpilogue), decltype(&ZEValidationEntryPoints::zeMemGetPitchFor2dImageEpilogue)>::value;
+    overrides[ZEEntryPoint::zeImageGetDeviceOffsetExpPrologue] = !std::is_same<decltype(&TChecker::zeImageGetDeviceOffsetExpPrologue), decltype(&ZEValidationEntryPoints::zeImageGetDeviceOffsetExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeImageGetDeviceOffsetExpEpilogue] = !std::is_same<decltype(&TChecker::zeImageGetDeviceOffsetExpEpilogue), decltype(&ZEValidationEntryPoints::zeImageGetDeviceOffsetExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListCreateCloneExpPrologue] = !std::is_same<decltype(&TChecker::zeCommandListCreateCloneExpPrologue), decltype(&ZEValidationEntryPoints::zeCommandListCreateCloneExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListCreateCloneExpEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListCreateCloneExpEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListCreateCloneExpEpilogue)>::value;
+    overrides[ZEEntryPoint::zeCommandListImmediateAppendCommandListsExpPrologue] = !std::is_same<decltype(&TChecker::zeCommandListImmediateAppendCommandListsExpPrologue), decltype(&ZEValidationEntryPoints::zeCommandListImmediateAppendCommandListsExpPrologue)>::value;
+    overrides[ZEEntryPoint::zeCommandListImmediateAppendCommandListsExpEpilogue] = !std::is_same<decltype(&TChecker::zeCommandListImmediateAppendCommandListsExpEpilogue), decltype(&ZEValidationEntryPoints::zeCommandListImmediateAppendCommandListsExpEpilogue)>::value;
+    return overrides;
+}
 }
\ No newline at end of file
@@ -11,6 +11,9 @@
  */
 #pragma once
 #include "zes_api.h"
+#include <bitset>
+#include <cstdint>
+#include <type_traits>
 
 namespace validation_layer
 {
@@ -18,301 +21,908 @@ namespace validation_layer
 class ZESValidationEntryPoints {
 public:
     virtual ze_result_t zesInitPrologue( zes_init_flags_t flags ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesInitEpilogue( zes_init_flags_t flags ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesInitEpilogue( zes_init_flags_t flags, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDriverGetPrologue( uint32_t* pCount, zes_driver_handle_t* phDrivers ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDriverGetEpilogue( uint32_t* pCount, zes_driver_handle_t* phDrivers ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDriverGetEpilogue( uint32_t* pCount, zes_driver_handle_t* phDrivers, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDriverGetExtensionPropertiesPrologue( zes_driver_handle_t hDriver, uint32_t* pCount, zes_driver_extension_properties_t* pExtensionProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDriverGetExtensionPropertiesEpilogue( zes_driver_handle_t hDriver, uint32_t* pCount, zes_driver_extension_properties_t* pExtensionProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDriverGetExtensionPropertiesEpilogue( zes_driver_handle_t hDriver, uint32_t* pCount, zes_driver_extension_properties_t* pExtensionProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDriverGetExtensionFunctionAddressPrologue( zes_driver_handle_t hDriver, const char* name, void** ppFunctionAddress ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDriverGetExtensionFunctionAddressEpilogue( zes_driver_handle_t hDriver, const char* name, void** ppFunctionAddress ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDriverGetExtensionFunctionAddressEpilogue( zes_driver_handle_t hDriver, const char* name, void** ppFunctionAddress, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceGetPrologue( zes_driver_handle_t hDriver, uint32_t* pCount, zes_device_handle_t* phDevices ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceGetEpilogue( zes_driver_handle_t hDriver, uint32_t* pCount, zes_device_handle_t* phDevices ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceGetEpilogue( zes_driver_handle_t hDriver, uint32_t* pCount, zes_device_handle_t* phDevices, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceGetPropertiesPrologue( zes_device_handle_t hDevice, zes_device_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceGetPropertiesEpilogue( zes_device_handle_t hDevice, zes_device_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceGetPropertiesEpilogue( zes_device_handle_t hDevice, zes_device_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceGetStatePrologue( zes_device_handle_t hDevice, zes_device_state_t* pState ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceGetStateEpilogue( zes_device_handle_t hDevice, zes_device_state_t* pState ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceGetStateEpilogue( zes_device_handle_t hDevice, zes_device_state_t* pState, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceResetPrologue( zes_device_handle_t hDevice, ze_bool_t force ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceResetEpilogue( zes_device_handle_t hDevice, ze_bool_t force ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceResetEpilogue( zes_device_handle_t hDevice, ze_bool_t force, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceResetExtPrologue( zes_device_handle_t hDevice, zes_reset_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceResetExtEpilogue( zes_device_handle_t hDevice, zes_reset_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceResetExtEpilogue( zes_device_handle_t hDevice, zes_reset_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceProcessesGetStatePrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_process_state_t* pProcesses ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceProcessesGetStateEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_process_state_t* pProcesses ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceProcessesGetStateEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_process_state_t* pProcesses, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDevicePciGetPropertiesPrologue( zes_device_handle_t hDevice, zes_pci_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDevicePciGetPropertiesEpilogue( zes_device_handle_t hDevice, zes_pci_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDevicePciGetPropertiesEpilogue( zes_device_handle_t hDevice, zes_pci_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDevicePciGetStatePrologue( zes_device_handle_t hDevice, zes_pci_state_t* pState ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDevicePciGetStateEpilogue( zes_device_handle_t hDevice, zes_pci_state_t* pState ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDevicePciGetStateEpilogue( zes_device_handle_t hDevice, zes_pci_state_t* pState, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDevicePciGetBarsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_pci_bar_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDevicePciGetBarsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_pci_bar_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDevicePciGetBarsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_pci_bar_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDevicePciGetStatsPrologue( zes_device_handle_t hDevice, zes_pci_stats_t* pStats ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDevicePciGetStatsEpilogue( zes_device_handle_t hDevice, zes_pci_stats_t* pStats ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDevicePciGetStatsEpilogue( zes_device_handle_t hDevice, zes_pci_stats_t* pStats, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceSetOverclockWaiverPrologue( zes_device_handle_t hDevice ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceSetOverclockWaiverEpilogue( zes_device_handle_t hDevice ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceSetOverclockWaiverEpilogue( zes_device_handle_t hDevice, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceGetOverclockDomainsPrologue( zes_device_handle_t hDevice, uint32_t* pOverclockDomains ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceGetOverclockDomainsEpilogue( zes_device_handle_t hDevice, uint32_t* pOverclockDomains ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceGetOverclockDomainsEpilogue( zes_device_handle_t hDevice, uint32_t* pOverclockDomains, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceGetOverclockControlsPrologue( zes_device_handle_t hDevice, zes_overclock_domain_t domainType, uint32_t* pAvailableControls ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceGetOverclockControlsEpilogue( zes_device_handle_t hDevice, zes_overclock_domain_t domainType, uint32_t* pAvailableControls ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceGetOverclockControlsEpilogue( zes_device_handle_t hDevice, zes_overclock_domain_t domainType, uint32_t* pAvailableControls, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceResetOverclockSettingsPrologue( zes_device_handle_t hDevice, ze_bool_t onShippedState ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceResetOverclockSettingsEpilogue( zes_device_handle_t hDevice, ze_bool_t onShippedState ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceResetOverclockSettingsEpilogue( zes_device_handle_t hDevice, ze_bool_t onShippedState, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceReadOverclockStatePrologue( zes_device_handle_t hDevice, zes_overclock_mode_t* pOverclockMode, ze_bool_t* pWaiverSetting, ze_bool_t* pOverclockState, zes_pending_action_t* pPendingAction, ze_bool_t* pPendingReset ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceReadOverclockStateEpilogue( zes_device_handle_t hDevice, zes_overclock_mode_t* pOverclockMode, ze_bool_t* pWaiverSetting, ze_bool_t* pOverclockState, zes_pending_action_t* pPendingAction, ze_bool_t* pPendingReset ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceReadOverclockStateEpilogue( zes_device_handle_t hDevice, zes_overclock_mode_t* pOverclockMode, ze_bool_t* pWaiverSetting, ze_bool_t* pOverclockState, zes_pending_action_t* pPendingAction, ze_bool_t* pPendingReset, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumOverclockDomainsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_overclock_handle_t* phDomainHandle ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumOverclockDomainsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_overclock_handle_t* phDomainHandle ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumOverclockDomainsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_overclock_handle_t* phDomainHandle, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesOverclockGetDomainPropertiesPrologue( zes_overclock_handle_t hDomainHandle, zes_overclock_properties_t* pDomainProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesOverclockGetDomainPropertiesEpilogue( zes_overclock_handle_t hDomainHandle, zes_overclock_properties_t* pDomainProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesOverclockGetDomainPropertiesEpilogue( zes_overclock_handle_t hDomainHandle, zes_overclock_properties_t* pDomainProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesOverclockGetDomainVFPropertiesPrologue( zes_overclock_handle_t hDomainHandle, zes_vf_property_t* pVFProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesOverclockGetDomainVFPropertiesEpilogue( zes_overclock_handle_t hDomainHandle, zes_vf_property_t* pVFProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesOverclockGetDomainVFPropertiesEpilogue( zes_overclock_handle_t hDomainHandle, zes_vf_property_t* pVFProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesOverclockGetDomainControlPropertiesPrologue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, zes_control_property_t* pControlProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesOverclockGetDomainControlPropertiesEpilogue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, zes_control_property_t* pControlProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesOverclockGetDomainControlPropertiesEpilogue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, zes_control_property_t* pControlProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesOverclockGetControlCurrentValuePrologue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double* pValue ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesOverclockGetControlCurrentValueEpilogue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double* pValue ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesOverclockGetControlCurrentValueEpilogue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double* pValue, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesOverclockGetControlPendingValuePrologue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double* pValue ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesOverclockGetControlPendingValueEpilogue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double* pValue ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesOverclockGetControlPendingValueEpilogue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double* pValue, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesOverclockSetControlUserValuePrologue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double pValue, zes_pending_action_t* pPendingAction ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesOverclockSetControlUserValueEpilogue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double pValue, zes_pending_action_t* pPendingAction ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesOverclockSetControlUserValueEpilogue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double pValue, zes_pending_action_t* pPendingAction, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesOverclockGetControlStatePrologue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, zes_control_state_t* pControlState, zes_pending_action_t* pPendingAction ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesOverclockGetControlStateEpilogue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, zes_control_state_t* pControlState, zes_pending_action_t* pPendingAction ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesOverclockGetControlStateEpilogue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, zes_control_state_t* pControlState, zes_pending_action_t* pPendingAction, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesOverclockGetVFPointValuesPrologue( zes_overclock_handle_t hDomainHandle, zes_vf_type_t VFType, zes_vf_array_type_t VFArrayType, uint32_t PointIndex, uint32_t* PointValue ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesOverclockGetVFPointValuesEpilogue( zes_overclock_handle_t hDomainHandle, zes_vf_type_t VFType, zes_vf_array_type_t VFArrayType, uint32_t PointIndex, uint32_t* PointValue ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesOverclockGetVFPointValuesEpilogue( zes_overclock_handle_t hDomainHandle, zes_vf_type_t VFType, zes_vf_array_type_t VFArrayType, uint32_t PointIndex, uint32_t* PointValue, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesOverclockSetVFPointValuesPrologue( zes_overclock_handle_t hDomainHandle, zes_vf_type_t VFType, uint32_t PointIndex, uint32_t PointValue ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesOverclockSetVFPointValuesEpilogue( zes_overclock_handle_t hDomainHandle, zes_vf_type_t VFType, uint32_t PointIndex, uint32_t PointValue ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesOverclockSetVFPointValuesEpilogue( zes_overclock_handle_t hDomainHandle, zes_vf_type_t VFType, uint32_t PointIndex, uint32_t PointValue, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumDiagnosticTestSuitesPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_diag_handle_t* phDiagnostics ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumDiagnosticTestSuitesEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_diag_handle_t* phDiagnostics ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumDiagnosticTestSuitesEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_diag_handle_t* phDiagnostics, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDiagnosticsGetPropertiesPrologue( zes_diag_handle_t hDiagnostics, zes_diag_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDiagnosticsGetPropertiesEpilogue( zes_diag_handle_t hDiagnostics, zes_diag_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDiagnosticsGetPropertiesEpilogue( zes_diag_handle_t hDiagnostics, zes_diag_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDiagnosticsGetTestsPrologue( zes_diag_handle_t hDiagnostics, uint32_t* pCount, zes_diag_test_t* pTests ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDiagnosticsGetTestsEpilogue( zes_diag_handle_t hDiagnostics, uint32_t* pCount, zes_diag_test_t* pTests ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDiagnosticsGetTestsEpilogue( zes_diag_handle_t hDiagnostics, uint32_t* pCount, zes_diag_test_t* pTests, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDiagnosticsRunTestsPrologue( zes_diag_handle_t hDiagnostics, uint32_t startIndex, uint32_t endIndex, zes_diag_result_t* pResult ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDiagnosticsRunTestsEpilogue( zes_diag_handle_t hDiagnostics, uint32_t startIndex, uint32_t endIndex, zes_diag_result_t* pResult ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDiagnosticsRunTestsEpilogue( zes_diag_handle_t hDiagnostics, uint32_t startIndex, uint32_t endIndex, zes_diag_result_t* pResult, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEccAvailablePrologue( zes_device_handle_t hDevice, ze_bool_t* pAvailable ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEccAvailableEpilogue( zes_device_handle_t hDevice, ze_bool_t* pAvailable ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEccAvailableEpilogue( zes_device_handle_t hDevice, ze_bool_t* pAvailable, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEccConfigurablePrologue( zes_device_handle_t hDevice, ze_bool_t* pConfigurable ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEccConfigurableEpilogue( zes_device_handle_t hDevice, ze_bool_t* pConfigurable ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEccConfigurableEpilogue( zes_device_handle_t hDevice, ze_bool_t* pConfigurable, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceGetEccStatePrologue( zes_device_handle_t hDevice, zes_device_ecc_properties_t* pState ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceGetEccStateEpilogue( zes_device_handle_t hDevice, zes_device_ecc_properties_t* pState ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceGetEccStateEpilogue( zes_device_handle_t hDevice, zes_device_ecc_properties_t* pState, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceSetEccStatePrologue( zes_device_handle_t hDevice, const zes_device_ecc_desc_t* newState, zes_device_ecc_properties_t* pState ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceSetEccStateEpilogue( zes_device_handle_t hDevice, const zes_device_ecc_desc_t* newState, zes_device_ecc_properties_t* pState ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceSetEccStateEpilogue( zes_device_handle_t hDevice, const zes_device_ecc_desc_t* newState, zes_device_ecc_properties_t* pState, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumEngineGroupsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_engine_handle_t* phEngine ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumEngineGroupsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_engine_handle_t* phEngine ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumEngineGroupsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_engine_handle_t* phEngine, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesEngineGetPropertiesPrologue( zes_engine_handle_t hEngine, zes_engine_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesEngineGetPropertiesEpilogue( zes_engine_handle_t hEngine, zes_engine_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesEngineGetPropertiesEpilogue( zes_engine_handle_t hEngine, zes_engine_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesEngineGetActivityPrologue( zes_engine_handle_t hEngine, zes_engine_stats_t* pStats ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesEngineGetActivityEpilogue( zes_engine_handle_t hEngine, zes_engine_stats_t* pStats ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesEngineGetActivityEpilogue( zes_engine_handle_t hEngine, zes_engine_stats_t* pStats, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEventRegisterPrologue( zes_device_handle_t hDevice, zes_event_type_flags_t events ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEventRegisterEpilogue( zes_device_handle_t hDevice, zes_event_type_flags_t events ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEventRegisterEpilogue( zes_device_handle_t hDevice, zes_event_type_flags_t events, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDriverEventListenPrologue( ze_driver_handle_t hDriver, uint32_t timeout, uint32_t count, zes_device_handle_t* phDevices, uint32_t* pNumDeviceEvents, zes_event_type_flags_t* pEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDriverEventListenEpilogue( ze_driver_handle_t hDriver, uint32_t timeout, uint32_t count, zes_device_handle_t* phDevices, uint32_t* pNumDeviceEvents, zes_event_type_flags_t* pEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDriverEventListenEpilogue( ze_driver_handle_t hDriver, uint32_t timeout, uint32_t count, zes_device_handle_t* phDevices, uint32_t* pNumDeviceEvents, zes_event_type_flags_t* pEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDriverEventListenExPrologue( ze_driver_handle_t hDriver, uint64_t timeout, uint32_t count, zes_device_handle_t* phDevices, uint32_t* pNumDeviceEvents, zes_event_type_flags_t* pEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDriverEventListenExEpilogue( ze_driver_handle_t hDriver, uint64_t timeout, uint32_t count, zes_device_handle_t* phDevices, uint32_t* pNumDeviceEvents, zes_event_type_flags_t* pEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDriverEventListenExEpilogue( ze_driver_handle_t hDriver, uint64_t timeout, uint32_t count, zes_device_handle_t* phDevices, uint32_t* pNumDeviceEvents, zes_event_type_flags_t* pEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumFabricPortsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_fabric_port_handle_t* phPort ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumFabricPortsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_fabric_port_handle_t* phPort ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumFabricPortsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_fabric_port_handle_t* phPort, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFabricPortGetPropertiesPrologue( zes_fabric_port_handle_t hPort, zes_fabric_port_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFabricPortGetPropertiesEpilogue( zes_fabric_port_handle_t hPort, zes_fabric_port_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFabricPortGetPropertiesEpilogue( zes_fabric_port_handle_t hPort, zes_fabric_port_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFabricPortGetLinkTypePrologue( zes_fabric_port_handle_t hPort, zes_fabric_link_type_t* pLinkType ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFabricPortGetLinkTypeEpilogue( zes_fabric_port_handle_t hPort, zes_fabric_link_type_t* pLinkType ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFabricPortGetLinkTypeEpilogue( zes_fabric_port_handle_t hPort, zes_fabric_link_type_t* pLinkType, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFabricPortGetConfigPrologue( zes_fabric_port_handle_t hPort, zes_fabric_port_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFabricPortGetConfigEpilogue( zes_fabric_port_handle_t hPort, zes_fabric_port_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFabricPortGetConfigEpilogue( zes_fabric_port_handle_t hPort, zes_fabric_port_config_t* pConfig, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFabricPortSetConfigPrologue( zes_fabric_port_handle_t hPort, const zes_fabric_port_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFabricPortSetConfigEpilogue( zes_fabric_port_handle_t hPort, const zes_fabric_port_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFabricPortSetConfigEpilogue( zes_fabric_port_handle_t hPort, const zes_fabric_port_config_t* pConfig, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFabricPortGetStatePrologue( zes_fabric_port_handle_t hPort, zes_fabric_port_state_t* pState ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFabricPortGetStateEpilogue( zes_fabric_port_handle_t hPort, zes_fabric_port_state_t* pState ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFabricPortGetStateEpilogue( zes_fabric_port_handle_t hPort, zes_fabric_port_state_t* pState, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFabricPortGetThroughputPrologue( zes_fabric_port_handle_t hPort, zes_fabric_port_throughput_t* pThroughput ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFabricPortGetThroughputEpilogue( zes_fabric_port_handle_t hPort, zes_fabric_port_throughput_t* pThroughput ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFabricPortGetThroughputEpilogue( zes_fabric_port_handle_t hPort, zes_fabric_port_throughput_t* pThroughput, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFabricPortGetFabricErrorCountersPrologue( zes_fabric_port_handle_t hPort, zes_fabric_port_error_counters_t* pErrors ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFabricPortGetFabricErrorCountersEpilogue( zes_fabric_port_handle_t hPort, zes_fabric_port_error_counters_t* pErrors ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFabricPortGetFabricErrorCountersEpilogue( zes_fabric_port_handle_t hPort, zes_fabric_port_error_counters_t* pErrors, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFabricPortGetMultiPortThroughputPrologue( zes_device_handle_t hDevice, uint32_t numPorts, zes_fabric_port_handle_t* phPort, zes_fabric_port_throughput_t** pThroughput ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFabricPortGetMultiPortThroughputEpilogue( zes_device_handle_t hDevice, uint32_t numPorts, zes_fabric_port_handle_t* phPort, zes_fabric_port_throughput_t** pThroughput ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFabricPortGetMultiPortThroughputEpilogue( zes_device_handle_t hDevice, uint32_t numPorts, zes_fabric_port_handle_t* phPort, zes_fabric_port_throughput_t** pThroughput, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumFansPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_fan_handle_t* phFan ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumFansEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_fan_handle_t* phFan ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumFansEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_fan_handle_t* phFan, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFanGetPropertiesPrologue( zes_fan_handle_t hFan, zes_fan_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFanGetPropertiesEpilogue( zes_fan_handle_t hFan, zes_fan_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFanGetPropertiesEpilogue( zes_fan_handle_t hFan, zes_fan_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFanGetConfigPrologue( zes_fan_handle_t hFan, zes_fan_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFanGetConfigEpilogue( zes_fan_handle_t hFan, zes_fan_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFanGetConfigEpilogue( zes_fan_handle_t hFan, zes_fan_config_t* pConfig, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFanSetDefaultModePrologue( zes_fan_handle_t hFan ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFanSetDefaultModeEpilogue( zes_fan_handle_t hFan ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFanSetDefaultModeEpilogue( zes_fan_handle_t hFan, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFanSetFixedSpeedModePrologue( zes_fan_handle_t hFan, const zes_fan_speed_t* speed ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFanSetFixedSpeedModeEpilogue( zes_fan_handle_t hFan, const zes_fan_speed_t* speed ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFanSetFixedSpeedModeEpilogue( zes_fan_handle_t hFan, const zes_fan_speed_t* speed, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFanSetSpeedTableModePrologue( zes_fan_handle_t hFan, const zes_fan_speed_table_t* speedTable ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFanSetSpeedTableModeEpilogue( zes_fan_handle_t hFan, const zes_fan_speed_table_t* speedTable ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFanSetSpeedTableModeEpilogue( zes_fan_handle_t hFan, const zes_fan_speed_table_t* speedTable, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFanGetStatePrologue( zes_fan_handle_t hFan, zes_fan_speed_units_t units, int32_t* pSpeed ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFanGetStateEpilogue( zes_fan_handle_t hFan, zes_fan_speed_units_t units, int32_t* pSpeed ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFanGetStateEpilogue( zes_fan_handle_t hFan, zes_fan_speed_units_t units, int32_t* pSpeed, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumFirmwaresPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_firmware_handle_t* phFirmware ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumFirmwaresEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_firmware_handle_t* phFirmware ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumFirmwaresEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_firmware_handle_t* phFirmware, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFirmwareGetPropertiesPrologue( zes_firmware_handle_t hFirmware, zes_firmware_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFirmwareGetPropertiesEpilogue( zes_firmware_handle_t hFirmware, zes_firmware_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFirmwareGetPropertiesEpilogue( zes_firmware_handle_t hFirmware, zes_firmware_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFirmwareFlashPrologue( zes_firmware_handle_t hFirmware, void* pImage, uint32_t size ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFirmwareFlashEpilogue( zes_firmware_handle_t hFirmware, void* pImage, uint32_t size ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFirmwareFlashEpilogue( zes_firmware_handle_t hFirmware, void* pImage, uint32_t size, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFirmwareGetFlashProgressPrologue( zes_firmware_handle_t hFirmware, uint32_t* pCompletionPercent ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFirmwareGetFlashProgressEpilogue( zes_firmware_handle_t hFirmware, uint32_t* pCompletionPercent ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFirmwareGetFlashProgressEpilogue( zes_firmware_handle_t hFirmware, uint32_t* pCompletionPercent, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFirmwareGetConsoleLogsPrologue( zes_firmware_handle_t hFirmware, size_t* pSize, char* pFirmwareLog ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFirmwareGetConsoleLogsEpilogue( zes_firmware_handle_t hFirmware, size_t* pSize, char* pFirmwareLog ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFirmwareGetConsoleLogsEpilogue( zes_firmware_handle_t hFirmware, size_t* pSize, char* pFirmwareLog, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumFrequencyDomainsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_freq_handle_t* phFrequency ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumFrequencyDomainsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_freq_handle_t* phFrequency ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumFrequencyDomainsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_freq_handle_t* phFrequency, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyGetPropertiesPrologue( zes_freq_handle_t hFrequency, zes_freq_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyGetPropertiesEpilogue( zes_freq_handle_t hFrequency, zes_freq_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyGetPropertiesEpilogue( zes_freq_handle_t hFrequency, zes_freq_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyGetAvailableClocksPrologue( zes_freq_handle_t hFrequency, uint32_t* pCount, double* phFrequency ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyGetAvailableClocksEpilogue( zes_freq_handle_t hFrequency, uint32_t* pCount, double* phFrequency ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyGetAvailableClocksEpilogue( zes_freq_handle_t hFrequency, uint32_t* pCount, double* phFrequency, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyGetRangePrologue( zes_freq_handle_t hFrequency, zes_freq_range_t* pLimits ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyGetRangeEpilogue( zes_freq_handle_t hFrequency, zes_freq_range_t* pLimits ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyGetRangeEpilogue( zes_freq_handle_t hFrequency, zes_freq_range_t* pLimits, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencySetRangePrologue( zes_freq_handle_t hFrequency, const zes_freq_range_t* pLimits ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencySetRangeEpilogue( zes_freq_handle_t hFrequency, const zes_freq_range_t* pLimits ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencySetRangeEpilogue( zes_freq_handle_t hFrequency, const zes_freq_range_t* pLimits, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyGetStatePrologue( zes_freq_handle_t hFrequency, zes_freq_state_t* pState ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyGetStateEpilogue( zes_freq_handle_t hFrequency, zes_freq_state_t* pState ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyGetStateEpilogue( zes_freq_handle_t hFrequency, zes_freq_state_t* pState, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyGetThrottleTimePrologue( zes_freq_handle_t hFrequency, zes_freq_throttle_time_t* pThrottleTime ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyGetThrottleTimeEpilogue( zes_freq_handle_t hFrequency, zes_freq_throttle_time_t* pThrottleTime ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyGetThrottleTimeEpilogue( zes_freq_handle_t hFrequency, zes_freq_throttle_time_t* pThrottleTime, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyOcGetCapabilitiesPrologue( zes_freq_handle_t hFrequency, zes_oc_capabilities_t* pOcCapabilities ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyOcGetCapabilitiesEpilogue( zes_freq_handle_t hFrequency, zes_oc_capabilities_t* pOcCapabilities ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyOcGetCapabilitiesEpilogue( zes_freq_handle_t hFrequency, zes_oc_capabilities_t* pOcCapabilities, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyOcGetFrequencyTargetPrologue( zes_freq_handle_t hFrequency, double* pCurrentOcFrequency ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyOcGetFrequencyTargetEpilogue( zes_freq_handle_t hFrequency, double* pCurrentOcFrequency ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyOcGetFrequencyTargetEpilogue( zes_freq_handle_t hFrequency, double* pCurrentOcFrequency, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyOcSetFrequencyTargetPrologue( zes_freq_handle_t hFrequency, double CurrentOcFrequency ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyOcSetFrequencyTargetEpilogue( zes_freq_handle_t hFrequency, double CurrentOcFrequency ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyOcSetFrequencyTargetEpilogue( zes_freq_handle_t hFrequency, double CurrentOcFrequency, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyOcGetVoltageTargetPrologue( zes_freq_handle_t hFrequency, double* pCurrentVoltageTarget, double* pCurrentVoltageOffset ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyOcGetVoltageTargetEpilogue( zes_freq_handle_t hFrequency, double* pCurrentVoltageTarget, double* pCurrentVoltageOffset ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyOcGetVoltageTargetEpilogue( zes_freq_handle_t hFrequency, double* pCurrentVoltageTarget, double* pCurrentVoltageOffset, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyOcSetVoltageTargetPrologue( zes_freq_handle_t hFrequency, double CurrentVoltageTarget, double CurrentVoltageOffset ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyOcSetVoltageTargetEpilogue( zes_freq_handle_t hFrequency, double CurrentVoltageTarget, double CurrentVoltageOffset ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyOcSetVoltageTargetEpilogue( zes_freq_handle_t hFrequency, double CurrentVoltageTarget, double CurrentVoltageOffset, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyOcSetModePrologue( zes_freq_handle_t hFrequency, zes_oc_mode_t CurrentOcMode ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyOcSetModeEpilogue( zes_freq_handle_t hFrequency, zes_oc_mode_t CurrentOcMode ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyOcSetModeEpilogue( zes_freq_handle_t hFrequency, zes_oc_mode_t CurrentOcMode, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyOcGetModePrologue( zes_freq_handle_t hFrequency, zes_oc_mode_t* pCurrentOcMode ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyOcGetModeEpilogue( zes_freq_handle_t hFrequency, zes_oc_mode_t* pCurrentOcMode ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyOcGetModeEpilogue( zes_freq_handle_t hFrequency, zes_oc_mode_t* pCurrentOcMode, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyOcGetIccMaxPrologue( zes_freq_handle_t hFrequency, double* pOcIccMax ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyOcGetIccMaxEpilogue( zes_freq_handle_t hFrequency, double* pOcIccMax ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyOcGetIccMaxEpilogue( zes_freq_handle_t hFrequency, double* pOcIccMax, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyOcSetIccMaxPrologue( zes_freq_handle_t hFrequency, double ocIccMax ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyOcSetIccMaxEpilogue( zes_freq_handle_t hFrequency, double ocIccMax ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyOcSetIccMaxEpilogue( zes_freq_handle_t hFrequency, double ocIccMax, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyOcGetTjMaxPrologue( zes_freq_handle_t hFrequency, double* pOcTjMax ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyOcGetTjMaxEpilogue( zes_freq_handle_t hFrequency, double* pOcTjMax ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyOcGetTjMaxEpilogue( zes_freq_handle_t hFrequency, double* pOcTjMax, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFrequencyOcSetTjMaxPrologue( zes_freq_handle_t hFrequency, double ocTjMax ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFrequencyOcSetTjMaxEpilogue( zes_freq_handle_t hFrequency, double ocTjMax ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFrequencyOcSetTjMaxEpilogue( zes_freq_handle_t hFrequency, double ocTjMax, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumLedsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_led_handle_t* phLed ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumLedsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_led_handle_t* phLed ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumLedsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_led_handle_t* phLed, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesLedGetPropertiesPrologue( zes_led_handle_t hLed, zes_led_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesLedGetPropertiesEpilogue( zes_led_handle_t hLed, zes_led_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesLedGetPropertiesEpilogue( zes_led_handle_t hLed, zes_led_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesLedGetStatePrologue( zes_led_handle_t hLed, zes_led_state_t* pState ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesLedGetStateEpilogue( zes_led_handle_t hLed, zes_led_state_t* pState ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesLedGetStateEpilogue( zes_led_handle_t hLed, zes_led_state_t* pState, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesLedSetStatePrologue( zes_led_handle_t hLed, ze_bool_t enable ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesLedSetStateEpilogue( zes_led_handle_t hLed, ze_bool_t enable ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesLedSetStateEpilogue( zes_led_handle_t hLed, ze_bool_t enable, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesLedSetColorPrologue( zes_led_handle_t hLed, const zes_led_color_t* pColor ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesLedSetColorEpilogue( zes_led_handle_t hLed, const zes_led_color_t* pColor ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesLedSetColorEpilogue( zes_led_handle_t hLed, const zes_led_color_t* pColor, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumMemoryModulesPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_mem_handle_t* phMemory ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumMemoryModulesEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_mem_handle_t* phMemory ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumMemoryModulesEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_mem_handle_t* phMemory, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesMemoryGetPropertiesPrologue( zes_mem_handle_t hMemory, zes_mem_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesMemoryGetPropertiesEpilogue( zes_mem_handle_t hMemory, zes_mem_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesMemoryGetPropertiesEpilogue( zes_mem_handle_t hMemory, zes_mem_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesMemoryGetStatePrologue( zes_mem_handle_t hMemory, zes_mem_state_t* pState ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesMemoryGetStateEpilogue( zes_mem_handle_t hMemory, zes_mem_state_t* pState ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesMemoryGetStateEpilogue( zes_mem_handle_t hMemory, zes_mem_state_t* pState, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesMemoryGetBandwidthPrologue( zes_mem_handle_t hMemory, zes_mem_bandwidth_t* pBandwidth ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesMemoryGetBandwidthEpilogue( zes_mem_handle_t hMemory, zes_mem_bandwidth_t* pBandwidth ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesMemoryGetBandwidthEpilogue( zes_mem_handle_t hMemory, zes_mem_bandwidth_t* pBandwidth, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumPerformanceFactorDomainsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_perf_handle_t* phPerf ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumPerformanceFactorDomainsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_perf_handle_t* phPerf ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumPerformanceFactorDomainsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_perf_handle_t* phPerf, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPerformanceFactorGetPropertiesPrologue( zes_perf_handle_t hPerf, zes_perf_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPerformanceFactorGetPropertiesEpilogue( zes_perf_handle_t hPerf, zes_perf_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPerformanceFactorGetPropertiesEpilogue( zes_perf_handle_t hPerf, zes_perf_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPerformanceFactorGetConfigPrologue( zes_perf_handle_t hPerf, double* pFactor ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPerformanceFactorGetConfigEpilogue( zes_perf_handle_t hPerf, double* pFactor ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPerformanceFactorGetConfigEpilogue( zes_perf_handle_t hPerf, double* pFactor, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPerformanceFactorSetConfigPrologue( zes_perf_handle_t hPerf, double factor ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPerformanceFactorSetConfigEpilogue( zes_perf_handle_t hPerf, double factor ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPerformanceFactorSetConfigEpilogue( zes_perf_handle_t hPerf, double factor, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumPowerDomainsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_pwr_handle_t* phPower ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumPowerDomainsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_pwr_handle_t* phPower ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumPowerDomainsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_pwr_handle_t* phPower, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceGetCardPowerDomainPrologue( zes_device_handle_t hDevice, zes_pwr_handle_t* phPower ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceGetCardPowerDomainEpilogue( zes_device_handle_t hDevice, zes_pwr_handle_t* phPower ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceGetCardPowerDomainEpilogue( zes_device_handle_t hDevice, zes_pwr_handle_t* phPower, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPowerGetPropertiesPrologue( zes_pwr_handle_t hPower, zes_power_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPowerGetPropertiesEpilogue( zes_pwr_handle_t hPower, zes_power_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPowerGetPropertiesEpilogue( zes_pwr_handle_t hPower, zes_power_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPowerGetEnergyCounterPrologue( zes_pwr_handle_t hPower, zes_power_energy_counter_t* pEnergy ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPowerGetEnergyCounterEpilogue( zes_pwr_handle_t hPower, zes_power_energy_counter_t* pEnergy ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPowerGetEnergyCounterEpilogue( zes_pwr_handle_t hPower, zes_power_energy_counter_t* pEnergy, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPowerGetLimitsPrologue( zes_pwr_handle_t hPower, zes_power_sustained_limit_t* pSustained, zes_power_burst_limit_t* pBurst, zes_power_peak_limit_t* pPeak ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPowerGetLimitsEpilogue( zes_pwr_handle_t hPower, zes_power_sustained_limit_t* pSustained, zes_power_burst_limit_t* pBurst, zes_power_peak_limit_t* pPeak ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPowerGetLimitsEpilogue( zes_pwr_handle_t hPower, zes_power_sustained_limit_t* pSustained, zes_power_burst_limit_t* pBurst, zes_power_peak_limit_t* pPeak, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPowerSetLimitsPrologue( zes_pwr_handle_t hPower, const zes_power_sustained_limit_t* pSustained, const zes_power_burst_limit_t* pBurst, const zes_power_peak_limit_t* pPeak ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPowerSetLimitsEpilogue( zes_pwr_handle_t hPower, const zes_power_sustained_limit_t* pSustained, const zes_power_burst_limit_t* pBurst, const zes_power_peak_limit_t* pPeak ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPowerSetLimitsEpilogue( zes_pwr_handle_t hPower, const zes_power_sustained_limit_t* pSustained, const zes_power_burst_limit_t* pBurst, const zes_power_peak_limit_t* pPeak, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPowerGetEnergyThresholdPrologue( zes_pwr_handle_t hPower, zes_energy_threshold_t* pThreshold ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPowerGetEnergyThresholdEpilogue( zes_pwr_handle_t hPower, zes_energy_threshold_t* pThreshold ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPowerGetEnergyThresholdEpilogue( zes_pwr_handle_t hPower, zes_energy_threshold_t* pThreshold, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPowerSetEnergyThresholdPrologue( zes_pwr_handle_t hPower, double threshold ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPowerSetEnergyThresholdEpilogue( zes_pwr_handle_t hPower, double threshold ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPowerSetEnergyThresholdEpilogue( zes_pwr_handle_t hPower, double threshold, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumPsusPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_psu_handle_t* phPsu ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumPsusEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_psu_handle_t* phPsu ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumPsusEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_psu_handle_t* phPsu, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPsuGetPropertiesPrologue( zes_psu_handle_t hPsu, zes_psu_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPsuGetPropertiesEpilogue( zes_psu_handle_t hPsu, zes_psu_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPsuGetPropertiesEpilogue( zes_psu_handle_t hPsu, zes_psu_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPsuGetStatePrologue( zes_psu_handle_t hPsu, zes_psu_state_t* pState ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPsuGetStateEpilogue( zes_psu_handle_t hPsu, zes_psu_state_t* pState ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPsuGetStateEpilogue( zes_psu_handle_t hPsu, zes_psu_state_t* pState, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumRasErrorSetsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_ras_handle_t* phRas ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumRasErrorSetsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_ras_handle_t* phRas ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumRasErrorSetsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_ras_handle_t* phRas, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesRasGetPropertiesPrologue( zes_ras_handle_t hRas, zes_ras_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesRasGetPropertiesEpilogue( zes_ras_handle_t hRas, zes_ras_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesRasGetPropertiesEpilogue( zes_ras_handle_t hRas, zes_ras_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesRasGetConfigPrologue( zes_ras_handle_t hRas, zes_ras_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesRasGetConfigEpilogue( zes_ras_handle_t hRas, zes_ras_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesRasGetConfigEpilogue( zes_ras_handle_t hRas, zes_ras_config_t* pConfig, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesRasSetConfigPrologue( zes_ras_handle_t hRas, const zes_ras_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesRasSetConfigEpilogue( zes_ras_handle_t hRas, const zes_ras_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesRasSetConfigEpilogue( zes_ras_handle_t hRas, const zes_ras_config_t* pConfig, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesRasGetStatePrologue( zes_ras_handle_t hRas, ze_bool_t clear, zes_ras_state_t* pState ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesRasGetStateEpilogue( zes_ras_handle_t hRas, ze_bool_t clear, zes_ras_state_t* pState ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesRasGetStateEpilogue( zes_ras_handle_t hRas, ze_bool_t clear, zes_ras_state_t* pState, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumSchedulersPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_sched_handle_t* phScheduler ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumSchedulersEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_sched_handle_t* phScheduler ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumSchedulersEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_sched_handle_t* phScheduler, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesSchedulerGetPropertiesPrologue( zes_sched_handle_t hScheduler, zes_sched_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesSchedulerGetPropertiesEpilogue( zes_sched_handle_t hScheduler, zes_sched_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesSchedulerGetPropertiesEpilogue( zes_sched_handle_t hScheduler, zes_sched_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesSchedulerGetCurrentModePrologue( zes_sched_handle_t hScheduler, zes_sched_mode_t* pMode ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesSchedulerGetCurrentModeEpilogue( zes_sched_handle_t hScheduler, zes_sched_mode_t* pMode ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesSchedulerGetCurrentModeEpilogue( zes_sched_handle_t hScheduler, zes_sched_mode_t* pMode, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesSchedulerGetTimeoutModePropertiesPrologue( zes_sched_handle_t hScheduler, ze_bool_t getDefaults, zes_sched_timeout_properties_t* pConfig ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesSchedulerGetTimeoutModePropertiesEpilogue( zes_sched_handle_t hScheduler, ze_bool_t getDefaults, zes_sched_timeout_properties_t* pConfig ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesSchedulerGetTimeoutModePropertiesEpilogue( zes_sched_handle_t hScheduler, ze_bool_t getDefaults, zes_sched_timeout_properties_t* pConfig, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesSchedulerGetTimesliceModePropertiesPrologue( zes_sched_handle_t hScheduler, ze_bool_t getDefaults, zes_sched_timeslice_properties_t* pConfig ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesSchedulerGetTimesliceModePropertiesEpilogue( zes_sched_handle_t hScheduler, ze_bool_t getDefaults, zes_sched_timeslice_properties_t* pConfig ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesSchedulerGetTimesliceModePropertiesEpilogue( zes_sched_handle_t hScheduler, ze_bool_t getDefaults, zes_sched_timeslice_properties_t* pConfig, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesSchedulerSetTimeoutModePrologue( zes_sched_handle_t hScheduler, zes_sched_timeout_properties_t* pProperties, ze_bool_t* pNeedReload ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesSchedulerSetTimeoutModeEpilogue( zes_sched_handle_t hScheduler, zes_sched_timeout_properties_t* pProperties, ze_bool_t* pNeedReload ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesSchedulerSetTimeoutModeEpilogue( zes_sched_handle_t hScheduler, zes_sched_timeout_properties_t* pProperties, ze_bool_t* pNeedReload, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesSchedulerSetTimesliceModePrologue( zes_sched_handle_t hScheduler, zes_sched_timeslice_properties_t* pProperties, ze_bool_t* pNeedReload ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesSchedulerSetTimesliceModeEpilogue( zes_sched_handle_t hScheduler, zes_sched_timeslice_properties_t* pProperties, ze_bool_t* pNeedReload ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesSchedulerSetTimesliceModeEpilogue( zes_sched_handle_t hScheduler, zes_sched_timeslice_properties_t* pProperties, ze_bool_t* pNeedReload, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesSchedulerSetExclusiveModePrologue( zes_sched_handle_t hScheduler, ze_bool_t* pNeedReload ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesSchedulerSetExclusiveModeEpilogue( zes_sched_handle_t hScheduler, ze_bool_t* pNeedReload ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesSchedulerSetExclusiveModeEpilogue( zes_sched_handle_t hScheduler, ze_bool_t* pNeedReload, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesSchedulerSetComputeUnitDebugModePrologue( zes_sched_handle_t hScheduler, ze_bool_t* pNeedReload ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesSchedulerSetComputeUnitDebugModeEpilogue( zes_sched_handle_t hScheduler, ze_bool_t* pNeedReload ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesSchedulerSetComputeUnitDebugModeEpilogue( zes_sched_handle_t hScheduler, ze_bool_t* pNeedReload, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumStandbyDomainsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_standby_handle_t* phStandby ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumStandbyDomainsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_standby_handle_t* phStandby ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumStandbyDomainsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_standby_handle_t* phStandby, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesStandbyGetPropertiesPrologue( zes_standby_handle_t hStandby, zes_standby_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesStandbyGetPropertiesEpilogue( zes_standby_handle_t hStandby, zes_standby_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesStandbyGetPropertiesEpilogue( zes_standby_handle_t hStandby, zes_standby_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesStandbyGetModePrologue( zes_standby_handle_t hStandby, zes_standby_promo_mode_t* pMode ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesStandbyGetModeEpilogue( zes_standby_handle_t hStandby, zes_standby_promo_mode_t* pMode ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesStandbyGetModeEpilogue( zes_standby_handle_t hStandby, zes_standby_promo_mode_t* pMode, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesStandbySetModePrologue( zes_standby_handle_t hStandby, zes_standby_promo_mode_t mode ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesStandbySetModeEpilogue( zes_standby_handle_t hStandby, zes_standby_promo_mode_t mode ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesStandbySetModeEpilogue( zes_standby_handle_t hStandby, zes_standby_promo_mode_t mode, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumTemperatureSensorsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_temp_handle_t* phTemperature ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumTemperatureSensorsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_temp_handle_t* phTemperature ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumTemperatureSensorsEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_temp_handle_t* phTemperature, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesTemperatureGetPropertiesPrologue( zes_temp_handle_t hTemperature, zes_temp_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesTemperatureGetPropertiesEpilogue( zes_temp_handle_t hTemperature, zes_temp_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesTemperatureGetPropertiesEpilogue( zes_temp_handle_t hTemperature, zes_temp_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesTemperatureGetConfigPrologue( zes_temp_handle_t hTemperature, zes_temp_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesTemperatureGetConfigEpilogue( zes_temp_handle_t hTemperature, zes_temp_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesTemperatureGetConfigEpilogue( zes_temp_handle_t hTemperature, zes_temp_config_t* pConfig, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesTemperatureSetConfigPrologue( zes_temp_handle_t hTemperature, const zes_temp_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesTemperatureSetConfigEpilogue( zes_temp_handle_t hTemperature, const zes_temp_config_t* pConfig ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesTemperatureSetConfigEpilogue( zes_temp_handle_t hTemperature, const zes_temp_config_t* pConfig, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesTemperatureGetStatePrologue( zes_temp_handle_t hTemperature, double* pTemperature ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesTemperatureGetStateEpilogue( zes_temp_handle_t hTemperature, double* pTemperature ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesTemperatureGetStateEpilogue( zes_temp_handle_t hTemperature, double* pTemperature, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPowerGetLimitsExtPrologue( zes_pwr_handle_t hPower, uint32_t* pCount, zes_power_limit_ext_desc_t* pSustained ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPowerGetLimitsExtEpilogue( zes_pwr_handle_t hPower, uint32_t* pCount, zes_power_limit_ext_desc_t* pSustained ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPowerGetLimitsExtEpilogue( zes_pwr_handle_t hPower, uint32_t* pCount, zes_power_limit_ext_desc_t* pSustained, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesPowerSetLimitsExtPrologue( zes_pwr_handle_t hPower, uint32_t* pCount, zes_power_limit_ext_desc_t* pSustained ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesPowerSetLimitsExtEpilogue( zes_pwr_handle_t hPower, uint32_t* pCount, zes_power_limit_ext_desc_t* pSustained ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesPowerSetLimitsExtEpilogue( zes_pwr_handle_t hPower, uint32_t* pCount, zes_power_limit_ext_desc_t* pSustained, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesEngineGetActivityExtPrologue( zes_engine_handle_t hEngine, uint32_t* pCount, zes_engine_stats_t* pStats ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesEngineGetActivityExtEpilogue( zes_engine_handle_t hEngine, uint32_t* pCount, zes_engine_stats_t* pStats ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesEngineGetActivityExtEpilogue( zes_engine_handle_t hEngine, uint32_t* pCount, zes_engine_stats_t* pStats, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesRasGetStateExpPrologue( zes_ras_handle_t hRas, uint32_t* pCount, zes_ras_state_exp_t* pState ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesRasGetStateExpEpilogue( zes_ras_handle_t hRas, uint32_t* pCount, zes_ras_state_exp_t* pState ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesRasGetStateExpEpilogue( zes_ras_handle_t hRas, uint32_t* pCount, zes_ras_state_exp_t* pState, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesRasClearStateExpPrologue( zes_ras_handle_t hRas, zes_ras_error_category_exp_t category ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesRasClearStateExpEpilogue( zes_ras_handle_t hRas, zes_ras_error_category_exp_t category ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesRasClearStateExpEpilogue( zes_ras_handle_t hRas, zes_ras_error_category_exp_t category, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFirmwareGetSecurityVersionExpPrologue( zes_firmware_handle_t hFirmware, char* pVersion ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFirmwareGetSecurityVersionExpEpilogue( zes_firmware_handle_t hFirmware, char* pVersion ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFirmwareGetSecurityVersionExpEpilogue( zes_firmware_handle_t hFirmware, char* pVersion, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesFirmwareSetSecurityVersionExpPrologue( zes_firmware_handle_t hFirmware ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesFirmwareSetSecurityVersionExpEpilogue( zes_firmware_handle_t hFirmware ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesFirmwareSetSecurityVersionExpEpilogue( zes_firmware_handle_t hFirmware, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceGetSubDevicePropertiesExpPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_subdevice_exp_properties_t* pSubdeviceProps ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceGetSubDevicePropertiesExpEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_subdevice_exp_properties_t* pSubdeviceProps ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceGetSubDevicePropertiesExpEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_subdevice_exp_properties_t* pSubdeviceProps, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDriverGetDeviceByUuidExpPrologue( zes_driver_handle_t hDriver, zes_uuid_t uuid, zes_device_handle_t* phDevice, ze_bool_t* onSubdevice, uint32_t* subdeviceId ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDriverGetDeviceByUuidExpEpilogue( zes_driver_handle_t hDriver, zes_uuid_t uuid, zes_device_handle_t* phDevice, ze_bool_t* onSubdevice, uint32_t* subdeviceId ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDriverGetDeviceByUuidExpEpilogue( zes_driver_handle_t hDriver, zes_uuid_t uuid, zes_device_handle_t* phDevice, ze_bool_t* onSubdevice, uint32_t* subdeviceId, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumActiveVFExpPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_vf_handle_t* phVFhandle ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumActiveVFExpEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_vf_handle_t* phVFhandle ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumActiveVFExpEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_vf_handle_t* phVFhandle, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesVFManagementGetVFPropertiesExpPrologue( zes_vf_handle_t hVFhandle, zes_vf_exp_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesVFManagementGetVFPropertiesExpEpilogue( zes_vf_handle_t hVFhandle, zes_vf_exp_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesVFManagementGetVFPropertiesExpEpilogue( zes_vf_handle_t hVFhandle, zes_vf_exp_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesVFManagementGetVFMemoryUtilizationExpPrologue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_mem_exp_t* pMemUtil ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesVFManagementGetVFMemoryUtilizationExpEpilogue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_mem_exp_t* pMemUtil ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesVFManagementGetVFMemoryUtilizationExpEpilogue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_mem_exp_t* pMemUtil, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesVFManagementGetVFEngineUtilizationExpPrologue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_engine_exp_t* pEngineUtil ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesVFManagementGetVFEngineUtilizationExpEpilogue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_engine_exp_t* pEngineUtil ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesVFManagementGetVFEngineUtilizationExpEpilogue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_engine_exp_t* pEngineUtil, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesVFManagementSetVFTelemetryModeExpPrologue( zes_vf_handle_t hVFhandle, zes_vf_info_util_exp_flags_t flags, ze_bool_t enable ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesVFManagementSetVFTelemetryModeExpEpilogue( zes_vf_handle_t hVFhandle, zes_vf_info_util_exp_flags_t flags, ze_bool_t enable ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesVFManagementSetVFTelemetryModeExpEpilogue( zes_vf_handle_t hVFhandle, zes_vf_info_util_exp_flags_t flags, ze_bool_t enable, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue( zes_vf_handle_t hVFhandle, zes_vf_info_util_exp_flags_t flag, uint64_t samplingInterval ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue( zes_vf_handle_t hVFhandle, zes_vf_info_util_exp_flags_t flag, uint64_t samplingInterval ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue( zes_vf_handle_t hVFhandle, zes_vf_info_util_exp_flags_t flag, uint64_t samplingInterval, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesDeviceEnumEnabledVFExpPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_vf_handle_t* phVFhandle ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesDeviceEnumEnabledVFExpEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_vf_handle_t* phVFhandle ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesDeviceEnumEnabledVFExpEpilogue( zes_device_handle_t hDevice, uint32_t* pCount, zes_vf_handle_t* phVFhandle, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesVFManagementGetVFCapabilitiesExpPrologue( zes_vf_handle_t hVFhandle, zes_vf_exp_capabilities_t* pCapability ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesVFManagementGetVFCapabilitiesExpEpilogue( zes_vf_handle_t hVFhandle, zes_vf_exp_capabilities_t* pCapability ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesVFManagementGetVFCapabilitiesExpEpilogue( zes_vf_handle_t hVFhandle, zes_vf_exp_capabilities_t* pCapability, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesVFManagementGetVFMemoryUtilizationExp2Prologue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_mem_exp2_t* pMemUtil ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesVFManagementGetVFMemoryUtilizationExp2Epilogue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_mem_exp2_t* pMemUtil ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesVFManagementGetVFMemoryUtilizationExp2Epilogue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_mem_exp2_t* pMemUtil, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zesVFManagementGetVFEngineUtilizationExp2Prologue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_engine_exp2_t* pEngineUtil ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zesVFManagementGetVFEngineUtilizationExp2Epilogue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_engine_exp2_t* pEngineUtil ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zesVFManagementGetVFEngineUtilizationExp2Epilogue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_engine_exp2_t* pEngineUtil, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ~ZESValidationEntryPoints() {}
 };
+
+// Index of each entry point, for the lists of checkers overriding it.
+namespace ZESEntryPoint {
+enum : uint32_t {
+    zesInitPrologue,
+    zesInitEpilogue,
+    zesDriverGetPrologue,
+    zesDriverGetEpilogue,
+    zesDriverGetExtensionPropertiesPrologue,
+    zesDriverGetExtensionPropertiesEpilogue,
+    zesDriverGetExtensionFunctionAddressPrologue,
+    zesDriverGetExtensionFunctionAddressEpilogue,
+    zesDeviceGetPrologue,
+    zesDeviceGetEpilogue,
+    zesDeviceGetPropertiesPrologue,
+    zesDeviceGetPropertiesEpilogue,
+    zesDeviceGetStatePrologue,
+    zesDeviceGetStateEpilogue,
+    zesDeviceResetPrologue,
+    zesDeviceResetEpilogue,
+    zesDeviceResetExtPrologue,
+    zesDeviceResetExtEpilogue,
+    zesDeviceProcessesGetStatePrologue,
+    zesDeviceProcessesGetStateEpilogue,
+    zesDevicePciGetPropertiesPrologue,
+    zesDevicePciGetPropertiesEpilogue,
+    zesDevicePciGetStatePrologue,
+    zesDevicePciGetStateEpilogue,
+    zesDevicePciGetBarsPrologue,
+    zesDevicePciGetBarsEpilogue,
+    zesDevicePciGetStatsPrologue,
+    zesDevicePciGetStatsEpilogue,
+    zesDeviceSetOverclockWaiverPrologue,
+    zesDeviceSetOverclockWaiverEpilogue,
+    zesDeviceGetOverclockDomainsPrologue,
+    zesDeviceGetOverclockDomainsEpilogue,
+    zesDeviceGetOverclockControlsPrologue,
+    zesDeviceGetOverclockControlsEpilogue,
+    zesDeviceResetOverclockSettingsPrologue,
+    zesDeviceResetOverclockSettingsEpilogue,
+    zesDeviceReadOverclockStatePrologue,
+    zesDeviceReadOverclockStateEpilogue,
+    zesDeviceEnumOverclockDomainsPrologue,
+    zesDeviceEnumOverclockDomainsEpilogue,
+    zesOverclockGetDomainPropertiesPrologue,
+    zesOverclockGetDomainPropertiesEpilogue,
+    zesOverclockGetDomainVFPropertiesPrologue,
+    zesOverclockGetDomainVFPropertiesEpilogue,
+    zesOverclockGetDomainControlPropertiesPrologue,
+    zesOverclockGetDomainControlPropertiesEpilogue,
+    zesOverclockGetControlCurrentValuePrologue,
+    zesOverclockGetControlCurrentValueEpilogue,
+    zesOverclockGetControlPendingValuePrologue,
+    zesOverclockGetControlPendingValueEpilogue,
+    zesOverclockSetControlUserValuePrologue,
+    zesOverclockSetControlUserValueEpilogue,
+    zesOverclockGetControlStatePrologue,
+    zesOverclockGetControlStateEpilogue,
+    zesOverclockGetVFPointValuesPrologue,
+    zesOverclockGetVFPointValuesEpilogue,
+    zesOverclockSetVFPointValuesPrologue,
+    zesOverclockSetVFPointValuesEpilogue,
+    zesDeviceEnumDiagnosticTestSuitesPrologue,
+    zesDeviceEnumDiagnosticTestSuitesEpilogue,
+    zesDiagnosticsGetPropertiesPrologue,
+    zesDiagnosticsGetPropertiesEpilogue,
+    zesDiagnosticsGetTestsPrologue,
+    zesDiagnosticsGetTestsEpilogue,
+    zesDiagnosticsRunTestsPrologue,
+    zesDiagnosticsRunTestsEpilogue,
+    zesDeviceEccAvailablePrologue,
+    zesDeviceEccAvailableEpilogue,
+    zesDeviceEccConfigurablePrologue,
+    zesDeviceEccConfigurableEpilogue,
+    zesDeviceGetEccStatePrologue,
+    zesDeviceGetEccStateEpilogue,
+    zesDeviceSetEccStatePrologue,
+    zesDeviceSetEccStateEpilogue,
+    zesDeviceEnumEngineGroupsPrologue,
+    zesDeviceEnumEngineGroupsEpilogue,
+    zesEngineGetPropertiesPrologue,
+    zesEngineGetPropertiesEpilogue,
+    zesEngineGetActivityPrologue,
+    zesEngineGetActivityEpilogue,
+    zesDeviceEventRegisterPrologue,
+    zesDeviceEventRegisterEpilogue,
+    zesDriverEventListenPrologue,
+    zesDriverEventListenEpilogue,
+    zesDriverEventListenExPrologue,
+    zesDriverEventListenExEpilogue,
+    zesDeviceEnumFabricPortsPrologue,
+    zesDeviceEnumFabricPortsEpilogue,
+    zesFabricPortGetPropertiesPrologue,
+    zesFabricPortGetPropertiesEpilogue,
+    zesFabricPortGetLinkTypePrologue,
+    zesFabricPortGetLinkTypeEpilogue,
+    zesFabricPortGetConfigPrologue,
+    zesFabricPortGetConfigEpilogue,
+    zesFabricPortSetConfigPrologue,
+    zesFabricPortSetConfigEpilogue,
+    zesFabricPortGetStatePrologue,
+    zesFabricPortGetStateEpilogue,
+    zesFabricPortGetThroughputPrologue,
+    zesFabricPortGetThroughputEpilogue,
+    zesFabricPortGetFabricErrorCountersPrologue,
+    zesFabricPortGetFabricErrorCountersEpilogue,
+    zesFabricPortGetMultiPortThroughputPrologue,
+    zesFabricPortGetMultiPortThroughputEpilogue,
+    zesDeviceEnumFansPrologue,
+    zesDeviceEnumFansEpilogue,
+    zesFanGetPropertiesPrologue,
+    zesFanGetPropertiesEpilogue,
+    zesFanGetConfigPrologue,
+    zesFanGetConfigEpilogue,
+    zesFanSetDefaultModePrologue,
+    zesFanSetDefaultModeEpilogue,
+    zesFanSetFixedSpeedModePrologue,
+    zesFanSetFixedSpeedModeEpilogue,
+    zesFanSetSpeedTableModePrologue,
+    zesFanSetSpeedTableModeEpilogue,
+    zesFanGetStatePrologue,
+    zesFanGetStateEpilogue,
+    zesDeviceEnumFirmwaresPrologue,
+    zesDeviceEnumFirmwaresEpilogue,
+    zesFirmwareGetPropertiesPrologue,
+    zesFirmwareGetPropertiesEpilogue,
+    zesFirmwareFlashPrologue,
+    zesFirmwareFlashEpilogue,
+    zesFirmwareGetFlashProgressPrologue,
+    zesFirmwareGetFlashProgressEpilogue,
+    zesFirmwareGetConsoleLogsPrologue,
+    zesFirmwareGetConsoleLogsEpilogue,
+    zesDeviceEnumFrequencyDomainsPrologue,
+    zesDeviceEnumFrequencyDomainsEpilogue,
+    zesFrequencyGetPropertiesPrologue,
+    zesFrequencyGetPropertiesEpilogue,
+    zesFrequencyGetAvailableClocksPrologue,
+    zesFrequencyGetAvailableClocksEpilogue,
+    zesFrequencyGetRangePrologue,
+    zesFrequencyGetRangeEpilogue,
+    zesFrequencySetRangePrologue,
+    zesFrequencySetRangeEpilogue,
+    zesFrequencyGetStatePrologue,
+    zesFrequencyGetStateEpilogue,
+    zesFrequencyGetThrottleTimePrologue,
+    zesFrequencyGetThrottleTimeEpilogue,
+    zesFrequencyOcGetCapabilitiesPrologue,
+    zesFrequencyOcGetCapabilitiesEpilogue,
+    zesFrequencyOcGetFrequencyTargetPrologue,
+    zesFrequencyOcGetFrequencyTargetEpilogue,
+    zesFrequencyOcSetFrequencyTargetPrologue,
+    zesFrequencyOcSetFrequencyTargetEpilogue,
+    zesFrequencyOcGetVoltageTargetPrologue,
+    zesFrequencyOcGetVoltageTargetEpilogue,
+    zesFrequencyOcSetVoltageTargetPrologue,
+    zesFrequencyOcSetVoltageTargetEpilogue,
+    zesFrequencyOcSetModePrologue,
+    zesFrequencyOcSetModeEpilogue,
+    zesFrequencyOcGetModePrologue,
+    zesFrequencyOcGetModeEpilogue,
+    zesFrequencyOcGetIccMaxPrologue,
+    zesFrequencyOcGetIccMaxEpilogue,
+    zesFrequencyOcSetIccMaxPrologue,
+    zesFrequencyOcSetIccMaxEpilogue,
+    zesFrequencyOcGetTjMaxPrologue,
+    zesFrequencyOcGetTjMaxEpilogue,
+    zesFrequencyOcSetTjMaxPrologue,
+    zesFrequencyOcSetTjMaxEpilogue,
+    zesDeviceEnumLedsPrologue,
+    zesDeviceEnumLedsEpilogue,
+    zesLedGetPropertiesPrologue,
+    zesLedGetPropertiesEpilogue,
+    zesLedGetStatePrologue,
+    zesLedGetStateEpilogue,
+    zesLedSetStatePrologue,
+    zesLedSetStateEpilogue,
+    zesLedSetColorPrologue,
+    zesLedSetColorEpilogue,
+    zesDeviceEnumMemoryModulesPrologue,
+    zesDeviceEnumMemoryModulesEpilogue,
+    zesMemoryGetPropertiesPrologue,
+    zesMemoryGetPropertiesEpilogue,
+    zesMemoryGetStatePrologue,
+    zesMemoryGetStateEpilogue,
+    zesMemoryGetBandwidthPrologue,
+    zesMemoryGetBandwidthEpilogue,
+    zesDeviceEnumPerformanceFactorDomainsPrologue,
+    zesDeviceEnumPerformanceFactorDomainsEpilogue,
+    zesPerformanceFactorGetPropertiesPrologue,
+    zesPerformanceFactorGetPropertiesEpilogue,
+    zesPerformanceFactorGetConfigPrologue,
+    zesPerformanceFactorGetConfigEpilogue,
+    zesPerformanceFactorSetConfigPrologue,
+    zesPerformanceFactorSetConfigEpilogue,
+    zesDeviceEnumPowerDomainsPrologue,
+    zesDeviceEnumPowerDomainsEpilogue,
+    zesDeviceGetCardPowerDomainPrologue,
+    zesDeviceGetCardPowerDomainEpilogue,
+    zesPowerGetPropertiesPrologue,
+    zesPowerGetPropertiesEpilogue,
+    zesPowerGetEnergyCounterPrologue,
+    zesPowerGetEnergyCounterEpilogue,
+    zesPowerGetLimitsPrologue,
+    zesPowerGetLimitsEpilogue,
+    zesPowerSetLimitsPrologue,
+    zesPowerSetLimitsEpilogue,
+    zesPowerGetEnergyThresholdPrologue,
+    zesPowerGetEnergyThresholdEpilogue,
+    zesPowerSetEnergyThresholdPrologue,
+    zesPowerSetEnergyThresholdEpilogue,
+    zesDeviceEnumPsusPrologue,
+    zesDeviceEnumPsusEpilogue,
+    zesPsuGetPropertiesPrologue,
+    zesPsuGetPropertiesEpilogue,
+    zesPsuGetStatePrologue,
+    zesPsuGetStateEpilogue,
+    zesDeviceEnumRasErrorSetsPrologue,
+    zesDeviceEnumRasErrorSetsEpilogue,
+    zesRasGetPropertiesPrologue,
+    zesRasGetPropertiesEpilogue,
+    zesRasGetConfigPrologue,
+    zesRasGetConfigEpilogue,
+    zesRasSetConfigPrologue,
+    zesRasSetConfigEpilogue,
+    zesRasGetStatePrologue,
+    zesRasGetStateEpilogue,
+    zesDeviceEnumSchedulersPrologue,
+    zesDeviceEnumSchedulersEpilogue,
+    zesSchedulerGetPropertiesPrologue,
+    zesSchedulerGetPropertiesEpilogue,
+    zesSchedulerGetCurrentModePrologue,
+    zesSchedulerGetCurrentModeEpilogue,
+    zesSchedulerGetTimeoutModePropertiesPrologue,
+    zesSchedulerGetTimeoutModePropertiesEpilogue,
+    zesSchedulerGetTimesliceModePropertiesPrologue,
+    zesSchedulerGetTimesliceModePropertiesEpilogue,
+    zesSchedulerSetTimeoutModePrologue,
+    zesSchedulerSetTimeoutModeEpilogue,
+    zesSchedulerSetTimesliceModePrologue,
+    zesSchedulerSetTimesliceModeEpilogue,
+    zesSchedulerSetExclusiveModePrologue,
+    zesSchedulerSetExclusiveModeEpilogue,
+    zesSchedulerSetComputeUnitDebugModePrologue,
+    zesSchedulerSetComputeUnitDebugModeEpilogue,
+    zesDeviceEnumStandbyDomainsPrologue,
+    zesDeviceEnumStandbyDomainsEpilogue,
+    zesStandbyGetPropertiesPrologue,
+    zesStandbyGetPropertiesEpilogue,
+    zesStandbyGetModePrologue,
+    zesStandbyGetModeEpilogue,
+    zesStandbySetModePrologue,
+    zesStandbySetModeEpilogue,
+    zesDeviceEnumTemperatureSensorsPrologue,
+    zesDeviceEnumTemperatureSensorsEpilogue,
+    zesTemperatureGetPropertiesPrologue,
+    zesTemperatureGetPropertiesEpilogue,
+    zesTemperatureGetConfigPrologue,
+    zesTemperatureGetConfigEpilogue,
+    zesTemperatureSetConfigPrologue,
+    zesTemperatureSetConfigEpilogue,
+    zesTemperatureGetStatePrologue,
+    zesTemperatureGetStateEpilogue,
+    zesPowerGetLimitsExtPrologue,
+    zesPowerGetLimitsExtEpilogue,
+    zesPowerSetLimitsExtPrologue,
+    zesPowerSetLimitsExtEpilogue,
+    zesEngineGetActivityExtPrologue,
+    zesEngineGetActivityExtEpilogue,
+    zesRasGetStateExpPrologue,
+    zesRasGetStateExpEpilogue,
+    zesRasClearStateExpPrologue,
+    zesRasClearStateExpEpilogue,
+    zesFirmwareGetSecurityVersionExpPrologue,
+    zesFirmwareGetSecurityVersionExpEpilogue,
+    zesFirmwareSetSecurityVersionExpPrologue,
+    zesFirmwareSetSecurityVersionExpEpilogue,
+    zesDeviceGetSubDevicePropertiesExpPrologue,
+    zesDeviceGetSubDevicePropertiesExpEpilogue,
+    zesDriverGetDeviceByUuidExpPrologue,
+    zesDriverGetDeviceByUuidExpEpilogue,
+    zesDeviceEnumActiveVFExpPrologue,
+    zesDeviceEnumActiveVFExpEpilogue,
+    zesVFManagementGetVFPropertiesExpPrologue,
+    zesVFManagementGetVFPropertiesExpEpilogue,
+    zesVFManagementGetVFMemoryUtilizationExpPrologue,
+    zesVFManagementGetVFMemoryUtilizationExpEpilogue,
+    zesVFManagementGetVFEngineUtilizationExpPrologue,
+    zesVFManagementGetVFEngineUtilizationExpEpilogue,
+    zesVFManagementSetVFTelemetryModeExpPrologue,
+    zesVFManagementSetVFTelemetryModeExpEpilogue,
+    zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue,
+    zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue,
+    zesDeviceEnumEnabledVFExpPrologue,
+    zesDeviceEnumEnabledVFExpEpilogue,
+    zesVFManagementGetVFCapabilitiesExpPrologue,
+    zesVFManagementGetVFCapabilitiesExpEpilogue,
+    zesVFManagementGetVFMemoryUtilizationExp2Prologue,
+    zesVFManagementGetVFMemoryUtilizationExp2Epilogue,
+    zesVFManagementGetVFEngineUtilizationExp2Prologue,
+    zesVFManagementGetVFEngineUtilizationExp2Epilogue,
+    Count
+};
+}
+
+// Entry points a checker class overrides, told apart from the defaults
+// above by the class their member pointers belong to.
+template <typename TChecker>
+std::bitset<ZESEntryPoint::Count> getZESOverriddenEntryPoints() {
+    std::bitset<ZESEntryPoint::Count> overrides;
+    overrides[ZESEntryPoint::zesInitPrologue] = !std::is_same<decltype(&TChecker::zesInitPrologue), decltype(&ZESValidationEntryPoints::zesInitPrologue)>::value;
+    overrides[ZESEntryPoint::zesInitEpilogue] = !std::is_same<decltype(&TChecker::zesInitEpilogue), decltype(&ZESValidationEntryPoints::zesInitEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDriverGetPrologue] = !std::is_same<decltype(&TChecker::zesDriverGetPrologue), decltype(&ZESValidationEntryPoints::zesDriverGetPrologue)>::value;
+    overrides[ZESEntryPoint::zesDriverGetEpilogue] = !std::is_same<decltype(&TChecker::zesDriverGetEpilogue), decltype(&ZESValidationEntryPoints::zesDriverGetEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDriverGetExtensionPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesDriverGetExtensionPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesDriverGetExtensionPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesDriverGetExtensionPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesDriverGetExtensionPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesDriverGetExtensionPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDriverGetExtensionFunctionAddressPrologue] = !std::is_same<decltype(&TChecker::zesDriverGetExtensionFunctionAddressPrologue), decltype(&ZESValidationEntryPoints::zesDriverGetExtensionFunctionAddressPrologue)>::value;
+    overrides[ZESEntryPoint::zesDriverGetExtensionFunctionAddressEpilogue] = !std::is_same<decltype(&TChecker::zesDriverGetExtensionFunctionAddressEpilogue), decltype(&ZESValidationEntryPoints::zesDriverGetExtensionFunctionAddressEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetPrologue] = !std::is_same<decltype(&TChecker::zesDeviceGetPrologue), decltype(&ZESValidationEntryPoints::zesDeviceGetPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceGetEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceGetEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesDeviceGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesDeviceGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetStatePrologue] = !std::is_same<decltype(&TChecker::zesDeviceGetStatePrologue), decltype(&ZESValidationEntryPoints::zesDeviceGetStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetStateEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceGetStateEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceGetStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceResetPrologue] = !std::is_same<decltype(&TChecker::zesDeviceResetPrologue), decltype(&ZESValidationEntryPoints::zesDeviceResetPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceResetEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceResetEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceResetEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceResetExtPrologue] = !std::is_same<decltype(&TChecker::zesDeviceResetExtPrologue), decltype(&ZESValidationEntryPoints::zesDeviceResetExtPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceResetExtEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceResetExtEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceResetExtEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceProcessesGetStatePrologue] = !std::is_same<decltype(&TChecker::zesDeviceProcessesGetStatePrologue), decltype(&ZESValidationEntryPoints::zesDeviceProcessesGetStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceProcessesGetStateEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceProcessesGetStateEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceProcessesGetStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDevicePciGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesDevicePciGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesDevicePciGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesDevicePciGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesDevicePciGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesDevicePciGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDevicePciGetStatePrologue] = !std::is_same<decltype(&TChecker::zesDevicePciGetStatePrologue), decltype(&ZESValidationEntryPoints::zesDevicePciGetStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesDevicePciGetStateEpilogue] = !std::is_same<decltype(&TChecker::zesDevicePciGetStateEpilogue), decltype(&ZESValidationEntryPoints::zesDevicePciGetStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDevicePciGetBarsPrologue] = !std::is_same<decltype(&TChecker::zesDevicePciGetBarsPrologue), decltype(&ZESValidationEntryPoints::zesDevicePciGetBarsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDevicePciGetBarsEpilogue] = !std::is_same<decltype(&TChecker::zesDevicePciGetBarsEpilogue), decltype(&ZESValidationEntryPoints::zesDevicePciGetBarsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDevicePciGetStatsPrologue] = !std::is_same<decltype(&TChecker::zesDevicePciGetStatsPrologue), decltype(&ZESValidationEntryPoints::zesDevicePciGetStatsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDevicePciGetStatsEpilogue] = !std::is_same<decltype(&TChecker::zesDevicePciGetStatsEpilogue), decltype(&ZESValidationEntryPoints::zesDevicePciGetStatsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceSetOverclockWaiverPrologue] = !std::is_same<decltype(&TChecker::zesDeviceSetOverclockWaiverPrologue), decltype(&ZESValidationEntryPoints::zesDeviceSetOverclockWaiverPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceSetOverclockWaiverEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceSetOverclockWaiverEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceSetOverclockWaiverEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetOverclockDomainsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceGetOverclockDomainsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceGetOverclockDomainsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetOverclockDomainsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceGetOverclockDomainsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceGetOverclockDomainsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetOverclockControlsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceGetOverclockControlsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceGetOverclockControlsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetOverclockControlsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceGetOverclockControlsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceGetOverclockControlsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceResetOverclockSettingsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceResetOverclockSettingsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceResetOverclockSettingsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceResetOverclockSettingsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceResetOverclockSettingsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceResetOverclockSettingsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceReadOverclockStatePrologue] = !std::is_same<decltype(&TChecker::zesDeviceReadOverclockStatePrologue), decltype(&ZESValidationEntryPoints::zesDeviceReadOverclockStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceReadOverclockStateEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceReadOverclockStateEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceReadOverclockStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumOverclockDomainsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumOverclockDomainsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumOverclockDomainsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumOverclockDomainsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumOverclockDomainsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumOverclockDomainsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetDomainPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesOverclockGetDomainPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesOverclockGetDomainPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetDomainPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesOverclockGetDomainPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesOverclockGetDomainPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetDomainVFPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesOverclockGetDomainVFPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesOverclockGetDomainVFPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetDomainVFPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesOverclockGetDomainVFPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesOverclockGetDomainVFPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetDomainControlPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesOverclockGetDomainControlPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesOverclockGetDomainControlPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetDomainControlPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesOverclockGetDomainControlPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesOverclockGetDomainControlPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetControlCurrentValuePrologue] = !std::is_same<decltype(&TChecker::zesOverclockGetControlCurrentValuePrologue), decltype(&ZESValidationEntryPoints::zesOverclockGetControlCurrentValuePrologue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetControlCurrentValueEpilogue] = !std::is_same<decltype(&TChecker::zesOverclockGetControlCurrentValueEpilogue), decltype(&ZESValidationEntryPoints::zesOverclockGetControlCurrentValueEpilogue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetControlPendingValuePrologue] = !std::is_same<decltype(&TChecker::zesOverclockGetControlPendingValuePrologue), decltype(&ZESValidationEntryPoints::zesOverclockGetControlPendingValuePrologue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetControlPendingValueEpilogue] = !std::is_same<decltype(&TChecker::zesOverclockGetControlPendingValueEpilogue), decltype(&ZESValidationEntryPoints::zesOverclockGetControlPendingValueEpilogue)>::value;
+    overrides[ZESEntryPoint::zesOverclockSetControlUserValuePrologue] = !std::is_same<decltype(&TChecker::zesOverclockSetControlUserValuePrologue), decltype(&ZESValidationEntryPoints::zesOverclockSetControlUserValuePrologue)>::value;
+    overrides[ZESEntryPoint::zesOverclockSetControlUserValueEpilogue] = !std::is_same<decltype(&TChecker::zesOverclockSetControlUserValueEpilogue), decltype(&ZESValidationEntryPoints::zesOverclockSetControlUserValueEpilogue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetControlStatePrologue] = !std::is_same<decltype(&TChecker::zesOverclockGetControlStatePrologue), decltype(&ZESValidationEntryPoints::zesOverclockGetControlStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetControlStateEpilogue] = !std::is_same<decltype(&TChecker::zesOverclockGetControlStateEpilogue), decltype(&ZESValidationEntryPoints::zesOverclockGetControlStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetVFPointValuesPrologue] = !std::is_same<decltype(&TChecker::zesOverclockGetVFPointValuesPrologue), decltype(&ZESValidationEntryPoints::zesOverclockGetVFPointValuesPrologue)>::value;
+    overrides[ZESEntryPoint::zesOverclockGetVFPointValuesEpilogue] = !std::is_same<decltype(&TChecker::zesOverclockGetVFPointValuesEpilogue), decltype(&ZESValidationEntryPoints::zesOverclockGetVFPointValuesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesOverclockSetVFPointValuesPrologue] = !std::is_same<decltype(&TChecker::zesOverclockSetVFPointValuesPrologue), decltype(&ZESValidationEntryPoints::zesOverclockSetVFPointValuesPrologue)>::value;
+    overrides[ZESEntryPoint::zesOverclockSetVFPointValuesEpilogue] = !std::is_same<decltype(&TChecker::zesOverclockSetVFPointValuesEpilogue), decltype(&ZESValidationEntryPoints::zesOverclockSetVFPointValuesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumDiagnosticTestSuitesPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumDiagnosticTestSuitesPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumDiagnosticTestSuitesPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumDiagnosticTestSuitesEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumDiagnosticTestSuitesEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumDiagnosticTestSuitesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDiagnosticsGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesDiagnosticsGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesDiagnosticsGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesDiagnosticsGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesDiagnosticsGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesDiagnosticsGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDiagnosticsGetTestsPrologue] = !std::is_same<decltype(&TChecker::zesDiagnosticsGetTestsPrologue), decltype(&ZESValidationEntryPoints::zesDiagnosticsGetTestsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDiagnosticsGetTestsEpilogue] = !std::is_same<decltype(&TChecker::zesDiagnosticsGetTestsEpilogue), decltype(&ZESValidationEntryPoints::zesDiagnosticsGetTestsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDiagnosticsRunTestsPrologue] = !std::is_same<decltype(&TChecker::zesDiagnosticsRunTestsPrologue), decltype(&ZESValidationEntryPoints::zesDiagnosticsRunTestsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDiagnosticsRunTestsEpilogue] = !std::is_same<decltype(&TChecker::zesDiagnosticsRunTestsEpilogue), decltype(&ZESValidationEntryPoints::zesDiagnosticsRunTestsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEccAvailablePrologue] = !std::is_same<decltype(&TChecker::zesDeviceEccAvailablePrologue), decltype(&ZESValidationEntryPoints::zesDeviceEccAvailablePrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEccAvailableEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEccAvailableEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEccAvailableEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEccConfigurablePrologue] = !std::is_same<decltype(&TChecker::zesDeviceEccConfigurablePrologue), decltype(&ZESValidationEntryPoints::zesDeviceEccConfigurablePrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEccConfigurableEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEccConfigurableEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEccConfigurableEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetEccStatePrologue] = !std::is_same<decltype(&TChecker::zesDeviceGetEccStatePrologue), decltype(&ZESValidationEntryPoints::zesDeviceGetEccStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetEccStateEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceGetEccStateEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceGetEccStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceSetEccStatePrologue] = !std::is_same<decltype(&TChecker::zesDeviceSetEccStatePrologue), decltype(&ZESValidationEntryPoints::zesDeviceSetEccStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceSetEccStateEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceSetEccStateEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceSetEccStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumEngineGroupsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumEngineGroupsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumEngineGroupsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumEngineGroupsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumEngineGroupsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumEngineGroupsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesEngineGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesEngineGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesEngineGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesEngineGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesEngineGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesEngineGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesEngineGetActivityPrologue] = !std::is_same<decltype(&TChecker::zesEngineGetActivityPrologue), decltype(&ZESValidationEntryPoints::zesEngineGetActivityPrologue)>::value;
+    overrides[ZESEntryPoint::zesEngineGetActivityEpilogue] = !std::is_same<decltype(&TChecker::zesEngineGetActivityEpilogue), decltype(&ZESValidationEntryPoints::zesEngineGetActivityEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEventRegisterPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEventRegisterPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEventRegisterPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEventRegisterEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEventRegisterEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEventRegisterEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDriverEventListenPrologue] = !std::is_same<decltype(&TChecker::zesDriverEventListenPrologue), decltype(&ZESValidationEntryPoints::zesDriverEventListenPrologue)>::value;
+    overrides[ZESEntryPoint::zesDriverEventListenEpilogue] = !std::is_same<decltype(&TChecker::zesDriverEventListenEpilogue), decltype(&ZESValidationEntryPoints::zesDriverEventListenEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDriverEventListenExPrologue] = !std::is_same<decltype(&TChecker::zesDriverEventListenExPrologue), decltype(&ZESValidationEntryPoints::zesDriverEventListenExPrologue)>::value;
+    overrides[ZESEntryPoint::zesDriverEventListenExEpilogue] = !std::is_same<decltype(&TChecker::zesDriverEventListenExEpilogue), decltype(&ZESValidationEntryPoints::zesDriverEventListenExEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumFabricPortsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumFabricPortsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumFabricPortsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumFabricPortsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumFabricPortsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumFabricPortsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesFabricPortGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesFabricPortGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesFabricPortGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesFabricPortGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetLinkTypePrologue] = !std::is_same<decltype(&TChecker::zesFabricPortGetLinkTypePrologue), decltype(&ZESValidationEntryPoints::zesFabricPortGetLinkTypePrologue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetLinkTypeEpilogue] = !std::is_same<decltype(&TChecker::zesFabricPortGetLinkTypeEpilogue), decltype(&ZESValidationEntryPoints::zesFabricPortGetLinkTypeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetConfigPrologue] = !std::is_same<decltype(&TChecker::zesFabricPortGetConfigPrologue), decltype(&ZESValidationEntryPoints::zesFabricPortGetConfigPrologue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetConfigEpilogue] = !std::is_same<decltype(&TChecker::zesFabricPortGetConfigEpilogue), decltype(&ZESValidationEntryPoints::zesFabricPortGetConfigEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortSetConfigPrologue] = !std::is_same<decltype(&TChecker::zesFabricPortSetConfigPrologue), decltype(&ZESValidationEntryPoints::zesFabricPortSetConfigPrologue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortSetConfigEpilogue] = !std::is_same<decltype(&TChecker::zesFabricPortSetConfigEpilogue), decltype(&ZESValidationEntryPoints::zesFabricPortSetConfigEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetStatePrologue] = !std::is_same<decltype(&TChecker::zesFabricPortGetStatePrologue), decltype(&ZESValidationEntryPoints::zesFabricPortGetStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetStateEpilogue] = !std::is_same<decltype(&TChecker::zesFabricPortGetStateEpilogue), decltype(&ZESValidationEntryPoints::zesFabricPortGetStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetThroughputPrologue] = !std::is_same<decltype(&TChecker::zesFabricPortGetThroughputPrologue), decltype(&ZESValidationEntryPoints::zesFabricPortGetThroughputPrologue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetThroughputEpilogue] = !std::is_same<decltype(&TChecker::zesFabricPortGetThroughputEpilogue), decltype(&ZESValidationEntryPoints::zesFabricPortGetThroughputEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetFabricErrorCountersPrologue] = !std::is_same<decltype(&TChecker::zesFabricPortGetFabricErrorCountersPrologue), decltype(&ZESValidationEntryPoints::zesFabricPortGetFabricErrorCountersPrologue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetFabricErrorCountersEpilogue] = !std::is_same<decltype(&TChecker::zesFabricPortGetFabricErrorCountersEpilogue), decltype(&ZESValidationEntryPoints::zesFabricPortGetFabricErrorCountersEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetMultiPortThroughputPrologue] = !std::is_same<decltype(&TChecker::zesFabricPortGetMultiPortThroughputPrologue), decltype(&ZESValidationEntryPoints::zesFabricPortGetMultiPortThroughputPrologue)>::value;
+    overrides[ZESEntryPoint::zesFabricPortGetMultiPortThroughputEpilogue] = !std::is_same<decltype(&TChecker::zesFabricPortGetMultiPortThroughputEpilogue), decltype(&ZESValidationEntryPoints::zesFabricPortGetMultiPortThroughputEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumFansPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumFansPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumFansPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumFansEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumFansEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumFansEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFanGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesFanGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesFanGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesFanGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesFanGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesFanGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFanGetConfigPrologue] = !std::is_same<decltype(&TChecker::zesFanGetConfigPrologue), decltype(&ZESValidationEntryPoints::zesFanGetConfigPrologue)>::value;
+    overrides[ZESEntryPoint::zesFanGetConfigEpilogue] = !std::is_same<decltype(&TChecker::zesFanGetConfigEpilogue), decltype(&ZESValidationEntryPoints::zesFanGetConfigEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFanSetDefaultModePrologue] = !std::is_same<decltype(&TChecker::zesFanSetDefaultModePrologue), decltype(&ZESValidationEntryPoints::zesFanSetDefaultModePrologue)>::value;
+    overrides[ZESEntryPoint::zesFanSetDefaultModeEpilogue] = !std::is_same<decltype(&TChecker::zesFanSetDefaultModeEpilogue), decltype(&ZESValidationEntryPoints::zesFanSetDefaultModeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFanSetFixedSpeedModePrologue] = !std::is_same<decltype(&TChecker::zesFanSetFixedSpeedModePrologue), decltype(&ZESValidationEntryPoints::zesFanSetFixedSpeedModePrologue)>::value;
+    overrides[ZESEntryPoint::zesFanSetFixedSpeedModeEpilogue] = !std::is_same<decltype(&TChecker::zesFanSetFixedSpeedModeEpilogue), decltype(&ZESValidationEntryPoints::zesFanSetFixedSpeedModeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFanSetSpeedTableModePrologue] = !std::is_same<decltype(&TChecker::zesFanSetSpeedTableModePrologue), decltype(&ZESValidationEntryPoints::zesFanSetSpeedTableModePrologue)>::value;
+    overrides[ZESEntryPoint::zesFanSetSpeedTableModeEpilogue] = !std::is_same<decltype(&TChecker::zesFanSetSpeedTableModeEpilogue), decltype(&ZESValidationEntryPoints::zesFanSetSpeedTableModeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFanGetStatePrologue] = !std::is_same<decltype(&TChecker::zesFanGetStatePrologue), decltype(&ZESValidationEntryPoints::zesFanGetStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesFanGetStateEpilogue] = !std::is_same<decltype(&TChecker::zesFanGetStateEpilogue), decltype(&ZESValidationEntryPoints::zesFanGetStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumFirmwaresPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumFirmwaresPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumFirmwaresPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumFirmwaresEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumFirmwaresEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumFirmwaresEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFirmwareGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesFirmwareGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesFirmwareGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesFirmwareGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesFirmwareGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesFirmwareGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFirmwareFlashPrologue] = !std::is_same<decltype(&TChecker::zesFirmwareFlashPrologue), decltype(&ZESValidationEntryPoints::zesFirmwareFlashPrologue)>::value;
+    overrides[ZESEntryPoint::zesFirmwareFlashEpilogue] = !std::is_same<decltype(&TChecker::zesFirmwareFlashEpilogue), decltype(&ZESValidationEntryPoints::zesFirmwareFlashEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFirmwareGetFlashProgressPrologue] = !std::is_same<decltype(&TChecker::zesFirmwareGetFlashProgressPrologue), decltype(&ZESValidationEntryPoints::zesFirmwareGetFlashProgressPrologue)>::value;
+    overrides[ZESEntryPoint::zesFirmwareGetFlashProgressEpilogue] = !std::is_same<decltype(&TChecker::zesFirmwareGetFlashProgressEpilogue), decltype(&ZESValidationEntryPoints::zesFirmwareGetFlashProgressEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFirmwareGetConsoleLogsPrologue] = !std::is_same<decltype(&TChecker::zesFirmwareGetConsoleLogsPrologue), decltype(&ZESValidationEntryPoints::zesFirmwareGetConsoleLogsPrologue)>::value;
+    overrides[ZESEntryPoint::zesFirmwareGetConsoleLogsEpilogue] = !std::is_same<decltype(&TChecker::zesFirmwareGetConsoleLogsEpilogue), decltype(&ZESValidationEntryPoints::zesFirmwareGetConsoleLogsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumFrequencyDomainsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumFrequencyDomainsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumFrequencyDomainsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumFrequencyDomainsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumFrequencyDomainsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumFrequencyDomainsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesFrequencyGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesFrequencyGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyGetAvailableClocksPrologue] = !std::is_same<decltype(&TChecker::zesFrequencyGetAvailableClocksPrologue), decltype(&ZESValidationEntryPoints::zesFrequencyGetAvailableClocksPrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyGetAvailableClocksEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyGetAvailableClocksEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyGetAvailableClocksEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyGetRangePrologue] = !std::is_same<decltype(&TChecker::zesFrequencyGetRangePrologue), decltype(&ZESValidationEntryPoints::zesFrequencyGetRangePrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyGetRangeEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyGetRangeEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyGetRangeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencySetRangePrologue] = !std::is_same<decltype(&TChecker::zesFrequencySetRangePrologue), decltype(&ZESValidationEntryPoints::zesFrequencySetRangePrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencySetRangeEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencySetRangeEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencySetRangeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyGetStatePrologue] = !std::is_same<decltype(&TChecker::zesFrequencyGetStatePrologue), decltype(&ZESValidationEntryPoints::zesFrequencyGetStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyGetStateEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyGetStateEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyGetStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyGetThrottleTimePrologue] = !std::is_same<decltype(&TChecker::zesFrequencyGetThrottleTimePrologue), decltype(&ZESValidationEntryPoints::zesFrequencyGetThrottleTimePrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyGetThrottleTimeEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyGetThrottleTimeEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyGetThrottleTimeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcGetCapabilitiesPrologue] = !std::is_same<decltype(&TChecker::zesFrequencyOcGetCapabilitiesPrologue), decltype(&ZESValidationEntryPoints::zesFrequencyOcGetCapabilitiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcGetCapabilitiesEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyOcGetCapabilitiesEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyOcGetCapabilitiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcGetFrequencyTargetPrologue] = !std::is_same<decltype(&TChecker::zesFrequencyOcGetFrequencyTargetPrologue), decltype(&ZESValidationEntryPoints::zesFrequencyOcGetFrequencyTargetPrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcGetFrequencyTargetEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyOcGetFrequencyTargetEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyOcGetFrequencyTargetEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcSetFrequencyTargetPrologue] = !std::is_same<decltype(&TChecker::zesFrequencyOcSetFrequencyTargetPrologue), decltype(&ZESValidationEntryPoints::zesFrequencyOcSetFrequencyTargetPrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcSetFrequencyTargetEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyOcSetFrequencyTargetEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyOcSetFrequencyTargetEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcGetVoltageTargetPrologue] = !std::is_same<decltype(&TChecker::zesFrequencyOcGetVoltageTargetPrologue), decltype(&ZESValidationEntryPoints::zesFrequencyOcGetVoltageTargetPrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcGetVoltageTargetEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyOcGetVoltageTargetEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyOcGetVoltageTargetEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcSetVoltageTargetPrologue] = !std::is_same<decltype(&TChecker::zesFrequencyOcSetVoltageTargetPrologue), decltype(&ZESValidationEntryPoints::zesFrequencyOcSetVoltageTargetPrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcSetVoltageTargetEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyOcSetVoltageTargetEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyOcSetVoltageTargetEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcSetModePrologue] = !std::is_same<decltype(&TChecker::zesFrequencyOcSetModePrologue), decltype(&ZESValidationEntryPoints::zesFrequencyOcSetModePrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcSetModeEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyOcSetModeEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyOcSetModeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcGetModePrologue] = !std::is_same<decltype(&TChecker::zesFrequencyOcGetModePrologue), decltype(&ZESValidationEntryPoints::zesFrequencyOcGetModePrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcGetModeEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyOcGetModeEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyOcGetModeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcGetIccMaxPrologue] = !std::is_same<decltype(&TChecker::zesFrequencyOcGetIccMaxPrologue), decltype(&ZESValidationEntryPoints::zesFrequencyOcGetIccMaxPrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcGetIccMaxEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyOcGetIccMaxEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyOcGetIccMaxEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcSetIccMaxPrologue] = !std::is_same<decltype(&TChecker::zesFrequencyOcSetIccMaxPrologue), decltype(&ZESValidationEntryPoints::zesFrequencyOcSetIccMaxPrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcSetIccMaxEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyOcSetIccMaxEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyOcSetIccMaxEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcGetTjMaxPrologue] = !std::is_same<decltype(&TChecker::zesFrequencyOcGetTjMaxPrologue), decltype(&ZESValidationEntryPoints::zesFrequencyOcGetTjMaxPrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcGetTjMaxEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyOcGetTjMaxEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyOcGetTjMaxEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcSetTjMaxPrologue] = !std::is_same<decltype(&TChecker::zesFrequencyOcSetTjMaxPrologue), decltype(&ZESValidationEntryPoints::zesFrequencyOcSetTjMaxPrologue)>::value;
+    overrides[ZESEntryPoint::zesFrequencyOcSetTjMaxEpilogue] = !std::is_same<decltype(&TChecker::zesFrequencyOcSetTjMaxEpilogue), decltype(&ZESValidationEntryPoints::zesFrequencyOcSetTjMaxEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumLedsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumLedsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumLedsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumLedsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumLedsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumLedsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesLedGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesLedGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesLedGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesLedGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesLedGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesLedGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesLedGetStatePrologue] = !std::is_same<decltype(&TChecker::zesLedGetStatePrologue), decltype(&ZESValidationEntryPoints::zesLedGetStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesLedGetStateEpilogue] = !std::is_same<decltype(&TChecker::zesLedGetStateEpilogue), decltype(&ZESValidationEntryPoints::zesLedGetStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesLedSetStatePrologue] = !std::is_same<decltype(&TChecker::zesLedSetStatePrologue), decltype(&ZESValidationEntryPoints::zesLedSetStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesLedSetStateEpilogue] = !std::is_same<decltype(&TChecker::zesLedSetStateEpilogue), decltype(&ZESValidationEntryPoints::zesLedSetStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesLedSetColorPrologue] = !std::is_same<decltype(&TChecker::zesLedSetColorPrologue), decltype(&ZESValidationEntryPoints::zesLedSetColorPrologue)>::value;
+    overrides[ZESEntryPoint::zesLedSetColorEpilogue] = !std::is_same<decltype(&TChecker::zesLedSetColorEpilogue), decltype(&ZESValidationEntryPoints::zesLedSetColorEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumMemoryModulesPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumMemoryModulesPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumMemoryModulesPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumMemoryModulesEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumMemoryModulesEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumMemoryModulesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesMemoryGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesMemoryGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesMemoryGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesMemoryGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesMemoryGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesMemoryGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesMemoryGetStatePrologue] = !std::is_same<decltype(&TChecker::zesMemoryGetStatePrologue), decltype(&ZESValidationEntryPoints::zesMemoryGetStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesMemoryGetStateEpilogue] = !std::is_same<decltype(&TChecker::zesMemoryGetStateEpilogue), decltype(&ZESValidationEntryPoints::zesMemoryGetStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesMemoryGetBandwidthPrologue] = !std::is_same<decltype(&TChecker::zesMemoryGetBandwidthPrologue), decltype(&ZESValidationEntryPoints::zesMemoryGetBandwidthPrologue)>::value;
+    overrides[ZESEntryPoint::zesMemoryGetBandwidthEpilogue] = !std::is_same<decltype(&TChecker::zesMemoryGetBandwidthEpilogue), decltype(&ZESValidationEntryPoints::zesMemoryGetBandwidthEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumPerformanceFactorDomainsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumPerformanceFactorDomainsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumPerformanceFactorDomainsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumPerformanceFactorDomainsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumPerformanceFactorDomainsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumPerformanceFactorDomainsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPerformanceFactorGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesPerformanceFactorGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesPerformanceFactorGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesPerformanceFactorGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesPerformanceFactorGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesPerformanceFactorGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPerformanceFactorGetConfigPrologue] = !std::is_same<decltype(&TChecker::zesPerformanceFactorGetConfigPrologue), decltype(&ZESValidationEntryPoints::zesPerformanceFactorGetConfigPrologue)>::value;
+    overrides[ZESEntryPoint::zesPerformanceFactorGetConfigEpilogue] = !std::is_same<decltype(&TChecker::zesPerformanceFactorGetConfigEpilogue), decltype(&ZESValidationEntryPoints::zesPerformanceFactorGetConfigEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPerformanceFactorSetConfigPrologue] = !std::is_same<decltype(&TChecker::zesPerformanceFactorSetConfigPrologue), decltype(&ZESValidationEntryPoints::zesPerformanceFactorSetConfigPrologue)>::value;
+    overrides[ZESEntryPoint::zesPerformanceFactorSetConfigEpilogue] = !std::is_same<decltype(&TChecker::zesPerformanceFactorSetConfigEpilogue), decltype(&ZESValidationEntryPoints::zesPerformanceFactorSetConfigEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumPowerDomainsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumPowerDomainsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumPowerDomainsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumPowerDomainsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumPowerDomainsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumPowerDomainsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetCardPowerDomainPrologue] = !std::is_same<decltype(&TChecker::zesDeviceGetCardPowerDomainPrologue), decltype(&ZESValidationEntryPoints::zesDeviceGetCardPowerDomainPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetCardPowerDomainEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceGetCardPowerDomainEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceGetCardPowerDomainEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPowerGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesPowerGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesPowerGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesPowerGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesPowerGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesPowerGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPowerGetEnergyCounterPrologue] = !std::is_same<decltype(&TChecker::zesPowerGetEnergyCounterPrologue), decltype(&ZESValidationEntryPoints::zesPowerGetEnergyCounterPrologue)>::value;
+    overrides[ZESEntryPoint::zesPowerGetEnergyCounterEpilogue] = !std::is_same<decltype(&TChecker::zesPowerGetEnergyCounterEpilogue), decltype(&ZESValidationEntryPoints::zesPowerGetEnergyCounterEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPowerGetLimitsPrologue] = !std::is_same<decltype(&TChecker::zesPowerGetLimitsPrologue), decltype(&ZESValidationEntryPoints::zesPowerGetLimitsPrologue)>::value;
+    overrides[ZESEntryPoint::zesPowerGetLimitsEpilogue] = !std::is_same<decltype(&TChecker::zesPowerGetLimitsEpilogue), decltype(&ZESValidationEntryPoints::zesPowerGetLimitsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPowerSetLimitsPrologue] = !std::is_same<decltype(&TChecker::zesPowerSetLimitsPrologue), decltype(&ZESValidationEntryPoints::zesPowerSetLimitsPrologue)>::value;
+    overrides[ZESEntryPoint::zesPowerSetLimitsEpilogue] = !std::is_same<decltype(&TChecker::zesPowerSetLimitsEpilogue), decltype(&ZESValidationEntryPoints::zesPowerSetLimitsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPowerGetEnergyThresholdPrologue] = !std::is_same<decltype(&TChecker::zesPowerGetEnergyThresholdPrologue), decltype(&ZESValidationEntryPoints::zesPowerGetEnergyThresholdPrologue)>::value;
+    overrides[ZESEntryPoint::zesPowerGetEnergyThresholdEpilogue] = !std::is_same<decltype(&TChecker::zesPowerGetEnergyThresholdEpilogue), decltype(&ZESValidationEntryPoints::zesPowerGetEnergyThresholdEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPowerSetEnergyThresholdPrologue] = !std::is_same<decltype(&TChecker::zesPowerSetEnergyThresholdPrologue), decltype(&ZESValidationEntryPoints::zesPowerSetEnergyThresholdPrologue)>::value;
+    overrides[ZESEntryPoint::zesPowerSetEnergyThresholdEpilogue] = !std::is_same<decltype(&TChecker::zesPowerSetEnergyThresholdEpilogue), decltype(&ZESValidationEntryPoints::zesPowerSetEnergyThresholdEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumPsusPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumPsusPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumPsusPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumPsusEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumPsusEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumPsusEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPsuGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesPsuGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesPsuGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesPsuGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesPsuGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesPsuGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPsuGetStatePrologue] = !std::is_same<decltype(&TChecker::zesPsuGetStatePrologue), decltype(&ZESValidationEntryPoints::zesPsuGetStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesPsuGetStateEpilogue] = !std::is_same<decltype(&TChecker::zesPsuGetStateEpilogue), decltype(&ZESValidationEntryPoints::zesPsuGetStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumRasErrorSetsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumRasErrorSetsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumRasErrorSetsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumRasErrorSetsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumRasErrorSetsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumRasErrorSetsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesRasGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesRasGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesRasGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesRasGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesRasGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesRasGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesRasGetConfigPrologue] = !std::is_same<decltype(&TChecker::zesRasGetConfigPrologue), decltype(&ZESValidationEntryPoints::zesRasGetConfigPrologue)>::value;
+    overrides[ZESEntryPoint::zesRasGetConfigEpilogue] = !std::is_same<decltype(&TChecker::zesRasGetConfigEpilogue), decltype(&ZESValidationEntryPoints::zesRasGetConfigEpilogue)>::value;
+    overrides[ZESEntryPoint::zesRasSetConfigPrologue] = !std::is_same<decltype(&TChecker::zesRasSetConfigPrologue), decltype(&ZESValidationEntryPoints::zesRasSetConfigPrologue)>::value;
+    overrides[ZESEntryPoint::zesRasSetConfigEpilogue] = !std::is_same<decltype(&TChecker::zesRasSetConfigEpilogue), decltype(&ZESValidationEntryPoints::zesRasSetConfigEpilogue)>::value;
+    overrides[ZESEntryPoint::zesRasGetStatePrologue] = !std::is_same<decltype(&TChecker::zesRasGetStatePrologue), decltype(&ZESValidationEntryPoints::zesRasGetStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesRasGetStateEpilogue] = !std::is_same<decltype(&TChecker::zesRasGetStateEpilogue), decltype(&ZESValidationEntryPoints::zesRasGetStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumSchedulersPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumSchedulersPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumSchedulersPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumSchedulersEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumSchedulersEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumSchedulersEpilogue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesSchedulerGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesSchedulerGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesSchedulerGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesSchedulerGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerGetCurrentModePrologue] = !std::is_same<decltype(&TChecker::zesSchedulerGetCurrentModePrologue), decltype(&ZESValidationEntryPoints::zesSchedulerGetCurrentModePrologue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerGetCurrentModeEpilogue] = !std::is_same<decltype(&TChecker::zesSchedulerGetCurrentModeEpilogue), decltype(&ZESValidationEntryPoints::zesSchedulerGetCurrentModeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerGetTimeoutModePropertiesPrologue] = !std::is_same<decltype(&TChecker::zesSchedulerGetTimeoutModePropertiesPrologue), decltype(&ZESValidationEntryPoints::zesSchedulerGetTimeoutModePropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerGetTimeoutModePropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesSchedulerGetTimeoutModePropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesSchedulerGetTimeoutModePropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerGetTimesliceModePropertiesPrologue] = !std::is_same<decltype(&TChecker::zesSchedulerGetTimesliceModePropertiesPrologue), decltype(&ZESValidationEntryPoints::zesSchedulerGetTimesliceModePropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerGetTimesliceModePropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesSchedulerGetTimesliceModePropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesSchedulerGetTimesliceModePropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerSetTimeoutModePrologue] = !std::is_same<decltype(&TChecker::zesSchedulerSetTimeoutModePrologue), decltype(&ZESValidationEntryPoints::zesSchedulerSetTimeoutModePrologue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerSetTimeoutModeEpilogue] = !std::is_same<decltype(&TChecker::zesSchedulerSetTimeoutModeEpilogue), decltype(&ZESValidationEntryPoints::zesSchedulerSetTimeoutModeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerSetTimesliceModePrologue] = !std::is_same<decltype(&TChecker::zesSchedulerSetTimesliceModePrologue), decltype(&ZESValidationEntryPoints::zesSchedulerSetTimesliceModePrologue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerSetTimesliceModeEpilogue] = !std::is_same<decltype(&TChecker::zesSchedulerSetTimesliceModeEpilogue), decltype(&ZESValidationEntryPoints::zesSchedulerSetTimesliceModeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerSetExclusiveModePrologue] = !std::is_same<decltype(&TChecker::zesSchedulerSetExclusiveModePrologue), decltype(&ZESValidationEntryPoints::zesSchedulerSetExclusiveModePrologue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerSetExclusiveModeEpilogue] = !std::is_same<decltype(&TChecker::zesSchedulerSetExclusiveModeEpilogue), decltype(&ZESValidationEntryPoints::zesSchedulerSetExclusiveModeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerSetComputeUnitDebugModePrologue] = !std::is_same<decltype(&TChecker::zesSchedulerSetComputeUnitDebugModePrologue), decltype(&ZESValidationEntryPoints::zesSchedulerSetComputeUnitDebugModePrologue)>::value;
+    overrides[ZESEntryPoint::zesSchedulerSetComputeUnitDebugModeEpilogue] = !std::is_same<decltype(&TChecker::zesSchedulerSetComputeUnitDebugModeEpilogue), decltype(&ZESValidationEntryPoints::zesSchedulerSetComputeUnitDebugModeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumStandbyDomainsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumStandbyDomainsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumStandbyDomainsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumStandbyDomainsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumStandbyDomainsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumStandbyDomainsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesStandbyGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesStandbyGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesStandbyGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesStandbyGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesStandbyGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesStandbyGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesStandbyGetModePrologue] = !std::is_same<decltype(&TChecker::zesStandbyGetModePrologue), decltype(&ZESValidationEntryPoints::zesStandbyGetModePrologue)>::value;
+    overrides[ZESEntryPoint::zesStandbyGetModeEpilogue] = !std::is_same<decltype(&TChecker::zesStandbyGetModeEpilogue), decltype(&ZESValidationEntryPoints::zesStandbyGetModeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesStandbySetModePrologue] = !std::is_same<decltype(&TChecker::zesStandbySetModePrologue), decltype(&ZESValidationEntryPoints::zesStandbySetModePrologue)>::value;
+    overrides[ZESEntryPoint::zesStandbySetModeEpilogue] = !std::is_same<decltype(&TChecker::zesStandbySetModeEpilogue), decltype(&ZESValidationEntryPoints::zesStandbySetModeEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumTemperatureSensorsPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumTemperatureSensorsPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumTemperatureSensorsPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumTemperatureSensorsEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumTemperatureSensorsEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumTemperatureSensorsEpilogue)>::value;
+    overrides[ZESEntryPoint::zesTemperatureGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zesTemperatureGetPropertiesPrologue), decltype(&ZESValidationEntryPoints::zesTemperatureGetPropertiesPrologue)>::value;
+    overrides[ZESEntryPoint::zesTemperatureGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zesTemperatureGetPropertiesEpilogue), decltype(&ZESValidationEntryPoints::zesTemperatureGetPropertiesEpilogue)>::value;
+    overrides[ZESEntryPoint::zesTemperatureGetConfigPrologue] = !std::is_same<decltype(&TChecker::zesTemperatureGetConfigPrologue), decltype(&ZESValidationEntryPoints::zesTemperatureGetConfigPrologue)>::value;
+    overrides[ZESEntryPoint::zesTemperatureGetConfigEpilogue] = !std::is_same<decltype(&TChecker::zesTemperatureGetConfigEpilogue), decltype(&ZESValidationEntryPoints::zesTemperatureGetConfigEpilogue)>::value;
+    overrides[ZESEntryPoint::zesTemperatureSetConfigPrologue] = !std::is_same<decltype(&TChecker::zesTemperatureSetConfigPrologue), decltype(&ZESValidationEntryPoints::zesTemperatureSetConfigPrologue)>::value;
+    overrides[ZESEntryPoint::zesTemperatureSetConfigEpilogue] = !std::is_same<decltype(&TChecker::zesTemperatureSetConfigEpilogue), decltype(&ZESValidationEntryPoints::zesTemperatureSetConfigEpilogue)>::value;
+    overrides[ZESEntryPoint::zesTemperatureGetStatePrologue] = !std::is_same<decltype(&TChecker::zesTemperatureGetStatePrologue), decltype(&ZESValidationEntryPoints::zesTemperatureGetStatePrologue)>::value;
+    overrides[ZESEntryPoint::zesTemperatureGetStateEpilogue] = !std::is_same<decltype(&TChecker::zesTemperatureGetStateEpilogue), decltype(&ZESValidationEntryPoints::zesTemperatureGetStateEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPowerGetLimitsExtPrologue] = !std::is_same<decltype(&TChecker::zesPowerGetLimitsExtPrologue), decltype(&ZESValidationEntryPoints::zesPowerGetLimitsExtPrologue)>::value;
+    overrides[ZESEntryPoint::zesPowerGetLimitsExtEpilogue] = !std::is_same<decltype(&TChecker::zesPowerGetLimitsExtEpilogue), decltype(&ZESValidationEntryPoints::zesPowerGetLimitsExtEpilogue)>::value;
+    overrides[ZESEntryPoint::zesPowerSetLimitsExtPrologue] = !std::is_same<decltype(&TChecker::zesPowerSetLimitsExtPrologue), decltype(&ZESValidationEntryPoints::zesPowerSetLimitsExtPrologue)>::value;
+    overrides[ZESEntryPoint::zesPowerSetLimitsExtEpilogue] = !std::is_same<decltype(&TChecker::zesPowerSetLimitsExtEpilogue), decltype(&ZESValidationEntryPoints::zesPowerSetLimitsExtEpilogue)>::value;
+    overrides[ZESEntryPoint::zesEngineGetActivityExtPrologue] = !std::is_same<decltype(&TChecker::zesEngineGetActivityExtPrologue), decltype(&ZESValidationEntryPoints::zesEngineGetActivityExtPrologue)>::value;
+    overrides[ZESEntryPoint::zesEngineGetActivityExtEpilogue] = !std::is_same<decltype(&TChecker::zesEngineGetActivityExtEpilogue), decltype(&ZESValidationEntryPoints::zesEngineGetActivityExtEpilogue)>::value;
+    overrides[ZESEntryPoint::zesRasGetStateExpPrologue] = !std::is_same<decltype(&TChecker::zesRasGetStateExpPrologue), decltype(&ZESValidationEntryPoints::zesRasGetStateExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesRasGetStateExpEpilogue] = !std::is_same<decltype(&TChecker::zesRasGetStateExpEpilogue), decltype(&ZESValidationEntryPoints::zesRasGetStateExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesRasClearStateExpPrologue] = !std::is_same<decltype(&TChecker::zesRasClearStateExpPrologue), decltype(&ZESValidationEntryPoints::zesRasClearStateExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesRasClearStateExpEpilogue] = !std::is_same<decltype(&TChecker::zesRasClearStateExpEpilogue), decltype(&ZESValidationEntryPoints::zesRasClearStateExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFirmwareGetSecurityVersionExpPrologue] = !std::is_same<decltype(&TChecker::zesFirmwareGetSecurityVersionExpPrologue), decltype(&ZESValidationEntryPoints::zesFirmwareGetSecurityVersionExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesFirmwareGetSecurityVersionExpEpilogue] = !std::is_same<decltype(&TChecker::zesFirmwareGetSecurityVersionExpEpilogue), decltype(&ZESValidationEntryPoints::zesFirmwareGetSecurityVersionExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesFirmwareSetSecurityVersionExpPrologue] = !std::is_same<decltype(&TChecker::zesFirmwareSetSecurityVersionExpPrologue), decltype(&ZESValidationEntryPoints::zesFirmwareSetSecurityVersionExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesFirmwareSetSecurityVersionExpEpilogue] = !std::is_same<decltype(&TChecker::zesFirmwareSetSecurityVersionExpEpilogue), decltype(&ZESValidationEntryPoints::zesFirmwareSetSecurityVersionExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetSubDevicePropertiesExpPrologue] = !std::is_same<decltype(&TChecker::zesDeviceGetSubDevicePropertiesExpPrologue), decltype(&ZESValidationEntryPoints::zesDeviceGetSubDevicePropertiesExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceGetSubDevicePropertiesExpEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceGetSubDevicePropertiesExpEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceGetSubDevicePropertiesExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDriverGetDeviceByUuidExpPrologue] = !std::is_same<decltype(&TChecker::zesDriverGetDeviceByUuidExpPrologue), decltype(&ZESValidationEntryPoints::zesDriverGetDeviceByUuidExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesDriverGetDeviceByUuidExpEpilogue] = !std::is_same<decltype(&TChecker::zesDriverGetDeviceByUuidExpEpilogue), decltype(&ZESValidationEntryPoints::zesDriverGetDeviceByUuidExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumActiveVFExpPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumActiveVFExpPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumActiveVFExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumActiveVFExpEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumActiveVFExpEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumActiveVFExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementGetVFPropertiesExpPrologue] = !std::is_same<decltype(&TChecker::zesVFManagementGetVFPropertiesExpPrologue), decltype(&ZESValidationEntryPoints::zesVFManagementGetVFPropertiesExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementGetVFPropertiesExpEpilogue] = !std::is_same<decltype(&TChecker::zesVFManagementGetVFPropertiesExpEpilogue), decltype(&ZESValidationEntryPoints::zesVFManagementGetVFPropertiesExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementGetVFMemoryUtilizationExpPrologue] = !std::is_same<decltype(&TChecker::zesVFManagementGetVFMemoryUtilizationExpPrologue), decltype(&ZESValidationEntryPoints::zesVFManagementGetVFMemoryUtilizationExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementGetVFMemoryUtilizationExpEpilogue] = !std::is_same<decltype(&TChecker::zesVFManagementGetVFMemoryUtilizationExpEpilogue), decltype(&ZESValidationEntryPoints::zesVFManagementGetVFMemoryUtilizationExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementGetVFEngineUtilizationExpPrologue] = !std::is_same<decltype(&TChecker::zesVFManagementGetVFEngineUtilizationExpPrologue), decltype(&ZESValidationEntryPoints::zesVFManagementGetVFEngineUtilizationExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementGetVFEngineUtilizationExpEpilogue] = !std::is_same<decltype(&TChecker::zesVFManagementGetVFEngineUtilizationExpEpilogue), decltype(&ZESValidationEntryPoints::zesVFManagementGetVFEngineUtilizationExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementSetVFTelemetryModeExpPrologue] = !std::is_same<decltype(&TChecker::zesVFManagementSetVFTelemetryModeExpPrologue), decltype(&ZESValidationEntryPoints::zesVFManagementSetVFTelemetryModeExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementSetVFTelemetryModeExpEpilogue] = !std::is_same<decltype(&TChecker::zesVFManagementSetVFTelemetryModeExpEpilogue), decltype(&ZESValidationEntryPoints::zesVFManagementSetVFTelemetryModeExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue] = !std::is_same<decltype(&TChecker::zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue), decltype(&ZESValidationEntryPoints::zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue] = !std::is_same<decltype(&TChecker::zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue), decltype(&ZESValidationEntryPoints::zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumEnabledVFExpPrologue] = !std::is_same<decltype(&TChecker::zesDeviceEnumEnabledVFExpPrologue), decltype(&ZESValidationEntryPoints::zesDeviceEnumEnabledVFExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesDeviceEnumEnabledVFExpEpilogue] = !std::is_same<decltype(&TChecker::zesDeviceEnumEnabledVFExpEpilogue), decltype(&ZESValidationEntryPoints::zesDeviceEnumEnabledVFExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementGetVFCapabilitiesExpPrologue] = !std::is_same<decltype(&TChecker::zesVFManagementGetVFCapabilitiesExpPrologue), decltype(&ZESValidationEntryPoints::zesVFManagementGetVFCapabilitiesExpPrologue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementGetVFCapabilitiesExpEpilogue] = !std::is_same<decltype(&TChecker::zesVFManagementGetVFCapabilitiesExpEpilogue), decltype(&ZESValidationEntryPoints::zesVFManagementGetVFCapabilitiesExpEpilogue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementGetVFMemoryUtilizationExp2Prologue] = !std::is_same<decltype(&TChecker::zesVFManagementGetVFMemoryUtilizationExp2Prologue), decltype(&ZESValidationEntryPoints::zesVFManagementGetVFMemoryUtilizationExp2Prologue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementGetVFMemoryUtilizationExp2Epilogue] = !std::is_same<decltype(&TChecker::zesVFManagementGetVFMemoryUtilizationExp2Epilogue), decltype(&ZESValidationEntryPoints::zesVFManagementGetVFMemoryUtilizationExp2Epilogue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementGetVFEngineUtilizationExp2Prologue] = !std::is_same<decltype(&TChecker::zesVFManagementGetVFEngineUtilizationExp2Prologue), decltype(&ZESValidationEntryPoints::zesVFManagementGetVFEngineUtilizationExp2Prologue)>::value;
+    overrides[ZESEntryPoint::zesVFManagementGetVFEngineUtilizationExp2Epilogue] = !std::is_same<decltype(&TChecker::zesVFManagementGetVFEngineUtilizationExp2Epilogue), decltype(&ZESValidationEntryPoints::zesVFManagementGetVFEngineUtilizationExp2Epilogue)>::value;
+    return overrides;
+}
 }
\ No newline at end of file
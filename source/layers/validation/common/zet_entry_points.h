@@ -11,6 +11,9 @@
  */
 #pragma once
 #include "zet_api.h"
+#include <bitset>
+#include <cstdint>
+#include <type_traits>
 
 namespace validation_layer
 {
@@ -18,137 +21,416 @@ namespace validation_layer
 class ZETValidationEntryPoints {
 public:
     virtual ze_result_t zetModuleGetDebugInfoPrologue( zet_module_handle_t hModule, zet_module_debug_info_format_t format, size_t* pSize, uint8_t* pDebugInfo ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetModuleGetDebugInfoEpilogue( zet_module_handle_t hModule, zet_module_debug_info_format_t format, size_t* pSize, uint8_t* pDebugInfo ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetModuleGetDebugInfoEpilogue( zet_module_handle_t hModule, zet_module_debug_info_format_t format, size_t* pSize, uint8_t* pDebugInfo, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDeviceGetDebugPropertiesPrologue( zet_device_handle_t hDevice, zet_device_debug_properties_t* pDebugProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDeviceGetDebugPropertiesEpilogue( zet_device_handle_t hDevice, zet_device_debug_properties_t* pDebugProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDeviceGetDebugPropertiesEpilogue( zet_device_handle_t hDevice, zet_device_debug_properties_t* pDebugProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDebugAttachPrologue( zet_device_handle_t hDevice, const zet_debug_config_t* config, zet_debug_session_handle_t* phDebug ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDebugAttachEpilogue( zet_device_handle_t hDevice, const zet_debug_config_t* config, zet_debug_session_handle_t* phDebug ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDebugAttachEpilogue( zet_device_handle_t hDevice, const zet_debug_config_t* config, zet_debug_session_handle_t* phDebug, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDebugDetachPrologue( zet_debug_session_handle_t hDebug ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDebugDetachEpilogue( zet_debug_session_handle_t hDebug ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDebugDetachEpilogue( zet_debug_session_handle_t hDebug, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDebugReadEventPrologue( zet_debug_session_handle_t hDebug, uint64_t timeout, zet_debug_event_t* event ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDebugReadEventEpilogue( zet_debug_session_handle_t hDebug, uint64_t timeout, zet_debug_event_t* event ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDebugReadEventEpilogue( zet_debug_session_handle_t hDebug, uint64_t timeout, zet_debug_event_t* event, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDebugAcknowledgeEventPrologue( zet_debug_session_handle_t hDebug, const zet_debug_event_t* event ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDebugAcknowledgeEventEpilogue( zet_debug_session_handle_t hDebug, const zet_debug_event_t* event ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDebugAcknowledgeEventEpilogue( zet_debug_session_handle_t hDebug, const zet_debug_event_t* event, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDebugInterruptPrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDebugInterruptEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDebugInterruptEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDebugResumePrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDebugResumeEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDebugResumeEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDebugReadMemoryPrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, const zet_debug_memory_space_desc_t* desc, size_t size, void* buffer ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDebugReadMemoryEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, const zet_debug_memory_space_desc_t* desc, size_t size, void* buffer ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDebugReadMemoryEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, const zet_debug_memory_space_desc_t* desc, size_t size, void* buffer, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDebugWriteMemoryPrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, const zet_debug_memory_space_desc_t* desc, size_t size, const void* buffer ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDebugWriteMemoryEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, const zet_debug_memory_space_desc_t* desc, size_t size, const void* buffer ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDebugWriteMemoryEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, const zet_debug_memory_space_desc_t* desc, size_t size, const void* buffer, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDebugGetRegisterSetPropertiesPrologue( zet_device_handle_t hDevice, uint32_t* pCount, zet_debug_regset_properties_t* pRegisterSetProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDebugGetRegisterSetPropertiesEpilogue( zet_device_handle_t hDevice, uint32_t* pCount, zet_debug_regset_properties_t* pRegisterSetProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDebugGetRegisterSetPropertiesEpilogue( zet_device_handle_t hDevice, uint32_t* pCount, zet_debug_regset_properties_t* pRegisterSetProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDebugGetThreadRegisterSetPropertiesPrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t* pCount, zet_debug_regset_properties_t* pRegisterSetProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDebugGetThreadRegisterSetPropertiesEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t* pCount, zet_debug_regset_properties_t* pRegisterSetProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDebugGetThreadRegisterSetPropertiesEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t* pCount, zet_debug_regset_properties_t* pRegisterSetProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDebugReadRegistersPrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t type, uint32_t start, uint32_t count, void* pRegisterValues ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDebugReadRegistersEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t type, uint32_t start, uint32_t count, void* pRegisterValues ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDebugReadRegistersEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t type, uint32_t start, uint32_t count, void* pRegisterValues, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDebugWriteRegistersPrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t type, uint32_t start, uint32_t count, void* pRegisterValues ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDebugWriteRegistersEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t type, uint32_t start, uint32_t count, void* pRegisterValues ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDebugWriteRegistersEpilogue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t type, uint32_t start, uint32_t count, void* pRegisterValues, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGroupGetPrologue( zet_device_handle_t hDevice, uint32_t* pCount, zet_metric_group_handle_t* phMetricGroups ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGroupGetEpilogue( zet_device_handle_t hDevice, uint32_t* pCount, zet_metric_group_handle_t* phMetricGroups ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGroupGetEpilogue( zet_device_handle_t hDevice, uint32_t* pCount, zet_metric_group_handle_t* phMetricGroups, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGroupGetPropertiesPrologue( zet_metric_group_handle_t hMetricGroup, zet_metric_group_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGroupGetPropertiesEpilogue( zet_metric_group_handle_t hMetricGroup, zet_metric_group_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGroupGetPropertiesEpilogue( zet_metric_group_handle_t hMetricGroup, zet_metric_group_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGroupCalculateMetricValuesPrologue( zet_metric_group_handle_t hMetricGroup, zet_metric_group_calculation_type_t type, size_t rawDataSize, const uint8_t* pRawData, uint32_t* pMetricValueCount, zet_typed_value_t* pMetricValues ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGroupCalculateMetricValuesEpilogue( zet_metric_group_handle_t hMetricGroup, zet_metric_group_calculation_type_t type, size_t rawDataSize, const uint8_t* pRawData, uint32_t* pMetricValueCount, zet_typed_value_t* pMetricValues ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGroupCalculateMetricValuesEpilogue( zet_metric_group_handle_t hMetricGroup, zet_metric_group_calculation_type_t type, size_t rawDataSize, const uint8_t* pRawData, uint32_t* pMetricValueCount, zet_typed_value_t* pMetricValues, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGetPrologue( zet_metric_group_handle_t hMetricGroup, uint32_t* pCount, zet_metric_handle_t* phMetrics ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGetEpilogue( zet_metric_group_handle_t hMetricGroup, uint32_t* pCount, zet_metric_handle_t* phMetrics ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGetEpilogue( zet_metric_group_handle_t hMetricGroup, uint32_t* pCount, zet_metric_handle_t* phMetrics, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGetPropertiesPrologue( zet_metric_handle_t hMetric, zet_metric_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGetPropertiesEpilogue( zet_metric_handle_t hMetric, zet_metric_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGetPropertiesEpilogue( zet_metric_handle_t hMetric, zet_metric_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetContextActivateMetricGroupsPrologue( zet_context_handle_t hContext, zet_device_handle_t hDevice, uint32_t count, zet_metric_group_handle_t* phMetricGroups ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetContextActivateMetricGroupsEpilogue( zet_context_handle_t hContext, zet_device_handle_t hDevice, uint32_t count, zet_metric_group_handle_t* phMetricGroups ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetContextActivateMetricGroupsEpilogue( zet_context_handle_t hContext, zet_device_handle_t hDevice, uint32_t count, zet_metric_group_handle_t* phMetricGroups, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricStreamerOpenPrologue( zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup, zet_metric_streamer_desc_t* desc, ze_event_handle_t hNotificationEvent, zet_metric_streamer_handle_t* phMetricStreamer ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricStreamerOpenEpilogue( zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup, zet_metric_streamer_desc_t* desc, ze_event_handle_t hNotificationEvent, zet_metric_streamer_handle_t* phMetricStreamer ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricStreamerOpenEpilogue( zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup, zet_metric_streamer_desc_t* desc, ze_event_handle_t hNotificationEvent, zet_metric_streamer_handle_t* phMetricStreamer, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetCommandListAppendMetricStreamerMarkerPrologue( zet_command_list_handle_t hCommandList, zet_metric_streamer_handle_t hMetricStreamer, uint32_t value ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetCommandListAppendMetricStreamerMarkerEpilogue( zet_command_list_handle_t hCommandList, zet_metric_streamer_handle_t hMetricStreamer, uint32_t value ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetCommandListAppendMetricStreamerMarkerEpilogue( zet_command_list_handle_t hCommandList, zet_metric_streamer_handle_t hMetricStreamer, uint32_t value, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricStreamerClosePrologue( zet_metric_streamer_handle_t hMetricStreamer ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricStreamerCloseEpilogue( zet_metric_streamer_handle_t hMetricStreamer ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricStreamerCloseEpilogue( zet_metric_streamer_handle_t hMetricStreamer, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricStreamerReadDataPrologue( zet_metric_streamer_handle_t hMetricStreamer, uint32_t maxReportCount, size_t* pRawDataSize, uint8_t* pRawData ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricStreamerReadDataEpilogue( zet_metric_streamer_handle_t hMetricStreamer, uint32_t maxReportCount, size_t* pRawDataSize, uint8_t* pRawData ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricStreamerReadDataEpilogue( zet_metric_streamer_handle_t hMetricStreamer, uint32_t maxReportCount, size_t* pRawDataSize, uint8_t* pRawData, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricQueryPoolCreatePrologue( zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup, const zet_metric_query_pool_desc_t* desc, zet_metric_query_pool_handle_t* phMetricQueryPool ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricQueryPoolCreateEpilogue( zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup, const zet_metric_query_pool_desc_t* desc, zet_metric_query_pool_handle_t* phMetricQueryPool ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricQueryPoolCreateEpilogue( zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup, const zet_metric_query_pool_desc_t* desc, zet_metric_query_pool_handle_t* phMetricQueryPool, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricQueryPoolDestroyPrologue( zet_metric_query_pool_handle_t hMetricQueryPool ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricQueryPoolDestroyEpilogue( zet_metric_query_pool_handle_t hMetricQueryPool ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricQueryPoolDestroyEpilogue( zet_metric_query_pool_handle_t hMetricQueryPool, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricQueryCreatePrologue( zet_metric_query_pool_handle_t hMetricQueryPool, uint32_t index, zet_metric_query_handle_t* phMetricQuery ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricQueryCreateEpilogue( zet_metric_query_pool_handle_t hMetricQueryPool, uint32_t index, zet_metric_query_handle_t* phMetricQuery ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricQueryCreateEpilogue( zet_metric_query_pool_handle_t hMetricQueryPool, uint32_t index, zet_metric_query_handle_t* phMetricQuery, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricQueryDestroyPrologue( zet_metric_query_handle_t hMetricQuery ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricQueryDestroyEpilogue( zet_metric_query_handle_t hMetricQuery ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricQueryDestroyEpilogue( zet_metric_query_handle_t hMetricQuery, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricQueryResetPrologue( zet_metric_query_handle_t hMetricQuery ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricQueryResetEpilogue( zet_metric_query_handle_t hMetricQuery ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricQueryResetEpilogue( zet_metric_query_handle_t hMetricQuery, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetCommandListAppendMetricQueryBeginPrologue( zet_command_list_handle_t hCommandList, zet_metric_query_handle_t hMetricQuery ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetCommandListAppendMetricQueryBeginEpilogue( zet_command_list_handle_t hCommandList, zet_metric_query_handle_t hMetricQuery ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetCommandListAppendMetricQueryBeginEpilogue( zet_command_list_handle_t hCommandList, zet_metric_query_handle_t hMetricQuery, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetCommandListAppendMetricQueryEndPrologue( zet_command_list_handle_t hCommandList, zet_metric_query_handle_t hMetricQuery, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetCommandListAppendMetricQueryEndEpilogue( zet_command_list_handle_t hCommandList, zet_metric_query_handle_t hMetricQuery, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetCommandListAppendMetricQueryEndEpilogue( zet_command_list_handle_t hCommandList, zet_metric_query_handle_t hMetricQuery, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetCommandListAppendMetricMemoryBarrierPrologue( zet_command_list_handle_t hCommandList ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetCommandListAppendMetricMemoryBarrierEpilogue( zet_command_list_handle_t hCommandList ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetCommandListAppendMetricMemoryBarrierEpilogue( zet_command_list_handle_t hCommandList, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricQueryGetDataPrologue( zet_metric_query_handle_t hMetricQuery, size_t* pRawDataSize, uint8_t* pRawData ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricQueryGetDataEpilogue( zet_metric_query_handle_t hMetricQuery, size_t* pRawDataSize, uint8_t* pRawData ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricQueryGetDataEpilogue( zet_metric_query_handle_t hMetricQuery, size_t* pRawDataSize, uint8_t* pRawData, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetKernelGetProfileInfoPrologue( zet_kernel_handle_t hKernel, zet_profile_properties_t* pProfileProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetKernelGetProfileInfoEpilogue( zet_kernel_handle_t hKernel, zet_profile_properties_t* pProfileProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetKernelGetProfileInfoEpilogue( zet_kernel_handle_t hKernel, zet_profile_properties_t* pProfileProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetTracerExpCreatePrologue( zet_context_handle_t hContext, const zet_tracer_exp_desc_t* desc, zet_tracer_exp_handle_t* phTracer ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetTracerExpCreateEpilogue( zet_context_handle_t hContext, const zet_tracer_exp_desc_t* desc, zet_tracer_exp_handle_t* phTracer ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetTracerExpCreateEpilogue( zet_context_handle_t hContext, const zet_tracer_exp_desc_t* desc, zet_tracer_exp_handle_t* phTracer, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetTracerExpDestroyPrologue( zet_tracer_exp_handle_t hTracer ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetTracerExpDestroyEpilogue( zet_tracer_exp_handle_t hTracer ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetTracerExpDestroyEpilogue( zet_tracer_exp_handle_t hTracer, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetTracerExpSetProloguesPrologue( zet_tracer_exp_handle_t hTracer, zet_core_callbacks_t* pCoreCbs ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetTracerExpSetProloguesEpilogue( zet_tracer_exp_handle_t hTracer, zet_core_callbacks_t* pCoreCbs ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetTracerExpSetProloguesEpilogue( zet_tracer_exp_handle_t hTracer, zet_core_callbacks_t* pCoreCbs, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetTracerExpSetEpiloguesPrologue( zet_tracer_exp_handle_t hTracer, zet_core_callbacks_t* pCoreCbs ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetTracerExpSetEpiloguesEpilogue( zet_tracer_exp_handle_t hTracer, zet_core_callbacks_t* pCoreCbs ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetTracerExpSetEpiloguesEpilogue( zet_tracer_exp_handle_t hTracer, zet_core_callbacks_t* pCoreCbs, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetTracerExpSetEnabledPrologue( zet_tracer_exp_handle_t hTracer, ze_bool_t enable ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetTracerExpSetEnabledEpilogue( zet_tracer_exp_handle_t hTracer, ze_bool_t enable ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetTracerExpSetEnabledEpilogue( zet_tracer_exp_handle_t hTracer, ze_bool_t enable, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDeviceGetConcurrentMetricGroupsExpPrologue( zet_device_handle_t hDevice, uint32_t metricGroupCount, zet_metric_group_handle_t * phMetricGroups, uint32_t * pMetricGroupsCountPerConcurrentGroup, uint32_t * pConcurrentGroupCount ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDeviceGetConcurrentMetricGroupsExpEpilogue( zet_device_handle_t hDevice, uint32_t metricGroupCount, zet_metric_group_handle_t * phMetricGroups, uint32_t * pMetricGroupsCountPerConcurrentGroup, uint32_t * pConcurrentGroupCount ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDeviceGetConcurrentMetricGroupsExpEpilogue( zet_device_handle_t hDevice, uint32_t metricGroupCount, zet_metric_group_handle_t * phMetricGroups, uint32_t * pMetricGroupsCountPerConcurrentGroup, uint32_t * pConcurrentGroupCount, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricTracerCreateExpPrologue( zet_context_handle_t hContext, zet_device_handle_t hDevice, uint32_t metricGroupCount, zet_metric_group_handle_t* phMetricGroups, zet_metric_tracer_exp_desc_t* desc, ze_event_handle_t hNotificationEvent, zet_metric_tracer_exp_handle_t* phMetricTracer ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricTracerCreateExpEpilogue( zet_context_handle_t hContext, zet_device_handle_t hDevice, uint32_t metricGroupCount, zet_metric_group_handle_t* phMetricGroups, zet_metric_tracer_exp_desc_t* desc, ze_event_handle_t hNotificationEvent, zet_metric_tracer_exp_handle_t* phMetricTracer ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricTracerCreateExpEpilogue( zet_context_handle_t hContext, zet_device_handle_t hDevice, uint32_t metricGroupCount, zet_metric_group_handle_t* phMetricGroups, zet_metric_tracer_exp_desc_t* desc, ze_event_handle_t hNotificationEvent, zet_metric_tracer_exp_handle_t* phMetricTracer, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricTracerDestroyExpPrologue( zet_metric_tracer_exp_handle_t hMetricTracer ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricTracerDestroyExpEpilogue( zet_metric_tracer_exp_handle_t hMetricTracer ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricTracerDestroyExpEpilogue( zet_metric_tracer_exp_handle_t hMetricTracer, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricTracerEnableExpPrologue( zet_metric_tracer_exp_handle_t hMetricTracer, ze_bool_t synchronous ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricTracerEnableExpEpilogue( zet_metric_tracer_exp_handle_t hMetricTracer, ze_bool_t synchronous ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricTracerEnableExpEpilogue( zet_metric_tracer_exp_handle_t hMetricTracer, ze_bool_t synchronous, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricTracerDisableExpPrologue( zet_metric_tracer_exp_handle_t hMetricTracer, ze_bool_t synchronous ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricTracerDisableExpEpilogue( zet_metric_tracer_exp_handle_t hMetricTracer, ze_bool_t synchronous ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricTracerDisableExpEpilogue( zet_metric_tracer_exp_handle_t hMetricTracer, ze_bool_t synchronous, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricTracerReadDataExpPrologue( zet_metric_tracer_exp_handle_t hMetricTracer, size_t* pRawDataSize, uint8_t* pRawData ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricTracerReadDataExpEpilogue( zet_metric_tracer_exp_handle_t hMetricTracer, size_t* pRawDataSize, uint8_t* pRawData ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricTracerReadDataExpEpilogue( zet_metric_tracer_exp_handle_t hMetricTracer, size_t* pRawDataSize, uint8_t* pRawData, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricDecoderCreateExpPrologue( zet_metric_tracer_exp_handle_t hMetricTracer, zet_metric_decoder_exp_handle_t* phMetricDecoder ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricDecoderCreateExpEpilogue( zet_metric_tracer_exp_handle_t hMetricTracer, zet_metric_decoder_exp_handle_t* phMetricDecoder ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricDecoderCreateExpEpilogue( zet_metric_tracer_exp_handle_t hMetricTracer, zet_metric_decoder_exp_handle_t* phMetricDecoder, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricDecoderDestroyExpPrologue( zet_metric_decoder_exp_handle_t phMetricDecoder ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricDecoderDestroyExpEpilogue( zet_metric_decoder_exp_handle_t phMetricDecoder ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricDecoderDestroyExpEpilogue( zet_metric_decoder_exp_handle_t phMetricDecoder, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricDecoderGetDecodableMetricsExpPrologue( zet_metric_decoder_exp_handle_t hMetricDecoder, uint32_t* pCount, zet_metric_handle_t* phMetrics ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricDecoderGetDecodableMetricsExpEpilogue( zet_metric_decoder_exp_handle_t hMetricDecoder, uint32_t* pCount, zet_metric_handle_t* phMetrics ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricDecoderGetDecodableMetricsExpEpilogue( zet_metric_decoder_exp_handle_t hMetricDecoder, uint32_t* pCount, zet_metric_handle_t* phMetrics, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricTracerDecodeExpPrologue( zet_metric_decoder_exp_handle_t phMetricDecoder, size_t* pRawDataSize, uint8_t* pRawData, uint32_t metricsCount, zet_metric_handle_t* phMetrics, uint32_t* pSetCount, uint32_t* pMetricEntriesCountPerSet, uint32_t* pMetricEntriesCount, zet_metric_entry_exp_t* pMetricEntries ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricTracerDecodeExpEpilogue( zet_metric_decoder_exp_handle_t phMetricDecoder, size_t* pRawDataSize, uint8_t* pRawData, uint32_t metricsCount, zet_metric_handle_t* phMetrics, uint32_t* pSetCount, uint32_t* pMetricEntriesCountPerSet, uint32_t* pMetricEntriesCount, zet_metric_entry_exp_t* pMetricEntries ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricTracerDecodeExpEpilogue( zet_metric_decoder_exp_handle_t phMetricDecoder, size_t* pRawDataSize, uint8_t* pRawData, uint32_t metricsCount, zet_metric_handle_t* phMetrics, uint32_t* pSetCount, uint32_t* pMetricEntriesCountPerSet, uint32_t* pMetricEntriesCount, zet_metric_entry_exp_t* pMetricEntries, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGroupCalculateMultipleMetricValuesExpPrologue( zet_metric_group_handle_t hMetricGroup, zet_metric_group_calculation_type_t type, size_t rawDataSize, const uint8_t* pRawData, uint32_t* pSetCount, uint32_t* pTotalMetricValueCount, uint32_t* pMetricCounts, zet_typed_value_t* pMetricValues ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGroupCalculateMultipleMetricValuesExpEpilogue( zet_metric_group_handle_t hMetricGroup, zet_metric_group_calculation_type_t type, size_t rawDataSize, const uint8_t* pRawData, uint32_t* pSetCount, uint32_t* pTotalMetricValueCount, uint32_t* pMetricCounts, zet_typed_value_t* pMetricValues ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGroupCalculateMultipleMetricValuesExpEpilogue( zet_metric_group_handle_t hMetricGroup, zet_metric_group_calculation_type_t type, size_t rawDataSize, const uint8_t* pRawData, uint32_t* pSetCount, uint32_t* pTotalMetricValueCount, uint32_t* pMetricCounts, zet_typed_value_t* pMetricValues, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGroupGetGlobalTimestampsExpPrologue( zet_metric_group_handle_t hMetricGroup, ze_bool_t synchronizedWithHost, uint64_t* globalTimestamp, uint64_t* metricTimestamp ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGroupGetGlobalTimestampsExpEpilogue( zet_metric_group_handle_t hMetricGroup, ze_bool_t synchronizedWithHost, uint64_t* globalTimestamp, uint64_t* metricTimestamp ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGroupGetGlobalTimestampsExpEpilogue( zet_metric_group_handle_t hMetricGroup, ze_bool_t synchronizedWithHost, uint64_t* globalTimestamp, uint64_t* metricTimestamp, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGroupGetExportDataExpPrologue( zet_metric_group_handle_t hMetricGroup, const uint8_t* pRawData, size_t rawDataSize, size_t* pExportDataSize, uint8_t * pExportData ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGroupGetExportDataExpEpilogue( zet_metric_group_handle_t hMetricGroup, const uint8_t* pRawData, size_t rawDataSize, size_t* pExportDataSize, uint8_t * pExportData ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGroupGetExportDataExpEpilogue( zet_metric_group_handle_t hMetricGroup, const uint8_t* pRawData, size_t rawDataSize, size_t* pExportDataSize, uint8_t * pExportData, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGroupCalculateMetricExportDataExpPrologue( ze_driver_handle_t hDriver, zet_metric_group_calculation_type_t type, size_t exportDataSize, const uint8_t* pExportData, zet_metric_calculate_exp_desc_t* pCalculateDescriptor, uint32_t* pSetCount, uint32_t* pTotalMetricValueCount, uint32_t* pMetricCounts, zet_typed_value_t* pMetricValues ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGroupCalculateMetricExportDataExpEpilogue( ze_driver_handle_t hDriver, zet_metric_group_calculation_type_t type, size_t exportDataSize, const uint8_t* pExportData, zet_metric_calculate_exp_desc_t* pCalculateDescriptor, uint32_t* pSetCount, uint32_t* pTotalMetricValueCount, uint32_t* pMetricCounts, zet_typed_value_t* pMetricValues ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGroupCalculateMetricExportDataExpEpilogue( ze_driver_handle_t hDriver, zet_metric_group_calculation_type_t type, size_t exportDataSize, const uint8_t* pExportData, zet_metric_calculate_exp_desc_t* pCalculateDescriptor, uint32_t* pSetCount, uint32_t* pTotalMetricValueCount, uint32_t* pMetricCounts, zet_typed_value_t* pMetricValues, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricProgrammableGetExpPrologue( zet_device_handle_t hDevice, uint32_t* pCount, zet_metric_programmable_exp_handle_t* phMetricProgrammables ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricProgrammableGetExpEpilogue( zet_device_handle_t hDevice, uint32_t* pCount, zet_metric_programmable_exp_handle_t* phMetricProgrammables ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricProgrammableGetExpEpilogue( zet_device_handle_t hDevice, uint32_t* pCount, zet_metric_programmable_exp_handle_t* phMetricProgrammables, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricProgrammableGetPropertiesExpPrologue( zet_metric_programmable_exp_handle_t hMetricProgrammable, zet_metric_programmable_exp_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricProgrammableGetPropertiesExpEpilogue( zet_metric_programmable_exp_handle_t hMetricProgrammable, zet_metric_programmable_exp_properties_t* pProperties ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricProgrammableGetPropertiesExpEpilogue( zet_metric_programmable_exp_handle_t hMetricProgrammable, zet_metric_programmable_exp_properties_t* pProperties, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricProgrammableGetParamInfoExpPrologue( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t* pParameterCount, zet_metric_programmable_param_info_exp_t* pParameterInfo ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricProgrammableGetParamInfoExpEpilogue( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t* pParameterCount, zet_metric_programmable_param_info_exp_t* pParameterInfo ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricProgrammableGetParamInfoExpEpilogue( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t* pParameterCount, zet_metric_programmable_param_info_exp_t* pParameterInfo, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricProgrammableGetParamValueInfoExpPrologue( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t parameterOrdinal, uint32_t* pValueInfoCount, zet_metric_programmable_param_value_info_exp_t* pValueInfo ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricProgrammableGetParamValueInfoExpEpilogue( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t parameterOrdinal, uint32_t* pValueInfoCount, zet_metric_programmable_param_value_info_exp_t* pValueInfo ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricProgrammableGetParamValueInfoExpEpilogue( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t parameterOrdinal, uint32_t* pValueInfoCount, zet_metric_programmable_param_value_info_exp_t* pValueInfo, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricCreateFromProgrammableExp2Prologue( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t parameterCount, zet_metric_programmable_param_value_exp_t* pParameterValues, const char* pName, const char* pDescription, uint32_t* pMetricHandleCount, zet_metric_handle_t* phMetricHandles ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricCreateFromProgrammableExp2Epilogue( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t parameterCount, zet_metric_programmable_param_value_exp_t* pParameterValues, const char* pName, const char* pDescription, uint32_t* pMetricHandleCount, zet_metric_handle_t* phMetricHandles ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricCreateFromProgrammableExp2Epilogue( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t parameterCount, zet_metric_programmable_param_value_exp_t* pParameterValues, const char* pName, const char* pDescription, uint32_t* pMetricHandleCount, zet_metric_handle_t* phMetricHandles, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricCreateFromProgrammableExpPrologue( zet_metric_programmable_exp_handle_t hMetricProgrammable, zet_metric_programmable_param_value_exp_t* pParameterValues, uint32_t parameterCount, const char* pName, const char* pDescription, uint32_t* pMetricHandleCount, zet_metric_handle_t* phMetricHandles ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricCreateFromProgrammableExpEpilogue( zet_metric_programmable_exp_handle_t hMetricProgrammable, zet_metric_programmable_param_value_exp_t* pParameterValues, uint32_t parameterCount, const char* pName, const char* pDescription, uint32_t* pMetricHandleCount, zet_metric_handle_t* phMetricHandles ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricCreateFromProgrammableExpEpilogue( zet_metric_programmable_exp_handle_t hMetricProgrammable, zet_metric_programmable_param_value_exp_t* pParameterValues, uint32_t parameterCount, const char* pName, const char* pDescription, uint32_t* pMetricHandleCount, zet_metric_handle_t* phMetricHandles, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetDeviceCreateMetricGroupsFromMetricsExpPrologue( zet_device_handle_t hDevice, uint32_t metricCount, zet_metric_handle_t * phMetrics, const char * pMetricGroupNamePrefix, const char * pDescription, uint32_t * pMetricGroupCount, zet_metric_group_handle_t* phMetricGroup ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetDeviceCreateMetricGroupsFromMetricsExpEpilogue( zet_device_handle_t hDevice, uint32_t metricCount, zet_metric_handle_t * phMetrics, const char * pMetricGroupNamePrefix, const char * pDescription, uint32_t * pMetricGroupCount, zet_metric_group_handle_t* phMetricGroup ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetDeviceCreateMetricGroupsFromMetricsExpEpilogue( zet_device_handle_t hDevice, uint32_t metricCount, zet_metric_handle_t * phMetrics, const char * pMetricGroupNamePrefix, const char * pDescription, uint32_t * pMetricGroupCount, zet_metric_group_handle_t* phMetricGroup, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGroupCreateExpPrologue( zet_device_handle_t hDevice, const char* pName, const char* pDescription, zet_metric_group_sampling_type_flags_t samplingType, zet_metric_group_handle_t* phMetricGroup ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGroupCreateExpEpilogue( zet_device_handle_t hDevice, const char* pName, const char* pDescription, zet_metric_group_sampling_type_flags_t samplingType, zet_metric_group_handle_t* phMetricGroup ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGroupCreateExpEpilogue( zet_device_handle_t hDevice, const char* pName, const char* pDescription, zet_metric_group_sampling_type_flags_t samplingType, zet_metric_group_handle_t* phMetricGroup, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGroupAddMetricExpPrologue( zet_metric_group_handle_t hMetricGroup, zet_metric_handle_t hMetric, size_t * pErrorStringSize, char* pErrorString ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGroupAddMetricExpEpilogue( zet_metric_group_handle_t hMetricGroup, zet_metric_handle_t hMetric, size_t * pErrorStringSize, char* pErrorString ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGroupAddMetricExpEpilogue( zet_metric_group_handle_t hMetricGroup, zet_metric_handle_t hMetric, size_t * pErrorStringSize, char* pErrorString, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGroupRemoveMetricExpPrologue( zet_metric_group_handle_t hMetricGroup, zet_metric_handle_t hMetric ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGroupRemoveMetricExpEpilogue( zet_metric_group_handle_t hMetricGroup, zet_metric_handle_t hMetric ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGroupRemoveMetricExpEpilogue( zet_metric_group_handle_t hMetricGroup, zet_metric_handle_t hMetric, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGroupCloseExpPrologue( zet_metric_group_handle_t hMetricGroup ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGroupCloseExpEpilogue( zet_metric_group_handle_t hMetricGroup ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGroupCloseExpEpilogue( zet_metric_group_handle_t hMetricGroup, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricGroupDestroyExpPrologue( zet_metric_group_handle_t hMetricGroup ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricGroupDestroyExpEpilogue( zet_metric_group_handle_t hMetricGroup ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricGroupDestroyExpEpilogue( zet_metric_group_handle_t hMetricGroup, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ze_result_t zetMetricDestroyExpPrologue( zet_metric_handle_t hMetric ) {return ZE_RESULT_SUCCESS;}
-    virtual ze_result_t zetMetricDestroyExpEpilogue( zet_metric_handle_t hMetric ) {return ZE_RESULT_SUCCESS;}
+    virtual ze_result_t zetMetricDestroyExpEpilogue( zet_metric_handle_t hMetric, ze_result_t result ) {return ZE_RESULT_SUCCESS;}
     virtual ~ZETValidationEntryPoints() {}
 };
+
+// Index of each entry point, for the lists of checkers overriding it.
+namespace ZETEntryPoint {
+enum : uint32_t {
+    zetModuleGetDebugInfoPrologue,
+    zetModuleGetDebugInfoEpilogue,
+    zetDeviceGetDebugPropertiesPrologue,
+    zetDeviceGetDebugPropertiesEpilogue,
+    zetDebugAttachPrologue,
+    zetDebugAttachEpilogue,
+    zetDebugDetachPrologue,
+    zetDebugDetachEpilogue,
+    zetDebugReadEventPrologue,
+    zetDebugReadEventEpilogue,
+    zetDebugAcknowledgeEventPrologue,
+    zetDebugAcknowledgeEventEpilogue,
+    zetDebugInterruptPrologue,
+    zetDebugInterruptEpilogue,
+    zetDebugResumePrologue,
+    zetDebugResumeEpilogue,
+    zetDebugReadMemoryPrologue,
+    zetDebugReadMemoryEpilogue,
+    zetDebugWriteMemoryPrologue,
+    zetDebugWriteMemoryEpilogue,
+    zetDebugGetRegisterSetPropertiesPrologue,
+    zetDebugGetRegisterSetPropertiesEpilogue,
+    zetDebugGetThreadRegisterSetPropertiesPrologue,
+    zetDebugGetThreadRegisterSetPropertiesEpilogue,
+    zetDebugReadRegistersPrologue,
+    zetDebugReadRegistersEpilogue,
+    zetDebugWriteRegistersPrologue,
+    zetDebugWriteRegistersEpilogue,
+    zetMetricGroupGetPrologue,
+    zetMetricGroupGetEpilogue,
+    zetMetricGroupGetPropertiesPrologue,
+    zetMetricGroupGetPropertiesEpilogue,
+    zetMetricGroupCalculateMetricValuesPrologue,
+    zetMetricGroupCalculateMetricValuesEpilogue,
+    zetMetricGetPrologue,
+    zetMetricGetEpilogue,
+    zetMetricGetPropertiesPrologue,
+    zetMetricGetPropertiesEpilogue,
+    zetContextActivateMetricGroupsPrologue,
+    zetContextActivateMetricGroupsEpilogue,
+    zetMetricStreamerOpenPrologue,
+    zetMetricStreamerOpenEpilogue,
+    zetCommandListAppendMetricStreamerMarkerPrologue,
+    zetCommandListAppendMetricStreamerMarkerEpilogue,
+    zetMetricStreamerClosePrologue,
+    zetMetricStreamerCloseEpilogue,
+    zetMetricStreamerReadDataPrologue,
+    zetMetricStreamerReadDataEpilogue,
+    zetMetricQueryPoolCreatePrologue,
+    zetMetricQueryPoolCreateEpilogue,
+    zetMetricQueryPoolDestroyPrologue,
+    zetMetricQueryPoolDestroyEpilogue,
+    zetMetricQueryCreatePrologue,
+    zetMetricQueryCreateEpilogue,
+    zetMetricQueryDestroyPrologue,
+    zetMetricQueryDestroyEpilogue,
+    zetMetricQueryResetPrologue,
+    zetMetricQueryResetEpilogue,
+    zetCommandListAppendMetricQueryBeginPrologue,
+    zetCommandListAppendMetricQueryBeginEpilogue,
+    zetCommandListAppendMetricQueryEndPrologue,
+    zetCommandListAppendMetricQueryEndEpilogue,
+    zetCommandListAppendMetricMemoryBarrierPrologue,
+    zetCommandListAppendMetricMemoryBarrierEpilogue,
+    zetMetricQueryGetDataPrologue,
+    zetMetricQueryGetDataEpilogue,
+    zetKernelGetProfileInfoPrologue,
+    zetKernelGetProfileInfoEpilogue,
+    zetTracerExpCreatePrologue,
+    zetTracerExpCreateEpilogue,
+    zetTracerExpDestroyPrologue,
+    zetTracerExpDestroyEpilogue,
+    zetTracerExpSetProloguesPrologue,
+    zetTracerExpSetProloguesEpilogue,
+    zetTracerExpSetEpiloguesPrologue,
+    zetTracerExpSetEpiloguesEpilogue,
+    zetTracerExpSetEnabledPrologue,
+    zetTracerExpSetEnabledEpilogue,
+    zetDeviceGetConcurrentMetricGroupsExpPrologue,
+    zetDeviceGetConcurrentMetricGroupsExpEpilogue,
+    zetMetricTracerCreateExpPrologue,
+    zetMetricTracerCreateExpEpilogue,
+    zetMetricTracerDestroyExpPrologue,
+    zetMetricTracerDestroyExpEpilogue,
+    zetMetricTracerEnableExpPrologue,
+    zetMetricTracerEnableExpEpilogue,
+    zetMetricTracerDisableExpPrologue,
+    zetMetricTracerDisableExpEpilogue,
+    zetMetricTracerReadDataExpPrologue,
+    zetMetricTracerReadDataExpEpilogue,
+    zetMetricDecoderCreateExpPrologue,
+    zetMetricDecoderCreateExpEpilogue,
+    zetMetricDecoderDestroyExpPrologue,
+    zetMetricDecoderDestroyExpEpilogue,
+    zetMetricDecoderGetDecodableMetricsExpPrologue,
+    zetMetricDecoderGetDecodableMetricsExpEpilogue,
+    zetMetricTracerDecodeExpPrologue,
+    zetMetricTracerDecodeExpEpilogue,
+    zetMetricGroupCalculateMultipleMetricValuesExpPrologue,
+    zetMetricGroupCalculateMultipleMetricValuesExpEpilogue,
+    zetMetricGroupGetGlobalTimestampsExpPrologue,
+    zetMetricGroupGetGlobalTimestampsExpEpilogue,
+    zetMetricGroupGetExportDataExpPrologue,
+    zetMetricGroupGetExportDataExpEpilogue,
+    zetMetricGroupCalculateMetricExportDataExpPrologue,
+    zetMetricGroupCalculateMetricExportDataExpEpilogue,
+    zetMetricProgrammableGetExpPrologue,
+    zetMetricProgrammableGetExpEpilogue,
+    zetMetricProgrammableGetPropertiesExpPrologue,
+    zetMetricProgrammableGetPropertiesExpEpilogue,
+    zetMetricProgrammableGetParamInfoExpPrologue,
+    zetMetricProgrammableGetParamInfoExpEpilogue,
+    zetMetricProgrammableGetParamValueInfoExpPrologue,
+    zetMetricProgrammableGetParamValueInfoExpEpilogue,
+    zetMetricCreateFromProgrammableExp2Prologue,
+    zetMetricCreateFromProgrammableExp2Epilogue,
+    zetMetricCreateFromProgrammableExpPrologue,
+    zetMetricCreateFromProgrammableExpEpilogue,
+    zetDeviceCreateMetricGroupsFromMetricsExpPrologue,
+    zetDeviceCreateMetricGroupsFromMetricsExpEpilogue,
+    zetMetricGroupCreateExpPrologue,
+    zetMetricGroupCreateExpEpilogue,
+    zetMetricGroupAddMetricExpPrologue,
+    zetMetricGroupAddMetricExpEpilogue,
+    zetMetricGroupRemoveMetricExpPrologue,
+    zetMetricGroupRemoveMetricExpEpilogue,
+    zetMetricGroupCloseExpPrologue,
+    zetMetricGroupCloseExpEpilogue,
+    zetMetricGroupDestroyExpPrologue,
+    zetMetricGroupDestroyExpEpilogue,
+    zetMetricDestroyExpPrologue,
+    zetMetricDestroyExpEpilogue,
+    Count
+};
+}
+
+// Entry points a checker class overrides, told apart from the defaults
+// above by the class their member pointers belong to.
+template <typename TChecker>
+std::bitset<ZETEntryPoint::Count> getZETOverriddenEntryPoints() {
+    std::bitset<ZETEntryPoint::Count> overrides;
+    overrides[ZETEntryPoint::zetModuleGetDebugInfoPrologue] = !std::is_same<decltype(&TChecker::zetModuleGetDebugInfoPrologue), decltype(&ZETValidationEntryPoints::zetModuleGetDebugInfoPrologue)>::value;
+    overrides[ZETEntryPoint::zetModuleGetDebugInfoEpilogue] = !std::is_same<decltype(&TChecker::zetModuleGetDebugInfoEpilogue), decltype(&ZETValidationEntryPoints::zetModuleGetDebugInfoEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDeviceGetDebugPropertiesPrologue] = !std::is_same<decltype(&TChecker::zetDeviceGetDebugPropertiesPrologue), decltype(&ZETValidationEntryPoints::zetDeviceGetDebugPropertiesPrologue)>::value;
+    overrides[ZETEntryPoint::zetDeviceGetDebugPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zetDeviceGetDebugPropertiesEpilogue), decltype(&ZETValidationEntryPoints::zetDeviceGetDebugPropertiesEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDebugAttachPrologue] = !std::is_same<decltype(&TChecker::zetDebugAttachPrologue), decltype(&ZETValidationEntryPoints::zetDebugAttachPrologue)>::value;
+    overrides[ZETEntryPoint::zetDebugAttachEpilogue] = !std::is_same<decltype(&TChecker::zetDebugAttachEpilogue), decltype(&ZETValidationEntryPoints::zetDebugAttachEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDebugDetachPrologue] = !std::is_same<decltype(&TChecker::zetDebugDetachPrologue), decltype(&ZETValidationEntryPoints::zetDebugDetachPrologue)>::value;
+    overrides[ZETEntryPoint::zetDebugDetachEpilogue] = !std::is_same<decltype(&TChecker::zetDebugDetachEpilogue), decltype(&ZETValidationEntryPoints::zetDebugDetachEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDebugReadEventPrologue] = !std::is_same<decltype(&TChecker::zetDebugReadEventPrologue), decltype(&ZETValidationEntryPoints::zetDebugReadEventPrologue)>::value;
+    overrides[ZETEntryPoint::zetDebugReadEventEpilogue] = !std::is_same<decltype(&TChecker::zetDebugReadEventEpilogue), decltype(&ZETValidationEntryPoints::zetDebugReadEventEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDebugAcknowledgeEventPrologue] = !std::is_same<decltype(&TChecker::zetDebugAcknowledgeEventPrologue), decltype(&ZETValidationEntryPoints::zetDebugAcknowledgeEventPrologue)>::value;
+    overrides[ZETEntryPoint::zetDebugAcknowledgeEventEpilogue] = !std::is_same<decltype(&TChecker::zetDebugAcknowledgeEventEpilogue), decltype(&ZETValidationEntryPoints::zetDebugAcknowledgeEventEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDebugInterruptPrologue] = !std::is_same<decltype(&TChecker::zetDebugInterruptPrologue), decltype(&ZETValidationEntryPoints::zetDebugInterruptPrologue)>::value;
+    overrides[ZETEntryPoint::zetDebugInterruptEpilogue] = !std::is_same<decltype(&TChecker::zetDebugInterruptEpilogue), decltype(&ZETValidationEntryPoints::zetDebugInterruptEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDebugResumePrologue] = !std::is_same<decltype(&TChecker::zetDebugResumePrologue), decltype(&ZETValidationEntryPoints::zetDebugResumePrologue)>::value;
+    overrides[ZETEntryPoint::zetDebugResumeEpilogue] = !std::is_same<decltype(&TChecker::zetDebugResumeEpilogue), decltype(&ZETValidationEntryPoints::zetDebugResumeEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDebugReadMemoryPrologue] = !std::is_same<decltype(&TChecker::zetDebugReadMemoryPrologue), decltype(&ZETValidationEntryPoints::zetDebugReadMemoryPrologue)>::value;
+    overrides[ZETEntryPoint::zetDebugReadMemoryEpilogue] = !std::is_same<decltype(&TChecker::zetDebugReadMemoryEpilogue), decltype(&ZETValidationEntryPoints::zetDebugReadMemoryEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDebugWriteMemoryPrologue] = !std::is_same<decltype(&TChecker::zetDebugWriteMemoryPrologue), decltype(&ZETValidationEntryPoints::zetDebugWriteMemoryPrologue)>::value;
+    overrides[ZETEntryPoint::zetDebugWriteMemoryEpilogue] = !std::is_same<decltype(&TChecker::zetDebugWriteMemoryEpilogue), decltype(&ZETValidationEntryPoints::zetDebugWriteMemoryEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDebugGetRegisterSetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zetDebugGetRegisterSetPropertiesPrologue), decltype(&ZETValidationEntryPoints::zetDebugGetRegisterSetPropertiesPrologue)>::value;
+    overrides[ZETEntryPoint::zetDebugGetRegisterSetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zetDebugGetRegisterSetPropertiesEpilogue), decltype(&ZETValidationEntryPoints::zetDebugGetRegisterSetPropertiesEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDebugGetThreadRegisterSetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zetDebugGetThreadRegisterSetPropertiesPrologue), decltype(&ZETValidationEntryPoints::zetDebugGetThreadRegisterSetPropertiesPrologue)>::value;
+    overrides[ZETEntryPoint::zetDebugGetThreadRegisterSetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zetDebugGetThreadRegisterSetPropertiesEpilogue), decltype(&ZETValidationEntryPoints::zetDebugGetThreadRegisterSetPropertiesEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDebugReadRegistersPrologue] = !std::is_same<decltype(&TChecker::zetDebugReadRegistersPrologue), decltype(&ZETValidationEntryPoints::zetDebugReadRegistersPrologue)>::value;
+    overrides[ZETEntryPoint::zetDebugReadRegistersEpilogue] = !std::is_same<decltype(&TChecker::zetDebugReadRegistersEpilogue), decltype(&ZETValidationEntryPoints::zetDebugReadRegistersEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDebugWriteRegistersPrologue] = !std::is_same<decltype(&TChecker::zetDebugWriteRegistersPrologue), decltype(&ZETValidationEntryPoints::zetDebugWriteRegistersPrologue)>::value;
+    overrides[ZETEntryPoint::zetDebugWriteRegistersEpilogue] = !std::is_same<decltype(&TChecker::zetDebugWriteRegistersEpilogue), decltype(&ZETValidationEntryPoints::zetDebugWriteRegistersEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupGetPrologue] = !std::is_same<decltype(&TChecker::zetMetricGroupGetPrologue), decltype(&ZETValidationEntryPoints::zetMetricGroupGetPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupGetEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGroupGetEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGroupGetEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zetMetricGroupGetPropertiesPrologue), decltype(&ZETValidationEntryPoints::zetMetricGroupGetPropertiesPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGroupGetPropertiesEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGroupGetPropertiesEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupCalculateMetricValuesPrologue] = !std::is_same<decltype(&TChecker::zetMetricGroupCalculateMetricValuesPrologue), decltype(&ZETValidationEntryPoints::zetMetricGroupCalculateMetricValuesPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupCalculateMetricValuesEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGroupCalculateMetricValuesEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGroupCalculateMetricValuesEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGetPrologue] = !std::is_same<decltype(&TChecker::zetMetricGetPrologue), decltype(&ZETValidationEntryPoints::zetMetricGetPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGetEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGetEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGetEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGetPropertiesPrologue] = !std::is_same<decltype(&TChecker::zetMetricGetPropertiesPrologue), decltype(&ZETValidationEntryPoints::zetMetricGetPropertiesPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGetPropertiesEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGetPropertiesEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGetPropertiesEpilogue)>::value;
+    overrides[ZETEntryPoint::zetContextActivateMetricGroupsPrologue] = !std::is_same<decltype(&TChecker::zetContextActivateMetricGroupsPrologue), decltype(&ZETValidationEntryPoints::zetContextActivateMetricGroupsPrologue)>::value;
+    overrides[ZETEntryPoint::zetContextActivateMetricGroupsEpilogue] = !std::is_same<decltype(&TChecker::zetContextActivateMetricGroupsEpilogue), decltype(&ZETValidationEntryPoints::zetContextActivateMetricGroupsEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricStreamerOpenPrologue] = !std::is_same<decltype(&TChecker::zetMetricStreamerOpenPrologue), decltype(&ZETValidationEntryPoints::zetMetricStreamerOpenPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricStreamerOpenEpilogue] = !std::is_same<decltype(&TChecker::zetMetricStreamerOpenEpilogue), decltype(&ZETValidationEntryPoints::zetMetricStreamerOpenEpilogue)>::value;
+    overrides[ZETEntryPoint::zetCommandListAppendMetricStreamerMarkerPrologue] = !std::is_same<decltype(&TChecker::zetCommandListAppendMetricStreamerMarkerPrologue), decltype(&ZETValidationEntryPoints::zetCommandListAppendMetricStreamerMarkerPrologue)>::value;
+    overrides[ZETEntryPoint::zetCommandListAppendMetricStreamerMarkerEpilogue] = !std::is_same<decltype(&TChecker::zetCommandListAppendMetricStreamerMarkerEpilogue), decltype(&ZETValidationEntryPoints::zetCommandListAppendMetricStreamerMarkerEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricStreamerClosePrologue] = !std::is_same<decltype(&TChecker::zetMetricStreamerClosePrologue), decltype(&ZETValidationEntryPoints::zetMetricStreamerClosePrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricStreamerCloseEpilogue] = !std::is_same<decltype(&TChecker::zetMetricStreamerCloseEpilogue), decltype(&ZETValidationEntryPoints::zetMetricStreamerCloseEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricStreamerReadDataPrologue] = !std::is_same<decltype(&TChecker::zetMetricStreamerReadDataPrologue), decltype(&ZETValidationEntryPoints::zetMetricStreamerReadDataPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricStreamerReadDataEpilogue] = !std::is_same<decltype(&TChecker::zetMetricStreamerReadDataEpilogue), decltype(&ZETValidationEntryPoints::zetMetricStreamerReadDataEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricQueryPoolCreatePrologue] = !std::is_same<decltype(&TChecker::zetMetricQueryPoolCreatePrologue), decltype(&ZETValidationEntryPoints::zetMetricQueryPoolCreatePrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricQueryPoolCreateEpilogue] = !std::is_same<decltype(&TChecker::zetMetricQueryPoolCreateEpilogue), decltype(&ZETValidationEntryPoints::zetMetricQueryPoolCreateEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricQueryPoolDestroyPrologue] = !std::is_same<decltype(&TChecker::zetMetricQueryPoolDestroyPrologue), decltype(&ZETValidationEntryPoints::zetMetricQueryPoolDestroyPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricQueryPoolDestroyEpilogue] = !std::is_same<decltype(&TChecker::zetMetricQueryPoolDestroyEpilogue), decltype(&ZETValidationEntryPoints::zetMetricQueryPoolDestroyEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricQueryCreatePrologue] = !std::is_same<decltype(&TChecker::zetMetricQueryCreatePrologue), decltype(&ZETValidationEntryPoints::zetMetricQueryCreatePrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricQueryCreateEpilogue] = !std::is_same<decltype(&TChecker::zetMetricQueryCreateEpilogue), decltype(&ZETValidationEntryPoints::zetMetricQueryCreateEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricQueryDestroyPrologue] = !std::is_same<decltype(&TChecker::zetMetricQueryDestroyPrologue), decltype(&ZETValidationEntryPoints::zetMetricQueryDestroyPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricQueryDestroyEpilogue] = !std::is_same<decltype(&TChecker::zetMetricQueryDestroyEpilogue), decltype(&ZETValidationEntryPoints::zetMetricQueryDestroyEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricQueryResetPrologue] = !std::is_same<decltype(&TChecker::zetMetricQueryResetPrologue), decltype(&ZETValidationEntryPoints::zetMetricQueryResetPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricQueryResetEpilogue] = !std::is_same<decltype(&TChecker::zetMetricQueryResetEpilogue), decltype(&ZETValidationEntryPoints::zetMetricQueryResetEpilogue)>::value;
+    overrides[ZETEntryPoint::zetCommandListAppendMetricQueryBeginPrologue] = !std::is_same<decltype(&TChecker::zetCommandListAppendMetricQueryBeginPrologue), decltype(&ZETValidationEntryPoints::zetCommandListAppendMetricQueryBeginPrologue)>::value;
+    overrides[ZETEntryPoint::zetCommandListAppendMetricQueryBeginEpilogue] = !std::is_same<decltype(&TChecker::zetCommandListAppendMetricQueryBeginEpilogue), decltype(&ZETValidationEntryPoints::zetCommandListAppendMetricQueryBeginEpilogue)>::value;
+    overrides[ZETEntryPoint::zetCommandListAppendMetricQueryEndPrologue] = !std::is_same<decltype(&TChecker::zetCommandListAppendMetricQueryEndPrologue), decltype(&ZETValidationEntryPoints::zetCommandListAppendMetricQueryEndPrologue)>::value;
+    overrides[ZETEntryPoint::zetCommandListAppendMetricQueryEndEpilogue] = !std::is_same<decltype(&TChecker::zetCommandListAppendMetricQueryEndEpilogue), decltype(&ZETValidationEntryPoints::zetCommandListAppendMetricQueryEndEpilogue)>::value;
+    overrides[ZETEntryPoint::zetCommandListAppendMetricMemoryBarrierPrologue] = !std::is_same<decltype(&TChecker::zetCommandListAppendMetricMemoryBarrierPrologue), decltype(&ZETValidationEntryPoints::zetCommandListAppendMetricMemoryBarrierPrologue)>::value;
+    overrides[ZETEntryPoint::zetCommandListAppendMetricMemoryBarrierEpilogue] = !std::is_same<decltype(&TChecker::zetCommandListAppendMetricMemoryBarrierEpilogue), decltype(&ZETValidationEntryPoints::zetCommandListAppendMetricMemoryBarrierEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricQueryGetDataPrologue] = !std::is_same<decltype(&TChecker::zetMetricQueryGetDataPrologue), decltype(&ZETValidationEntryPoints::zetMetricQueryGetDataPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricQueryGetDataEpilogue] = !std::is_same<decltype(&TChecker::zetMetricQueryGetDataEpilogue), decltype(&ZETValidationEntryPoints::zetMetricQueryGetDataEpilogue)>::value;
+    overrides[ZETEntryPoint::zetKernelGetProfileInfoPrologue] = !std::is_same<decltype(&TChecker::zetKernelGetProfileInfoPrologue), decltype(&ZETValidationEntryPoints::zetKernelGetProfileInfoPrologue)>::value;
+    overrides[ZETEntryPoint::zetKernelGetProfileInfoEpilogue] = !std::is_same<decltype(&TChecker::zetKernelGetProfileInfoEpilogue), decltype(&ZETValidationEntryPoints::zetKernelGetProfileInfoEpilogue)>::value;
+    overrides[ZETEntryPoint::zetTracerExpCreatePrologue] = !std::is_same<decltype(&TChecker::zetTracerExpCreatePrologue), decltype(&ZETValidationEntryPoints::zetTracerExpCreatePrologue)>::value;
+    overrides[ZETEntryPoint::zetTracerExpCreateEpilogue] = !std::is_same<decltype(&TChecker::zetTracerExpCreateEpilogue), decltype(&ZETValidationEntryPoints::zetTracerExpCreateEpilogue)>::value;
+    overrides[ZETEntryPoint::zetTracerExpDestroyPrologue] = !std::is_same<decltype(&TChecker::zetTracerExpDestroyPrologue), decltype(&ZETValidationEntryPoints::zetTracerExpDestroyPrologue)>::value;
+    overrides[ZETEntryPoint::zetTracerExpDestroyEpilogue] = !std::is_same<decltype(&TChecker::zetTracerExpDestroyEpilogue), decltype(&ZETValidationEntryPoints::zetTracerExpDestroyEpilogue)>::value;
+    overrides[ZETEntryPoint::zetTracerExpSetProloguesPrologue] = !std::is_same<decltype(&TChecker::zetTracerExpSetProloguesPrologue), decltype(&ZETValidationEntryPoints::zetTracerExpSetProloguesPrologue)>::value;
+    overrides[ZETEntryPoint::zetTracerExpSetProloguesEpilogue] = !std::is_same<decltype(&TChecker::zetTracerExpSetProloguesEpilogue), decltype(&ZETValidationEntryPoints::zetTracerExpSetProloguesEpilogue)>::value;
+    overrides[ZETEntryPoint::zetTracerExpSetEpiloguesPrologue] = !std::is_same<decltype(&TChecker::zetTracerExpSetEpiloguesPrologue), decltype(&ZETValidationEntryPoints::zetTracerExpSetEpiloguesPrologue)>::value;
+    overrides[ZETEntryPoint::zetTracerExpSetEpiloguesEpilogue] = !std::is_same<decltype(&TChecker::zetTracerExpSetEpiloguesEpilogue), decltype(&ZETValidationEntryPoints::zetTracerExpSetEpiloguesEpilogue)>::value;
+    overrides[ZETEntryPoint::zetTracerExpSetEnabledPrologue] = !std::is_same<decltype(&TChecker::zetTracerExpSetEnabledPrologue), decltype(&ZETValidationEntryPoints::zetTracerExpSetEnabledPrologue)>::value;
+    overrides[ZETEntryPoint::zetTracerExpSetEnabledEpilogue] = !std::is_same<decltype(&TChecker::zetTracerExpSetEnabledEpilogue), decltype(&ZETValidationEntryPoints::zetTracerExpSetEnabledEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDeviceGetConcurrentMetricGroupsExpPrologue] = !std::is_same<decltype(&TChecker::zetDeviceGetConcurrentMetricGroupsExpPrologue), decltype(&ZETValidationEntryPoints::zetDeviceGetConcurrentMetricGroupsExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetDeviceGetConcurrentMetricGroupsExpEpilogue] = !std::is_same<decltype(&TChecker::zetDeviceGetConcurrentMetricGroupsExpEpilogue), decltype(&ZETValidationEntryPoints::zetDeviceGetConcurrentMetricGroupsExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricTracerCreateExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricTracerCreateExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricTracerCreateExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricTracerCreateExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricTracerCreateExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricTracerCreateExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricTracerDestroyExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricTracerDestroyExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricTracerDestroyExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricTracerDestroyExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricTracerDestroyExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricTracerDestroyExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricTracerEnableExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricTracerEnableExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricTracerEnableExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricTracerEnableExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricTracerEnableExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricTracerEnableExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricTracerDisableExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricTracerDisableExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricTracerDisableExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricTracerDisableExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricTracerDisableExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricTracerDisableExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricTracerReadDataExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricTracerReadDataExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricTracerReadDataExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricTracerReadDataExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricTracerReadDataExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricTracerReadDataExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricDecoderCreateExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricDecoderCreateExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricDecoderCreateExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricDecoderCreateExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricDecoderCreateExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricDecoderCreateExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricDecoderDestroyExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricDecoderDestroyExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricDecoderDestroyExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricDecoderDestroyExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricDecoderDestroyExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricDecoderDestroyExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricDecoderGetDecodableMetricsExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricDecoderGetDecodableMetricsExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricDecoderGetDecodableMetricsExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricDecoderGetDecodableMetricsExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricDecoderGetDecodableMetricsExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricDecoderGetDecodableMetricsExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricTracerDecodeExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricTracerDecodeExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricTracerDecodeExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricTracerDecodeExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricTracerDecodeExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricTracerDecodeExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupCalculateMultipleMetricValuesExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricGroupCalculateMultipleMetricValuesExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricGroupCalculateMultipleMetricValuesExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupCalculateMultipleMetricValuesExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGroupCalculateMultipleMetricValuesExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGroupCalculateMultipleMetricValuesExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupGetGlobalTimestampsExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricGroupGetGlobalTimestampsExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricGroupGetGlobalTimestampsExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupGetGlobalTimestampsExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGroupGetGlobalTimestampsExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGroupGetGlobalTimestampsExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupGetExportDataExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricGroupGetExportDataExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricGroupGetExportDataExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupGetExportDataExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGroupGetExportDataExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGroupGetExportDataExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupCalculateMetricExportDataExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricGroupCalculateMetricExportDataExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricGroupCalculateMetricExportDataExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupCalculateMetricExportDataExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGroupCalculateMetricExportDataExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGroupCalculateMetricExportDataExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricProgrammableGetExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricProgrammableGetExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricProgrammableGetExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricProgrammableGetExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricProgrammableGetExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricProgrammableGetExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricProgrammableGetPropertiesExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricProgrammableGetPropertiesExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricProgrammableGetPropertiesExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricProgrammableGetPropertiesExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricProgrammableGetPropertiesExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricProgrammableGetPropertiesExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricProgrammableGetParamInfoExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricProgrammableGetParamInfoExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricProgrammableGetParamInfoExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricProgrammableGetParamInfoExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricProgrammableGetParamInfoExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricProgrammableGetParamInfoExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricProgrammableGetParamValueInfoExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricProgrammableGetParamValueInfoExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricProgrammableGetParamValueInfoExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricProgrammableGetParamValueInfoExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricProgrammableGetParamValueInfoExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricProgrammableGetParamValueInfoExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricCreateFromProgrammableExp2Prologue] = !std::is_same<decltype(&TChecker::zetMetricCreateFromProgrammableExp2Prologue), decltype(&ZETValidationEntryPoints::zetMetricCreateFromProgrammableExp2Prologue)>::value;
+    overrides[ZETEntryPoint::zetMetricCreateFromProgrammableExp2Epilogue] = !std::is_same<decltype(&TChecker::zetMetricCreateFromProgrammableExp2Epilogue), decltype(&ZETValidationEntryPoints::zetMetricCreateFromProgrammableExp2Epilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricCreateFromProgrammableExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricCreateFromProgrammableExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricCreateFromProgrammableExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricCreateFromProgrammableExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricCreateFromProgrammableExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricCreateFromProgrammableExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetDeviceCreateMetricGroupsFromMetricsExpPrologue] = !std::is_same<decltype(&TChecker::zetDeviceCreateMetricGroupsFromMetricsExpPrologue), decltype(&ZETValidationEntryPoints::zetDeviceCreateMetricGroupsFromMetricsExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetDeviceCreateMetricGroupsFromMetricsExpEpilogue] = !std::is_same<decltype(&TChecker::zetDeviceCreateMetricGroupsFromMetricsExpEpilogue), decltype(&ZETValidationEntryPoints::zetDeviceCreateMetricGroupsFromMetricsExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupCreateExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricGroupCreateExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricGroupCreateExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupCreateExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGroupCreateExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGroupCreateExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupAddMetricExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricGroupAddMetricExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricGroupAddMetricExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupAddMetricExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGroupAddMetricExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGroupAddMetricExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupRemoveMetricExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricGroupRemoveMetricExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricGroupRemoveMetricExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupRemoveMetricExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGroupRemoveMetricExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGroupRemoveMetricExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupCloseExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricGroupCloseExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricGroupCloseExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupCloseExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGroupCloseExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGroupCloseExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupDestroyExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricGroupDestroyExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricGroupDestroyExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricGroupDestroyExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricGroupDestroyExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricGroupDestroyExpEpilogue)>::value;
+    overrides[ZETEntryPoint::zetMetricDestroyExpPrologue] = !std::is_same<decltype(&TChecker::zetMetricDestroyExpPrologue), decltype(&ZETValidationEntryPoints::zetMetricDestroyExpPrologue)>::value;
+    overrides[ZETEntryPoint::zetMetricDestroyExpEpilogue] = !std::is_same<decltype(&TChecker::zetMetricDestroyExpEpilogue), decltype(&ZETValidationEntryPoints::zetMetricDestroyExpEpilogue)>::value;
+    return overrides;
+}
 }
\ No newline at end of file
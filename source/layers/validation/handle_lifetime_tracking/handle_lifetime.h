@@ -7,503 +7,365 @@
 
 #pragma once
 
+#include "ze_cache_line.h"
 #include "ze_handle_lifetime.h"
 #include "zes_handle_lifetime.h"
 #include "zet_handle_lifetime.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <memory>
-#include <type_traits>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 namespace validation_layer {
 
+//
+// Type of a tracked handle.  Handles of types without a tag share the
+// untracked type, and the same pointer may be tracked as several types.
+//
+enum class handle_type_t : uint8_t {
+  UNTRACKED = 0,
+  DRIVER,
+  DEVICE,
+  CONTEXT,
+  COMMAND_QUEUE,
+  COMMAND_LIST,
+  FENCE,
+  EVENT_POOL,
+  EVENT,
+  IMAGE,
+  MODULE,
+  MODULE_BUILD_LOG,
+  KERNEL,
+  SAMPLER,
+  PHYSICAL_MEM,
+  FABRIC_VERTEX,
+  FABRIC_EDGE,
+  RTAS_BUILDER_EXP,
+  RTAS_PARALLEL_OPERATION_EXP,
+  // tools
+  METRIC_GROUP,
+  METRIC,
+  METRIC_STREAMER,
+  METRIC_QUERY_POOL,
+  METRIC_QUERY,
+  TRACER_EXP,
+  DEBUG_SESSION,
+  // sysman
+  SCHED,
+  PERF,
+  PWR,
+  FREQ,
+  ENGINE,
+  STANDBY,
+  FIRMWARE,
+  MEM,
+  FABRIC_PORT,
+  TEMP,
+  PSU,
+  FAN,
+  LED,
+  RAS,
+  DIAG,
+  OVERCLOCK,
+};
+
+template <class T> struct HandleTypeTag {
+  static constexpr handle_type_t value = handle_type_t::UNTRACKED;
+};
+
+#define ZEL_HANDLE_TYPE_TAG(handle_t, tag)                                     \
+  template <> struct HandleTypeTag<handle_t> {                                 \
+    static constexpr handle_type_t value = handle_type_t::tag;                 \
+  };
+
+ZEL_HANDLE_TYPE_TAG(ze_driver_handle_t, DRIVER)
+ZEL_HANDLE_TYPE_TAG(ze_device_handle_t, DEVICE)
+ZEL_HANDLE_TYPE_TAG(ze_context_handle_t, CONTEXT)
+ZEL_HANDLE_TYPE_TAG(ze_command_queue_handle_t, COMMAND_QUEUE)
+ZEL_HANDLE_TYPE_TAG(ze_command_list_handle_t, COMMAND_LIST)
+ZEL_HANDLE_TYPE_TAG(ze_fence_handle_t, FENCE)
+ZEL_HANDLE_TYPE_TAG(ze_event_pool_handle_t, EVENT_POOL)
+ZEL_HANDLE_TYPE_TAG(ze_event_handle_t, EVENT)
+ZEL_HANDLE_TYPE_TAG(ze_image_handle_t, IMAGE)
+ZEL_HANDLE_TYPE_TAG(ze_module_handle_t, MODULE)
+ZEL_HANDLE_TYPE_TAG(ze_module_build_log_handle_t, MODULE_BUILD_LOG)
+ZEL_HANDLE_TYPE_TAG(ze_kernel_handle_t, KERNEL)
+ZEL_HANDLE_TYPE_TAG(ze_sampler_handle_t, SAMPLER)
+ZEL_HANDLE_TYPE_TAG(ze_physical_mem_handle_t, PHYSICAL_MEM)
+ZEL_HANDLE_TYPE_TAG(ze_fabric_vertex_handle_t, FABRIC_VERTEX)
+ZEL_HANDLE_TYPE_TAG(ze_fabric_edge_handle_t, FABRIC_EDGE)
+ZEL_HANDLE_TYPE_TAG(ze_rtas_builder_exp_handle_t, RTAS_BUILDER_EXP)
+ZEL_HANDLE_TYPE_TAG(ze_rtas_parallel_operation_exp_handle_t,
+                    RTAS_PARALLEL_OPERATION_EXP)
+ZEL_HANDLE_TYPE_TAG(zet_metric_group_handle_t, METRIC_GROUP)
+ZEL_HANDLE_TYPE_TAG(zet_metric_handle_t, METRIC)
+ZEL_HANDLE_TYPE_TAG(zet_metric_streamer_handle_t, METRIC_STREAMER)
+ZEL_HANDLE_TYPE_TAG(zet_metric_query_pool_handle_t, METRIC_QUERY_POOL)
+ZEL_HANDLE_TYPE_TAG(zet_metric_query_handle_t, METRIC_QUERY)
+ZEL_HANDLE_TYPE_TAG(zet_tracer_exp_handle_t, TRACER_EXP)
+ZEL_HANDLE_TYPE_TAG(zet_debug_session_handle_t, DEBUG_SESSION)
+ZEL_HANDLE_TYPE_TAG(zes_sched_handle_t, SCHED)
+ZEL_HANDLE_TYPE_TAG(zes_perf_handle_t, PERF)
+ZEL_HANDLE_TYPE_TAG(zes_pwr_handle_t, PWR)
+ZEL_HANDLE_TYPE_TAG(zes_freq_handle_t, FREQ)
+ZEL_HANDLE_TYPE_TAG(zes_engine_handle_t, ENGINE)
+ZEL_HANDLE_TYPE_TAG(zes_standby_handle_t, STANDBY)
+ZEL_HANDLE_TYPE_TAG(zes_firmware_handle_t, FIRMWARE)
+ZEL_HANDLE_TYPE_TAG(zes_mem_handle_t, MEM)
+ZEL_HANDLE_TYPE_TAG(zes_fabric_port_handle_t, FABRIC_PORT)
+ZEL_HANDLE_TYPE_TAG(zes_temp_handle_t, TEMP)
+ZEL_HANDLE_TYPE_TAG(zes_psu_handle_t, PSU)
+ZEL_HANDLE_TYPE_TAG(zes_fan_handle_t, FAN)
+ZEL_HANDLE_TYPE_TAG(zes_led_handle_t, LED)
+ZEL_HANDLE_TYPE_TAG(zes_ras_handle_t, RAS)
+ZEL_HANDLE_TYPE_TAG(zes_diag_handle_t, DIAG)
+ZEL_HANDLE_TYPE_TAG(zes_overclock_handle_t, OVERCLOCK)
+
+#undef ZEL_HANDLE_TYPE_TAG
+
+//
+// State of a tracked handle, kept inline in its registry entry.  The
+// owning context is a small id given to each context when it is added;
+// a context owns itself, and other handles take the context of the handle
+// they were created from.  The creation epoch tells apart handles which
+// reuse the address of a destroyed one.
+//
 typedef struct _zel_handle_state_t {
-  bool is_open;
+  uintptr_t handle; // 0 when the entry is free
+  uint32_t epoch;
+  uint16_t context;
+  handle_type_t type;
+  uint8_t is_open;
 } zel_handle_state_t;
 
-class HandleLifetimeValidation {
-public:
-  ZEHandleLifetimeValidation zeHandleLifetime;
-  ZESHandleLifetimeValidation zesHandleLifetime;
-  ZETHandleLifetimeValidation zetHandleLifetime;
+static_assert(sizeof(zel_handle_state_t) <= 16,
+              "registry entries stay compact");
 
-  // default methods
-  template <class T> void addHandle(T handle) {
-    // TODO : Log warning
-    untrackedHandles++;
-    defaultHandleStateMap.insert({static_cast<void *>(handle), nullptr});
+//
+// All tracked handles in one open addressing table with linear probing,
+// keyed by handle and type.  The table is split into shards so that
+// threads creating and destroying handles rarely contend; lookups take a
+// shared lock on one shard and probe its entries in place.
+//
+class HandleRegistry {
+public:
+  HandleRegistry() {
+    for (auto &shard : shards) {
+      shard.entries.reset(new zel_handle_state_t[initialCapacity]());
+      shard.mask = initialCapacity - 1;
+    }
   }
 
-  template <class T> void removeHandle(T handle) {
-    // TODO: Log warning
-    untrackedHandles--;
-    defaultHandleStateMap.erase(static_cast<void *>(handle));
+  void insert(uintptr_t handle, handle_type_t type, uint16_t context,
+              bool is_open) {
+    if (handle == 0) {
+      return;
+    }
+    uint64_t hash = getHash(handle, type);
+    Shard &shard = getShard(hash);
+    uint32_t epoch = nextEpoch.fetch_add(1, std::memory_order_relaxed) + 1;
+    std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+    zel_handle_state_t *entry = find(shard, hash, handle, type);
+    if (entry->handle == 0) {
+      if ((shard.count + 1) * 4 > (shard.mask + 1) * 3) {
+        grow(shard);
+        entry = find(shard, hash, handle, type);
+      }
+      shard.count++;
+    }
+    *entry = {handle, epoch, context, type, uint8_t(is_open)};
   }
 
-  template <class T> bool isHandleValid(T handle) {
-    return defaultHandleStateMap.find(static_cast<void *>(handle)) !=
-           defaultHandleStateMap.end();
+  void erase(uintptr_t handle, handle_type_t type) {
+    if (handle == 0) {
+      return;
+    }
+    uint64_t hash = getHash(handle, type);
+    Shard &shard = getShard(hash);
+    std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+    zel_handle_state_t *entry = find(shard, hash, handle, type);
+    if (entry->handle == 0) {
+      return;
+    }
+    // shift back the entries after the erased one which probed past it
+    size_t hole = entry - shard.entries.get();
+    for (size_t i = (hole + 1) & shard.mask; shard.entries[i].handle != 0;
+         i = (i + 1) & shard.mask) {
+      const zel_handle_state_t &moved = shard.entries[i];
+      size_t home = getSlot(getHash(moved.handle, moved.type), shard.mask);
+      if (((i - home) & shard.mask) >= ((i - hole) & shard.mask)) {
+        shard.entries[hole] = moved;
+        hole = i;
+      }
+    }
+    shard.entries[hole] = zel_handle_state_t();
+    shard.count--;
   }
 
-  template <class S, class T> S get_handle_map(T handle) {
-    if (std::is_same<T, ze_context_handle_t>::value) {
-      return contextHandleStateMap;
-    } else if (std::is_same<T, ze_driver_handle_t>::value) {
-      return driverHandleStateMap;
-    } else {
-      return defaultHandleStateMap;
+  // Copy the state of a tracked handle, returning false if it is not tracked.
+  bool get(uintptr_t handle, handle_type_t type, zel_handle_state_t &state) {
+    if (handle == 0) {
+      return false;
+    }
+    uint64_t hash = getHash(handle, type);
+    Shard &shard = getShard(hash);
+    std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+    zel_handle_state_t *entry = find(shard, hash, handle, type);
+    if (entry->handle == 0) {
+      return false;
     }
+    state = *entry;
+    return true;
   }
 
-  void addHandle(ze_context_handle_t handle) {
-    contextHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_driver_handle_t handle) {
-    driverHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_device_handle_t handle) {
-    deviceHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_command_queue_handle_t handle) {
-    commandQueueHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_command_list_handle_t handle, bool is_open = true) {
-    commandListHandleStateMap.insert(
-        {handle, std::make_unique<zel_handle_state_t>()});
-    commandListHandleStateMap[handle]->is_open = is_open;
-  }
-  void addHandle(ze_fence_handle_t handle) {
-    fenceHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_event_pool_handle_t handle) {
-    eventPoolHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_event_handle_t handle) {
-    eventHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_image_handle_t handle) {
-    imageHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_module_handle_t handle) {
-    moduleHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_module_build_log_handle_t handle) {
-    moduleBuildLogHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_kernel_handle_t handle) {
-    kernelHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_sampler_handle_t handle) {
-    samplerHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_fabric_vertex_handle_t handle) {
-    fabricVertexHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_fabric_edge_handle_t handle) {
-    fabricEdgeHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_physical_mem_handle_t handle) {
-    physicalMemHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_ipc_event_pool_handle_t handle) {
-    ipcEventPoolHandleStateMap.insert({&handle, nullptr});
-  }
-  void addHandle(ze_ipc_mem_handle_t handle) {
-    ipcMemHandleStateMap.insert({&handle, nullptr});
-  }
-  void addHandle(ze_external_memory_import_win32_handle_t &handle) {
-    externalMemoryImportWin32HandleStateMap.insert({&handle, nullptr});
-  }
-  void addHandle(ze_external_memory_export_win32_handle_t &handle) {
-    externalMemoryExportWin32HandleStateMap.insert({&handle, nullptr});
+  bool contains(uintptr_t handle, handle_type_t type) {
+    zel_handle_state_t state;
+    return get(handle, type, state);
   }
 
-  void addHandle(zet_metric_group_handle_t handle) {
-    metricGroupHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zet_metric_handle_t handle) {
-    metricHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zet_metric_streamer_handle_t handle) {
-    metricStreamerHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zet_metric_query_pool_handle_t handle) {
-    metricQueryPoolHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zet_metric_query_handle_t handle) {
-    metricQueryHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zet_tracer_exp_handle_t handle) {
-    tracerExpHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zet_debug_session_handle_t handle) {
-    debugSessionHandleStateMap.insert({handle, nullptr});
+  // Only changes the state of a tracked handle.
+  void setOpen(uintptr_t handle, handle_type_t type, bool is_open) {
+    if (handle == 0) {
+      return;
+    }
+    uint64_t hash = getHash(handle, type);
+    Shard &shard = getShard(hash);
+    std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+    zel_handle_state_t *entry = find(shard, hash, handle, type);
+    if (entry->handle != 0) {
+      entry->is_open = is_open;
+    }
   }
 
-  void addHandle(zes_sched_handle_t handle) {
-    schedHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_perf_handle_t handle) {
-    perfHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_pwr_handle_t handle) {
-    pwrHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_freq_handle_t handle) {
-    freqHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_engine_handle_t handle) {
-    engineHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_standby_handle_t handle) {
-    standbyHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_firmware_handle_t handle) {
-    firmwareHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_mem_handle_t handle) {
-    memHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_fabric_port_handle_t handle) {
-    fabricPortHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_temp_handle_t handle) {
-    tempHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_psu_handle_t handle) {
-    psuHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_fan_handle_t handle) {
-    fanHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_led_handle_t handle) {
-    ledHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_ras_handle_t handle) {
-    rasHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_diag_handle_t handle) {
-    diagHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_overclock_handle_t handle) {
-    overclockHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_rtas_parallel_operation_exp_handle_t handle) {
-    rtasParallelOperationHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_rtas_builder_exp_handle_t handle) {
-    rtasBuilderHandleStateMap.insert({handle, nullptr});
+  // Id for a new context; ids wrap around but are never 0, which means none.
+  uint16_t newContextId() {
+    uint16_t id;
+    do {
+      id = uint16_t(nextContextId.fetch_add(1, std::memory_order_relaxed));
+    } while (id == 0);
+    return id;
   }
 
-  void removeHandle(ze_context_handle_t handle) {
-    contextHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_driver_handle_t handle) {
-    driverHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_device_handle_t handle) {
-    deviceHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_command_queue_handle_t handle) {
-    commandQueueHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_command_list_handle_t handle) {
-    commandListHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_fence_handle_t handle) {
-    fenceHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_event_pool_handle_t handle) {
-    eventPoolHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_event_handle_t handle) {
-    eventHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_image_handle_t handle) {
-    imageHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_module_handle_t handle) {
-    moduleHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_module_build_log_handle_t handle) {
-    moduleBuildLogHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_kernel_handle_t handle) {
-    kernelHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_sampler_handle_t handle) {
-    samplerHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_physical_mem_handle_t handle) {
-    physicalMemHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_fabric_vertex_handle_t handle) {
-    fabricVertexHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_fabric_edge_handle_t handle) {
-    fabricEdgeHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_ipc_mem_handle_t &handle) {
-    ipcMemHandleStateMap.erase(&handle);
-  }
-  void removeHandle(ze_ipc_event_pool_handle_t &handle) {
-    ipcEventPoolHandleStateMap.erase(&handle);
-  }
-  void removeHandle(ze_external_memory_export_win32_handle_t &handle) {
-    externalMemoryExportWin32HandleStateMap.erase(&handle);
-  }
-  void removeHandle(ze_external_memory_import_win32_handle_t &handle) {
-    externalMemoryImportWin32HandleStateMap.erase(&handle);
-  }
+private:
+  static constexpr uint32_t shardBits = 4;
+  static constexpr size_t initialCapacity = 64;
 
-  void removeHandle(zet_metric_group_handle_t handle) {
-    metricGroupHandleStateMap.erase(handle);
-  }
-  void removeHandle(zet_metric_handle_t handle) {
-    metricHandleStateMap.erase(handle);
-  }
-  void removeHandle(zet_metric_streamer_handle_t handle) {
-    metricStreamerHandleStateMap.erase(handle);
-  }
-  void removeHandle(zet_metric_query_pool_handle_t handle) {
-    metricQueryPoolHandleStateMap.erase(handle);
-  }
-  void removeHandle(zet_metric_query_handle_t handle) {
-    metricQueryHandleStateMap.erase(handle);
-  }
-  void removeHandle(zet_tracer_exp_handle_t handle) {
-    tracerExpHandleStateMap.erase(handle);
-  }
-  void removeHandle(zet_debug_session_handle_t handle) {
-    debugSessionHandleStateMap.erase(handle);
-  }
+  struct Shard {
+    std::shared_timed_mutex mutex;
+    std::unique_ptr<zel_handle_state_t[]> entries;
+    size_t mask = 0;
+    size_t count = 0;
+  };
 
-  void removeHandle(zes_sched_handle_t handle) {
-    schedHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_perf_handle_t handle) {
-    perfHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_pwr_handle_t handle) {
-    pwrHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_freq_handle_t handle) {
-    freqHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_engine_handle_t handle) {
-    engineHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_standby_handle_t handle) {
-    standbyHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_firmware_handle_t handle) {
-    firmwareHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_mem_handle_t handle) {
-    memHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_fabric_port_handle_t handle) {
-    fabricPortHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_temp_handle_t handle) {
-    tempHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_psu_handle_t handle) {
-    psuHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_fan_handle_t handle) {
-    fanHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_led_handle_t handle) {
-    ledHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_ras_handle_t handle) {
-    rasHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_diag_handle_t handle) {
-    diagHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_overclock_handle_t handle) {
-    overclockHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_rtas_parallel_operation_exp_handle_t handle) {
-    rtasParallelOperationHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_rtas_builder_exp_handle_t handle) {
-    rtasBuilderHandleStateMap.erase(handle);
+  static uint64_t getHash(uintptr_t handle, handle_type_t type) {
+    return hash_handle(uint64_t(handle) ^ (uint64_t(type) << 48));
   }
 
-  bool isHandleValid(ze_context_handle_t handle) {
-    return contextHandleStateMap.find(handle) != contextHandleStateMap.end();
-  }
-  bool isHandleValid(ze_driver_handle_t handle) {
-    return driverHandleStateMap.find(handle) != driverHandleStateMap.end();
-  }
-  bool isHandleValid(ze_device_handle_t handle) {
-    return deviceHandleStateMap.find(handle) != deviceHandleStateMap.end();
-  }
-  bool isHandleValid(ze_command_queue_handle_t handle) {
-    return commandQueueHandleStateMap.find(handle) !=
-           commandQueueHandleStateMap.end();
-  }
-  bool isHandleValid(ze_command_list_handle_t handle) {
-    return commandListHandleStateMap.find(handle) !=
-           commandListHandleStateMap.end();
-  }
-  bool isHandleValid(ze_fence_handle_t handle) {
-    return fenceHandleStateMap.find(handle) != fenceHandleStateMap.end();
-  }
-  bool isHandleValid(ze_event_pool_handle_t handle) {
-    return eventPoolHandleStateMap.find(handle) !=
-           eventPoolHandleStateMap.end();
-  }
-  bool isHandleValid(ze_event_handle_t handle) {
-    return eventHandleStateMap.find(handle) != eventHandleStateMap.end();
-  }
-  bool isHandleValid(ze_image_handle_t handle) {
-    return imageHandleStateMap.find(handle) != imageHandleStateMap.end();
-  }
-  bool isHandleValid(ze_module_handle_t handle) {
-    return moduleHandleStateMap.find(handle) != moduleHandleStateMap.end();
-  }
-  bool isHandleValid(ze_module_build_log_handle_t handle) {
-    return moduleBuildLogHandleStateMap.find(handle) !=
-           moduleBuildLogHandleStateMap.end();
-  }
-  bool isHandleValid(ze_kernel_handle_t handle) {
-    return kernelHandleStateMap.find(handle) != kernelHandleStateMap.end();
-  }
-  bool isHandleValid(ze_sampler_handle_t handle) {
-    return samplerHandleStateMap.find(handle) != samplerHandleStateMap.end();
-  }
-  bool isHandleValid(ze_physical_mem_handle_t handle) {
-    return physicalMemHandleStateMap.find(handle) !=
-           physicalMemHandleStateMap.end();
-  }
-  bool isHandleValid(ze_fabric_vertex_handle_t handle) {
-    return fabricVertexHandleStateMap.find(handle) !=
-           fabricVertexHandleStateMap.end();
-  }
-  bool isHandleValid(ze_fabric_edge_handle_t handle) {
-    return fabricEdgeHandleStateMap.find(handle) !=
-           fabricEdgeHandleStateMap.end();
-  }
-  bool isHandleValid(ze_ipc_mem_handle_t &handle) {
-    return ipcMemHandleStateMap.find(&handle) != ipcMemHandleStateMap.end();
-  }
-  bool isHandleValid(ze_ipc_event_pool_handle_t &handle) {
-    return ipcEventPoolHandleStateMap.find(&handle) !=
-           ipcEventPoolHandleStateMap.end();
-  }
-  bool isHandleValid(ze_external_memory_import_win32_handle_t &handle) {
-    return externalMemoryImportWin32HandleStateMap.find(&handle) !=
-           externalMemoryImportWin32HandleStateMap.end();
-  }
-  bool isHandleValid(ze_external_memory_export_win32_handle_t &handle) {
-    return externalMemoryExportWin32HandleStateMap.find(&handle) !=
-           externalMemoryExportWin32HandleStateMap.end();
+  static size_t getSlot(uint64_t hash, size_t mask) {
+    return size_t(hash >> 16) & mask;
   }
 
-  bool isHandleValid(zet_metric_group_handle_t handle) {
-    return metricGroupHandleStateMap.find(handle) !=
-           metricGroupHandleStateMap.end();
-  }
-  bool isHandleValid(zet_metric_handle_t handle) {
-    return metricHandleStateMap.find(handle) != metricHandleStateMap.end();
-  }
-  bool isHandleValid(zet_metric_streamer_handle_t handle) {
-    return metricStreamerHandleStateMap.find(handle) !=
-           metricStreamerHandleStateMap.end();
-  }
-  bool isHandleValid(zet_metric_query_pool_handle_t handle) {
-    return metricQueryPoolHandleStateMap.find(handle) !=
-           metricQueryPoolHandleStateMap.end();
-  }
-  bool isHandleValid(zet_metric_query_handle_t handle) {
-    return metricQueryHandleStateMap.find(handle) !=
-           metricQueryHandleStateMap.end();
-  }
-  bool isHandleValid(zet_tracer_exp_handle_t handle) {
-    return tracerExpHandleStateMap.find(handle) !=
-           tracerExpHandleStateMap.end();
-  }
-  bool isHandleValid(zet_debug_session_handle_t handle) {
-    return debugSessionHandleStateMap.find(handle) !=
-           debugSessionHandleStateMap.end();
-  }
+  Shard &getShard(uint64_t hash) { return shards[hash >> (64 - shardBits)]; }
 
-  bool isHandleValid(zes_sched_handle_t handle) {
-    return schedHandleStateMap.find(handle) != schedHandleStateMap.end();
-  }
-  bool isHandleValid(zes_perf_handle_t handle) {
-    return perfHandleStateMap.find(handle) != perfHandleStateMap.end();
-  }
-  bool isHandleValid(zes_pwr_handle_t handle) {
-    return pwrHandleStateMap.find(handle) != pwrHandleStateMap.end();
-  }
-  bool isHandleValid(zes_freq_handle_t handle) {
-    return freqHandleStateMap.find(handle) != freqHandleStateMap.end();
-  }
-  bool isHandleValid(zes_engine_handle_t handle) {
-    return engineHandleStateMap.find(handle) != engineHandleStateMap.end();
-  }
-  bool isHandleValid(zes_standby_handle_t handle) {
-    return standbyHandleStateMap.find(handle) != standbyHandleStateMap.end();
-  }
-  bool isHandleValid(zes_firmware_handle_t handle) {
-    return firmwareHandleStateMap.find(handle) != firmwareHandleStateMap.end();
-  }
-  bool isHandleValid(zes_mem_handle_t handle) {
-    return memHandleStateMap.find(handle) != memHandleStateMap.end();
-  }
-  bool isHandleValid(zes_fabric_port_handle_t handle) {
-    return fabricPortHandleStateMap.find(handle) !=
-           fabricPortHandleStateMap.end();
-  }
-  bool isHandleValid(zes_temp_handle_t handle) {
-    return tempHandleStateMap.find(handle) != tempHandleStateMap.end();
-  }
-  bool isHandleValid(zes_psu_handle_t handle) {
-    return psuHandleStateMap.find(handle) != psuHandleStateMap.end();
-  }
-  bool isHandleValid(zes_fan_handle_t handle) {
-    return fanHandleStateMap.find(handle) != fanHandleStateMap.end();
-  }
-  bool isHandleValid(zes_led_handle_t handle) {
-    return ledHandleStateMap.find(handle) != ledHandleStateMap.end();
+  // The entry of the handle, or the free entry ending its probe sequence.
+  static zel_handle_state_t *find(Shard &shard, uint64_t hash,
+                                  uintptr_t handle, handle_type_t type) {
+    for (size_t i = getSlot(hash, shard.mask);; i = (i + 1) & shard.mask) {
+      zel_handle_state_t &entry = shard.entries[i];
+      if (entry.handle == 0 ||
+          (entry.handle == handle && entry.type == type)) {
+        return &entry;
+      }
+    }
   }
-  bool isHandleValid(zes_ras_handle_t handle) {
-    return rasHandleStateMap.find(handle) != rasHandleStateMap.end();
+
+  static void grow(Shard &shard) {
+    size_t mask = shard.mask;
+    std::unique_ptr<zel_handle_state_t[]> entries(
+        new zel_handle_state_t[(mask + 1) * 2]());
+    std::swap(shard.entries, entries);
+    shard.mask = mask * 2 + 1;
+    for (size_t i = 0; i <= mask; i++) {
+      const zel_handle_state_t &entry = entries[i];
+      if (entry.handle != 0) {
+        *find(shard, getHash(entry.handle, entry.type), entry.handle,
+              entry.type) = entry;
+      }
+    }
   }
-  bool isHandleValid(zes_diag_handle_t handle) {
-    return diagHandleStateMap.find(handle) != diagHandleStateMap.end();
+
+  cache_line_t<Shard> shards[size_t(1) << shardBits];
+  std::atomic<uint32_t> nextEpoch{0};
+  std::atomic<uint32_t> nextContextId{1};
+};
+
+class HandleLifetimeValidation : public cache_line_allocated_t {
+public:
+  ZEHandleLifetimeValidation zeHandleLifetime;
+  ZESHandleLifetimeValidation zesHandleLifetime;
+  ZETHandleLifetimeValidation zetHandleLifetime;
+
+  template <class T> void addHandle(T handle) { addHandle(handle, nullptr); }
+
+  //
+  // Track a handle created from a parent handle, the first argument of the
+  // API which created it, from which it takes its owning context.
+  //
+  template <class T, class P>
+  void addHandle(T handle, P parent, bool is_open = true) {
+    constexpr handle_type_t type = HandleTypeTag<T>::value;
+    if (type == handle_type_t::UNTRACKED) {
+      // TODO : Log warning
+      untrackedHandles++;
+    }
+    uint16_t owner = 0;
+    if (type == handle_type_t::CONTEXT) {
+      owner = registry.newContextId();
+    } else {
+      zel_handle_state_t state;
+      if (registry.get(getKey(parent), HandleTypeTag<P>::value, state)) {
+        owner = state.context;
+      }
+    }
+    registry.insert(getKey(handle), type, owner, is_open);
   }
-  bool isHandleValid(zes_overclock_handle_t handle) {
-    return overclockHandleStateMap.find(handle) !=
-           overclockHandleStateMap.end();
+
+  template <class T> void removeHandle(T handle) {
+    if (HandleTypeTag<T>::value == handle_type_t::UNTRACKED) {
+      // TODO: Log warning
+      untrackedHandles--;
+    }
+    registry.erase(getKey(handle), HandleTypeTag<T>::value);
   }
 
-  bool isHandleValid(ze_rtas_parallel_operation_exp_handle_t handle) {
-    return rtasParallelOperationHandleStateMap.find(handle) !=
-           rtasParallelOperationHandleStateMap.end();
+  template <class T> bool isHandleValid(T handle) {
+    return registry.contains(getKey(handle), HandleTypeTag<T>::value);
   }
 
-  bool isHandleValid(ze_rtas_builder_exp_handle_t handle) {
-    return rtasBuilderHandleStateMap.find(handle) !=
-           rtasBuilderHandleStateMap.end();
+  // Copy the state of a tracked handle, returning false if it is not tracked.
+  template <class T> bool getHandleState(T handle, zel_handle_state_t &state) {
+    return registry.get(getKey(handle), HandleTypeTag<T>::value, state);
   }
 
   bool isOpen(ze_command_list_handle_t handle) {
-    return commandListHandleStateMap[handle]->is_open;
+    zel_handle_state_t state;
+    return getHandleState(handle, state) && state.is_open;
   }
   void close(ze_command_list_handle_t handle) {
-    commandListHandleStateMap[handle]->is_open = false;
+    registry.setOpen(getKey(handle), handle_type_t::COMMAND_LIST, false);
   }
   void reset(ze_command_list_handle_t handle) {
-    commandListHandleStateMap[handle]->is_open = true;
+    registry.setOpen(getKey(handle), handle_type_t::COMMAND_LIST, true);
   }
 
   void printDependentMap() {
+    std::lock_guard<std::mutex> lock(dependentMutex);
 
     printf("\n--------------------------------------------\n");
     for (auto &handle : dependentMap) {
@@ -519,12 +381,11 @@ public:
 
   void addDependent(const void *handle, const void *dependent) {
     // No need to track driver dependents
-    for (auto &driverHandle : driverHandleStateMap){
-      if (handle == (void*)driverHandle.first){
-        return;
-      }
+    if (registry.contains(getKey(handle), handle_type_t::DRIVER)) {
+      return;
     }
 
+    std::lock_guard<std::mutex> lock(dependentMutex);
     if (dependentMap.count(handle) == 0) {
       dependentMap[handle] = std::unordered_set<const void *>();
     }
@@ -532,12 +393,14 @@ public:
   }
 
   void removeDependent(const void *dependent) {
+    std::lock_guard<std::mutex> lock(dependentMutex);
     for (auto &handle : dependentMap) {
       handle.second.erase(dependent);
     }
   }
 
   void removeDependent(const void *handle, const void *dependent) {
+    std::lock_guard<std::mutex> lock(dependentMutex);
     if (dependentMap.count(handle) == 0) {
       return;
     }
@@ -545,151 +408,25 @@ public:
   }
 
   bool hasDependents(const void *handle) {
-    return dependentMap.count(handle) && !dependentMap[handle].empty();
+    std::lock_guard<std::mutex> lock(dependentMutex);
+    auto it = dependentMap.find(handle);
+    return it != dependentMap.end() && !it->second.empty();
   }
 
 private:
-  std::unordered_map<void *, std::unique_ptr<zel_handle_state_t>>
-      defaultHandleStateMap;
-  std::unordered_map<ze_context_handle_t, std::unique_ptr<zel_handle_state_t>>
-      contextHandleStateMap;
-  std::unordered_map<ze_driver_handle_t, std::unique_ptr<zel_handle_state_t>>
-      driverHandleStateMap;
-  std::unordered_map<ze_device_handle_t, std::unique_ptr<zel_handle_state_t>>
-      deviceHandleStateMap;
-  std::unordered_map<ze_command_queue_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      commandQueueHandleStateMap;
-  std::unordered_map<ze_command_list_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      commandListHandleStateMap;
-  std::unordered_map<ze_fence_handle_t, std::unique_ptr<zel_handle_state_t>>
-      fenceHandleStateMap;
-  std::unordered_map<ze_event_pool_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      eventPoolHandleStateMap;
-  std::unordered_map<ze_event_handle_t, std::unique_ptr<zel_handle_state_t>>
-      eventHandleStateMap;
-  std::unordered_map<ze_image_handle_t, std::unique_ptr<zel_handle_state_t>>
-      imageHandleStateMap;
-  std::unordered_map<ze_module_handle_t, std::unique_ptr<zel_handle_state_t>>
-      moduleHandleStateMap;
-  std::unordered_map<ze_module_build_log_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      moduleBuildLogHandleStateMap;
-  std::unordered_map<ze_kernel_handle_t, std::unique_ptr<zel_handle_state_t>>
-      kernelHandleStateMap;
-  std::unordered_map<ze_sampler_handle_t, std::unique_ptr<zel_handle_state_t>>
-      samplerHandleStateMap;
-  std::unordered_map<ze_physical_mem_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      physicalMemHandleStateMap;
-
-  std::unordered_map<ze_fabric_vertex_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      fabricVertexHandleStateMap;
-  std::unordered_map<ze_fabric_edge_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      fabricEdgeHandleStateMap;
-
-  std::unordered_map<ze_ipc_event_pool_handle_t *,
-                     std::unique_ptr<zel_handle_state_t>>
-      ipcEventPoolHandleStateMap;
-  std::unordered_map<ze_ipc_mem_handle_t *, std::unique_ptr<zel_handle_state_t>>
-      ipcMemHandleStateMap;
-
-  std::unordered_map<ze_external_memory_import_win32_handle_t *,
-                     std::unique_ptr<zel_handle_state_t>>
-      externalMemoryImportWin32HandleStateMap;
-  std::unordered_map<ze_external_memory_export_win32_handle_t *,
-                     std::unique_ptr<zel_handle_state_t>>
-      externalMemoryExportWin32HandleStateMap;
-
-  // tools
-  std::unordered_map<zet_driver_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetDriverHandleStateMap;
-  std::unordered_map<zet_device_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetDeviceHandleStateMap;
-  std::unordered_map<zet_context_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetContextHandleStateMap;
-  std::unordered_map<zet_command_list_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      zetCommandListHandleStateMap;
-  std::unordered_map<zet_module_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetModuleHandleStateMap;
-  std::unordered_map<zet_kernel_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetKernelHandleStateMap;
-  std::unordered_map<zet_metric_group_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricGroupHandleStateMap;
-  std::unordered_map<zet_metric_handle_t, std::unique_ptr<zel_handle_state_t>>
-      metricHandleStateMap;
-  std::unordered_map<zet_metric_streamer_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricStreamerHandleStateMap;
-  std::unordered_map<zet_metric_query_pool_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricQueryPoolHandleStateMap;
-  std::unordered_map<zet_metric_query_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricQueryHandleStateMap;
-  std::unordered_map<zet_tracer_exp_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      tracerExpHandleStateMap;
-  std::unordered_map<zet_debug_session_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      debugSessionHandleStateMap;
+  template <class T> static uintptr_t getKey(T handle) {
+    return reinterpret_cast<uintptr_t>(handle);
+  }
+  static uintptr_t getKey(std::nullptr_t) { return 0; }
 
-  // sysman
-  std::unordered_map<zes_driver_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zesDriverHandleStateMap;
-  std::unordered_map<zes_device_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zesDeviceHandleStateMap;
-  std::unordered_map<zes_sched_handle_t, std::unique_ptr<zel_handle_state_t>>
-      schedHandleStateMap;
-  std::unordered_map<zes_perf_handle_t, std::unique_ptr<zel_handle_state_t>>
-      perfHandleStateMap;
-  std::unordered_map<zes_pwr_handle_t, std::unique_ptr<zel_handle_state_t>>
-      pwrHandleStateMap;
-  std::unordered_map<zes_freq_handle_t, std::unique_ptr<zel_handle_state_t>>
-      freqHandleStateMap;
-  std::unordered_map<zes_engine_handle_t, std::unique_ptr<zel_handle_state_t>>
-      engineHandleStateMap;
-  std::unordered_map<zes_standby_handle_t, std::unique_ptr<zel_handle_state_t>>
-      standbyHandleStateMap;
-  std::unordered_map<zes_firmware_handle_t, std::unique_ptr<zel_handle_state_t>>
-      firmwareHandleStateMap;
-  std::unordered_map<zes_mem_handle_t, std::unique_ptr<zel_handle_state_t>>
-      memHandleStateMap;
-  std::unordered_map<zes_fabric_port_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      fabricPortHandleStateMap;
-  std::unordered_map<zes_temp_handle_t, std::unique_ptr<zel_handle_state_t>>
-      tempHandleStateMap;
-  std::unordered_map<zes_psu_handle_t, std::unique_ptr<zel_handle_state_t>>
-      psuHandleStateMap;
-  std::unordered_map<zes_fan_handle_t, std::unique_ptr<zel_handle_state_t>>
-      fanHandleStateMap;
-  std::unordered_map<zes_led_handle_t, std::unique_ptr<zel_handle_state_t>>
-      ledHandleStateMap;
-  std::unordered_map<zes_ras_handle_t, std::unique_ptr<zel_handle_state_t>>
-      rasHandleStateMap;
-  std::unordered_map<zes_diag_handle_t, std::unique_ptr<zel_handle_state_t>>
-      diagHandleStateMap;
-  std::unordered_map<zes_overclock_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      overclockHandleStateMap;
-  std::unordered_map<ze_rtas_parallel_operation_exp_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      rtasParallelOperationHandleStateMap;
-  std::unordered_map<ze_rtas_builder_exp_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      rtasBuilderHandleStateMap;
+  HandleRegistry registry;
 
+  // dependents change only when handles are created and destroyed
+  std::mutex dependentMutex;
   std::unordered_map<const void *, std::unordered_set<const void *>>
       dependentMap;
 
-  int untrackedHandles = 0;
+  std::atomic<int> untrackedHandles{0};
 
 }; // class HandleLifetimeValidation
 
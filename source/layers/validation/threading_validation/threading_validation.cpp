@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "threading_validation.h"
+#include "ze_validation_layer.h"
+
+#include <sstream>
+
+namespace validation_layer {
+
+thread_local ThreadingThread *ThreadingValidation::myThread = nullptr;
+thread_local ThreadingThreadOwner ThreadingValidation::myThreadOwner;
+
+// Give a thread the record of an exited thread, or a new one.
+ThreadingThread *ThreadingValidation::addThread() {
+  std::lock_guard<std::mutex> lock(threadsMutex);
+  ThreadingThread *thread = nullptr;
+  for (auto &record : threads) {
+    bool inUse = false;
+    if (record->inUse.compare_exchange_strong(inUse, true,
+                                              std::memory_order_acquire)) {
+      thread = record.get();
+      break;
+    }
+  }
+  if (thread == nullptr) {
+    if (threads.size() == maxThreads)
+      return nullptr;
+    threads.emplace_back(new ThreadingThread);
+    thread = threads.back().get();
+    // tags start at one, so that no owner word is zero
+    thread->tag = uint64_t(threads.size()) << handleBits;
+  }
+  thread->id = std::this_thread::get_id();
+  myThread = thread;
+  myThreadOwner.thread = thread;
+  return thread;
+}
+
+void ThreadingValidation::reportViolation(const void *handle,
+                                          const char *type, const char *api,
+                                          ThreadingThread *me,
+                                          uint64_t owner,
+                                          const char *ownerApi) {
+  // the thread of a sharing call is published after the owner word, and may
+  // not be known yet
+  std::ostringstream ownerThread;
+  if (owner != 0) {
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    ownerThread << "thread " << threads[owner - 1]->id;
+  } else {
+    ownerThread << "another thread";
+  }
+  std::ostringstream message;
+  message << "Threading violation: " << api << " on thread " << me->id
+          << " uses " << type << " " << handle << " while "
+          << (ownerApi != nullptr ? ownerApi : "another call") << " on "
+          << ownerThread.str() << " is using it";
+  context.log(message.str());
+}
+
+} // namespace validation_layer
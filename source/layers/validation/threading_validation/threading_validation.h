@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "ze_api.h"
+#include "ze_cache_line.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace validation_layer {
+
+// A thread calling APIs, kept for the next thread once the thread exits.
+struct ThreadingThread {
+  std::thread::id id;
+  // index of the thread in the owner words of the slots
+  uint64_t tag = 0;
+  std::atomic<bool> inUse{true};
+};
+
+struct ThreadingThreadOwner {
+  ~ThreadingThreadOwner() {
+    if (thread != nullptr)
+      thread->inUse.store(false, std::memory_order_release);
+  }
+  ThreadingThread *thread = nullptr;
+};
+
+//
+// Catches command list and kernel handles used by several threads at once
+// where the specification forbids it, when ZE_ENABLE_THREADING_VALIDATION is
+// set.  A call the specification says must not run on simultaneous threads
+// owns the handle exclusively for its duration, by setting the owner word of
+// the handle's slot to its thread and a hash of the handle; calls which may
+// run on simultaneous threads share it, counting themselves in the owner
+// word.  A violation is reported when an exclusive use meets any other use
+// from another thread.  Publishing the hash in the owner word leaves no
+// window in which a slot is owned by an unknown handle.  Handles whose
+// slots collide are not checked against each other, so that no lock is
+// ever taken.
+//
+class ThreadingValidation : public cache_line_allocated_t {
+  struct Slot;
+
+public:
+  // Handles used by a call, released when the call returns.
+  class Guard {
+  public:
+    Guard() = default;
+    ~Guard() {
+      for (uint32_t i = 0; i < count; i++)
+        ThreadingValidation::release(*slots[i], shared[i]);
+    }
+
+  private:
+    Guard(const Guard &) = delete;
+    Guard &operator=(const Guard &) = delete;
+
+    friend class ThreadingValidation;
+    static constexpr uint32_t capacity = 2;
+    Slot *slots[capacity];
+    bool shared[capacity];
+    uint32_t count = 0;
+  };
+
+  void acquire(Guard &guard, ze_command_list_handle_t handle,
+               const char *api) {
+    acquire(guard, handle, "command list", api);
+  }
+  void acquire(Guard &guard, ze_kernel_handle_t handle, const char *api) {
+    acquire(guard, handle, "kernel", api);
+  }
+
+  void share(Guard &guard, ze_command_list_handle_t handle, const char *api) {
+    share(guard, handle, "command list", api);
+  }
+  void share(Guard &guard, ze_kernel_handle_t handle, const char *api) {
+    share(guard, handle, "kernel", api);
+  }
+
+private:
+  static constexpr size_t slotCount = 1024;
+
+  // An owner word holds the top bits of the handle's hash in its low
+  // handleBits, which also pick the slot, and above them either the tag of
+  // the thread owning the handle, or sharedFlag and the number of calls
+  // sharing it.
+  static constexpr uint32_t handleBits = 48;
+  static constexpr uint64_t handleMask = (uint64_t(1) << handleBits) - 1;
+  static constexpr uint64_t sharedFlag = uint64_t(1) << 63;
+  static constexpr uint64_t oneSharer = uint64_t(1) << handleBits;
+  static constexpr uint64_t maxThreads = (sharedFlag >> handleBits) - 1;
+  static constexpr uint64_t maxSharers = maxThreads;
+
+  // Owner word of the handles hashed to the slot, and the API and thread of
+  // the owning call, or of the first sharing call.
+  struct Slot {
+    std::atomic<uint64_t> owner{0};
+    std::atomic<const char *> api{nullptr};
+    std::atomic<uint64_t> thread{0};
+  };
+
+  void acquire(Guard &guard, const void *handle, const char *type,
+               const char *api) {
+    if (handle == nullptr || guard.count == Guard::capacity)
+      return;
+    ThreadingThread *me = getThread();
+    if (me == nullptr)
+      return;
+    uint64_t hash = getHash(handle);
+    Slot &slot = slots[hash >> 54];
+    uint64_t owner = 0;
+    if (slot.owner.compare_exchange_strong(owner, me->tag | (hash >> 16),
+                                           std::memory_order_acq_rel)) {
+      slot.api.store(api, std::memory_order_relaxed);
+      slot.thread.store(me->tag, std::memory_order_relaxed);
+      guard.slots[guard.count] = &slot;
+      guard.shared[guard.count++] = false;
+      return;
+    }
+    if ((owner & handleMask) != (hash >> 16))
+      return;
+    uint64_t state = owner & ~handleMask;
+    if ((state & sharedFlag) == 0) {
+      if (state != me->tag) {
+        reportViolation(handle, type, api, me, owner >> handleBits,
+                        slot.api.load(std::memory_order_relaxed));
+      }
+      return;
+    }
+    // a single sharing call of this thread is not a violation
+    uint64_t thread = slot.thread.load(std::memory_order_relaxed);
+    if (state != (sharedFlag | oneSharer) || thread != me->tag) {
+      reportViolation(handle, type, api, me, thread >> handleBits,
+                      slot.api.load(std::memory_order_relaxed));
+    }
+  }
+
+  void share(Guard &guard, const void *handle, const char *type,
+             const char *api) {
+    if (handle == nullptr || guard.count == Guard::capacity)
+      return;
+    ThreadingThread *me = getThread();
+    if (me == nullptr)
+      return;
+    uint64_t hash = getHash(handle);
+    Slot &slot = slots[hash >> 54];
+    uint64_t owner = slot.owner.load(std::memory_order_acquire);
+    for (;;) {
+      if (owner == 0) {
+        if (!slot.owner.compare_exchange_weak(
+                owner, sharedFlag | oneSharer | (hash >> 16),
+                std::memory_order_acq_rel))
+          continue;
+        slot.api.store(api, std::memory_order_relaxed);
+        slot.thread.store(me->tag, std::memory_order_relaxed);
+        break;
+      }
+      if ((owner & handleMask) != (hash >> 16))
+        return;
+      if ((owner & sharedFlag) == 0) {
+        if ((owner & ~handleMask) != me->tag) {
+          reportViolation(handle, type, api, me, owner >> handleBits,
+                          slot.api.load(std::memory_order_relaxed));
+        }
+        return;
+      }
+      if (((owner & ~sharedFlag) >> handleBits) == maxSharers)
+        return;
+      if (slot.owner.compare_exchange_weak(owner, owner + oneSharer,
+                                           std::memory_order_acq_rel))
+        break;
+    }
+    guard.slots[guard.count] = &slot;
+    guard.shared[guard.count++] = true;
+  }
+
+  static void release(Slot &slot, bool shared) {
+    if (!shared) {
+      slot.api.store(nullptr, std::memory_order_relaxed);
+      slot.thread.store(0, std::memory_order_relaxed);
+      slot.owner.store(0, std::memory_order_release);
+      return;
+    }
+    uint64_t owner = slot.owner.load(std::memory_order_relaxed);
+    while (!slot.owner.compare_exchange_weak(
+        owner,
+        (owner & ~handleMask) == (sharedFlag | oneSharer) ? 0
+                                                          : owner - oneSharer,
+        std::memory_order_release)) {
+    }
+  }
+
+  static uint64_t getHash(const void *handle) {
+    return hash_handle(reinterpret_cast<uintptr_t>(handle));
+  }
+
+  // The calling thread, or nullptr past maxThreads threads, which are then
+  // not checked.
+  ThreadingThread *getThread() {
+    ThreadingThread *thread = myThread;
+    return thread != nullptr ? thread : addThread();
+  }
+
+  ThreadingThread *addThread();
+  void reportViolation(const void *handle, const char *type, const char *api,
+                       ThreadingThread *me, uint64_t owner,
+                       const char *ownerApi);
+
+  static_assert(slotCount == size_t(1) << (64 - 54),
+                "a slot for every hash");
+
+  // Trivially destructible, so that reading it is a plain thread local
+  // access; myThreadOwner releases the thread at thread exit.
+  static thread_local ThreadingThread *myThread;
+  static thread_local ThreadingThreadOwner myThreadOwner;
+
+  cache_line_t<Slot> slots[slotCount];
+  std::mutex threadsMutex;
+  std::vector<std::unique_ptr<ThreadingThread>> threads;
+};
+
+} // namespace validation_layer
@@ -26,17 +26,11 @@ namespace validation_layer
         if( nullptr == pfnInit )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeInitPrologue( flags );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeInitPrologue ] ) {
+            auto result = checker->zeInitPrologue( flags );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeInitPrologue( flags );
@@ -45,9 +39,9 @@ namespace validation_layer
 
         auto result = pfnInit( flags );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeInitEpilogue( flags );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeInitEpilogue ] ) {
+            auto epilogueResult = checker->zeInitEpilogue( flags, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -72,17 +66,11 @@ namespace validation_layer
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetPrologue( pCount, phDrivers );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetPrologue ] ) {
+            auto result = checker->zeDriverGetPrologue( pCount, phDrivers );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetPrologue( pCount, phDrivers );
@@ -91,9 +79,9 @@ namespace validation_layer
 
         auto result = pfnGet( pCount, phDrivers );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetEpilogue( pCount, phDrivers );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetEpilogue ] ) {
+            auto epilogueResult = checker->zeDriverGetEpilogue( pCount, phDrivers, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -101,7 +89,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phDrivers) && (i < *pCount); ++i){
                 if (phDrivers[i]){
-                    context.handleLifetime->addHandle( phDrivers[i] );
+                    context.handleLifetime->addHandle( phDrivers[i], pCount );
                     context.handleLifetime->addDependent( pCount, phDrivers[i] );
                 }
             }
@@ -130,17 +118,11 @@ namespace validation_layer
         if( nullptr == pfnInitDrivers )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeInitDriversPrologue( pCount, phDrivers, desc );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeInitDriversPrologue ] ) {
+            auto result = checker->zeInitDriversPrologue( pCount, phDrivers, desc );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeInitDriversPrologue( pCount, phDrivers, desc );
@@ -149,9 +131,9 @@ namespace validation_layer
 
         auto result = pfnInitDrivers( pCount, phDrivers, desc );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeInitDriversEpilogue( pCount, phDrivers, desc );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeInitDriversEpilogue ] ) {
+            auto epilogueResult = checker->zeInitDriversEpilogue( pCount, phDrivers, desc, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -170,17 +152,11 @@ namespace validation_layer
         if( nullptr == pfnGetApiVersion )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetApiVersionPrologue( hDriver, version );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetApiVersionPrologue ] ) {
+            auto result = checker->zeDriverGetApiVersionPrologue( hDriver, version );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetApiVersionPrologue( hDriver, version );
@@ -189,9 +165,9 @@ namespace validation_layer
 
         auto result = pfnGetApiVersion( hDriver, version );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetApiVersionEpilogue( hDriver, version );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetApiVersionEpilogue ] ) {
+            auto epilogueResult = checker->zeDriverGetApiVersionEpilogue( hDriver, version, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -210,17 +186,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetPropertiesPrologue( hDriver, pDriverProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetPropertiesPrologue ] ) {
+            auto result = checker->zeDriverGetPropertiesPrologue( hDriver, pDriverProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetPropertiesPrologue( hDriver, pDriverProperties );
@@ -229,9 +199,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hDriver, pDriverProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetPropertiesEpilogue( hDriver, pDriverProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDriverGetPropertiesEpilogue( hDriver, pDriverProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -250,17 +220,11 @@ namespace validation_layer
         if( nullptr == pfnGetIpcProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetIpcPropertiesPrologue( hDriver, pIpcProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetIpcPropertiesPrologue ] ) {
+            auto result = checker->zeDriverGetIpcPropertiesPrologue( hDriver, pIpcProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetIpcPropertiesPrologue( hDriver, pIpcProperties );
@@ -269,9 +233,9 @@ namespace validation_layer
 
         auto result = pfnGetIpcProperties( hDriver, pIpcProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetIpcPropertiesEpilogue( hDriver, pIpcProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetIpcPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDriverGetIpcPropertiesEpilogue( hDriver, pIpcProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -299,17 +263,11 @@ namespace validation_layer
         if( nullptr == pfnGetExtensionProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetExtensionPropertiesPrologue ] ) {
+            auto result = checker->zeDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
@@ -318,9 +276,9 @@ namespace validation_layer
 
         auto result = pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetExtensionPropertiesEpilogue( hDriver, pCount, pExtensionProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetExtensionPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDriverGetExtensionPropertiesEpilogue( hDriver, pCount, pExtensionProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -340,17 +298,11 @@ namespace validation_layer
         if( nullptr == pfnGetExtensionFunctionAddress )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetExtensionFunctionAddressPrologue ] ) {
+            auto result = checker->zeDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
@@ -359,9 +311,9 @@ namespace validation_layer
 
         auto result = pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetExtensionFunctionAddressEpilogue( hDriver, name, ppFunctionAddress );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetExtensionFunctionAddressEpilogue ] ) {
+            auto epilogueResult = checker->zeDriverGetExtensionFunctionAddressEpilogue( hDriver, name, ppFunctionAddress, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -381,17 +333,11 @@ namespace validation_layer
         if( nullptr == pfnGetLastErrorDescription )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetLastErrorDescriptionPrologue( hDriver, ppString );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetLastErrorDescriptionPrologue ] ) {
+            auto result = checker->zeDriverGetLastErrorDescriptionPrologue( hDriver, ppString );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetLastErrorDescriptionPrologue( hDriver, ppString );
@@ -400,9 +346,9 @@ namespace validation_layer
 
         auto result = pfnGetLastErrorDescription( hDriver, ppString );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverGetLastErrorDescriptionEpilogue( hDriver, ppString );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverGetLastErrorDescriptionEpilogue ] ) {
+            auto epilogueResult = checker->zeDriverGetLastErrorDescriptionEpilogue( hDriver, ppString, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -428,17 +374,11 @@ namespace validation_layer
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetPrologue( hDriver, pCount, phDevices );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetPrologue ] ) {
+            auto result = checker->zeDeviceGetPrologue( hDriver, pCount, phDevices );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetPrologue( hDriver, pCount, phDevices );
@@ -447,9 +387,9 @@ namespace validation_layer
 
         auto result = pfnGet( hDriver, pCount, phDevices );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetEpilogue( hDriver, pCount, phDevices );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetEpilogue( hDriver, pCount, phDevices, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -457,7 +397,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phDevices) && (i < *pCount); ++i){
                 if (phDevices[i]){
-                    context.handleLifetime->addHandle( phDevices[i] );
+                    context.handleLifetime->addHandle( phDevices[i], hDriver );
                     context.handleLifetime->addDependent( hDriver, phDevices[i] );
                 }
             }
@@ -478,17 +418,11 @@ namespace validation_layer
         if( nullptr == pfnGetRootDevice )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetRootDevicePrologue( hDevice, phRootDevice );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetRootDevicePrologue ] ) {
+            auto result = checker->zeDeviceGetRootDevicePrologue( hDevice, phRootDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetRootDevicePrologue( hDevice, phRootDevice );
@@ -497,9 +431,9 @@ namespace validation_layer
 
         auto result = pfnGetRootDevice( hDevice, phRootDevice );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetRootDeviceEpilogue( hDevice, phRootDevice );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetRootDeviceEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetRootDeviceEpilogue( hDevice, phRootDevice, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -525,17 +459,11 @@ namespace validation_layer
         if( nullptr == pfnGetSubDevices )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetSubDevicesPrologue( hDevice, pCount, phSubdevices );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetSubDevicesPrologue ] ) {
+            auto result = checker->zeDeviceGetSubDevicesPrologue( hDevice, pCount, phSubdevices );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetSubDevicesPrologue( hDevice, pCount, phSubdevices );
@@ -544,9 +472,9 @@ namespace validation_layer
 
         auto result = pfnGetSubDevices( hDevice, pCount, phSubdevices );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetSubDevicesEpilogue( hDevice, pCount, phSubdevices );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetSubDevicesEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetSubDevicesEpilogue( hDevice, pCount, phSubdevices, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -554,7 +482,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phSubdevices) && (i < *pCount); ++i){
                 if (phSubdevices[i]){
-                    context.handleLifetime->addHandle( phSubdevices[i] );
+                    context.handleLifetime->addHandle( phSubdevices[i], hDevice );
                     context.handleLifetime->addDependent( hDevice, phSubdevices[i] );
                 }
             }
@@ -575,17 +503,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetPropertiesPrologue( hDevice, pDeviceProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetPropertiesPrologue ] ) {
+            auto result = checker->zeDeviceGetPropertiesPrologue( hDevice, pDeviceProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetPropertiesPrologue( hDevice, pDeviceProperties );
@@ -594,9 +516,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hDevice, pDeviceProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetPropertiesEpilogue( hDevice, pDeviceProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetPropertiesEpilogue( hDevice, pDeviceProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -615,17 +537,11 @@ namespace validation_layer
         if( nullptr == pfnGetComputeProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetComputePropertiesPrologue( hDevice, pComputeProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetComputePropertiesPrologue ] ) {
+            auto result = checker->zeDeviceGetComputePropertiesPrologue( hDevice, pComputeProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetComputePropertiesPrologue( hDevice, pComputeProperties );
@@ -634,9 +550,9 @@ namespace validation_layer
 
         auto result = pfnGetComputeProperties( hDevice, pComputeProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetComputePropertiesEpilogue( hDevice, pComputeProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetComputePropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetComputePropertiesEpilogue( hDevice, pComputeProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -655,17 +571,11 @@ namespace validation_layer
         if( nullptr == pfnGetModuleProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetModulePropertiesPrologue( hDevice, pModuleProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetModulePropertiesPrologue ] ) {
+            auto result = checker->zeDeviceGetModulePropertiesPrologue( hDevice, pModuleProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetModulePropertiesPrologue( hDevice, pModuleProperties );
@@ -674,9 +584,9 @@ namespace validation_layer
 
         auto result = pfnGetModuleProperties( hDevice, pModuleProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetModulePropertiesEpilogue( hDevice, pModuleProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetModulePropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetModulePropertiesEpilogue( hDevice, pModuleProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -705,17 +615,11 @@ namespace validation_layer
         if( nullptr == pfnGetCommandQueueGroupProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetCommandQueueGroupPropertiesPrologue( hDevice, pCount, pCommandQueueGroupProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetCommandQueueGroupPropertiesPrologue ] ) {
+            auto result = checker->zeDeviceGetCommandQueueGroupPropertiesPrologue( hDevice, pCount, pCommandQueueGroupProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetCommandQueueGroupPropertiesPrologue( hDevice, pCount, pCommandQueueGroupProperties );
@@ -724,9 +628,9 @@ namespace validation_layer
 
         auto result = pfnGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetCommandQueueGroupPropertiesEpilogue( hDevice, pCount, pCommandQueueGroupProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetCommandQueueGroupPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetCommandQueueGroupPropertiesEpilogue( hDevice, pCount, pCommandQueueGroupProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -754,17 +658,11 @@ namespace validation_layer
         if( nullptr == pfnGetMemoryProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetMemoryPropertiesPrologue( hDevice, pCount, pMemProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetMemoryPropertiesPrologue ] ) {
+            auto result = checker->zeDeviceGetMemoryPropertiesPrologue( hDevice, pCount, pMemProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetMemoryPropertiesPrologue( hDevice, pCount, pMemProperties );
@@ -773,9 +671,9 @@ namespace validation_layer
 
         auto result = pfnGetMemoryProperties( hDevice, pCount, pMemProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetMemoryPropertiesEpilogue( hDevice, pCount, pMemProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetMemoryPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetMemoryPropertiesEpilogue( hDevice, pCount, pMemProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -794,17 +692,11 @@ namespace validation_layer
         if( nullptr == pfnGetMemoryAccessProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetMemoryAccessPropertiesPrologue( hDevice, pMemAccessProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetMemoryAccessPropertiesPrologue ] ) {
+            auto result = checker->zeDeviceGetMemoryAccessPropertiesPrologue( hDevice, pMemAccessProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetMemoryAccessPropertiesPrologue( hDevice, pMemAccessProperties );
@@ -813,9 +705,9 @@ namespace validation_layer
 
         auto result = pfnGetMemoryAccessProperties( hDevice, pMemAccessProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetMemoryAccessPropertiesEpilogue( hDevice, pMemAccessProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetMemoryAccessPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetMemoryAccessPropertiesEpilogue( hDevice, pMemAccessProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -842,17 +734,11 @@ namespace validation_layer
         if( nullptr == pfnGetCacheProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetCachePropertiesPrologue( hDevice, pCount, pCacheProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetCachePropertiesPrologue ] ) {
+            auto result = checker->zeDeviceGetCachePropertiesPrologue( hDevice, pCount, pCacheProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetCachePropertiesPrologue( hDevice, pCount, pCacheProperties );
@@ -861,9 +747,9 @@ namespace validation_layer
 
         auto result = pfnGetCacheProperties( hDevice, pCount, pCacheProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetCachePropertiesEpilogue( hDevice, pCount, pCacheProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetCachePropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetCachePropertiesEpilogue( hDevice, pCount, pCacheProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -882,17 +768,11 @@ namespace validation_layer
         if( nullptr == pfnGetImageProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetImagePropertiesPrologue( hDevice, pImageProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetImagePropertiesPrologue ] ) {
+            auto result = checker->zeDeviceGetImagePropertiesPrologue( hDevice, pImageProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetImagePropertiesPrologue( hDevice, pImageProperties );
@@ -901,9 +781,9 @@ namespace validation_layer
 
         auto result = pfnGetImageProperties( hDevice, pImageProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetImagePropertiesEpilogue( hDevice, pImageProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetImagePropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetImagePropertiesEpilogue( hDevice, pImageProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -922,17 +802,11 @@ namespace validation_layer
         if( nullptr == pfnGetExternalMemoryProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetExternalMemoryPropertiesPrologue( hDevice, pExternalMemoryProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetExternalMemoryPropertiesPrologue ] ) {
+            auto result = checker->zeDeviceGetExternalMemoryPropertiesPrologue( hDevice, pExternalMemoryProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetExternalMemoryPropertiesPrologue( hDevice, pExternalMemoryProperties );
@@ -941,9 +815,9 @@ namespace validation_layer
 
         auto result = pfnGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetExternalMemoryPropertiesEpilogue( hDevice, pExternalMemoryProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetExternalMemoryPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetExternalMemoryPropertiesEpilogue( hDevice, pExternalMemoryProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -963,17 +837,11 @@ namespace validation_layer
         if( nullptr == pfnGetP2PProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetP2PPropertiesPrologue( hDevice, hPeerDevice, pP2PProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetP2PPropertiesPrologue ] ) {
+            auto result = checker->zeDeviceGetP2PPropertiesPrologue( hDevice, hPeerDevice, pP2PProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetP2PPropertiesPrologue( hDevice, hPeerDevice, pP2PProperties );
@@ -982,9 +850,9 @@ namespace validation_layer
 
         auto result = pfnGetP2PProperties( hDevice, hPeerDevice, pP2PProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetP2PPropertiesEpilogue( hDevice, hPeerDevice, pP2PProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetP2PPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetP2PPropertiesEpilogue( hDevice, hPeerDevice, pP2PProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1004,17 +872,11 @@ namespace validation_layer
         if( nullptr == pfnCanAccessPeer )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceCanAccessPeerPrologue( hDevice, hPeerDevice, value );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceCanAccessPeerPrologue ] ) {
+            auto result = checker->zeDeviceCanAccessPeerPrologue( hDevice, hPeerDevice, value );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceCanAccessPeerPrologue( hDevice, hPeerDevice, value );
@@ -1023,9 +885,9 @@ namespace validation_layer
 
         auto result = pfnCanAccessPeer( hDevice, hPeerDevice, value );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceCanAccessPeerEpilogue( hDevice, hPeerDevice, value );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceCanAccessPeerEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceCanAccessPeerEpilogue( hDevice, hPeerDevice, value, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1043,17 +905,11 @@ namespace validation_layer
         if( nullptr == pfnGetStatus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetStatusPrologue( hDevice );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetStatusPrologue ] ) {
+            auto result = checker->zeDeviceGetStatusPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetStatusPrologue( hDevice );
@@ -1062,9 +918,9 @@ namespace validation_layer
 
         auto result = pfnGetStatus( hDevice );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetStatusEpilogue( hDevice );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetStatusEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetStatusEpilogue( hDevice, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1086,17 +942,11 @@ namespace validation_layer
         if( nullptr == pfnGetGlobalTimestamps )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetGlobalTimestampsPrologue( hDevice, hostTimestamp, deviceTimestamp );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetGlobalTimestampsPrologue ] ) {
+            auto result = checker->zeDeviceGetGlobalTimestampsPrologue( hDevice, hostTimestamp, deviceTimestamp );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetGlobalTimestampsPrologue( hDevice, hostTimestamp, deviceTimestamp );
@@ -1105,9 +955,9 @@ namespace validation_layer
 
         auto result = pfnGetGlobalTimestamps( hDevice, hostTimestamp, deviceTimestamp );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetGlobalTimestampsEpilogue( hDevice, hostTimestamp, deviceTimestamp );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetGlobalTimestampsEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetGlobalTimestampsEpilogue( hDevice, hostTimestamp, deviceTimestamp, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1127,17 +977,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextCreatePrologue( hDriver, desc, phContext );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextCreatePrologue ] ) {
+            auto result = checker->zeContextCreatePrologue( hDriver, desc, phContext );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextCreatePrologue( hDriver, desc, phContext );
@@ -1146,16 +990,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hDriver, desc, phContext );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextCreateEpilogue( hDriver, desc, phContext );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextCreateEpilogue ] ) {
+            auto epilogueResult = checker->zeContextCreateEpilogue( hDriver, desc, phContext, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phContext){
-                context.handleLifetime->addHandle( *phContext );
+                context.handleLifetime->addHandle( *phContext, hDriver );
                 context.handleLifetime->addDependent( hDriver, *phContext );
 
             }
@@ -1187,17 +1031,11 @@ namespace validation_layer
         if( nullptr == pfnCreateEx )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextCreateExPrologue( hDriver, desc, numDevices, phDevices, phContext );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextCreateExPrologue ] ) {
+            auto result = checker->zeContextCreateExPrologue( hDriver, desc, numDevices, phDevices, phContext );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextCreateExPrologue( hDriver, desc, numDevices, phDevices, phContext );
@@ -1206,16 +1044,16 @@ namespace validation_layer
 
         auto result = pfnCreateEx( hDriver, desc, numDevices, phDevices, phContext );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextCreateExEpilogue( hDriver, desc, numDevices, phDevices, phContext );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextCreateExEpilogue ] ) {
+            auto epilogueResult = checker->zeContextCreateExEpilogue( hDriver, desc, numDevices, phDevices, phContext, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phContext){
-                context.handleLifetime->addHandle( *phContext );
+                context.handleLifetime->addHandle( *phContext, hDriver );
                 context.handleLifetime->addDependent( hDriver, *phContext );
 
             }
@@ -1235,17 +1073,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextDestroyPrologue( hContext );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextDestroyPrologue ] ) {
+            auto result = checker->zeContextDestroyPrologue( hContext );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextDestroyPrologue( hContext );
@@ -1254,9 +1086,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hContext );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextDestroyEpilogue( hContext );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zeContextDestroyEpilogue( hContext, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1274,17 +1106,11 @@ namespace validation_layer
         if( nullptr == pfnGetStatus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextGetStatusPrologue( hContext );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextGetStatusPrologue ] ) {
+            auto result = checker->zeContextGetStatusPrologue( hContext );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextGetStatusPrologue( hContext );
@@ -1293,9 +1119,9 @@ namespace validation_layer
 
         auto result = pfnGetStatus( hContext );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextGetStatusEpilogue( hContext );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextGetStatusEpilogue ] ) {
+            auto epilogueResult = checker->zeContextGetStatusEpilogue( hContext, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1316,17 +1142,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueCreatePrologue( hContext, hDevice, desc, phCommandQueue );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandQueueCreatePrologue ] ) {
+            auto result = checker->zeCommandQueueCreatePrologue( hContext, hDevice, desc, phCommandQueue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueCreatePrologue( hContext, hDevice, desc, phCommandQueue );
@@ -1335,16 +1155,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, desc, phCommandQueue );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueCreateEpilogue( hContext, hDevice, desc, phCommandQueue );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandQueueCreateEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandQueueCreateEpilogue( hContext, hDevice, desc, phCommandQueue, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phCommandQueue){
-                context.handleLifetime->addHandle( *phCommandQueue );
+                context.handleLifetime->addHandle( *phCommandQueue, hContext );
                 context.handleLifetime->addDependent( hContext, *phCommandQueue );
 
             }
@@ -1364,17 +1184,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueDestroyPrologue( hCommandQueue );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandQueueDestroyPrologue ] ) {
+            auto result = checker->zeCommandQueueDestroyPrologue( hCommandQueue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueDestroyPrologue( hCommandQueue );
@@ -1383,9 +1197,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hCommandQueue );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueDestroyEpilogue( hCommandQueue );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandQueueDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandQueueDestroyEpilogue( hCommandQueue, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1407,17 +1221,11 @@ namespace validation_layer
         if( nullptr == pfnExecuteCommandLists )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueExecuteCommandListsPrologue( hCommandQueue, numCommandLists, phCommandLists, hFence );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandQueueExecuteCommandListsPrologue ] ) {
+            auto result = checker->zeCommandQueueExecuteCommandListsPrologue( hCommandQueue, numCommandLists, phCommandLists, hFence );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueExecuteCommandListsPrologue( hCommandQueue, numCommandLists, phCommandLists, hFence );
@@ -1426,9 +1234,9 @@ namespace validation_layer
 
         auto result = pfnExecuteCommandLists( hCommandQueue, numCommandLists, phCommandLists, hFence );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueExecuteCommandListsEpilogue( hCommandQueue, numCommandLists, phCommandLists, hFence );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandQueueExecuteCommandListsEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandQueueExecuteCommandListsEpilogue( hCommandQueue, numCommandLists, phCommandLists, hFence, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1453,17 +1261,11 @@ namespace validation_layer
         if( nullptr == pfnSynchronize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueSynchronizePrologue( hCommandQueue, timeout );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandQueueSynchronizePrologue ] ) {
+            auto result = checker->zeCommandQueueSynchronizePrologue( hCommandQueue, timeout );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueSynchronizePrologue( hCommandQueue, timeout );
@@ -1472,9 +1274,9 @@ namespace validation_layer
 
         auto result = pfnSynchronize( hCommandQueue, timeout );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueSynchronizeEpilogue( hCommandQueue, timeout );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandQueueSynchronizeEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandQueueSynchronizeEpilogue( hCommandQueue, timeout, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1493,17 +1295,11 @@ namespace validation_layer
         if( nullptr == pfnGetOrdinal )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueGetOrdinalPrologue( hCommandQueue, pOrdinal );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandQueueGetOrdinalPrologue ] ) {
+            auto result = checker->zeCommandQueueGetOrdinalPrologue( hCommandQueue, pOrdinal );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueGetOrdinalPrologue( hCommandQueue, pOrdinal );
@@ -1512,9 +1308,9 @@ namespace validation_layer
 
         auto result = pfnGetOrdinal( hCommandQueue, pOrdinal );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueGetOrdinalEpilogue( hCommandQueue, pOrdinal );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandQueueGetOrdinalEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandQueueGetOrdinalEpilogue( hCommandQueue, pOrdinal, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1533,17 +1329,11 @@ namespace validation_layer
         if( nullptr == pfnGetIndex )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueGetIndexPrologue( hCommandQueue, pIndex );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandQueueGetIndexPrologue ] ) {
+            auto result = checker->zeCommandQueueGetIndexPrologue( hCommandQueue, pIndex );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueGetIndexPrologue( hCommandQueue, pIndex );
@@ -1552,9 +1342,9 @@ namespace validation_layer
 
         auto result = pfnGetIndex( hCommandQueue, pIndex );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueGetIndexEpilogue( hCommandQueue, pIndex );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandQueueGetIndexEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandQueueGetIndexEpilogue( hCommandQueue, pIndex, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1575,17 +1365,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListCreatePrologue( hContext, hDevice, desc, phCommandList );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListCreatePrologue ] ) {
+            auto result = checker->zeCommandListCreatePrologue( hContext, hDevice, desc, phCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListCreatePrologue( hContext, hDevice, desc, phCommandList );
@@ -1594,16 +1378,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, desc, phCommandList );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListCreateEpilogue( hContext, hDevice, desc, phCommandList );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListCreateEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListCreateEpilogue( hContext, hDevice, desc, phCommandList, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phCommandList){
-                context.handleLifetime->addHandle( *phCommandList );
+                context.handleLifetime->addHandle( *phCommandList, hContext );
                 context.handleLifetime->addDependent( hContext, *phCommandList );
 
             }
@@ -1626,17 +1410,11 @@ namespace validation_layer
         if( nullptr == pfnCreateImmediate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListCreateImmediatePrologue( hContext, hDevice, altdesc, phCommandList );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListCreateImmediatePrologue ] ) {
+            auto result = checker->zeCommandListCreateImmediatePrologue( hContext, hDevice, altdesc, phCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListCreateImmediatePrologue( hContext, hDevice, altdesc, phCommandList );
@@ -1645,16 +1423,16 @@ namespace validation_layer
 
         auto result = pfnCreateImmediate( hContext, hDevice, altdesc, phCommandList );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListCreateImmediateEpilogue( hContext, hDevice, altdesc, phCommandList );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListCreateImmediateEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListCreateImmediateEpilogue( hContext, hDevice, altdesc, phCommandList, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phCommandList){
-                context.handleLifetime->addHandle( *phCommandList , false);
+                context.handleLifetime->addHandle( *phCommandList, hContext, false );
             }
         }
         return result;
@@ -1672,15 +1450,14 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListDestroyPrologue( hCommandList );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListDestroyPrologue ] ) {
+            auto result = checker->zeCommandListDestroyPrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListDestroy" );
         }
 
         
@@ -1691,9 +1468,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hCommandList );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListDestroyEpilogue( hCommandList );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListDestroyEpilogue( hCommandList, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1711,15 +1488,14 @@ namespace validation_layer
         if( nullptr == pfnClose )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListClosePrologue( hCommandList );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListClosePrologue ] ) {
+            auto result = checker->zeCommandListClosePrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListClose" );
         }
 
         
@@ -1730,9 +1506,9 @@ namespace validation_layer
 
         auto result = pfnClose( hCommandList );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListCloseEpilogue( hCommandList );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListCloseEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListCloseEpilogue( hCommandList, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1750,15 +1526,14 @@ namespace validation_layer
         if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListResetPrologue( hCommandList );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListResetPrologue ] ) {
+            auto result = checker->zeCommandListResetPrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListReset" );
         }
 
         
@@ -1769,9 +1544,9 @@ namespace validation_layer
 
         auto result = pfnReset( hCommandList );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListResetEpilogue( hCommandList );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListResetEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListResetEpilogue( hCommandList, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1796,15 +1571,14 @@ namespace validation_layer
         if( nullptr == pfnAppendWriteGlobalTimestamp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendWriteGlobalTimestampPrologue( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendWriteGlobalTimestampPrologue ] ) {
+            auto result = checker->zeCommandListAppendWriteGlobalTimestampPrologue( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendWriteGlobalTimestamp" );
         }
 
         
@@ -1815,9 +1589,9 @@ namespace validation_layer
 
         auto result = pfnAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendWriteGlobalTimestampEpilogue( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendWriteGlobalTimestampEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendWriteGlobalTimestampEpilogue( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1842,15 +1616,14 @@ namespace validation_layer
         if( nullptr == pfnHostSynchronize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListHostSynchronizePrologue( hCommandList, timeout );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListHostSynchronizePrologue ] ) {
+            auto result = checker->zeCommandListHostSynchronizePrologue( hCommandList, timeout );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hCommandList, "zeCommandListHostSynchronize" );
         }
 
         
@@ -1861,9 +1634,9 @@ namespace validation_layer
 
         auto result = pfnHostSynchronize( hCommandList, timeout );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListHostSynchronizeEpilogue( hCommandList, timeout );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListHostSynchronizeEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListHostSynchronizeEpilogue( hCommandList, timeout, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1882,15 +1655,14 @@ namespace validation_layer
         if( nullptr == pfnGetDeviceHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetDeviceHandlePrologue( hCommandList, phDevice );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListGetDeviceHandlePrologue ] ) {
+            auto result = checker->zeCommandListGetDeviceHandlePrologue( hCommandList, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hCommandList, "zeCommandListGetDeviceHandle" );
         }
 
         
@@ -1901,9 +1673,9 @@ namespace validation_layer
 
         auto result = pfnGetDeviceHandle( hCommandList, phDevice );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetDeviceHandleEpilogue( hCommandList, phDevice );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListGetDeviceHandleEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListGetDeviceHandleEpilogue( hCommandList, phDevice, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1922,15 +1694,14 @@ namespace validation_layer
         if( nullptr == pfnGetContextHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetContextHandlePrologue( hCommandList, phContext );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListGetContextHandlePrologue ] ) {
+            auto result = checker->zeCommandListGetContextHandlePrologue( hCommandList, phContext );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hCommandList, "zeCommandListGetContextHandle" );
         }
 
         
@@ -1941,9 +1712,9 @@ namespace validation_layer
 
         auto result = pfnGetContextHandle( hCommandList, phContext );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetContextHandleEpilogue( hCommandList, phContext );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListGetContextHandleEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListGetContextHandleEpilogue( hCommandList, phContext, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1962,15 +1733,14 @@ namespace validation_layer
         if( nullptr == pfnGetOrdinal )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetOrdinalPrologue( hCommandList, pOrdinal );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListGetOrdinalPrologue ] ) {
+            auto result = checker->zeCommandListGetOrdinalPrologue( hCommandList, pOrdinal );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hCommandList, "zeCommandListGetOrdinal" );
         }
 
         
@@ -1981,9 +1751,9 @@ namespace validation_layer
 
         auto result = pfnGetOrdinal( hCommandList, pOrdinal );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetOrdinalEpilogue( hCommandList, pOrdinal );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListGetOrdinalEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListGetOrdinalEpilogue( hCommandList, pOrdinal, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2003,15 +1773,14 @@ namespace validation_layer
         if( nullptr == pfnImmediateGetIndex )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListImmediateGetIndexPrologue( hCommandListImmediate, pIndex );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListImmediateGetIndexPrologue ] ) {
+            auto result = checker->zeCommandListImmediateGetIndexPrologue( hCommandListImmediate, pIndex );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hCommandListImmediate, "zeCommandListImmediateGetIndex" );
         }
 
         
@@ -2022,9 +1791,9 @@ namespace validation_layer
 
         auto result = pfnImmediateGetIndex( hCommandListImmediate, pIndex );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListImmediateGetIndexEpilogue( hCommandListImmediate, pIndex );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListImmediateGetIndexEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListImmediateGetIndexEpilogue( hCommandListImmediate, pIndex, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2044,15 +1813,14 @@ namespace validation_layer
         if( nullptr == pfnIsImmediate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListIsImmediatePrologue( hCommandList, pIsImmediate );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListIsImmediatePrologue ] ) {
+            auto result = checker->zeCommandListIsImmediatePrologue( hCommandList, pIsImmediate );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hCommandList, "zeCommandListIsImmediate" );
         }
 
         
@@ -2063,9 +1831,9 @@ namespace validation_layer
 
         auto result = pfnIsImmediate( hCommandList, pIsImmediate );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListIsImmediateEpilogue( hCommandList, pIsImmediate );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListIsImmediateEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListIsImmediateEpilogue( hCommandList, pIsImmediate, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2088,15 +1856,14 @@ namespace validation_layer
         if( nullptr == pfnAppendBarrier )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendBarrierPrologue( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendBarrierPrologue ] ) {
+            auto result = checker->zeCommandListAppendBarrierPrologue( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendBarrier" );
         }
 
         
@@ -2107,9 +1874,9 @@ namespace validation_layer
 
         auto result = pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendBarrierEpilogue( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendBarrierEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendBarrierEpilogue( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2135,15 +1902,14 @@ namespace validation_layer
         if( nullptr == pfnAppendMemoryRangesBarrier )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryRangesBarrierPrologue( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemoryRangesBarrierPrologue ] ) {
+            auto result = checker->zeCommandListAppendMemoryRangesBarrierPrologue( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendMemoryRangesBarrier" );
         }
 
         
@@ -2154,9 +1920,9 @@ namespace validation_layer
 
         auto result = pfnAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryRangesBarrierEpilogue( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemoryRangesBarrierEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendMemoryRangesBarrierEpilogue( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2175,17 +1941,11 @@ namespace validation_layer
         if( nullptr == pfnSystemBarrier )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextSystemBarrierPrologue( hContext, hDevice );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextSystemBarrierPrologue ] ) {
+            auto result = checker->zeContextSystemBarrierPrologue( hContext, hDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextSystemBarrierPrologue( hContext, hDevice );
@@ -2194,9 +1954,9 @@ namespace validation_layer
 
         auto result = pfnSystemBarrier( hContext, hDevice );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextSystemBarrierEpilogue( hContext, hDevice );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextSystemBarrierEpilogue ] ) {
+            auto epilogueResult = checker->zeContextSystemBarrierEpilogue( hContext, hDevice, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2222,15 +1982,14 @@ namespace validation_layer
         if( nullptr == pfnAppendMemoryCopy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryCopyPrologue( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemoryCopyPrologue ] ) {
+            auto result = checker->zeCommandListAppendMemoryCopyPrologue( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendMemoryCopy" );
         }
 
         
@@ -2241,9 +2000,9 @@ namespace validation_layer
 
         auto result = pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryCopyEpilogue( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemoryCopyEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendMemoryCopyEpilogue( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2270,15 +2029,14 @@ namespace validation_layer
         if( nullptr == pfnAppendMemoryFill )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryFillPrologue( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemoryFillPrologue ] ) {
+            auto result = checker->zeCommandListAppendMemoryFillPrologue( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendMemoryFill" );
         }
 
         
@@ -2289,9 +2047,9 @@ namespace validation_layer
 
         auto result = pfnAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryFillEpilogue( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemoryFillEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendMemoryFillEpilogue( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2326,15 +2084,14 @@ namespace validation_layer
         if( nullptr == pfnAppendMemoryCopyRegion )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryCopyRegionPrologue( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemoryCopyRegionPrologue ] ) {
+            auto result = checker->zeCommandListAppendMemoryCopyRegionPrologue( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendMemoryCopyRegion" );
         }
 
         
@@ -2345,9 +2102,9 @@ namespace validation_layer
 
         auto result = pfnAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryCopyRegionEpilogue( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemoryCopyRegionEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendMemoryCopyRegionEpilogue( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2374,15 +2131,14 @@ namespace validation_layer
         if( nullptr == pfnAppendMemoryCopyFromContext )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryCopyFromContextPrologue( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemoryCopyFromContextPrologue ] ) {
+            auto result = checker->zeCommandListAppendMemoryCopyFromContextPrologue( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendMemoryCopyFromContext" );
         }
 
         
@@ -2393,9 +2149,9 @@ namespace validation_layer
 
         auto result = pfnAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryCopyFromContextEpilogue( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemoryCopyFromContextEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendMemoryCopyFromContextEpilogue( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2420,15 +2176,14 @@ namespace validation_layer
         if( nullptr == pfnAppendImageCopy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyPrologue( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendImageCopyPrologue ] ) {
+            auto result = checker->zeCommandListAppendImageCopyPrologue( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendImageCopy" );
         }
 
         
@@ -2439,9 +2194,9 @@ namespace validation_layer
 
         auto result = pfnAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyEpilogue( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendImageCopyEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendImageCopyEpilogue( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2468,15 +2223,14 @@ namespace validation_layer
         if( nullptr == pfnAppendImageCopyRegion )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyRegionPrologue( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendImageCopyRegionPrologue ] ) {
+            auto result = checker->zeCommandListAppendImageCopyRegionPrologue( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendImageCopyRegion" );
         }
 
         
@@ -2487,9 +2241,9 @@ namespace validation_layer
 
         auto result = pfnAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyRegionEpilogue( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendImageCopyRegionEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendImageCopyRegionEpilogue( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2515,15 +2269,14 @@ namespace validation_layer
         if( nullptr == pfnAppendImageCopyToMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyToMemoryPrologue( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendImageCopyToMemoryPrologue ] ) {
+            auto result = checker->zeCommandListAppendImageCopyToMemoryPrologue( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendImageCopyToMemory" );
         }
 
         
@@ -2534,9 +2287,9 @@ namespace validation_layer
 
         auto result = pfnAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyToMemoryEpilogue( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendImageCopyToMemoryEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendImageCopyToMemoryEpilogue( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2562,15 +2315,14 @@ namespace validation_layer
         if( nullptr == pfnAppendImageCopyFromMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyFromMemoryPrologue( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendImageCopyFromMemoryPrologue ] ) {
+            auto result = checker->zeCommandListAppendImageCopyFromMemoryPrologue( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendImageCopyFromMemory" );
         }
 
         
@@ -2581,9 +2333,9 @@ namespace validation_layer
 
         auto result = pfnAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyFromMemoryEpilogue( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendImageCopyFromMemoryEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendImageCopyFromMemoryEpilogue( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2603,15 +2355,14 @@ namespace validation_layer
         if( nullptr == pfnAppendMemoryPrefetch )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryPrefetchPrologue( hCommandList, ptr, size );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemoryPrefetchPrologue ] ) {
+            auto result = checker->zeCommandListAppendMemoryPrefetchPrologue( hCommandList, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendMemoryPrefetch" );
         }
 
         
@@ -2622,9 +2373,9 @@ namespace validation_layer
 
         auto result = pfnAppendMemoryPrefetch( hCommandList, ptr, size );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryPrefetchEpilogue( hCommandList, ptr, size );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemoryPrefetchEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendMemoryPrefetchEpilogue( hCommandList, ptr, size, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2646,15 +2397,14 @@ namespace validation_layer
         if( nullptr == pfnAppendMemAdvise )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemAdvisePrologue( hCommandList, hDevice, ptr, size, advice );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemAdvisePrologue ] ) {
+            auto result = checker->zeCommandListAppendMemAdvisePrologue( hCommandList, hDevice, ptr, size, advice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendMemAdvise" );
         }
 
         
@@ -2665,9 +2415,9 @@ namespace validation_layer
 
         auto result = pfnAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemAdviseEpilogue( hCommandList, hDevice, ptr, size, advice );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendMemAdviseEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendMemAdviseEpilogue( hCommandList, hDevice, ptr, size, advice, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2693,17 +2443,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolCreatePrologue( hContext, desc, numDevices, phDevices, phEventPool );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolCreatePrologue ] ) {
+            auto result = checker->zeEventPoolCreatePrologue( hContext, desc, numDevices, phDevices, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolCreatePrologue( hContext, desc, numDevices, phDevices, phEventPool );
@@ -2712,16 +2456,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, desc, numDevices, phDevices, phEventPool );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolCreateEpilogue( hContext, desc, numDevices, phDevices, phEventPool );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolCreateEpilogue ] ) {
+            auto epilogueResult = checker->zeEventPoolCreateEpilogue( hContext, desc, numDevices, phDevices, phEventPool, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phEventPool){
-                context.handleLifetime->addHandle( *phEventPool );
+                context.handleLifetime->addHandle( *phEventPool, hContext );
                 context.handleLifetime->addDependent( hContext, *phEventPool );
 
             }
@@ -2741,17 +2485,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolDestroyPrologue( hEventPool );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolDestroyPrologue ] ) {
+            auto result = checker->zeEventPoolDestroyPrologue( hEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolDestroyPrologue( hEventPool );
@@ -2760,9 +2498,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hEventPool );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolDestroyEpilogue( hEventPool );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zeEventPoolDestroyEpilogue( hEventPool, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2782,17 +2520,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventCreatePrologue( hEventPool, desc, phEvent );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventCreatePrologue ] ) {
+            auto result = checker->zeEventCreatePrologue( hEventPool, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventCreatePrologue( hEventPool, desc, phEvent );
@@ -2801,16 +2533,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hEventPool, desc, phEvent );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventCreateEpilogue( hEventPool, desc, phEvent );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventCreateEpilogue ] ) {
+            auto epilogueResult = checker->zeEventCreateEpilogue( hEventPool, desc, phEvent, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phEvent){
-                context.handleLifetime->addHandle( *phEvent );
+                context.handleLifetime->addHandle( *phEvent, hEventPool );
                 context.handleLifetime->addDependent( hEventPool, *phEvent );
 
             }
@@ -2830,17 +2562,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventDestroyPrologue( hEvent );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventDestroyPrologue ] ) {
+            auto result = checker->zeEventDestroyPrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventDestroyPrologue( hEvent );
@@ -2849,9 +2575,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hEvent );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventDestroyEpilogue( hEvent );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zeEventDestroyEpilogue( hEvent, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2870,17 +2596,11 @@ namespace validation_layer
         if( nullptr == pfnGetIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolGetIpcHandlePrologue( hEventPool, phIpc );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolGetIpcHandlePrologue ] ) {
+            auto result = checker->zeEventPoolGetIpcHandlePrologue( hEventPool, phIpc );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolGetIpcHandlePrologue( hEventPool, phIpc );
@@ -2889,9 +2609,9 @@ namespace validation_layer
 
         auto result = pfnGetIpcHandle( hEventPool, phIpc );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolGetIpcHandleEpilogue( hEventPool, phIpc );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolGetIpcHandleEpilogue ] ) {
+            auto epilogueResult = checker->zeEventPoolGetIpcHandleEpilogue( hEventPool, phIpc, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -2915,17 +2635,11 @@ namespace validation_layer
         if( nullptr == pfnPutIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolPutIpcHandlePrologue( hContext, hIpc );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolPutIpcHandlePrologue ] ) {
+            auto result = checker->zeEventPoolPutIpcHandlePrologue( hContext, hIpc );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolPutIpcHandlePrologue( hContext, hIpc );
@@ -2934,9 +2648,9 @@ namespace validation_layer
 
         auto result = pfnPutIpcHandle( hContext, hIpc );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolPutIpcHandleEpilogue( hContext, hIpc );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolPutIpcHandleEpilogue ] ) {
+            auto epilogueResult = checker->zeEventPoolPutIpcHandleEpilogue( hContext, hIpc, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2957,17 +2671,11 @@ namespace validation_layer
         if( nullptr == pfnOpenIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolOpenIpcHandlePrologue( hContext, hIpc, phEventPool );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolOpenIpcHandlePrologue ] ) {
+            auto result = checker->zeEventPoolOpenIpcHandlePrologue( hContext, hIpc, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolOpenIpcHandlePrologue( hContext, hIpc, phEventPool );
@@ -2976,9 +2684,9 @@ namespace validation_layer
 
         auto result = pfnOpenIpcHandle( hContext, hIpc, phEventPool );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolOpenIpcHandleEpilogue( hContext, hIpc, phEventPool );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolOpenIpcHandleEpilogue ] ) {
+            auto epilogueResult = checker->zeEventPoolOpenIpcHandleEpilogue( hContext, hIpc, phEventPool, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2996,17 +2704,11 @@ namespace validation_layer
         if( nullptr == pfnCloseIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolCloseIpcHandlePrologue( hEventPool );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolCloseIpcHandlePrologue ] ) {
+            auto result = checker->zeEventPoolCloseIpcHandlePrologue( hEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolCloseIpcHandlePrologue( hEventPool );
@@ -3015,9 +2717,9 @@ namespace validation_layer
 
         auto result = pfnCloseIpcHandle( hEventPool );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolCloseIpcHandleEpilogue( hEventPool );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolCloseIpcHandleEpilogue ] ) {
+            auto epilogueResult = checker->zeEventPoolCloseIpcHandleEpilogue( hEventPool, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3036,15 +2738,14 @@ namespace validation_layer
         if( nullptr == pfnAppendSignalEvent )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendSignalEventPrologue( hCommandList, hEvent );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendSignalEventPrologue ] ) {
+            auto result = checker->zeCommandListAppendSignalEventPrologue( hCommandList, hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendSignalEvent" );
         }
 
         
@@ -3055,9 +2756,9 @@ namespace validation_layer
 
         auto result = pfnAppendSignalEvent( hCommandList, hEvent );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendSignalEventEpilogue( hCommandList, hEvent );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendSignalEventEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendSignalEventEpilogue( hCommandList, hEvent, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3078,15 +2779,14 @@ namespace validation_layer
         if( nullptr == pfnAppendWaitOnEvents )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendWaitOnEventsPrologue( hCommandList, numEvents, phEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendWaitOnEventsPrologue ] ) {
+            auto result = checker->zeCommandListAppendWaitOnEventsPrologue( hCommandList, numEvents, phEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendWaitOnEvents" );
         }
 
         
@@ -3097,9 +2797,9 @@ namespace validation_layer
 
         auto result = pfnAppendWaitOnEvents( hCommandList, numEvents, phEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendWaitOnEventsEpilogue( hCommandList, numEvents, phEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendWaitOnEventsEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendWaitOnEventsEpilogue( hCommandList, numEvents, phEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3117,17 +2817,11 @@ namespace validation_layer
         if( nullptr == pfnHostSignal )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventHostSignalPrologue( hEvent );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventHostSignalPrologue ] ) {
+            auto result = checker->zeEventHostSignalPrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventHostSignalPrologue( hEvent );
@@ -3136,9 +2830,9 @@ namespace validation_layer
 
         auto result = pfnHostSignal( hEvent );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventHostSignalEpilogue( hEvent );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventHostSignalEpilogue ] ) {
+            auto epilogueResult = checker->zeEventHostSignalEpilogue( hEvent, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3163,17 +2857,11 @@ namespace validation_layer
         if( nullptr == pfnHostSynchronize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventHostSynchronizePrologue( hEvent, timeout );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventHostSynchronizePrologue ] ) {
+            auto result = checker->zeEventHostSynchronizePrologue( hEvent, timeout );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventHostSynchronizePrologue( hEvent, timeout );
@@ -3182,9 +2870,9 @@ namespace validation_layer
 
         auto result = pfnHostSynchronize( hEvent, timeout );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventHostSynchronizeEpilogue( hEvent, timeout );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventHostSynchronizeEpilogue ] ) {
+            auto epilogueResult = checker->zeEventHostSynchronizeEpilogue( hEvent, timeout, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3202,17 +2890,11 @@ namespace validation_layer
         if( nullptr == pfnQueryStatus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventQueryStatusPrologue( hEvent );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventQueryStatusPrologue ] ) {
+            auto result = checker->zeEventQueryStatusPrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventQueryStatusPrologue( hEvent );
@@ -3221,9 +2903,9 @@ namespace validation_layer
 
         auto result = pfnQueryStatus( hEvent );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventQueryStatusEpilogue( hEvent );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventQueryStatusEpilogue ] ) {
+            auto epilogueResult = checker->zeEventQueryStatusEpilogue( hEvent, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3242,15 +2924,14 @@ namespace validation_layer
         if( nullptr == pfnAppendEventReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendEventResetPrologue( hCommandList, hEvent );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendEventResetPrologue ] ) {
+            auto result = checker->zeCommandListAppendEventResetPrologue( hCommandList, hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendEventReset" );
         }
 
         
@@ -3261,9 +2942,9 @@ namespace validation_layer
 
         auto result = pfnAppendEventReset( hCommandList, hEvent );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendEventResetEpilogue( hCommandList, hEvent );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendEventResetEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendEventResetEpilogue( hCommandList, hEvent, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3281,17 +2962,11 @@ namespace validation_layer
         if( nullptr == pfnHostReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventHostResetPrologue( hEvent );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventHostResetPrologue ] ) {
+            auto result = checker->zeEventHostResetPrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventHostResetPrologue( hEvent );
@@ -3300,9 +2975,9 @@ namespace validation_layer
 
         auto result = pfnHostReset( hEvent );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventHostResetEpilogue( hEvent );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventHostResetEpilogue ] ) {
+            auto epilogueResult = checker->zeEventHostResetEpilogue( hEvent, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3321,17 +2996,11 @@ namespace validation_layer
         if( nullptr == pfnQueryKernelTimestamp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventQueryKernelTimestampPrologue( hEvent, dstptr );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventQueryKernelTimestampPrologue ] ) {
+            auto result = checker->zeEventQueryKernelTimestampPrologue( hEvent, dstptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventQueryKernelTimestampPrologue( hEvent, dstptr );
@@ -3340,9 +3009,9 @@ namespace validation_layer
 
         auto result = pfnQueryKernelTimestamp( hEvent, dstptr );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventQueryKernelTimestampEpilogue( hEvent, dstptr );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventQueryKernelTimestampEpilogue ] ) {
+            auto epilogueResult = checker->zeEventQueryKernelTimestampEpilogue( hEvent, dstptr, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3372,15 +3041,14 @@ namespace validation_layer
         if( nullptr == pfnAppendQueryKernelTimestamps )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendQueryKernelTimestampsPrologue( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendQueryKernelTimestampsPrologue ] ) {
+            auto result = checker->zeCommandListAppendQueryKernelTimestampsPrologue( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendQueryKernelTimestamps" );
         }
 
         
@@ -3391,9 +3059,9 @@ namespace validation_layer
 
         auto result = pfnAppendQueryKernelTimestamps( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendQueryKernelTimestampsEpilogue( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendQueryKernelTimestampsEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendQueryKernelTimestampsEpilogue( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3412,17 +3080,11 @@ namespace validation_layer
         if( nullptr == pfnGetEventPool )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventGetEventPoolPrologue( hEvent, phEventPool );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventGetEventPoolPrologue ] ) {
+            auto result = checker->zeEventGetEventPoolPrologue( hEvent, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventGetEventPoolPrologue( hEvent, phEventPool );
@@ -3431,9 +3093,9 @@ namespace validation_layer
 
         auto result = pfnGetEventPool( hEvent, phEventPool );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventGetEventPoolEpilogue( hEvent, phEventPool );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventGetEventPoolEpilogue ] ) {
+            auto epilogueResult = checker->zeEventGetEventPoolEpilogue( hEvent, phEventPool, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3454,17 +3116,11 @@ namespace validation_layer
         if( nullptr == pfnGetSignalScope )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventGetSignalScopePrologue( hEvent, pSignalScope );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventGetSignalScopePrologue ] ) {
+            auto result = checker->zeEventGetSignalScopePrologue( hEvent, pSignalScope );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventGetSignalScopePrologue( hEvent, pSignalScope );
@@ -3473,9 +3129,9 @@ namespace validation_layer
 
         auto result = pfnGetSignalScope( hEvent, pSignalScope );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventGetSignalScopeEpilogue( hEvent, pSignalScope );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventGetSignalScopeEpilogue ] ) {
+            auto epilogueResult = checker->zeEventGetSignalScopeEpilogue( hEvent, pSignalScope, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3496,17 +3152,11 @@ namespace validation_layer
         if( nullptr == pfnGetWaitScope )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventGetWaitScopePrologue( hEvent, pWaitScope );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventGetWaitScopePrologue ] ) {
+            auto result = checker->zeEventGetWaitScopePrologue( hEvent, pWaitScope );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventGetWaitScopePrologue( hEvent, pWaitScope );
@@ -3515,9 +3165,9 @@ namespace validation_layer
 
         auto result = pfnGetWaitScope( hEvent, pWaitScope );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventGetWaitScopeEpilogue( hEvent, pWaitScope );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventGetWaitScopeEpilogue ] ) {
+            auto epilogueResult = checker->zeEventGetWaitScopeEpilogue( hEvent, pWaitScope, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3536,17 +3186,11 @@ namespace validation_layer
         if( nullptr == pfnGetContextHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolGetContextHandlePrologue( hEventPool, phContext );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolGetContextHandlePrologue ] ) {
+            auto result = checker->zeEventPoolGetContextHandlePrologue( hEventPool, phContext );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolGetContextHandlePrologue( hEventPool, phContext );
@@ -3555,9 +3199,9 @@ namespace validation_layer
 
         auto result = pfnGetContextHandle( hEventPool, phContext );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolGetContextHandleEpilogue( hEventPool, phContext );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolGetContextHandleEpilogue ] ) {
+            auto epilogueResult = checker->zeEventPoolGetContextHandleEpilogue( hEventPool, phContext, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3577,17 +3221,11 @@ namespace validation_layer
         if( nullptr == pfnGetFlags )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolGetFlagsPrologue( hEventPool, pFlags );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolGetFlagsPrologue ] ) {
+            auto result = checker->zeEventPoolGetFlagsPrologue( hEventPool, pFlags );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolGetFlagsPrologue( hEventPool, pFlags );
@@ -3596,9 +3234,9 @@ namespace validation_layer
 
         auto result = pfnGetFlags( hEventPool, pFlags );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventPoolGetFlagsEpilogue( hEventPool, pFlags );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventPoolGetFlagsEpilogue ] ) {
+            auto epilogueResult = checker->zeEventPoolGetFlagsEpilogue( hEventPool, pFlags, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3618,17 +3256,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFenceCreatePrologue( hCommandQueue, desc, phFence );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFenceCreatePrologue ] ) {
+            auto result = checker->zeFenceCreatePrologue( hCommandQueue, desc, phFence );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceCreatePrologue( hCommandQueue, desc, phFence );
@@ -3637,16 +3269,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hCommandQueue, desc, phFence );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFenceCreateEpilogue( hCommandQueue, desc, phFence );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFenceCreateEpilogue ] ) {
+            auto epilogueResult = checker->zeFenceCreateEpilogue( hCommandQueue, desc, phFence, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phFence){
-                context.handleLifetime->addHandle( *phFence );
+                context.handleLifetime->addHandle( *phFence, hCommandQueue );
                 context.handleLifetime->addDependent( hCommandQueue, *phFence );
 
             }
@@ -3666,17 +3298,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFenceDestroyPrologue( hFence );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFenceDestroyPrologue ] ) {
+            auto result = checker->zeFenceDestroyPrologue( hFence );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceDestroyPrologue( hFence );
@@ -3685,9 +3311,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hFence );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFenceDestroyEpilogue( hFence );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFenceDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zeFenceDestroyEpilogue( hFence, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3712,17 +3338,11 @@ namespace validation_layer
         if( nullptr == pfnHostSynchronize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFenceHostSynchronizePrologue( hFence, timeout );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFenceHostSynchronizePrologue ] ) {
+            auto result = checker->zeFenceHostSynchronizePrologue( hFence, timeout );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceHostSynchronizePrologue( hFence, timeout );
@@ -3731,9 +3351,9 @@ namespace validation_layer
 
         auto result = pfnHostSynchronize( hFence, timeout );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFenceHostSynchronizeEpilogue( hFence, timeout );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFenceHostSynchronizeEpilogue ] ) {
+            auto epilogueResult = checker->zeFenceHostSynchronizeEpilogue( hFence, timeout, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3751,17 +3371,11 @@ namespace validation_layer
         if( nullptr == pfnQueryStatus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFenceQueryStatusPrologue( hFence );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFenceQueryStatusPrologue ] ) {
+            auto result = checker->zeFenceQueryStatusPrologue( hFence );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceQueryStatusPrologue( hFence );
@@ -3770,9 +3384,9 @@ namespace validation_layer
 
         auto result = pfnQueryStatus( hFence );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFenceQueryStatusEpilogue( hFence );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFenceQueryStatusEpilogue ] ) {
+            auto epilogueResult = checker->zeFenceQueryStatusEpilogue( hFence, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3790,17 +3404,11 @@ namespace validation_layer
         if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFenceResetPrologue( hFence );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFenceResetPrologue ] ) {
+            auto result = checker->zeFenceResetPrologue( hFence );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceResetPrologue( hFence );
@@ -3809,9 +3417,9 @@ namespace validation_layer
 
         auto result = pfnReset( hFence );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFenceResetEpilogue( hFence );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFenceResetEpilogue ] ) {
+            auto epilogueResult = checker->zeFenceResetEpilogue( hFence, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3831,17 +3439,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageGetPropertiesPrologue( hDevice, desc, pImageProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageGetPropertiesPrologue ] ) {
+            auto result = checker->zeImageGetPropertiesPrologue( hDevice, desc, pImageProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageGetPropertiesPrologue( hDevice, desc, pImageProperties );
@@ -3850,9 +3452,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hDevice, desc, pImageProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageGetPropertiesEpilogue( hDevice, desc, pImageProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeImageGetPropertiesEpilogue( hDevice, desc, pImageProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3873,17 +3475,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageCreatePrologue( hContext, hDevice, desc, phImage );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageCreatePrologue ] ) {
+            auto result = checker->zeImageCreatePrologue( hContext, hDevice, desc, phImage );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageCreatePrologue( hContext, hDevice, desc, phImage );
@@ -3892,16 +3488,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, desc, phImage );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageCreateEpilogue( hContext, hDevice, desc, phImage );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageCreateEpilogue ] ) {
+            auto epilogueResult = checker->zeImageCreateEpilogue( hContext, hDevice, desc, phImage, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phImage){
-                context.handleLifetime->addHandle( *phImage );
+                context.handleLifetime->addHandle( *phImage, hContext );
                 context.handleLifetime->addDependent( hContext, *phImage );
 
             }
@@ -3921,17 +3517,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageDestroyPrologue( hImage );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageDestroyPrologue ] ) {
+            auto result = checker->zeImageDestroyPrologue( hImage );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageDestroyPrologue( hImage );
@@ -3940,9 +3530,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hImage );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageDestroyEpilogue( hImage );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zeImageDestroyEpilogue( hImage, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3968,17 +3558,11 @@ namespace validation_layer
         if( nullptr == pfnAllocShared )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemAllocSharedPrologue( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemAllocSharedPrologue ] ) {
+            auto result = checker->zeMemAllocSharedPrologue( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemAllocSharedPrologue( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
@@ -3987,9 +3571,9 @@ namespace validation_layer
 
         auto result = pfnAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemAllocSharedEpilogue( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemAllocSharedEpilogue ] ) {
+            auto epilogueResult = checker->zeMemAllocSharedEpilogue( hContext, device_desc, host_desc, size, alignment, hDevice, pptr, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4014,17 +3598,11 @@ namespace validation_layer
         if( nullptr == pfnAllocDevice )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemAllocDevicePrologue( hContext, device_desc, size, alignment, hDevice, pptr );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemAllocDevicePrologue ] ) {
+            auto result = checker->zeMemAllocDevicePrologue( hContext, device_desc, size, alignment, hDevice, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemAllocDevicePrologue( hContext, device_desc, size, alignment, hDevice, pptr );
@@ -4033,9 +3611,9 @@ namespace validation_layer
 
         auto result = pfnAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemAllocDeviceEpilogue( hContext, device_desc, size, alignment, hDevice, pptr );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemAllocDeviceEpilogue ] ) {
+            auto epilogueResult = checker->zeMemAllocDeviceEpilogue( hContext, device_desc, size, alignment, hDevice, pptr, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4059,17 +3637,11 @@ namespace validation_layer
         if( nullptr == pfnAllocHost )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemAllocHostPrologue( hContext, host_desc, size, alignment, pptr );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemAllocHostPrologue ] ) {
+            auto result = checker->zeMemAllocHostPrologue( hContext, host_desc, size, alignment, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemAllocHostPrologue( hContext, host_desc, size, alignment, pptr );
@@ -4078,9 +3650,9 @@ namespace validation_layer
 
         auto result = pfnAllocHost( hContext, host_desc, size, alignment, pptr );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemAllocHostEpilogue( hContext, host_desc, size, alignment, pptr );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemAllocHostEpilogue ] ) {
+            auto epilogueResult = checker->zeMemAllocHostEpilogue( hContext, host_desc, size, alignment, pptr, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4099,17 +3671,11 @@ namespace validation_layer
         if( nullptr == pfnFree )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemFreePrologue( hContext, ptr );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemFreePrologue ] ) {
+            auto result = checker->zeMemFreePrologue( hContext, ptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemFreePrologue( hContext, ptr );
@@ -4118,9 +3684,9 @@ namespace validation_layer
 
         auto result = pfnFree( hContext, ptr );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemFreeEpilogue( hContext, ptr );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemFreeEpilogue ] ) {
+            auto epilogueResult = checker->zeMemFreeEpilogue( hContext, ptr, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4141,17 +3707,11 @@ namespace validation_layer
         if( nullptr == pfnGetAllocProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetAllocPropertiesPrologue( hContext, ptr, pMemAllocProperties, phDevice );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetAllocPropertiesPrologue ] ) {
+            auto result = checker->zeMemGetAllocPropertiesPrologue( hContext, ptr, pMemAllocProperties, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetAllocPropertiesPrologue( hContext, ptr, pMemAllocProperties, phDevice );
@@ -4160,9 +3720,9 @@ namespace validation_layer
 
         auto result = pfnGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetAllocPropertiesEpilogue( hContext, ptr, pMemAllocProperties, phDevice );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetAllocPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeMemGetAllocPropertiesEpilogue( hContext, ptr, pMemAllocProperties, phDevice, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4183,17 +3743,11 @@ namespace validation_layer
         if( nullptr == pfnGetAddressRange )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetAddressRangePrologue( hContext, ptr, pBase, pSize );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetAddressRangePrologue ] ) {
+            auto result = checker->zeMemGetAddressRangePrologue( hContext, ptr, pBase, pSize );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetAddressRangePrologue( hContext, ptr, pBase, pSize );
@@ -4202,9 +3756,9 @@ namespace validation_layer
 
         auto result = pfnGetAddressRange( hContext, ptr, pBase, pSize );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetAddressRangeEpilogue( hContext, ptr, pBase, pSize );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetAddressRangeEpilogue ] ) {
+            auto epilogueResult = checker->zeMemGetAddressRangeEpilogue( hContext, ptr, pBase, pSize, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4224,17 +3778,11 @@ namespace validation_layer
         if( nullptr == pfnGetIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetIpcHandlePrologue( hContext, ptr, pIpcHandle );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetIpcHandlePrologue ] ) {
+            auto result = checker->zeMemGetIpcHandlePrologue( hContext, ptr, pIpcHandle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetIpcHandlePrologue( hContext, ptr, pIpcHandle );
@@ -4243,9 +3791,9 @@ namespace validation_layer
 
         auto result = pfnGetIpcHandle( hContext, ptr, pIpcHandle );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetIpcHandleEpilogue( hContext, ptr, pIpcHandle );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetIpcHandleEpilogue ] ) {
+            auto epilogueResult = checker->zeMemGetIpcHandleEpilogue( hContext, ptr, pIpcHandle, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -4269,17 +3817,11 @@ namespace validation_layer
         if( nullptr == pfnGetIpcHandleFromFileDescriptorExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetIpcHandleFromFileDescriptorExpPrologue( hContext, handle, pIpcHandle );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetIpcHandleFromFileDescriptorExpPrologue ] ) {
+            auto result = checker->zeMemGetIpcHandleFromFileDescriptorExpPrologue( hContext, handle, pIpcHandle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetIpcHandleFromFileDescriptorExpPrologue( hContext, handle, pIpcHandle );
@@ -4288,9 +3830,9 @@ namespace validation_layer
 
         auto result = pfnGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetIpcHandleFromFileDescriptorExpEpilogue( hContext, handle, pIpcHandle );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetIpcHandleFromFileDescriptorExpEpilogue ] ) {
+            auto epilogueResult = checker->zeMemGetIpcHandleFromFileDescriptorExpEpilogue( hContext, handle, pIpcHandle, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -4314,17 +3856,11 @@ namespace validation_layer
         if( nullptr == pfnGetFileDescriptorFromIpcHandleExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetFileDescriptorFromIpcHandleExpPrologue( hContext, ipcHandle, pHandle );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetFileDescriptorFromIpcHandleExpPrologue ] ) {
+            auto result = checker->zeMemGetFileDescriptorFromIpcHandleExpPrologue( hContext, ipcHandle, pHandle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetFileDescriptorFromIpcHandleExpPrologue( hContext, ipcHandle, pHandle );
@@ -4333,9 +3869,9 @@ namespace validation_layer
 
         auto result = pfnGetFileDescriptorFromIpcHandleExp( hContext, ipcHandle, pHandle );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetFileDescriptorFromIpcHandleExpEpilogue( hContext, ipcHandle, pHandle );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetFileDescriptorFromIpcHandleExpEpilogue ] ) {
+            auto epilogueResult = checker->zeMemGetFileDescriptorFromIpcHandleExpEpilogue( hContext, ipcHandle, pHandle, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -4358,17 +3894,11 @@ namespace validation_layer
         if( nullptr == pfnPutIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemPutIpcHandlePrologue( hContext, handle );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemPutIpcHandlePrologue ] ) {
+            auto result = checker->zeMemPutIpcHandlePrologue( hContext, handle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemPutIpcHandlePrologue( hContext, handle );
@@ -4377,9 +3907,9 @@ namespace validation_layer
 
         auto result = pfnPutIpcHandle( hContext, handle );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemPutIpcHandleEpilogue( hContext, handle );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemPutIpcHandleEpilogue ] ) {
+            auto epilogueResult = checker->zeMemPutIpcHandleEpilogue( hContext, handle, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4402,17 +3932,11 @@ namespace validation_layer
         if( nullptr == pfnOpenIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemOpenIpcHandlePrologue( hContext, hDevice, handle, flags, pptr );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemOpenIpcHandlePrologue ] ) {
+            auto result = checker->zeMemOpenIpcHandlePrologue( hContext, hDevice, handle, flags, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemOpenIpcHandlePrologue( hContext, hDevice, handle, flags, pptr );
@@ -4421,9 +3945,9 @@ namespace validation_layer
 
         auto result = pfnOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemOpenIpcHandleEpilogue( hContext, hDevice, handle, flags, pptr );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemOpenIpcHandleEpilogue ] ) {
+            auto epilogueResult = checker->zeMemOpenIpcHandleEpilogue( hContext, hDevice, handle, flags, pptr, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4442,17 +3966,11 @@ namespace validation_layer
         if( nullptr == pfnCloseIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemCloseIpcHandlePrologue( hContext, ptr );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemCloseIpcHandlePrologue ] ) {
+            auto result = checker->zeMemCloseIpcHandlePrologue( hContext, ptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemCloseIpcHandlePrologue( hContext, ptr );
@@ -4461,9 +3979,9 @@ namespace validation_layer
 
         auto result = pfnCloseIpcHandle( hContext, ptr );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemCloseIpcHandleEpilogue( hContext, ptr );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemCloseIpcHandleEpilogue ] ) {
+            auto epilogueResult = checker->zeMemCloseIpcHandleEpilogue( hContext, ptr, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4486,17 +4004,11 @@ namespace validation_layer
         if( nullptr == pfnSetAtomicAccessAttributeExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemSetAtomicAccessAttributeExpPrologue( hContext, hDevice, ptr, size, attr );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemSetAtomicAccessAttributeExpPrologue ] ) {
+            auto result = checker->zeMemSetAtomicAccessAttributeExpPrologue( hContext, hDevice, ptr, size, attr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemSetAtomicAccessAttributeExpPrologue( hContext, hDevice, ptr, size, attr );
@@ -4505,9 +4017,9 @@ namespace validation_layer
 
         auto result = pfnSetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, attr );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemSetAtomicAccessAttributeExpEpilogue( hContext, hDevice, ptr, size, attr );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemSetAtomicAccessAttributeExpEpilogue ] ) {
+            auto epilogueResult = checker->zeMemSetAtomicAccessAttributeExpEpilogue( hContext, hDevice, ptr, size, attr, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4529,17 +4041,11 @@ namespace validation_layer
         if( nullptr == pfnGetAtomicAccessAttributeExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetAtomicAccessAttributeExpPrologue( hContext, hDevice, ptr, size, pAttr );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetAtomicAccessAttributeExpPrologue ] ) {
+            auto result = checker->zeMemGetAtomicAccessAttributeExpPrologue( hContext, hDevice, ptr, size, pAttr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetAtomicAccessAttributeExpPrologue( hContext, hDevice, ptr, size, pAttr );
@@ -4548,9 +4054,9 @@ namespace validation_layer
 
         auto result = pfnGetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, pAttr );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetAtomicAccessAttributeExpEpilogue( hContext, hDevice, ptr, size, pAttr );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetAtomicAccessAttributeExpEpilogue ] ) {
+            auto epilogueResult = checker->zeMemGetAtomicAccessAttributeExpEpilogue( hContext, hDevice, ptr, size, pAttr, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -4576,17 +4082,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleCreatePrologue( hContext, hDevice, desc, phModule, phBuildLog );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleCreatePrologue ] ) {
+            auto result = checker->zeModuleCreatePrologue( hContext, hDevice, desc, phModule, phBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleCreatePrologue( hContext, hDevice, desc, phModule, phBuildLog );
@@ -4595,21 +4095,21 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, desc, phModule, phBuildLog );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleCreateEpilogue( hContext, hDevice, desc, phModule, phBuildLog );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleCreateEpilogue ] ) {
+            auto epilogueResult = checker->zeModuleCreateEpilogue( hContext, hDevice, desc, phModule, phBuildLog, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phModule){
-                context.handleLifetime->addHandle( *phModule );
+                context.handleLifetime->addHandle( *phModule, hContext );
                 context.handleLifetime->addDependent( hContext, *phModule );
 
             }
             if (phBuildLog){
-                context.handleLifetime->addHandle( *phBuildLog );
+                context.handleLifetime->addHandle( *phBuildLog, hContext );
                 context.handleLifetime->addDependent( hContext, *phBuildLog );
 
             }
@@ -4629,17 +4129,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleDestroyPrologue( hModule );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleDestroyPrologue ] ) {
+            auto result = checker->zeModuleDestroyPrologue( hModule );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleDestroyPrologue( hModule );
@@ -4648,9 +4142,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hModule );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleDestroyEpilogue( hModule );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zeModuleDestroyEpilogue( hModule, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4671,17 +4165,11 @@ namespace validation_layer
         if( nullptr == pfnDynamicLink )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleDynamicLinkPrologue( numModules, phModules, phLinkLog );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleDynamicLinkPrologue ] ) {
+            auto result = checker->zeModuleDynamicLinkPrologue( numModules, phModules, phLinkLog );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleDynamicLinkPrologue( numModules, phModules, phLinkLog );
@@ -4690,9 +4178,9 @@ namespace validation_layer
 
         auto result = pfnDynamicLink( numModules, phModules, phLinkLog );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleDynamicLinkEpilogue( numModules, phModules, phLinkLog );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleDynamicLinkEpilogue ] ) {
+            auto epilogueResult = checker->zeModuleDynamicLinkEpilogue( numModules, phModules, phLinkLog, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4710,17 +4198,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleBuildLogDestroyPrologue( hModuleBuildLog );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleBuildLogDestroyPrologue ] ) {
+            auto result = checker->zeModuleBuildLogDestroyPrologue( hModuleBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleBuildLogDestroyPrologue( hModuleBuildLog );
@@ -4729,9 +4211,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hModuleBuildLog );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleBuildLogDestroyEpilogue( hModuleBuildLog );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleBuildLogDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zeModuleBuildLogDestroyEpilogue( hModuleBuildLog, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4751,17 +4233,11 @@ namespace validation_layer
         if( nullptr == pfnGetString )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleBuildLogGetStringPrologue( hModuleBuildLog, pSize, pBuildLog );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleBuildLogGetStringPrologue ] ) {
+            auto result = checker->zeModuleBuildLogGetStringPrologue( hModuleBuildLog, pSize, pBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleBuildLogGetStringPrologue( hModuleBuildLog, pSize, pBuildLog );
@@ -4770,9 +4246,9 @@ namespace validation_layer
 
         auto result = pfnGetString( hModuleBuildLog, pSize, pBuildLog );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleBuildLogGetStringEpilogue( hModuleBuildLog, pSize, pBuildLog );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleBuildLogGetStringEpilogue ] ) {
+            auto epilogueResult = checker->zeModuleBuildLogGetStringEpilogue( hModuleBuildLog, pSize, pBuildLog, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4792,15 +4268,9 @@ namespace validation_layer
         if( nullptr == pfnGetNativeBinary )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleGetNativeBinaryPrologue( hModule, pSize, pModuleNativeBinary );
-            if(result!=ZE_RESULT_SUCCESS) return result;
-        }
-
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleGetNativeBinaryPrologue ] ) {
+            auto result = checker->zeModuleGetNativeBinaryPrologue( hModule, pSize, pModuleNativeBinary );
+            if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
         
@@ -4811,9 +4281,9 @@ namespace validation_layer
 
         auto result = pfnGetNativeBinary( hModule, pSize, pModuleNativeBinary );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleGetNativeBinaryEpilogue( hModule, pSize, pModuleNativeBinary );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleGetNativeBinaryEpilogue ] ) {
+            auto epilogueResult = checker->zeModuleGetNativeBinaryEpilogue( hModule, pSize, pModuleNativeBinary, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4834,17 +4304,11 @@ namespace validation_layer
         if( nullptr == pfnGetGlobalPointer )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleGetGlobalPointerPrologue( hModule, pGlobalName, pSize, pptr );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleGetGlobalPointerPrologue ] ) {
+            auto result = checker->zeModuleGetGlobalPointerPrologue( hModule, pGlobalName, pSize, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetGlobalPointerPrologue( hModule, pGlobalName, pSize, pptr );
@@ -4853,9 +4317,9 @@ namespace validation_layer
 
         auto result = pfnGetGlobalPointer( hModule, pGlobalName, pSize, pptr );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleGetGlobalPointerEpilogue( hModule, pGlobalName, pSize, pptr );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleGetGlobalPointerEpilogue ] ) {
+            auto epilogueResult = checker->zeModuleGetGlobalPointerEpilogue( hModule, pGlobalName, pSize, pptr, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4881,17 +4345,11 @@ namespace validation_layer
         if( nullptr == pfnGetKernelNames )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleGetKernelNamesPrologue( hModule, pCount, pNames );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleGetKernelNamesPrologue ] ) {
+            auto result = checker->zeModuleGetKernelNamesPrologue( hModule, pCount, pNames );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetKernelNamesPrologue( hModule, pCount, pNames );
@@ -4900,9 +4358,9 @@ namespace validation_layer
 
         auto result = pfnGetKernelNames( hModule, pCount, pNames );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleGetKernelNamesEpilogue( hModule, pCount, pNames );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleGetKernelNamesEpilogue ] ) {
+            auto epilogueResult = checker->zeModuleGetKernelNamesEpilogue( hModule, pCount, pNames, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4921,17 +4379,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleGetPropertiesPrologue( hModule, pModuleProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleGetPropertiesPrologue ] ) {
+            auto result = checker->zeModuleGetPropertiesPrologue( hModule, pModuleProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetPropertiesPrologue( hModule, pModuleProperties );
@@ -4940,9 +4392,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hModule, pModuleProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleGetPropertiesEpilogue( hModule, pModuleProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeModuleGetPropertiesEpilogue( hModule, pModuleProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4962,17 +4414,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelCreatePrologue( hModule, desc, phKernel );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelCreatePrologue ] ) {
+            auto result = checker->zeKernelCreatePrologue( hModule, desc, phKernel );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelCreatePrologue( hModule, desc, phKernel );
@@ -4981,16 +4427,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hModule, desc, phKernel );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelCreateEpilogue( hModule, desc, phKernel );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelCreateEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelCreateEpilogue( hModule, desc, phKernel, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phKernel){
-                context.handleLifetime->addHandle( *phKernel );
+                context.handleLifetime->addHandle( *phKernel, hModule );
                 context.handleLifetime->addDependent( hModule, *phKernel );
 
             }
@@ -5010,15 +4456,14 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelDestroyPrologue( hKernel );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelDestroyPrologue ] ) {
+            auto result = checker->zeKernelDestroyPrologue( hKernel );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hKernel, "zeKernelDestroy" );
         }
 
         
@@ -5029,9 +4474,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hKernel );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelDestroyEpilogue( hKernel );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelDestroyEpilogue( hKernel, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5051,17 +4496,11 @@ namespace validation_layer
         if( nullptr == pfnGetFunctionPointer )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleGetFunctionPointerPrologue( hModule, pFunctionName, pfnFunction );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleGetFunctionPointerPrologue ] ) {
+            auto result = checker->zeModuleGetFunctionPointerPrologue( hModule, pFunctionName, pfnFunction );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetFunctionPointerPrologue( hModule, pFunctionName, pfnFunction );
@@ -5070,9 +4509,9 @@ namespace validation_layer
 
         auto result = pfnGetFunctionPointer( hModule, pFunctionName, pfnFunction );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleGetFunctionPointerEpilogue( hModule, pFunctionName, pfnFunction );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleGetFunctionPointerEpilogue ] ) {
+            auto epilogueResult = checker->zeModuleGetFunctionPointerEpilogue( hModule, pFunctionName, pfnFunction, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5093,15 +4532,14 @@ namespace validation_layer
         if( nullptr == pfnSetGroupSize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSetGroupSizePrologue( hKernel, groupSizeX, groupSizeY, groupSizeZ );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSetGroupSizePrologue ] ) {
+            auto result = checker->zeKernelSetGroupSizePrologue( hKernel, groupSizeX, groupSizeY, groupSizeZ );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hKernel, "zeKernelSetGroupSize" );
         }
 
         
@@ -5112,9 +4550,9 @@ namespace validation_layer
 
         auto result = pfnSetGroupSize( hKernel, groupSizeX, groupSizeY, groupSizeZ );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSetGroupSizeEpilogue( hKernel, groupSizeX, groupSizeY, groupSizeZ );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSetGroupSizeEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelSetGroupSizeEpilogue( hKernel, groupSizeX, groupSizeY, groupSizeZ, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5138,15 +4576,14 @@ namespace validation_layer
         if( nullptr == pfnSuggestGroupSize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSuggestGroupSizePrologue( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSuggestGroupSizePrologue ] ) {
+            auto result = checker->zeKernelSuggestGroupSizePrologue( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hKernel, "zeKernelSuggestGroupSize" );
         }
 
         
@@ -5157,9 +4594,9 @@ namespace validation_layer
 
         auto result = pfnSuggestGroupSize( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSuggestGroupSizeEpilogue( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSuggestGroupSizeEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelSuggestGroupSizeEpilogue( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5178,15 +4615,14 @@ namespace validation_layer
         if( nullptr == pfnSuggestMaxCooperativeGroupCount )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSuggestMaxCooperativeGroupCountPrologue( hKernel, totalGroupCount );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSuggestMaxCooperativeGroupCountPrologue ] ) {
+            auto result = checker->zeKernelSuggestMaxCooperativeGroupCountPrologue( hKernel, totalGroupCount );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hKernel, "zeKernelSuggestMaxCooperativeGroupCount" );
         }
 
         
@@ -5197,9 +4633,9 @@ namespace validation_layer
 
         auto result = pfnSuggestMaxCooperativeGroupCount( hKernel, totalGroupCount );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSuggestMaxCooperativeGroupCountEpilogue( hKernel, totalGroupCount );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSuggestMaxCooperativeGroupCountEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelSuggestMaxCooperativeGroupCountEpilogue( hKernel, totalGroupCount, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5221,15 +4657,14 @@ namespace validation_layer
         if( nullptr == pfnSetArgumentValue )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSetArgumentValuePrologue( hKernel, argIndex, argSize, pArgValue );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSetArgumentValuePrologue ] ) {
+            auto result = checker->zeKernelSetArgumentValuePrologue( hKernel, argIndex, argSize, pArgValue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hKernel, "zeKernelSetArgumentValue" );
         }
 
         
@@ -5240,9 +4675,9 @@ namespace validation_layer
 
         auto result = pfnSetArgumentValue( hKernel, argIndex, argSize, pArgValue );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSetArgumentValueEpilogue( hKernel, argIndex, argSize, pArgValue );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSetArgumentValueEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelSetArgumentValueEpilogue( hKernel, argIndex, argSize, pArgValue, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5261,15 +4696,14 @@ namespace validation_layer
         if( nullptr == pfnSetIndirectAccess )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSetIndirectAccessPrologue( hKernel, flags );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSetIndirectAccessPrologue ] ) {
+            auto result = checker->zeKernelSetIndirectAccessPrologue( hKernel, flags );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hKernel, "zeKernelSetIndirectAccess" );
         }
 
         
@@ -5280,9 +4714,9 @@ namespace validation_layer
 
         auto result = pfnSetIndirectAccess( hKernel, flags );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSetIndirectAccessEpilogue( hKernel, flags );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSetIndirectAccessEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelSetIndirectAccessEpilogue( hKernel, flags, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5301,15 +4735,14 @@ namespace validation_layer
         if( nullptr == pfnGetIndirectAccess )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelGetIndirectAccessPrologue( hKernel, pFlags );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelGetIndirectAccessPrologue ] ) {
+            auto result = checker->zeKernelGetIndirectAccessPrologue( hKernel, pFlags );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hKernel, "zeKernelGetIndirectAccess" );
         }
 
         
@@ -5320,9 +4753,9 @@ namespace validation_layer
 
         auto result = pfnGetIndirectAccess( hKernel, pFlags );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelGetIndirectAccessEpilogue( hKernel, pFlags );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelGetIndirectAccessEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelGetIndirectAccessEpilogue( hKernel, pFlags, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5349,15 +4782,14 @@ namespace validation_layer
         if( nullptr == pfnGetSourceAttributes )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelGetSourceAttributesPrologue( hKernel, pSize, pString );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelGetSourceAttributesPrologue ] ) {
+            auto result = checker->zeKernelGetSourceAttributesPrologue( hKernel, pSize, pString );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hKernel, "zeKernelGetSourceAttributes" );
         }
 
         
@@ -5368,9 +4800,9 @@ namespace validation_layer
 
         auto result = pfnGetSourceAttributes( hKernel, pSize, pString );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelGetSourceAttributesEpilogue( hKernel, pSize, pString );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelGetSourceAttributesEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelGetSourceAttributesEpilogue( hKernel, pSize, pString, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5390,15 +4822,14 @@ namespace validation_layer
         if( nullptr == pfnSetCacheConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSetCacheConfigPrologue( hKernel, flags );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSetCacheConfigPrologue ] ) {
+            auto result = checker->zeKernelSetCacheConfigPrologue( hKernel, flags );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hKernel, "zeKernelSetCacheConfig" );
         }
 
         
@@ -5409,9 +4840,9 @@ namespace validation_layer
 
         auto result = pfnSetCacheConfig( hKernel, flags );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSetCacheConfigEpilogue( hKernel, flags );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSetCacheConfigEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelSetCacheConfigEpilogue( hKernel, flags, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5430,15 +4861,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelGetPropertiesPrologue( hKernel, pKernelProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelGetPropertiesPrologue ] ) {
+            auto result = checker->zeKernelGetPropertiesPrologue( hKernel, pKernelProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hKernel, "zeKernelGetProperties" );
         }
 
         
@@ -5449,9 +4879,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hKernel, pKernelProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelGetPropertiesEpilogue( hKernel, pKernelProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelGetPropertiesEpilogue( hKernel, pKernelProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5472,15 +4902,14 @@ namespace validation_layer
         if( nullptr == pfnGetName )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelGetNamePrologue( hKernel, pSize, pName );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelGetNamePrologue ] ) {
+            auto result = checker->zeKernelGetNamePrologue( hKernel, pSize, pName );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hKernel, "zeKernelGetName" );
         }
 
         
@@ -5491,9 +4920,9 @@ namespace validation_layer
 
         auto result = pfnGetName( hKernel, pSize, pName );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelGetNameEpilogue( hKernel, pSize, pName );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelGetNameEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelGetNameEpilogue( hKernel, pSize, pName, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5518,15 +4947,15 @@ namespace validation_layer
         if( nullptr == pfnAppendLaunchKernel )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchKernelPrologue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendLaunchKernelPrologue ] ) {
+            auto result = checker->zeCommandListAppendLaunchKernelPrologue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendLaunchKernel" );
+            context.threadingValidation->share( threadingGuard, hKernel, "zeCommandListAppendLaunchKernel" );
         }
 
         
@@ -5537,9 +4966,9 @@ namespace validation_layer
 
         auto result = pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchKernelEpilogue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendLaunchKernelEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendLaunchKernelEpilogue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5564,15 +4993,15 @@ namespace validation_layer
         if( nullptr == pfnAppendLaunchCooperativeKernel )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchCooperativeKernelPrologue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendLaunchCooperativeKernelPrologue ] ) {
+            auto result = checker->zeCommandListAppendLaunchCooperativeKernelPrologue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendLaunchCooperativeKernel" );
+            context.threadingValidation->share( threadingGuard, hKernel, "zeCommandListAppendLaunchCooperativeKernel" );
         }
 
         
@@ -5583,9 +5012,9 @@ namespace validation_layer
 
         auto result = pfnAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchCooperativeKernelEpilogue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendLaunchCooperativeKernelEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendLaunchCooperativeKernelEpilogue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5611,15 +5040,15 @@ namespace validation_layer
         if( nullptr == pfnAppendLaunchKernelIndirect )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchKernelIndirectPrologue( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendLaunchKernelIndirectPrologue ] ) {
+            auto result = checker->zeCommandListAppendLaunchKernelIndirectPrologue( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendLaunchKernelIndirect" );
+            context.threadingValidation->share( threadingGuard, hKernel, "zeCommandListAppendLaunchKernelIndirect" );
         }
 
         
@@ -5630,9 +5059,9 @@ namespace validation_layer
 
         auto result = pfnAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchKernelIndirectEpilogue( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendLaunchKernelIndirectEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendLaunchKernelIndirectEpilogue( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5662,15 +5091,14 @@ namespace validation_layer
         if( nullptr == pfnAppendLaunchMultipleKernelsIndirect )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchMultipleKernelsIndirectPrologue( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendLaunchMultipleKernelsIndirectPrologue ] ) {
+            auto result = checker->zeCommandListAppendLaunchMultipleKernelsIndirectPrologue( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendLaunchMultipleKernelsIndirect" );
         }
 
         
@@ -5681,9 +5109,9 @@ namespace validation_layer
 
         auto result = pfnAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5704,17 +5132,11 @@ namespace validation_layer
         if( nullptr == pfnMakeMemoryResident )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextMakeMemoryResidentPrologue( hContext, hDevice, ptr, size );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextMakeMemoryResidentPrologue ] ) {
+            auto result = checker->zeContextMakeMemoryResidentPrologue( hContext, hDevice, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextMakeMemoryResidentPrologue( hContext, hDevice, ptr, size );
@@ -5723,9 +5145,9 @@ namespace validation_layer
 
         auto result = pfnMakeMemoryResident( hContext, hDevice, ptr, size );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextMakeMemoryResidentEpilogue( hContext, hDevice, ptr, size );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextMakeMemoryResidentEpilogue ] ) {
+            auto epilogueResult = checker->zeContextMakeMemoryResidentEpilogue( hContext, hDevice, ptr, size, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5746,17 +5168,11 @@ namespace validation_layer
         if( nullptr == pfnEvictMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextEvictMemoryPrologue( hContext, hDevice, ptr, size );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextEvictMemoryPrologue ] ) {
+            auto result = checker->zeContextEvictMemoryPrologue( hContext, hDevice, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextEvictMemoryPrologue( hContext, hDevice, ptr, size );
@@ -5765,9 +5181,9 @@ namespace validation_layer
 
         auto result = pfnEvictMemory( hContext, hDevice, ptr, size );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextEvictMemoryEpilogue( hContext, hDevice, ptr, size );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextEvictMemoryEpilogue ] ) {
+            auto epilogueResult = checker->zeContextEvictMemoryEpilogue( hContext, hDevice, ptr, size, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5787,17 +5203,11 @@ namespace validation_layer
         if( nullptr == pfnMakeImageResident )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextMakeImageResidentPrologue( hContext, hDevice, hImage );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextMakeImageResidentPrologue ] ) {
+            auto result = checker->zeContextMakeImageResidentPrologue( hContext, hDevice, hImage );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextMakeImageResidentPrologue( hContext, hDevice, hImage );
@@ -5806,9 +5216,9 @@ namespace validation_layer
 
         auto result = pfnMakeImageResident( hContext, hDevice, hImage );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextMakeImageResidentEpilogue( hContext, hDevice, hImage );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextMakeImageResidentEpilogue ] ) {
+            auto epilogueResult = checker->zeContextMakeImageResidentEpilogue( hContext, hDevice, hImage, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5828,17 +5238,11 @@ namespace validation_layer
         if( nullptr == pfnEvictImage )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextEvictImagePrologue( hContext, hDevice, hImage );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextEvictImagePrologue ] ) {
+            auto result = checker->zeContextEvictImagePrologue( hContext, hDevice, hImage );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextEvictImagePrologue( hContext, hDevice, hImage );
@@ -5847,9 +5251,9 @@ namespace validation_layer
 
         auto result = pfnEvictImage( hContext, hDevice, hImage );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeContextEvictImageEpilogue( hContext, hDevice, hImage );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeContextEvictImageEpilogue ] ) {
+            auto epilogueResult = checker->zeContextEvictImageEpilogue( hContext, hDevice, hImage, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5870,17 +5274,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeSamplerCreatePrologue( hContext, hDevice, desc, phSampler );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeSamplerCreatePrologue ] ) {
+            auto result = checker->zeSamplerCreatePrologue( hContext, hDevice, desc, phSampler );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeSamplerCreatePrologue( hContext, hDevice, desc, phSampler );
@@ -5889,16 +5287,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, desc, phSampler );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeSamplerCreateEpilogue( hContext, hDevice, desc, phSampler );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeSamplerCreateEpilogue ] ) {
+            auto epilogueResult = checker->zeSamplerCreateEpilogue( hContext, hDevice, desc, phSampler, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phSampler){
-                context.handleLifetime->addHandle( *phSampler );
+                context.handleLifetime->addHandle( *phSampler, hContext );
                 context.handleLifetime->addDependent( hContext, *phSampler );
 
             }
@@ -5918,17 +5316,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeSamplerDestroyPrologue( hSampler );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeSamplerDestroyPrologue ] ) {
+            auto result = checker->zeSamplerDestroyPrologue( hSampler );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeSamplerDestroyPrologue( hSampler );
@@ -5937,9 +5329,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hSampler );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeSamplerDestroyEpilogue( hSampler );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeSamplerDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zeSamplerDestroyEpilogue( hSampler, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5961,17 +5353,11 @@ namespace validation_layer
         if( nullptr == pfnReserve )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemReservePrologue( hContext, pStart, size, pptr );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemReservePrologue ] ) {
+            auto result = checker->zeVirtualMemReservePrologue( hContext, pStart, size, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemReservePrologue( hContext, pStart, size, pptr );
@@ -5980,9 +5366,9 @@ namespace validation_layer
 
         auto result = pfnReserve( hContext, pStart, size, pptr );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemReserveEpilogue( hContext, pStart, size, pptr );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemReserveEpilogue ] ) {
+            auto epilogueResult = checker->zeVirtualMemReserveEpilogue( hContext, pStart, size, pptr, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6002,17 +5388,11 @@ namespace validation_layer
         if( nullptr == pfnFree )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemFreePrologue( hContext, ptr, size );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemFreePrologue ] ) {
+            auto result = checker->zeVirtualMemFreePrologue( hContext, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemFreePrologue( hContext, ptr, size );
@@ -6021,9 +5401,9 @@ namespace validation_layer
 
         auto result = pfnFree( hContext, ptr, size );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemFreeEpilogue( hContext, ptr, size );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemFreeEpilogue ] ) {
+            auto epilogueResult = checker->zeVirtualMemFreeEpilogue( hContext, ptr, size, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6045,17 +5425,11 @@ namespace validation_layer
         if( nullptr == pfnQueryPageSize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemQueryPageSizePrologue( hContext, hDevice, size, pagesize );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemQueryPageSizePrologue ] ) {
+            auto result = checker->zeVirtualMemQueryPageSizePrologue( hContext, hDevice, size, pagesize );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemQueryPageSizePrologue( hContext, hDevice, size, pagesize );
@@ -6064,9 +5438,9 @@ namespace validation_layer
 
         auto result = pfnQueryPageSize( hContext, hDevice, size, pagesize );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemQueryPageSizeEpilogue( hContext, hDevice, size, pagesize );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemQueryPageSizeEpilogue ] ) {
+            auto epilogueResult = checker->zeVirtualMemQueryPageSizeEpilogue( hContext, hDevice, size, pagesize, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6088,17 +5462,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zePhysicalMemCreatePrologue( hContext, hDevice, desc, phPhysicalMemory );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zePhysicalMemCreatePrologue ] ) {
+            auto result = checker->zePhysicalMemCreatePrologue( hContext, hDevice, desc, phPhysicalMemory );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zePhysicalMemCreatePrologue( hContext, hDevice, desc, phPhysicalMemory );
@@ -6107,16 +5475,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, desc, phPhysicalMemory );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zePhysicalMemCreateEpilogue( hContext, hDevice, desc, phPhysicalMemory );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zePhysicalMemCreateEpilogue ] ) {
+            auto epilogueResult = checker->zePhysicalMemCreateEpilogue( hContext, hDevice, desc, phPhysicalMemory, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phPhysicalMemory){
-                context.handleLifetime->addHandle( *phPhysicalMemory );
+                context.handleLifetime->addHandle( *phPhysicalMemory, hContext );
                 context.handleLifetime->addDependent( hContext, *phPhysicalMemory );
 
             }
@@ -6137,17 +5505,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zePhysicalMemDestroyPrologue( hContext, hPhysicalMemory );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zePhysicalMemDestroyPrologue ] ) {
+            auto result = checker->zePhysicalMemDestroyPrologue( hContext, hPhysicalMemory );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zePhysicalMemDestroyPrologue( hContext, hPhysicalMemory );
@@ -6156,9 +5518,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hContext, hPhysicalMemory );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zePhysicalMemDestroyEpilogue( hContext, hPhysicalMemory );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zePhysicalMemDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zePhysicalMemDestroyEpilogue( hContext, hPhysicalMemory, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6184,17 +5546,11 @@ namespace validation_layer
         if( nullptr == pfnMap )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemMapPrologue( hContext, ptr, size, hPhysicalMemory, offset, access );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemMapPrologue ] ) {
+            auto result = checker->zeVirtualMemMapPrologue( hContext, ptr, size, hPhysicalMemory, offset, access );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemMapPrologue( hContext, ptr, size, hPhysicalMemory, offset, access );
@@ -6203,9 +5559,9 @@ namespace validation_layer
 
         auto result = pfnMap( hContext, ptr, size, hPhysicalMemory, offset, access );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemMapEpilogue( hContext, ptr, size, hPhysicalMemory, offset, access );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemMapEpilogue ] ) {
+            auto epilogueResult = checker->zeVirtualMemMapEpilogue( hContext, ptr, size, hPhysicalMemory, offset, access, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6225,17 +5581,11 @@ namespace validation_layer
         if( nullptr == pfnUnmap )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemUnmapPrologue( hContext, ptr, size );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemUnmapPrologue ] ) {
+            auto result = checker->zeVirtualMemUnmapPrologue( hContext, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemUnmapPrologue( hContext, ptr, size );
@@ -6244,9 +5594,9 @@ namespace validation_layer
 
         auto result = pfnUnmap( hContext, ptr, size );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemUnmapEpilogue( hContext, ptr, size );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemUnmapEpilogue ] ) {
+            auto epilogueResult = checker->zeVirtualMemUnmapEpilogue( hContext, ptr, size, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6268,17 +5618,11 @@ namespace validation_layer
         if( nullptr == pfnSetAccessAttribute )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemSetAccessAttributePrologue( hContext, ptr, size, access );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemSetAccessAttributePrologue ] ) {
+            auto result = checker->zeVirtualMemSetAccessAttributePrologue( hContext, ptr, size, access );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemSetAccessAttributePrologue( hContext, ptr, size, access );
@@ -6287,9 +5631,9 @@ namespace validation_layer
 
         auto result = pfnSetAccessAttribute( hContext, ptr, size, access );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemSetAccessAttributeEpilogue( hContext, ptr, size, access );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemSetAccessAttributeEpilogue ] ) {
+            auto epilogueResult = checker->zeVirtualMemSetAccessAttributeEpilogue( hContext, ptr, size, access, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6312,17 +5656,11 @@ namespace validation_layer
         if( nullptr == pfnGetAccessAttribute )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemGetAccessAttributePrologue( hContext, ptr, size, access, outSize );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemGetAccessAttributePrologue ] ) {
+            auto result = checker->zeVirtualMemGetAccessAttributePrologue( hContext, ptr, size, access, outSize );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemGetAccessAttributePrologue( hContext, ptr, size, access, outSize );
@@ -6331,9 +5669,9 @@ namespace validation_layer
 
         auto result = pfnGetAccessAttribute( hContext, ptr, size, access, outSize );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemGetAccessAttributeEpilogue( hContext, ptr, size, access, outSize );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeVirtualMemGetAccessAttributeEpilogue ] ) {
+            auto epilogueResult = checker->zeVirtualMemGetAccessAttributeEpilogue( hContext, ptr, size, access, outSize, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6354,15 +5692,14 @@ namespace validation_layer
         if( nullptr == pfnSetGlobalOffsetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSetGlobalOffsetExpPrologue( hKernel, offsetX, offsetY, offsetZ );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSetGlobalOffsetExpPrologue ] ) {
+            auto result = checker->zeKernelSetGlobalOffsetExpPrologue( hKernel, offsetX, offsetY, offsetZ );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hKernel, "zeKernelSetGlobalOffsetExp" );
         }
 
         
@@ -6373,9 +5710,9 @@ namespace validation_layer
 
         auto result = pfnSetGlobalOffsetExp( hKernel, offsetX, offsetY, offsetZ );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSetGlobalOffsetExpEpilogue( hKernel, offsetX, offsetY, offsetZ );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSetGlobalOffsetExpEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelSetGlobalOffsetExpEpilogue( hKernel, offsetX, offsetY, offsetZ, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6395,15 +5732,14 @@ namespace validation_layer
         if( nullptr == pfnGetNextCommandIdExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetNextCommandIdExpPrologue( hCommandList, desc, pCommandId );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListGetNextCommandIdExpPrologue ] ) {
+            auto result = checker->zeCommandListGetNextCommandIdExpPrologue( hCommandList, desc, pCommandId );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hCommandList, "zeCommandListGetNextCommandIdExp" );
         }
 
         
@@ -6414,9 +5750,9 @@ namespace validation_layer
 
         auto result = pfnGetNextCommandIdExp( hCommandList, desc, pCommandId );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetNextCommandIdExpEpilogue( hCommandList, desc, pCommandId );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListGetNextCommandIdExpEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListGetNextCommandIdExpEpilogue( hCommandList, desc, pCommandId, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -6444,15 +5780,14 @@ namespace validation_layer
         if( nullptr == pfnGetNextCommandIdWithKernelsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetNextCommandIdWithKernelsExpPrologue( hCommandList, desc, numKernels, phKernels, pCommandId );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListGetNextCommandIdWithKernelsExpPrologue ] ) {
+            auto result = checker->zeCommandListGetNextCommandIdWithKernelsExpPrologue( hCommandList, desc, numKernels, phKernels, pCommandId );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hCommandList, "zeCommandListGetNextCommandIdWithKernelsExp" );
         }
 
         
@@ -6463,9 +5798,9 @@ namespace validation_layer
 
         auto result = pfnGetNextCommandIdWithKernelsExp( hCommandList, desc, numKernels, phKernels, pCommandId );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetNextCommandIdWithKernelsExpEpilogue( hCommandList, desc, numKernels, phKernels, pCommandId );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListGetNextCommandIdWithKernelsExpEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListGetNextCommandIdWithKernelsExpEpilogue( hCommandList, desc, numKernels, phKernels, pCommandId, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -6489,15 +5824,14 @@ namespace validation_layer
         if( nullptr == pfnUpdateMutableCommandsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandsExpPrologue( hCommandList, desc );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListUpdateMutableCommandsExpPrologue ] ) {
+            auto result = checker->zeCommandListUpdateMutableCommandsExpPrologue( hCommandList, desc );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListUpdateMutableCommandsExp" );
         }
 
         
@@ -6508,9 +5842,9 @@ namespace validation_layer
 
         auto result = pfnUpdateMutableCommandsExp( hCommandList, desc );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandsExpEpilogue( hCommandList, desc );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListUpdateMutableCommandsExpEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListUpdateMutableCommandsExpEpilogue( hCommandList, desc, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6530,15 +5864,14 @@ namespace validation_layer
         if( nullptr == pfnUpdateMutableCommandSignalEventExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandSignalEventExpPrologue( hCommandList, commandId, hSignalEvent );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListUpdateMutableCommandSignalEventExpPrologue ] ) {
+            auto result = checker->zeCommandListUpdateMutableCommandSignalEventExpPrologue( hCommandList, commandId, hSignalEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListUpdateMutableCommandSignalEventExp" );
         }
 
         
@@ -6549,9 +5882,9 @@ namespace validation_layer
 
         auto result = pfnUpdateMutableCommandSignalEventExp( hCommandList, commandId, hSignalEvent );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandSignalEventExpEpilogue( hCommandList, commandId, hSignalEvent );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListUpdateMutableCommandSignalEventExpEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListUpdateMutableCommandSignalEventExpEpilogue( hCommandList, commandId, hSignalEvent, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6573,15 +5906,14 @@ namespace validation_layer
         if( nullptr == pfnUpdateMutableCommandWaitEventsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandWaitEventsExpPrologue( hCommandList, commandId, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListUpdateMutableCommandWaitEventsExpPrologue ] ) {
+            auto result = checker->zeCommandListUpdateMutableCommandWaitEventsExpPrologue( hCommandList, commandId, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListUpdateMutableCommandWaitEventsExp" );
         }
 
         
@@ -6592,9 +5924,9 @@ namespace validation_layer
 
         auto result = pfnUpdateMutableCommandWaitEventsExp( hCommandList, commandId, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandWaitEventsExpEpilogue( hCommandList, commandId, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListUpdateMutableCommandWaitEventsExpEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListUpdateMutableCommandWaitEventsExpEpilogue( hCommandList, commandId, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6616,15 +5948,14 @@ namespace validation_layer
         if( nullptr == pfnUpdateMutableCommandKernelsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandKernelsExpPrologue( hCommandList, numKernels, pCommandId, phKernels );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListUpdateMutableCommandKernelsExpPrologue ] ) {
+            auto result = checker->zeCommandListUpdateMutableCommandKernelsExpPrologue( hCommandList, numKernels, pCommandId, phKernels );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListUpdateMutableCommandKernelsExp" );
         }
 
         
@@ -6635,9 +5966,9 @@ namespace validation_layer
 
         auto result = pfnUpdateMutableCommandKernelsExp( hCommandList, numKernels, pCommandId, phKernels );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandKernelsExpEpilogue( hCommandList, numKernels, pCommandId, phKernels );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListUpdateMutableCommandKernelsExpEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListUpdateMutableCommandKernelsExpEpilogue( hCommandList, numKernels, pCommandId, phKernels, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6660,17 +5991,11 @@ namespace validation_layer
         if( nullptr == pfnReserveCacheExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceReserveCacheExtPrologue( hDevice, cacheLevel, cacheReservationSize );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceReserveCacheExtPrologue ] ) {
+            auto result = checker->zeDeviceReserveCacheExtPrologue( hDevice, cacheLevel, cacheReservationSize );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceReserveCacheExtPrologue( hDevice, cacheLevel, cacheReservationSize );
@@ -6679,9 +6004,9 @@ namespace validation_layer
 
         auto result = pfnReserveCacheExt( hDevice, cacheLevel, cacheReservationSize );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceReserveCacheExtEpilogue( hDevice, cacheLevel, cacheReservationSize );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceReserveCacheExtEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceReserveCacheExtEpilogue( hDevice, cacheLevel, cacheReservationSize, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6702,17 +6027,11 @@ namespace validation_layer
         if( nullptr == pfnSetCacheAdviceExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceSetCacheAdviceExtPrologue( hDevice, ptr, regionSize, cacheRegion );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceSetCacheAdviceExtPrologue ] ) {
+            auto result = checker->zeDeviceSetCacheAdviceExtPrologue( hDevice, ptr, regionSize, cacheRegion );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceSetCacheAdviceExtPrologue( hDevice, ptr, regionSize, cacheRegion );
@@ -6721,9 +6040,9 @@ namespace validation_layer
 
         auto result = pfnSetCacheAdviceExt( hDevice, ptr, regionSize, cacheRegion );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceSetCacheAdviceExtEpilogue( hDevice, ptr, regionSize, cacheRegion );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceSetCacheAdviceExtEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceSetCacheAdviceExtEpilogue( hDevice, ptr, regionSize, cacheRegion, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6750,17 +6069,11 @@ namespace validation_layer
         if( nullptr == pfnQueryTimestampsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventQueryTimestampsExpPrologue( hEvent, hDevice, pCount, pTimestamps );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventQueryTimestampsExpPrologue ] ) {
+            auto result = checker->zeEventQueryTimestampsExpPrologue( hEvent, hDevice, pCount, pTimestamps );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventQueryTimestampsExpPrologue( hEvent, hDevice, pCount, pTimestamps );
@@ -6769,9 +6082,9 @@ namespace validation_layer
 
         auto result = pfnQueryTimestampsExp( hEvent, hDevice, pCount, pTimestamps );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventQueryTimestampsExpEpilogue( hEvent, hDevice, pCount, pTimestamps );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventQueryTimestampsExpEpilogue ] ) {
+            auto epilogueResult = checker->zeEventQueryTimestampsExpEpilogue( hEvent, hDevice, pCount, pTimestamps, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6790,17 +6103,11 @@ namespace validation_layer
         if( nullptr == pfnGetMemoryPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageGetMemoryPropertiesExpPrologue( hImage, pMemoryProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageGetMemoryPropertiesExpPrologue ] ) {
+            auto result = checker->zeImageGetMemoryPropertiesExpPrologue( hImage, pMemoryProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageGetMemoryPropertiesExpPrologue( hImage, pMemoryProperties );
@@ -6809,9 +6116,9 @@ namespace validation_layer
 
         auto result = pfnGetMemoryPropertiesExp( hImage, pMemoryProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageGetMemoryPropertiesExpEpilogue( hImage, pMemoryProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageGetMemoryPropertiesExpEpilogue ] ) {
+            auto epilogueResult = checker->zeImageGetMemoryPropertiesExpEpilogue( hImage, pMemoryProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -6837,17 +6144,11 @@ namespace validation_layer
         if( nullptr == pfnViewCreateExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageViewCreateExtPrologue( hContext, hDevice, desc, hImage, phImageView );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageViewCreateExtPrologue ] ) {
+            auto result = checker->zeImageViewCreateExtPrologue( hContext, hDevice, desc, hImage, phImageView );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageViewCreateExtPrologue( hContext, hDevice, desc, hImage, phImageView );
@@ -6856,16 +6157,16 @@ namespace validation_layer
 
         auto result = pfnViewCreateExt( hContext, hDevice, desc, hImage, phImageView );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageViewCreateExtEpilogue( hContext, hDevice, desc, hImage, phImageView );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageViewCreateExtEpilogue ] ) {
+            auto epilogueResult = checker->zeImageViewCreateExtEpilogue( hContext, hDevice, desc, hImage, phImageView, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phImageView){
-                context.handleLifetime->addHandle( *phImageView );
+                context.handleLifetime->addHandle( *phImageView, hContext );
                 context.handleLifetime->addDependent( hContext, *phImageView );
 
             }
@@ -6889,17 +6190,11 @@ namespace validation_layer
         if( nullptr == pfnViewCreateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageViewCreateExpPrologue( hContext, hDevice, desc, hImage, phImageView );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageViewCreateExpPrologue ] ) {
+            auto result = checker->zeImageViewCreateExpPrologue( hContext, hDevice, desc, hImage, phImageView );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageViewCreateExpPrologue( hContext, hDevice, desc, hImage, phImageView );
@@ -6908,16 +6203,16 @@ namespace validation_layer
 
         auto result = pfnViewCreateExp( hContext, hDevice, desc, hImage, phImageView );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageViewCreateExpEpilogue( hContext, hDevice, desc, hImage, phImageView );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageViewCreateExpEpilogue ] ) {
+            auto epilogueResult = checker->zeImageViewCreateExpEpilogue( hContext, hDevice, desc, hImage, phImageView, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phImageView){
-                context.handleLifetime->addHandle( *phImageView );
+                context.handleLifetime->addHandle( *phImageView, hContext );
                 context.handleLifetime->addDependent( hContext, *phImageView );
 
             }
@@ -6938,15 +6233,14 @@ namespace validation_layer
         if( nullptr == pfnSchedulingHintExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSchedulingHintExpPrologue( hKernel, pHint );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSchedulingHintExpPrologue ] ) {
+            auto result = checker->zeKernelSchedulingHintExpPrologue( hKernel, pHint );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hKernel, "zeKernelSchedulingHintExp" );
         }
 
         
@@ -6957,9 +6251,9 @@ namespace validation_layer
 
         auto result = pfnSchedulingHintExp( hKernel, pHint );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeKernelSchedulingHintExpEpilogue( hKernel, pHint );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeKernelSchedulingHintExpEpilogue ] ) {
+            auto epilogueResult = checker->zeKernelSchedulingHintExpEpilogue( hKernel, pHint, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6978,17 +6272,11 @@ namespace validation_layer
         if( nullptr == pfnPciGetPropertiesExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDevicePciGetPropertiesExtPrologue( hDevice, pPciProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDevicePciGetPropertiesExtPrologue ] ) {
+            auto result = checker->zeDevicePciGetPropertiesExtPrologue( hDevice, pPciProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDevicePciGetPropertiesExtPrologue( hDevice, pPciProperties );
@@ -6997,9 +6285,9 @@ namespace validation_layer
 
         auto result = pfnPciGetPropertiesExt( hDevice, pPciProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDevicePciGetPropertiesExtEpilogue( hDevice, pPciProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDevicePciGetPropertiesExtEpilogue ] ) {
+            auto epilogueResult = checker->zeDevicePciGetPropertiesExtEpilogue( hDevice, pPciProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -7029,15 +6317,14 @@ namespace validation_layer
         if( nullptr == pfnAppendImageCopyToMemoryExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyToMemoryExtPrologue( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendImageCopyToMemoryExtPrologue ] ) {
+            auto result = checker->zeCommandListAppendImageCopyToMemoryExtPrologue( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendImageCopyToMemoryExt" );
         }
 
         
@@ -7048,9 +6335,9 @@ namespace validation_layer
 
         auto result = pfnAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyToMemoryExtEpilogue( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendImageCopyToMemoryExtEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendImageCopyToMemoryExtEpilogue( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -7080,15 +6367,14 @@ namespace validation_layer
         if( nullptr == pfnAppendImageCopyFromMemoryExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyFromMemoryExtPrologue( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendImageCopyFromMemoryExtPrologue ] ) {
+            auto result = checker->zeCommandListAppendImageCopyFromMemoryExtPrologue( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zeCommandListAppendImageCopyFromMemoryExt" );
         }
 
         
@@ -7099,9 +6385,9 @@ namespace validation_layer
 
         auto result = pfnAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyFromMemoryExtEpilogue( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListAppendImageCopyFromMemoryExtEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListAppendImageCopyFromMemoryExtEpilogue( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -7121,17 +6407,11 @@ namespace validation_layer
         if( nullptr == pfnGetAllocPropertiesExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageGetAllocPropertiesExtPrologue( hContext, hImage, pImageAllocProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageGetAllocPropertiesExtPrologue ] ) {
+            auto result = checker->zeImageGetAllocPropertiesExtPrologue( hContext, hImage, pImageAllocProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageGetAllocPropertiesExtPrologue( hContext, hImage, pImageAllocProperties );
@@ -7140,9 +6420,9 @@ namespace validation_layer
 
         auto result = pfnGetAllocPropertiesExt( hContext, hImage, pImageAllocProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageGetAllocPropertiesExtEpilogue( hContext, hImage, pImageAllocProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageGetAllocPropertiesExtEpilogue ] ) {
+            auto epilogueResult = checker->zeImageGetAllocPropertiesExtEpilogue( hContext, hImage, pImageAllocProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -7165,17 +6445,11 @@ namespace validation_layer
         if( nullptr == pfnInspectLinkageExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleInspectLinkageExtPrologue( pInspectDesc, numModules, phModules, phLog );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleInspectLinkageExtPrologue ] ) {
+            auto result = checker->zeModuleInspectLinkageExtPrologue( pInspectDesc, numModules, phModules, phLog );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleInspectLinkageExtPrologue( pInspectDesc, numModules, phModules, phLog );
@@ -7184,9 +6458,9 @@ namespace validation_layer
 
         auto result = pfnInspectLinkageExt( pInspectDesc, numModules, phModules, phLog );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeModuleInspectLinkageExtEpilogue( pInspectDesc, numModules, phModules, phLog );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeModuleInspectLinkageExtEpilogue ] ) {
+            auto epilogueResult = checker->zeModuleInspectLinkageExtEpilogue( pInspectDesc, numModules, phModules, phLog, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -7206,17 +6480,11 @@ namespace validation_layer
         if( nullptr == pfnFreeExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemFreeExtPrologue( hContext, pMemFreeDesc, ptr );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemFreeExtPrologue ] ) {
+            auto result = checker->zeMemFreeExtPrologue( hContext, pMemFreeDesc, ptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemFreeExtPrologue( hContext, pMemFreeDesc, ptr );
@@ -7225,9 +6493,9 @@ namespace validation_layer
 
         auto result = pfnFreeExt( hContext, pMemFreeDesc, ptr );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemFreeExtEpilogue( hContext, pMemFreeDesc, ptr );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemFreeExtEpilogue ] ) {
+            auto epilogueResult = checker->zeMemFreeExtEpilogue( hContext, pMemFreeDesc, ptr, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -7254,17 +6522,11 @@ namespace validation_layer
         if( nullptr == pfnGetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetExpPrologue( hDriver, pCount, phVertices );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricVertexGetExpPrologue ] ) {
+            auto result = checker->zeFabricVertexGetExpPrologue( hDriver, pCount, phVertices );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetExpPrologue( hDriver, pCount, phVertices );
@@ -7273,9 +6535,9 @@ namespace validation_layer
 
         auto result = pfnGetExp( hDriver, pCount, phVertices );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetExpEpilogue( hDriver, pCount, phVertices );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricVertexGetExpEpilogue ] ) {
+            auto epilogueResult = checker->zeFabricVertexGetExpEpilogue( hDriver, pCount, phVertices, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -7283,7 +6545,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phVertices) && (i < *pCount); ++i){
                 if (phVertices[i]){
-                    context.handleLifetime->addHandle( phVertices[i] );
+                    context.handleLifetime->addHandle( phVertices[i], hDriver );
                     context.handleLifetime->addDependent( hDriver, phVertices[i] );
                 }
             }
@@ -7312,17 +6574,11 @@ namespace validation_layer
         if( nullptr == pfnGetSubVerticesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetSubVerticesExpPrologue( hVertex, pCount, phSubvertices );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricVertexGetSubVerticesExpPrologue ] ) {
+            auto result = checker->zeFabricVertexGetSubVerticesExpPrologue( hVertex, pCount, phSubvertices );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetSubVerticesExpPrologue( hVertex, pCount, phSubvertices );
@@ -7331,9 +6587,9 @@ namespace validation_layer
 
         auto result = pfnGetSubVerticesExp( hVertex, pCount, phSubvertices );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetSubVerticesExpEpilogue( hVertex, pCount, phSubvertices );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricVertexGetSubVerticesExpEpilogue ] ) {
+            auto epilogueResult = checker->zeFabricVertexGetSubVerticesExpEpilogue( hVertex, pCount, phSubvertices, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -7341,7 +6597,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phSubvertices) && (i < *pCount); ++i){
                 if (phSubvertices[i]){
-                    context.handleLifetime->addHandle( phSubvertices[i] );
+                    context.handleLifetime->addHandle( phSubvertices[i], hVertex );
                     context.handleLifetime->addDependent( hVertex, phSubvertices[i] );
                 }
             }
@@ -7362,17 +6618,11 @@ namespace validation_layer
         if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetPropertiesExpPrologue( hVertex, pVertexProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricVertexGetPropertiesExpPrologue ] ) {
+            auto result = checker->zeFabricVertexGetPropertiesExpPrologue( hVertex, pVertexProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetPropertiesExpPrologue( hVertex, pVertexProperties );
@@ -7381,9 +6631,9 @@ namespace validation_layer
 
         auto result = pfnGetPropertiesExp( hVertex, pVertexProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetPropertiesExpEpilogue( hVertex, pVertexProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricVertexGetPropertiesExpEpilogue ] ) {
+            auto epilogueResult = checker->zeFabricVertexGetPropertiesExpEpilogue( hVertex, pVertexProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -7406,17 +6656,11 @@ namespace validation_layer
         if( nullptr == pfnGetDeviceExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetDeviceExpPrologue( hVertex, phDevice );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricVertexGetDeviceExpPrologue ] ) {
+            auto result = checker->zeFabricVertexGetDeviceExpPrologue( hVertex, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetDeviceExpPrologue( hVertex, phDevice );
@@ -7425,16 +6669,16 @@ namespace validation_layer
 
         auto result = pfnGetDeviceExp( hVertex, phDevice );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetDeviceExpEpilogue( hVertex, phDevice );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricVertexGetDeviceExpEpilogue ] ) {
+            auto epilogueResult = checker->zeFabricVertexGetDeviceExpEpilogue( hVertex, phDevice, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phDevice){
-                context.handleLifetime->addHandle( *phDevice );
+                context.handleLifetime->addHandle( *phDevice, hVertex );
                 context.handleLifetime->addDependent( hVertex, *phDevice );
 
             }
@@ -7455,17 +6699,11 @@ namespace validation_layer
         if( nullptr == pfnGetFabricVertexExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetFabricVertexExpPrologue( hDevice, phVertex );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetFabricVertexExpPrologue ] ) {
+            auto result = checker->zeDeviceGetFabricVertexExpPrologue( hDevice, phVertex );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetFabricVertexExpPrologue( hDevice, phVertex );
@@ -7474,16 +6712,16 @@ namespace validation_layer
 
         auto result = pfnGetFabricVertexExp( hDevice, phVertex );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetFabricVertexExpEpilogue( hDevice, phVertex );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDeviceGetFabricVertexExpEpilogue ] ) {
+            auto epilogueResult = checker->zeDeviceGetFabricVertexExpEpilogue( hDevice, phVertex, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phVertex){
-                context.handleLifetime->addHandle( *phVertex );
+                context.handleLifetime->addHandle( *phVertex, hDevice );
                 context.handleLifetime->addDependent( hDevice, *phVertex );
 
             }
@@ -7513,17 +6751,11 @@ namespace validation_layer
         if( nullptr == pfnGetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricEdgeGetExpPrologue( hVertexA, hVertexB, pCount, phEdges );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricEdgeGetExpPrologue ] ) {
+            auto result = checker->zeFabricEdgeGetExpPrologue( hVertexA, hVertexB, pCount, phEdges );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricEdgeGetExpPrologue( hVertexA, hVertexB, pCount, phEdges );
@@ -7532,9 +6764,9 @@ namespace validation_layer
 
         auto result = pfnGetExp( hVertexA, hVertexB, pCount, phEdges );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricEdgeGetExpEpilogue( hVertexA, hVertexB, pCount, phEdges );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricEdgeGetExpEpilogue ] ) {
+            auto epilogueResult = checker->zeFabricEdgeGetExpEpilogue( hVertexA, hVertexB, pCount, phEdges, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -7542,7 +6774,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phEdges) && (i < *pCount); ++i){
                 if (phEdges[i]){
-                    context.handleLifetime->addHandle( phEdges[i] );
+                    context.handleLifetime->addHandle( phEdges[i], hVertexA );
                     context.handleLifetime->addDependent( hVertexA, phEdges[i] );
                 }
             }
@@ -7564,17 +6796,11 @@ namespace validation_layer
         if( nullptr == pfnGetVerticesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricEdgeGetVerticesExpPrologue( hEdge, phVertexA, phVertexB );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricEdgeGetVerticesExpPrologue ] ) {
+            auto result = checker->zeFabricEdgeGetVerticesExpPrologue( hEdge, phVertexA, phVertexB );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricEdgeGetVerticesExpPrologue( hEdge, phVertexA, phVertexB );
@@ -7583,21 +6809,21 @@ namespace validation_layer
 
         auto result = pfnGetVerticesExp( hEdge, phVertexA, phVertexB );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricEdgeGetVerticesExpEpilogue( hEdge, phVertexA, phVertexB );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricEdgeGetVerticesExpEpilogue ] ) {
+            auto epilogueResult = checker->zeFabricEdgeGetVerticesExpEpilogue( hEdge, phVertexA, phVertexB, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phVertexA){
-                context.handleLifetime->addHandle( *phVertexA );
+                context.handleLifetime->addHandle( *phVertexA, hEdge );
                 context.handleLifetime->addDependent( hEdge, *phVertexA );
 
             }
             if (phVertexB){
-                context.handleLifetime->addHandle( *phVertexB );
+                context.handleLifetime->addHandle( *phVertexB, hEdge );
                 context.handleLifetime->addDependent( hEdge, *phVertexB );
 
             }
@@ -7618,17 +6844,11 @@ namespace validation_layer
         if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricEdgeGetPropertiesExpPrologue( hEdge, pEdgeProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricEdgeGetPropertiesExpPrologue ] ) {
+            auto result = checker->zeFabricEdgeGetPropertiesExpPrologue( hEdge, pEdgeProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricEdgeGetPropertiesExpPrologue( hEdge, pEdgeProperties );
@@ -7637,9 +6857,9 @@ namespace validation_layer
 
         auto result = pfnGetPropertiesExp( hEdge, pEdgeProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeFabricEdgeGetPropertiesExpEpilogue( hEdge, pEdgeProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeFabricEdgeGetPropertiesExpEpilogue ] ) {
+            auto epilogueResult = checker->zeFabricEdgeGetPropertiesExpEpilogue( hEdge, pEdgeProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -7677,17 +6897,11 @@ namespace validation_layer
         if( nullptr == pfnQueryKernelTimestampsExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventQueryKernelTimestampsExtPrologue( hEvent, hDevice, pCount, pResults );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventQueryKernelTimestampsExtPrologue ] ) {
+            auto result = checker->zeEventQueryKernelTimestampsExtPrologue( hEvent, hDevice, pCount, pResults );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventQueryKernelTimestampsExtPrologue( hEvent, hDevice, pCount, pResults );
@@ -7696,9 +6910,9 @@ namespace validation_layer
 
         auto result = pfnQueryKernelTimestampsExt( hEvent, hDevice, pCount, pResults );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeEventQueryKernelTimestampsExtEpilogue( hEvent, hDevice, pCount, pResults );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeEventQueryKernelTimestampsExtEpilogue ] ) {
+            auto epilogueResult = checker->zeEventQueryKernelTimestampsExtEpilogue( hEvent, hDevice, pCount, pResults, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -7718,17 +6932,11 @@ namespace validation_layer
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderCreateExpPrologue( hDriver, pDescriptor, phBuilder );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASBuilderCreateExpPrologue ] ) {
+            auto result = checker->zeRTASBuilderCreateExpPrologue( hDriver, pDescriptor, phBuilder );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderCreateExpPrologue( hDriver, pDescriptor, phBuilder );
@@ -7737,16 +6945,16 @@ namespace validation_layer
 
         auto result = pfnCreateExp( hDriver, pDescriptor, phBuilder );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderCreateExpEpilogue( hDriver, pDescriptor, phBuilder );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASBuilderCreateExpEpilogue ] ) {
+            auto epilogueResult = checker->zeRTASBuilderCreateExpEpilogue( hDriver, pDescriptor, phBuilder, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phBuilder){
-                context.handleLifetime->addHandle( *phBuilder );
+                context.handleLifetime->addHandle( *phBuilder, hDriver );
                 context.handleLifetime->addDependent( hDriver, *phBuilder );
 
             }
@@ -7768,17 +6976,11 @@ namespace validation_layer
         if( nullptr == pfnGetBuildPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderGetBuildPropertiesExpPrologue( hBuilder, pBuildOpDescriptor, pProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASBuilderGetBuildPropertiesExpPrologue ] ) {
+            auto result = checker->zeRTASBuilderGetBuildPropertiesExpPrologue( hBuilder, pBuildOpDescriptor, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderGetBuildPropertiesExpPrologue( hBuilder, pBuildOpDescriptor, pProperties );
@@ -7787,9 +6989,9 @@ namespace validation_layer
 
         auto result = pfnGetBuildPropertiesExp( hBuilder, pBuildOpDescriptor, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderGetBuildPropertiesExpEpilogue( hBuilder, pBuildOpDescriptor, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASBuilderGetBuildPropertiesExpEpilogue ] ) {
+            auto epilogueResult = checker->zeRTASBuilderGetBuildPropertiesExpEpilogue( hBuilder, pBuildOpDescriptor, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -7813,17 +7015,11 @@ namespace validation_layer
         if( nullptr == pfnRTASFormatCompatibilityCheckExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverRTASFormatCompatibilityCheckExpPrologue( hDriver, rtasFormatA, rtasFormatB );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverRTASFormatCompatibilityCheckExpPrologue ] ) {
+            auto result = checker->zeDriverRTASFormatCompatibilityCheckExpPrologue( hDriver, rtasFormatA, rtasFormatB );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverRTASFormatCompatibilityCheckExpPrologue( hDriver, rtasFormatA, rtasFormatB );
@@ -7832,9 +7028,9 @@ namespace validation_layer
 
         auto result = pfnRTASFormatCompatibilityCheckExp( hDriver, rtasFormatA, rtasFormatB );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeDriverRTASFormatCompatibilityCheckExpEpilogue( hDriver, rtasFormatA, rtasFormatB );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeDriverRTASFormatCompatibilityCheckExpEpilogue ] ) {
+            auto epilogueResult = checker->zeDriverRTASFormatCompatibilityCheckExpEpilogue( hDriver, rtasFormatA, rtasFormatB, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -7864,17 +7060,11 @@ namespace validation_layer
         if( nullptr == pfnBuildExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderBuildExpPrologue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASBuilderBuildExpPrologue ] ) {
+            auto result = checker->zeRTASBuilderBuildExpPrologue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderBuildExpPrologue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
@@ -7883,9 +7073,9 @@ namespace validation_layer
 
         auto result = pfnBuildExp( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderBuildExpEpilogue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASBuilderBuildExpEpilogue ] ) {
+            auto epilogueResult = checker->zeRTASBuilderBuildExpEpilogue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -7903,17 +7093,11 @@ namespace validation_layer
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderDestroyExpPrologue( hBuilder );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASBuilderDestroyExpPrologue ] ) {
+            auto result = checker->zeRTASBuilderDestroyExpPrologue( hBuilder );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderDestroyExpPrologue( hBuilder );
@@ -7922,9 +7106,9 @@ namespace validation_layer
 
         auto result = pfnDestroyExp( hBuilder );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderDestroyExpEpilogue( hBuilder );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASBuilderDestroyExpEpilogue ] ) {
+            auto epilogueResult = checker->zeRTASBuilderDestroyExpEpilogue( hBuilder, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -7943,17 +7127,11 @@ namespace validation_layer
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationCreateExpPrologue( hDriver, phParallelOperation );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASParallelOperationCreateExpPrologue ] ) {
+            auto result = checker->zeRTASParallelOperationCreateExpPrologue( hDriver, phParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationCreateExpPrologue( hDriver, phParallelOperation );
@@ -7962,16 +7140,16 @@ namespace validation_layer
 
         auto result = pfnCreateExp( hDriver, phParallelOperation );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationCreateExpEpilogue( hDriver, phParallelOperation );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASParallelOperationCreateExpEpilogue ] ) {
+            auto epilogueResult = checker->zeRTASParallelOperationCreateExpEpilogue( hDriver, phParallelOperation, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phParallelOperation){
-                context.handleLifetime->addHandle( *phParallelOperation );
+                context.handleLifetime->addHandle( *phParallelOperation, hDriver );
                 context.handleLifetime->addDependent( hDriver, *phParallelOperation );
 
             }
@@ -7992,17 +7170,11 @@ namespace validation_layer
         if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationGetPropertiesExpPrologue( hParallelOperation, pProperties );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASParallelOperationGetPropertiesExpPrologue ] ) {
+            auto result = checker->zeRTASParallelOperationGetPropertiesExpPrologue( hParallelOperation, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationGetPropertiesExpPrologue( hParallelOperation, pProperties );
@@ -8011,9 +7183,9 @@ namespace validation_layer
 
         auto result = pfnGetPropertiesExp( hParallelOperation, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationGetPropertiesExpEpilogue( hParallelOperation, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASParallelOperationGetPropertiesExpEpilogue ] ) {
+            auto epilogueResult = checker->zeRTASParallelOperationGetPropertiesExpEpilogue( hParallelOperation, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -8035,17 +7207,11 @@ namespace validation_layer
         if( nullptr == pfnJoinExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationJoinExpPrologue( hParallelOperation );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASParallelOperationJoinExpPrologue ] ) {
+            auto result = checker->zeRTASParallelOperationJoinExpPrologue( hParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationJoinExpPrologue( hParallelOperation );
@@ -8054,9 +7220,9 @@ namespace validation_layer
 
         auto result = pfnJoinExp( hParallelOperation );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationJoinExpEpilogue( hParallelOperation );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASParallelOperationJoinExpEpilogue ] ) {
+            auto epilogueResult = checker->zeRTASParallelOperationJoinExpEpilogue( hParallelOperation, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -8074,17 +7240,11 @@ namespace validation_layer
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationDestroyExpPrologue( hParallelOperation );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASParallelOperationDestroyExpPrologue ] ) {
+            auto result = checker->zeRTASParallelOperationDestroyExpPrologue( hParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationDestroyExpPrologue( hParallelOperation );
@@ -8093,9 +7253,9 @@ namespace validation_layer
 
         auto result = pfnDestroyExp( hParallelOperation );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationDestroyExpEpilogue( hParallelOperation );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeRTASParallelOperationDestroyExpEpilogue ] ) {
+            auto epilogueResult = checker->zeRTASParallelOperationDestroyExpEpilogue( hParallelOperation, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -8118,17 +7278,11 @@ namespace validation_layer
         if( nullptr == pfnGetPitchFor2dImage )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetPitchFor2dImagePrologue( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetPitchFor2dImagePrologue ] ) {
+            auto result = checker->zeMemGetPitchFor2dImagePrologue( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetPitchFor2dImagePrologue( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
@@ -8137,9 +7291,9 @@ namespace validation_layer
 
         auto result = pfnGetPitchFor2dImage( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeMemGetPitchFor2dImageEpilogue( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeMemGetPitchFor2dImageEpilogue ] ) {
+            auto epilogueResult = checker->zeMemGetPitchFor2dImageEpilogue( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -8158,17 +7312,11 @@ namespace validation_layer
         if( nullptr == pfnGetDeviceOffsetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageGetDeviceOffsetExpPrologue( hImage, pDeviceOffset );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageGetDeviceOffsetExpPrologue ] ) {
+            auto result = checker->zeImageGetDeviceOffsetExpPrologue( hImage, pDeviceOffset );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageGetDeviceOffsetExpPrologue( hImage, pDeviceOffset );
@@ -8177,9 +7325,9 @@ namespace validation_layer
 
         auto result = pfnGetDeviceOffsetExp( hImage, pDeviceOffset );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeImageGetDeviceOffsetExpEpilogue( hImage, pDeviceOffset );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeImageGetDeviceOffsetExpEpilogue ] ) {
+            auto epilogueResult = checker->zeImageGetDeviceOffsetExpEpilogue( hImage, pDeviceOffset, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -8202,15 +7350,14 @@ namespace validation_layer
         if( nullptr == pfnCreateCloneExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListCreateCloneExpPrologue( hCommandList, phClonedCommandList );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListCreateCloneExpPrologue ] ) {
+            auto result = checker->zeCommandListCreateCloneExpPrologue( hCommandList, phClonedCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hCommandList, "zeCommandListCreateCloneExp" );
         }
 
         
@@ -8221,16 +7368,16 @@ namespace validation_layer
 
         auto result = pfnCreateCloneExp( hCommandList, phClonedCommandList );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListCreateCloneExpEpilogue( hCommandList, phClonedCommandList );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListCreateCloneExpEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListCreateCloneExpEpilogue( hCommandList, phClonedCommandList, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phClonedCommandList){
-                context.handleLifetime->addHandle( *phClonedCommandList );
+                context.handleLifetime->addHandle( *phClonedCommandList, hCommandList );
                 context.handleLifetime->addDependent( hCommandList, *phClonedCommandList );
 
             }
@@ -8261,15 +7408,14 @@ namespace validation_layer
         if( nullptr == pfnImmediateAppendCommandListsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListImmediateAppendCommandListsExpPrologue( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListImmediateAppendCommandListsExpPrologue ] ) {
+            auto result = checker->zeCommandListImmediateAppendCommandListsExpPrologue( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hCommandListImmediate, "zeCommandListImmediateAppendCommandListsExp" );
         }
 
         
@@ -8280,9 +7426,9 @@ namespace validation_layer
 
         auto result = pfnImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zeValidation->zeCommandListImmediateAppendCommandListsExpEpilogue( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zeCheckers[ ZEEntryPoint::zeCommandListImmediateAppendCommandListsExpEpilogue ] ) {
+            auto epilogueResult = checker->zeCommandListImmediateAppendCommandListsExpEpilogue( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -9,6 +9,7 @@
  */
 #include "ze_validation_layer.h"
 #include "param_validation.h"
+#include <cstdio>
 #include <memory>
 
 namespace validation_layer
@@ -23,6 +24,9 @@ namespace validation_layer
             handleLifetime = std::make_unique<HandleLifetimeValidation>();
         }
         enableThreadingValidation = getenv_tobool( "ZE_ENABLE_THREADING_VALIDATION" );
+        if (enableThreadingValidation) {
+            threadingValidation = std::make_unique<ThreadingValidation>();
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -30,6 +34,29 @@ namespace validation_layer
     {
         validationHandlers.clear();
     }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void context_t::addValidationChecker( validationChecker *checker )
+    {
+        validationHandlers.push_back( checker );
+        for( size_t i = 0; i < ZEEntryPoint::Count; i++ )
+            if( checker->zeEntryPoints[ i ] )
+                zeCheckers[ i ].push_back( checker->zeValidation );
+        for( size_t i = 0; i < ZESEntryPoint::Count; i++ )
+            if( checker->zesEntryPoints[ i ] )
+                zesCheckers[ i ].push_back( checker->zesValidation );
+        for( size_t i = 0; i < ZETEntryPoint::Count; i++ )
+            if( checker->zetEntryPoints[ i ] )
+                zetCheckers[ i ].push_back( checker->zetValidation );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void context_t::log( const std::string &message )
+    {
+        std::lock_guard<std::mutex> lock( logMutex );
+        fprintf( stderr, "%s: %s\n", VALIDATION_COMP_NAME, message.c_str() );
+        fflush( stderr );
+    }
 } // namespace validation_layer
 
 
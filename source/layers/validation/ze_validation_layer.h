@@ -14,10 +14,14 @@
 #include "ze_util.h"
 #include "loader/ze_loader.h"
 #include "handle_lifetime.h"
+#include "threading_validation.h"
 #include "ze_entry_points.h"
 #include "zet_entry_points.h"
 #include "zes_entry_points.h"
+#include <bitset>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 #define VALIDATION_COMP_NAME "validation layer"
@@ -31,6 +35,10 @@ namespace validation_layer
         ZEValidationEntryPoints *zeValidation;
         ZESValidationEntryPoints *zesValidation;
         ZETValidationEntryPoints *zetValidation;
+        // Entry points the checker overrides, from get*OverriddenEntryPoints
+        std::bitset<ZEEntryPoint::Count> zeEntryPoints;
+        std::bitset<ZESEntryPoint::Count> zesEntryPoints;
+        std::bitset<ZETEntryPoint::Count> zetEntryPoints;
     };
     class __zedlllocal context_t
     {
@@ -45,7 +53,18 @@ namespace validation_layer
         zes_dditable_t  zesDdiTable = {};
 
         std::vector<validationChecker *> validationHandlers;
+        // Checkers overriding each entry point, in the order they were added,
+        // so that intercepts only call the checkers doing something.
+        std::vector<ZEValidationEntryPoints *> zeCheckers[ZEEntryPoint::Count];
+        std::vector<ZESValidationEntryPoints *> zesCheckers[ZESEntryPoint::Count];
+        std::vector<ZETValidationEntryPoints *> zetCheckers[ZETEntryPoint::Count];
+        void addValidationChecker( validationChecker *checker );
         std::unique_ptr<HandleLifetimeValidation> handleLifetime;
+        std::unique_ptr<ThreadingValidation> threadingValidation;
+
+        // Report a validation error to the validation log, which is stderr.
+        void log( const std::string &message );
+        std::mutex logMutex;
 
         static context_t& getInstance() {
             static context_t instance;
@@ -26,17 +26,11 @@ namespace validation_layer
         if( nullptr == pfnInit )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesInitPrologue( flags );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesInitPrologue ] ) {
+            auto result = checker->zesInitPrologue( flags );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesInitPrologue( flags );
@@ -45,9 +39,9 @@ namespace validation_layer
 
         auto result = pfnInit( flags );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesInitEpilogue( flags );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesInitEpilogue ] ) {
+            auto epilogueResult = checker->zesInitEpilogue( flags, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -73,17 +67,11 @@ namespace validation_layer
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetPrologue( pCount, phDrivers );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDriverGetPrologue ] ) {
+            auto result = checker->zesDriverGetPrologue( pCount, phDrivers );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetPrologue( pCount, phDrivers );
@@ -92,9 +80,9 @@ namespace validation_layer
 
         auto result = pfnGet( pCount, phDrivers );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetEpilogue( pCount, phDrivers );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDriverGetEpilogue ] ) {
+            auto epilogueResult = checker->zesDriverGetEpilogue( pCount, phDrivers, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -102,7 +90,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phDrivers) && (i < *pCount); ++i){
                 if (phDrivers[i]){
-                    context.handleLifetime->addHandle( phDrivers[i] );
+                    context.handleLifetime->addHandle( phDrivers[i], pCount );
                     context.handleLifetime->addDependent( pCount, phDrivers[i] );
                 }
             }
@@ -132,17 +120,11 @@ namespace validation_layer
         if( nullptr == pfnGetExtensionProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDriverGetExtensionPropertiesPrologue ] ) {
+            auto result = checker->zesDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
@@ -151,9 +133,9 @@ namespace validation_layer
 
         auto result = pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetExtensionPropertiesEpilogue( hDriver, pCount, pExtensionProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDriverGetExtensionPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesDriverGetExtensionPropertiesEpilogue( hDriver, pCount, pExtensionProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -173,17 +155,11 @@ namespace validation_layer
         if( nullptr == pfnGetExtensionFunctionAddress )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDriverGetExtensionFunctionAddressPrologue ] ) {
+            auto result = checker->zesDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
@@ -192,9 +168,9 @@ namespace validation_layer
 
         auto result = pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetExtensionFunctionAddressEpilogue( hDriver, name, ppFunctionAddress );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDriverGetExtensionFunctionAddressEpilogue ] ) {
+            auto epilogueResult = checker->zesDriverGetExtensionFunctionAddressEpilogue( hDriver, name, ppFunctionAddress, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -221,17 +197,11 @@ namespace validation_layer
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetPrologue( hDriver, pCount, phDevices );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetPrologue ] ) {
+            auto result = checker->zesDeviceGetPrologue( hDriver, pCount, phDevices );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetPrologue( hDriver, pCount, phDevices );
@@ -240,9 +210,9 @@ namespace validation_layer
 
         auto result = pfnGet( hDriver, pCount, phDevices );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetEpilogue( hDriver, pCount, phDevices );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceGetEpilogue( hDriver, pCount, phDevices, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -250,7 +220,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phDevices) && (i < *pCount); ++i){
                 if (phDevices[i]){
-                    context.handleLifetime->addHandle( phDevices[i] );
+                    context.handleLifetime->addHandle( phDevices[i], hDriver );
                     context.handleLifetime->addDependent( hDriver, phDevices[i] );
                 }
             }
@@ -271,17 +241,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetPropertiesPrologue( hDevice, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetPropertiesPrologue ] ) {
+            auto result = checker->zesDeviceGetPropertiesPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetPropertiesPrologue( hDevice, pProperties );
@@ -290,9 +254,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hDevice, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetPropertiesEpilogue( hDevice, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceGetPropertiesEpilogue( hDevice, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -311,17 +275,11 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetStatePrologue( hDevice, pState );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetStatePrologue ] ) {
+            auto result = checker->zesDeviceGetStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetStatePrologue( hDevice, pState );
@@ -330,9 +288,9 @@ namespace validation_layer
 
         auto result = pfnGetState( hDevice, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetStateEpilogue( hDevice, pState );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetStateEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceGetStateEpilogue( hDevice, pState, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -352,17 +310,11 @@ namespace validation_layer
         if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetPrologue( hDevice, force );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceResetPrologue ] ) {
+            auto result = checker->zesDeviceResetPrologue( hDevice, force );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceResetPrologue( hDevice, force );
@@ -371,9 +323,9 @@ namespace validation_layer
 
         auto result = pfnReset( hDevice, force );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetEpilogue( hDevice, force );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceResetEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceResetEpilogue( hDevice, force, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -392,17 +344,11 @@ namespace validation_layer
         if( nullptr == pfnResetExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetExtPrologue( hDevice, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceResetExtPrologue ] ) {
+            auto result = checker->zesDeviceResetExtPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceResetExtPrologue( hDevice, pProperties );
@@ -411,9 +357,9 @@ namespace validation_layer
 
         auto result = pfnResetExt( hDevice, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetExtEpilogue( hDevice, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceResetExtEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceResetExtEpilogue( hDevice, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -441,17 +387,11 @@ namespace validation_layer
         if( nullptr == pfnProcessesGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceProcessesGetStatePrologue( hDevice, pCount, pProcesses );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceProcessesGetStatePrologue ] ) {
+            auto result = checker->zesDeviceProcessesGetStatePrologue( hDevice, pCount, pProcesses );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceProcessesGetStatePrologue( hDevice, pCount, pProcesses );
@@ -460,9 +400,9 @@ namespace validation_layer
 
         auto result = pfnProcessesGetState( hDevice, pCount, pProcesses );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceProcessesGetStateEpilogue( hDevice, pCount, pProcesses );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceProcessesGetStateEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceProcessesGetStateEpilogue( hDevice, pCount, pProcesses, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -481,17 +421,11 @@ namespace validation_layer
         if( nullptr == pfnPciGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetPropertiesPrologue( hDevice, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDevicePciGetPropertiesPrologue ] ) {
+            auto result = checker->zesDevicePciGetPropertiesPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetPropertiesPrologue( hDevice, pProperties );
@@ -500,9 +434,9 @@ namespace validation_layer
 
         auto result = pfnPciGetProperties( hDevice, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetPropertiesEpilogue( hDevice, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDevicePciGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesDevicePciGetPropertiesEpilogue( hDevice, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -521,17 +455,11 @@ namespace validation_layer
         if( nullptr == pfnPciGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetStatePrologue( hDevice, pState );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDevicePciGetStatePrologue ] ) {
+            auto result = checker->zesDevicePciGetStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetStatePrologue( hDevice, pState );
@@ -540,9 +468,9 @@ namespace validation_layer
 
         auto result = pfnPciGetState( hDevice, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetStateEpilogue( hDevice, pState );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDevicePciGetStateEpilogue ] ) {
+            auto epilogueResult = checker->zesDevicePciGetStateEpilogue( hDevice, pState, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -569,17 +497,11 @@ namespace validation_layer
         if( nullptr == pfnPciGetBars )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetBarsPrologue( hDevice, pCount, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDevicePciGetBarsPrologue ] ) {
+            auto result = checker->zesDevicePciGetBarsPrologue( hDevice, pCount, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetBarsPrologue( hDevice, pCount, pProperties );
@@ -588,9 +510,9 @@ namespace validation_layer
 
         auto result = pfnPciGetBars( hDevice, pCount, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetBarsEpilogue( hDevice, pCount, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDevicePciGetBarsEpilogue ] ) {
+            auto epilogueResult = checker->zesDevicePciGetBarsEpilogue( hDevice, pCount, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -609,17 +531,11 @@ namespace validation_layer
         if( nullptr == pfnPciGetStats )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetStatsPrologue( hDevice, pStats );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDevicePciGetStatsPrologue ] ) {
+            auto result = checker->zesDevicePciGetStatsPrologue( hDevice, pStats );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetStatsPrologue( hDevice, pStats );
@@ -628,9 +544,9 @@ namespace validation_layer
 
         auto result = pfnPciGetStats( hDevice, pStats );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetStatsEpilogue( hDevice, pStats );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDevicePciGetStatsEpilogue ] ) {
+            auto epilogueResult = checker->zesDevicePciGetStatsEpilogue( hDevice, pStats, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -648,17 +564,11 @@ namespace validation_layer
         if( nullptr == pfnSetOverclockWaiver )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceSetOverclockWaiverPrologue( hDevice );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceSetOverclockWaiverPrologue ] ) {
+            auto result = checker->zesDeviceSetOverclockWaiverPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceSetOverclockWaiverPrologue( hDevice );
@@ -667,9 +577,9 @@ namespace validation_layer
 
         auto result = pfnSetOverclockWaiver( hDevice );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceSetOverclockWaiverEpilogue( hDevice );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceSetOverclockWaiverEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceSetOverclockWaiverEpilogue( hDevice, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -690,17 +600,11 @@ namespace validation_layer
         if( nullptr == pfnGetOverclockDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetOverclockDomainsPrologue( hDevice, pOverclockDomains );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetOverclockDomainsPrologue ] ) {
+            auto result = checker->zesDeviceGetOverclockDomainsPrologue( hDevice, pOverclockDomains );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetOverclockDomainsPrologue( hDevice, pOverclockDomains );
@@ -709,9 +613,9 @@ namespace validation_layer
 
         auto result = pfnGetOverclockDomains( hDevice, pOverclockDomains );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetOverclockDomainsEpilogue( hDevice, pOverclockDomains );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetOverclockDomainsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceGetOverclockDomainsEpilogue( hDevice, pOverclockDomains, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -733,17 +637,11 @@ namespace validation_layer
         if( nullptr == pfnGetOverclockControls )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetOverclockControlsPrologue( hDevice, domainType, pAvailableControls );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetOverclockControlsPrologue ] ) {
+            auto result = checker->zesDeviceGetOverclockControlsPrologue( hDevice, domainType, pAvailableControls );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetOverclockControlsPrologue( hDevice, domainType, pAvailableControls );
@@ -752,9 +650,9 @@ namespace validation_layer
 
         auto result = pfnGetOverclockControls( hDevice, domainType, pAvailableControls );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetOverclockControlsEpilogue( hDevice, domainType, pAvailableControls );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetOverclockControlsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceGetOverclockControlsEpilogue( hDevice, domainType, pAvailableControls, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -774,17 +672,11 @@ namespace validation_layer
         if( nullptr == pfnResetOverclockSettings )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetOverclockSettingsPrologue( hDevice, onShippedState );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceResetOverclockSettingsPrologue ] ) {
+            auto result = checker->zesDeviceResetOverclockSettingsPrologue( hDevice, onShippedState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceResetOverclockSettingsPrologue( hDevice, onShippedState );
@@ -793,9 +685,9 @@ namespace validation_layer
 
         auto result = pfnResetOverclockSettings( hDevice, onShippedState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetOverclockSettingsEpilogue( hDevice, onShippedState );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceResetOverclockSettingsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceResetOverclockSettingsEpilogue( hDevice, onShippedState, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -819,17 +711,11 @@ namespace validation_layer
         if( nullptr == pfnReadOverclockState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceReadOverclockStatePrologue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceReadOverclockStatePrologue ] ) {
+            auto result = checker->zesDeviceReadOverclockStatePrologue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceReadOverclockStatePrologue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
@@ -838,9 +724,9 @@ namespace validation_layer
 
         auto result = pfnReadOverclockState( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceReadOverclockStateEpilogue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceReadOverclockStateEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceReadOverclockStateEpilogue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -869,17 +755,11 @@ namespace validation_layer
         if( nullptr == pfnEnumOverclockDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumOverclockDomainsPrologue( hDevice, pCount, phDomainHandle );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumOverclockDomainsPrologue ] ) {
+            auto result = checker->zesDeviceEnumOverclockDomainsPrologue( hDevice, pCount, phDomainHandle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumOverclockDomainsPrologue( hDevice, pCount, phDomainHandle );
@@ -888,9 +768,9 @@ namespace validation_layer
 
         auto result = pfnEnumOverclockDomains( hDevice, pCount, phDomainHandle );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumOverclockDomainsEpilogue( hDevice, pCount, phDomainHandle );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumOverclockDomainsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumOverclockDomainsEpilogue( hDevice, pCount, phDomainHandle, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -909,17 +789,11 @@ namespace validation_layer
         if( nullptr == pfnGetDomainProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainPropertiesPrologue( hDomainHandle, pDomainProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetDomainPropertiesPrologue ] ) {
+            auto result = checker->zesOverclockGetDomainPropertiesPrologue( hDomainHandle, pDomainProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainPropertiesPrologue( hDomainHandle, pDomainProperties );
@@ -928,9 +802,9 @@ namespace validation_layer
 
         auto result = pfnGetDomainProperties( hDomainHandle, pDomainProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainPropertiesEpilogue( hDomainHandle, pDomainProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetDomainPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesOverclockGetDomainPropertiesEpilogue( hDomainHandle, pDomainProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -949,17 +823,11 @@ namespace validation_layer
         if( nullptr == pfnGetDomainVFProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainVFPropertiesPrologue( hDomainHandle, pVFProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetDomainVFPropertiesPrologue ] ) {
+            auto result = checker->zesOverclockGetDomainVFPropertiesPrologue( hDomainHandle, pVFProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainVFPropertiesPrologue( hDomainHandle, pVFProperties );
@@ -968,9 +836,9 @@ namespace validation_layer
 
         auto result = pfnGetDomainVFProperties( hDomainHandle, pVFProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainVFPropertiesEpilogue( hDomainHandle, pVFProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetDomainVFPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesOverclockGetDomainVFPropertiesEpilogue( hDomainHandle, pVFProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -990,17 +858,11 @@ namespace validation_layer
         if( nullptr == pfnGetDomainControlProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainControlPropertiesPrologue( hDomainHandle, DomainControl, pControlProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetDomainControlPropertiesPrologue ] ) {
+            auto result = checker->zesOverclockGetDomainControlPropertiesPrologue( hDomainHandle, DomainControl, pControlProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainControlPropertiesPrologue( hDomainHandle, DomainControl, pControlProperties );
@@ -1009,9 +871,9 @@ namespace validation_layer
 
         auto result = pfnGetDomainControlProperties( hDomainHandle, DomainControl, pControlProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainControlPropertiesEpilogue( hDomainHandle, DomainControl, pControlProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetDomainControlPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesOverclockGetDomainControlPropertiesEpilogue( hDomainHandle, DomainControl, pControlProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1031,17 +893,11 @@ namespace validation_layer
         if( nullptr == pfnGetControlCurrentValue )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlCurrentValuePrologue( hDomainHandle, DomainControl, pValue );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetControlCurrentValuePrologue ] ) {
+            auto result = checker->zesOverclockGetControlCurrentValuePrologue( hDomainHandle, DomainControl, pValue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlCurrentValuePrologue( hDomainHandle, DomainControl, pValue );
@@ -1050,9 +906,9 @@ namespace validation_layer
 
         auto result = pfnGetControlCurrentValue( hDomainHandle, DomainControl, pValue );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlCurrentValueEpilogue( hDomainHandle, DomainControl, pValue );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetControlCurrentValueEpilogue ] ) {
+            auto epilogueResult = checker->zesOverclockGetControlCurrentValueEpilogue( hDomainHandle, DomainControl, pValue, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1073,17 +929,11 @@ namespace validation_layer
         if( nullptr == pfnGetControlPendingValue )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlPendingValuePrologue( hDomainHandle, DomainControl, pValue );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetControlPendingValuePrologue ] ) {
+            auto result = checker->zesOverclockGetControlPendingValuePrologue( hDomainHandle, DomainControl, pValue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlPendingValuePrologue( hDomainHandle, DomainControl, pValue );
@@ -1092,9 +942,9 @@ namespace validation_layer
 
         auto result = pfnGetControlPendingValue( hDomainHandle, DomainControl, pValue );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlPendingValueEpilogue( hDomainHandle, DomainControl, pValue );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetControlPendingValueEpilogue ] ) {
+            auto epilogueResult = checker->zesOverclockGetControlPendingValueEpilogue( hDomainHandle, DomainControl, pValue, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1116,17 +966,11 @@ namespace validation_layer
         if( nullptr == pfnSetControlUserValue )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockSetControlUserValuePrologue( hDomainHandle, DomainControl, pValue, pPendingAction );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockSetControlUserValuePrologue ] ) {
+            auto result = checker->zesOverclockSetControlUserValuePrologue( hDomainHandle, DomainControl, pValue, pPendingAction );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockSetControlUserValuePrologue( hDomainHandle, DomainControl, pValue, pPendingAction );
@@ -1135,9 +979,9 @@ namespace validation_layer
 
         auto result = pfnSetControlUserValue( hDomainHandle, DomainControl, pValue, pPendingAction );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockSetControlUserValueEpilogue( hDomainHandle, DomainControl, pValue, pPendingAction );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockSetControlUserValueEpilogue ] ) {
+            auto epilogueResult = checker->zesOverclockSetControlUserValueEpilogue( hDomainHandle, DomainControl, pValue, pPendingAction, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1158,17 +1002,11 @@ namespace validation_layer
         if( nullptr == pfnGetControlState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlStatePrologue( hDomainHandle, DomainControl, pControlState, pPendingAction );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetControlStatePrologue ] ) {
+            auto result = checker->zesOverclockGetControlStatePrologue( hDomainHandle, DomainControl, pControlState, pPendingAction );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlStatePrologue( hDomainHandle, DomainControl, pControlState, pPendingAction );
@@ -1177,9 +1015,9 @@ namespace validation_layer
 
         auto result = pfnGetControlState( hDomainHandle, DomainControl, pControlState, pPendingAction );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlStateEpilogue( hDomainHandle, DomainControl, pControlState, pPendingAction );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetControlStateEpilogue ] ) {
+            auto epilogueResult = checker->zesOverclockGetControlStateEpilogue( hDomainHandle, DomainControl, pControlState, pPendingAction, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1202,17 +1040,11 @@ namespace validation_layer
         if( nullptr == pfnGetVFPointValues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetVFPointValuesPrologue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetVFPointValuesPrologue ] ) {
+            auto result = checker->zesOverclockGetVFPointValuesPrologue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetVFPointValuesPrologue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
@@ -1221,9 +1053,9 @@ namespace validation_layer
 
         auto result = pfnGetVFPointValues( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetVFPointValuesEpilogue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockGetVFPointValuesEpilogue ] ) {
+            auto epilogueResult = checker->zesOverclockGetVFPointValuesEpilogue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1245,17 +1077,11 @@ namespace validation_layer
         if( nullptr == pfnSetVFPointValues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockSetVFPointValuesPrologue( hDomainHandle, VFType, PointIndex, PointValue );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockSetVFPointValuesPrologue ] ) {
+            auto result = checker->zesOverclockSetVFPointValuesPrologue( hDomainHandle, VFType, PointIndex, PointValue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockSetVFPointValuesPrologue( hDomainHandle, VFType, PointIndex, PointValue );
@@ -1264,9 +1090,9 @@ namespace validation_layer
 
         auto result = pfnSetVFPointValues( hDomainHandle, VFType, PointIndex, PointValue );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesOverclockSetVFPointValuesEpilogue( hDomainHandle, VFType, PointIndex, PointValue );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesOverclockSetVFPointValuesEpilogue ] ) {
+            auto epilogueResult = checker->zesOverclockSetVFPointValuesEpilogue( hDomainHandle, VFType, PointIndex, PointValue, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1295,17 +1121,11 @@ namespace validation_layer
         if( nullptr == pfnEnumDiagnosticTestSuites )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumDiagnosticTestSuitesPrologue( hDevice, pCount, phDiagnostics );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumDiagnosticTestSuitesPrologue ] ) {
+            auto result = checker->zesDeviceEnumDiagnosticTestSuitesPrologue( hDevice, pCount, phDiagnostics );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumDiagnosticTestSuitesPrologue( hDevice, pCount, phDiagnostics );
@@ -1314,9 +1134,9 @@ namespace validation_layer
 
         auto result = pfnEnumDiagnosticTestSuites( hDevice, pCount, phDiagnostics );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumDiagnosticTestSuitesEpilogue( hDevice, pCount, phDiagnostics );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumDiagnosticTestSuitesEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumDiagnosticTestSuitesEpilogue( hDevice, pCount, phDiagnostics, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1336,17 +1156,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsGetPropertiesPrologue( hDiagnostics, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDiagnosticsGetPropertiesPrologue ] ) {
+            auto result = checker->zesDiagnosticsGetPropertiesPrologue( hDiagnostics, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDiagnosticsGetPropertiesPrologue( hDiagnostics, pProperties );
@@ -1355,9 +1169,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hDiagnostics, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsGetPropertiesEpilogue( hDiagnostics, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDiagnosticsGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesDiagnosticsGetPropertiesEpilogue( hDiagnostics, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1384,17 +1198,11 @@ namespace validation_layer
         if( nullptr == pfnGetTests )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsGetTestsPrologue( hDiagnostics, pCount, pTests );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDiagnosticsGetTestsPrologue ] ) {
+            auto result = checker->zesDiagnosticsGetTestsPrologue( hDiagnostics, pCount, pTests );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDiagnosticsGetTestsPrologue( hDiagnostics, pCount, pTests );
@@ -1403,9 +1211,9 @@ namespace validation_layer
 
         auto result = pfnGetTests( hDiagnostics, pCount, pTests );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsGetTestsEpilogue( hDiagnostics, pCount, pTests );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDiagnosticsGetTestsEpilogue ] ) {
+            auto epilogueResult = checker->zesDiagnosticsGetTestsEpilogue( hDiagnostics, pCount, pTests, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1428,17 +1236,11 @@ namespace validation_layer
         if( nullptr == pfnRunTests )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsRunTestsPrologue( hDiagnostics, startIndex, endIndex, pResult );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDiagnosticsRunTestsPrologue ] ) {
+            auto result = checker->zesDiagnosticsRunTestsPrologue( hDiagnostics, startIndex, endIndex, pResult );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDiagnosticsRunTestsPrologue( hDiagnostics, startIndex, endIndex, pResult );
@@ -1447,9 +1249,9 @@ namespace validation_layer
 
         auto result = pfnRunTests( hDiagnostics, startIndex, endIndex, pResult );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsRunTestsEpilogue( hDiagnostics, startIndex, endIndex, pResult );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDiagnosticsRunTestsEpilogue ] ) {
+            auto epilogueResult = checker->zesDiagnosticsRunTestsEpilogue( hDiagnostics, startIndex, endIndex, pResult, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1468,17 +1270,11 @@ namespace validation_layer
         if( nullptr == pfnEccAvailable )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEccAvailablePrologue( hDevice, pAvailable );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEccAvailablePrologue ] ) {
+            auto result = checker->zesDeviceEccAvailablePrologue( hDevice, pAvailable );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEccAvailablePrologue( hDevice, pAvailable );
@@ -1487,9 +1283,9 @@ namespace validation_layer
 
         auto result = pfnEccAvailable( hDevice, pAvailable );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEccAvailableEpilogue( hDevice, pAvailable );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEccAvailableEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEccAvailableEpilogue( hDevice, pAvailable, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1508,17 +1304,11 @@ namespace validation_layer
         if( nullptr == pfnEccConfigurable )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEccConfigurablePrologue( hDevice, pConfigurable );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEccConfigurablePrologue ] ) {
+            auto result = checker->zesDeviceEccConfigurablePrologue( hDevice, pConfigurable );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEccConfigurablePrologue( hDevice, pConfigurable );
@@ -1527,9 +1317,9 @@ namespace validation_layer
 
         auto result = pfnEccConfigurable( hDevice, pConfigurable );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEccConfigurableEpilogue( hDevice, pConfigurable );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEccConfigurableEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEccConfigurableEpilogue( hDevice, pConfigurable, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1548,17 +1338,11 @@ namespace validation_layer
         if( nullptr == pfnGetEccState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetEccStatePrologue( hDevice, pState );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetEccStatePrologue ] ) {
+            auto result = checker->zesDeviceGetEccStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetEccStatePrologue( hDevice, pState );
@@ -1567,9 +1351,9 @@ namespace validation_layer
 
         auto result = pfnGetEccState( hDevice, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetEccStateEpilogue( hDevice, pState );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetEccStateEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceGetEccStateEpilogue( hDevice, pState, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1589,17 +1373,11 @@ namespace validation_layer
         if( nullptr == pfnSetEccState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceSetEccStatePrologue( hDevice, newState, pState );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceSetEccStatePrologue ] ) {
+            auto result = checker->zesDeviceSetEccStatePrologue( hDevice, newState, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceSetEccStatePrologue( hDevice, newState, pState );
@@ -1608,9 +1386,9 @@ namespace validation_layer
 
         auto result = pfnSetEccState( hDevice, newState, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceSetEccStateEpilogue( hDevice, newState, pState );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceSetEccStateEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceSetEccStateEpilogue( hDevice, newState, pState, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1639,17 +1417,11 @@ namespace validation_layer
         if( nullptr == pfnEnumEngineGroups )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumEngineGroupsPrologue( hDevice, pCount, phEngine );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumEngineGroupsPrologue ] ) {
+            auto result = checker->zesDeviceEnumEngineGroupsPrologue( hDevice, pCount, phEngine );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumEngineGroupsPrologue( hDevice, pCount, phEngine );
@@ -1658,9 +1430,9 @@ namespace validation_layer
 
         auto result = pfnEnumEngineGroups( hDevice, pCount, phEngine );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumEngineGroupsEpilogue( hDevice, pCount, phEngine );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumEngineGroupsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumEngineGroupsEpilogue( hDevice, pCount, phEngine, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1679,17 +1451,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesEngineGetPropertiesPrologue( hEngine, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesEngineGetPropertiesPrologue ] ) {
+            auto result = checker->zesEngineGetPropertiesPrologue( hEngine, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesEngineGetPropertiesPrologue( hEngine, pProperties );
@@ -1698,9 +1464,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hEngine, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesEngineGetPropertiesEpilogue( hEngine, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesEngineGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesEngineGetPropertiesEpilogue( hEngine, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1720,17 +1486,11 @@ namespace validation_layer
         if( nullptr == pfnGetActivity )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesEngineGetActivityPrologue( hEngine, pStats );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesEngineGetActivityPrologue ] ) {
+            auto result = checker->zesEngineGetActivityPrologue( hEngine, pStats );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesEngineGetActivityPrologue( hEngine, pStats );
@@ -1739,9 +1499,9 @@ namespace validation_layer
 
         auto result = pfnGetActivity( hEngine, pStats );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesEngineGetActivityEpilogue( hEngine, pStats );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesEngineGetActivityEpilogue ] ) {
+            auto epilogueResult = checker->zesEngineGetActivityEpilogue( hEngine, pStats, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1760,17 +1520,11 @@ namespace validation_layer
         if( nullptr == pfnEventRegister )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEventRegisterPrologue( hDevice, events );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEventRegisterPrologue ] ) {
+            auto result = checker->zesDeviceEventRegisterPrologue( hDevice, events );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEventRegisterPrologue( hDevice, events );
@@ -1779,9 +1533,9 @@ namespace validation_layer
 
         auto result = pfnEventRegister( hDevice, events );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEventRegisterEpilogue( hDevice, events );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEventRegisterEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEventRegisterEpilogue( hDevice, events, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1816,17 +1570,11 @@ namespace validation_layer
         if( nullptr == pfnEventListen )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverEventListenPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDriverEventListenPrologue ] ) {
+            auto result = checker->zesDriverEventListenPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverEventListenPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
@@ -1835,9 +1583,9 @@ namespace validation_layer
 
         auto result = pfnEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverEventListenEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDriverEventListenEpilogue ] ) {
+            auto epilogueResult = checker->zesDriverEventListenEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1872,17 +1620,11 @@ namespace validation_layer
         if( nullptr == pfnEventListenEx )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverEventListenExPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDriverEventListenExPrologue ] ) {
+            auto result = checker->zesDriverEventListenExPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverEventListenExPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
@@ -1891,9 +1633,9 @@ namespace validation_layer
 
         auto result = pfnEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverEventListenExEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDriverEventListenExEpilogue ] ) {
+            auto epilogueResult = checker->zesDriverEventListenExEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1922,17 +1664,11 @@ namespace validation_layer
         if( nullptr == pfnEnumFabricPorts )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFabricPortsPrologue( hDevice, pCount, phPort );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumFabricPortsPrologue ] ) {
+            auto result = checker->zesDeviceEnumFabricPortsPrologue( hDevice, pCount, phPort );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFabricPortsPrologue( hDevice, pCount, phPort );
@@ -1941,9 +1677,9 @@ namespace validation_layer
 
         auto result = pfnEnumFabricPorts( hDevice, pCount, phPort );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFabricPortsEpilogue( hDevice, pCount, phPort );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumFabricPortsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumFabricPortsEpilogue( hDevice, pCount, phPort, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1962,17 +1698,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetPropertiesPrologue( hPort, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetPropertiesPrologue ] ) {
+            auto result = checker->zesFabricPortGetPropertiesPrologue( hPort, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetPropertiesPrologue( hPort, pProperties );
@@ -1981,9 +1711,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hPort, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetPropertiesEpilogue( hPort, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesFabricPortGetPropertiesEpilogue( hPort, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2003,17 +1733,11 @@ namespace validation_layer
         if( nullptr == pfnGetLinkType )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetLinkTypePrologue( hPort, pLinkType );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetLinkTypePrologue ] ) {
+            auto result = checker->zesFabricPortGetLinkTypePrologue( hPort, pLinkType );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetLinkTypePrologue( hPort, pLinkType );
@@ -2022,9 +1746,9 @@ namespace validation_layer
 
         auto result = pfnGetLinkType( hPort, pLinkType );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetLinkTypeEpilogue( hPort, pLinkType );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetLinkTypeEpilogue ] ) {
+            auto epilogueResult = checker->zesFabricPortGetLinkTypeEpilogue( hPort, pLinkType, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2043,17 +1767,11 @@ namespace validation_layer
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetConfigPrologue( hPort, pConfig );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetConfigPrologue ] ) {
+            auto result = checker->zesFabricPortGetConfigPrologue( hPort, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetConfigPrologue( hPort, pConfig );
@@ -2062,9 +1780,9 @@ namespace validation_layer
 
         auto result = pfnGetConfig( hPort, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetConfigEpilogue( hPort, pConfig );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetConfigEpilogue ] ) {
+            auto epilogueResult = checker->zesFabricPortGetConfigEpilogue( hPort, pConfig, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2083,17 +1801,11 @@ namespace validation_layer
         if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortSetConfigPrologue( hPort, pConfig );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortSetConfigPrologue ] ) {
+            auto result = checker->zesFabricPortSetConfigPrologue( hPort, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortSetConfigPrologue( hPort, pConfig );
@@ -2102,9 +1814,9 @@ namespace validation_layer
 
         auto result = pfnSetConfig( hPort, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortSetConfigEpilogue( hPort, pConfig );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortSetConfigEpilogue ] ) {
+            auto epilogueResult = checker->zesFabricPortSetConfigEpilogue( hPort, pConfig, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2123,17 +1835,11 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetStatePrologue( hPort, pState );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetStatePrologue ] ) {
+            auto result = checker->zesFabricPortGetStatePrologue( hPort, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetStatePrologue( hPort, pState );
@@ -2142,9 +1848,9 @@ namespace validation_layer
 
         auto result = pfnGetState( hPort, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetStateEpilogue( hPort, pState );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetStateEpilogue ] ) {
+            auto epilogueResult = checker->zesFabricPortGetStateEpilogue( hPort, pState, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2163,17 +1869,11 @@ namespace validation_layer
         if( nullptr == pfnGetThroughput )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetThroughputPrologue( hPort, pThroughput );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetThroughputPrologue ] ) {
+            auto result = checker->zesFabricPortGetThroughputPrologue( hPort, pThroughput );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetThroughputPrologue( hPort, pThroughput );
@@ -2182,9 +1882,9 @@ namespace validation_layer
 
         auto result = pfnGetThroughput( hPort, pThroughput );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetThroughputEpilogue( hPort, pThroughput );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetThroughputEpilogue ] ) {
+            auto epilogueResult = checker->zesFabricPortGetThroughputEpilogue( hPort, pThroughput, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2203,17 +1903,11 @@ namespace validation_layer
         if( nullptr == pfnGetFabricErrorCounters )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetFabricErrorCountersPrologue( hPort, pErrors );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetFabricErrorCountersPrologue ] ) {
+            auto result = checker->zesFabricPortGetFabricErrorCountersPrologue( hPort, pErrors );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetFabricErrorCountersPrologue( hPort, pErrors );
@@ -2222,9 +1916,9 @@ namespace validation_layer
 
         auto result = pfnGetFabricErrorCounters( hPort, pErrors );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetFabricErrorCountersEpilogue( hPort, pErrors );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetFabricErrorCountersEpilogue ] ) {
+            auto epilogueResult = checker->zesFabricPortGetFabricErrorCountersEpilogue( hPort, pErrors, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2247,17 +1941,11 @@ namespace validation_layer
         if( nullptr == pfnGetMultiPortThroughput )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetMultiPortThroughputPrologue( hDevice, numPorts, phPort, pThroughput );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetMultiPortThroughputPrologue ] ) {
+            auto result = checker->zesFabricPortGetMultiPortThroughputPrologue( hDevice, numPorts, phPort, pThroughput );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetMultiPortThroughputPrologue( hDevice, numPorts, phPort, pThroughput );
@@ -2266,9 +1954,9 @@ namespace validation_layer
 
         auto result = pfnGetMultiPortThroughput( hDevice, numPorts, phPort, pThroughput );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetMultiPortThroughputEpilogue( hDevice, numPorts, phPort, pThroughput );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFabricPortGetMultiPortThroughputEpilogue ] ) {
+            auto epilogueResult = checker->zesFabricPortGetMultiPortThroughputEpilogue( hDevice, numPorts, phPort, pThroughput, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2297,17 +1985,11 @@ namespace validation_layer
         if( nullptr == pfnEnumFans )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFansPrologue( hDevice, pCount, phFan );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumFansPrologue ] ) {
+            auto result = checker->zesDeviceEnumFansPrologue( hDevice, pCount, phFan );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFansPrologue( hDevice, pCount, phFan );
@@ -2316,9 +1998,9 @@ namespace validation_layer
 
         auto result = pfnEnumFans( hDevice, pCount, phFan );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFansEpilogue( hDevice, pCount, phFan );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumFansEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumFansEpilogue( hDevice, pCount, phFan, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2337,17 +2019,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanGetPropertiesPrologue( hFan, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFanGetPropertiesPrologue ] ) {
+            auto result = checker->zesFanGetPropertiesPrologue( hFan, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanGetPropertiesPrologue( hFan, pProperties );
@@ -2356,9 +2032,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hFan, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanGetPropertiesEpilogue( hFan, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFanGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesFanGetPropertiesEpilogue( hFan, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2377,17 +2053,11 @@ namespace validation_layer
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanGetConfigPrologue( hFan, pConfig );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFanGetConfigPrologue ] ) {
+            auto result = checker->zesFanGetConfigPrologue( hFan, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanGetConfigPrologue( hFan, pConfig );
@@ -2396,9 +2066,9 @@ namespace validation_layer
 
         auto result = pfnGetConfig( hFan, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanGetConfigEpilogue( hFan, pConfig );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFanGetConfigEpilogue ] ) {
+            auto epilogueResult = checker->zesFanGetConfigEpilogue( hFan, pConfig, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2416,17 +2086,11 @@ namespace validation_layer
         if( nullptr == pfnSetDefaultMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanSetDefaultModePrologue( hFan );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFanSetDefaultModePrologue ] ) {
+            auto result = checker->zesFanSetDefaultModePrologue( hFan );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanSetDefaultModePrologue( hFan );
@@ -2435,9 +2099,9 @@ namespace validation_layer
 
         auto result = pfnSetDefaultMode( hFan );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanSetDefaultModeEpilogue( hFan );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFanSetDefaultModeEpilogue ] ) {
+            auto epilogueResult = checker->zesFanSetDefaultModeEpilogue( hFan, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2456,17 +2120,11 @@ namespace validation_layer
         if( nullptr == pfnSetFixedSpeedMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanSetFixedSpeedModePrologue( hFan, speed );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFanSetFixedSpeedModePrologue ] ) {
+            auto result = checker->zesFanSetFixedSpeedModePrologue( hFan, speed );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanSetFixedSpeedModePrologue( hFan, speed );
@@ -2475,9 +2133,9 @@ namespace validation_layer
 
         auto result = pfnSetFixedSpeedMode( hFan, speed );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanSetFixedSpeedModeEpilogue( hFan, speed );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFanSetFixedSpeedModeEpilogue ] ) {
+            auto epilogueResult = checker->zesFanSetFixedSpeedModeEpilogue( hFan, speed, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2496,17 +2154,11 @@ namespace validation_layer
         if( nullptr == pfnSetSpeedTableMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanSetSpeedTableModePrologue( hFan, speedTable );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFanSetSpeedTableModePrologue ] ) {
+            auto result = checker->zesFanSetSpeedTableModePrologue( hFan, speedTable );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanSetSpeedTableModePrologue( hFan, speedTable );
@@ -2515,9 +2167,9 @@ namespace validation_layer
 
         auto result = pfnSetSpeedTableMode( hFan, speedTable );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanSetSpeedTableModeEpilogue( hFan, speedTable );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFanSetSpeedTableModeEpilogue ] ) {
+            auto epilogueResult = checker->zesFanSetSpeedTableModeEpilogue( hFan, speedTable, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2539,17 +2191,11 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanGetStatePrologue( hFan, units, pSpeed );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFanGetStatePrologue ] ) {
+            auto result = checker->zesFanGetStatePrologue( hFan, units, pSpeed );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanGetStatePrologue( hFan, units, pSpeed );
@@ -2558,9 +2204,9 @@ namespace validation_layer
 
         auto result = pfnGetState( hFan, units, pSpeed );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFanGetStateEpilogue( hFan, units, pSpeed );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFanGetStateEpilogue ] ) {
+            auto epilogueResult = checker->zesFanGetStateEpilogue( hFan, units, pSpeed, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2589,17 +2235,11 @@ namespace validation_layer
         if( nullptr == pfnEnumFirmwares )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFirmwaresPrologue( hDevice, pCount, phFirmware );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumFirmwaresPrologue ] ) {
+            auto result = checker->zesDeviceEnumFirmwaresPrologue( hDevice, pCount, phFirmware );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFirmwaresPrologue( hDevice, pCount, phFirmware );
@@ -2608,9 +2248,9 @@ namespace validation_layer
 
         auto result = pfnEnumFirmwares( hDevice, pCount, phFirmware );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFirmwaresEpilogue( hDevice, pCount, phFirmware );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumFirmwaresEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumFirmwaresEpilogue( hDevice, pCount, phFirmware, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2630,17 +2270,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetPropertiesPrologue( hFirmware, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFirmwareGetPropertiesPrologue ] ) {
+            auto result = checker->zesFirmwareGetPropertiesPrologue( hFirmware, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetPropertiesPrologue( hFirmware, pProperties );
@@ -2649,9 +2283,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hFirmware, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetPropertiesEpilogue( hFirmware, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFirmwareGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesFirmwareGetPropertiesEpilogue( hFirmware, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2671,17 +2305,11 @@ namespace validation_layer
         if( nullptr == pfnFlash )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareFlashPrologue( hFirmware, pImage, size );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFirmwareFlashPrologue ] ) {
+            auto result = checker->zesFirmwareFlashPrologue( hFirmware, pImage, size );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareFlashPrologue( hFirmware, pImage, size );
@@ -2690,9 +2318,9 @@ namespace validation_layer
 
         auto result = pfnFlash( hFirmware, pImage, size );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareFlashEpilogue( hFirmware, pImage, size );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFirmwareFlashEpilogue ] ) {
+            auto epilogueResult = checker->zesFirmwareFlashEpilogue( hFirmware, pImage, size, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2711,17 +2339,11 @@ namespace validation_layer
         if( nullptr == pfnGetFlashProgress )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetFlashProgressPrologue( hFirmware, pCompletionPercent );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFirmwareGetFlashProgressPrologue ] ) {
+            auto result = checker->zesFirmwareGetFlashProgressPrologue( hFirmware, pCompletionPercent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetFlashProgressPrologue( hFirmware, pCompletionPercent );
@@ -2730,9 +2352,9 @@ namespace validation_layer
 
         auto result = pfnGetFlashProgress( hFirmware, pCompletionPercent );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetFlashProgressEpilogue( hFirmware, pCompletionPercent );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFirmwareGetFlashProgressEpilogue ] ) {
+            auto epilogueResult = checker->zesFirmwareGetFlashProgressEpilogue( hFirmware, pCompletionPercent, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2752,17 +2374,11 @@ namespace validation_layer
         if( nullptr == pfnGetConsoleLogs )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetConsoleLogsPrologue( hFirmware, pSize, pFirmwareLog );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFirmwareGetConsoleLogsPrologue ] ) {
+            auto result = checker->zesFirmwareGetConsoleLogsPrologue( hFirmware, pSize, pFirmwareLog );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetConsoleLogsPrologue( hFirmware, pSize, pFirmwareLog );
@@ -2771,9 +2387,9 @@ namespace validation_layer
 
         auto result = pfnGetConsoleLogs( hFirmware, pSize, pFirmwareLog );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetConsoleLogsEpilogue( hFirmware, pSize, pFirmwareLog );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFirmwareGetConsoleLogsEpilogue ] ) {
+            auto epilogueResult = checker->zesFirmwareGetConsoleLogsEpilogue( hFirmware, pSize, pFirmwareLog, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2802,17 +2418,11 @@ namespace validation_layer
         if( nullptr == pfnEnumFrequencyDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFrequencyDomainsPrologue( hDevice, pCount, phFrequency );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumFrequencyDomainsPrologue ] ) {
+            auto result = checker->zesDeviceEnumFrequencyDomainsPrologue( hDevice, pCount, phFrequency );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFrequencyDomainsPrologue( hDevice, pCount, phFrequency );
@@ -2821,9 +2431,9 @@ namespace validation_layer
 
         auto result = pfnEnumFrequencyDomains( hDevice, pCount, phFrequency );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFrequencyDomainsEpilogue( hDevice, pCount, phFrequency );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumFrequencyDomainsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumFrequencyDomainsEpilogue( hDevice, pCount, phFrequency, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2842,17 +2452,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetPropertiesPrologue( hFrequency, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyGetPropertiesPrologue ] ) {
+            auto result = checker->zesFrequencyGetPropertiesPrologue( hFrequency, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetPropertiesPrologue( hFrequency, pProperties );
@@ -2861,9 +2465,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hFrequency, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetPropertiesEpilogue( hFrequency, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyGetPropertiesEpilogue( hFrequency, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2890,17 +2494,11 @@ namespace validation_layer
         if( nullptr == pfnGetAvailableClocks )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetAvailableClocksPrologue( hFrequency, pCount, phFrequency );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyGetAvailableClocksPrologue ] ) {
+            auto result = checker->zesFrequencyGetAvailableClocksPrologue( hFrequency, pCount, phFrequency );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetAvailableClocksPrologue( hFrequency, pCount, phFrequency );
@@ -2909,9 +2507,9 @@ namespace validation_layer
 
         auto result = pfnGetAvailableClocks( hFrequency, pCount, phFrequency );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetAvailableClocksEpilogue( hFrequency, pCount, phFrequency );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyGetAvailableClocksEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyGetAvailableClocksEpilogue( hFrequency, pCount, phFrequency, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2931,17 +2529,11 @@ namespace validation_layer
         if( nullptr == pfnGetRange )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetRangePrologue( hFrequency, pLimits );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyGetRangePrologue ] ) {
+            auto result = checker->zesFrequencyGetRangePrologue( hFrequency, pLimits );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetRangePrologue( hFrequency, pLimits );
@@ -2950,9 +2542,9 @@ namespace validation_layer
 
         auto result = pfnGetRange( hFrequency, pLimits );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetRangeEpilogue( hFrequency, pLimits );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyGetRangeEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyGetRangeEpilogue( hFrequency, pLimits, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2972,17 +2564,11 @@ namespace validation_layer
         if( nullptr == pfnSetRange )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencySetRangePrologue( hFrequency, pLimits );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencySetRangePrologue ] ) {
+            auto result = checker->zesFrequencySetRangePrologue( hFrequency, pLimits );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencySetRangePrologue( hFrequency, pLimits );
@@ -2991,9 +2577,9 @@ namespace validation_layer
 
         auto result = pfnSetRange( hFrequency, pLimits );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencySetRangeEpilogue( hFrequency, pLimits );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencySetRangeEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencySetRangeEpilogue( hFrequency, pLimits, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3012,17 +2598,11 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetStatePrologue( hFrequency, pState );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyGetStatePrologue ] ) {
+            auto result = checker->zesFrequencyGetStatePrologue( hFrequency, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetStatePrologue( hFrequency, pState );
@@ -3031,9 +2611,9 @@ namespace validation_layer
 
         auto result = pfnGetState( hFrequency, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetStateEpilogue( hFrequency, pState );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyGetStateEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyGetStateEpilogue( hFrequency, pState, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3053,17 +2633,11 @@ namespace validation_layer
         if( nullptr == pfnGetThrottleTime )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetThrottleTimePrologue( hFrequency, pThrottleTime );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyGetThrottleTimePrologue ] ) {
+            auto result = checker->zesFrequencyGetThrottleTimePrologue( hFrequency, pThrottleTime );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetThrottleTimePrologue( hFrequency, pThrottleTime );
@@ -3072,9 +2646,9 @@ namespace validation_layer
 
         auto result = pfnGetThrottleTime( hFrequency, pThrottleTime );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetThrottleTimeEpilogue( hFrequency, pThrottleTime );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyGetThrottleTimeEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyGetThrottleTimeEpilogue( hFrequency, pThrottleTime, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3093,17 +2667,11 @@ namespace validation_layer
         if( nullptr == pfnOcGetCapabilities )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetCapabilitiesPrologue( hFrequency, pOcCapabilities );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcGetCapabilitiesPrologue ] ) {
+            auto result = checker->zesFrequencyOcGetCapabilitiesPrologue( hFrequency, pOcCapabilities );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetCapabilitiesPrologue( hFrequency, pOcCapabilities );
@@ -3112,9 +2680,9 @@ namespace validation_layer
 
         auto result = pfnOcGetCapabilities( hFrequency, pOcCapabilities );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetCapabilitiesEpilogue( hFrequency, pOcCapabilities );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcGetCapabilitiesEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyOcGetCapabilitiesEpilogue( hFrequency, pOcCapabilities, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3136,17 +2704,11 @@ namespace validation_layer
         if( nullptr == pfnOcGetFrequencyTarget )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetFrequencyTargetPrologue( hFrequency, pCurrentOcFrequency );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcGetFrequencyTargetPrologue ] ) {
+            auto result = checker->zesFrequencyOcGetFrequencyTargetPrologue( hFrequency, pCurrentOcFrequency );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetFrequencyTargetPrologue( hFrequency, pCurrentOcFrequency );
@@ -3155,9 +2717,9 @@ namespace validation_layer
 
         auto result = pfnOcGetFrequencyTarget( hFrequency, pCurrentOcFrequency );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetFrequencyTargetEpilogue( hFrequency, pCurrentOcFrequency );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcGetFrequencyTargetEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyOcGetFrequencyTargetEpilogue( hFrequency, pCurrentOcFrequency, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3179,17 +2741,11 @@ namespace validation_layer
         if( nullptr == pfnOcSetFrequencyTarget )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetFrequencyTargetPrologue( hFrequency, CurrentOcFrequency );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcSetFrequencyTargetPrologue ] ) {
+            auto result = checker->zesFrequencyOcSetFrequencyTargetPrologue( hFrequency, CurrentOcFrequency );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetFrequencyTargetPrologue( hFrequency, CurrentOcFrequency );
@@ -3198,9 +2754,9 @@ namespace validation_layer
 
         auto result = pfnOcSetFrequencyTarget( hFrequency, CurrentOcFrequency );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetFrequencyTargetEpilogue( hFrequency, CurrentOcFrequency );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcSetFrequencyTargetEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyOcSetFrequencyTargetEpilogue( hFrequency, CurrentOcFrequency, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3224,17 +2780,11 @@ namespace validation_layer
         if( nullptr == pfnOcGetVoltageTarget )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetVoltageTargetPrologue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcGetVoltageTargetPrologue ] ) {
+            auto result = checker->zesFrequencyOcGetVoltageTargetPrologue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetVoltageTargetPrologue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
@@ -3243,9 +2793,9 @@ namespace validation_layer
 
         auto result = pfnOcGetVoltageTarget( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetVoltageTargetEpilogue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcGetVoltageTargetEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyOcGetVoltageTargetEpilogue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3269,17 +2819,11 @@ namespace validation_layer
         if( nullptr == pfnOcSetVoltageTarget )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetVoltageTargetPrologue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcSetVoltageTargetPrologue ] ) {
+            auto result = checker->zesFrequencyOcSetVoltageTargetPrologue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetVoltageTargetPrologue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
@@ -3288,9 +2832,9 @@ namespace validation_layer
 
         auto result = pfnOcSetVoltageTarget( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetVoltageTargetEpilogue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcSetVoltageTargetEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyOcSetVoltageTargetEpilogue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3309,17 +2853,11 @@ namespace validation_layer
         if( nullptr == pfnOcSetMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetModePrologue( hFrequency, CurrentOcMode );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcSetModePrologue ] ) {
+            auto result = checker->zesFrequencyOcSetModePrologue( hFrequency, CurrentOcMode );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetModePrologue( hFrequency, CurrentOcMode );
@@ -3328,9 +2866,9 @@ namespace validation_layer
 
         auto result = pfnOcSetMode( hFrequency, CurrentOcMode );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetModeEpilogue( hFrequency, CurrentOcMode );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcSetModeEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyOcSetModeEpilogue( hFrequency, CurrentOcMode, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3349,17 +2887,11 @@ namespace validation_layer
         if( nullptr == pfnOcGetMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetModePrologue( hFrequency, pCurrentOcMode );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcGetModePrologue ] ) {
+            auto result = checker->zesFrequencyOcGetModePrologue( hFrequency, pCurrentOcMode );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetModePrologue( hFrequency, pCurrentOcMode );
@@ -3368,9 +2900,9 @@ namespace validation_layer
 
         auto result = pfnOcGetMode( hFrequency, pCurrentOcMode );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetModeEpilogue( hFrequency, pCurrentOcMode );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcGetModeEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyOcGetModeEpilogue( hFrequency, pCurrentOcMode, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3390,17 +2922,11 @@ namespace validation_layer
         if( nullptr == pfnOcGetIccMax )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetIccMaxPrologue( hFrequency, pOcIccMax );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcGetIccMaxPrologue ] ) {
+            auto result = checker->zesFrequencyOcGetIccMaxPrologue( hFrequency, pOcIccMax );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetIccMaxPrologue( hFrequency, pOcIccMax );
@@ -3409,9 +2935,9 @@ namespace validation_layer
 
         auto result = pfnOcGetIccMax( hFrequency, pOcIccMax );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetIccMaxEpilogue( hFrequency, pOcIccMax );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcGetIccMaxEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyOcGetIccMaxEpilogue( hFrequency, pOcIccMax, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3430,17 +2956,11 @@ namespace validation_layer
         if( nullptr == pfnOcSetIccMax )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetIccMaxPrologue( hFrequency, ocIccMax );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcSetIccMaxPrologue ] ) {
+            auto result = checker->zesFrequencyOcSetIccMaxPrologue( hFrequency, ocIccMax );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetIccMaxPrologue( hFrequency, ocIccMax );
@@ -3449,9 +2969,9 @@ namespace validation_layer
 
         auto result = pfnOcSetIccMax( hFrequency, ocIccMax );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetIccMaxEpilogue( hFrequency, ocIccMax );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcSetIccMaxEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyOcSetIccMaxEpilogue( hFrequency, ocIccMax, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3471,17 +2991,11 @@ namespace validation_layer
         if( nullptr == pfnOcGetTjMax )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetTjMaxPrologue( hFrequency, pOcTjMax );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcGetTjMaxPrologue ] ) {
+            auto result = checker->zesFrequencyOcGetTjMaxPrologue( hFrequency, pOcTjMax );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetTjMaxPrologue( hFrequency, pOcTjMax );
@@ -3490,9 +3004,9 @@ namespace validation_layer
 
         auto result = pfnOcGetTjMax( hFrequency, pOcTjMax );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetTjMaxEpilogue( hFrequency, pOcTjMax );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcGetTjMaxEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyOcGetTjMaxEpilogue( hFrequency, pOcTjMax, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3511,17 +3025,11 @@ namespace validation_layer
         if( nullptr == pfnOcSetTjMax )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetTjMaxPrologue( hFrequency, ocTjMax );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcSetTjMaxPrologue ] ) {
+            auto result = checker->zesFrequencyOcSetTjMaxPrologue( hFrequency, ocTjMax );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetTjMaxPrologue( hFrequency, ocTjMax );
@@ -3530,9 +3038,9 @@ namespace validation_layer
 
         auto result = pfnOcSetTjMax( hFrequency, ocTjMax );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetTjMaxEpilogue( hFrequency, ocTjMax );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFrequencyOcSetTjMaxEpilogue ] ) {
+            auto epilogueResult = checker->zesFrequencyOcSetTjMaxEpilogue( hFrequency, ocTjMax, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3561,17 +3069,11 @@ namespace validation_layer
         if( nullptr == pfnEnumLeds )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumLedsPrologue( hDevice, pCount, phLed );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumLedsPrologue ] ) {
+            auto result = checker->zesDeviceEnumLedsPrologue( hDevice, pCount, phLed );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumLedsPrologue( hDevice, pCount, phLed );
@@ -3580,9 +3082,9 @@ namespace validation_layer
 
         auto result = pfnEnumLeds( hDevice, pCount, phLed );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumLedsEpilogue( hDevice, pCount, phLed );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumLedsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumLedsEpilogue( hDevice, pCount, phLed, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3601,17 +3103,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedGetPropertiesPrologue( hLed, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesLedGetPropertiesPrologue ] ) {
+            auto result = checker->zesLedGetPropertiesPrologue( hLed, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesLedGetPropertiesPrologue( hLed, pProperties );
@@ -3620,9 +3116,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hLed, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedGetPropertiesEpilogue( hLed, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesLedGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesLedGetPropertiesEpilogue( hLed, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3641,17 +3137,11 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedGetStatePrologue( hLed, pState );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesLedGetStatePrologue ] ) {
+            auto result = checker->zesLedGetStatePrologue( hLed, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesLedGetStatePrologue( hLed, pState );
@@ -3660,9 +3150,9 @@ namespace validation_layer
 
         auto result = pfnGetState( hLed, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedGetStateEpilogue( hLed, pState );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesLedGetStateEpilogue ] ) {
+            auto epilogueResult = checker->zesLedGetStateEpilogue( hLed, pState, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3681,17 +3171,11 @@ namespace validation_layer
         if( nullptr == pfnSetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedSetStatePrologue( hLed, enable );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesLedSetStatePrologue ] ) {
+            auto result = checker->zesLedSetStatePrologue( hLed, enable );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesLedSetStatePrologue( hLed, enable );
@@ -3700,9 +3184,9 @@ namespace validation_layer
 
         auto result = pfnSetState( hLed, enable );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedSetStateEpilogue( hLed, enable );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesLedSetStateEpilogue ] ) {
+            auto epilogueResult = checker->zesLedSetStateEpilogue( hLed, enable, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3721,17 +3205,11 @@ namespace validation_layer
         if( nullptr == pfnSetColor )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedSetColorPrologue( hLed, pColor );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesLedSetColorPrologue ] ) {
+            auto result = checker->zesLedSetColorPrologue( hLed, pColor );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesLedSetColorPrologue( hLed, pColor );
@@ -3740,9 +3218,9 @@ namespace validation_layer
 
         auto result = pfnSetColor( hLed, pColor );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesLedSetColorEpilogue( hLed, pColor );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesLedSetColorEpilogue ] ) {
+            auto epilogueResult = checker->zesLedSetColorEpilogue( hLed, pColor, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3771,17 +3249,11 @@ namespace validation_layer
         if( nullptr == pfnEnumMemoryModules )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumMemoryModulesPrologue( hDevice, pCount, phMemory );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumMemoryModulesPrologue ] ) {
+            auto result = checker->zesDeviceEnumMemoryModulesPrologue( hDevice, pCount, phMemory );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumMemoryModulesPrologue( hDevice, pCount, phMemory );
@@ -3790,9 +3262,9 @@ namespace validation_layer
 
         auto result = pfnEnumMemoryModules( hDevice, pCount, phMemory );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumMemoryModulesEpilogue( hDevice, pCount, phMemory );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumMemoryModulesEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumMemoryModulesEpilogue( hDevice, pCount, phMemory, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3811,17 +3283,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetPropertiesPrologue( hMemory, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesMemoryGetPropertiesPrologue ] ) {
+            auto result = checker->zesMemoryGetPropertiesPrologue( hMemory, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesMemoryGetPropertiesPrologue( hMemory, pProperties );
@@ -3830,9 +3296,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hMemory, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetPropertiesEpilogue( hMemory, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesMemoryGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesMemoryGetPropertiesEpilogue( hMemory, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3851,17 +3317,11 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetStatePrologue( hMemory, pState );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesMemoryGetStatePrologue ] ) {
+            auto result = checker->zesMemoryGetStatePrologue( hMemory, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesMemoryGetStatePrologue( hMemory, pState );
@@ -3870,9 +3330,9 @@ namespace validation_layer
 
         auto result = pfnGetState( hMemory, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetStateEpilogue( hMemory, pState );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesMemoryGetStateEpilogue ] ) {
+            auto epilogueResult = checker->zesMemoryGetStateEpilogue( hMemory, pState, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3892,17 +3352,11 @@ namespace validation_layer
         if( nullptr == pfnGetBandwidth )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetBandwidthPrologue( hMemory, pBandwidth );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesMemoryGetBandwidthPrologue ] ) {
+            auto result = checker->zesMemoryGetBandwidthPrologue( hMemory, pBandwidth );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesMemoryGetBandwidthPrologue( hMemory, pBandwidth );
@@ -3911,9 +3365,9 @@ namespace validation_layer
 
         auto result = pfnGetBandwidth( hMemory, pBandwidth );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetBandwidthEpilogue( hMemory, pBandwidth );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesMemoryGetBandwidthEpilogue ] ) {
+            auto epilogueResult = checker->zesMemoryGetBandwidthEpilogue( hMemory, pBandwidth, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3942,17 +3396,11 @@ namespace validation_layer
         if( nullptr == pfnEnumPerformanceFactorDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPerformanceFactorDomainsPrologue( hDevice, pCount, phPerf );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumPerformanceFactorDomainsPrologue ] ) {
+            auto result = checker->zesDeviceEnumPerformanceFactorDomainsPrologue( hDevice, pCount, phPerf );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPerformanceFactorDomainsPrologue( hDevice, pCount, phPerf );
@@ -3961,9 +3409,9 @@ namespace validation_layer
 
         auto result = pfnEnumPerformanceFactorDomains( hDevice, pCount, phPerf );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPerformanceFactorDomainsEpilogue( hDevice, pCount, phPerf );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumPerformanceFactorDomainsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumPerformanceFactorDomainsEpilogue( hDevice, pCount, phPerf, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3983,17 +3431,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorGetPropertiesPrologue( hPerf, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPerformanceFactorGetPropertiesPrologue ] ) {
+            auto result = checker->zesPerformanceFactorGetPropertiesPrologue( hPerf, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorGetPropertiesPrologue( hPerf, pProperties );
@@ -4002,9 +3444,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hPerf, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorGetPropertiesEpilogue( hPerf, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPerformanceFactorGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesPerformanceFactorGetPropertiesEpilogue( hPerf, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4024,17 +3466,11 @@ namespace validation_layer
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorGetConfigPrologue( hPerf, pFactor );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPerformanceFactorGetConfigPrologue ] ) {
+            auto result = checker->zesPerformanceFactorGetConfigPrologue( hPerf, pFactor );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorGetConfigPrologue( hPerf, pFactor );
@@ -4043,9 +3479,9 @@ namespace validation_layer
 
         auto result = pfnGetConfig( hPerf, pFactor );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorGetConfigEpilogue( hPerf, pFactor );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPerformanceFactorGetConfigEpilogue ] ) {
+            auto epilogueResult = checker->zesPerformanceFactorGetConfigEpilogue( hPerf, pFactor, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4064,17 +3500,11 @@ namespace validation_layer
         if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorSetConfigPrologue( hPerf, factor );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPerformanceFactorSetConfigPrologue ] ) {
+            auto result = checker->zesPerformanceFactorSetConfigPrologue( hPerf, factor );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorSetConfigPrologue( hPerf, factor );
@@ -4083,9 +3513,9 @@ namespace validation_layer
 
         auto result = pfnSetConfig( hPerf, factor );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorSetConfigEpilogue( hPerf, factor );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPerformanceFactorSetConfigEpilogue ] ) {
+            auto epilogueResult = checker->zesPerformanceFactorSetConfigEpilogue( hPerf, factor, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4114,17 +3544,11 @@ namespace validation_layer
         if( nullptr == pfnEnumPowerDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPowerDomainsPrologue( hDevice, pCount, phPower );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumPowerDomainsPrologue ] ) {
+            auto result = checker->zesDeviceEnumPowerDomainsPrologue( hDevice, pCount, phPower );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPowerDomainsPrologue( hDevice, pCount, phPower );
@@ -4133,9 +3557,9 @@ namespace validation_layer
 
         auto result = pfnEnumPowerDomains( hDevice, pCount, phPower );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPowerDomainsEpilogue( hDevice, pCount, phPower );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumPowerDomainsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumPowerDomainsEpilogue( hDevice, pCount, phPower, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4154,17 +3578,11 @@ namespace validation_layer
         if( nullptr == pfnGetCardPowerDomain )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetCardPowerDomainPrologue( hDevice, phPower );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetCardPowerDomainPrologue ] ) {
+            auto result = checker->zesDeviceGetCardPowerDomainPrologue( hDevice, phPower );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetCardPowerDomainPrologue( hDevice, phPower );
@@ -4173,9 +3591,9 @@ namespace validation_layer
 
         auto result = pfnGetCardPowerDomain( hDevice, phPower );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetCardPowerDomainEpilogue( hDevice, phPower );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetCardPowerDomainEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceGetCardPowerDomainEpilogue( hDevice, phPower, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4194,17 +3612,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetPropertiesPrologue( hPower, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerGetPropertiesPrologue ] ) {
+            auto result = checker->zesPowerGetPropertiesPrologue( hPower, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetPropertiesPrologue( hPower, pProperties );
@@ -4213,9 +3625,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hPower, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetPropertiesEpilogue( hPower, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesPowerGetPropertiesEpilogue( hPower, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4235,17 +3647,11 @@ namespace validation_layer
         if( nullptr == pfnGetEnergyCounter )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetEnergyCounterPrologue( hPower, pEnergy );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerGetEnergyCounterPrologue ] ) {
+            auto result = checker->zesPowerGetEnergyCounterPrologue( hPower, pEnergy );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetEnergyCounterPrologue( hPower, pEnergy );
@@ -4254,9 +3660,9 @@ namespace validation_layer
 
         auto result = pfnGetEnergyCounter( hPower, pEnergy );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetEnergyCounterEpilogue( hPower, pEnergy );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerGetEnergyCounterEpilogue ] ) {
+            auto epilogueResult = checker->zesPowerGetEnergyCounterEpilogue( hPower, pEnergy, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4280,17 +3686,11 @@ namespace validation_layer
         if( nullptr == pfnGetLimits )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerGetLimitsPrologue ] ) {
+            auto result = checker->zesPowerGetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
@@ -4299,9 +3699,9 @@ namespace validation_layer
 
         auto result = pfnGetLimits( hPower, pSustained, pBurst, pPeak );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsEpilogue( hPower, pSustained, pBurst, pPeak );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerGetLimitsEpilogue ] ) {
+            auto epilogueResult = checker->zesPowerGetLimitsEpilogue( hPower, pSustained, pBurst, pPeak, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4325,17 +3725,11 @@ namespace validation_layer
         if( nullptr == pfnSetLimits )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerSetLimitsPrologue ] ) {
+            auto result = checker->zesPowerSetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
@@ -4344,9 +3738,9 @@ namespace validation_layer
 
         auto result = pfnSetLimits( hPower, pSustained, pBurst, pPeak );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsEpilogue( hPower, pSustained, pBurst, pPeak );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerSetLimitsEpilogue ] ) {
+            auto epilogueResult = checker->zesPowerSetLimitsEpilogue( hPower, pSustained, pBurst, pPeak, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4366,17 +3760,11 @@ namespace validation_layer
         if( nullptr == pfnGetEnergyThreshold )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetEnergyThresholdPrologue( hPower, pThreshold );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerGetEnergyThresholdPrologue ] ) {
+            auto result = checker->zesPowerGetEnergyThresholdPrologue( hPower, pThreshold );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetEnergyThresholdPrologue( hPower, pThreshold );
@@ -4385,9 +3773,9 @@ namespace validation_layer
 
         auto result = pfnGetEnergyThreshold( hPower, pThreshold );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetEnergyThresholdEpilogue( hPower, pThreshold );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerGetEnergyThresholdEpilogue ] ) {
+            auto epilogueResult = checker->zesPowerGetEnergyThresholdEpilogue( hPower, pThreshold, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4406,17 +3794,11 @@ namespace validation_layer
         if( nullptr == pfnSetEnergyThreshold )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetEnergyThresholdPrologue( hPower, threshold );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerSetEnergyThresholdPrologue ] ) {
+            auto result = checker->zesPowerSetEnergyThresholdPrologue( hPower, threshold );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetEnergyThresholdPrologue( hPower, threshold );
@@ -4425,9 +3807,9 @@ namespace validation_layer
 
         auto result = pfnSetEnergyThreshold( hPower, threshold );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetEnergyThresholdEpilogue( hPower, threshold );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerSetEnergyThresholdEpilogue ] ) {
+            auto epilogueResult = checker->zesPowerSetEnergyThresholdEpilogue( hPower, threshold, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4456,17 +3838,11 @@ namespace validation_layer
         if( nullptr == pfnEnumPsus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPsusPrologue( hDevice, pCount, phPsu );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumPsusPrologue ] ) {
+            auto result = checker->zesDeviceEnumPsusPrologue( hDevice, pCount, phPsu );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPsusPrologue( hDevice, pCount, phPsu );
@@ -4475,9 +3851,9 @@ namespace validation_layer
 
         auto result = pfnEnumPsus( hDevice, pCount, phPsu );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPsusEpilogue( hDevice, pCount, phPsu );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumPsusEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumPsusEpilogue( hDevice, pCount, phPsu, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4496,17 +3872,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPsuGetPropertiesPrologue( hPsu, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPsuGetPropertiesPrologue ] ) {
+            auto result = checker->zesPsuGetPropertiesPrologue( hPsu, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPsuGetPropertiesPrologue( hPsu, pProperties );
@@ -4515,9 +3885,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hPsu, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPsuGetPropertiesEpilogue( hPsu, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPsuGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesPsuGetPropertiesEpilogue( hPsu, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4536,17 +3906,11 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPsuGetStatePrologue( hPsu, pState );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPsuGetStatePrologue ] ) {
+            auto result = checker->zesPsuGetStatePrologue( hPsu, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPsuGetStatePrologue( hPsu, pState );
@@ -4555,9 +3919,9 @@ namespace validation_layer
 
         auto result = pfnGetState( hPsu, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPsuGetStateEpilogue( hPsu, pState );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPsuGetStateEpilogue ] ) {
+            auto epilogueResult = checker->zesPsuGetStateEpilogue( hPsu, pState, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4586,17 +3950,11 @@ namespace validation_layer
         if( nullptr == pfnEnumRasErrorSets )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumRasErrorSetsPrologue( hDevice, pCount, phRas );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumRasErrorSetsPrologue ] ) {
+            auto result = checker->zesDeviceEnumRasErrorSetsPrologue( hDevice, pCount, phRas );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumRasErrorSetsPrologue( hDevice, pCount, phRas );
@@ -4605,9 +3963,9 @@ namespace validation_layer
 
         auto result = pfnEnumRasErrorSets( hDevice, pCount, phRas );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumRasErrorSetsEpilogue( hDevice, pCount, phRas );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumRasErrorSetsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumRasErrorSetsEpilogue( hDevice, pCount, phRas, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4626,17 +3984,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetPropertiesPrologue( hRas, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesRasGetPropertiesPrologue ] ) {
+            auto result = checker->zesRasGetPropertiesPrologue( hRas, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetPropertiesPrologue( hRas, pProperties );
@@ -4645,9 +3997,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hRas, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetPropertiesEpilogue( hRas, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesRasGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesRasGetPropertiesEpilogue( hRas, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4667,17 +4019,11 @@ namespace validation_layer
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetConfigPrologue( hRas, pConfig );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesRasGetConfigPrologue ] ) {
+            auto result = checker->zesRasGetConfigPrologue( hRas, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetConfigPrologue( hRas, pConfig );
@@ -4686,9 +4032,9 @@ namespace validation_layer
 
         auto result = pfnGetConfig( hRas, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetConfigEpilogue( hRas, pConfig );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesRasGetConfigEpilogue ] ) {
+            auto epilogueResult = checker->zesRasGetConfigEpilogue( hRas, pConfig, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4707,17 +4053,11 @@ namespace validation_layer
         if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasSetConfigPrologue( hRas, pConfig );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesRasSetConfigPrologue ] ) {
+            auto result = checker->zesRasSetConfigPrologue( hRas, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasSetConfigPrologue( hRas, pConfig );
@@ -4726,9 +4066,9 @@ namespace validation_layer
 
         auto result = pfnSetConfig( hRas, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasSetConfigEpilogue( hRas, pConfig );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesRasSetConfigEpilogue ] ) {
+            auto epilogueResult = checker->zesRasSetConfigEpilogue( hRas, pConfig, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4748,17 +4088,11 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetStatePrologue( hRas, clear, pState );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesRasGetStatePrologue ] ) {
+            auto result = checker->zesRasGetStatePrologue( hRas, clear, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetStatePrologue( hRas, clear, pState );
@@ -4767,9 +4101,9 @@ namespace validation_layer
 
         auto result = pfnGetState( hRas, clear, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetStateEpilogue( hRas, clear, pState );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesRasGetStateEpilogue ] ) {
+            auto epilogueResult = checker->zesRasGetStateEpilogue( hRas, clear, pState, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4798,17 +4132,11 @@ namespace validation_layer
         if( nullptr == pfnEnumSchedulers )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumSchedulersPrologue( hDevice, pCount, phScheduler );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumSchedulersPrologue ] ) {
+            auto result = checker->zesDeviceEnumSchedulersPrologue( hDevice, pCount, phScheduler );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumSchedulersPrologue( hDevice, pCount, phScheduler );
@@ -4817,9 +4145,9 @@ namespace validation_layer
 
         auto result = pfnEnumSchedulers( hDevice, pCount, phScheduler );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumSchedulersEpilogue( hDevice, pCount, phScheduler );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumSchedulersEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumSchedulersEpilogue( hDevice, pCount, phScheduler, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4838,17 +4166,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetPropertiesPrologue( hScheduler, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerGetPropertiesPrologue ] ) {
+            auto result = checker->zesSchedulerGetPropertiesPrologue( hScheduler, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetPropertiesPrologue( hScheduler, pProperties );
@@ -4857,9 +4179,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hScheduler, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetPropertiesEpilogue( hScheduler, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesSchedulerGetPropertiesEpilogue( hScheduler, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4878,17 +4200,11 @@ namespace validation_layer
         if( nullptr == pfnGetCurrentMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetCurrentModePrologue( hScheduler, pMode );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerGetCurrentModePrologue ] ) {
+            auto result = checker->zesSchedulerGetCurrentModePrologue( hScheduler, pMode );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetCurrentModePrologue( hScheduler, pMode );
@@ -4897,9 +4213,9 @@ namespace validation_layer
 
         auto result = pfnGetCurrentMode( hScheduler, pMode );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetCurrentModeEpilogue( hScheduler, pMode );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerGetCurrentModeEpilogue ] ) {
+            auto epilogueResult = checker->zesSchedulerGetCurrentModeEpilogue( hScheduler, pMode, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4920,17 +4236,11 @@ namespace validation_layer
         if( nullptr == pfnGetTimeoutModeProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetTimeoutModePropertiesPrologue( hScheduler, getDefaults, pConfig );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerGetTimeoutModePropertiesPrologue ] ) {
+            auto result = checker->zesSchedulerGetTimeoutModePropertiesPrologue( hScheduler, getDefaults, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetTimeoutModePropertiesPrologue( hScheduler, getDefaults, pConfig );
@@ -4939,9 +4249,9 @@ namespace validation_layer
 
         auto result = pfnGetTimeoutModeProperties( hScheduler, getDefaults, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetTimeoutModePropertiesEpilogue( hScheduler, getDefaults, pConfig );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerGetTimeoutModePropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesSchedulerGetTimeoutModePropertiesEpilogue( hScheduler, getDefaults, pConfig, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -4962,17 +4272,11 @@ namespace validation_layer
         if( nullptr == pfnGetTimesliceModeProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetTimesliceModePropertiesPrologue( hScheduler, getDefaults, pConfig );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerGetTimesliceModePropertiesPrologue ] ) {
+            auto result = checker->zesSchedulerGetTimesliceModePropertiesPrologue( hScheduler, getDefaults, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetTimesliceModePropertiesPrologue( hScheduler, getDefaults, pConfig );
@@ -4981,9 +4285,9 @@ namespace validation_layer
 
         auto result = pfnGetTimesliceModeProperties( hScheduler, getDefaults, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetTimesliceModePropertiesEpilogue( hScheduler, getDefaults, pConfig );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerGetTimesliceModePropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesSchedulerGetTimesliceModePropertiesEpilogue( hScheduler, getDefaults, pConfig, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5004,17 +4308,11 @@ namespace validation_layer
         if( nullptr == pfnSetTimeoutMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetTimeoutModePrologue( hScheduler, pProperties, pNeedReload );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerSetTimeoutModePrologue ] ) {
+            auto result = checker->zesSchedulerSetTimeoutModePrologue( hScheduler, pProperties, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetTimeoutModePrologue( hScheduler, pProperties, pNeedReload );
@@ -5023,9 +4321,9 @@ namespace validation_layer
 
         auto result = pfnSetTimeoutMode( hScheduler, pProperties, pNeedReload );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetTimeoutModeEpilogue( hScheduler, pProperties, pNeedReload );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerSetTimeoutModeEpilogue ] ) {
+            auto epilogueResult = checker->zesSchedulerSetTimeoutModeEpilogue( hScheduler, pProperties, pNeedReload, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5046,17 +4344,11 @@ namespace validation_layer
         if( nullptr == pfnSetTimesliceMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetTimesliceModePrologue( hScheduler, pProperties, pNeedReload );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerSetTimesliceModePrologue ] ) {
+            auto result = checker->zesSchedulerSetTimesliceModePrologue( hScheduler, pProperties, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetTimesliceModePrologue( hScheduler, pProperties, pNeedReload );
@@ -5065,9 +4357,9 @@ namespace validation_layer
 
         auto result = pfnSetTimesliceMode( hScheduler, pProperties, pNeedReload );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetTimesliceModeEpilogue( hScheduler, pProperties, pNeedReload );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerSetTimesliceModeEpilogue ] ) {
+            auto epilogueResult = checker->zesSchedulerSetTimesliceModeEpilogue( hScheduler, pProperties, pNeedReload, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5087,17 +4379,11 @@ namespace validation_layer
         if( nullptr == pfnSetExclusiveMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetExclusiveModePrologue( hScheduler, pNeedReload );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerSetExclusiveModePrologue ] ) {
+            auto result = checker->zesSchedulerSetExclusiveModePrologue( hScheduler, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetExclusiveModePrologue( hScheduler, pNeedReload );
@@ -5106,9 +4392,9 @@ namespace validation_layer
 
         auto result = pfnSetExclusiveMode( hScheduler, pNeedReload );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetExclusiveModeEpilogue( hScheduler, pNeedReload );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerSetExclusiveModeEpilogue ] ) {
+            auto epilogueResult = checker->zesSchedulerSetExclusiveModeEpilogue( hScheduler, pNeedReload, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5128,17 +4414,11 @@ namespace validation_layer
         if( nullptr == pfnSetComputeUnitDebugMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetComputeUnitDebugModePrologue( hScheduler, pNeedReload );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerSetComputeUnitDebugModePrologue ] ) {
+            auto result = checker->zesSchedulerSetComputeUnitDebugModePrologue( hScheduler, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetComputeUnitDebugModePrologue( hScheduler, pNeedReload );
@@ -5147,9 +4427,9 @@ namespace validation_layer
 
         auto result = pfnSetComputeUnitDebugMode( hScheduler, pNeedReload );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetComputeUnitDebugModeEpilogue( hScheduler, pNeedReload );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesSchedulerSetComputeUnitDebugModeEpilogue ] ) {
+            auto epilogueResult = checker->zesSchedulerSetComputeUnitDebugModeEpilogue( hScheduler, pNeedReload, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5178,17 +4458,11 @@ namespace validation_layer
         if( nullptr == pfnEnumStandbyDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumStandbyDomainsPrologue( hDevice, pCount, phStandby );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumStandbyDomainsPrologue ] ) {
+            auto result = checker->zesDeviceEnumStandbyDomainsPrologue( hDevice, pCount, phStandby );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumStandbyDomainsPrologue( hDevice, pCount, phStandby );
@@ -5197,9 +4471,9 @@ namespace validation_layer
 
         auto result = pfnEnumStandbyDomains( hDevice, pCount, phStandby );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumStandbyDomainsEpilogue( hDevice, pCount, phStandby );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumStandbyDomainsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumStandbyDomainsEpilogue( hDevice, pCount, phStandby, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5218,17 +4492,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesStandbyGetPropertiesPrologue( hStandby, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesStandbyGetPropertiesPrologue ] ) {
+            auto result = checker->zesStandbyGetPropertiesPrologue( hStandby, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesStandbyGetPropertiesPrologue( hStandby, pProperties );
@@ -5237,9 +4505,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hStandby, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesStandbyGetPropertiesEpilogue( hStandby, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesStandbyGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesStandbyGetPropertiesEpilogue( hStandby, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5258,17 +4526,11 @@ namespace validation_layer
         if( nullptr == pfnGetMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesStandbyGetModePrologue( hStandby, pMode );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesStandbyGetModePrologue ] ) {
+            auto result = checker->zesStandbyGetModePrologue( hStandby, pMode );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesStandbyGetModePrologue( hStandby, pMode );
@@ -5277,9 +4539,9 @@ namespace validation_layer
 
         auto result = pfnGetMode( hStandby, pMode );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesStandbyGetModeEpilogue( hStandby, pMode );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesStandbyGetModeEpilogue ] ) {
+            auto epilogueResult = checker->zesStandbyGetModeEpilogue( hStandby, pMode, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5298,17 +4560,11 @@ namespace validation_layer
         if( nullptr == pfnSetMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesStandbySetModePrologue( hStandby, mode );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesStandbySetModePrologue ] ) {
+            auto result = checker->zesStandbySetModePrologue( hStandby, mode );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesStandbySetModePrologue( hStandby, mode );
@@ -5317,9 +4573,9 @@ namespace validation_layer
 
         auto result = pfnSetMode( hStandby, mode );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesStandbySetModeEpilogue( hStandby, mode );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesStandbySetModeEpilogue ] ) {
+            auto epilogueResult = checker->zesStandbySetModeEpilogue( hStandby, mode, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5348,17 +4604,11 @@ namespace validation_layer
         if( nullptr == pfnEnumTemperatureSensors )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumTemperatureSensorsPrologue( hDevice, pCount, phTemperature );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumTemperatureSensorsPrologue ] ) {
+            auto result = checker->zesDeviceEnumTemperatureSensorsPrologue( hDevice, pCount, phTemperature );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumTemperatureSensorsPrologue( hDevice, pCount, phTemperature );
@@ -5367,9 +4617,9 @@ namespace validation_layer
 
         auto result = pfnEnumTemperatureSensors( hDevice, pCount, phTemperature );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumTemperatureSensorsEpilogue( hDevice, pCount, phTemperature );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumTemperatureSensorsEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumTemperatureSensorsEpilogue( hDevice, pCount, phTemperature, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5388,17 +4638,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetPropertiesPrologue( hTemperature, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesTemperatureGetPropertiesPrologue ] ) {
+            auto result = checker->zesTemperatureGetPropertiesPrologue( hTemperature, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureGetPropertiesPrologue( hTemperature, pProperties );
@@ -5407,9 +4651,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hTemperature, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetPropertiesEpilogue( hTemperature, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesTemperatureGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zesTemperatureGetPropertiesEpilogue( hTemperature, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5428,17 +4672,11 @@ namespace validation_layer
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetConfigPrologue( hTemperature, pConfig );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesTemperatureGetConfigPrologue ] ) {
+            auto result = checker->zesTemperatureGetConfigPrologue( hTemperature, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureGetConfigPrologue( hTemperature, pConfig );
@@ -5447,9 +4685,9 @@ namespace validation_layer
 
         auto result = pfnGetConfig( hTemperature, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetConfigEpilogue( hTemperature, pConfig );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesTemperatureGetConfigEpilogue ] ) {
+            auto epilogueResult = checker->zesTemperatureGetConfigEpilogue( hTemperature, pConfig, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5468,17 +4706,11 @@ namespace validation_layer
         if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureSetConfigPrologue( hTemperature, pConfig );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesTemperatureSetConfigPrologue ] ) {
+            auto result = checker->zesTemperatureSetConfigPrologue( hTemperature, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureSetConfigPrologue( hTemperature, pConfig );
@@ -5487,9 +4719,9 @@ namespace validation_layer
 
         auto result = pfnSetConfig( hTemperature, pConfig );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureSetConfigEpilogue( hTemperature, pConfig );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesTemperatureSetConfigEpilogue ] ) {
+            auto epilogueResult = checker->zesTemperatureSetConfigEpilogue( hTemperature, pConfig, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5509,17 +4741,11 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetStatePrologue( hTemperature, pTemperature );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesTemperatureGetStatePrologue ] ) {
+            auto result = checker->zesTemperatureGetStatePrologue( hTemperature, pTemperature );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureGetStatePrologue( hTemperature, pTemperature );
@@ -5528,9 +4754,9 @@ namespace validation_layer
 
         auto result = pfnGetState( hTemperature, pTemperature );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetStateEpilogue( hTemperature, pTemperature );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesTemperatureGetStateEpilogue ] ) {
+            auto epilogueResult = checker->zesTemperatureGetStateEpilogue( hTemperature, pTemperature, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5557,17 +4783,11 @@ namespace validation_layer
         if( nullptr == pfnGetLimitsExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsExtPrologue( hPower, pCount, pSustained );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerGetLimitsExtPrologue ] ) {
+            auto result = checker->zesPowerGetLimitsExtPrologue( hPower, pCount, pSustained );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetLimitsExtPrologue( hPower, pCount, pSustained );
@@ -5576,9 +4796,9 @@ namespace validation_layer
 
         auto result = pfnGetLimitsExt( hPower, pCount, pSustained );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsExtEpilogue( hPower, pCount, pSustained );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerGetLimitsExtEpilogue ] ) {
+            auto epilogueResult = checker->zesPowerGetLimitsExtEpilogue( hPower, pCount, pSustained, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5598,17 +4818,11 @@ namespace validation_layer
         if( nullptr == pfnSetLimitsExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsExtPrologue( hPower, pCount, pSustained );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerSetLimitsExtPrologue ] ) {
+            auto result = checker->zesPowerSetLimitsExtPrologue( hPower, pCount, pSustained );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetLimitsExtPrologue( hPower, pCount, pSustained );
@@ -5617,9 +4831,9 @@ namespace validation_layer
 
         auto result = pfnSetLimitsExt( hPower, pCount, pSustained );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsExtEpilogue( hPower, pCount, pSustained );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesPowerSetLimitsExtEpilogue ] ) {
+            auto epilogueResult = checker->zesPowerSetLimitsExtEpilogue( hPower, pCount, pSustained, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5651,17 +4865,11 @@ namespace validation_layer
         if( nullptr == pfnGetActivityExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesEngineGetActivityExtPrologue( hEngine, pCount, pStats );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesEngineGetActivityExtPrologue ] ) {
+            auto result = checker->zesEngineGetActivityExtPrologue( hEngine, pCount, pStats );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesEngineGetActivityExtPrologue( hEngine, pCount, pStats );
@@ -5670,9 +4878,9 @@ namespace validation_layer
 
         auto result = pfnGetActivityExt( hEngine, pCount, pStats );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesEngineGetActivityExtEpilogue( hEngine, pCount, pStats );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesEngineGetActivityExtEpilogue ] ) {
+            auto epilogueResult = checker->zesEngineGetActivityExtEpilogue( hEngine, pCount, pStats, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5699,17 +4907,11 @@ namespace validation_layer
         if( nullptr == pfnGetStateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetStateExpPrologue( hRas, pCount, pState );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesRasGetStateExpPrologue ] ) {
+            auto result = checker->zesRasGetStateExpPrologue( hRas, pCount, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetStateExpPrologue( hRas, pCount, pState );
@@ -5718,9 +4920,9 @@ namespace validation_layer
 
         auto result = pfnGetStateExp( hRas, pCount, pState );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasGetStateExpEpilogue( hRas, pCount, pState );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesRasGetStateExpEpilogue ] ) {
+            auto epilogueResult = checker->zesRasGetStateExpEpilogue( hRas, pCount, pState, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -5743,17 +4945,11 @@ namespace validation_layer
         if( nullptr == pfnClearStateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasClearStateExpPrologue( hRas, category );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesRasClearStateExpPrologue ] ) {
+            auto result = checker->zesRasClearStateExpPrologue( hRas, category );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasClearStateExpPrologue( hRas, category );
@@ -5762,9 +4958,9 @@ namespace validation_layer
 
         auto result = pfnClearStateExp( hRas, category );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesRasClearStateExpEpilogue( hRas, category );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesRasClearStateExpEpilogue ] ) {
+            auto epilogueResult = checker->zesRasClearStateExpEpilogue( hRas, category, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5784,17 +4980,11 @@ namespace validation_layer
         if( nullptr == pfnGetSecurityVersionExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetSecurityVersionExpPrologue( hFirmware, pVersion );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFirmwareGetSecurityVersionExpPrologue ] ) {
+            auto result = checker->zesFirmwareGetSecurityVersionExpPrologue( hFirmware, pVersion );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetSecurityVersionExpPrologue( hFirmware, pVersion );
@@ -5803,9 +4993,9 @@ namespace validation_layer
 
         auto result = pfnGetSecurityVersionExp( hFirmware, pVersion );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetSecurityVersionExpEpilogue( hFirmware, pVersion );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFirmwareGetSecurityVersionExpEpilogue ] ) {
+            auto epilogueResult = checker->zesFirmwareGetSecurityVersionExpEpilogue( hFirmware, pVersion, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -5827,17 +5017,11 @@ namespace validation_layer
         if( nullptr == pfnSetSecurityVersionExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareSetSecurityVersionExpPrologue( hFirmware );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFirmwareSetSecurityVersionExpPrologue ] ) {
+            auto result = checker->zesFirmwareSetSecurityVersionExpPrologue( hFirmware );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareSetSecurityVersionExpPrologue( hFirmware );
@@ -5846,9 +5030,9 @@ namespace validation_layer
 
         auto result = pfnSetSecurityVersionExp( hFirmware );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesFirmwareSetSecurityVersionExpEpilogue( hFirmware );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesFirmwareSetSecurityVersionExpEpilogue ] ) {
+            auto epilogueResult = checker->zesFirmwareSetSecurityVersionExpEpilogue( hFirmware, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -5875,17 +5059,11 @@ namespace validation_layer
         if( nullptr == pfnGetSubDevicePropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetSubDevicePropertiesExpPrologue( hDevice, pCount, pSubdeviceProps );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetSubDevicePropertiesExpPrologue ] ) {
+            auto result = checker->zesDeviceGetSubDevicePropertiesExpPrologue( hDevice, pCount, pSubdeviceProps );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetSubDevicePropertiesExpPrologue( hDevice, pCount, pSubdeviceProps );
@@ -5894,9 +5072,9 @@ namespace validation_layer
 
         auto result = pfnGetSubDevicePropertiesExp( hDevice, pCount, pSubdeviceProps );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetSubDevicePropertiesExpEpilogue( hDevice, pCount, pSubdeviceProps );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceGetSubDevicePropertiesExpEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceGetSubDevicePropertiesExpEpilogue( hDevice, pCount, pSubdeviceProps, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -5923,17 +5101,11 @@ namespace validation_layer
         if( nullptr == pfnGetDeviceByUuidExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetDeviceByUuidExpPrologue( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDriverGetDeviceByUuidExpPrologue ] ) {
+            auto result = checker->zesDriverGetDeviceByUuidExpPrologue( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetDeviceByUuidExpPrologue( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
@@ -5942,16 +5114,16 @@ namespace validation_layer
 
         auto result = pfnGetDeviceByUuidExp( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDriverGetDeviceByUuidExpEpilogue( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDriverGetDeviceByUuidExpEpilogue ] ) {
+            auto epilogueResult = checker->zesDriverGetDeviceByUuidExpEpilogue( hDriver, uuid, phDevice, onSubdevice, subdeviceId, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phDevice){
-                context.handleLifetime->addHandle( *phDevice );
+                context.handleLifetime->addHandle( *phDevice, hDriver );
                 context.handleLifetime->addDependent( hDriver, *phDevice );
 
             }
@@ -5982,17 +5154,11 @@ namespace validation_layer
         if( nullptr == pfnEnumActiveVFExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumActiveVFExpPrologue( hDevice, pCount, phVFhandle );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumActiveVFExpPrologue ] ) {
+            auto result = checker->zesDeviceEnumActiveVFExpPrologue( hDevice, pCount, phVFhandle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumActiveVFExpPrologue( hDevice, pCount, phVFhandle );
@@ -6001,9 +5167,9 @@ namespace validation_layer
 
         auto result = pfnEnumActiveVFExp( hDevice, pCount, phVFhandle );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumActiveVFExpEpilogue( hDevice, pCount, phVFhandle );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumActiveVFExpEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumActiveVFExpEpilogue( hDevice, pCount, phVFhandle, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6022,17 +5188,11 @@ namespace validation_layer
         if( nullptr == pfnGetVFPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFPropertiesExpPrologue( hVFhandle, pProperties );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementGetVFPropertiesExpPrologue ] ) {
+            auto result = checker->zesVFManagementGetVFPropertiesExpPrologue( hVFhandle, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFPropertiesExpPrologue( hVFhandle, pProperties );
@@ -6041,9 +5201,9 @@ namespace validation_layer
 
         auto result = pfnGetVFPropertiesExp( hVFhandle, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFPropertiesExpEpilogue( hVFhandle, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementGetVFPropertiesExpEpilogue ] ) {
+            auto epilogueResult = checker->zesVFManagementGetVFPropertiesExpEpilogue( hVFhandle, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -6078,17 +5238,11 @@ namespace validation_layer
         if( nullptr == pfnGetVFMemoryUtilizationExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFMemoryUtilizationExpPrologue( hVFhandle, pCount, pMemUtil );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementGetVFMemoryUtilizationExpPrologue ] ) {
+            auto result = checker->zesVFManagementGetVFMemoryUtilizationExpPrologue( hVFhandle, pCount, pMemUtil );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFMemoryUtilizationExpPrologue( hVFhandle, pCount, pMemUtil );
@@ -6097,9 +5251,9 @@ namespace validation_layer
 
         auto result = pfnGetVFMemoryUtilizationExp( hVFhandle, pCount, pMemUtil );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFMemoryUtilizationExpEpilogue( hVFhandle, pCount, pMemUtil );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementGetVFMemoryUtilizationExpEpilogue ] ) {
+            auto epilogueResult = checker->zesVFManagementGetVFMemoryUtilizationExpEpilogue( hVFhandle, pCount, pMemUtil, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -6134,17 +5288,11 @@ namespace validation_layer
         if( nullptr == pfnGetVFEngineUtilizationExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFEngineUtilizationExpPrologue( hVFhandle, pCount, pEngineUtil );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementGetVFEngineUtilizationExpPrologue ] ) {
+            auto result = checker->zesVFManagementGetVFEngineUtilizationExpPrologue( hVFhandle, pCount, pEngineUtil );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFEngineUtilizationExpPrologue( hVFhandle, pCount, pEngineUtil );
@@ -6153,9 +5301,9 @@ namespace validation_layer
 
         auto result = pfnGetVFEngineUtilizationExp( hVFhandle, pCount, pEngineUtil );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFEngineUtilizationExpEpilogue( hVFhandle, pCount, pEngineUtil );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementGetVFEngineUtilizationExpEpilogue ] ) {
+            auto epilogueResult = checker->zesVFManagementGetVFEngineUtilizationExpEpilogue( hVFhandle, pCount, pEngineUtil, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -6180,17 +5328,11 @@ namespace validation_layer
         if( nullptr == pfnSetVFTelemetryModeExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementSetVFTelemetryModeExpPrologue( hVFhandle, flags, enable );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementSetVFTelemetryModeExpPrologue ] ) {
+            auto result = checker->zesVFManagementSetVFTelemetryModeExpPrologue( hVFhandle, flags, enable );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementSetVFTelemetryModeExpPrologue( hVFhandle, flags, enable );
@@ -6199,9 +5341,9 @@ namespace validation_layer
 
         auto result = pfnSetVFTelemetryModeExp( hVFhandle, flags, enable );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementSetVFTelemetryModeExpEpilogue( hVFhandle, flags, enable );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementSetVFTelemetryModeExpEpilogue ] ) {
+            auto epilogueResult = checker->zesVFManagementSetVFTelemetryModeExpEpilogue( hVFhandle, flags, enable, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6222,17 +5364,11 @@ namespace validation_layer
         if( nullptr == pfnSetVFTelemetrySamplingIntervalExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue( hVFhandle, flag, samplingInterval );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue ] ) {
+            auto result = checker->zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue( hVFhandle, flag, samplingInterval );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue( hVFhandle, flag, samplingInterval );
@@ -6241,9 +5377,9 @@ namespace validation_layer
 
         auto result = pfnSetVFTelemetrySamplingIntervalExp( hVFhandle, flag, samplingInterval );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue( hVFhandle, flag, samplingInterval );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue ] ) {
+            auto epilogueResult = checker->zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue( hVFhandle, flag, samplingInterval, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6272,17 +5408,11 @@ namespace validation_layer
         if( nullptr == pfnEnumEnabledVFExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumEnabledVFExpPrologue( hDevice, pCount, phVFhandle );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumEnabledVFExpPrologue ] ) {
+            auto result = checker->zesDeviceEnumEnabledVFExpPrologue( hDevice, pCount, phVFhandle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumEnabledVFExpPrologue( hDevice, pCount, phVFhandle );
@@ -6291,9 +5421,9 @@ namespace validation_layer
 
         auto result = pfnEnumEnabledVFExp( hDevice, pCount, phVFhandle );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumEnabledVFExpEpilogue( hDevice, pCount, phVFhandle );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesDeviceEnumEnabledVFExpEpilogue ] ) {
+            auto epilogueResult = checker->zesDeviceEnumEnabledVFExpEpilogue( hDevice, pCount, phVFhandle, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6312,17 +5442,11 @@ namespace validation_layer
         if( nullptr == pfnGetVFCapabilitiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFCapabilitiesExpPrologue( hVFhandle, pCapability );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementGetVFCapabilitiesExpPrologue ] ) {
+            auto result = checker->zesVFManagementGetVFCapabilitiesExpPrologue( hVFhandle, pCapability );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFCapabilitiesExpPrologue( hVFhandle, pCapability );
@@ -6331,9 +5455,9 @@ namespace validation_layer
 
         auto result = pfnGetVFCapabilitiesExp( hVFhandle, pCapability );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFCapabilitiesExpEpilogue( hVFhandle, pCapability );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementGetVFCapabilitiesExpEpilogue ] ) {
+            auto epilogueResult = checker->zesVFManagementGetVFCapabilitiesExpEpilogue( hVFhandle, pCapability, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -6366,17 +5490,11 @@ namespace validation_layer
         if( nullptr == pfnGetVFMemoryUtilizationExp2 )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFMemoryUtilizationExp2Prologue( hVFhandle, pCount, pMemUtil );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementGetVFMemoryUtilizationExp2Prologue ] ) {
+            auto result = checker->zesVFManagementGetVFMemoryUtilizationExp2Prologue( hVFhandle, pCount, pMemUtil );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFMemoryUtilizationExp2Prologue( hVFhandle, pCount, pMemUtil );
@@ -6385,9 +5503,9 @@ namespace validation_layer
 
         auto result = pfnGetVFMemoryUtilizationExp2( hVFhandle, pCount, pMemUtil );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFMemoryUtilizationExp2Epilogue( hVFhandle, pCount, pMemUtil );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementGetVFMemoryUtilizationExp2Epilogue ] ) {
+            auto epilogueResult = checker->zesVFManagementGetVFMemoryUtilizationExp2Epilogue( hVFhandle, pCount, pMemUtil, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -6416,17 +5534,11 @@ namespace validation_layer
         if( nullptr == pfnGetVFEngineUtilizationExp2 )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFEngineUtilizationExp2Prologue( hVFhandle, pCount, pEngineUtil );
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementGetVFEngineUtilizationExp2Prologue ] ) {
+            auto result = checker->zesVFManagementGetVFEngineUtilizationExp2Prologue( hVFhandle, pCount, pEngineUtil );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFEngineUtilizationExp2Prologue( hVFhandle, pCount, pEngineUtil );
@@ -6435,9 +5547,9 @@ namespace validation_layer
 
         auto result = pfnGetVFEngineUtilizationExp2( hVFhandle, pCount, pEngineUtil );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFEngineUtilizationExp2Epilogue( hVFhandle, pCount, pEngineUtil );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zesCheckers[ ZESEntryPoint::zesVFManagementGetVFEngineUtilizationExp2Epilogue ] ) {
+            auto epilogueResult = checker->zesVFManagementGetVFEngineUtilizationExp2Epilogue( hVFhandle, pCount, pEngineUtil, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
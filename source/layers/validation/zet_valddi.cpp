@@ -28,17 +28,11 @@ namespace validation_layer
         if( nullptr == pfnGetDebugInfo )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetModuleGetDebugInfoPrologue( hModule, format, pSize, pDebugInfo );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetModuleGetDebugInfoPrologue ] ) {
+            auto result = checker->zetModuleGetDebugInfoPrologue( hModule, format, pSize, pDebugInfo );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetModuleGetDebugInfoPrologue( hModule, format, pSize, pDebugInfo );
@@ -47,9 +41,9 @@ namespace validation_layer
 
         auto result = pfnGetDebugInfo( hModule, format, pSize, pDebugInfo );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetModuleGetDebugInfoEpilogue( hModule, format, pSize, pDebugInfo );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetModuleGetDebugInfoEpilogue ] ) {
+            auto epilogueResult = checker->zetModuleGetDebugInfoEpilogue( hModule, format, pSize, pDebugInfo, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -68,17 +62,11 @@ namespace validation_layer
         if( nullptr == pfnGetDebugProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceGetDebugPropertiesPrologue( hDevice, pDebugProperties );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDeviceGetDebugPropertiesPrologue ] ) {
+            auto result = checker->zetDeviceGetDebugPropertiesPrologue( hDevice, pDebugProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceGetDebugPropertiesPrologue( hDevice, pDebugProperties );
@@ -87,9 +75,9 @@ namespace validation_layer
 
         auto result = pfnGetDebugProperties( hDevice, pDebugProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceGetDebugPropertiesEpilogue( hDevice, pDebugProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDeviceGetDebugPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zetDeviceGetDebugPropertiesEpilogue( hDevice, pDebugProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -109,17 +97,11 @@ namespace validation_layer
         if( nullptr == pfnAttach )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugAttachPrologue( hDevice, config, phDebug );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugAttachPrologue ] ) {
+            auto result = checker->zetDebugAttachPrologue( hDevice, config, phDebug );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugAttachPrologue( hDevice, config, phDebug );
@@ -128,9 +110,9 @@ namespace validation_layer
 
         auto result = pfnAttach( hDevice, config, phDebug );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugAttachEpilogue( hDevice, config, phDebug );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugAttachEpilogue ] ) {
+            auto epilogueResult = checker->zetDebugAttachEpilogue( hDevice, config, phDebug, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -148,17 +130,11 @@ namespace validation_layer
         if( nullptr == pfnDetach )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugDetachPrologue( hDebug );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugDetachPrologue ] ) {
+            auto result = checker->zetDebugDetachPrologue( hDebug );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugDetachPrologue( hDebug );
@@ -167,9 +143,9 @@ namespace validation_layer
 
         auto result = pfnDetach( hDebug );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugDetachEpilogue( hDebug );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugDetachEpilogue ] ) {
+            auto epilogueResult = checker->zetDebugDetachEpilogue( hDebug, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -195,17 +171,11 @@ namespace validation_layer
         if( nullptr == pfnReadEvent )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugReadEventPrologue( hDebug, timeout, event );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugReadEventPrologue ] ) {
+            auto result = checker->zetDebugReadEventPrologue( hDebug, timeout, event );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugReadEventPrologue( hDebug, timeout, event );
@@ -214,9 +184,9 @@ namespace validation_layer
 
         auto result = pfnReadEvent( hDebug, timeout, event );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugReadEventEpilogue( hDebug, timeout, event );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugReadEventEpilogue ] ) {
+            auto epilogueResult = checker->zetDebugReadEventEpilogue( hDebug, timeout, event, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -235,17 +205,11 @@ namespace validation_layer
         if( nullptr == pfnAcknowledgeEvent )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugAcknowledgeEventPrologue( hDebug, event );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugAcknowledgeEventPrologue ] ) {
+            auto result = checker->zetDebugAcknowledgeEventPrologue( hDebug, event );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugAcknowledgeEventPrologue( hDebug, event );
@@ -254,9 +218,9 @@ namespace validation_layer
 
         auto result = pfnAcknowledgeEvent( hDebug, event );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugAcknowledgeEventEpilogue( hDebug, event );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugAcknowledgeEventEpilogue ] ) {
+            auto epilogueResult = checker->zetDebugAcknowledgeEventEpilogue( hDebug, event, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -275,17 +239,11 @@ namespace validation_layer
         if( nullptr == pfnInterrupt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugInterruptPrologue( hDebug, thread );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugInterruptPrologue ] ) {
+            auto result = checker->zetDebugInterruptPrologue( hDebug, thread );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugInterruptPrologue( hDebug, thread );
@@ -294,9 +252,9 @@ namespace validation_layer
 
         auto result = pfnInterrupt( hDebug, thread );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugInterruptEpilogue( hDebug, thread );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugInterruptEpilogue ] ) {
+            auto epilogueResult = checker->zetDebugInterruptEpilogue( hDebug, thread, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -315,17 +273,11 @@ namespace validation_layer
         if( nullptr == pfnResume )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugResumePrologue( hDebug, thread );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugResumePrologue ] ) {
+            auto result = checker->zetDebugResumePrologue( hDebug, thread );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugResumePrologue( hDebug, thread );
@@ -334,9 +286,9 @@ namespace validation_layer
 
         auto result = pfnResume( hDebug, thread );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugResumeEpilogue( hDebug, thread );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugResumeEpilogue ] ) {
+            auto epilogueResult = checker->zetDebugResumeEpilogue( hDebug, thread, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -358,17 +310,11 @@ namespace validation_layer
         if( nullptr == pfnReadMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugReadMemoryPrologue( hDebug, thread, desc, size, buffer );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugReadMemoryPrologue ] ) {
+            auto result = checker->zetDebugReadMemoryPrologue( hDebug, thread, desc, size, buffer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugReadMemoryPrologue( hDebug, thread, desc, size, buffer );
@@ -377,9 +323,9 @@ namespace validation_layer
 
         auto result = pfnReadMemory( hDebug, thread, desc, size, buffer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugReadMemoryEpilogue( hDebug, thread, desc, size, buffer );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugReadMemoryEpilogue ] ) {
+            auto epilogueResult = checker->zetDebugReadMemoryEpilogue( hDebug, thread, desc, size, buffer, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -401,17 +347,11 @@ namespace validation_layer
         if( nullptr == pfnWriteMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugWriteMemoryPrologue( hDebug, thread, desc, size, buffer );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugWriteMemoryPrologue ] ) {
+            auto result = checker->zetDebugWriteMemoryPrologue( hDebug, thread, desc, size, buffer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugWriteMemoryPrologue( hDebug, thread, desc, size, buffer );
@@ -420,9 +360,9 @@ namespace validation_layer
 
         auto result = pfnWriteMemory( hDebug, thread, desc, size, buffer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugWriteMemoryEpilogue( hDebug, thread, desc, size, buffer );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugWriteMemoryEpilogue ] ) {
+            auto epilogueResult = checker->zetDebugWriteMemoryEpilogue( hDebug, thread, desc, size, buffer, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -450,17 +390,11 @@ namespace validation_layer
         if( nullptr == pfnGetRegisterSetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugGetRegisterSetPropertiesPrologue( hDevice, pCount, pRegisterSetProperties );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugGetRegisterSetPropertiesPrologue ] ) {
+            auto result = checker->zetDebugGetRegisterSetPropertiesPrologue( hDevice, pCount, pRegisterSetProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugGetRegisterSetPropertiesPrologue( hDevice, pCount, pRegisterSetProperties );
@@ -469,9 +403,9 @@ namespace validation_layer
 
         auto result = pfnGetRegisterSetProperties( hDevice, pCount, pRegisterSetProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugGetRegisterSetPropertiesEpilogue( hDevice, pCount, pRegisterSetProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugGetRegisterSetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zetDebugGetRegisterSetPropertiesEpilogue( hDevice, pCount, pRegisterSetProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -500,17 +434,11 @@ namespace validation_layer
         if( nullptr == pfnGetThreadRegisterSetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugGetThreadRegisterSetPropertiesPrologue( hDebug, thread, pCount, pRegisterSetProperties );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugGetThreadRegisterSetPropertiesPrologue ] ) {
+            auto result = checker->zetDebugGetThreadRegisterSetPropertiesPrologue( hDebug, thread, pCount, pRegisterSetProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugGetThreadRegisterSetPropertiesPrologue( hDebug, thread, pCount, pRegisterSetProperties );
@@ -519,9 +447,9 @@ namespace validation_layer
 
         auto result = pfnGetThreadRegisterSetProperties( hDebug, thread, pCount, pRegisterSetProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugGetThreadRegisterSetPropertiesEpilogue( hDebug, thread, pCount, pRegisterSetProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugGetThreadRegisterSetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zetDebugGetThreadRegisterSetPropertiesEpilogue( hDebug, thread, pCount, pRegisterSetProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -548,17 +476,11 @@ namespace validation_layer
         if( nullptr == pfnReadRegisters )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugReadRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugReadRegistersPrologue ] ) {
+            auto result = checker->zetDebugReadRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugReadRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
@@ -567,9 +489,9 @@ namespace validation_layer
 
         auto result = pfnReadRegisters( hDebug, thread, type, start, count, pRegisterValues );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugReadRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugReadRegistersEpilogue ] ) {
+            auto epilogueResult = checker->zetDebugReadRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -596,17 +518,11 @@ namespace validation_layer
         if( nullptr == pfnWriteRegisters )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugWriteRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugWriteRegistersPrologue ] ) {
+            auto result = checker->zetDebugWriteRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugWriteRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
@@ -615,9 +531,9 @@ namespace validation_layer
 
         auto result = pfnWriteRegisters( hDebug, thread, type, start, count, pRegisterValues );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDebugWriteRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDebugWriteRegistersEpilogue ] ) {
+            auto epilogueResult = checker->zetDebugWriteRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -644,17 +560,11 @@ namespace validation_layer
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetPrologue( hDevice, pCount, phMetricGroups );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupGetPrologue ] ) {
+            auto result = checker->zetMetricGroupGetPrologue( hDevice, pCount, phMetricGroups );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetPrologue( hDevice, pCount, phMetricGroups );
@@ -663,9 +573,9 @@ namespace validation_layer
 
         auto result = pfnGet( hDevice, pCount, phMetricGroups );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetEpilogue( hDevice, pCount, phMetricGroups );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupGetEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGroupGetEpilogue( hDevice, pCount, phMetricGroups, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -673,7 +583,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phMetricGroups) && (i < *pCount); ++i){
                 if (phMetricGroups[i]){
-                    context.handleLifetime->addHandle( phMetricGroups[i] );
+                    context.handleLifetime->addHandle( phMetricGroups[i], hDevice );
                     context.handleLifetime->addDependent( hDevice, phMetricGroups[i] );
                 }
             }
@@ -694,17 +604,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetPropertiesPrologue( hMetricGroup, pProperties );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupGetPropertiesPrologue ] ) {
+            auto result = checker->zetMetricGroupGetPropertiesPrologue( hMetricGroup, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetPropertiesPrologue( hMetricGroup, pProperties );
@@ -713,9 +617,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hMetricGroup, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetPropertiesEpilogue( hMetricGroup, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGroupGetPropertiesEpilogue( hMetricGroup, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -745,17 +649,11 @@ namespace validation_layer
         if( nullptr == pfnCalculateMetricValues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMetricValuesPrologue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupCalculateMetricValuesPrologue ] ) {
+            auto result = checker->zetMetricGroupCalculateMetricValuesPrologue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMetricValuesPrologue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
@@ -764,9 +662,9 @@ namespace validation_layer
 
         auto result = pfnCalculateMetricValues( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMetricValuesEpilogue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupCalculateMetricValuesEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGroupCalculateMetricValuesEpilogue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -792,17 +690,11 @@ namespace validation_layer
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGetPrologue( hMetricGroup, pCount, phMetrics );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGetPrologue ] ) {
+            auto result = checker->zetMetricGetPrologue( hMetricGroup, pCount, phMetrics );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGetPrologue( hMetricGroup, pCount, phMetrics );
@@ -811,9 +703,9 @@ namespace validation_layer
 
         auto result = pfnGet( hMetricGroup, pCount, phMetrics );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGetEpilogue( hMetricGroup, pCount, phMetrics );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGetEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGetEpilogue( hMetricGroup, pCount, phMetrics, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -821,7 +713,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phMetrics) && (i < *pCount); ++i){
                 if (phMetrics[i]){
-                    context.handleLifetime->addHandle( phMetrics[i] );
+                    context.handleLifetime->addHandle( phMetrics[i], hMetricGroup );
                     context.handleLifetime->addDependent( hMetricGroup, phMetrics[i] );
                 }
             }
@@ -842,17 +734,11 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGetPropertiesPrologue( hMetric, pProperties );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGetPropertiesPrologue ] ) {
+            auto result = checker->zetMetricGetPropertiesPrologue( hMetric, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGetPropertiesPrologue( hMetric, pProperties );
@@ -861,9 +747,9 @@ namespace validation_layer
 
         auto result = pfnGetProperties( hMetric, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGetPropertiesEpilogue( hMetric, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGetPropertiesEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGetPropertiesEpilogue( hMetric, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -888,17 +774,11 @@ namespace validation_layer
         if( nullptr == pfnActivateMetricGroups )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetContextActivateMetricGroupsPrologue( hContext, hDevice, count, phMetricGroups );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetContextActivateMetricGroupsPrologue ] ) {
+            auto result = checker->zetContextActivateMetricGroupsPrologue( hContext, hDevice, count, phMetricGroups );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetContextActivateMetricGroupsPrologue( hContext, hDevice, count, phMetricGroups );
@@ -907,9 +787,9 @@ namespace validation_layer
 
         auto result = pfnActivateMetricGroups( hContext, hDevice, count, phMetricGroups );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetContextActivateMetricGroupsEpilogue( hContext, hDevice, count, phMetricGroups );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetContextActivateMetricGroupsEpilogue ] ) {
+            auto epilogueResult = checker->zetContextActivateMetricGroupsEpilogue( hContext, hDevice, count, phMetricGroups, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -932,17 +812,11 @@ namespace validation_layer
         if( nullptr == pfnOpen )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerOpenPrologue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricStreamerOpenPrologue ] ) {
+            auto result = checker->zetMetricStreamerOpenPrologue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricStreamerOpenPrologue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
@@ -951,9 +825,9 @@ namespace validation_layer
 
         auto result = pfnOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerOpenEpilogue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricStreamerOpenEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricStreamerOpenEpilogue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -973,15 +847,14 @@ namespace validation_layer
         if( nullptr == pfnAppendMetricStreamerMarker )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricStreamerMarkerPrologue( hCommandList, hMetricStreamer, value );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetCommandListAppendMetricStreamerMarkerPrologue ] ) {
+            auto result = checker->zetCommandListAppendMetricStreamerMarkerPrologue( hCommandList, hMetricStreamer, value );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zetCommandListAppendMetricStreamerMarker" );
         }
 
         
@@ -992,9 +865,9 @@ namespace validation_layer
 
         auto result = pfnAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricStreamerMarkerEpilogue( hCommandList, hMetricStreamer, value );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetCommandListAppendMetricStreamerMarkerEpilogue ] ) {
+            auto epilogueResult = checker->zetCommandListAppendMetricStreamerMarkerEpilogue( hCommandList, hMetricStreamer, value, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1012,17 +885,11 @@ namespace validation_layer
         if( nullptr == pfnClose )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerClosePrologue( hMetricStreamer );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricStreamerClosePrologue ] ) {
+            auto result = checker->zetMetricStreamerClosePrologue( hMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricStreamerClosePrologue( hMetricStreamer );
@@ -1031,9 +898,9 @@ namespace validation_layer
 
         auto result = pfnClose( hMetricStreamer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerCloseEpilogue( hMetricStreamer );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricStreamerCloseEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricStreamerCloseEpilogue( hMetricStreamer, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1062,17 +929,11 @@ namespace validation_layer
         if( nullptr == pfnReadData )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerReadDataPrologue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricStreamerReadDataPrologue ] ) {
+            auto result = checker->zetMetricStreamerReadDataPrologue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricStreamerReadDataPrologue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
@@ -1081,9 +942,9 @@ namespace validation_layer
 
         auto result = pfnReadData( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerReadDataEpilogue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricStreamerReadDataEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricStreamerReadDataEpilogue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1105,17 +966,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryPoolCreatePrologue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricQueryPoolCreatePrologue ] ) {
+            auto result = checker->zetMetricQueryPoolCreatePrologue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryPoolCreatePrologue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
@@ -1124,16 +979,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryPoolCreateEpilogue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricQueryPoolCreateEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricQueryPoolCreateEpilogue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phMetricQueryPool){
-                context.handleLifetime->addHandle( *phMetricQueryPool );
+                context.handleLifetime->addHandle( *phMetricQueryPool, hContext );
                 context.handleLifetime->addDependent( hContext, *phMetricQueryPool );
 
             }
@@ -1153,17 +1008,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryPoolDestroyPrologue( hMetricQueryPool );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricQueryPoolDestroyPrologue ] ) {
+            auto result = checker->zetMetricQueryPoolDestroyPrologue( hMetricQueryPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryPoolDestroyPrologue( hMetricQueryPool );
@@ -1172,9 +1021,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hMetricQueryPool );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryPoolDestroyEpilogue( hMetricQueryPool );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricQueryPoolDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricQueryPoolDestroyEpilogue( hMetricQueryPool, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1194,17 +1043,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryCreatePrologue( hMetricQueryPool, index, phMetricQuery );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricQueryCreatePrologue ] ) {
+            auto result = checker->zetMetricQueryCreatePrologue( hMetricQueryPool, index, phMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryCreatePrologue( hMetricQueryPool, index, phMetricQuery );
@@ -1213,16 +1056,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hMetricQueryPool, index, phMetricQuery );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryCreateEpilogue( hMetricQueryPool, index, phMetricQuery );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricQueryCreateEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricQueryCreateEpilogue( hMetricQueryPool, index, phMetricQuery, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phMetricQuery){
-                context.handleLifetime->addHandle( *phMetricQuery );
+                context.handleLifetime->addHandle( *phMetricQuery, hMetricQueryPool );
                 context.handleLifetime->addDependent( hMetricQueryPool, *phMetricQuery );
 
             }
@@ -1242,17 +1085,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryDestroyPrologue( hMetricQuery );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricQueryDestroyPrologue ] ) {
+            auto result = checker->zetMetricQueryDestroyPrologue( hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryDestroyPrologue( hMetricQuery );
@@ -1261,9 +1098,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hMetricQuery );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryDestroyEpilogue( hMetricQuery );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricQueryDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricQueryDestroyEpilogue( hMetricQuery, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1281,17 +1118,11 @@ namespace validation_layer
         if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryResetPrologue( hMetricQuery );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricQueryResetPrologue ] ) {
+            auto result = checker->zetMetricQueryResetPrologue( hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryResetPrologue( hMetricQuery );
@@ -1300,9 +1131,9 @@ namespace validation_layer
 
         auto result = pfnReset( hMetricQuery );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryResetEpilogue( hMetricQuery );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricQueryResetEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricQueryResetEpilogue( hMetricQuery, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1321,15 +1152,14 @@ namespace validation_layer
         if( nullptr == pfnAppendMetricQueryBegin )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricQueryBeginPrologue( hCommandList, hMetricQuery );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetCommandListAppendMetricQueryBeginPrologue ] ) {
+            auto result = checker->zetCommandListAppendMetricQueryBeginPrologue( hCommandList, hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zetCommandListAppendMetricQueryBegin" );
         }
 
         
@@ -1340,9 +1170,9 @@ namespace validation_layer
 
         auto result = pfnAppendMetricQueryBegin( hCommandList, hMetricQuery );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricQueryBeginEpilogue( hCommandList, hMetricQuery );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetCommandListAppendMetricQueryBeginEpilogue ] ) {
+            auto epilogueResult = checker->zetCommandListAppendMetricQueryBeginEpilogue( hCommandList, hMetricQuery, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1364,15 +1194,14 @@ namespace validation_layer
         if( nullptr == pfnAppendMetricQueryEnd )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricQueryEndPrologue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetCommandListAppendMetricQueryEndPrologue ] ) {
+            auto result = checker->zetCommandListAppendMetricQueryEndPrologue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zetCommandListAppendMetricQueryEnd" );
         }
 
         
@@ -1383,9 +1212,9 @@ namespace validation_layer
 
         auto result = pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricQueryEndEpilogue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetCommandListAppendMetricQueryEndEpilogue ] ) {
+            auto epilogueResult = checker->zetCommandListAppendMetricQueryEndEpilogue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1403,15 +1232,14 @@ namespace validation_layer
         if( nullptr == pfnAppendMetricMemoryBarrier )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricMemoryBarrierPrologue( hCommandList );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetCommandListAppendMetricMemoryBarrierPrologue ] ) {
+            auto result = checker->zetCommandListAppendMetricMemoryBarrierPrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->acquire( threadingGuard, hCommandList, "zetCommandListAppendMetricMemoryBarrier" );
         }
 
         
@@ -1422,9 +1250,9 @@ namespace validation_layer
 
         auto result = pfnAppendMetricMemoryBarrier( hCommandList );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricMemoryBarrierEpilogue( hCommandList );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetCommandListAppendMetricMemoryBarrierEpilogue ] ) {
+            auto epilogueResult = checker->zetCommandListAppendMetricMemoryBarrierEpilogue( hCommandList, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1451,17 +1279,11 @@ namespace validation_layer
         if( nullptr == pfnGetData )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryGetDataPrologue( hMetricQuery, pRawDataSize, pRawData );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricQueryGetDataPrologue ] ) {
+            auto result = checker->zetMetricQueryGetDataPrologue( hMetricQuery, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryGetDataPrologue( hMetricQuery, pRawDataSize, pRawData );
@@ -1470,9 +1292,9 @@ namespace validation_layer
 
         auto result = pfnGetData( hMetricQuery, pRawDataSize, pRawData );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryGetDataEpilogue( hMetricQuery, pRawDataSize, pRawData );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricQueryGetDataEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricQueryGetDataEpilogue( hMetricQuery, pRawDataSize, pRawData, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1491,15 +1313,14 @@ namespace validation_layer
         if( nullptr == pfnGetProfileInfo )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetKernelGetProfileInfoPrologue( hKernel, pProfileProperties );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetKernelGetProfileInfoPrologue ] ) {
+            auto result = checker->zetKernelGetProfileInfoPrologue( hKernel, pProfileProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        ThreadingValidation::Guard threadingGuard;
+        if( context.enableThreadingValidation ){
+            context.threadingValidation->share( threadingGuard, hKernel, "zetKernelGetProfileInfo" );
         }
 
         
@@ -1510,9 +1331,9 @@ namespace validation_layer
 
         auto result = pfnGetProfileInfo( hKernel, pProfileProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetKernelGetProfileInfoEpilogue( hKernel, pProfileProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetKernelGetProfileInfoEpilogue ] ) {
+            auto epilogueResult = checker->zetKernelGetProfileInfoEpilogue( hKernel, pProfileProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1532,17 +1353,11 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpCreatePrologue( hContext, desc, phTracer );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetTracerExpCreatePrologue ] ) {
+            auto result = checker->zetTracerExpCreatePrologue( hContext, desc, phTracer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpCreatePrologue( hContext, desc, phTracer );
@@ -1551,16 +1366,16 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, desc, phTracer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpCreateEpilogue( hContext, desc, phTracer );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetTracerExpCreateEpilogue ] ) {
+            auto epilogueResult = checker->zetTracerExpCreateEpilogue( hContext, desc, phTracer, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phTracer){
-                context.handleLifetime->addHandle( *phTracer );
+                context.handleLifetime->addHandle( *phTracer, hContext );
                 context.handleLifetime->addDependent( hContext, *phTracer );
 
             }
@@ -1580,17 +1395,11 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpDestroyPrologue( hTracer );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetTracerExpDestroyPrologue ] ) {
+            auto result = checker->zetTracerExpDestroyPrologue( hTracer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpDestroyPrologue( hTracer );
@@ -1599,9 +1408,9 @@ namespace validation_layer
 
         auto result = pfnDestroy( hTracer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpDestroyEpilogue( hTracer );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetTracerExpDestroyEpilogue ] ) {
+            auto epilogueResult = checker->zetTracerExpDestroyEpilogue( hTracer, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1620,17 +1429,11 @@ namespace validation_layer
         if( nullptr == pfnSetPrologues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetProloguesPrologue( hTracer, pCoreCbs );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetTracerExpSetProloguesPrologue ] ) {
+            auto result = checker->zetTracerExpSetProloguesPrologue( hTracer, pCoreCbs );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpSetProloguesPrologue( hTracer, pCoreCbs );
@@ -1639,9 +1442,9 @@ namespace validation_layer
 
         auto result = pfnSetPrologues( hTracer, pCoreCbs );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetProloguesEpilogue( hTracer, pCoreCbs );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetTracerExpSetProloguesEpilogue ] ) {
+            auto epilogueResult = checker->zetTracerExpSetProloguesEpilogue( hTracer, pCoreCbs, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1660,17 +1463,11 @@ namespace validation_layer
         if( nullptr == pfnSetEpilogues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetEpiloguesPrologue( hTracer, pCoreCbs );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetTracerExpSetEpiloguesPrologue ] ) {
+            auto result = checker->zetTracerExpSetEpiloguesPrologue( hTracer, pCoreCbs );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpSetEpiloguesPrologue( hTracer, pCoreCbs );
@@ -1679,9 +1476,9 @@ namespace validation_layer
 
         auto result = pfnSetEpilogues( hTracer, pCoreCbs );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetEpiloguesEpilogue( hTracer, pCoreCbs );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetTracerExpSetEpiloguesEpilogue ] ) {
+            auto epilogueResult = checker->zetTracerExpSetEpiloguesEpilogue( hTracer, pCoreCbs, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1700,17 +1497,11 @@ namespace validation_layer
         if( nullptr == pfnSetEnabled )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetEnabledPrologue( hTracer, enable );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetTracerExpSetEnabledPrologue ] ) {
+            auto result = checker->zetTracerExpSetEnabledPrologue( hTracer, enable );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpSetEnabledPrologue( hTracer, enable );
@@ -1719,9 +1510,9 @@ namespace validation_layer
 
         auto result = pfnSetEnabled( hTracer, enable );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetEnabledEpilogue( hTracer, enable );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetTracerExpSetEnabledEpilogue ] ) {
+            auto epilogueResult = checker->zetTracerExpSetEnabledEpilogue( hTracer, enable, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1747,17 +1538,11 @@ namespace validation_layer
         if( nullptr == pfnGetConcurrentMetricGroupsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceGetConcurrentMetricGroupsExpPrologue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDeviceGetConcurrentMetricGroupsExpPrologue ] ) {
+            auto result = checker->zetDeviceGetConcurrentMetricGroupsExpPrologue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceGetConcurrentMetricGroupsExpPrologue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
@@ -1766,9 +1551,9 @@ namespace validation_layer
 
         auto result = pfnGetConcurrentMetricGroupsExp( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceGetConcurrentMetricGroupsExpEpilogue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDeviceGetConcurrentMetricGroupsExpEpilogue ] ) {
+            auto epilogueResult = checker->zetDeviceGetConcurrentMetricGroupsExpEpilogue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -1799,17 +1584,11 @@ namespace validation_layer
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerCreateExpPrologue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricTracerCreateExpPrologue ] ) {
+            auto result = checker->zetMetricTracerCreateExpPrologue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerCreateExpPrologue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
@@ -1818,16 +1597,16 @@ namespace validation_layer
 
         auto result = pfnCreateExp( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerCreateExpEpilogue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricTracerCreateExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricTracerCreateExpEpilogue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phMetricTracer){
-                context.handleLifetime->addHandle( *phMetricTracer );
+                context.handleLifetime->addHandle( *phMetricTracer, hContext );
                 context.handleLifetime->addDependent( hContext, *phMetricTracer );
 
             }
@@ -1847,17 +1626,11 @@ namespace validation_layer
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDestroyExpPrologue( hMetricTracer );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricTracerDestroyExpPrologue ] ) {
+            auto result = checker->zetMetricTracerDestroyExpPrologue( hMetricTracer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerDestroyExpPrologue( hMetricTracer );
@@ -1866,9 +1639,9 @@ namespace validation_layer
 
         auto result = pfnDestroyExp( hMetricTracer );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDestroyExpEpilogue( hMetricTracer );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricTracerDestroyExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricTracerDestroyExpEpilogue( hMetricTracer, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1891,17 +1664,11 @@ namespace validation_layer
         if( nullptr == pfnEnableExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerEnableExpPrologue( hMetricTracer, synchronous );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricTracerEnableExpPrologue ] ) {
+            auto result = checker->zetMetricTracerEnableExpPrologue( hMetricTracer, synchronous );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerEnableExpPrologue( hMetricTracer, synchronous );
@@ -1910,9 +1677,9 @@ namespace validation_layer
 
         auto result = pfnEnableExp( hMetricTracer, synchronous );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerEnableExpEpilogue( hMetricTracer, synchronous );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricTracerEnableExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricTracerEnableExpEpilogue( hMetricTracer, synchronous, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1936,17 +1703,11 @@ namespace validation_layer
         if( nullptr == pfnDisableExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDisableExpPrologue( hMetricTracer, synchronous );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricTracerDisableExpPrologue ] ) {
+            auto result = checker->zetMetricTracerDisableExpPrologue( hMetricTracer, synchronous );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerDisableExpPrologue( hMetricTracer, synchronous );
@@ -1955,9 +1716,9 @@ namespace validation_layer
 
         auto result = pfnDisableExp( hMetricTracer, synchronous );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDisableExpEpilogue( hMetricTracer, synchronous );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricTracerDisableExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricTracerDisableExpEpilogue( hMetricTracer, synchronous, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -1984,17 +1745,11 @@ namespace validation_layer
         if( nullptr == pfnReadDataExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerReadDataExpPrologue( hMetricTracer, pRawDataSize, pRawData );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricTracerReadDataExpPrologue ] ) {
+            auto result = checker->zetMetricTracerReadDataExpPrologue( hMetricTracer, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerReadDataExpPrologue( hMetricTracer, pRawDataSize, pRawData );
@@ -2003,9 +1758,9 @@ namespace validation_layer
 
         auto result = pfnReadDataExp( hMetricTracer, pRawDataSize, pRawData );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerReadDataExpEpilogue( hMetricTracer, pRawDataSize, pRawData );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricTracerReadDataExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricTracerReadDataExpEpilogue( hMetricTracer, pRawDataSize, pRawData, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2024,17 +1779,11 @@ namespace validation_layer
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderCreateExpPrologue( hMetricTracer, phMetricDecoder );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricDecoderCreateExpPrologue ] ) {
+            auto result = checker->zetMetricDecoderCreateExpPrologue( hMetricTracer, phMetricDecoder );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDecoderCreateExpPrologue( hMetricTracer, phMetricDecoder );
@@ -2043,16 +1792,16 @@ namespace validation_layer
 
         auto result = pfnCreateExp( hMetricTracer, phMetricDecoder );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderCreateExpEpilogue( hMetricTracer, phMetricDecoder );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricDecoderCreateExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricDecoderCreateExpEpilogue( hMetricTracer, phMetricDecoder, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phMetricDecoder){
-                context.handleLifetime->addHandle( *phMetricDecoder );
+                context.handleLifetime->addHandle( *phMetricDecoder, hMetricTracer );
                 context.handleLifetime->addDependent( hMetricTracer, *phMetricDecoder );
 
             }
@@ -2072,17 +1821,11 @@ namespace validation_layer
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderDestroyExpPrologue( phMetricDecoder );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricDecoderDestroyExpPrologue ] ) {
+            auto result = checker->zetMetricDecoderDestroyExpPrologue( phMetricDecoder );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDecoderDestroyExpPrologue( phMetricDecoder );
@@ -2091,9 +1834,9 @@ namespace validation_layer
 
         auto result = pfnDestroyExp( phMetricDecoder );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderDestroyExpEpilogue( phMetricDecoder );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricDecoderDestroyExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricDecoderDestroyExpEpilogue( phMetricDecoder, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2122,17 +1865,11 @@ namespace validation_layer
         if( nullptr == pfnGetDecodableMetricsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderGetDecodableMetricsExpPrologue( hMetricDecoder, pCount, phMetrics );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricDecoderGetDecodableMetricsExpPrologue ] ) {
+            auto result = checker->zetMetricDecoderGetDecodableMetricsExpPrologue( hMetricDecoder, pCount, phMetrics );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDecoderGetDecodableMetricsExpPrologue( hMetricDecoder, pCount, phMetrics );
@@ -2141,9 +1878,9 @@ namespace validation_layer
 
         auto result = pfnGetDecodableMetricsExp( hMetricDecoder, pCount, phMetrics );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderGetDecodableMetricsExpEpilogue( hMetricDecoder, pCount, phMetrics );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricDecoderGetDecodableMetricsExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricDecoderGetDecodableMetricsExpEpilogue( hMetricDecoder, pCount, phMetrics, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -2151,7 +1888,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phMetrics) && (i < *pCount); ++i){
                 if (phMetrics[i]){
-                    context.handleLifetime->addHandle( phMetrics[i] );
+                    context.handleLifetime->addHandle( phMetrics[i], hMetricDecoder );
                     context.handleLifetime->addDependent( hMetricDecoder, phMetrics[i] );
                 }
             }
@@ -2210,17 +1947,11 @@ namespace validation_layer
         if( nullptr == pfnDecodeExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDecodeExpPrologue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricTracerDecodeExpPrologue ] ) {
+            auto result = checker->zetMetricTracerDecodeExpPrologue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerDecodeExpPrologue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
@@ -2229,9 +1960,9 @@ namespace validation_layer
 
         auto result = pfnDecodeExp( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDecodeExpEpilogue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricTracerDecodeExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricTracerDecodeExpEpilogue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2271,17 +2002,11 @@ namespace validation_layer
         if( nullptr == pfnCalculateMultipleMetricValuesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMultipleMetricValuesExpPrologue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupCalculateMultipleMetricValuesExpPrologue ] ) {
+            auto result = checker->zetMetricGroupCalculateMultipleMetricValuesExpPrologue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMultipleMetricValuesExpPrologue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
@@ -2290,9 +2015,9 @@ namespace validation_layer
 
         auto result = pfnCalculateMultipleMetricValuesExp( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMultipleMetricValuesExpEpilogue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupCalculateMultipleMetricValuesExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGroupCalculateMultipleMetricValuesExpEpilogue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2313,17 +2038,11 @@ namespace validation_layer
         if( nullptr == pfnGetGlobalTimestampsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetGlobalTimestampsExpPrologue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupGetGlobalTimestampsExpPrologue ] ) {
+            auto result = checker->zetMetricGroupGetGlobalTimestampsExpPrologue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetGlobalTimestampsExpPrologue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
@@ -2332,9 +2051,9 @@ namespace validation_layer
 
         auto result = pfnGetGlobalTimestampsExp( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetGlobalTimestampsExpEpilogue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupGetGlobalTimestampsExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGroupGetGlobalTimestampsExpEpilogue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -2364,17 +2083,11 @@ namespace validation_layer
         if( nullptr == pfnGetExportDataExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetExportDataExpPrologue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupGetExportDataExpPrologue ] ) {
+            auto result = checker->zetMetricGroupGetExportDataExpPrologue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetExportDataExpPrologue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
@@ -2383,9 +2096,9 @@ namespace validation_layer
 
         auto result = pfnGetExportDataExp( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetExportDataExpEpilogue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupGetExportDataExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGroupGetExportDataExpEpilogue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -2430,17 +2143,11 @@ namespace validation_layer
         if( nullptr == pfnCalculateMetricExportDataExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMetricExportDataExpPrologue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupCalculateMetricExportDataExpPrologue ] ) {
+            auto result = checker->zetMetricGroupCalculateMetricExportDataExpPrologue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMetricExportDataExpPrologue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
@@ -2449,9 +2156,9 @@ namespace validation_layer
 
         auto result = pfnCalculateMetricExportDataExp( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMetricExportDataExpEpilogue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupCalculateMetricExportDataExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGroupCalculateMetricExportDataExpEpilogue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2478,17 +2185,11 @@ namespace validation_layer
         if( nullptr == pfnGetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetExpPrologue( hDevice, pCount, phMetricProgrammables );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricProgrammableGetExpPrologue ] ) {
+            auto result = checker->zetMetricProgrammableGetExpPrologue( hDevice, pCount, phMetricProgrammables );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetExpPrologue( hDevice, pCount, phMetricProgrammables );
@@ -2497,9 +2198,9 @@ namespace validation_layer
 
         auto result = pfnGetExp( hDevice, pCount, phMetricProgrammables );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetExpEpilogue( hDevice, pCount, phMetricProgrammables );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricProgrammableGetExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricProgrammableGetExpEpilogue( hDevice, pCount, phMetricProgrammables, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -2507,7 +2208,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phMetricProgrammables) && (i < *pCount); ++i){
                 if (phMetricProgrammables[i]){
-                    context.handleLifetime->addHandle( phMetricProgrammables[i] );
+                    context.handleLifetime->addHandle( phMetricProgrammables[i], hDevice );
                     context.handleLifetime->addDependent( hDevice, phMetricProgrammables[i] );
                 }
             }
@@ -2528,17 +2229,11 @@ namespace validation_layer
         if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetPropertiesExpPrologue( hMetricProgrammable, pProperties );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricProgrammableGetPropertiesExpPrologue ] ) {
+            auto result = checker->zetMetricProgrammableGetPropertiesExpPrologue( hMetricProgrammable, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetPropertiesExpPrologue( hMetricProgrammable, pProperties );
@@ -2547,9 +2242,9 @@ namespace validation_layer
 
         auto result = pfnGetPropertiesExp( hMetricProgrammable, pProperties );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetPropertiesExpEpilogue( hMetricProgrammable, pProperties );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricProgrammableGetPropertiesExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricProgrammableGetPropertiesExpEpilogue( hMetricProgrammable, pProperties, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -2579,17 +2274,11 @@ namespace validation_layer
         if( nullptr == pfnGetParamInfoExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetParamInfoExpPrologue( hMetricProgrammable, pParameterCount, pParameterInfo );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricProgrammableGetParamInfoExpPrologue ] ) {
+            auto result = checker->zetMetricProgrammableGetParamInfoExpPrologue( hMetricProgrammable, pParameterCount, pParameterInfo );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetParamInfoExpPrologue( hMetricProgrammable, pParameterCount, pParameterInfo );
@@ -2598,9 +2287,9 @@ namespace validation_layer
 
         auto result = pfnGetParamInfoExp( hMetricProgrammable, pParameterCount, pParameterInfo );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetParamInfoExpEpilogue( hMetricProgrammable, pParameterCount, pParameterInfo );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricProgrammableGetParamInfoExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricProgrammableGetParamInfoExpEpilogue( hMetricProgrammable, pParameterCount, pParameterInfo, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -2631,17 +2320,11 @@ namespace validation_layer
         if( nullptr == pfnGetParamValueInfoExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetParamValueInfoExpPrologue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricProgrammableGetParamValueInfoExpPrologue ] ) {
+            auto result = checker->zetMetricProgrammableGetParamValueInfoExpPrologue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetParamValueInfoExpPrologue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
@@ -2650,9 +2333,9 @@ namespace validation_layer
 
         auto result = pfnGetParamValueInfoExp( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetParamValueInfoExpEpilogue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricProgrammableGetParamValueInfoExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricProgrammableGetParamValueInfoExpEpilogue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -2690,17 +2373,11 @@ namespace validation_layer
         if( nullptr == pfnCreateFromProgrammableExp2 )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricCreateFromProgrammableExp2Prologue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricCreateFromProgrammableExp2Prologue ] ) {
+            auto result = checker->zetMetricCreateFromProgrammableExp2Prologue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricCreateFromProgrammableExp2Prologue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
@@ -2709,9 +2386,9 @@ namespace validation_layer
 
         auto result = pfnCreateFromProgrammableExp2( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricCreateFromProgrammableExp2Epilogue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricCreateFromProgrammableExp2Epilogue ] ) {
+            auto epilogueResult = checker->zetMetricCreateFromProgrammableExp2Epilogue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -2719,7 +2396,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phMetricHandles) && (i < *pMetricHandleCount); ++i){
                 if (phMetricHandles[i]){
-                    context.handleLifetime->addHandle( phMetricHandles[i] );
+                    context.handleLifetime->addHandle( phMetricHandles[i], hMetricProgrammable );
                     context.handleLifetime->addDependent( hMetricProgrammable, phMetricHandles[i] );
                 }
             }
@@ -2755,17 +2432,11 @@ namespace validation_layer
         if( nullptr == pfnCreateFromProgrammableExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricCreateFromProgrammableExpPrologue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricCreateFromProgrammableExpPrologue ] ) {
+            auto result = checker->zetMetricCreateFromProgrammableExpPrologue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricCreateFromProgrammableExpPrologue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
@@ -2774,9 +2445,9 @@ namespace validation_layer
 
         auto result = pfnCreateFromProgrammableExp( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricCreateFromProgrammableExpEpilogue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricCreateFromProgrammableExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricCreateFromProgrammableExpEpilogue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -2784,7 +2455,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phMetricHandles) && (i < *pMetricHandleCount); ++i){
                 if (phMetricHandles[i]){
-                    context.handleLifetime->addHandle( phMetricHandles[i] );
+                    context.handleLifetime->addHandle( phMetricHandles[i], hMetricProgrammable );
                     context.handleLifetime->addDependent( hMetricProgrammable, phMetricHandles[i] );
                 }
             }
@@ -2823,17 +2494,11 @@ namespace validation_layer
         if( nullptr == pfnCreateMetricGroupsFromMetricsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceCreateMetricGroupsFromMetricsExpPrologue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDeviceCreateMetricGroupsFromMetricsExpPrologue ] ) {
+            auto result = checker->zetDeviceCreateMetricGroupsFromMetricsExpPrologue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceCreateMetricGroupsFromMetricsExpPrologue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
@@ -2842,9 +2507,9 @@ namespace validation_layer
 
         auto result = pfnCreateMetricGroupsFromMetricsExp( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetDeviceCreateMetricGroupsFromMetricsExpEpilogue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetDeviceCreateMetricGroupsFromMetricsExpEpilogue ] ) {
+            auto epilogueResult = checker->zetDeviceCreateMetricGroupsFromMetricsExpEpilogue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
@@ -2852,7 +2517,7 @@ namespace validation_layer
             
             for (size_t i = 0; ( nullptr != phMetricGroup) && (i < *pMetricGroupCount); ++i){
                 if (phMetricGroup[i]){
-                    context.handleLifetime->addHandle( phMetricGroup[i] );
+                    context.handleLifetime->addHandle( phMetricGroup[i], hDevice );
                     context.handleLifetime->addDependent( hDevice, phMetricGroup[i] );
                 }
             }
@@ -2879,17 +2544,11 @@ namespace validation_layer
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCreateExpPrologue( hDevice, pName, pDescription, samplingType, phMetricGroup );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupCreateExpPrologue ] ) {
+            auto result = checker->zetMetricGroupCreateExpPrologue( hDevice, pName, pDescription, samplingType, phMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCreateExpPrologue( hDevice, pName, pDescription, samplingType, phMetricGroup );
@@ -2898,16 +2557,16 @@ namespace validation_layer
 
         auto result = pfnCreateExp( hDevice, pName, pDescription, samplingType, phMetricGroup );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCreateExpEpilogue( hDevice, pName, pDescription, samplingType, phMetricGroup );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupCreateExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGroupCreateExpEpilogue( hDevice, pName, pDescription, samplingType, phMetricGroup, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phMetricGroup){
-                context.handleLifetime->addHandle( *phMetricGroup );
+                context.handleLifetime->addHandle( *phMetricGroup, hDevice );
                 context.handleLifetime->addDependent( hDevice, *phMetricGroup );
 
             }
@@ -2935,17 +2594,11 @@ namespace validation_layer
         if( nullptr == pfnAddMetricExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupAddMetricExpPrologue( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupAddMetricExpPrologue ] ) {
+            auto result = checker->zetMetricGroupAddMetricExpPrologue( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupAddMetricExpPrologue( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
@@ -2954,9 +2607,9 @@ namespace validation_layer
 
         auto result = pfnAddMetricExp( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupAddMetricExpEpilogue( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupAddMetricExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGroupAddMetricExpEpilogue( hMetricGroup, hMetric, pErrorStringSize, pErrorString, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -2975,17 +2628,11 @@ namespace validation_layer
         if( nullptr == pfnRemoveMetricExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupRemoveMetricExpPrologue( hMetricGroup, hMetric );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupRemoveMetricExpPrologue ] ) {
+            auto result = checker->zetMetricGroupRemoveMetricExpPrologue( hMetricGroup, hMetric );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupRemoveMetricExpPrologue( hMetricGroup, hMetric );
@@ -2994,9 +2641,9 @@ namespace validation_layer
 
         auto result = pfnRemoveMetricExp( hMetricGroup, hMetric );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupRemoveMetricExpEpilogue( hMetricGroup, hMetric );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupRemoveMetricExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGroupRemoveMetricExpEpilogue( hMetricGroup, hMetric, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3014,17 +2661,11 @@ namespace validation_layer
         if( nullptr == pfnCloseExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCloseExpPrologue( hMetricGroup );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupCloseExpPrologue ] ) {
+            auto result = checker->zetMetricGroupCloseExpPrologue( hMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCloseExpPrologue( hMetricGroup );
@@ -3033,9 +2674,9 @@ namespace validation_layer
 
         auto result = pfnCloseExp( hMetricGroup );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCloseExpEpilogue( hMetricGroup );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupCloseExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGroupCloseExpEpilogue( hMetricGroup, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3053,17 +2694,11 @@ namespace validation_layer
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupDestroyExpPrologue( hMetricGroup );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupDestroyExpPrologue ] ) {
+            auto result = checker->zetMetricGroupDestroyExpPrologue( hMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupDestroyExpPrologue( hMetricGroup );
@@ -3072,9 +2707,9 @@ namespace validation_layer
 
         auto result = pfnDestroyExp( hMetricGroup );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupDestroyExpEpilogue( hMetricGroup );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricGroupDestroyExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricGroupDestroyExpEpilogue( hMetricGroup, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
@@ -3092,17 +2727,11 @@ namespace validation_layer
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        auto numValHandlers = context.validationHandlers.size();
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDestroyExpPrologue( hMetric );
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricDestroyExpPrologue ] ) {
+            auto result = checker->zetMetricDestroyExpPrologue( hMetric );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDestroyExpPrologue( hMetric );
@@ -3111,9 +2740,9 @@ namespace validation_layer
 
         auto result = pfnDestroyExp( hMetric );
 
-        for (size_t i = 0; i < numValHandlers; i++) {
-            auto result = context.validationHandlers[i]->zetValidation->zetMetricDestroyExpEpilogue( hMetric );
-            if(result!=ZE_RESULT_SUCCESS) return result;
+        for( auto checker : context.zetCheckers[ ZETEntryPoint::zetMetricDestroyExpEpilogue ] ) {
+            auto epilogueResult = checker->zetMetricDestroyExpEpilogue( hMetric, result );
+            if(epilogueResult!=ZE_RESULT_SUCCESS) return epilogueResult;
         }
 
         return result;
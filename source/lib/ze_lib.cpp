@@ -18,6 +18,24 @@ namespace ze_lib
     context_t *context;
     bool destruction = false;
 
+    thread_local ze_dditable_t *context_t::threadZeDdiTable = nullptr;
+    thread_local zet_dditable_t *context_t::threadZetDdiTable = nullptr;
+    thread_local zes_dditable_t *context_t::threadZesDdiTable = nullptr;
+    thread_local uint32_t context_t::threadTracingEnableCounter = 0;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// a thread which exits with tracing enabled for itself no longer counts
+    struct thread_tracing_owner_t
+    {
+        bool enabled = false;
+        ~thread_tracing_owner_t()
+        {
+            if( enabled && !destruction )
+                context->threadTracingCount.fetch_sub( 1 );
+        }
+    };
+    static thread_local thread_tracing_owner_t threadTracingOwner;
+
     ///////////////////////////////////////////////////////////////////////////////
     context_t::context_t()
     {
@@ -104,7 +122,7 @@ namespace ze_lib
         // Init the stored ddi tables for the tracing layer
         if( ZE_RESULT_SUCCESS == result )
         {
-            result = zelLoaderTracingLayerInit(this->pTracingZeDdiTable);
+            result = zelLoaderTracingLayerInit(this->pTracingZeDdiTable, this->pTracingZetDdiTable, this->pTracingZesDdiTable);
         }
         // End DDI Table Inits
 
@@ -114,7 +132,7 @@ namespace ze_lib
             // Check which drivers support the ze_driver_flag_t specified
             // No need to check if only initializing sysman
             bool requireDdiReinit = false;
-            result = zelLoaderDriverCheck(flags, desc, &ze_lib::context->initialzeDdiTable.Global, &ze_lib::context->initialzesDdiTable.Global, &requireDdiReinit, sysmanOnly);
+            result = zelLoaderDriverCheck(flags, desc, &requireDdiReinit, sysmanOnly);
             // If a driver was removed from the driver list, then the ddi tables need to be reinit to allow for passthru directly to the driver.
             if (requireDdiReinit) {
                 // If a user has already called the core apis, then ddi table reinit is not possible due to handles already being read by the user.
@@ -153,6 +171,54 @@ namespace ze_lib
         return result;
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// the loader only loads the tracing layer at init if ZE_ENABLE_TRACING_LAYER
+    /// is set, otherwise it is loaded here on the first zelEnableTracingLayer or
+    /// zelTracerCreate; once loaded this is a single atomic load
+    __zedlllocal ze_result_t context_t::tracingLayerLoad()
+    {
+        if( tracingLayerLoaded.load( std::memory_order_acquire ) )
+            return ZE_RESULT_SUCCESS;
+
+        std::lock_guard<std::mutex> lk( tracingLayerLoadMutex );
+        if( tracingLayerLoaded.load( std::memory_order_relaxed ) )
+            return ZE_RESULT_SUCCESS;
+        if( !isInitialized )
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+
+        ze_result_t result = ZE_RESULT_SUCCESS;
+#ifdef DYNAMIC_LOAD_LOADER
+        // an older loader loads the tracing layer at init and has no loading entry point
+        typedef ze_result_t (ZE_APICALL *tracingLayerLoad_t)();
+        auto tracingLayerLoad = reinterpret_cast<tracingLayerLoad_t>(
+                GET_FUNCTION_PTR(loader, "zelLoaderTracingLayerLoad") );
+        if( tracingLayerLoad )
+            result = tracingLayerLoad();
+        if( ZE_RESULT_SUCCESS == result ) {
+            typedef HMODULE (ZE_APICALL *getTracing_t)();
+            auto getTracing = reinterpret_cast<getTracing_t>(
+                GET_FUNCTION_PTR(loader, "zeLoaderGetTracingHandle") );
+            tracing_lib = getTracing();
+        }
+#else
+        result = zelLoaderTracingLayerLoad();
+        if( ZE_RESULT_SUCCESS == result ) {
+            tracing_lib = zeLoaderGetTracingHandle();
+        }
+#endif
+        // the tracer API table is filled from the now loaded tracing layer
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            result = zelTracingDdiTableInit();
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            tracingLayerLoaded.store( true, std::memory_order_release );
+        }
+        return result;
+    }
+
 } // namespace ze_lib
 
 extern "C" {
@@ -199,8 +265,13 @@ zelSetDriverTeardown()
 ze_result_t ZE_APICALL
 zelEnableTracingLayer()
 {
+    auto result = ze_lib::context->tracingLayerLoad();
+    if( ZE_RESULT_SUCCESS != result )
+        return result;
     if (ze_lib::context->tracingLayerEnableCounter.fetch_add(1) == 0) {
         ze_lib::context->zeDdiTable.exchange(ze_lib::context->pTracingZeDdiTable);
+        ze_lib::context->zetDdiTable.exchange(ze_lib::context->pTracingZetDdiTable);
+        ze_lib::context->zesDdiTable.exchange(ze_lib::context->pTracingZesDdiTable);
     }
     return ZE_RESULT_SUCCESS;
 }
@@ -210,6 +281,39 @@ zelDisableTracingLayer()
 {
     if (ze_lib::context->tracingLayerEnableCounter.fetch_sub(1) <= 1) {
         ze_lib::context->zeDdiTable.exchange(&ze_lib::context->initialzeDdiTable);
+        ze_lib::context->zetDdiTable.exchange(&ze_lib::context->initialzetDdiTable);
+        ze_lib::context->zesDdiTable.exchange(&ze_lib::context->initialzesDdiTable);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zelEnableTracingLayerForThread()
+{
+    auto result = ze_lib::context->tracingLayerLoad();
+    if( ZE_RESULT_SUCCESS != result )
+        return result;
+    if (ze_lib::context_t::threadTracingEnableCounter++ == 0) {
+        ze_lib::threadTracingOwner.enabled = true;
+        ze_lib::context_t::threadZeDdiTable = ze_lib::context->pTracingZeDdiTable;
+        ze_lib::context_t::threadZetDdiTable = ze_lib::context->pTracingZetDdiTable;
+        ze_lib::context_t::threadZesDdiTable = ze_lib::context->pTracingZesDdiTable;
+        ze_lib::context->threadTracingCount.fetch_add(1);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zelDisableTracingLayerForThread()
+{
+    if (ze_lib::context_t::threadTracingEnableCounter == 0)
+        return ZE_RESULT_SUCCESS;
+    if (--ze_lib::context_t::threadTracingEnableCounter == 0) {
+        ze_lib::threadTracingOwner.enabled = false;
+        ze_lib::context_t::threadZeDdiTable = nullptr;
+        ze_lib::context_t::threadZetDdiTable = nullptr;
+        ze_lib::context_t::threadZesDdiTable = nullptr;
+        ze_lib::context->threadTracingCount.fetch_sub(1);
     }
     return ZE_RESULT_SUCCESS;
 }
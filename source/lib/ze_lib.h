@@ -42,21 +42,67 @@ namespace ze_lib
 
         ze_result_t zeDdiTableInit();
         std::atomic<ze_dditable_t *>  zeDdiTable = {nullptr};
+        // threads which enabled tracing for themselves only
+        std::atomic<uint32_t> threadTracingCount{0};
+
+        //////////////////////////////////////////////////////////////////////
+        /// the tracing table for a thread which enabled tracing for itself,
+        /// the process-wide table otherwise; other threads only read the
+        /// thread-local table while such a thread exists
+        ze_dditable_t *getZeDdiTable()
+        {
+            if( threadTracingCount.load( std::memory_order_relaxed ) != 0 ) {
+                ze_dditable_t *table = threadZeDdiTable;
+                if( table != nullptr )
+                    return table;
+            }
+            return zeDdiTable.load();
+        }
+        static thread_local ze_dditable_t *threadZeDdiTable;
+        static thread_local uint32_t threadTracingEnableCounter;
 
         ze_result_t zetDdiTableInit();
         std::atomic<zet_dditable_t *> zetDdiTable = {nullptr};
 
+        zet_dditable_t *getZetDdiTable()
+        {
+            if( threadTracingCount.load( std::memory_order_relaxed ) != 0 ) {
+                zet_dditable_t *table = threadZetDdiTable;
+                if( table != nullptr )
+                    return table;
+            }
+            return zetDdiTable.load();
+        }
+        static thread_local zet_dditable_t *threadZetDdiTable;
+
         ze_result_t zesDdiTableInit();
         std::atomic<zes_dditable_t *> zesDdiTable = {nullptr};
 
+        zes_dditable_t *getZesDdiTable()
+        {
+            if( threadTracingCount.load( std::memory_order_relaxed ) != 0 ) {
+                zes_dditable_t *table = threadZesDdiTable;
+                if( table != nullptr )
+                    return table;
+            }
+            return zesDdiTable.load();
+        }
+        static thread_local zes_dditable_t *threadZesDdiTable;
+
         ze_result_t zelTracingDdiTableInit();
         zel_tracing_dditable_t  zelTracingDdiTable = {};
         std::atomic<ze_dditable_t *> pTracingZeDdiTable = {nullptr};
+        std::atomic<zet_dditable_t *> pTracingZetDdiTable = {nullptr};
+        std::atomic<zes_dditable_t *> pTracingZesDdiTable = {nullptr};
         ze_dditable_t initialzeDdiTable;
         zet_dditable_t initialzetDdiTable;
         zes_dditable_t initialzesDdiTable;
         std::atomic_uint32_t tracingLayerEnableCounter{0};
 
+        ze_result_t tracingLayerLoad();
+        std::atomic<bool> tracingLayerLoaded{false};
+        std::mutex tracingLayerLoadMutex;
+
         HMODULE tracing_lib = nullptr;
         bool isInitialized = false;
         bool inTeardown = false;
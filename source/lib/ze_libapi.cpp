@@ -118,7 +118,7 @@ zeDriverGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zeDdiTable.load()->Driver.pfnGet;
+    auto pfnGet = ze_lib::context->getZeDdiTable()->Driver.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -247,7 +247,7 @@ zeDriverGetApiVersion(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetApiVersion = ze_lib::context->zeDdiTable.load()->Driver.pfnGetApiVersion;
+    auto pfnGetApiVersion = ze_lib::context->getZeDdiTable()->Driver.pfnGetApiVersion;
     if( nullptr == pfnGetApiVersion ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -289,7 +289,7 @@ zeDriverGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Driver.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZeDdiTable()->Driver.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -327,7 +327,7 @@ zeDriverGetIpcProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcProperties = ze_lib::context->zeDdiTable.load()->Driver.pfnGetIpcProperties;
+    auto pfnGetIpcProperties = ze_lib::context->getZeDdiTable()->Driver.pfnGetIpcProperties;
     if( nullptr == pfnGetIpcProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -378,7 +378,7 @@ zeDriverGetExtensionProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExtensionProperties = ze_lib::context->zeDdiTable.load()->Driver.pfnGetExtensionProperties;
+    auto pfnGetExtensionProperties = ze_lib::context->getZeDdiTable()->Driver.pfnGetExtensionProperties;
     if( nullptr == pfnGetExtensionProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -419,7 +419,7 @@ zeDriverGetExtensionFunctionAddress(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExtensionFunctionAddress = ze_lib::context->zeDdiTable.load()->Driver.pfnGetExtensionFunctionAddress;
+    auto pfnGetExtensionFunctionAddress = ze_lib::context->getZeDdiTable()->Driver.pfnGetExtensionFunctionAddress;
     if( nullptr == pfnGetExtensionFunctionAddress ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -464,7 +464,7 @@ zeDriverGetLastErrorDescription(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLastErrorDescription = ze_lib::context->zeDdiTable.load()->Driver.pfnGetLastErrorDescription;
+    auto pfnGetLastErrorDescription = ze_lib::context->getZeDdiTable()->Driver.pfnGetLastErrorDescription;
     if( nullptr == pfnGetLastErrorDescription ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -514,7 +514,7 @@ zeDeviceGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zeDdiTable.load()->Device.pfnGet;
+    auto pfnGet = ze_lib::context->getZeDdiTable()->Device.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -560,7 +560,7 @@ zeDeviceGetRootDevice(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetRootDevice = ze_lib::context->zeDdiTable.load()->Device.pfnGetRootDevice;
+    auto pfnGetRootDevice = ze_lib::context->getZeDdiTable()->Device.pfnGetRootDevice;
     if( nullptr == pfnGetRootDevice ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -615,7 +615,7 @@ zeDeviceGetSubDevices(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSubDevices = ze_lib::context->zeDdiTable.load()->Device.pfnGetSubDevices;
+    auto pfnGetSubDevices = ze_lib::context->getZeDdiTable()->Device.pfnGetSubDevices;
     if( nullptr == pfnGetSubDevices ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -657,7 +657,7 @@ zeDeviceGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZeDdiTable()->Device.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -699,7 +699,7 @@ zeDeviceGetComputeProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetComputeProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetComputeProperties;
+    auto pfnGetComputeProperties = ze_lib::context->getZeDdiTable()->Device.pfnGetComputeProperties;
     if( nullptr == pfnGetComputeProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -737,7 +737,7 @@ zeDeviceGetModuleProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetModuleProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetModuleProperties;
+    auto pfnGetModuleProperties = ze_lib::context->getZeDdiTable()->Device.pfnGetModuleProperties;
     if( nullptr == pfnGetModuleProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -795,7 +795,7 @@ zeDeviceGetCommandQueueGroupProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCommandQueueGroupProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetCommandQueueGroupProperties;
+    auto pfnGetCommandQueueGroupProperties = ze_lib::context->getZeDdiTable()->Device.pfnGetCommandQueueGroupProperties;
     if( nullptr == pfnGetCommandQueueGroupProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -852,7 +852,7 @@ zeDeviceGetMemoryProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMemoryProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetMemoryProperties;
+    auto pfnGetMemoryProperties = ze_lib::context->getZeDdiTable()->Device.pfnGetMemoryProperties;
     if( nullptr == pfnGetMemoryProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -894,7 +894,7 @@ zeDeviceGetMemoryAccessProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMemoryAccessProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetMemoryAccessProperties;
+    auto pfnGetMemoryAccessProperties = ze_lib::context->getZeDdiTable()->Device.pfnGetMemoryAccessProperties;
     if( nullptr == pfnGetMemoryAccessProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -944,7 +944,7 @@ zeDeviceGetCacheProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCacheProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetCacheProperties;
+    auto pfnGetCacheProperties = ze_lib::context->getZeDdiTable()->Device.pfnGetCacheProperties;
     if( nullptr == pfnGetCacheProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -983,7 +983,7 @@ zeDeviceGetImageProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetImageProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetImageProperties;
+    auto pfnGetImageProperties = ze_lib::context->getZeDdiTable()->Device.pfnGetImageProperties;
     if( nullptr == pfnGetImageProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1021,7 +1021,7 @@ zeDeviceGetExternalMemoryProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExternalMemoryProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetExternalMemoryProperties;
+    auto pfnGetExternalMemoryProperties = ze_lib::context->getZeDdiTable()->Device.pfnGetExternalMemoryProperties;
     if( nullptr == pfnGetExternalMemoryProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1062,7 +1062,7 @@ zeDeviceGetP2PProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetP2PProperties = ze_lib::context->zeDdiTable.load()->Device.pfnGetP2PProperties;
+    auto pfnGetP2PProperties = ze_lib::context->getZeDdiTable()->Device.pfnGetP2PProperties;
     if( nullptr == pfnGetP2PProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1116,7 +1116,7 @@ zeDeviceCanAccessPeer(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCanAccessPeer = ze_lib::context->zeDdiTable.load()->Device.pfnCanAccessPeer;
+    auto pfnCanAccessPeer = ze_lib::context->getZeDdiTable()->Device.pfnCanAccessPeer;
     if( nullptr == pfnCanAccessPeer ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1158,7 +1158,7 @@ zeDeviceGetStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetStatus = ze_lib::context->zeDdiTable.load()->Device.pfnGetStatus;
+    auto pfnGetStatus = ze_lib::context->getZeDdiTable()->Device.pfnGetStatus;
     if( nullptr == pfnGetStatus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1203,7 +1203,7 @@ zeDeviceGetGlobalTimestamps(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetGlobalTimestamps = ze_lib::context->zeDdiTable.load()->Device.pfnGetGlobalTimestamps;
+    auto pfnGetGlobalTimestamps = ze_lib::context->getZeDdiTable()->Device.pfnGetGlobalTimestamps;
     if( nullptr == pfnGetGlobalTimestamps ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1247,7 +1247,7 @@ zeContextCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Context.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZeDdiTable()->Context.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1303,7 +1303,7 @@ zeContextCreateEx(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateEx = ze_lib::context->zeDdiTable.load()->Context.pfnCreateEx;
+    auto pfnCreateEx = ze_lib::context->getZeDdiTable()->Context.pfnCreateEx;
     if( nullptr == pfnCreateEx ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1344,7 +1344,7 @@ zeContextDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Context.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZeDdiTable()->Context.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1384,7 +1384,7 @@ zeContextGetStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetStatus = ze_lib::context->zeDdiTable.load()->Context.pfnGetStatus;
+    auto pfnGetStatus = ze_lib::context->getZeDdiTable()->Context.pfnGetStatus;
     if( nullptr == pfnGetStatus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1438,7 +1438,7 @@ zeCommandQueueCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZeDdiTable()->CommandQueue.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1485,7 +1485,7 @@ zeCommandQueueDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZeDdiTable()->CommandQueue.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1549,7 +1549,7 @@ zeCommandQueueExecuteCommandLists(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnExecuteCommandLists = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnExecuteCommandLists;
+    auto pfnExecuteCommandLists = ze_lib::context->getZeDdiTable()->CommandQueue.pfnExecuteCommandLists;
     if( nullptr == pfnExecuteCommandLists ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1593,7 +1593,7 @@ zeCommandQueueSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSynchronize = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnSynchronize;
+    auto pfnSynchronize = ze_lib::context->getZeDdiTable()->CommandQueue.pfnSynchronize;
     if( nullptr == pfnSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1631,7 +1631,7 @@ zeCommandQueueGetOrdinal(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetOrdinal = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnGetOrdinal;
+    auto pfnGetOrdinal = ze_lib::context->getZeDdiTable()->CommandQueue.pfnGetOrdinal;
     if( nullptr == pfnGetOrdinal ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1669,7 +1669,7 @@ zeCommandQueueGetIndex(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIndex = ze_lib::context->zeDdiTable.load()->CommandQueue.pfnGetIndex;
+    auto pfnGetIndex = ze_lib::context->getZeDdiTable()->CommandQueue.pfnGetIndex;
     if( nullptr == pfnGetIndex ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1718,7 +1718,7 @@ zeCommandListCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->CommandList.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZeDdiTable()->CommandList.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1775,7 +1775,7 @@ zeCommandListCreateImmediate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateImmediate = ze_lib::context->zeDdiTable.load()->CommandList.pfnCreateImmediate;
+    auto pfnCreateImmediate = ze_lib::context->getZeDdiTable()->CommandList.pfnCreateImmediate;
     if( nullptr == pfnCreateImmediate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1816,7 +1816,7 @@ zeCommandListDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->CommandList.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZeDdiTable()->CommandList.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1852,7 +1852,7 @@ zeCommandListClose(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnClose = ze_lib::context->zeDdiTable.load()->CommandList.pfnClose;
+    auto pfnClose = ze_lib::context->getZeDdiTable()->CommandList.pfnClose;
     if( nullptr == pfnClose ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1891,7 +1891,7 @@ zeCommandListReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReset = ze_lib::context->zeDdiTable.load()->CommandList.pfnReset;
+    auto pfnReset = ze_lib::context->getZeDdiTable()->CommandList.pfnReset;
     if( nullptr == pfnReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1950,7 +1950,7 @@ zeCommandListAppendWriteGlobalTimestamp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendWriteGlobalTimestamp = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendWriteGlobalTimestamp;
+    auto pfnAppendWriteGlobalTimestamp = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendWriteGlobalTimestamp;
     if( nullptr == pfnAppendWriteGlobalTimestamp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2003,7 +2003,7 @@ zeCommandListHostSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostSynchronize = ze_lib::context->zeDdiTable.load()->CommandList.pfnHostSynchronize;
+    auto pfnHostSynchronize = ze_lib::context->getZeDdiTable()->CommandList.pfnHostSynchronize;
     if( nullptr == pfnHostSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2041,7 +2041,7 @@ zeCommandListGetDeviceHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDeviceHandle = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetDeviceHandle;
+    auto pfnGetDeviceHandle = ze_lib::context->getZeDdiTable()->CommandList.pfnGetDeviceHandle;
     if( nullptr == pfnGetDeviceHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2079,7 +2079,7 @@ zeCommandListGetContextHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetContextHandle = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetContextHandle;
+    auto pfnGetContextHandle = ze_lib::context->getZeDdiTable()->CommandList.pfnGetContextHandle;
     if( nullptr == pfnGetContextHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2118,7 +2118,7 @@ zeCommandListGetOrdinal(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetOrdinal = ze_lib::context->zeDdiTable.load()->CommandList.pfnGetOrdinal;
+    auto pfnGetOrdinal = ze_lib::context->getZeDdiTable()->CommandList.pfnGetOrdinal;
     if( nullptr == pfnGetOrdinal ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2162,7 +2162,7 @@ zeCommandListImmediateGetIndex(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnImmediateGetIndex = ze_lib::context->zeDdiTable.load()->CommandList.pfnImmediateGetIndex;
+    auto pfnImmediateGetIndex = ze_lib::context->getZeDdiTable()->CommandList.pfnImmediateGetIndex;
     if( nullptr == pfnImmediateGetIndex ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2201,7 +2201,7 @@ zeCommandListIsImmediate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnIsImmediate = ze_lib::context->zeDdiTable.load()->CommandList.pfnIsImmediate;
+    auto pfnIsImmediate = ze_lib::context->getZeDdiTable()->CommandList.pfnIsImmediate;
     if( nullptr == pfnIsImmediate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2259,7 +2259,7 @@ zeCommandListAppendBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendBarrier = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendBarrier;
+    auto pfnAppendBarrier = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendBarrier;
     if( nullptr == pfnAppendBarrier ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2317,7 +2317,7 @@ zeCommandListAppendMemoryRangesBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryRangesBarrier = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryRangesBarrier;
+    auto pfnAppendMemoryRangesBarrier = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendMemoryRangesBarrier;
     if( nullptr == pfnAppendMemoryRangesBarrier ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2360,7 +2360,7 @@ zeContextSystemBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSystemBarrier = ze_lib::context->zeDdiTable.load()->Context.pfnSystemBarrier;
+    auto pfnSystemBarrier = ze_lib::context->getZeDdiTable()->Context.pfnSystemBarrier;
     if( nullptr == pfnSystemBarrier ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2426,7 +2426,7 @@ zeCommandListAppendMemoryCopy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryCopy = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryCopy;
+    auto pfnAppendMemoryCopy = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendMemoryCopy;
     if( nullptr == pfnAppendMemoryCopy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2496,7 +2496,7 @@ zeCommandListAppendMemoryFill(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryFill = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryFill;
+    auto pfnAppendMemoryFill = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendMemoryFill;
     if( nullptr == pfnAppendMemoryFill ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2571,7 +2571,7 @@ zeCommandListAppendMemoryCopyRegion(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryCopyRegion = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryCopyRegion;
+    auto pfnAppendMemoryCopyRegion = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendMemoryCopyRegion;
     if( nullptr == pfnAppendMemoryCopyRegion ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2633,7 +2633,7 @@ zeCommandListAppendMemoryCopyFromContext(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryCopyFromContext = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryCopyFromContext;
+    auto pfnAppendMemoryCopyFromContext = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendMemoryCopyFromContext;
     if( nullptr == pfnAppendMemoryCopyFromContext ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2691,7 +2691,7 @@ zeCommandListAppendImageCopy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopy = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopy;
+    auto pfnAppendImageCopy = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendImageCopy;
     if( nullptr == pfnAppendImageCopy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2751,7 +2751,7 @@ zeCommandListAppendImageCopyRegion(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyRegion = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyRegion;
+    auto pfnAppendImageCopyRegion = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendImageCopyRegion;
     if( nullptr == pfnAppendImageCopyRegion ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2816,7 +2816,7 @@ zeCommandListAppendImageCopyToMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyToMemory = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyToMemory;
+    auto pfnAppendImageCopyToMemory = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendImageCopyToMemory;
     if( nullptr == pfnAppendImageCopyToMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2881,7 +2881,7 @@ zeCommandListAppendImageCopyFromMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyFromMemory = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyFromMemory;
+    auto pfnAppendImageCopyFromMemory = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendImageCopyFromMemory;
     if( nullptr == pfnAppendImageCopyFromMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2942,7 +2942,7 @@ zeCommandListAppendMemoryPrefetch(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryPrefetch = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemoryPrefetch;
+    auto pfnAppendMemoryPrefetch = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendMemoryPrefetch;
     if( nullptr == pfnAppendMemoryPrefetch ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3003,7 +3003,7 @@ zeCommandListAppendMemAdvise(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemAdvise = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendMemAdvise;
+    auto pfnAppendMemAdvise = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendMemAdvise;
     if( nullptr == pfnAppendMemAdvise ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3056,7 +3056,7 @@ zeEventPoolCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->EventPool.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZeDdiTable()->EventPool.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3099,7 +3099,7 @@ zeEventPoolDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->EventPool.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZeDdiTable()->EventPool.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3152,7 +3152,7 @@ zeEventCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Event.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZeDdiTable()->Event.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3198,7 +3198,7 @@ zeEventDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Event.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZeDdiTable()->Event.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3238,7 +3238,7 @@ zeEventPoolGetIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnGetIpcHandle;
+    auto pfnGetIpcHandle = ze_lib::context->getZeDdiTable()->EventPool.pfnGetIpcHandle;
     if( nullptr == pfnGetIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3284,7 +3284,7 @@ zeEventPoolPutIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPutIpcHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnPutIpcHandle;
+    auto pfnPutIpcHandle = ze_lib::context->getZeDdiTable()->EventPool.pfnPutIpcHandle;
     if( nullptr == pfnPutIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3340,7 +3340,7 @@ zeEventPoolOpenIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOpenIpcHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnOpenIpcHandle;
+    auto pfnOpenIpcHandle = ze_lib::context->getZeDdiTable()->EventPool.pfnOpenIpcHandle;
     if( nullptr == pfnOpenIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3377,7 +3377,7 @@ zeEventPoolCloseIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCloseIpcHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnCloseIpcHandle;
+    auto pfnCloseIpcHandle = ze_lib::context->getZeDdiTable()->EventPool.pfnCloseIpcHandle;
     if( nullptr == pfnCloseIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3430,7 +3430,7 @@ zeCommandListAppendSignalEvent(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendSignalEvent = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendSignalEvent;
+    auto pfnAppendSignalEvent = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendSignalEvent;
     if( nullptr == pfnAppendSignalEvent ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3476,7 +3476,7 @@ zeCommandListAppendWaitOnEvents(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendWaitOnEvents = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendWaitOnEvents;
+    auto pfnAppendWaitOnEvents = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendWaitOnEvents;
     if( nullptr == pfnAppendWaitOnEvents ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3521,7 +3521,7 @@ zeEventHostSignal(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostSignal = ze_lib::context->zeDdiTable.load()->Event.pfnHostSignal;
+    auto pfnHostSignal = ze_lib::context->getZeDdiTable()->Event.pfnHostSignal;
     if( nullptr == pfnHostSignal ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3570,7 +3570,7 @@ zeEventHostSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostSynchronize = ze_lib::context->zeDdiTable.load()->Event.pfnHostSynchronize;
+    auto pfnHostSynchronize = ze_lib::context->getZeDdiTable()->Event.pfnHostSynchronize;
     if( nullptr == pfnHostSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3613,7 +3613,7 @@ zeEventQueryStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryStatus = ze_lib::context->zeDdiTable.load()->Event.pfnQueryStatus;
+    auto pfnQueryStatus = ze_lib::context->getZeDdiTable()->Event.pfnQueryStatus;
     if( nullptr == pfnQueryStatus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3661,7 +3661,7 @@ zeCommandListAppendEventReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendEventReset = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendEventReset;
+    auto pfnAppendEventReset = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendEventReset;
     if( nullptr == pfnAppendEventReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3701,7 +3701,7 @@ zeEventHostReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostReset = ze_lib::context->zeDdiTable.load()->Event.pfnHostReset;
+    auto pfnHostReset = ze_lib::context->getZeDdiTable()->Event.pfnHostReset;
     if( nullptr == pfnHostReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3747,7 +3747,7 @@ zeEventQueryKernelTimestamp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryKernelTimestamp = ze_lib::context->zeDdiTable.load()->Event.pfnQueryKernelTimestamp;
+    auto pfnQueryKernelTimestamp = ze_lib::context->getZeDdiTable()->Event.pfnQueryKernelTimestamp;
     if( nullptr == pfnQueryKernelTimestamp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3814,7 +3814,7 @@ zeCommandListAppendQueryKernelTimestamps(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendQueryKernelTimestamps = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendQueryKernelTimestamps;
+    auto pfnAppendQueryKernelTimestamps = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendQueryKernelTimestamps;
     if( nullptr == pfnAppendQueryKernelTimestamps ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3852,7 +3852,7 @@ zeEventGetEventPool(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetEventPool = ze_lib::context->zeDdiTable.load()->Event.pfnGetEventPool;
+    auto pfnGetEventPool = ze_lib::context->getZeDdiTable()->Event.pfnGetEventPool;
     if( nullptr == pfnGetEventPool ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3892,7 +3892,7 @@ zeEventGetSignalScope(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSignalScope = ze_lib::context->zeDdiTable.load()->Event.pfnGetSignalScope;
+    auto pfnGetSignalScope = ze_lib::context->getZeDdiTable()->Event.pfnGetSignalScope;
     if( nullptr == pfnGetSignalScope ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3932,7 +3932,7 @@ zeEventGetWaitScope(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetWaitScope = ze_lib::context->zeDdiTable.load()->Event.pfnGetWaitScope;
+    auto pfnGetWaitScope = ze_lib::context->getZeDdiTable()->Event.pfnGetWaitScope;
     if( nullptr == pfnGetWaitScope ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3970,7 +3970,7 @@ zeEventPoolGetContextHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetContextHandle = ze_lib::context->zeDdiTable.load()->EventPool.pfnGetContextHandle;
+    auto pfnGetContextHandle = ze_lib::context->getZeDdiTable()->EventPool.pfnGetContextHandle;
     if( nullptr == pfnGetContextHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4009,7 +4009,7 @@ zeEventPoolGetFlags(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFlags = ze_lib::context->zeDdiTable.load()->EventPool.pfnGetFlags;
+    auto pfnGetFlags = ze_lib::context->getZeDdiTable()->EventPool.pfnGetFlags;
     if( nullptr == pfnGetFlags ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4059,7 +4059,7 @@ zeFenceCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Fence.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZeDdiTable()->Fence.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4104,7 +4104,7 @@ zeFenceDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Fence.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZeDdiTable()->Fence.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4153,7 +4153,7 @@ zeFenceHostSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostSynchronize = ze_lib::context->zeDdiTable.load()->Fence.pfnHostSynchronize;
+    auto pfnHostSynchronize = ze_lib::context->getZeDdiTable()->Fence.pfnHostSynchronize;
     if( nullptr == pfnHostSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4195,7 +4195,7 @@ zeFenceQueryStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryStatus = ze_lib::context->zeDdiTable.load()->Fence.pfnQueryStatus;
+    auto pfnQueryStatus = ze_lib::context->getZeDdiTable()->Fence.pfnQueryStatus;
     if( nullptr == pfnQueryStatus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4234,7 +4234,7 @@ zeFenceReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReset = ze_lib::context->zeDdiTable.load()->Fence.pfnReset;
+    auto pfnReset = ze_lib::context->getZeDdiTable()->Fence.pfnReset;
     if( nullptr == pfnReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4277,7 +4277,7 @@ zeImageGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Image.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZeDdiTable()->Image.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4329,7 +4329,7 @@ zeImageCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Image.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZeDdiTable()->Image.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4370,7 +4370,7 @@ zeImageDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Image.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZeDdiTable()->Image.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4440,7 +4440,7 @@ zeMemAllocShared(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAllocShared = ze_lib::context->zeDdiTable.load()->Mem.pfnAllocShared;
+    auto pfnAllocShared = ze_lib::context->getZeDdiTable()->Mem.pfnAllocShared;
     if( nullptr == pfnAllocShared ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4498,7 +4498,7 @@ zeMemAllocDevice(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAllocDevice = ze_lib::context->zeDdiTable.load()->Mem.pfnAllocDevice;
+    auto pfnAllocDevice = ze_lib::context->getZeDdiTable()->Mem.pfnAllocDevice;
     if( nullptr == pfnAllocDevice ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4556,7 +4556,7 @@ zeMemAllocHost(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAllocHost = ze_lib::context->zeDdiTable.load()->Mem.pfnAllocHost;
+    auto pfnAllocHost = ze_lib::context->getZeDdiTable()->Mem.pfnAllocHost;
     if( nullptr == pfnAllocHost ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4600,7 +4600,7 @@ zeMemFree(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnFree = ze_lib::context->zeDdiTable.load()->Mem.pfnFree;
+    auto pfnFree = ze_lib::context->getZeDdiTable()->Mem.pfnFree;
     if( nullptr == pfnFree ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4645,7 +4645,7 @@ zeMemGetAllocProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAllocProperties = ze_lib::context->zeDdiTable.load()->Mem.pfnGetAllocProperties;
+    auto pfnGetAllocProperties = ze_lib::context->getZeDdiTable()->Mem.pfnGetAllocProperties;
     if( nullptr == pfnGetAllocProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4684,7 +4684,7 @@ zeMemGetAddressRange(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAddressRange = ze_lib::context->zeDdiTable.load()->Mem.pfnGetAddressRange;
+    auto pfnGetAddressRange = ze_lib::context->getZeDdiTable()->Mem.pfnGetAddressRange;
     if( nullptr == pfnGetAddressRange ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4729,7 +4729,7 @@ zeMemGetIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcHandle = ze_lib::context->zeDdiTable.load()->Mem.pfnGetIpcHandle;
+    auto pfnGetIpcHandle = ze_lib::context->getZeDdiTable()->Mem.pfnGetIpcHandle;
     if( nullptr == pfnGetIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4772,7 +4772,7 @@ zeMemGetIpcHandleFromFileDescriptorExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcHandleFromFileDescriptorExp = ze_lib::context->zeDdiTable.load()->MemExp.pfnGetIpcHandleFromFileDescriptorExp;
+    auto pfnGetIpcHandleFromFileDescriptorExp = ze_lib::context->getZeDdiTable()->MemExp.pfnGetIpcHandleFromFileDescriptorExp;
     if( nullptr == pfnGetIpcHandleFromFileDescriptorExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4813,7 +4813,7 @@ zeMemGetFileDescriptorFromIpcHandleExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFileDescriptorFromIpcHandleExp = ze_lib::context->zeDdiTable.load()->MemExp.pfnGetFileDescriptorFromIpcHandleExp;
+    auto pfnGetFileDescriptorFromIpcHandleExp = ze_lib::context->getZeDdiTable()->MemExp.pfnGetFileDescriptorFromIpcHandleExp;
     if( nullptr == pfnGetFileDescriptorFromIpcHandleExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4858,7 +4858,7 @@ zeMemPutIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPutIpcHandle = ze_lib::context->zeDdiTable.load()->Mem.pfnPutIpcHandle;
+    auto pfnPutIpcHandle = ze_lib::context->getZeDdiTable()->Mem.pfnPutIpcHandle;
     if( nullptr == pfnPutIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4910,7 +4910,7 @@ zeMemOpenIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOpenIpcHandle = ze_lib::context->zeDdiTable.load()->Mem.pfnOpenIpcHandle;
+    auto pfnOpenIpcHandle = ze_lib::context->getZeDdiTable()->Mem.pfnOpenIpcHandle;
     if( nullptr == pfnOpenIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4951,7 +4951,7 @@ zeMemCloseIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCloseIpcHandle = ze_lib::context->zeDdiTable.load()->Mem.pfnCloseIpcHandle;
+    auto pfnCloseIpcHandle = ze_lib::context->getZeDdiTable()->Mem.pfnCloseIpcHandle;
     if( nullptr == pfnCloseIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5012,7 +5012,7 @@ zeMemSetAtomicAccessAttributeExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetAtomicAccessAttributeExp = ze_lib::context->zeDdiTable.load()->MemExp.pfnSetAtomicAccessAttributeExp;
+    auto pfnSetAtomicAccessAttributeExp = ze_lib::context->getZeDdiTable()->MemExp.pfnSetAtomicAccessAttributeExp;
     if( nullptr == pfnSetAtomicAccessAttributeExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5057,7 +5057,7 @@ zeMemGetAtomicAccessAttributeExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAtomicAccessAttributeExp = ze_lib::context->zeDdiTable.load()->MemExp.pfnGetAtomicAccessAttributeExp;
+    auto pfnGetAtomicAccessAttributeExp = ze_lib::context->getZeDdiTable()->MemExp.pfnGetAtomicAccessAttributeExp;
     if( nullptr == pfnGetAtomicAccessAttributeExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5116,7 +5116,7 @@ zeModuleCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Module.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZeDdiTable()->Module.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5159,7 +5159,7 @@ zeModuleDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Module.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZeDdiTable()->Module.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5224,7 +5224,7 @@ zeModuleDynamicLink(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDynamicLink = ze_lib::context->zeDdiTable.load()->Module.pfnDynamicLink;
+    auto pfnDynamicLink = ze_lib::context->getZeDdiTable()->Module.pfnDynamicLink;
     if( nullptr == pfnDynamicLink ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5265,7 +5265,7 @@ zeModuleBuildLogDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->ModuleBuildLog.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZeDdiTable()->ModuleBuildLog.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5306,7 +5306,7 @@ zeModuleBuildLogGetString(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetString = ze_lib::context->zeDdiTable.load()->ModuleBuildLog.pfnGetString;
+    auto pfnGetString = ze_lib::context->getZeDdiTable()->ModuleBuildLog.pfnGetString;
     if( nullptr == pfnGetString ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5353,7 +5353,7 @@ zeModuleGetNativeBinary(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetNativeBinary = ze_lib::context->zeDdiTable.load()->Module.pfnGetNativeBinary;
+    auto pfnGetNativeBinary = ze_lib::context->getZeDdiTable()->Module.pfnGetNativeBinary;
     if( nullptr == pfnGetNativeBinary ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5398,7 +5398,7 @@ zeModuleGetGlobalPointer(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetGlobalPointer = ze_lib::context->zeDdiTable.load()->Module.pfnGetGlobalPointer;
+    auto pfnGetGlobalPointer = ze_lib::context->getZeDdiTable()->Module.pfnGetGlobalPointer;
     if( nullptr == pfnGetGlobalPointer ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5443,7 +5443,7 @@ zeModuleGetKernelNames(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetKernelNames = ze_lib::context->zeDdiTable.load()->Module.pfnGetKernelNames;
+    auto pfnGetKernelNames = ze_lib::context->getZeDdiTable()->Module.pfnGetKernelNames;
     if( nullptr == pfnGetKernelNames ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5481,7 +5481,7 @@ zeModuleGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Module.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZeDdiTable()->Module.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5528,7 +5528,7 @@ zeKernelCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Kernel.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZeDdiTable()->Kernel.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5569,7 +5569,7 @@ zeKernelDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Kernel.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZeDdiTable()->Kernel.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5615,7 +5615,7 @@ zeModuleGetFunctionPointer(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFunctionPointer = ze_lib::context->zeDdiTable.load()->Module.pfnGetFunctionPointer;
+    auto pfnGetFunctionPointer = ze_lib::context->getZeDdiTable()->Module.pfnGetFunctionPointer;
     if( nullptr == pfnGetFunctionPointer ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5657,7 +5657,7 @@ zeKernelSetGroupSize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetGroupSize = ze_lib::context->zeDdiTable.load()->Kernel.pfnSetGroupSize;
+    auto pfnSetGroupSize = ze_lib::context->getZeDdiTable()->Kernel.pfnSetGroupSize;
     if( nullptr == pfnSetGroupSize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5706,7 +5706,7 @@ zeKernelSuggestGroupSize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSuggestGroupSize = ze_lib::context->zeDdiTable.load()->Kernel.pfnSuggestGroupSize;
+    auto pfnSuggestGroupSize = ze_lib::context->getZeDdiTable()->Kernel.pfnSuggestGroupSize;
     if( nullptr == pfnSuggestGroupSize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5744,7 +5744,7 @@ zeKernelSuggestMaxCooperativeGroupCount(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSuggestMaxCooperativeGroupCount = ze_lib::context->zeDdiTable.load()->Kernel.pfnSuggestMaxCooperativeGroupCount;
+    auto pfnSuggestMaxCooperativeGroupCount = ze_lib::context->getZeDdiTable()->Kernel.pfnSuggestMaxCooperativeGroupCount;
     if( nullptr == pfnSuggestMaxCooperativeGroupCount ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5788,7 +5788,7 @@ zeKernelSetArgumentValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetArgumentValue = ze_lib::context->zeDdiTable.load()->Kernel.pfnSetArgumentValue;
+    auto pfnSetArgumentValue = ze_lib::context->getZeDdiTable()->Kernel.pfnSetArgumentValue;
     if( nullptr == pfnSetArgumentValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5830,7 +5830,7 @@ zeKernelSetIndirectAccess(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetIndirectAccess = ze_lib::context->zeDdiTable.load()->Kernel.pfnSetIndirectAccess;
+    auto pfnSetIndirectAccess = ze_lib::context->getZeDdiTable()->Kernel.pfnSetIndirectAccess;
     if( nullptr == pfnSetIndirectAccess ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5869,7 +5869,7 @@ zeKernelGetIndirectAccess(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIndirectAccess = ze_lib::context->zeDdiTable.load()->Kernel.pfnGetIndirectAccess;
+    auto pfnGetIndirectAccess = ze_lib::context->getZeDdiTable()->Kernel.pfnGetIndirectAccess;
     if( nullptr == pfnGetIndirectAccess ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5917,7 +5917,7 @@ zeKernelGetSourceAttributes(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSourceAttributes = ze_lib::context->zeDdiTable.load()->Kernel.pfnGetSourceAttributes;
+    auto pfnGetSourceAttributes = ze_lib::context->getZeDdiTable()->Kernel.pfnGetSourceAttributes;
     if( nullptr == pfnGetSourceAttributes ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5960,7 +5960,7 @@ zeKernelSetCacheConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetCacheConfig = ze_lib::context->zeDdiTable.load()->Kernel.pfnSetCacheConfig;
+    auto pfnSetCacheConfig = ze_lib::context->getZeDdiTable()->Kernel.pfnSetCacheConfig;
     if( nullptr == pfnSetCacheConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5998,7 +5998,7 @@ zeKernelGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.load()->Kernel.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZeDdiTable()->Kernel.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6041,7 +6041,7 @@ zeKernelGetName(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetName = ze_lib::context->zeDdiTable.load()->Kernel.pfnGetName;
+    auto pfnGetName = ze_lib::context->getZeDdiTable()->Kernel.pfnGetName;
     if( nullptr == pfnGetName ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6096,7 +6096,7 @@ zeCommandListAppendLaunchKernel(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchKernel = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchKernel;
+    auto pfnAppendLaunchKernel = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendLaunchKernel;
     if( nullptr == pfnAppendLaunchKernel ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6155,7 +6155,7 @@ zeCommandListAppendLaunchCooperativeKernel(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchCooperativeKernel = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchCooperativeKernel;
+    auto pfnAppendLaunchCooperativeKernel = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendLaunchCooperativeKernel;
     if( nullptr == pfnAppendLaunchCooperativeKernel ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6216,7 +6216,7 @@ zeCommandListAppendLaunchKernelIndirect(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchKernelIndirect = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchKernelIndirect;
+    auto pfnAppendLaunchKernelIndirect = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendLaunchKernelIndirect;
     if( nullptr == pfnAppendLaunchKernelIndirect ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6284,7 +6284,7 @@ zeCommandListAppendLaunchMultipleKernelsIndirect(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchMultipleKernelsIndirect = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendLaunchMultipleKernelsIndirect;
+    auto pfnAppendLaunchMultipleKernelsIndirect = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendLaunchMultipleKernelsIndirect;
     if( nullptr == pfnAppendLaunchMultipleKernelsIndirect ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6329,7 +6329,7 @@ zeContextMakeMemoryResident(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnMakeMemoryResident = ze_lib::context->zeDdiTable.load()->Context.pfnMakeMemoryResident;
+    auto pfnMakeMemoryResident = ze_lib::context->getZeDdiTable()->Context.pfnMakeMemoryResident;
     if( nullptr == pfnMakeMemoryResident ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6374,7 +6374,7 @@ zeContextEvictMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEvictMemory = ze_lib::context->zeDdiTable.load()->Context.pfnEvictMemory;
+    auto pfnEvictMemory = ze_lib::context->getZeDdiTable()->Context.pfnEvictMemory;
     if( nullptr == pfnEvictMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6415,7 +6415,7 @@ zeContextMakeImageResident(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnMakeImageResident = ze_lib::context->zeDdiTable.load()->Context.pfnMakeImageResident;
+    auto pfnMakeImageResident = ze_lib::context->getZeDdiTable()->Context.pfnMakeImageResident;
     if( nullptr == pfnMakeImageResident ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6458,7 +6458,7 @@ zeContextEvictImage(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEvictImage = ze_lib::context->zeDdiTable.load()->Context.pfnEvictImage;
+    auto pfnEvictImage = ze_lib::context->getZeDdiTable()->Context.pfnEvictImage;
     if( nullptr == pfnEvictImage ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6505,7 +6505,7 @@ zeSamplerCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->Sampler.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZeDdiTable()->Sampler.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6546,7 +6546,7 @@ zeSamplerDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->Sampler.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZeDdiTable()->Sampler.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6598,7 +6598,7 @@ zeVirtualMemReserve(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReserve = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnReserve;
+    auto pfnReserve = ze_lib::context->getZeDdiTable()->VirtualMem.pfnReserve;
     if( nullptr == pfnReserve ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6643,7 +6643,7 @@ zeVirtualMemFree(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnFree = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnFree;
+    auto pfnFree = ze_lib::context->getZeDdiTable()->VirtualMem.pfnFree;
     if( nullptr == pfnFree ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6688,7 +6688,7 @@ zeVirtualMemQueryPageSize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryPageSize = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnQueryPageSize;
+    auto pfnQueryPageSize = ze_lib::context->getZeDdiTable()->VirtualMem.pfnQueryPageSize;
     if( nullptr == pfnQueryPageSize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6741,7 +6741,7 @@ zePhysicalMemCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.load()->PhysicalMem.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZeDdiTable()->PhysicalMem.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6782,7 +6782,7 @@ zePhysicalMemDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.load()->PhysicalMem.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZeDdiTable()->PhysicalMem.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6842,7 +6842,7 @@ zeVirtualMemMap(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnMap = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnMap;
+    auto pfnMap = ze_lib::context->getZeDdiTable()->VirtualMem.pfnMap;
     if( nullptr == pfnMap ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6889,7 +6889,7 @@ zeVirtualMemUnmap(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnUnmap = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnUnmap;
+    auto pfnUnmap = ze_lib::context->getZeDdiTable()->VirtualMem.pfnUnmap;
     if( nullptr == pfnUnmap ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6938,7 +6938,7 @@ zeVirtualMemSetAccessAttribute(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetAccessAttribute = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnSetAccessAttribute;
+    auto pfnSetAccessAttribute = ze_lib::context->getZeDdiTable()->VirtualMem.pfnSetAccessAttribute;
     if( nullptr == pfnSetAccessAttribute ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6990,7 +6990,7 @@ zeVirtualMemGetAccessAttribute(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAccessAttribute = ze_lib::context->zeDdiTable.load()->VirtualMem.pfnGetAccessAttribute;
+    auto pfnGetAccessAttribute = ze_lib::context->getZeDdiTable()->VirtualMem.pfnGetAccessAttribute;
     if( nullptr == pfnGetAccessAttribute ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7031,7 +7031,7 @@ zeKernelSetGlobalOffsetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetGlobalOffsetExp = ze_lib::context->zeDdiTable.load()->KernelExp.pfnSetGlobalOffsetExp;
+    auto pfnSetGlobalOffsetExp = ze_lib::context->getZeDdiTable()->KernelExp.pfnSetGlobalOffsetExp;
     if( nullptr == pfnSetGlobalOffsetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7077,7 +7077,7 @@ zeCommandListGetNextCommandIdExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetNextCommandIdExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnGetNextCommandIdExp;
+    auto pfnGetNextCommandIdExp = ze_lib::context->getZeDdiTable()->CommandListExp.pfnGetNextCommandIdExp;
     if( nullptr == pfnGetNextCommandIdExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7129,7 +7129,7 @@ zeCommandListGetNextCommandIdWithKernelsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetNextCommandIdWithKernelsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnGetNextCommandIdWithKernelsExp;
+    auto pfnGetNextCommandIdWithKernelsExp = ze_lib::context->getZeDdiTable()->CommandListExp.pfnGetNextCommandIdWithKernelsExp;
     if( nullptr == pfnGetNextCommandIdWithKernelsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7176,7 +7176,7 @@ zeCommandListUpdateMutableCommandsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnUpdateMutableCommandsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnUpdateMutableCommandsExp;
+    auto pfnUpdateMutableCommandsExp = ze_lib::context->getZeDdiTable()->CommandListExp.pfnUpdateMutableCommandsExp;
     if( nullptr == pfnUpdateMutableCommandsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7222,7 +7222,7 @@ zeCommandListUpdateMutableCommandSignalEventExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnUpdateMutableCommandSignalEventExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnUpdateMutableCommandSignalEventExp;
+    auto pfnUpdateMutableCommandSignalEventExp = ze_lib::context->getZeDdiTable()->CommandListExp.pfnUpdateMutableCommandSignalEventExp;
     if( nullptr == pfnUpdateMutableCommandSignalEventExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7277,7 +7277,7 @@ zeCommandListUpdateMutableCommandWaitEventsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnUpdateMutableCommandWaitEventsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnUpdateMutableCommandWaitEventsExp;
+    auto pfnUpdateMutableCommandWaitEventsExp = ze_lib::context->getZeDdiTable()->CommandListExp.pfnUpdateMutableCommandWaitEventsExp;
     if( nullptr == pfnUpdateMutableCommandWaitEventsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7330,7 +7330,7 @@ zeCommandListUpdateMutableCommandKernelsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnUpdateMutableCommandKernelsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnUpdateMutableCommandKernelsExp;
+    auto pfnUpdateMutableCommandKernelsExp = ze_lib::context->getZeDdiTable()->CommandListExp.pfnUpdateMutableCommandKernelsExp;
     if( nullptr == pfnUpdateMutableCommandKernelsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7374,7 +7374,7 @@ zeDeviceReserveCacheExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReserveCacheExt = ze_lib::context->zeDdiTable.load()->Device.pfnReserveCacheExt;
+    auto pfnReserveCacheExt = ze_lib::context->getZeDdiTable()->Device.pfnReserveCacheExt;
     if( nullptr == pfnReserveCacheExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7416,7 +7416,7 @@ zeDeviceSetCacheAdviceExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetCacheAdviceExt = ze_lib::context->zeDdiTable.load()->Device.pfnSetCacheAdviceExt;
+    auto pfnSetCacheAdviceExt = ze_lib::context->getZeDdiTable()->Device.pfnSetCacheAdviceExt;
     if( nullptr == pfnSetCacheAdviceExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7475,7 +7475,7 @@ zeEventQueryTimestampsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryTimestampsExp = ze_lib::context->zeDdiTable.load()->EventExp.pfnQueryTimestampsExp;
+    auto pfnQueryTimestampsExp = ze_lib::context->getZeDdiTable()->EventExp.pfnQueryTimestampsExp;
     if( nullptr == pfnQueryTimestampsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7519,7 +7519,7 @@ zeImageGetMemoryPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMemoryPropertiesExp = ze_lib::context->zeDdiTable.load()->ImageExp.pfnGetMemoryPropertiesExp;
+    auto pfnGetMemoryPropertiesExp = ze_lib::context->getZeDdiTable()->ImageExp.pfnGetMemoryPropertiesExp;
     if( nullptr == pfnGetMemoryPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7580,7 +7580,7 @@ zeImageViewCreateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnViewCreateExt = ze_lib::context->zeDdiTable.load()->Image.pfnViewCreateExt;
+    auto pfnViewCreateExt = ze_lib::context->getZeDdiTable()->Image.pfnViewCreateExt;
     if( nullptr == pfnViewCreateExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7644,7 +7644,7 @@ zeImageViewCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnViewCreateExp = ze_lib::context->zeDdiTable.load()->ImageExp.pfnViewCreateExp;
+    auto pfnViewCreateExp = ze_lib::context->getZeDdiTable()->ImageExp.pfnViewCreateExp;
     if( nullptr == pfnViewCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7691,7 +7691,7 @@ zeKernelSchedulingHintExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSchedulingHintExp = ze_lib::context->zeDdiTable.load()->KernelExp.pfnSchedulingHintExp;
+    auto pfnSchedulingHintExp = ze_lib::context->getZeDdiTable()->KernelExp.pfnSchedulingHintExp;
     if( nullptr == pfnSchedulingHintExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7733,7 +7733,7 @@ zeDevicePciGetPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetPropertiesExt = ze_lib::context->zeDdiTable.load()->Device.pfnPciGetPropertiesExt;
+    auto pfnPciGetPropertiesExt = ze_lib::context->getZeDdiTable()->Device.pfnPciGetPropertiesExt;
     if( nullptr == pfnPciGetPropertiesExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7812,7 +7812,7 @@ zeCommandListAppendImageCopyToMemoryExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyToMemoryExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyToMemoryExt;
+    auto pfnAppendImageCopyToMemoryExt = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendImageCopyToMemoryExt;
     if( nullptr == pfnAppendImageCopyToMemoryExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7891,7 +7891,7 @@ zeCommandListAppendImageCopyFromMemoryExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyFromMemoryExt = ze_lib::context->zeDdiTable.load()->CommandList.pfnAppendImageCopyFromMemoryExt;
+    auto pfnAppendImageCopyFromMemoryExt = ze_lib::context->getZeDdiTable()->CommandList.pfnAppendImageCopyFromMemoryExt;
     if( nullptr == pfnAppendImageCopyFromMemoryExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7930,7 +7930,7 @@ zeImageGetAllocPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAllocPropertiesExt = ze_lib::context->zeDdiTable.load()->Image.pfnGetAllocPropertiesExt;
+    auto pfnGetAllocPropertiesExt = ze_lib::context->getZeDdiTable()->Image.pfnGetAllocPropertiesExt;
     if( nullptr == pfnGetAllocPropertiesExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -7978,7 +7978,7 @@ zeModuleInspectLinkageExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnInspectLinkageExt = ze_lib::context->zeDdiTable.load()->Module.pfnInspectLinkageExt;
+    auto pfnInspectLinkageExt = ze_lib::context->getZeDdiTable()->Module.pfnInspectLinkageExt;
     if( nullptr == pfnInspectLinkageExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8023,7 +8023,7 @@ zeMemFreeExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnFreeExt = ze_lib::context->zeDdiTable.load()->Mem.pfnFreeExt;
+    auto pfnFreeExt = ze_lib::context->getZeDdiTable()->Mem.pfnFreeExt;
     if( nullptr == pfnFreeExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8071,7 +8071,7 @@ zeFabricVertexGetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExp = ze_lib::context->zeDdiTable.load()->FabricVertexExp.pfnGetExp;
+    auto pfnGetExp = ze_lib::context->getZeDdiTable()->FabricVertexExp.pfnGetExp;
     if( nullptr == pfnGetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8121,7 +8121,7 @@ zeFabricVertexGetSubVerticesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSubVerticesExp = ze_lib::context->zeDdiTable.load()->FabricVertexExp.pfnGetSubVerticesExp;
+    auto pfnGetSubVerticesExp = ze_lib::context->getZeDdiTable()->FabricVertexExp.pfnGetSubVerticesExp;
     if( nullptr == pfnGetSubVerticesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8159,7 +8159,7 @@ zeFabricVertexGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPropertiesExp = ze_lib::context->zeDdiTable.load()->FabricVertexExp.pfnGetPropertiesExp;
+    auto pfnGetPropertiesExp = ze_lib::context->getZeDdiTable()->FabricVertexExp.pfnGetPropertiesExp;
     if( nullptr == pfnGetPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8201,7 +8201,7 @@ zeFabricVertexGetDeviceExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDeviceExp = ze_lib::context->zeDdiTable.load()->FabricVertexExp.pfnGetDeviceExp;
+    auto pfnGetDeviceExp = ze_lib::context->getZeDdiTable()->FabricVertexExp.pfnGetDeviceExp;
     if( nullptr == pfnGetDeviceExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8241,7 +8241,7 @@ zeDeviceGetFabricVertexExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFabricVertexExp = ze_lib::context->zeDdiTable.load()->DeviceExp.pfnGetFabricVertexExp;
+    auto pfnGetFabricVertexExp = ze_lib::context->getZeDdiTable()->DeviceExp.pfnGetFabricVertexExp;
     if( nullptr == pfnGetFabricVertexExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8291,7 +8291,7 @@ zeFabricEdgeGetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExp = ze_lib::context->zeDdiTable.load()->FabricEdgeExp.pfnGetExp;
+    auto pfnGetExp = ze_lib::context->getZeDdiTable()->FabricEdgeExp.pfnGetExp;
     if( nullptr == pfnGetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8333,7 +8333,7 @@ zeFabricEdgeGetVerticesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVerticesExp = ze_lib::context->zeDdiTable.load()->FabricEdgeExp.pfnGetVerticesExp;
+    auto pfnGetVerticesExp = ze_lib::context->getZeDdiTable()->FabricEdgeExp.pfnGetVerticesExp;
     if( nullptr == pfnGetVerticesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8371,7 +8371,7 @@ zeFabricEdgeGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPropertiesExp = ze_lib::context->zeDdiTable.load()->FabricEdgeExp.pfnGetPropertiesExp;
+    auto pfnGetPropertiesExp = ze_lib::context->getZeDdiTable()->FabricEdgeExp.pfnGetPropertiesExp;
     if( nullptr == pfnGetPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8443,7 +8443,7 @@ zeEventQueryKernelTimestampsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryKernelTimestampsExt = ze_lib::context->zeDdiTable.load()->Event.pfnQueryKernelTimestampsExt;
+    auto pfnQueryKernelTimestampsExt = ze_lib::context->getZeDdiTable()->Event.pfnQueryKernelTimestampsExt;
     if( nullptr == pfnQueryKernelTimestampsExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8487,7 +8487,7 @@ zeRTASBuilderCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExp = ze_lib::context->zeDdiTable.load()->RTASBuilderExp.pfnCreateExp;
+    auto pfnCreateExp = ze_lib::context->getZeDdiTable()->RTASBuilderExp.pfnCreateExp;
     if( nullptr == pfnCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8531,7 +8531,7 @@ zeRTASBuilderGetBuildPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetBuildPropertiesExp = ze_lib::context->zeDdiTable.load()->RTASBuilderExp.pfnGetBuildPropertiesExp;
+    auto pfnGetBuildPropertiesExp = ze_lib::context->getZeDdiTable()->RTASBuilderExp.pfnGetBuildPropertiesExp;
     if( nullptr == pfnGetBuildPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8575,7 +8575,7 @@ zeDriverRTASFormatCompatibilityCheckExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnRTASFormatCompatibilityCheckExp = ze_lib::context->zeDdiTable.load()->DriverExp.pfnRTASFormatCompatibilityCheckExp;
+    auto pfnRTASFormatCompatibilityCheckExp = ze_lib::context->getZeDdiTable()->DriverExp.pfnRTASFormatCompatibilityCheckExp;
     if( nullptr == pfnRTASFormatCompatibilityCheckExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8679,7 +8679,7 @@ zeRTASBuilderBuildExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnBuildExp = ze_lib::context->zeDdiTable.load()->RTASBuilderExp.pfnBuildExp;
+    auto pfnBuildExp = ze_lib::context->getZeDdiTable()->RTASBuilderExp.pfnBuildExp;
     if( nullptr == pfnBuildExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8718,7 +8718,7 @@ zeRTASBuilderDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExp = ze_lib::context->zeDdiTable.load()->RTASBuilderExp.pfnDestroyExp;
+    auto pfnDestroyExp = ze_lib::context->getZeDdiTable()->RTASBuilderExp.pfnDestroyExp;
     if( nullptr == pfnDestroyExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8759,7 +8759,7 @@ zeRTASParallelOperationCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExp = ze_lib::context->zeDdiTable.load()->RTASParallelOperationExp.pfnCreateExp;
+    auto pfnCreateExp = ze_lib::context->getZeDdiTable()->RTASParallelOperationExp.pfnCreateExp;
     if( nullptr == pfnCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8803,7 +8803,7 @@ zeRTASParallelOperationGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPropertiesExp = ze_lib::context->zeDdiTable.load()->RTASParallelOperationExp.pfnGetPropertiesExp;
+    auto pfnGetPropertiesExp = ze_lib::context->getZeDdiTable()->RTASParallelOperationExp.pfnGetPropertiesExp;
     if( nullptr == pfnGetPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8838,7 +8838,7 @@ zeRTASParallelOperationJoinExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnJoinExp = ze_lib::context->zeDdiTable.load()->RTASParallelOperationExp.pfnJoinExp;
+    auto pfnJoinExp = ze_lib::context->getZeDdiTable()->RTASParallelOperationExp.pfnJoinExp;
     if( nullptr == pfnJoinExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8878,7 +8878,7 @@ zeRTASParallelOperationDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExp = ze_lib::context->zeDdiTable.load()->RTASParallelOperationExp.pfnDestroyExp;
+    auto pfnDestroyExp = ze_lib::context->getZeDdiTable()->RTASParallelOperationExp.pfnDestroyExp;
     if( nullptr == pfnDestroyExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8924,7 +8924,7 @@ zeMemGetPitchFor2dImage(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPitchFor2dImage = ze_lib::context->zeDdiTable.load()->Mem.pfnGetPitchFor2dImage;
+    auto pfnGetPitchFor2dImage = ze_lib::context->getZeDdiTable()->Mem.pfnGetPitchFor2dImage;
     if( nullptr == pfnGetPitchFor2dImage ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -8965,7 +8965,7 @@ zeImageGetDeviceOffsetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDeviceOffsetExp = ze_lib::context->zeDdiTable.load()->ImageExp.pfnGetDeviceOffsetExp;
+    auto pfnGetDeviceOffsetExp = ze_lib::context->getZeDdiTable()->ImageExp.pfnGetDeviceOffsetExp;
     if( nullptr == pfnGetDeviceOffsetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9014,7 +9014,7 @@ zeCommandListCreateCloneExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateCloneExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnCreateCloneExp;
+    auto pfnCreateCloneExp = ze_lib::context->getZeDdiTable()->CommandListExp.pfnCreateCloneExp;
     if( nullptr == pfnCreateCloneExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -9067,7 +9067,7 @@ zeCommandListImmediateAppendCommandListsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnImmediateAppendCommandListsExp = ze_lib::context->zeDdiTable.load()->CommandListExp.pfnImmediateAppendCommandListsExp;
+    auto pfnImmediateAppendCommandListsExp = ze_lib::context->getZeDdiTable()->CommandListExp.pfnImmediateAppendCommandListsExp;
     if( nullptr == pfnImmediateAppendCommandListsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -38,6 +38,8 @@ zelTracerCreate(
 {
     if(ze_lib::context->inTeardown)
         return ZE_RESULT_ERROR_UNINITIALIZED;
+    if( ZE_RESULT_SUCCESS != ze_lib::context->tracingLayerLoad() )
+        return ZE_RESULT_ERROR_UNINITIALIZED;
     auto pfnCreate = ze_lib::context->zelTracingDdiTable.Tracer.pfnCreate;
     if( nullptr == pfnCreate )
         return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -175,4 +177,127 @@ zelTracerSetEnabled(
     return pfnSetEnabled( hTracer, enable );
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Retrieves the number of epilogues of a tracer which were dropped
+///        because the queue of deferred epilogues of their thread was full.
+/// 
+/// @details
+///     - Tracers without deferred epilogues drop none.
+///     - The application may call this function from simultaneous threads.
+/// 
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + the tracing layer does not defer epilogues
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `nullptr == hTracer`
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `nullptr == pCount`
+ze_result_t ZE_APICALL
+zelTracerGetDroppedEpilogueCount(
+    zel_tracer_handle_t hTracer,                ///< [in] handle of the tracer
+    uint64_t* pCount                            ///< [out] number of epilogues dropped since the tracer was created
+    )
+{
+    if(ze_lib::context->inTeardown)
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    // the table is only filled if the tracing layer is loaded
+    auto pfnGetDroppedEpilogueCount = ze_lib::context->zelTracingDdiTable.Async.pfnGetDroppedEpilogueCount;
+    if( nullptr == pfnGetDroppedEpilogueCount )
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+    return pfnGetDroppedEpilogueCount( hTracer, pCount );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Waits until the epilogues deferred before this call have run.
+/// 
+/// @details
+///     - Returns immediately for tracers without deferred epilogues.
+///     - The application may call this function from simultaneous threads.
+/// 
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + the tracing layer does not defer epilogues
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `nullptr == hTracer`
+///     - ::ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE
+///         + called from a deferred epilogue
+ze_result_t ZE_APICALL
+zelTracerFlushEpilogues(
+    zel_tracer_handle_t hTracer                 ///< [in] handle of the tracer
+    )
+{
+    if(ze_lib::context->inTeardown)
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    auto pfnFlushEpilogues = ze_lib::context->zelTracingDdiTable.Async.pfnFlushEpilogues;
+    if( nullptr == pfnFlushEpilogues )
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+    return pfnFlushEpilogues( hTracer );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Retrieves the call statistics of every API called since the
+///        statistics were last reset.
+/// 
+/// @details
+///     - Statistics are only collected if the environment variable
+///       ZEL_ENABLE_API_STATS is set when the loader is initialized.
+///     - Calls of all threads are merged when this function is called.
+///     - The application may call this function from simultaneous threads.
+/// 
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + statistics are not collected
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `nullptr == pCount`
+ze_result_t ZE_APICALL
+zelTracingGetApiStats(
+    uint32_t* pCount,                           ///< [in,out] pointer to the number of APIs
+    zel_api_stats_t* pStats                     ///< [in,out][optional][range(0, *pCount)] array of API statistics
+    )
+{
+    if(ze_lib::context->inTeardown || !ze_lib::context->isInitialized)
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    // the table is only filled if the tracing layer is loaded
+    auto pfnGetApiStats = ze_lib::context->zelTracingDdiTable.Stats.pfnGetApiStats;
+    if( nullptr == pfnGetApiStats )
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+    return pfnGetApiStats( pCount, pStats );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Resets the call statistics of every API.
+/// 
+/// @details
+///     - Calls in progress on other threads may be counted either before or
+///       after the reset.
+///     - The application may call this function from simultaneous threads.
+/// 
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + statistics are not collected
+ze_result_t ZE_APICALL
+zelTracingResetApiStats(
+    void
+    )
+{
+    if(ze_lib::context->inTeardown || !ze_lib::context->isInitialized)
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    auto pfnResetApiStats = ze_lib::context->zelTracingDdiTable.Stats.pfnResetApiStats;
+    if( nullptr == pfnResetApiStats )
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+    return pfnResetApiStats();
+}
+
 } // extern "C"
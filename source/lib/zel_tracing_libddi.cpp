@@ -26,6 +26,24 @@ namespace ze_lib
             result = getTable( ZE_API_VERSION_CURRENT, &zelTracingDdiTable.Tracer);
         }
 
+        // API statistics are optional; older loaders have no table
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getStatsTable = reinterpret_cast<zel_pfnGetTracingStatsProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader, "zelGetTracingStatsProcAddrTable") );
+            if( getStatsTable )
+                getStatsTable( ZE_API_VERSION_CURRENT, &zelTracingDdiTable.Stats);
+        }
+
+        // deferred epilogues are optional; older loaders have no table
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getAsyncTable = reinterpret_cast<zel_pfnGetTracerAsyncProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader, "zelGetTracerAsyncProcAddrTable") );
+            if( getAsyncTable )
+                getAsyncTable( ZE_API_VERSION_CURRENT, &zelTracingDdiTable.Async);
+        }
+
         return result;
     }
 #else
@@ -33,6 +51,11 @@ namespace ze_lib
     {
         ze_result_t result;
         result = zelGetTracerApiProcAddrTable( ZE_API_VERSION_CURRENT, &zelTracingDdiTable.Tracer);
+        // API statistics and deferred epilogues are optional
+        if( ZE_RESULT_SUCCESS == result ) {
+            zelGetTracingStatsProcAddrTable( ZE_API_VERSION_CURRENT, &zelTracingDdiTable.Stats);
+            zelGetTracerAsyncProcAddrTable( ZE_API_VERSION_CURRENT, &zelTracingDdiTable.Async);
+        }
         return result;
     }
 #endif
@@ -113,7 +113,7 @@ zesDriverGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zesDdiTable.load()->Driver.pfnGet;
+    auto pfnGet = ze_lib::context->getZesDdiTable()->Driver.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -161,7 +161,7 @@ zesDriverGetExtensionProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExtensionProperties = ze_lib::context->zesDdiTable.load()->Driver.pfnGetExtensionProperties;
+    auto pfnGetExtensionProperties = ze_lib::context->getZesDdiTable()->Driver.pfnGetExtensionProperties;
     if( nullptr == pfnGetExtensionProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -202,7 +202,7 @@ zesDriverGetExtensionFunctionAddress(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExtensionFunctionAddress = ze_lib::context->zesDdiTable.load()->Driver.pfnGetExtensionFunctionAddress;
+    auto pfnGetExtensionFunctionAddress = ze_lib::context->getZesDdiTable()->Driver.pfnGetExtensionFunctionAddress;
     if( nullptr == pfnGetExtensionFunctionAddress ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -253,7 +253,7 @@ zesDeviceGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zesDdiTable.load()->Device.pfnGet;
+    auto pfnGet = ze_lib::context->getZesDdiTable()->Device.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -291,7 +291,7 @@ zesDeviceGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Device.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Device.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -330,7 +330,7 @@ zesDeviceGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Device.pfnGetState;
+    auto pfnGetState = ze_lib::context->getZesDdiTable()->Device.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -380,7 +380,7 @@ zesDeviceReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReset = ze_lib::context->zesDdiTable.load()->Device.pfnReset;
+    auto pfnReset = ze_lib::context->getZesDdiTable()->Device.pfnReset;
     if( nullptr == pfnReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -431,7 +431,7 @@ zesDeviceResetExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnResetExt = ze_lib::context->zesDdiTable.load()->Device.pfnResetExt;
+    auto pfnResetExt = ze_lib::context->getZesDdiTable()->Device.pfnResetExt;
     if( nullptr == pfnResetExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -487,7 +487,7 @@ zesDeviceProcessesGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnProcessesGetState = ze_lib::context->zesDdiTable.load()->Device.pfnProcessesGetState;
+    auto pfnProcessesGetState = ze_lib::context->getZesDdiTable()->Device.pfnProcessesGetState;
     if( nullptr == pfnProcessesGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -525,7 +525,7 @@ zesDevicePciGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetProperties = ze_lib::context->zesDdiTable.load()->Device.pfnPciGetProperties;
+    auto pfnPciGetProperties = ze_lib::context->getZesDdiTable()->Device.pfnPciGetProperties;
     if( nullptr == pfnPciGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -563,7 +563,7 @@ zesDevicePciGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetState = ze_lib::context->zesDdiTable.load()->Device.pfnPciGetState;
+    auto pfnPciGetState = ze_lib::context->getZesDdiTable()->Device.pfnPciGetState;
     if( nullptr == pfnPciGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -609,7 +609,7 @@ zesDevicePciGetBars(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetBars = ze_lib::context->zesDdiTable.load()->Device.pfnPciGetBars;
+    auto pfnPciGetBars = ze_lib::context->getZesDdiTable()->Device.pfnPciGetBars;
     if( nullptr == pfnPciGetBars ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -649,7 +649,7 @@ zesDevicePciGetStats(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetStats = ze_lib::context->zesDdiTable.load()->Device.pfnPciGetStats;
+    auto pfnPciGetStats = ze_lib::context->getZesDdiTable()->Device.pfnPciGetStats;
     if( nullptr == pfnPciGetStats ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -687,7 +687,7 @@ zesDeviceSetOverclockWaiver(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetOverclockWaiver = ze_lib::context->zesDdiTable.load()->Device.pfnSetOverclockWaiver;
+    auto pfnSetOverclockWaiver = ze_lib::context->getZesDdiTable()->Device.pfnSetOverclockWaiver;
     if( nullptr == pfnSetOverclockWaiver ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -729,7 +729,7 @@ zesDeviceGetOverclockDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetOverclockDomains = ze_lib::context->zesDdiTable.load()->Device.pfnGetOverclockDomains;
+    auto pfnGetOverclockDomains = ze_lib::context->getZesDdiTable()->Device.pfnGetOverclockDomains;
     if( nullptr == pfnGetOverclockDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -775,7 +775,7 @@ zesDeviceGetOverclockControls(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetOverclockControls = ze_lib::context->zesDdiTable.load()->Device.pfnGetOverclockControls;
+    auto pfnGetOverclockControls = ze_lib::context->getZesDdiTable()->Device.pfnGetOverclockControls;
     if( nullptr == pfnGetOverclockControls ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -815,7 +815,7 @@ zesDeviceResetOverclockSettings(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnResetOverclockSettings = ze_lib::context->zesDdiTable.load()->Device.pfnResetOverclockSettings;
+    auto pfnResetOverclockSettings = ze_lib::context->getZesDdiTable()->Device.pfnResetOverclockSettings;
     if( nullptr == pfnResetOverclockSettings ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -864,7 +864,7 @@ zesDeviceReadOverclockState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadOverclockState = ze_lib::context->zesDdiTable.load()->Device.pfnReadOverclockState;
+    auto pfnReadOverclockState = ze_lib::context->getZesDdiTable()->Device.pfnReadOverclockState;
     if( nullptr == pfnReadOverclockState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -912,7 +912,7 @@ zesDeviceEnumOverclockDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumOverclockDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumOverclockDomains;
+    auto pfnEnumOverclockDomains = ze_lib::context->getZesDdiTable()->Device.pfnEnumOverclockDomains;
     if( nullptr == pfnEnumOverclockDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -952,7 +952,7 @@ zesOverclockGetDomainProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDomainProperties = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetDomainProperties;
+    auto pfnGetDomainProperties = ze_lib::context->getZesDdiTable()->Overclock.pfnGetDomainProperties;
     if( nullptr == pfnGetDomainProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -992,7 +992,7 @@ zesOverclockGetDomainVFProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDomainVFProperties = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetDomainVFProperties;
+    auto pfnGetDomainVFProperties = ze_lib::context->getZesDdiTable()->Overclock.pfnGetDomainVFProperties;
     if( nullptr == pfnGetDomainVFProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1035,7 +1035,7 @@ zesOverclockGetDomainControlProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDomainControlProperties = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetDomainControlProperties;
+    auto pfnGetDomainControlProperties = ze_lib::context->getZesDdiTable()->Overclock.pfnGetDomainControlProperties;
     if( nullptr == pfnGetDomainControlProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1078,7 +1078,7 @@ zesOverclockGetControlCurrentValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetControlCurrentValue = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetControlCurrentValue;
+    auto pfnGetControlCurrentValue = ze_lib::context->getZesDdiTable()->Overclock.pfnGetControlCurrentValue;
     if( nullptr == pfnGetControlCurrentValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1122,7 +1122,7 @@ zesOverclockGetControlPendingValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetControlPendingValue = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetControlPendingValue;
+    auto pfnGetControlPendingValue = ze_lib::context->getZesDdiTable()->Overclock.pfnGetControlPendingValue;
     if( nullptr == pfnGetControlPendingValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1167,7 +1167,7 @@ zesOverclockSetControlUserValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetControlUserValue = ze_lib::context->zesDdiTable.load()->Overclock.pfnSetControlUserValue;
+    auto pfnSetControlUserValue = ze_lib::context->getZesDdiTable()->Overclock.pfnSetControlUserValue;
     if( nullptr == pfnSetControlUserValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1212,7 +1212,7 @@ zesOverclockGetControlState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetControlState = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetControlState;
+    auto pfnGetControlState = ze_lib::context->getZesDdiTable()->Overclock.pfnGetControlState;
     if( nullptr == pfnGetControlState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1260,7 +1260,7 @@ zesOverclockGetVFPointValues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFPointValues = ze_lib::context->zesDdiTable.load()->Overclock.pfnGetVFPointValues;
+    auto pfnGetVFPointValues = ze_lib::context->getZesDdiTable()->Overclock.pfnGetVFPointValues;
     if( nullptr == pfnGetVFPointValues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1303,7 +1303,7 @@ zesOverclockSetVFPointValues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetVFPointValues = ze_lib::context->zesDdiTable.load()->Overclock.pfnSetVFPointValues;
+    auto pfnSetVFPointValues = ze_lib::context->getZesDdiTable()->Overclock.pfnSetVFPointValues;
     if( nullptr == pfnSetVFPointValues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1351,7 +1351,7 @@ zesDeviceEnumDiagnosticTestSuites(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumDiagnosticTestSuites = ze_lib::context->zesDdiTable.load()->Device.pfnEnumDiagnosticTestSuites;
+    auto pfnEnumDiagnosticTestSuites = ze_lib::context->getZesDdiTable()->Device.pfnEnumDiagnosticTestSuites;
     if( nullptr == pfnEnumDiagnosticTestSuites ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1390,7 +1390,7 @@ zesDiagnosticsGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Diagnostics.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Diagnostics.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1440,7 +1440,7 @@ zesDiagnosticsGetTests(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetTests = ze_lib::context->zesDdiTable.load()->Diagnostics.pfnGetTests;
+    auto pfnGetTests = ze_lib::context->getZesDdiTable()->Diagnostics.pfnGetTests;
     if( nullptr == pfnGetTests ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1493,7 +1493,7 @@ zesDiagnosticsRunTests(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnRunTests = ze_lib::context->zesDdiTable.load()->Diagnostics.pfnRunTests;
+    auto pfnRunTests = ze_lib::context->getZesDdiTable()->Diagnostics.pfnRunTests;
     if( nullptr == pfnRunTests ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1531,7 +1531,7 @@ zesDeviceEccAvailable(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEccAvailable = ze_lib::context->zesDdiTable.load()->Device.pfnEccAvailable;
+    auto pfnEccAvailable = ze_lib::context->getZesDdiTable()->Device.pfnEccAvailable;
     if( nullptr == pfnEccAvailable ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1569,7 +1569,7 @@ zesDeviceEccConfigurable(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEccConfigurable = ze_lib::context->zesDdiTable.load()->Device.pfnEccConfigurable;
+    auto pfnEccConfigurable = ze_lib::context->getZesDdiTable()->Device.pfnEccConfigurable;
     if( nullptr == pfnEccConfigurable ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1607,7 +1607,7 @@ zesDeviceGetEccState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetEccState = ze_lib::context->zesDdiTable.load()->Device.pfnGetEccState;
+    auto pfnGetEccState = ze_lib::context->getZesDdiTable()->Device.pfnGetEccState;
     if( nullptr == pfnGetEccState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1653,7 +1653,7 @@ zesDeviceSetEccState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetEccState = ze_lib::context->zesDdiTable.load()->Device.pfnSetEccState;
+    auto pfnSetEccState = ze_lib::context->getZesDdiTable()->Device.pfnSetEccState;
     if( nullptr == pfnSetEccState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1701,7 +1701,7 @@ zesDeviceEnumEngineGroups(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumEngineGroups = ze_lib::context->zesDdiTable.load()->Device.pfnEnumEngineGroups;
+    auto pfnEnumEngineGroups = ze_lib::context->getZesDdiTable()->Device.pfnEnumEngineGroups;
     if( nullptr == pfnEnumEngineGroups ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1739,7 +1739,7 @@ zesEngineGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Engine.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Engine.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1780,7 +1780,7 @@ zesEngineGetActivity(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetActivity = ze_lib::context->zesDdiTable.load()->Engine.pfnGetActivity;
+    auto pfnGetActivity = ze_lib::context->getZesDdiTable()->Engine.pfnGetActivity;
     if( nullptr == pfnGetActivity ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1818,7 +1818,7 @@ zesDeviceEventRegister(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEventRegister = ze_lib::context->zesDdiTable.load()->Device.pfnEventRegister;
+    auto pfnEventRegister = ze_lib::context->getZesDdiTable()->Device.pfnEventRegister;
     if( nullptr == pfnEventRegister ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1878,7 +1878,7 @@ zesDriverEventListen(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEventListen = ze_lib::context->zesDdiTable.load()->Driver.pfnEventListen;
+    auto pfnEventListen = ze_lib::context->getZesDdiTable()->Driver.pfnEventListen;
     if( nullptr == pfnEventListen ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1938,7 +1938,7 @@ zesDriverEventListenEx(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEventListenEx = ze_lib::context->zesDdiTable.load()->Driver.pfnEventListenEx;
+    auto pfnEventListenEx = ze_lib::context->getZesDdiTable()->Driver.pfnEventListenEx;
     if( nullptr == pfnEventListenEx ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1986,7 +1986,7 @@ zesDeviceEnumFabricPorts(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumFabricPorts = ze_lib::context->zesDdiTable.load()->Device.pfnEnumFabricPorts;
+    auto pfnEnumFabricPorts = ze_lib::context->getZesDdiTable()->Device.pfnEnumFabricPorts;
     if( nullptr == pfnEnumFabricPorts ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2024,7 +2024,7 @@ zesFabricPortGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->FabricPort.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2063,7 +2063,7 @@ zesFabricPortGetLinkType(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLinkType = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetLinkType;
+    auto pfnGetLinkType = ze_lib::context->getZesDdiTable()->FabricPort.pfnGetLinkType;
     if( nullptr == pfnGetLinkType ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2101,7 +2101,7 @@ zesFabricPortGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::context->getZesDdiTable()->FabricPort.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2141,7 +2141,7 @@ zesFabricPortSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfig = ze_lib::context->zesDdiTable.load()->FabricPort.pfnSetConfig;
+    auto pfnSetConfig = ze_lib::context->getZesDdiTable()->FabricPort.pfnSetConfig;
     if( nullptr == pfnSetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2180,7 +2180,7 @@ zesFabricPortGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetState;
+    auto pfnGetState = ze_lib::context->getZesDdiTable()->FabricPort.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2220,7 +2220,7 @@ zesFabricPortGetThroughput(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetThroughput = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetThroughput;
+    auto pfnGetThroughput = ze_lib::context->getZesDdiTable()->FabricPort.pfnGetThroughput;
     if( nullptr == pfnGetThroughput ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2263,7 +2263,7 @@ zesFabricPortGetFabricErrorCounters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFabricErrorCounters = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetFabricErrorCounters;
+    auto pfnGetFabricErrorCounters = ze_lib::context->getZesDdiTable()->FabricPort.pfnGetFabricErrorCounters;
     if( nullptr == pfnGetFabricErrorCounters ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2306,7 +2306,7 @@ zesFabricPortGetMultiPortThroughput(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMultiPortThroughput = ze_lib::context->zesDdiTable.load()->FabricPort.pfnGetMultiPortThroughput;
+    auto pfnGetMultiPortThroughput = ze_lib::context->getZesDdiTable()->FabricPort.pfnGetMultiPortThroughput;
     if( nullptr == pfnGetMultiPortThroughput ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2354,7 +2354,7 @@ zesDeviceEnumFans(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumFans = ze_lib::context->zesDdiTable.load()->Device.pfnEnumFans;
+    auto pfnEnumFans = ze_lib::context->getZesDdiTable()->Device.pfnEnumFans;
     if( nullptr == pfnEnumFans ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2392,7 +2392,7 @@ zesFanGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Fan.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Fan.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2431,7 +2431,7 @@ zesFanGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->Fan.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::context->getZesDdiTable()->Fan.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2469,7 +2469,7 @@ zesFanSetDefaultMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetDefaultMode = ze_lib::context->zesDdiTable.load()->Fan.pfnSetDefaultMode;
+    auto pfnSetDefaultMode = ze_lib::context->getZesDdiTable()->Fan.pfnSetDefaultMode;
     if( nullptr == pfnSetDefaultMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2512,7 +2512,7 @@ zesFanSetFixedSpeedMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetFixedSpeedMode = ze_lib::context->zesDdiTable.load()->Fan.pfnSetFixedSpeedMode;
+    auto pfnSetFixedSpeedMode = ze_lib::context->getZesDdiTable()->Fan.pfnSetFixedSpeedMode;
     if( nullptr == pfnSetFixedSpeedMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2557,7 +2557,7 @@ zesFanSetSpeedTableMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetSpeedTableMode = ze_lib::context->zesDdiTable.load()->Fan.pfnSetSpeedTableMode;
+    auto pfnSetSpeedTableMode = ze_lib::context->getZesDdiTable()->Fan.pfnSetSpeedTableMode;
     if( nullptr == pfnSetSpeedTableMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2602,7 +2602,7 @@ zesFanGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Fan.pfnGetState;
+    auto pfnGetState = ze_lib::context->getZesDdiTable()->Fan.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2650,7 +2650,7 @@ zesDeviceEnumFirmwares(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumFirmwares = ze_lib::context->zesDdiTable.load()->Device.pfnEnumFirmwares;
+    auto pfnEnumFirmwares = ze_lib::context->getZesDdiTable()->Device.pfnEnumFirmwares;
     if( nullptr == pfnEnumFirmwares ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2689,7 +2689,7 @@ zesFirmwareGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Firmware.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Firmware.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2734,7 +2734,7 @@ zesFirmwareFlash(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnFlash = ze_lib::context->zesDdiTable.load()->Firmware.pfnFlash;
+    auto pfnFlash = ze_lib::context->getZesDdiTable()->Firmware.pfnFlash;
     if( nullptr == pfnFlash ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2772,7 +2772,7 @@ zesFirmwareGetFlashProgress(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFlashProgress = ze_lib::context->zesDdiTable.load()->Firmware.pfnGetFlashProgress;
+    auto pfnGetFlashProgress = ze_lib::context->getZesDdiTable()->Firmware.pfnGetFlashProgress;
     if( nullptr == pfnGetFlashProgress ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2814,7 +2814,7 @@ zesFirmwareGetConsoleLogs(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConsoleLogs = ze_lib::context->zesDdiTable.load()->Firmware.pfnGetConsoleLogs;
+    auto pfnGetConsoleLogs = ze_lib::context->getZesDdiTable()->Firmware.pfnGetConsoleLogs;
     if( nullptr == pfnGetConsoleLogs ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2862,7 +2862,7 @@ zesDeviceEnumFrequencyDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumFrequencyDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumFrequencyDomains;
+    auto pfnEnumFrequencyDomains = ze_lib::context->getZesDdiTable()->Device.pfnEnumFrequencyDomains;
     if( nullptr == pfnEnumFrequencyDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2900,7 +2900,7 @@ zesFrequencyGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Frequency.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2949,7 +2949,7 @@ zesFrequencyGetAvailableClocks(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAvailableClocks = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetAvailableClocks;
+    auto pfnGetAvailableClocks = ze_lib::context->getZesDdiTable()->Frequency.pfnGetAvailableClocks;
     if( nullptr == pfnGetAvailableClocks ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2988,7 +2988,7 @@ zesFrequencyGetRange(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetRange = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetRange;
+    auto pfnGetRange = ze_lib::context->getZesDdiTable()->Frequency.pfnGetRange;
     if( nullptr == pfnGetRange ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3032,7 +3032,7 @@ zesFrequencySetRange(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetRange = ze_lib::context->zesDdiTable.load()->Frequency.pfnSetRange;
+    auto pfnSetRange = ze_lib::context->getZesDdiTable()->Frequency.pfnSetRange;
     if( nullptr == pfnSetRange ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3071,7 +3071,7 @@ zesFrequencyGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetState;
+    auto pfnGetState = ze_lib::context->getZesDdiTable()->Frequency.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3110,7 +3110,7 @@ zesFrequencyGetThrottleTime(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetThrottleTime = ze_lib::context->zesDdiTable.load()->Frequency.pfnGetThrottleTime;
+    auto pfnGetThrottleTime = ze_lib::context->getZesDdiTable()->Frequency.pfnGetThrottleTime;
     if( nullptr == pfnGetThrottleTime ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3149,7 +3149,7 @@ zesFrequencyOcGetCapabilities(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetCapabilities = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetCapabilities;
+    auto pfnOcGetCapabilities = ze_lib::context->getZesDdiTable()->Frequency.pfnOcGetCapabilities;
     if( nullptr == pfnOcGetCapabilities ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3200,7 +3200,7 @@ zesFrequencyOcGetFrequencyTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetFrequencyTarget = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetFrequencyTarget;
+    auto pfnOcGetFrequencyTarget = ze_lib::context->getZesDdiTable()->Frequency.pfnOcGetFrequencyTarget;
     if( nullptr == pfnOcGetFrequencyTarget ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3249,7 +3249,7 @@ zesFrequencyOcSetFrequencyTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetFrequencyTarget = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetFrequencyTarget;
+    auto pfnOcSetFrequencyTarget = ze_lib::context->getZesDdiTable()->Frequency.pfnOcSetFrequencyTarget;
     if( nullptr == pfnOcSetFrequencyTarget ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3302,7 +3302,7 @@ zesFrequencyOcGetVoltageTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetVoltageTarget = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetVoltageTarget;
+    auto pfnOcGetVoltageTarget = ze_lib::context->getZesDdiTable()->Frequency.pfnOcGetVoltageTarget;
     if( nullptr == pfnOcGetVoltageTarget ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3352,7 +3352,7 @@ zesFrequencyOcSetVoltageTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetVoltageTarget = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetVoltageTarget;
+    auto pfnOcSetVoltageTarget = ze_lib::context->getZesDdiTable()->Frequency.pfnOcSetVoltageTarget;
     if( nullptr == pfnOcSetVoltageTarget ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3399,7 +3399,7 @@ zesFrequencyOcSetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetMode = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetMode;
+    auto pfnOcSetMode = ze_lib::context->getZesDdiTable()->Frequency.pfnOcSetMode;
     if( nullptr == pfnOcSetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3446,7 +3446,7 @@ zesFrequencyOcGetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetMode = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetMode;
+    auto pfnOcGetMode = ze_lib::context->getZesDdiTable()->Frequency.pfnOcGetMode;
     if( nullptr == pfnOcGetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3489,7 +3489,7 @@ zesFrequencyOcGetIccMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetIccMax = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetIccMax;
+    auto pfnOcGetIccMax = ze_lib::context->getZesDdiTable()->Frequency.pfnOcGetIccMax;
     if( nullptr == pfnOcGetIccMax ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3536,7 +3536,7 @@ zesFrequencyOcSetIccMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetIccMax = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetIccMax;
+    auto pfnOcSetIccMax = ze_lib::context->getZesDdiTable()->Frequency.pfnOcSetIccMax;
     if( nullptr == pfnOcSetIccMax ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3578,7 +3578,7 @@ zesFrequencyOcGetTjMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetTjMax = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcGetTjMax;
+    auto pfnOcGetTjMax = ze_lib::context->getZesDdiTable()->Frequency.pfnOcGetTjMax;
     if( nullptr == pfnOcGetTjMax ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3625,7 +3625,7 @@ zesFrequencyOcSetTjMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetTjMax = ze_lib::context->zesDdiTable.load()->Frequency.pfnOcSetTjMax;
+    auto pfnOcSetTjMax = ze_lib::context->getZesDdiTable()->Frequency.pfnOcSetTjMax;
     if( nullptr == pfnOcSetTjMax ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3673,7 +3673,7 @@ zesDeviceEnumLeds(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumLeds = ze_lib::context->zesDdiTable.load()->Device.pfnEnumLeds;
+    auto pfnEnumLeds = ze_lib::context->getZesDdiTable()->Device.pfnEnumLeds;
     if( nullptr == pfnEnumLeds ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3711,7 +3711,7 @@ zesLedGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Led.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Led.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3749,7 +3749,7 @@ zesLedGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Led.pfnGetState;
+    auto pfnGetState = ze_lib::context->getZesDdiTable()->Led.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3787,7 +3787,7 @@ zesLedSetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetState = ze_lib::context->zesDdiTable.load()->Led.pfnSetState;
+    auto pfnSetState = ze_lib::context->getZesDdiTable()->Led.pfnSetState;
     if( nullptr == pfnSetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3829,7 +3829,7 @@ zesLedSetColor(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetColor = ze_lib::context->zesDdiTable.load()->Led.pfnSetColor;
+    auto pfnSetColor = ze_lib::context->getZesDdiTable()->Led.pfnSetColor;
     if( nullptr == pfnSetColor ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3877,7 +3877,7 @@ zesDeviceEnumMemoryModules(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumMemoryModules = ze_lib::context->zesDdiTable.load()->Device.pfnEnumMemoryModules;
+    auto pfnEnumMemoryModules = ze_lib::context->getZesDdiTable()->Device.pfnEnumMemoryModules;
     if( nullptr == pfnEnumMemoryModules ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3915,7 +3915,7 @@ zesMemoryGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Memory.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Memory.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3953,7 +3953,7 @@ zesMemoryGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Memory.pfnGetState;
+    auto pfnGetState = ze_lib::context->getZesDdiTable()->Memory.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -3994,7 +3994,7 @@ zesMemoryGetBandwidth(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetBandwidth = ze_lib::context->zesDdiTable.load()->Memory.pfnGetBandwidth;
+    auto pfnGetBandwidth = ze_lib::context->getZesDdiTable()->Memory.pfnGetBandwidth;
     if( nullptr == pfnGetBandwidth ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4044,7 +4044,7 @@ zesDeviceEnumPerformanceFactorDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumPerformanceFactorDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumPerformanceFactorDomains;
+    auto pfnEnumPerformanceFactorDomains = ze_lib::context->getZesDdiTable()->Device.pfnEnumPerformanceFactorDomains;
     if( nullptr == pfnEnumPerformanceFactorDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4083,7 +4083,7 @@ zesPerformanceFactorGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->PerformanceFactor.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->PerformanceFactor.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4122,7 +4122,7 @@ zesPerformanceFactorGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->PerformanceFactor.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::context->getZesDdiTable()->PerformanceFactor.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4163,7 +4163,7 @@ zesPerformanceFactorSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfig = ze_lib::context->zesDdiTable.load()->PerformanceFactor.pfnSetConfig;
+    auto pfnSetConfig = ze_lib::context->getZesDdiTable()->PerformanceFactor.pfnSetConfig;
     if( nullptr == pfnSetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4211,7 +4211,7 @@ zesDeviceEnumPowerDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumPowerDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumPowerDomains;
+    auto pfnEnumPowerDomains = ze_lib::context->getZesDdiTable()->Device.pfnEnumPowerDomains;
     if( nullptr == pfnEnumPowerDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4252,7 +4252,7 @@ zesDeviceGetCardPowerDomain(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCardPowerDomain = ze_lib::context->zesDdiTable.load()->Device.pfnGetCardPowerDomain;
+    auto pfnGetCardPowerDomain = ze_lib::context->getZesDdiTable()->Device.pfnGetCardPowerDomain;
     if( nullptr == pfnGetCardPowerDomain ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4290,7 +4290,7 @@ zesPowerGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Power.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Power.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4329,7 +4329,7 @@ zesPowerGetEnergyCounter(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetEnergyCounter = ze_lib::context->zesDdiTable.load()->Power.pfnGetEnergyCounter;
+    auto pfnGetEnergyCounter = ze_lib::context->getZesDdiTable()->Power.pfnGetEnergyCounter;
     if( nullptr == pfnGetEnergyCounter ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4371,7 +4371,7 @@ zesPowerGetLimits(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLimits = ze_lib::context->zesDdiTable.load()->Power.pfnGetLimits;
+    auto pfnGetLimits = ze_lib::context->getZesDdiTable()->Power.pfnGetLimits;
     if( nullptr == pfnGetLimits ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4417,7 +4417,7 @@ zesPowerSetLimits(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetLimits = ze_lib::context->zesDdiTable.load()->Power.pfnSetLimits;
+    auto pfnSetLimits = ze_lib::context->getZesDdiTable()->Power.pfnSetLimits;
     if( nullptr == pfnSetLimits ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4460,7 +4460,7 @@ zesPowerGetEnergyThreshold(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetEnergyThreshold = ze_lib::context->zesDdiTable.load()->Power.pfnGetEnergyThreshold;
+    auto pfnGetEnergyThreshold = ze_lib::context->getZesDdiTable()->Power.pfnGetEnergyThreshold;
     if( nullptr == pfnGetEnergyThreshold ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4516,7 +4516,7 @@ zesPowerSetEnergyThreshold(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetEnergyThreshold = ze_lib::context->zesDdiTable.load()->Power.pfnSetEnergyThreshold;
+    auto pfnSetEnergyThreshold = ze_lib::context->getZesDdiTable()->Power.pfnSetEnergyThreshold;
     if( nullptr == pfnSetEnergyThreshold ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4564,7 +4564,7 @@ zesDeviceEnumPsus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumPsus = ze_lib::context->zesDdiTable.load()->Device.pfnEnumPsus;
+    auto pfnEnumPsus = ze_lib::context->getZesDdiTable()->Device.pfnEnumPsus;
     if( nullptr == pfnEnumPsus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4602,7 +4602,7 @@ zesPsuGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Psu.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Psu.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4640,7 +4640,7 @@ zesPsuGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Psu.pfnGetState;
+    auto pfnGetState = ze_lib::context->getZesDdiTable()->Psu.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4698,7 +4698,7 @@ zesDeviceEnumRasErrorSets(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumRasErrorSets = ze_lib::context->zesDdiTable.load()->Device.pfnEnumRasErrorSets;
+    auto pfnEnumRasErrorSets = ze_lib::context->getZesDdiTable()->Device.pfnEnumRasErrorSets;
     if( nullptr == pfnEnumRasErrorSets ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4738,7 +4738,7 @@ zesRasGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Ras.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Ras.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4786,7 +4786,7 @@ zesRasGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->Ras.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::context->getZesDdiTable()->Ras.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4839,7 +4839,7 @@ zesRasSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfig = ze_lib::context->zesDdiTable.load()->Ras.pfnSetConfig;
+    auto pfnSetConfig = ze_lib::context->getZesDdiTable()->Ras.pfnSetConfig;
     if( nullptr == pfnSetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4883,7 +4883,7 @@ zesRasGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Ras.pfnGetState;
+    auto pfnGetState = ze_lib::context->getZesDdiTable()->Ras.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4937,7 +4937,7 @@ zesDeviceEnumSchedulers(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumSchedulers = ze_lib::context->zesDdiTable.load()->Device.pfnEnumSchedulers;
+    auto pfnEnumSchedulers = ze_lib::context->getZesDdiTable()->Device.pfnEnumSchedulers;
     if( nullptr == pfnEnumSchedulers ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -4975,7 +4975,7 @@ zesSchedulerGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Scheduler.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Scheduler.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5015,7 +5015,7 @@ zesSchedulerGetCurrentMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCurrentMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnGetCurrentMode;
+    auto pfnGetCurrentMode = ze_lib::context->getZesDdiTable()->Scheduler.pfnGetCurrentMode;
     if( nullptr == pfnGetCurrentMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5057,7 +5057,7 @@ zesSchedulerGetTimeoutModeProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetTimeoutModeProperties = ze_lib::context->zesDdiTable.load()->Scheduler.pfnGetTimeoutModeProperties;
+    auto pfnGetTimeoutModeProperties = ze_lib::context->getZesDdiTable()->Scheduler.pfnGetTimeoutModeProperties;
     if( nullptr == pfnGetTimeoutModeProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5099,7 +5099,7 @@ zesSchedulerGetTimesliceModeProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetTimesliceModeProperties = ze_lib::context->zesDdiTable.load()->Scheduler.pfnGetTimesliceModeProperties;
+    auto pfnGetTimesliceModeProperties = ze_lib::context->getZesDdiTable()->Scheduler.pfnGetTimesliceModeProperties;
     if( nullptr == pfnGetTimesliceModeProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5149,7 +5149,7 @@ zesSchedulerSetTimeoutMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetTimeoutMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnSetTimeoutMode;
+    auto pfnSetTimeoutMode = ze_lib::context->getZesDdiTable()->Scheduler.pfnSetTimeoutMode;
     if( nullptr == pfnSetTimeoutMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5198,7 +5198,7 @@ zesSchedulerSetTimesliceMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetTimesliceMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnSetTimesliceMode;
+    auto pfnSetTimesliceMode = ze_lib::context->getZesDdiTable()->Scheduler.pfnSetTimesliceMode;
     if( nullptr == pfnSetTimesliceMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5245,7 +5245,7 @@ zesSchedulerSetExclusiveMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetExclusiveMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnSetExclusiveMode;
+    auto pfnSetExclusiveMode = ze_lib::context->getZesDdiTable()->Scheduler.pfnSetExclusiveMode;
     if( nullptr == pfnSetExclusiveMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5294,7 +5294,7 @@ zesSchedulerSetComputeUnitDebugMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetComputeUnitDebugMode = ze_lib::context->zesDdiTable.load()->Scheduler.pfnSetComputeUnitDebugMode;
+    auto pfnSetComputeUnitDebugMode = ze_lib::context->getZesDdiTable()->Scheduler.pfnSetComputeUnitDebugMode;
     if( nullptr == pfnSetComputeUnitDebugMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5342,7 +5342,7 @@ zesDeviceEnumStandbyDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumStandbyDomains = ze_lib::context->zesDdiTable.load()->Device.pfnEnumStandbyDomains;
+    auto pfnEnumStandbyDomains = ze_lib::context->getZesDdiTable()->Device.pfnEnumStandbyDomains;
     if( nullptr == pfnEnumStandbyDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5380,7 +5380,7 @@ zesStandbyGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Standby.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Standby.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5418,7 +5418,7 @@ zesStandbyGetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMode = ze_lib::context->zesDdiTable.load()->Standby.pfnGetMode;
+    auto pfnGetMode = ze_lib::context->getZesDdiTable()->Standby.pfnGetMode;
     if( nullptr == pfnGetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5458,7 +5458,7 @@ zesStandbySetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetMode = ze_lib::context->zesDdiTable.load()->Standby.pfnSetMode;
+    auto pfnSetMode = ze_lib::context->getZesDdiTable()->Standby.pfnSetMode;
     if( nullptr == pfnSetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5506,7 +5506,7 @@ zesDeviceEnumTemperatureSensors(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumTemperatureSensors = ze_lib::context->zesDdiTable.load()->Device.pfnEnumTemperatureSensors;
+    auto pfnEnumTemperatureSensors = ze_lib::context->getZesDdiTable()->Device.pfnEnumTemperatureSensors;
     if( nullptr == pfnEnumTemperatureSensors ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5544,7 +5544,7 @@ zesTemperatureGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.load()->Temperature.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZesDdiTable()->Temperature.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5588,7 +5588,7 @@ zesTemperatureGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.load()->Temperature.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::context->getZesDdiTable()->Temperature.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5649,7 +5649,7 @@ zesTemperatureSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfig = ze_lib::context->zesDdiTable.load()->Temperature.pfnSetConfig;
+    auto pfnSetConfig = ze_lib::context->getZesDdiTable()->Temperature.pfnSetConfig;
     if( nullptr == pfnSetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5688,7 +5688,7 @@ zesTemperatureGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.load()->Temperature.pfnGetState;
+    auto pfnGetState = ze_lib::context->getZesDdiTable()->Temperature.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5736,7 +5736,7 @@ zesPowerGetLimitsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLimitsExt = ze_lib::context->zesDdiTable.load()->Power.pfnGetLimitsExt;
+    auto pfnGetLimitsExt = ze_lib::context->getZesDdiTable()->Power.pfnGetLimitsExt;
     if( nullptr == pfnGetLimitsExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5787,7 +5787,7 @@ zesPowerSetLimitsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetLimitsExt = ze_lib::context->zesDdiTable.load()->Power.pfnSetLimitsExt;
+    auto pfnSetLimitsExt = ze_lib::context->getZesDdiTable()->Power.pfnSetLimitsExt;
     if( nullptr == pfnSetLimitsExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5840,7 +5840,7 @@ zesEngineGetActivityExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetActivityExt = ze_lib::context->zesDdiTable.load()->Engine.pfnGetActivityExt;
+    auto pfnGetActivityExt = ze_lib::context->getZesDdiTable()->Engine.pfnGetActivityExt;
     if( nullptr == pfnGetActivityExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5888,7 +5888,7 @@ zesRasGetStateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetStateExp = ze_lib::context->zesDdiTable.load()->RasExp.pfnGetStateExp;
+    auto pfnGetStateExp = ze_lib::context->getZesDdiTable()->RasExp.pfnGetStateExp;
     if( nullptr == pfnGetStateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5933,7 +5933,7 @@ zesRasClearStateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnClearStateExp = ze_lib::context->zesDdiTable.load()->RasExp.pfnClearStateExp;
+    auto pfnClearStateExp = ze_lib::context->getZesDdiTable()->RasExp.pfnClearStateExp;
     if( nullptr == pfnClearStateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -5976,7 +5976,7 @@ zesFirmwareGetSecurityVersionExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSecurityVersionExp = ze_lib::context->zesDdiTable.load()->FirmwareExp.pfnGetSecurityVersionExp;
+    auto pfnGetSecurityVersionExp = ze_lib::context->getZesDdiTable()->FirmwareExp.pfnGetSecurityVersionExp;
     if( nullptr == pfnGetSecurityVersionExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6011,7 +6011,7 @@ zesFirmwareSetSecurityVersionExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetSecurityVersionExp = ze_lib::context->zesDdiTable.load()->FirmwareExp.pfnSetSecurityVersionExp;
+    auto pfnSetSecurityVersionExp = ze_lib::context->getZesDdiTable()->FirmwareExp.pfnSetSecurityVersionExp;
     if( nullptr == pfnSetSecurityVersionExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6057,7 +6057,7 @@ zesDeviceGetSubDevicePropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSubDevicePropertiesExp = ze_lib::context->zesDdiTable.load()->DeviceExp.pfnGetSubDevicePropertiesExp;
+    auto pfnGetSubDevicePropertiesExp = ze_lib::context->getZesDdiTable()->DeviceExp.pfnGetSubDevicePropertiesExp;
     if( nullptr == pfnGetSubDevicePropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6102,7 +6102,7 @@ zesDriverGetDeviceByUuidExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDeviceByUuidExp = ze_lib::context->zesDdiTable.load()->DriverExp.pfnGetDeviceByUuidExp;
+    auto pfnGetDeviceByUuidExp = ze_lib::context->getZesDdiTable()->DriverExp.pfnGetDeviceByUuidExp;
     if( nullptr == pfnGetDeviceByUuidExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6151,7 +6151,7 @@ zesDeviceEnumActiveVFExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumActiveVFExp = ze_lib::context->zesDdiTable.load()->DeviceExp.pfnEnumActiveVFExp;
+    auto pfnEnumActiveVFExp = ze_lib::context->getZesDdiTable()->DeviceExp.pfnEnumActiveVFExp;
     if( nullptr == pfnEnumActiveVFExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6191,7 +6191,7 @@ zesVFManagementGetVFPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFPropertiesExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFPropertiesExp;
+    auto pfnGetVFPropertiesExp = ze_lib::context->getZesDdiTable()->VFManagementExp.pfnGetVFPropertiesExp;
     if( nullptr == pfnGetVFPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6244,7 +6244,7 @@ zesVFManagementGetVFMemoryUtilizationExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFMemoryUtilizationExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFMemoryUtilizationExp;
+    auto pfnGetVFMemoryUtilizationExp = ze_lib::context->getZesDdiTable()->VFManagementExp.pfnGetVFMemoryUtilizationExp;
     if( nullptr == pfnGetVFMemoryUtilizationExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6297,7 +6297,7 @@ zesVFManagementGetVFEngineUtilizationExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFEngineUtilizationExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFEngineUtilizationExp;
+    auto pfnGetVFEngineUtilizationExp = ze_lib::context->getZesDdiTable()->VFManagementExp.pfnGetVFEngineUtilizationExp;
     if( nullptr == pfnGetVFEngineUtilizationExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6339,7 +6339,7 @@ zesVFManagementSetVFTelemetryModeExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetVFTelemetryModeExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnSetVFTelemetryModeExp;
+    auto pfnSetVFTelemetryModeExp = ze_lib::context->getZesDdiTable()->VFManagementExp.pfnSetVFTelemetryModeExp;
     if( nullptr == pfnSetVFTelemetryModeExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6381,7 +6381,7 @@ zesVFManagementSetVFTelemetrySamplingIntervalExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetVFTelemetrySamplingIntervalExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnSetVFTelemetrySamplingIntervalExp;
+    auto pfnSetVFTelemetrySamplingIntervalExp = ze_lib::context->getZesDdiTable()->VFManagementExp.pfnSetVFTelemetrySamplingIntervalExp;
     if( nullptr == pfnSetVFTelemetrySamplingIntervalExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6429,7 +6429,7 @@ zesDeviceEnumEnabledVFExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumEnabledVFExp = ze_lib::context->zesDdiTable.load()->DeviceExp.pfnEnumEnabledVFExp;
+    auto pfnEnumEnabledVFExp = ze_lib::context->getZesDdiTable()->DeviceExp.pfnEnumEnabledVFExp;
     if( nullptr == pfnEnumEnabledVFExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6467,7 +6467,7 @@ zesVFManagementGetVFCapabilitiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFCapabilitiesExp = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFCapabilitiesExp;
+    auto pfnGetVFCapabilitiesExp = ze_lib::context->getZesDdiTable()->VFManagementExp.pfnGetVFCapabilitiesExp;
     if( nullptr == pfnGetVFCapabilitiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6517,7 +6517,7 @@ zesVFManagementGetVFMemoryUtilizationExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFMemoryUtilizationExp2 = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFMemoryUtilizationExp2;
+    auto pfnGetVFMemoryUtilizationExp2 = ze_lib::context->getZesDdiTable()->VFManagementExp.pfnGetVFMemoryUtilizationExp2;
     if( nullptr == pfnGetVFMemoryUtilizationExp2 ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -6567,7 +6567,7 @@ zesVFManagementGetVFEngineUtilizationExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFEngineUtilizationExp2 = ze_lib::context->zesDdiTable.load()->VFManagementExp.pfnGetVFEngineUtilizationExp2;
+    auto pfnGetVFEngineUtilizationExp2 = ze_lib::context->getZesDdiTable()->VFManagementExp.pfnGetVFEngineUtilizationExp2;
     if( nullptr == pfnGetVFEngineUtilizationExp2 ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
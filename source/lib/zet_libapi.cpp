@@ -48,7 +48,7 @@ zetModuleGetDebugInfo(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDebugInfo = ze_lib::context->zetDdiTable.load()->Module.pfnGetDebugInfo;
+    auto pfnGetDebugInfo = ze_lib::context->getZetDdiTable()->Module.pfnGetDebugInfo;
     if( nullptr == pfnGetDebugInfo ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -82,7 +82,7 @@ zetDeviceGetDebugProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDebugProperties = ze_lib::context->zetDdiTable.load()->Device.pfnGetDebugProperties;
+    auto pfnGetDebugProperties = ze_lib::context->getZetDdiTable()->Device.pfnGetDebugProperties;
     if( nullptr == pfnGetDebugProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -128,7 +128,7 @@ zetDebugAttach(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAttach = ze_lib::context->zetDdiTable.load()->Debug.pfnAttach;
+    auto pfnAttach = ze_lib::context->getZetDdiTable()->Debug.pfnAttach;
     if( nullptr == pfnAttach ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -159,7 +159,7 @@ zetDebugDetach(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDetach = ze_lib::context->zetDdiTable.load()->Debug.pfnDetach;
+    auto pfnDetach = ze_lib::context->getZetDdiTable()->Debug.pfnDetach;
     if( nullptr == pfnDetach ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -202,7 +202,7 @@ zetDebugReadEvent(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadEvent = ze_lib::context->zetDdiTable.load()->Debug.pfnReadEvent;
+    auto pfnReadEvent = ze_lib::context->getZetDdiTable()->Debug.pfnReadEvent;
     if( nullptr == pfnReadEvent ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -236,7 +236,7 @@ zetDebugAcknowledgeEvent(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAcknowledgeEvent = ze_lib::context->zetDdiTable.load()->Debug.pfnAcknowledgeEvent;
+    auto pfnAcknowledgeEvent = ze_lib::context->getZetDdiTable()->Debug.pfnAcknowledgeEvent;
     if( nullptr == pfnAcknowledgeEvent ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -270,7 +270,7 @@ zetDebugInterrupt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnInterrupt = ze_lib::context->zetDdiTable.load()->Debug.pfnInterrupt;
+    auto pfnInterrupt = ze_lib::context->getZetDdiTable()->Debug.pfnInterrupt;
     if( nullptr == pfnInterrupt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -304,7 +304,7 @@ zetDebugResume(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnResume = ze_lib::context->zetDdiTable.load()->Debug.pfnResume;
+    auto pfnResume = ze_lib::context->getZetDdiTable()->Debug.pfnResume;
     if( nullptr == pfnResume ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -351,7 +351,7 @@ zetDebugReadMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadMemory = ze_lib::context->zetDdiTable.load()->Debug.pfnReadMemory;
+    auto pfnReadMemory = ze_lib::context->getZetDdiTable()->Debug.pfnReadMemory;
     if( nullptr == pfnReadMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -398,7 +398,7 @@ zetDebugWriteMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnWriteMemory = ze_lib::context->zetDdiTable.load()->Debug.pfnWriteMemory;
+    auto pfnWriteMemory = ze_lib::context->getZetDdiTable()->Debug.pfnWriteMemory;
     if( nullptr == pfnWriteMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -441,7 +441,7 @@ zetDebugGetRegisterSetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetRegisterSetProperties = ze_lib::context->zetDdiTable.load()->Debug.pfnGetRegisterSetProperties;
+    auto pfnGetRegisterSetProperties = ze_lib::context->getZetDdiTable()->Debug.pfnGetRegisterSetProperties;
     if( nullptr == pfnGetRegisterSetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -489,7 +489,7 @@ zetDebugGetThreadRegisterSetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetThreadRegisterSetProperties = ze_lib::context->zetDdiTable.load()->Debug.pfnGetThreadRegisterSetProperties;
+    auto pfnGetThreadRegisterSetProperties = ze_lib::context->getZetDdiTable()->Debug.pfnGetThreadRegisterSetProperties;
     if( nullptr == pfnGetThreadRegisterSetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -531,7 +531,7 @@ zetDebugReadRegisters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadRegisters = ze_lib::context->zetDdiTable.load()->Debug.pfnReadRegisters;
+    auto pfnReadRegisters = ze_lib::context->getZetDdiTable()->Debug.pfnReadRegisters;
     if( nullptr == pfnReadRegisters ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -573,7 +573,7 @@ zetDebugWriteRegisters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnWriteRegisters = ze_lib::context->zetDdiTable.load()->Debug.pfnWriteRegisters;
+    auto pfnWriteRegisters = ze_lib::context->getZetDdiTable()->Debug.pfnWriteRegisters;
     if( nullptr == pfnWriteRegisters ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -618,7 +618,7 @@ zetMetricGroupGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zetDdiTable.load()->MetricGroup.pfnGet;
+    auto pfnGet = ze_lib::context->getZetDdiTable()->MetricGroup.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -655,7 +655,7 @@ zetMetricGroupGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zetDdiTable.load()->MetricGroup.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZetDdiTable()->MetricGroup.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -706,7 +706,7 @@ zetMetricGroupCalculateMetricValues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCalculateMetricValues = ze_lib::context->zetDdiTable.load()->MetricGroup.pfnCalculateMetricValues;
+    auto pfnCalculateMetricValues = ze_lib::context->getZetDdiTable()->MetricGroup.pfnCalculateMetricValues;
     if( nullptr == pfnCalculateMetricValues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -750,7 +750,7 @@ zetMetricGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zetDdiTable.load()->Metric.pfnGet;
+    auto pfnGet = ze_lib::context->getZetDdiTable()->Metric.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -787,7 +787,7 @@ zetMetricGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zetDdiTable.load()->Metric.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->getZetDdiTable()->Metric.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -842,7 +842,7 @@ zetContextActivateMetricGroups(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnActivateMetricGroups = ze_lib::context->zetDdiTable.load()->Context.pfnActivateMetricGroups;
+    auto pfnActivateMetricGroups = ze_lib::context->getZetDdiTable()->Context.pfnActivateMetricGroups;
     if( nullptr == pfnActivateMetricGroups ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -894,7 +894,7 @@ zetMetricStreamerOpen(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOpen = ze_lib::context->zetDdiTable.load()->MetricStreamer.pfnOpen;
+    auto pfnOpen = ze_lib::context->getZetDdiTable()->MetricStreamer.pfnOpen;
     if( nullptr == pfnOpen ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -938,7 +938,7 @@ zetCommandListAppendMetricStreamerMarker(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMetricStreamerMarker = ze_lib::context->zetDdiTable.load()->CommandList.pfnAppendMetricStreamerMarker;
+    auto pfnAppendMetricStreamerMarker = ze_lib::context->getZetDdiTable()->CommandList.pfnAppendMetricStreamerMarker;
     if( nullptr == pfnAppendMetricStreamerMarker ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -973,7 +973,7 @@ zetMetricStreamerClose(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnClose = ze_lib::context->zetDdiTable.load()->MetricStreamer.pfnClose;
+    auto pfnClose = ze_lib::context->getZetDdiTable()->MetricStreamer.pfnClose;
     if( nullptr == pfnClose ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1022,7 +1022,7 @@ zetMetricStreamerReadData(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadData = ze_lib::context->zetDdiTable.load()->MetricStreamer.pfnReadData;
+    auto pfnReadData = ze_lib::context->getZetDdiTable()->MetricStreamer.pfnReadData;
     if( nullptr == pfnReadData ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1068,7 +1068,7 @@ zetMetricQueryPoolCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zetDdiTable.load()->MetricQueryPool.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZetDdiTable()->MetricQueryPool.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1109,7 +1109,7 @@ zetMetricQueryPoolDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zetDdiTable.load()->MetricQueryPool.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZetDdiTable()->MetricQueryPool.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1148,7 +1148,7 @@ zetMetricQueryCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zetDdiTable.load()->MetricQuery.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZetDdiTable()->MetricQuery.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1187,7 +1187,7 @@ zetMetricQueryDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zetDdiTable.load()->MetricQuery.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZetDdiTable()->MetricQuery.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1224,7 +1224,7 @@ zetMetricQueryReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReset = ze_lib::context->zetDdiTable.load()->MetricQuery.pfnReset;
+    auto pfnReset = ze_lib::context->getZetDdiTable()->MetricQuery.pfnReset;
     if( nullptr == pfnReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1267,7 +1267,7 @@ zetCommandListAppendMetricQueryBegin(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMetricQueryBegin = ze_lib::context->zetDdiTable.load()->CommandList.pfnAppendMetricQueryBegin;
+    auto pfnAppendMetricQueryBegin = ze_lib::context->getZetDdiTable()->CommandList.pfnAppendMetricQueryBegin;
     if( nullptr == pfnAppendMetricQueryBegin ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1324,7 +1324,7 @@ zetCommandListAppendMetricQueryEnd(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMetricQueryEnd = ze_lib::context->zetDdiTable.load()->CommandList.pfnAppendMetricQueryEnd;
+    auto pfnAppendMetricQueryEnd = ze_lib::context->getZetDdiTable()->CommandList.pfnAppendMetricQueryEnd;
     if( nullptr == pfnAppendMetricQueryEnd ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1359,7 +1359,7 @@ zetCommandListAppendMetricMemoryBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMetricMemoryBarrier = ze_lib::context->zetDdiTable.load()->CommandList.pfnAppendMetricMemoryBarrier;
+    auto pfnAppendMetricMemoryBarrier = ze_lib::context->getZetDdiTable()->CommandList.pfnAppendMetricMemoryBarrier;
     if( nullptr == pfnAppendMetricMemoryBarrier ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1404,7 +1404,7 @@ zetMetricQueryGetData(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetData = ze_lib::context->zetDdiTable.load()->MetricQuery.pfnGetData;
+    auto pfnGetData = ze_lib::context->getZetDdiTable()->MetricQuery.pfnGetData;
     if( nullptr == pfnGetData ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1446,7 +1446,7 @@ zetKernelGetProfileInfo(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProfileInfo = ze_lib::context->zetDdiTable.load()->Kernel.pfnGetProfileInfo;
+    auto pfnGetProfileInfo = ze_lib::context->getZetDdiTable()->Kernel.pfnGetProfileInfo;
     if( nullptr == pfnGetProfileInfo ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1490,7 +1490,7 @@ zetTracerExpCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zetDdiTable.load()->TracerExp.pfnCreate;
+    auto pfnCreate = ze_lib::context->getZetDdiTable()->TracerExp.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1530,7 +1530,7 @@ zetTracerExpDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zetDdiTable.load()->TracerExp.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->getZetDdiTable()->TracerExp.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1573,7 +1573,7 @@ zetTracerExpSetPrologues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetPrologues = ze_lib::context->zetDdiTable.load()->TracerExp.pfnSetPrologues;
+    auto pfnSetPrologues = ze_lib::context->getZetDdiTable()->TracerExp.pfnSetPrologues;
     if( nullptr == pfnSetPrologues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1616,7 +1616,7 @@ zetTracerExpSetEpilogues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetEpilogues = ze_lib::context->zetDdiTable.load()->TracerExp.pfnSetEpilogues;
+    auto pfnSetEpilogues = ze_lib::context->getZetDdiTable()->TracerExp.pfnSetEpilogues;
     if( nullptr == pfnSetEpilogues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1652,7 +1652,7 @@ zetTracerExpSetEnabled(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetEnabled = ze_lib::context->zetDdiTable.load()->TracerExp.pfnSetEnabled;
+    auto pfnSetEnabled = ze_lib::context->getZetDdiTable()->TracerExp.pfnSetEnabled;
     if( nullptr == pfnSetEnabled ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1696,7 +1696,7 @@ zetDeviceGetConcurrentMetricGroupsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConcurrentMetricGroupsExp = ze_lib::context->zetDdiTable.load()->DeviceExp.pfnGetConcurrentMetricGroupsExp;
+    auto pfnGetConcurrentMetricGroupsExp = ze_lib::context->getZetDdiTable()->DeviceExp.pfnGetConcurrentMetricGroupsExp;
     if( nullptr == pfnGetConcurrentMetricGroupsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1756,7 +1756,7 @@ zetMetricTracerCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnCreateExp;
+    auto pfnCreateExp = ze_lib::context->getZetDdiTable()->MetricTracerExp.pfnCreateExp;
     if( nullptr == pfnCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1791,7 +1791,7 @@ zetMetricTracerDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnDestroyExp;
+    auto pfnDestroyExp = ze_lib::context->getZetDdiTable()->MetricTracerExp.pfnDestroyExp;
     if( nullptr == pfnDestroyExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1834,7 +1834,7 @@ zetMetricTracerEnableExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnableExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnEnableExp;
+    auto pfnEnableExp = ze_lib::context->getZetDdiTable()->MetricTracerExp.pfnEnableExp;
     if( nullptr == pfnEnableExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1878,7 +1878,7 @@ zetMetricTracerDisableExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDisableExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnDisableExp;
+    auto pfnDisableExp = ze_lib::context->getZetDdiTable()->MetricTracerExp.pfnDisableExp;
     if( nullptr == pfnDisableExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1930,7 +1930,7 @@ zetMetricTracerReadDataExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadDataExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnReadDataExp;
+    auto pfnReadDataExp = ze_lib::context->getZetDdiTable()->MetricTracerExp.pfnReadDataExp;
     if( nullptr == pfnReadDataExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1964,7 +1964,7 @@ zetMetricDecoderCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExp = ze_lib::context->zetDdiTable.load()->MetricDecoderExp.pfnCreateExp;
+    auto pfnCreateExp = ze_lib::context->getZetDdiTable()->MetricDecoderExp.pfnCreateExp;
     if( nullptr == pfnCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -1995,7 +1995,7 @@ zetMetricDecoderDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExp = ze_lib::context->zetDdiTable.load()->MetricDecoderExp.pfnDestroyExp;
+    auto pfnDestroyExp = ze_lib::context->getZetDdiTable()->MetricDecoderExp.pfnDestroyExp;
     if( nullptr == pfnDestroyExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2048,7 +2048,7 @@ zetMetricDecoderGetDecodableMetricsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDecodableMetricsExp = ze_lib::context->zetDdiTable.load()->MetricDecoderExp.pfnGetDecodableMetricsExp;
+    auto pfnGetDecodableMetricsExp = ze_lib::context->getZetDdiTable()->MetricDecoderExp.pfnGetDecodableMetricsExp;
     if( nullptr == pfnGetDecodableMetricsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2123,7 +2123,7 @@ zetMetricTracerDecodeExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDecodeExp = ze_lib::context->zetDdiTable.load()->MetricTracerExp.pfnDecodeExp;
+    auto pfnDecodeExp = ze_lib::context->getZetDdiTable()->MetricTracerExp.pfnDecodeExp;
     if( nullptr == pfnDecodeExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2193,7 +2193,7 @@ zetMetricGroupCalculateMultipleMetricValuesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCalculateMultipleMetricValuesExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnCalculateMultipleMetricValuesExp;
+    auto pfnCalculateMultipleMetricValuesExp = ze_lib::context->getZetDdiTable()->MetricGroupExp.pfnCalculateMultipleMetricValuesExp;
     if( nullptr == pfnCalculateMultipleMetricValuesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2236,7 +2236,7 @@ zetMetricGroupGetGlobalTimestampsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetGlobalTimestampsExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnGetGlobalTimestampsExp;
+    auto pfnGetGlobalTimestampsExp = ze_lib::context->getZetDdiTable()->MetricGroupExp.pfnGetGlobalTimestampsExp;
     if( nullptr == pfnGetGlobalTimestampsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2287,7 +2287,7 @@ zetMetricGroupGetExportDataExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExportDataExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnGetExportDataExp;
+    auto pfnGetExportDataExp = ze_lib::context->getZetDdiTable()->MetricGroupExp.pfnGetExportDataExp;
     if( nullptr == pfnGetExportDataExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2358,7 +2358,7 @@ zetMetricGroupCalculateMetricExportDataExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCalculateMetricExportDataExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnCalculateMetricExportDataExp;
+    auto pfnCalculateMetricExportDataExp = ze_lib::context->getZetDdiTable()->MetricGroupExp.pfnCalculateMetricExportDataExp;
     if( nullptr == pfnCalculateMetricExportDataExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2405,7 +2405,7 @@ zetMetricProgrammableGetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExp = ze_lib::context->zetDdiTable.load()->MetricProgrammableExp.pfnGetExp;
+    auto pfnGetExp = ze_lib::context->getZetDdiTable()->MetricProgrammableExp.pfnGetExp;
     if( nullptr == pfnGetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2442,7 +2442,7 @@ zetMetricProgrammableGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPropertiesExp = ze_lib::context->zetDdiTable.load()->MetricProgrammableExp.pfnGetPropertiesExp;
+    auto pfnGetPropertiesExp = ze_lib::context->getZetDdiTable()->MetricProgrammableExp.pfnGetPropertiesExp;
     if( nullptr == pfnGetPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2488,7 +2488,7 @@ zetMetricProgrammableGetParamInfoExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetParamInfoExp = ze_lib::context->zetDdiTable.load()->MetricProgrammableExp.pfnGetParamInfoExp;
+    auto pfnGetParamInfoExp = ze_lib::context->getZetDdiTable()->MetricProgrammableExp.pfnGetParamInfoExp;
     if( nullptr == pfnGetParamInfoExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2536,7 +2536,7 @@ zetMetricProgrammableGetParamValueInfoExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetParamValueInfoExp = ze_lib::context->zetDdiTable.load()->MetricProgrammableExp.pfnGetParamValueInfoExp;
+    auto pfnGetParamValueInfoExp = ze_lib::context->getZetDdiTable()->MetricProgrammableExp.pfnGetParamValueInfoExp;
     if( nullptr == pfnGetParamValueInfoExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2600,7 +2600,7 @@ zetMetricCreateFromProgrammableExp2(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateFromProgrammableExp2 = ze_lib::context->zetDdiTable.load()->MetricExp.pfnCreateFromProgrammableExp2;
+    auto pfnCreateFromProgrammableExp2 = ze_lib::context->getZetDdiTable()->MetricExp.pfnCreateFromProgrammableExp2;
     if( nullptr == pfnCreateFromProgrammableExp2 ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2657,7 +2657,7 @@ zetMetricCreateFromProgrammableExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateFromProgrammableExp = ze_lib::context->zetDdiTable.load()->MetricExp.pfnCreateFromProgrammableExp;
+    auto pfnCreateFromProgrammableExp = ze_lib::context->getZetDdiTable()->MetricExp.pfnCreateFromProgrammableExp;
     if( nullptr == pfnCreateFromProgrammableExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2719,7 +2719,7 @@ zetDeviceCreateMetricGroupsFromMetricsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateMetricGroupsFromMetricsExp = ze_lib::context->zetDdiTable.load()->DeviceExp.pfnCreateMetricGroupsFromMetricsExp;
+    auto pfnCreateMetricGroupsFromMetricsExp = ze_lib::context->getZetDdiTable()->DeviceExp.pfnCreateMetricGroupsFromMetricsExp;
     if( nullptr == pfnCreateMetricGroupsFromMetricsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2767,7 +2767,7 @@ zetMetricGroupCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnCreateExp;
+    auto pfnCreateExp = ze_lib::context->getZetDdiTable()->MetricGroupExp.pfnCreateExp;
     if( nullptr == pfnCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2823,7 +2823,7 @@ zetMetricGroupAddMetricExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAddMetricExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnAddMetricExp;
+    auto pfnAddMetricExp = ze_lib::context->getZetDdiTable()->MetricGroupExp.pfnAddMetricExp;
     if( nullptr == pfnAddMetricExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2865,7 +2865,7 @@ zetMetricGroupRemoveMetricExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnRemoveMetricExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnRemoveMetricExp;
+    auto pfnRemoveMetricExp = ze_lib::context->getZetDdiTable()->MetricGroupExp.pfnRemoveMetricExp;
     if( nullptr == pfnRemoveMetricExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2915,7 +2915,7 @@ zetMetricGroupCloseExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCloseExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnCloseExp;
+    auto pfnCloseExp = ze_lib::context->getZetDdiTable()->MetricGroupExp.pfnCloseExp;
     if( nullptr == pfnCloseExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2957,7 +2957,7 @@ zetMetricGroupDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExp = ze_lib::context->zetDdiTable.load()->MetricGroupExp.pfnDestroyExp;
+    auto pfnDestroyExp = ze_lib::context->getZetDdiTable()->MetricGroupExp.pfnDestroyExp;
     if( nullptr == pfnDestroyExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -2996,7 +2996,7 @@ zetMetricDestroyExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroyExp = ze_lib::context->zetDdiTable.load()->MetricExp.pfnDestroyExp;
+    auto pfnDestroyExp = ze_lib::context->getZetDdiTable()->MetricExp.pfnDestroyExp;
     if( nullptr == pfnDestroyExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
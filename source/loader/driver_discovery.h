@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -17,4 +18,13 @@ using DriverLibraryPath = std::string;
 
 std::vector<DriverLibraryPath> discoverEnabledDrivers();
 
+// ze_init_driver_type_flags_t a discovered driver declares in its manifest,
+// or 0 if unknown and the driver has to be asked.
+uint32_t getDriverTypeFlags(const DriverLibraryPath &driver);
+
+// Record which discovered drivers could be loaded, so that a later discovery
+// can skip the libraries which are not installed.
+void recordLoadedDrivers(const std::vector<DriverLibraryPath> &drivers,
+                         const std::vector<bool> &loaded);
+
 } // namespace loader
@@ -9,9 +9,19 @@
 #include "source/loader/driver_discovery.h"
 
 #include "source/inc/ze_util.h"
+#include "ze_api.h"
+#include <algorithm>
+#include <cstdio>
+#include <dirent.h>
+#include <dlfcn.h>
+#include <fstream>
 #include <iostream>
+#include <link.h>
+#include <map>
 #include <sstream>
 #include <string>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace loader {
 
@@ -22,6 +32,211 @@ static const char *knownDriverNames[] = {
     MAKE_LIBRARY_NAME("ze_intel_npu", "1"),
 };
 
+// Directories searched for driver manifests when ZEL_DRIVER_MANIFEST_PATH is not set.
+static const char *defaultManifestPath = "/etc/level-zero/drivers.d:/usr/share/level-zero/drivers.d";
+
+// Stamp of the dynamic linker's search state; libraries missing from the
+// discovery cache are only assumed missing while the stamp is unchanged.
+static const char *ldCachePath = "/etc/ld.so.cache";
+
+// Directories the dynamic linker searches after its cache.
+static const char *ldDefaultPath = "/lib:/usr/lib:/lib64:/usr/lib64";
+
+static const char *discoveryCacheVersion = "ze_driver_discovery_cache 2";
+
+// ze_init_driver_type_flags_t declared by the manifests, keyed by library path.
+static std::map<std::string, uint32_t> manifestDriverTypes;
+
+// Library names found, or not found, by the previous process, as read from
+// and written to the discovery cache.
+struct CachedLibrary {
+  std::string path; // resolved path, empty if the library was not found
+  uint64_t inode = 0;
+  uint64_t mtime = 0;
+};
+static std::map<std::string, CachedLibrary> cachedLibraries;
+static bool cachedLibrariesValid = false;
+
+static bool statFile(const std::string &path, uint64_t &inode, uint64_t &mtime) {
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode)) {
+    return false;
+  }
+  inode = static_cast<uint64_t>(st.st_ino);
+  mtime = static_cast<uint64_t>(st.st_mtim.tv_sec) * 1000000000ull + st.st_mtim.tv_nsec;
+  return true;
+}
+
+static std::string trim(const std::string &str) {
+  auto begin = str.find_first_not_of(" \t\r");
+  if (begin == std::string::npos) {
+    return "";
+  }
+  auto end = str.find_last_not_of(" \t\r");
+  return str.substr(begin, end - begin + 1);
+}
+
+static uint32_t parseDriverTypes(const std::string &types) {
+  uint32_t flags = 0;
+  std::stringstream ss(types);
+  while (ss.good()) {
+    std::string type;
+    getline(ss, type, ',');
+    type = trim(type);
+    if (type == "gpu") {
+      flags |= ZE_INIT_DRIVER_TYPE_FLAG_GPU;
+    } else if (type == "npu") {
+      flags |= ZE_INIT_DRIVER_TYPE_FLAG_NPU;
+    }
+  }
+  return flags;
+}
+
+// A manifest is a file named *.conf holding key=value lines:
+//   library=<absolute path or library name of the driver>
+//   type=<comma separated list of gpu, npu>
+// A manifest naming a missing absolute path is skipped without loading it.
+static void readManifest(const std::string &file, std::vector<DriverLibraryPath> &drivers) {
+  std::ifstream in(file);
+  std::string line, library, types;
+  while (getline(in, line)) {
+    line = trim(line);
+    auto separator = line.find('=');
+    if (line.empty() || line[0] == '#' || separator == std::string::npos) {
+      continue;
+    }
+    auto key = trim(line.substr(0, separator));
+    auto value = trim(line.substr(separator + 1));
+    if (key == "library") {
+      library = value;
+    } else if (key == "type") {
+      types = value;
+    }
+  }
+
+  uint64_t inode, mtime;
+  if (library.empty() || (library[0] == '/' && !statFile(library, inode, mtime))) {
+    return;
+  }
+  if (std::find(drivers.begin(), drivers.end(), library) != drivers.end()) {
+    return;
+  }
+  drivers.emplace_back(library);
+  manifestDriverTypes[library] = parseDriverTypes(types);
+}
+
+// Whether a driver, given by path or by name, is the library of the given name.
+static bool isLibrary(const DriverLibraryPath &driver, const std::string &name) {
+  auto separator = driver.find_last_of('/');
+  return (separator == std::string::npos ? driver : driver.substr(separator + 1)) == name;
+}
+
+static std::vector<DriverLibraryPath> discoverManifestDrivers() {
+  std::vector<DriverLibraryPath> drivers;
+  std::string manifestPath = getenv_string("ZEL_DRIVER_MANIFEST_PATH");
+  if (manifestPath.empty()) {
+    manifestPath = defaultManifestPath;
+  }
+
+  std::stringstream ss(manifestPath);
+  while (ss.good()) {
+    std::string directory;
+    getline(ss, directory, ':');
+    DIR *dir = directory.empty() ? nullptr : opendir(directory.c_str());
+    if (dir == nullptr) {
+      continue;
+    }
+    // read the manifests in name order so that the driver order is stable
+    std::vector<std::string> files;
+    while (auto entry = readdir(dir)) {
+      std::string name = entry->d_name;
+      if (name.size() > 5 && name.compare(name.size() - 5, 5, ".conf") == 0) {
+        files.push_back(directory + "/" + name);
+      }
+    }
+    closedir(dir);
+    std::sort(files.begin(), files.end());
+    for (auto &file : files) {
+      readManifest(file, drivers);
+    }
+  }
+  return drivers;
+}
+
+static uint64_t getDirectoryMtime(const std::string &path) {
+  struct stat st;
+  if (path.empty() || stat(path.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) {
+    return 0;
+  }
+  return static_cast<uint64_t>(st.st_mtim.tv_sec) * 1000000000ull + st.st_mtim.tv_nsec;
+}
+
+// Installing a library into a searched directory changes the directory's
+// mtime, so the stamp holds the mtime of each directory of LD_LIBRARY_PATH and
+// of the default path along with the linker cache's.
+static std::string getLdCacheStamp() {
+  uint64_t inode = 0, mtime = 0;
+  statFile(ldCachePath, inode, mtime);
+  std::string libraryPath = getenv_string("LD_LIBRARY_PATH");
+  std::string stamp = std::to_string(inode) + " " + std::to_string(mtime) + " " + libraryPath;
+
+  std::stringstream ss(libraryPath + ":" + ldDefaultPath);
+  while (ss.good()) {
+    std::string directory;
+    getline(ss, directory, ':');
+    if (!directory.empty()) {
+      stamp += " " + std::to_string(getDirectoryMtime(directory));
+    }
+  }
+  return stamp;
+}
+
+// The discovery cache is only used if ZEL_DRIVER_DISCOVERY_CACHE names its file.
+// Each line after the header is "<library name>\t<path>\t<inode>\t<mtime>",
+// with an empty path for libraries which were not found.
+static void readDiscoveryCache() {
+  std::string cacheFile = getenv_string("ZEL_DRIVER_DISCOVERY_CACHE");
+  if (cacheFile.empty()) {
+    return;
+  }
+  std::ifstream in(cacheFile);
+  std::string line;
+  if (!getline(in, line) || line != discoveryCacheVersion || !getline(in, line) || line != getLdCacheStamp()) {
+    return;
+  }
+  while (getline(in, line)) {
+    std::stringstream fields(line);
+    std::string name, inode, mtime;
+    CachedLibrary library;
+    if (getline(fields, name, '\t') && getline(fields, library.path, '\t') &&
+        getline(fields, inode, '\t') && getline(fields, mtime, '\t')) {
+      library.inode = std::strtoull(inode.c_str(), nullptr, 10);
+      library.mtime = std::strtoull(mtime.c_str(), nullptr, 10);
+      cachedLibraries[name] = library;
+    }
+  }
+  cachedLibrariesValid = true;
+}
+
+// Resolve a library name through the discovery cache. Returns false if the
+// cache knows the library is not installed; a path found by the previous
+// process is only used while its inode and mtime are unchanged.
+static bool resolveCachedLibrary(DriverLibraryPath &driver) {
+  auto it = cachedLibraries.find(driver);
+  if (!cachedLibrariesValid || driver.empty() || driver[0] == '/' || it == cachedLibraries.end()) {
+    return true;
+  }
+  if (it->second.path.empty()) {
+    return false;
+  }
+  uint64_t inode, mtime;
+  if (statFile(it->second.path, inode, mtime) && inode == it->second.inode && mtime == it->second.mtime) {
+    manifestDriverTypes[it->second.path] = getDriverTypeFlags(driver);
+    driver = it->second.path;
+  }
+  return true;
+}
+
 std::vector<DriverLibraryPath> discoverEnabledDrivers() {
   std::vector<DriverLibraryPath> enabledDrivers;
   const char *altDrivers = nullptr;
@@ -29,8 +244,19 @@ std::vector<DriverLibraryPath> discoverEnabledDrivers() {
   // ZE_ENABLE_ALT_DRIVERS is for development/debug only
   altDrivers = getenv("ZE_ENABLE_ALT_DRIVERS");
   if (altDrivers == nullptr) {
-    for (auto path : knownDriverNames) {
-      enabledDrivers.emplace_back(path);
+    std::vector<DriverLibraryPath> candidates = discoverManifestDrivers();
+    // drivers installed without a manifest are still found by their known names
+    for (auto name : knownDriverNames) {
+      if (std::none_of(candidates.begin(), candidates.end(),
+                       [name](const DriverLibraryPath &driver) { return isLibrary(driver, name); })) {
+        candidates.emplace_back(name);
+      }
+    }
+    readDiscoveryCache();
+    for (auto &driver : candidates) {
+      if (resolveCachedLibrary(driver)) {
+        enabledDrivers.push_back(driver);
+      }
     }
   } else {
     std::stringstream ss(altDrivers);
@@ -43,4 +269,70 @@ std::vector<DriverLibraryPath> discoverEnabledDrivers() {
   return enabledDrivers;
 }
 
+uint32_t getDriverTypeFlags(const DriverLibraryPath &driver) {
+  auto it = manifestDriverTypes.find(driver);
+  return it == manifestDriverTypes.end() ? 0 : it->second;
+}
+
+void recordLoadedDrivers(const std::vector<DriverLibraryPath> &drivers,
+                         const std::vector<bool> &loaded) {
+  std::string cacheFile = getenv_string("ZEL_DRIVER_DISCOVERY_CACHE");
+  if (cacheFile.empty() || getenv("ZE_ENABLE_ALT_DRIVERS") != nullptr) {
+    return;
+  }
+
+  // drivers resolved through the cache keep their entries
+  auto libraries = cachedLibrariesValid ? cachedLibraries : std::map<std::string, CachedLibrary>();
+  bool changed = !cachedLibrariesValid;
+  for (size_t i = 0; i < drivers.size(); ++i) {
+    auto &name = drivers[i];
+    if (name.empty() || name[0] == '/') {
+      continue;
+    }
+    CachedLibrary library;
+    if (loaded[i]) {
+      // the library is loaded, so this only looks up where the linker found it
+      void *handle = dlopen(name.c_str(), RTLD_LAZY | RTLD_NOLOAD);
+      struct link_map *map = nullptr;
+      if (handle != nullptr && dlinfo(handle, RTLD_DI_LINKMAP, &map) == 0 && map != nullptr && map->l_name != nullptr) {
+        library.path = map->l_name;
+      }
+      if (handle != nullptr) {
+        dlclose(handle);
+      }
+      if (library.path.empty() || library.path[0] != '/' || !statFile(library.path, library.inode, library.mtime)) {
+        continue;
+      }
+    }
+    auto it = libraries.find(name);
+    if (it == libraries.end() || it->second.path != library.path || it->second.inode != library.inode ||
+        it->second.mtime != library.mtime) {
+      libraries[name] = library;
+      changed = true;
+    }
+  }
+  if (!changed) {
+    return;
+  }
+
+  // write a temporary file and rename it, so readers never see a partial cache
+  std::string tempFile = cacheFile + "." + std::to_string(getpid());
+  {
+    std::ofstream out(tempFile, std::ios::trunc);
+    out << discoveryCacheVersion << "\n"
+        << getLdCacheStamp() << "\n";
+    for (auto &entry : libraries) {
+      out << entry.first << "\t" << entry.second.path << "\t" << entry.second.inode << "\t" << entry.second.mtime << "\n";
+    }
+    if (!out.good()) {
+      out.close();
+      unlink(tempFile.c_str());
+      return;
+    }
+  }
+  if (rename(tempFile.c_str(), cacheFile.c_str()) != 0) {
+    unlink(tempFile.c_str());
+  }
+}
+
 } // namespace loader
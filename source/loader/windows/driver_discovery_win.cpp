@@ -207,4 +207,14 @@ std::vector<DriverLibraryPath> discoverDriversBasedOnDisplayAdapters(const GUID
     return enabledDrivers;
 }
 
+// Drivers are discovered through the display adapters, which have no manifest.
+uint32_t getDriverTypeFlags(const DriverLibraryPath &driver) {
+    return 0;
+}
+
+// The display adapters only list installed drivers, so there is nothing to record.
+void recordLoadedDrivers(const std::vector<DriverLibraryPath> &drivers,
+                         const std::vector<bool> &loaded) {
+}
+
 } // namespace loader
@@ -0,0 +1,120 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ze_enumeration_cache.h
+ *
+ */
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace loader
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// translated results of the enumeration intercepts (zeDriverGet,
+    /// zeDeviceGet, zeDeviceGetSubDevices), keyed by the loader handle of the
+    /// parent; drivers are stored under a null parent.
+    /// an entry first learns the total count from a count query and becomes
+    /// complete once a fill returns every handle, after which repeat calls
+    /// are answered with a copy instead of reaching the drivers.
+    class enumeration_cache_t
+    {
+    public:
+        //////////////////////////////////////////////////////////////////////////
+        /// answer a call from the cache; returns false if the entry cannot
+        /// answer it and the call must be forwarded
+        template<typename _handle_t>
+        bool get( const void* parent, uint32_t* pCount, _handle_t* phHandles )
+        {
+            static_assert( sizeof( _handle_t ) == sizeof( void* ), "handles must be pointer sized" );
+
+            std::lock_guard<std::mutex> lk( mut );
+            auto it = entries.find( parent );
+            if( it == entries.end() )
+                return false;
+
+            auto& entry = it->second;
+            if( ( nullptr == phHandles ) || ( 0 == *pCount ) )
+            {
+                *pCount = entry.total;
+                return true;
+            }
+            if( !entry.complete )
+                return false;
+
+            if( *pCount > entry.total )
+                *pCount = entry.total;
+            if( 0 < *pCount )
+                memcpy( phHandles, entry.handles.data(), *pCount * sizeof( void* ) );
+            return true;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// record the result of a successful forwarded call, where requested
+        /// is the count passed in and count the count returned
+        template<typename _handle_t>
+        void store( const void* parent, uint32_t requested, uint32_t count, const _handle_t* phHandles )
+        {
+            static_assert( sizeof( _handle_t ) == sizeof( void* ), "handles must be pointer sized" );
+
+            std::lock_guard<std::mutex> lk( mut );
+            if( ( nullptr == phHandles ) || ( 0 == requested ) )
+            {
+                auto& entry = entries[ parent ];
+                if( entry.total != count )
+                    entry = entry_t{ count, false, {} };
+                return;
+            }
+
+            // a fill is only known to be complete if it returned less than
+            // was asked for, or as many as a previous count query reported
+            auto it = entries.find( parent );
+            bool complete = ( count < requested ) || ( ( it != entries.end() ) && ( it->second.total == count ) );
+            if( !complete )
+                return;
+
+            auto& entry = entries[ parent ];
+            entry.total = count;
+            entry.complete = true;
+            entry.handles.resize( count );
+            if( 0 < count )
+                memcpy( entry.handles.data(), phHandles, count * sizeof( void* ) );
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// forget every entry, e.g. once the set of drivers has changed
+        void clear()
+        {
+            std::lock_guard<std::mutex> lk( mut );
+            entries.clear();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// zeInitDrivers with other driver type flags may report other drivers
+        void update_init_driver_flags( uint32_t flags )
+        {
+            std::lock_guard<std::mutex> lk( mut );
+            if( flags != initDriverFlags )
+                entries.clear();
+            initDriverFlags = flags;
+        }
+
+    protected:
+        struct entry_t
+        {
+            uint32_t total = 0;                     ///< total count reported by the last count query or fill
+            bool complete = false;                  ///< handles holds all total handles
+            std::vector<void*> handles;             ///< translated handles, valid if complete
+        };
+
+        std::mutex mut;
+        std::unordered_map<const void*, entry_t> entries;
+        uint32_t initDriverFlags = 0;
+    };
+}
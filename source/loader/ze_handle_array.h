@@ -0,0 +1,82 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ze_handle_array.h
+ *
+ */
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace loader
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// scratch storage used by the intercepts to translate an array of loader
+    /// handles into driver handles before forwarding the call.
+    /// arrays of up to _inline_count handles live on the stack; larger arrays
+    /// borrow a buffer from a per-thread pool which is kept for reuse, so the
+    /// translation does not allocate once a thread has seen its largest array.
+    template<typename _handle_t, size_t _inline_count = 16>
+    class handle_array_t
+    {
+    public:
+        using handle_t = _handle_t;
+
+        handle_array_t() = delete;
+        handle_array_t( const handle_array_t& ) = delete;
+        handle_array_t& operator=( const handle_array_t& ) = delete;
+
+        explicit handle_array_t( size_t count )
+            : ptr( inline_storage )
+        {
+            if( count > _inline_count )
+            {
+                auto& pool = get_pool();
+                if( !pool.empty() )
+                {
+                    buffer = std::move( pool.back() );
+                    pool.pop_back();
+                }
+                if( buffer.capacity < count )
+                {
+                    buffer.data.reset( new handle_t[ count ] );
+                    buffer.capacity = count;
+                }
+                ptr = buffer.data.get();
+            }
+        }
+
+        ~handle_array_t()
+        {
+            if( buffer.data )
+                get_pool().push_back( std::move( buffer ) );
+        }
+
+        handle_t* data() { return ptr; }
+        operator handle_t*() { return ptr; }
+        handle_t& operator[]( size_t i ) { return ptr[ i ]; }
+
+    private:
+        struct buffer_t
+        {
+            std::unique_ptr<handle_t[]> data;
+            size_t capacity = 0;
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        /// buffers released by this thread, available to the next large array
+        static std::vector<buffer_t>& get_pool()
+        {
+            static thread_local std::vector<buffer_t> pool;
+            return pool;
+        }
+
+        handle_t inline_storage[ _inline_count ];
+        handle_t* ptr;
+        buffer_t buffer;
+    };
+}
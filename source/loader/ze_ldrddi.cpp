@@ -53,6 +53,11 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
 
+        // repeat enumerations are answered from the cache
+        uint32_t requestedCount = *pCount;
+        if( context->enumeration_cache.get( nullptr, pCount, phDrivers ) )
+            return ZE_RESULT_SUCCESS;
+
         uint32_t total_driver_handle_count = 0;
 
         for( auto& drv : loader::context->zeDrivers )
@@ -86,7 +91,8 @@ namespace loader
 
                 try
                 {
-                    for( uint32_t i = 0; i < library_driver_handle_count; ++i ) {
+                    // driver handles carry the loader's table and are returned as is
+                    for( uint32_t i = 0; !drv.ddiHandlesTable && i < library_driver_handle_count; ++i ) {
                         uint32_t driver_index = total_driver_handle_count + i;
                         phDrivers[ driver_index ] = reinterpret_cast<ze_driver_handle_t>(
                             context->ze_driver_factory.getInstance( phDrivers[ driver_index ], &drv.dditable ) );
@@ -108,6 +114,9 @@ namespace loader
             result = ZE_RESULT_SUCCESS;
         }
 
+        if( ZE_RESULT_SUCCESS == result )
+            context->enumeration_cache.store( nullptr, requestedCount, *pCount, phDrivers );
+
         return result;
     }
 
@@ -129,6 +138,10 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
 
+        // drivers reported for other driver types may differ
+        if( nullptr != desc )
+            context->enumeration_cache.update_init_driver_flags( desc->flags );
+
         uint32_t total_driver_handle_count = 0;
 
         for( auto& drv : loader::context->zeDrivers )
@@ -138,6 +151,10 @@ namespace loader
                 continue;
             }
 
+            // drivers whose manifest declares other driver types are not asked
+            if( ( nullptr != desc ) && drv.driverTypeFlags && !( drv.driverTypeFlags & desc->flags ) )
+                continue;
+
             if( ( 0 < *pCount ) && ( *pCount == total_driver_handle_count))
                 break;
 
@@ -164,7 +181,8 @@ namespace loader
 
                 try
                 {
-                    for( uint32_t i = 0; i < library_driver_handle_count; ++i ) {
+                    // driver handles carry the loader's table and are returned as is
+                    for( uint32_t i = 0; !drv.ddiHandlesTable && i < library_driver_handle_count; ++i ) {
                         uint32_t driver_index = total_driver_handle_count + i;
                         phDrivers[ driver_index ] = reinterpret_cast<ze_driver_handle_t>(
                             context->ze_driver_factory.getInstance( phDrivers[ driver_index ], &drv.dditable ) );
@@ -205,6 +223,10 @@ namespace loader
         if( nullptr == pfnGetApiVersion )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetApiVersion( hDriver, version );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -230,6 +252,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hDriver, pDriverProperties );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -255,6 +281,10 @@ namespace loader
         if( nullptr == pfnGetIpcProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetIpcProperties( hDriver, pIpcProperties );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -289,6 +319,10 @@ namespace loader
         if( nullptr == pfnGetExtensionProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -315,6 +349,10 @@ namespace loader
         if( nullptr == pfnGetExtensionFunctionAddress )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -341,6 +379,10 @@ namespace loader
         if( nullptr == pfnGetLastErrorDescription )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetLastErrorDescription( hDriver, ppString );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -373,6 +415,16 @@ namespace loader
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGet( hDriver, pCount, phDevices );
+
+        // repeat enumerations are answered from the cache
+        auto hParent = hDriver;
+        uint32_t requestedCount = *pCount;
+        if( context->enumeration_cache.get( hParent, pCount, phDevices ) )
+            return ZE_RESULT_SUCCESS;
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -394,6 +446,9 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result )
+            context->enumeration_cache.store( hParent, requestedCount, *pCount, phDevices );
+
         return result;
     }
 
@@ -413,6 +468,10 @@ namespace loader
         if( nullptr == pfnGetRootDevice )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetRootDevice( hDevice, phRootDevice );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -459,6 +518,16 @@ namespace loader
         if( nullptr == pfnGetSubDevices )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetSubDevices( hDevice, pCount, phSubdevices );
+
+        // repeat enumerations are answered from the cache
+        auto hParent = hDevice;
+        uint32_t requestedCount = *pCount;
+        if( context->enumeration_cache.get( hParent, pCount, phSubdevices ) )
+            return ZE_RESULT_SUCCESS;
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -480,6 +549,9 @@ namespace loader
             result = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
 
+        if( ZE_RESULT_SUCCESS == result )
+            context->enumeration_cache.store( hParent, requestedCount, *pCount, phSubdevices );
+
         return result;
     }
 
@@ -499,6 +571,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hDevice, pDeviceProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -524,6 +600,10 @@ namespace loader
         if( nullptr == pfnGetComputeProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetComputeProperties( hDevice, pComputeProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -549,6 +629,10 @@ namespace loader
         if( nullptr == pfnGetModuleProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetModuleProperties( hDevice, pModuleProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -584,6 +668,10 @@ namespace loader
         if( nullptr == pfnGetCommandQueueGroupProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -618,6 +706,10 @@ namespace loader
         if( nullptr == pfnGetMemoryProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetMemoryProperties( hDevice, pCount, pMemProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -643,6 +735,10 @@ namespace loader
         if( nullptr == pfnGetMemoryAccessProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetMemoryAccessProperties( hDevice, pMemAccessProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -676,6 +772,10 @@ namespace loader
         if( nullptr == pfnGetCacheProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetCacheProperties( hDevice, pCount, pCacheProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -701,6 +801,10 @@ namespace loader
         if( nullptr == pfnGetImageProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetImageProperties( hDevice, pImageProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -726,6 +830,10 @@ namespace loader
         if( nullptr == pfnGetExternalMemoryProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -752,6 +860,10 @@ namespace loader
         if( nullptr == pfnGetP2PProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetP2PProperties( hDevice, hPeerDevice, pP2PProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -781,6 +893,10 @@ namespace loader
         if( nullptr == pfnCanAccessPeer )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCanAccessPeer( hDevice, hPeerDevice, value );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -808,6 +924,10 @@ namespace loader
         if( nullptr == pfnGetStatus )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetStatus( hDevice );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -836,6 +956,10 @@ namespace loader
         if( nullptr == pfnGetGlobalTimestamps )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetGlobalTimestamps( hDevice, hostTimestamp, deviceTimestamp );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -862,6 +986,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hDriver, desc, phContext );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -912,17 +1040,20 @@ namespace loader
         if( nullptr == pfnCreateEx )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreateEx( hDriver, desc, numDevices, phDevices, phContext );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // convert loader handles to driver handles
-        auto phDevicesLocal = new ze_device_handle_t [numDevices];
+        handle_array_t<ze_device_handle_t> phDevicesLocal( numDevices );
         for( size_t i = 0; ( nullptr != phDevices ) && ( i < numDevices ); ++i )
             phDevicesLocal[ i ] = reinterpret_cast<ze_device_object_t*>( phDevices[ i ] )->handle;
 
         // forward to device-driver
         result = pfnCreateEx( hDriver, desc, numDevices, phDevicesLocal, phContext );
-        delete []phDevicesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -956,6 +1087,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hContext );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -986,6 +1121,10 @@ namespace loader
         if( nullptr == pfnGetStatus )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetStatus( hContext );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -1013,6 +1152,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hContext, hDevice, desc, phCommandQueue );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -1054,6 +1197,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hCommandQueue );
+
         // convert loader handle to driver handle
         hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
 
@@ -1088,11 +1235,15 @@ namespace loader
         if( nullptr == pfnExecuteCommandLists )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnExecuteCommandLists( hCommandQueue, numCommandLists, phCommandLists, hFence );
+
         // convert loader handle to driver handle
         hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
 
         // convert loader handles to driver handles
-        auto phCommandListsLocal = new ze_command_list_handle_t [numCommandLists];
+        handle_array_t<ze_command_list_handle_t> phCommandListsLocal( numCommandLists );
         for( size_t i = 0; ( nullptr != phCommandLists ) && ( i < numCommandLists ); ++i )
             phCommandListsLocal[ i ] = reinterpret_cast<ze_command_list_object_t*>( phCommandLists[ i ] )->handle;
 
@@ -1101,7 +1252,6 @@ namespace loader
 
         // forward to device-driver
         result = pfnExecuteCommandLists( hCommandQueue, numCommandLists, phCommandListsLocal, hFence );
-        delete []phCommandListsLocal;
 
         return result;
     }
@@ -1128,6 +1278,10 @@ namespace loader
         if( nullptr == pfnSynchronize )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSynchronize( hCommandQueue, timeout );
+
         // convert loader handle to driver handle
         hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
 
@@ -1153,6 +1307,10 @@ namespace loader
         if( nullptr == pfnGetOrdinal )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetOrdinal( hCommandQueue, pOrdinal );
+
         // convert loader handle to driver handle
         hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
 
@@ -1178,6 +1336,10 @@ namespace loader
         if( nullptr == pfnGetIndex )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetIndex( hCommandQueue, pIndex );
+
         // convert loader handle to driver handle
         hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
 
@@ -1205,6 +1367,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hContext, hDevice, desc, phCommandList );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -1249,6 +1415,10 @@ namespace loader
         if( nullptr == pfnCreateImmediate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreateImmediate( hContext, hDevice, altdesc, phCommandList );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -1290,6 +1460,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hCommandList );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1320,6 +1494,10 @@ namespace loader
         if( nullptr == pfnClose )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnClose( hCommandList );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1344,6 +1522,10 @@ namespace loader
         if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnReset( hCommandList );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1375,6 +1557,10 @@ namespace loader
         if( nullptr == pfnAppendWriteGlobalTimestamp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1382,13 +1568,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1415,6 +1600,10 @@ namespace loader
         if( nullptr == pfnHostSynchronize )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnHostSynchronize( hCommandList, timeout );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1440,6 +1629,10 @@ namespace loader
         if( nullptr == pfnGetDeviceHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetDeviceHandle( hCommandList, phDevice );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1479,6 +1672,10 @@ namespace loader
         if( nullptr == pfnGetContextHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetContextHandle( hCommandList, phContext );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1518,6 +1715,10 @@ namespace loader
         if( nullptr == pfnGetOrdinal )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetOrdinal( hCommandList, pOrdinal );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1544,6 +1745,10 @@ namespace loader
         if( nullptr == pfnImmediateGetIndex )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnImmediateGetIndex( hCommandListImmediate, pIndex );
+
         // convert loader handle to driver handle
         hCommandListImmediate = reinterpret_cast<ze_command_list_object_t*>( hCommandListImmediate )->handle;
 
@@ -1570,6 +1775,10 @@ namespace loader
         if( nullptr == pfnIsImmediate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnIsImmediate( hCommandList, pIsImmediate );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1599,6 +1808,10 @@ namespace loader
         if( nullptr == pfnAppendBarrier )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1606,13 +1819,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1640,6 +1852,10 @@ namespace loader
         if( nullptr == pfnAppendMemoryRangesBarrier )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1647,13 +1863,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1674,6 +1889,10 @@ namespace loader
         if( nullptr == pfnSystemBarrier )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSystemBarrier( hContext, hDevice );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -1709,6 +1928,10 @@ namespace loader
         if( nullptr == pfnAppendMemoryCopy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1716,13 +1939,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1751,6 +1973,10 @@ namespace loader
         if( nullptr == pfnAppendMemoryFill )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1758,13 +1984,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1801,6 +2026,10 @@ namespace loader
         if( nullptr == pfnAppendMemoryCopyRegion )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1808,13 +2037,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1843,6 +2071,10 @@ namespace loader
         if( nullptr == pfnAppendMemoryCopyFromContext )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1853,13 +2085,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1886,6 +2117,10 @@ namespace loader
         if( nullptr == pfnAppendImageCopy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1899,13 +2134,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1934,6 +2168,10 @@ namespace loader
         if( nullptr == pfnAppendImageCopyRegion )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1947,13 +2185,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1981,6 +2218,10 @@ namespace loader
         if( nullptr == pfnAppendImageCopyToMemory )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -1991,13 +2232,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2025,6 +2265,10 @@ namespace loader
         if( nullptr == pfnAppendImageCopyFromMemory )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -2035,13 +2279,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2063,6 +2306,10 @@ namespace loader
         if( nullptr == pfnAppendMemoryPrefetch )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendMemoryPrefetch( hCommandList, ptr, size );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -2091,6 +2338,10 @@ namespace loader
         if( nullptr == pfnAppendMemAdvise )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -2126,17 +2377,20 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hContext, desc, numDevices, phDevices, phEventPool );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // convert loader handles to driver handles
-        auto phDevicesLocal = new ze_device_handle_t [numDevices];
+        handle_array_t<ze_device_handle_t> phDevicesLocal( numDevices );
         for( size_t i = 0; ( nullptr != phDevices ) && ( i < numDevices ); ++i )
             phDevicesLocal[ i ] = reinterpret_cast<ze_device_object_t*>( phDevices[ i ] )->handle;
 
         // forward to device-driver
         result = pfnCreate( hContext, desc, numDevices, phDevicesLocal, phEventPool );
-        delete []phDevicesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2170,6 +2424,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hEventPool );
+
         // convert loader handle to driver handle
         hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
 
@@ -2202,6 +2460,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hEventPool, desc, phEvent );
+
         // convert loader handle to driver handle
         hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
 
@@ -2240,6 +2502,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hEvent );
+
         // convert loader handle to driver handle
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
@@ -2271,6 +2537,10 @@ namespace loader
         if( nullptr == pfnGetIpcHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetIpcHandle( hEventPool, phIpc );
+
         // convert loader handle to driver handle
         hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
 
@@ -2297,6 +2567,10 @@ namespace loader
         if( nullptr == pfnPutIpcHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnPutIpcHandle( hContext, hIpc );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -2324,6 +2598,10 @@ namespace loader
         if( nullptr == pfnOpenIpcHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOpenIpcHandle( hContext, hIpc, phEventPool );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -2362,6 +2640,10 @@ namespace loader
         if( nullptr == pfnCloseIpcHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCloseIpcHandle( hEventPool );
+
         // convert loader handle to driver handle
         hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
 
@@ -2393,6 +2675,10 @@ namespace loader
         if( nullptr == pfnAppendSignalEvent )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendSignalEvent( hCommandList, hEvent );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -2423,17 +2709,20 @@ namespace loader
         if( nullptr == pfnAppendWaitOnEvents )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendWaitOnEvents( hCommandList, numEvents, phEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phEventsLocal = new ze_event_handle_t [numEvents];
+        handle_array_t<ze_event_handle_t> phEventsLocal( numEvents );
         for( size_t i = 0; ( nullptr != phEvents ) && ( i < numEvents ); ++i )
             phEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendWaitOnEvents( hCommandList, numEvents, phEventsLocal );
-        delete []phEventsLocal;
 
         return result;
     }
@@ -2453,6 +2742,10 @@ namespace loader
         if( nullptr == pfnHostSignal )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnHostSignal( hEvent );
+
         // convert loader handle to driver handle
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
@@ -2484,6 +2777,10 @@ namespace loader
         if( nullptr == pfnHostSynchronize )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnHostSynchronize( hEvent, timeout );
+
         // convert loader handle to driver handle
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
@@ -2508,6 +2805,10 @@ namespace loader
         if( nullptr == pfnQueryStatus )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnQueryStatus( hEvent );
+
         // convert loader handle to driver handle
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
@@ -2533,6 +2834,10 @@ namespace loader
         if( nullptr == pfnAppendEventReset )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendEventReset( hCommandList, hEvent );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -2560,6 +2865,10 @@ namespace loader
         if( nullptr == pfnHostReset )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnHostReset( hEvent );
+
         // convert loader handle to driver handle
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
@@ -2585,6 +2894,10 @@ namespace loader
         if( nullptr == pfnQueryKernelTimestamp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnQueryKernelTimestamp( hEvent, dstptr );
+
         // convert loader handle to driver handle
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
@@ -2621,11 +2934,15 @@ namespace loader
         if( nullptr == pfnAppendQueryKernelTimestamps )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendQueryKernelTimestamps( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phEventsLocal = new ze_event_handle_t [numEvents];
+        handle_array_t<ze_event_handle_t> phEventsLocal( numEvents );
         for( size_t i = 0; ( nullptr != phEvents ) && ( i < numEvents ); ++i )
             phEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phEvents[ i ] )->handle;
 
@@ -2633,14 +2950,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendQueryKernelTimestamps( hCommandList, numEvents, phEventsLocal, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phEventsLocal;
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2661,6 +2976,10 @@ namespace loader
         if( nullptr == pfnGetEventPool )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetEventPool( hEvent, phEventPool );
+
         // convert loader handle to driver handle
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
@@ -2702,6 +3021,10 @@ namespace loader
         if( nullptr == pfnGetSignalScope )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetSignalScope( hEvent, pSignalScope );
+
         // convert loader handle to driver handle
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
@@ -2729,6 +3052,10 @@ namespace loader
         if( nullptr == pfnGetWaitScope )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetWaitScope( hEvent, pWaitScope );
+
         // convert loader handle to driver handle
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
@@ -2754,6 +3081,10 @@ namespace loader
         if( nullptr == pfnGetContextHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetContextHandle( hEventPool, phContext );
+
         // convert loader handle to driver handle
         hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
 
@@ -2794,6 +3125,10 @@ namespace loader
         if( nullptr == pfnGetFlags )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetFlags( hEventPool, pFlags );
+
         // convert loader handle to driver handle
         hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
 
@@ -2820,6 +3155,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hCommandQueue, desc, phFence );
+
         // convert loader handle to driver handle
         hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
 
@@ -2858,6 +3197,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hFence );
+
         // convert loader handle to driver handle
         hFence = reinterpret_cast<ze_fence_object_t*>( hFence )->handle;
 
@@ -2895,6 +3238,10 @@ namespace loader
         if( nullptr == pfnHostSynchronize )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnHostSynchronize( hFence, timeout );
+
         // convert loader handle to driver handle
         hFence = reinterpret_cast<ze_fence_object_t*>( hFence )->handle;
 
@@ -2919,6 +3266,10 @@ namespace loader
         if( nullptr == pfnQueryStatus )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnQueryStatus( hFence );
+
         // convert loader handle to driver handle
         hFence = reinterpret_cast<ze_fence_object_t*>( hFence )->handle;
 
@@ -2943,6 +3294,10 @@ namespace loader
         if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnReset( hFence );
+
         // convert loader handle to driver handle
         hFence = reinterpret_cast<ze_fence_object_t*>( hFence )->handle;
 
@@ -2969,6 +3324,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hDevice, desc, pImageProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -2996,6 +3355,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hContext, hDevice, desc, phImage );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3011,14 +3374,8 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            ze_image_handle_t internalHandlePtr = *phImage;
             *phImage = reinterpret_cast<ze_image_handle_t>(
                 context->ze_image_factory.getInstance( *phImage, dditable ) );
-            // convert loader handle to driver handle and store in map
-            {
-                std::lock_guard<std::mutex> lock(context->image_handle_map_lock);
-                context->image_handle_map.insert({context->ze_image_factory.getInstance( internalHandlePtr, dditable ), internalHandlePtr});
-            }
         }
         catch( std::bad_alloc& )
         {
@@ -3043,11 +3400,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
-        // remove the handle from the kernel arugment map
-        {
-            std::lock_guard<std::mutex> lock(context->image_handle_map_lock);
-            context->image_handle_map.erase(reinterpret_cast<ze_image_object_t*>(hImage));
-        }
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hImage );
+
         // convert loader handle to driver handle
         hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
 
@@ -3086,6 +3442,10 @@ namespace loader
         if( nullptr == pfnAllocShared )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3120,6 +3480,10 @@ namespace loader
         if( nullptr == pfnAllocDevice )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3153,6 +3517,10 @@ namespace loader
         if( nullptr == pfnAllocHost )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAllocHost( hContext, host_desc, size, alignment, pptr );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3178,6 +3546,10 @@ namespace loader
         if( nullptr == pfnFree )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnFree( hContext, ptr );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3205,6 +3577,10 @@ namespace loader
         if( nullptr == pfnGetAllocProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3247,6 +3623,10 @@ namespace loader
         if( nullptr == pfnGetAddressRange )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetAddressRange( hContext, ptr, pBase, pSize );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3273,6 +3653,10 @@ namespace loader
         if( nullptr == pfnGetIpcHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetIpcHandle( hContext, ptr, pIpcHandle );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3299,6 +3683,10 @@ namespace loader
         if( nullptr == pfnGetIpcHandleFromFileDescriptorExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3325,6 +3713,10 @@ namespace loader
         if( nullptr == pfnGetFileDescriptorFromIpcHandleExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetFileDescriptorFromIpcHandleExp( hContext, ipcHandle, pHandle );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3350,6 +3742,10 @@ namespace loader
         if( nullptr == pfnPutIpcHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnPutIpcHandle( hContext, handle );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3379,6 +3775,10 @@ namespace loader
         if( nullptr == pfnOpenIpcHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3407,6 +3807,10 @@ namespace loader
         if( nullptr == pfnCloseIpcHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCloseIpcHandle( hContext, ptr );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3436,6 +3840,10 @@ namespace loader
         if( nullptr == pfnSetAtomicAccessAttributeExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, attr );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3467,6 +3875,10 @@ namespace loader
         if( nullptr == pfnGetAtomicAccessAttributeExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, pAttr );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3498,6 +3910,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hContext, hDevice, desc, phModule, phBuildLog );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -3551,6 +3967,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hModule );
+
         // convert loader handle to driver handle
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
@@ -3584,14 +4004,17 @@ namespace loader
         if( nullptr == pfnDynamicLink )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDynamicLink( numModules, phModules, phLinkLog );
+
         // convert loader handles to driver handles
-        auto phModulesLocal = new ze_module_handle_t [numModules];
+        handle_array_t<ze_module_handle_t> phModulesLocal( numModules );
         for( size_t i = 0; ( nullptr != phModules ) && ( i < numModules ); ++i )
             phModulesLocal[ i ] = reinterpret_cast<ze_module_object_t*>( phModules[ i ] )->handle;
 
         // forward to device-driver
         result = pfnDynamicLink( numModules, phModulesLocal, phLinkLog );
-        delete []phModulesLocal;
 
         try
         {
@@ -3626,6 +4049,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hModuleBuildLog );
+
         // convert loader handle to driver handle
         hModuleBuildLog = reinterpret_cast<ze_module_build_log_object_t*>( hModuleBuildLog )->handle;
 
@@ -3658,6 +4085,10 @@ namespace loader
         if( nullptr == pfnGetString )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetString( hModuleBuildLog, pSize, pBuildLog );
+
         // convert loader handle to driver handle
         hModuleBuildLog = reinterpret_cast<ze_module_build_log_object_t*>( hModuleBuildLog )->handle;
 
@@ -3684,6 +4115,10 @@ namespace loader
         if( nullptr == pfnGetNativeBinary )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetNativeBinary( hModule, pSize, pModuleNativeBinary );
+
         // convert loader handle to driver handle
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
@@ -3711,6 +4146,10 @@ namespace loader
         if( nullptr == pfnGetGlobalPointer )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetGlobalPointer( hModule, pGlobalName, pSize, pptr );
+
         // convert loader handle to driver handle
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
@@ -3743,6 +4182,10 @@ namespace loader
         if( nullptr == pfnGetKernelNames )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetKernelNames( hModule, pCount, pNames );
+
         // convert loader handle to driver handle
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
@@ -3768,6 +4211,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hModule, pModuleProperties );
+
         // convert loader handle to driver handle
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
@@ -3794,6 +4241,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hModule, desc, phKernel );
+
         // convert loader handle to driver handle
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
@@ -3832,6 +4283,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hKernel );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
@@ -3864,6 +4319,10 @@ namespace loader
         if( nullptr == pfnGetFunctionPointer )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetFunctionPointer( hModule, pFunctionName, pfnFunction );
+
         // convert loader handle to driver handle
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
@@ -3891,6 +4350,10 @@ namespace loader
         if( nullptr == pfnSetGroupSize )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetGroupSize( hKernel, groupSizeX, groupSizeY, groupSizeZ );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
@@ -3921,6 +4384,10 @@ namespace loader
         if( nullptr == pfnSuggestGroupSize )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSuggestGroupSize( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
@@ -3946,6 +4413,10 @@ namespace loader
         if( nullptr == pfnSuggestMaxCooperativeGroupCount )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSuggestMaxCooperativeGroupCount( hKernel, totalGroupCount );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
@@ -3974,24 +4445,24 @@ namespace loader
         if( nullptr == pfnSetArgumentValue )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetArgumentValue( hKernel, argIndex, argSize, pArgValue );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // convert pArgValue to correct handle if applicable
+        // only pointer-sized arguments can be handles; images and samplers are
+        // recognized by the address ranges of their factories, without a lock
         void *internalArgValue = const_cast<void *>(pArgValue);
-        if (pArgValue) {
-            // check if the arg value is a translated handle
-            ze_image_object_t **imageHandle = static_cast<ze_image_object_t **>(internalArgValue);
-            ze_sampler_object_t **samplerHandle = static_cast<ze_sampler_object_t **>(internalArgValue);
-            {
-                std::lock_guard<std::mutex> image_lock(context->image_handle_map_lock);
-                std::lock_guard<std::mutex> sampler_lock(context->sampler_handle_map_lock);
-                if( context->image_handle_map.find(*imageHandle) != context->image_handle_map.end() ) {
-                    internalArgValue = &context->image_handle_map[*imageHandle];
-                } else if( context->sampler_handle_map.find(*samplerHandle) != context->sampler_handle_map.end() ) {
-                    internalArgValue = &context->sampler_handle_map[*samplerHandle];
-                }
-            }
+        if( ( nullptr != pArgValue ) && ( sizeof( void* ) == argSize ) ) {
+            void *argHandle = nullptr;
+            memcpy( &argHandle, pArgValue, sizeof( argHandle ) );
+            if( context->ze_image_factory.owns( argHandle ) )
+                internalArgValue = &static_cast<ze_image_object_t*>( argHandle )->handle;
+            else if( context->ze_sampler_factory.owns( argHandle ) )
+                internalArgValue = &static_cast<ze_sampler_object_t*>( argHandle )->handle;
         }
         // forward to device-driver
         result = pfnSetArgumentValue( hKernel, argIndex, argSize, const_cast<const void *>(internalArgValue) );
@@ -4015,6 +4486,10 @@ namespace loader
         if( nullptr == pfnSetIndirectAccess )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetIndirectAccess( hKernel, flags );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
@@ -4040,6 +4515,10 @@ namespace loader
         if( nullptr == pfnGetIndirectAccess )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetIndirectAccess( hKernel, pFlags );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
@@ -4073,6 +4552,10 @@ namespace loader
         if( nullptr == pfnGetSourceAttributes )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetSourceAttributes( hKernel, pSize, pString );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
@@ -4099,6 +4582,10 @@ namespace loader
         if( nullptr == pfnSetCacheConfig )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetCacheConfig( hKernel, flags );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
@@ -4124,6 +4611,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hKernel, pKernelProperties );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
@@ -4151,6 +4642,10 @@ namespace loader
         if( nullptr == pfnGetName )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetName( hKernel, pSize, pName );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
@@ -4182,6 +4677,10 @@ namespace loader
         if( nullptr == pfnAppendLaunchKernel )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -4192,13 +4691,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -4225,6 +4723,10 @@ namespace loader
         if( nullptr == pfnAppendLaunchCooperativeKernel )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -4235,13 +4737,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -4269,6 +4770,10 @@ namespace loader
         if( nullptr == pfnAppendLaunchKernelIndirect )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -4279,13 +4784,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -4317,11 +4821,15 @@ namespace loader
         if( nullptr == pfnAppendLaunchMultipleKernelsIndirect )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phKernelsLocal = new ze_kernel_handle_t [numKernels];
+        handle_array_t<ze_kernel_handle_t> phKernelsLocal( numKernels );
         for( size_t i = 0; ( nullptr != phKernels ) && ( i < numKernels ); ++i )
             phKernelsLocal[ i ] = reinterpret_cast<ze_kernel_object_t*>( phKernels[ i ] )->handle;
 
@@ -4329,14 +4837,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernelsLocal, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phKernelsLocal;
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -4359,6 +4865,10 @@ namespace loader
         if( nullptr == pfnMakeMemoryResident )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnMakeMemoryResident( hContext, hDevice, ptr, size );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4389,6 +4899,10 @@ namespace loader
         if( nullptr == pfnEvictMemory )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEvictMemory( hContext, hDevice, ptr, size );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4418,6 +4932,10 @@ namespace loader
         if( nullptr == pfnMakeImageResident )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnMakeImageResident( hContext, hDevice, hImage );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4450,6 +4968,10 @@ namespace loader
         if( nullptr == pfnEvictImage )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEvictImage( hContext, hDevice, hImage );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4483,6 +5005,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hContext, hDevice, desc, phSampler );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4498,14 +5024,8 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            ze_sampler_handle_t internalHandlePtr = *phSampler;
             *phSampler = reinterpret_cast<ze_sampler_handle_t>(
                 context->ze_sampler_factory.getInstance( *phSampler, dditable ) );
-            // convert loader handle to driver handle and store in map
-            {
-                std::lock_guard<std::mutex> lock(context->sampler_handle_map_lock);
-                context->sampler_handle_map.insert({context->ze_sampler_factory.getInstance( internalHandlePtr, dditable ), internalHandlePtr});
-            }
         }
         catch( std::bad_alloc& )
         {
@@ -4530,11 +5050,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
-        // remove the handle from the kernel arugment map
-        {
-            std::lock_guard<std::mutex> lock(context->sampler_handle_map_lock);
-            context->sampler_handle_map.erase(reinterpret_cast<ze_sampler_object_t*>(hSampler));
-        }
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hSampler );
+
         // convert loader handle to driver handle
         hSampler = reinterpret_cast<ze_sampler_object_t*>( hSampler )->handle;
 
@@ -4569,6 +5088,10 @@ namespace loader
         if( nullptr == pfnReserve )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnReserve( hContext, pStart, size, pptr );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4595,6 +5118,10 @@ namespace loader
         if( nullptr == pfnFree )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnFree( hContext, ptr, size );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4623,6 +5150,10 @@ namespace loader
         if( nullptr == pfnQueryPageSize )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnQueryPageSize( hContext, hDevice, size, pagesize );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4654,6 +5185,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hContext, hDevice, desc, phPhysicalMemory );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4696,6 +5231,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hContext, hPhysicalMemory );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4737,6 +5276,10 @@ namespace loader
         if( nullptr == pfnMap )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnMap( hContext, ptr, size, hPhysicalMemory, offset, access );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4766,6 +5309,10 @@ namespace loader
         if( nullptr == pfnUnmap )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnUnmap( hContext, ptr, size );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4794,6 +5341,10 @@ namespace loader
         if( nullptr == pfnSetAccessAttribute )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetAccessAttribute( hContext, ptr, size, access );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4823,6 +5374,10 @@ namespace loader
         if( nullptr == pfnGetAccessAttribute )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetAccessAttribute( hContext, ptr, size, access, outSize );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -4850,6 +5405,10 @@ namespace loader
         if( nullptr == pfnSetGlobalOffsetExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetGlobalOffsetExp( hKernel, offsetX, offsetY, offsetZ );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
@@ -4876,6 +5435,10 @@ namespace loader
         if( nullptr == pfnGetNextCommandIdExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetNextCommandIdExp( hCommandList, desc, pCommandId );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -4906,17 +5469,20 @@ namespace loader
         if( nullptr == pfnGetNextCommandIdWithKernelsExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetNextCommandIdWithKernelsExp( hCommandList, desc, numKernels, phKernels, pCommandId );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phKernelsLocal = new ze_kernel_handle_t [numKernels];
+        handle_array_t<ze_kernel_handle_t> phKernelsLocal( numKernels );
         for( size_t i = 0; ( nullptr != phKernels ) && ( i < numKernels ); ++i )
             phKernelsLocal[ i ] = reinterpret_cast<ze_kernel_object_t*>( phKernels[ i ] )->handle;
 
         // forward to device-driver
         result = pfnGetNextCommandIdWithKernelsExp( hCommandList, desc, numKernels, phKernelsLocal, pCommandId );
-        delete []phKernelsLocal;
 
         return result;
     }
@@ -4938,6 +5504,10 @@ namespace loader
         if( nullptr == pfnUpdateMutableCommandsExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnUpdateMutableCommandsExp( hCommandList, desc );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -4964,6 +5534,10 @@ namespace loader
         if( nullptr == pfnUpdateMutableCommandSignalEventExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnUpdateMutableCommandSignalEventExp( hCommandList, commandId, hSignalEvent );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -4995,17 +5569,20 @@ namespace loader
         if( nullptr == pfnUpdateMutableCommandWaitEventsExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnUpdateMutableCommandWaitEventsExp( hCommandList, commandId, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnUpdateMutableCommandWaitEventsExp( hCommandList, commandId, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -5029,17 +5606,20 @@ namespace loader
         if( nullptr == pfnUpdateMutableCommandKernelsExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnUpdateMutableCommandKernelsExp( hCommandList, numKernels, pCommandId, phKernels );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // convert loader handles to driver handles
-        auto phKernelsLocal = new ze_kernel_handle_t [numKernels];
+        handle_array_t<ze_kernel_handle_t> phKernelsLocal( numKernels );
         for( size_t i = 0; ( nullptr != phKernels ) && ( i < numKernels ); ++i )
             phKernelsLocal[ i ] = reinterpret_cast<ze_kernel_object_t*>( phKernels[ i ] )->handle;
 
         // forward to device-driver
         result = pfnUpdateMutableCommandKernelsExp( hCommandList, numKernels, pCommandId, phKernelsLocal );
-        delete []phKernelsLocal;
 
         return result;
     }
@@ -5064,6 +5644,10 @@ namespace loader
         if( nullptr == pfnReserveCacheExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnReserveCacheExt( hDevice, cacheLevel, cacheReservationSize );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -5091,6 +5675,10 @@ namespace loader
         if( nullptr == pfnSetCacheAdviceExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetCacheAdviceExt( hDevice, ptr, regionSize, cacheRegion );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -5124,6 +5712,10 @@ namespace loader
         if( nullptr == pfnQueryTimestampsExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnQueryTimestampsExp( hEvent, hDevice, pCount, pTimestamps );
+
         // convert loader handle to driver handle
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
@@ -5152,6 +5744,10 @@ namespace loader
         if( nullptr == pfnGetMemoryPropertiesExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetMemoryPropertiesExp( hImage, pMemoryProperties );
+
         // convert loader handle to driver handle
         hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
 
@@ -5180,6 +5776,10 @@ namespace loader
         if( nullptr == pfnViewCreateExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnViewCreateExt( hContext, hDevice, desc, hImage, phImageView );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -5228,6 +5828,10 @@ namespace loader
         if( nullptr == pfnViewCreateExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnViewCreateExp( hContext, hDevice, desc, hImage, phImageView );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -5246,14 +5850,8 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            ze_image_handle_t internalHandlePtr = *phImageView;
             *phImageView = reinterpret_cast<ze_image_handle_t>(
                 context->ze_image_factory.getInstance( *phImageView, dditable ) );
-            // convert loader handle to driver handle and store in map
-            {
-                std::lock_guard<std::mutex> lock(context->image_handle_map_lock);
-                context->image_handle_map.insert({context->ze_image_factory.getInstance( internalHandlePtr, dditable ), internalHandlePtr});
-            }
         }
         catch( std::bad_alloc& )
         {
@@ -5279,6 +5877,10 @@ namespace loader
         if( nullptr == pfnSchedulingHintExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSchedulingHintExp( hKernel, pHint );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
@@ -5304,6 +5906,10 @@ namespace loader
         if( nullptr == pfnPciGetPropertiesExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnPciGetPropertiesExt( hDevice, pPciProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -5340,6 +5946,10 @@ namespace loader
         if( nullptr == pfnAppendImageCopyToMemoryExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -5350,13 +5960,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -5388,6 +5997,10 @@ namespace loader
         if( nullptr == pfnAppendImageCopyFromMemoryExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -5398,13 +6011,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -5426,6 +6038,10 @@ namespace loader
         if( nullptr == pfnGetAllocPropertiesExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetAllocPropertiesExt( hContext, hImage, pImageAllocProperties );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -5458,14 +6074,17 @@ namespace loader
         if( nullptr == pfnInspectLinkageExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnInspectLinkageExt( pInspectDesc, numModules, phModules, phLog );
+
         // convert loader handles to driver handles
-        auto phModulesLocal = new ze_module_handle_t [numModules];
+        handle_array_t<ze_module_handle_t> phModulesLocal( numModules );
         for( size_t i = 0; ( nullptr != phModules ) && ( i < numModules ); ++i )
             phModulesLocal[ i ] = reinterpret_cast<ze_module_object_t*>( phModules[ i ] )->handle;
 
         // forward to device-driver
         result = pfnInspectLinkageExt( pInspectDesc, numModules, phModulesLocal, phLog );
-        delete []phModulesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -5501,6 +6120,10 @@ namespace loader
         if( nullptr == pfnFreeExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnFreeExt( hContext, pMemFreeDesc, ptr );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -5534,6 +6157,10 @@ namespace loader
         if( nullptr == pfnGetExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetExp( hDriver, pCount, phVertices );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -5582,6 +6209,10 @@ namespace loader
         if( nullptr == pfnGetSubVerticesExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetSubVerticesExp( hVertex, pCount, phSubvertices );
+
         // convert loader handle to driver handle
         hVertex = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertex )->handle;
 
@@ -5622,6 +6253,10 @@ namespace loader
         if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetPropertiesExp( hVertex, pVertexProperties );
+
         // convert loader handle to driver handle
         hVertex = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertex )->handle;
 
@@ -5647,6 +6282,10 @@ namespace loader
         if( nullptr == pfnGetDeviceExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetDeviceExp( hVertex, phDevice );
+
         // convert loader handle to driver handle
         hVertex = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertex )->handle;
 
@@ -5686,6 +6325,10 @@ namespace loader
         if( nullptr == pfnGetFabricVertexExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetFabricVertexExp( hDevice, phVertex );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
@@ -5734,6 +6377,10 @@ namespace loader
         if( nullptr == pfnGetExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetExp( hVertexA, hVertexB, pCount, phEdges );
+
         // convert loader handle to driver handle
         hVertexA = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertexA )->handle;
 
@@ -5778,6 +6425,10 @@ namespace loader
         if( nullptr == pfnGetVerticesExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetVerticesExp( hEdge, phVertexA, phVertexB );
+
         // convert loader handle to driver handle
         hEdge = reinterpret_cast<ze_fabric_edge_object_t*>( hEdge )->handle;
 
@@ -5828,6 +6479,10 @@ namespace loader
         if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetPropertiesExp( hEdge, pEdgeProperties );
+
         // convert loader handle to driver handle
         hEdge = reinterpret_cast<ze_fabric_edge_object_t*>( hEdge )->handle;
 
@@ -5868,6 +6523,10 @@ namespace loader
         if( nullptr == pfnQueryKernelTimestampsExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnQueryKernelTimestampsExt( hEvent, hDevice, pCount, pResults );
+
         // convert loader handle to driver handle
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
@@ -5897,6 +6556,10 @@ namespace loader
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreateExp( hDriver, pDescriptor, phBuilder );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -5937,6 +6600,10 @@ namespace loader
         if( nullptr == pfnGetBuildPropertiesExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetBuildPropertiesExp( hBuilder, pBuildOpDescriptor, pProperties );
+
         // convert loader handle to driver handle
         hBuilder = reinterpret_cast<ze_rtas_builder_exp_object_t*>( hBuilder )->handle;
 
@@ -5963,6 +6630,10 @@ namespace loader
         if( nullptr == pfnRTASFormatCompatibilityCheckExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnRTASFormatCompatibilityCheckExp( hDriver, rtasFormatA, rtasFormatB );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -5999,6 +6670,10 @@ namespace loader
         if( nullptr == pfnBuildExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnBuildExp( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
+
         // convert loader handle to driver handle
         hBuilder = reinterpret_cast<ze_rtas_builder_exp_object_t*>( hBuilder )->handle;
 
@@ -6026,6 +6701,10 @@ namespace loader
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroyExp( hBuilder );
+
         // convert loader handle to driver handle
         hBuilder = reinterpret_cast<ze_rtas_builder_exp_object_t*>( hBuilder )->handle;
 
@@ -6057,6 +6736,10 @@ namespace loader
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreateExp( hDriver, phParallelOperation );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -6096,6 +6779,10 @@ namespace loader
         if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetPropertiesExp( hParallelOperation, pProperties );
+
         // convert loader handle to driver handle
         hParallelOperation = reinterpret_cast<ze_rtas_parallel_operation_exp_object_t*>( hParallelOperation )->handle;
 
@@ -6120,6 +6807,10 @@ namespace loader
         if( nullptr == pfnJoinExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnJoinExp( hParallelOperation );
+
         // convert loader handle to driver handle
         hParallelOperation = reinterpret_cast<ze_rtas_parallel_operation_exp_object_t*>( hParallelOperation )->handle;
 
@@ -6144,6 +6835,10 @@ namespace loader
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroyExp( hParallelOperation );
+
         // convert loader handle to driver handle
         hParallelOperation = reinterpret_cast<ze_rtas_parallel_operation_exp_object_t*>( hParallelOperation )->handle;
 
@@ -6179,6 +6874,10 @@ namespace loader
         if( nullptr == pfnGetPitchFor2dImage )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetPitchFor2dImage( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
@@ -6207,6 +6906,10 @@ namespace loader
         if( nullptr == pfnGetDeviceOffsetExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetDeviceOffsetExp( hImage, pDeviceOffset );
+
         // convert loader handle to driver handle
         hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
 
@@ -6232,6 +6935,10 @@ namespace loader
         if( nullptr == pfnCreateCloneExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreateCloneExp( hCommandList, phClonedCommandList );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
@@ -6281,11 +6988,15 @@ namespace loader
         if( nullptr == pfnImmediateAppendCommandListsExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandListImmediate = reinterpret_cast<ze_command_list_object_t*>( hCommandListImmediate )->handle;
 
         // convert loader handles to driver handles
-        auto phCommandListsLocal = new ze_command_list_handle_t [numCommandLists];
+        handle_array_t<ze_command_list_handle_t> phCommandListsLocal( numCommandLists );
         for( size_t i = 0; ( nullptr != phCommandLists ) && ( i < numCommandLists ); ++i )
             phCommandListsLocal[ i ] = reinterpret_cast<ze_command_list_object_t*>( phCommandLists[ i ] )->handle;
 
@@ -6293,14 +7004,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandListsLocal, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phCommandListsLocal;
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -6356,6 +7065,8 @@ zeGetGlobalProcAddrTable(
         if (drv.dditable.ze.Global.pfnInitDrivers) {
             loader::context->initDriversSupport = true;
         }
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.Global = drv.dditable.ze.Global;
     }
 
     if(!atLeastOneDriverValid)
@@ -6388,17 +7099,18 @@ zeGetGlobalProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.Global = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetGlobalProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_global_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_global_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.Global = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.Global );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -6444,6 +7156,8 @@ zeGetRTASBuilderExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.ze.RTASBuilderExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.RTASBuilderExp = drv.dditable.ze.RTASBuilderExp;
     }
 
 
@@ -6474,17 +7188,18 @@ zeGetRTASBuilderExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.RTASBuilderExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetRTASBuilderExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetRTASBuilderExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_rtas_builder_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_rtas_builder_exp_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.RTASBuilderExp = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.RTASBuilderExp );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -6530,6 +7245,8 @@ zeGetRTASParallelOperationExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.ze.RTASParallelOperationExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.RTASParallelOperationExp = drv.dditable.ze.RTASParallelOperationExp;
     }
 
 
@@ -6560,17 +7277,18 @@ zeGetRTASParallelOperationExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.RTASParallelOperationExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetRTASParallelOperationExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetRTASParallelOperationExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_rtas_parallel_operation_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_rtas_parallel_operation_exp_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.RTASParallelOperationExp = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.RTASParallelOperationExp );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -6621,6 +7339,8 @@ zeGetDriverProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.Driver = drv.dditable.ze.Driver;
     }
 
     if(!atLeastOneDriverValid)
@@ -6658,17 +7378,18 @@ zeGetDriverProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.Driver = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetDriverProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetDriverProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_driver_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_driver_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.Driver = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.Driver );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -6714,6 +7435,8 @@ zeGetDriverExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.ze.DriverExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.DriverExp = drv.dditable.ze.DriverExp;
     }
 
 
@@ -6741,17 +7464,18 @@ zeGetDriverExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.DriverExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetDriverExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetDriverExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_driver_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_driver_exp_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.DriverExp = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.DriverExp );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -6802,6 +7526,8 @@ zeGetDeviceProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.Device = drv.dditable.ze.Device;
     }
 
     if(!atLeastOneDriverValid)
@@ -6851,17 +7577,18 @@ zeGetDeviceProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.Device = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetDeviceProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetDeviceProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_device_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_device_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.Device = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.Device );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -6907,6 +7634,8 @@ zeGetDeviceExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.ze.DeviceExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.DeviceExp = drv.dditable.ze.DeviceExp;
     }
 
 
@@ -6934,17 +7663,18 @@ zeGetDeviceExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.DeviceExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetDeviceExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetDeviceExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_device_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_device_exp_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.DeviceExp = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.DeviceExp );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -6995,6 +7725,8 @@ zeGetContextProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.Context = drv.dditable.ze.Context;
     }
 
     if(!atLeastOneDriverValid)
@@ -7034,17 +7766,18 @@ zeGetContextProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.Context = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetContextProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetContextProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_context_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_context_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.Context = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.Context );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -7095,6 +7828,8 @@ zeGetCommandQueueProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.CommandQueue = drv.dditable.ze.CommandQueue;
     }
 
     if(!atLeastOneDriverValid)
@@ -7131,17 +7866,18 @@ zeGetCommandQueueProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.CommandQueue = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetCommandQueueProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetCommandQueueProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_command_queue_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_command_queue_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.CommandQueue = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.CommandQueue );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -7192,6 +7928,8 @@ zeGetCommandListProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.CommandList = drv.dditable.ze.CommandList;
     }
 
     if(!atLeastOneDriverValid)
@@ -7256,17 +7994,18 @@ zeGetCommandListProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.CommandList = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetCommandListProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetCommandListProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_command_list_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_command_list_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.CommandList = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.CommandList );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -7312,6 +8051,8 @@ zeGetCommandListExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.ze.CommandListExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.CommandListExp = drv.dditable.ze.CommandListExp;
     }
 
 
@@ -7346,17 +8087,18 @@ zeGetCommandListExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.CommandListExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetCommandListExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetCommandListExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_command_list_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_command_list_exp_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.CommandListExp = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.CommandListExp );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -7407,6 +8149,8 @@ zeGetEventProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.Event = drv.dditable.ze.Event;
     }
 
     if(!atLeastOneDriverValid)
@@ -7448,17 +8192,18 @@ zeGetEventProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.Event = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetEventProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetEventProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_event_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_event_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.Event = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.Event );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -7504,6 +8249,8 @@ zeGetEventExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.ze.EventExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.EventExp = drv.dditable.ze.EventExp;
     }
 
 
@@ -7531,17 +8278,18 @@ zeGetEventExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.EventExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetEventExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetEventExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_event_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_event_exp_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.EventExp = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.EventExp );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -7592,6 +8340,8 @@ zeGetEventPoolProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.EventPool = drv.dditable.ze.EventPool;
     }
 
     if(!atLeastOneDriverValid)
@@ -7630,17 +8380,18 @@ zeGetEventPoolProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.EventPool = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetEventPoolProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetEventPoolProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_event_pool_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_event_pool_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.EventPool = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.EventPool );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -7691,6 +8442,8 @@ zeGetFenceProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.Fence = drv.dditable.ze.Fence;
     }
 
     if(!atLeastOneDriverValid)
@@ -7726,17 +8479,18 @@ zeGetFenceProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.Fence = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetFenceProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetFenceProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_fence_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_fence_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.Fence = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.Fence );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -7787,6 +8541,8 @@ zeGetImageProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.Image = drv.dditable.ze.Image;
     }
 
     if(!atLeastOneDriverValid)
@@ -7822,17 +8578,18 @@ zeGetImageProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.Image = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetImageProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetImageProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_image_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_image_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.Image = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.Image );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -7878,6 +8635,8 @@ zeGetImageExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.ze.ImageExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.ImageExp = drv.dditable.ze.ImageExp;
     }
 
 
@@ -7907,17 +8666,18 @@ zeGetImageExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.ImageExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetImageExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetImageExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_image_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_image_exp_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.ImageExp = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.ImageExp );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -7968,6 +8728,8 @@ zeGetKernelProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.Kernel = drv.dditable.ze.Kernel;
     }
 
     if(!atLeastOneDriverValid)
@@ -8010,17 +8772,18 @@ zeGetKernelProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.Kernel = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetKernelProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetKernelProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_kernel_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_kernel_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.Kernel = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.Kernel );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -8066,6 +8829,8 @@ zeGetKernelExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.ze.KernelExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.KernelExp = drv.dditable.ze.KernelExp;
     }
 
 
@@ -8094,17 +8859,18 @@ zeGetKernelExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.KernelExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetKernelExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetKernelExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_kernel_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_kernel_exp_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.KernelExp = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.KernelExp );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -8155,6 +8921,8 @@ zeGetMemProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.Mem = drv.dditable.ze.Mem;
     }
 
     if(!atLeastOneDriverValid)
@@ -8197,17 +8965,18 @@ zeGetMemProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.Mem = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetMemProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetMemProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_mem_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_mem_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.Mem = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.Mem );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -8253,6 +9022,8 @@ zeGetMemExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.ze.MemExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.MemExp = drv.dditable.ze.MemExp;
     }
 
 
@@ -8283,17 +9054,18 @@ zeGetMemExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.MemExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetMemExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetMemExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_mem_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_mem_exp_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.MemExp = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.MemExp );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -8344,6 +9116,8 @@ zeGetModuleProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.Module = drv.dditable.ze.Module;
     }
 
     if(!atLeastOneDriverValid)
@@ -8383,17 +9157,18 @@ zeGetModuleProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.Module = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetModuleProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetModuleProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_module_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_module_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.Module = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.Module );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -8444,6 +9219,8 @@ zeGetModuleBuildLogProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.ModuleBuildLog = drv.dditable.ze.ModuleBuildLog;
     }
 
     if(!atLeastOneDriverValid)
@@ -8476,17 +9253,18 @@ zeGetModuleBuildLogProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.ModuleBuildLog = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetModuleBuildLogProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetModuleBuildLogProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_module_build_log_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_module_build_log_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.ModuleBuildLog = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.ModuleBuildLog );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -8537,6 +9315,8 @@ zeGetPhysicalMemProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.PhysicalMem = drv.dditable.ze.PhysicalMem;
     }
 
     if(!atLeastOneDriverValid)
@@ -8569,17 +9349,18 @@ zeGetPhysicalMemProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.PhysicalMem = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetPhysicalMemProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetPhysicalMemProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_physical_mem_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_physical_mem_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.PhysicalMem = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.PhysicalMem );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -8630,6 +9411,8 @@ zeGetSamplerProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.Sampler = drv.dditable.ze.Sampler;
     }
 
     if(!atLeastOneDriverValid)
@@ -8662,17 +9445,18 @@ zeGetSamplerProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.Sampler = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetSamplerProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetSamplerProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_sampler_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_sampler_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.Sampler = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.Sampler );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -8723,6 +9507,8 @@ zeGetVirtualMemProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.VirtualMem = drv.dditable.ze.VirtualMem;
     }
 
     if(!atLeastOneDriverValid)
@@ -8760,17 +9546,18 @@ zeGetVirtualMemProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.VirtualMem = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetVirtualMemProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetVirtualMemProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_virtual_mem_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_virtual_mem_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.VirtualMem = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.VirtualMem );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -8816,6 +9603,8 @@ zeGetFabricEdgeExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.ze.FabricEdgeExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.FabricEdgeExp = drv.dditable.ze.FabricEdgeExp;
     }
 
 
@@ -8845,17 +9634,18 @@ zeGetFabricEdgeExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.FabricEdgeExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetFabricEdgeExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetFabricEdgeExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_fabric_edge_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_fabric_edge_exp_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.FabricEdgeExp = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.FabricEdgeExp );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -8901,6 +9691,8 @@ zeGetFabricVertexExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.ze.FabricVertexExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->ze.FabricVertexExp = drv.dditable.ze.FabricVertexExp;
     }
 
 
@@ -8931,17 +9723,18 @@ zeGetFabricVertexExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.ze.FabricVertexExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetFabricVertexExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetFabricVertexExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        ze_fabric_vertex_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_fabric_vertex_exp_dditable_t));
-        result = getTable( version, &dditable );
-        loader::context->tracing_dditable.ze.FabricVertexExp = dditable;
+        result = getTable( version, &loader::context->tracing_dditable.ze.FabricVertexExp );
         if ( loader::context->tracingLayerEnabled ) {
             result = getTable( version, pDdiTable );
         }
@@ -8954,3 +9747,271 @@ zeGetFabricVertexExpProcAddrTable(
 #if defined(__cplusplus)
 };
 #endif
+
+namespace loader
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercepts the loader's DDIs kept in tracing_dditable with the
+    ///        API tracing layer's DDIs, once the layer has been loaded on demand
+    __zedlllocal ze_result_t ZE_APICALL
+    zeTracingLayerGetProcAddrTables(
+        ze_api_version_t version                       ///< [in] API version requested
+        )
+    {
+        ze_result_t result = ZE_RESULT_SUCCESS;
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetGlobalProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.Global );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetRTASBuilderExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetRTASBuilderExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.RTASBuilderExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetRTASParallelOperationExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetRTASParallelOperationExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.RTASParallelOperationExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetDriverProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetDriverProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.Driver );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetDriverExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetDriverExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.DriverExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetDeviceProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetDeviceProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.Device );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetDeviceExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetDeviceExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.DeviceExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetContextProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetContextProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.Context );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetCommandQueueProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetCommandQueueProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.CommandQueue );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetCommandListProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetCommandListProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.CommandList );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetCommandListExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetCommandListExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.CommandListExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetEventProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetEventProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.Event );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetEventExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetEventExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.EventExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetEventPoolProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetEventPoolProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.EventPool );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetFenceProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetFenceProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.Fence );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetImageProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetImageProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.Image );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetImageExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetImageExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.ImageExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetKernelProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetKernelProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.Kernel );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetKernelExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetKernelExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.KernelExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetMemProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetMemProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.Mem );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetMemExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetMemExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.MemExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetModuleProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetModuleProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.Module );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetModuleBuildLogProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetModuleBuildLogProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.ModuleBuildLog );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetPhysicalMemProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetPhysicalMemProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.PhysicalMem );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetSamplerProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetSamplerProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.Sampler );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetVirtualMemProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetVirtualMemProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.VirtualMem );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetFabricEdgeExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetFabricEdgeExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.FabricEdgeExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetFabricVertexExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetFabricVertexExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.ze.FabricVertexExp );
+        }
+
+        return result;
+    }
+} // namespace loader
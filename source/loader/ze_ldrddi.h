@@ -37,7 +37,8 @@ namespace loader
     using ze_event_factory_t                  = singleton_factory_t < ze_event_object_t, ze_event_handle_t >;
 
     using ze_image_object_t                   = object_t < ze_image_handle_t >;
-    using ze_image_factory_t                  = singleton_factory_t < ze_image_object_t, ze_image_handle_t >;
+    // kernel arguments are recognized as images and samplers by their address
+    using ze_image_factory_t                  = singleton_factory_t < ze_image_object_t, ze_image_handle_t, 1, true >;
 
     using ze_module_object_t                  = object_t < ze_module_handle_t >;
     using ze_module_factory_t                 = singleton_factory_t < ze_module_object_t, ze_module_handle_t >;
@@ -49,7 +50,8 @@ namespace loader
     using ze_kernel_factory_t                 = singleton_factory_t < ze_kernel_object_t, ze_kernel_handle_t >;
 
     using ze_sampler_object_t                 = object_t < ze_sampler_handle_t >;
-    using ze_sampler_factory_t                = singleton_factory_t < ze_sampler_object_t, ze_sampler_handle_t >;
+    // kernel arguments are recognized as images and samplers by their address
+    using ze_sampler_factory_t                = singleton_factory_t < ze_sampler_object_t, ze_sampler_handle_t, 1, true >;
 
     using ze_physical_mem_object_t            = object_t < ze_physical_mem_handle_t >;
     using ze_physical_mem_factory_t           = singleton_factory_t < ze_physical_mem_object_t, ze_physical_mem_handle_t >;
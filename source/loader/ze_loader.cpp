@@ -135,7 +135,7 @@ namespace loader
         return flags_value;
     }
 
-    ze_result_t context_t::check_drivers(ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, ze_global_dditable_t *globalInitStored, zes_global_dditable_t *sysmanGlobalInitStored, bool *requireDdiReinit, bool sysmanOnly) {
+    ze_result_t context_t::check_drivers(ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, bool *requireDdiReinit, bool sysmanOnly) {
         if (debugTraceEnabled) {
             if (desc) {
                 std::string message = "check_drivers(" + std::string("desc->flags=") + loader::to_string(desc) + ")";
@@ -161,10 +161,12 @@ namespace loader
             return_first_driver_result=true;
         }
 
+        probe_drivers(*drivers, flags, desc, sysmanOnly);
+
         for(auto it = drivers->begin(); it != drivers->end(); )
         {
             std::string freeLibraryErrorValue;
-            ze_result_t result = init_driver(*it, flags, desc, globalInitStored, sysmanGlobalInitStored, sysmanOnly);
+            ze_result_t result = init_driver(*it, flags, desc, sysmanOnly);
             if(result != ZE_RESULT_SUCCESS) {
                 // If the driver has already been init and handles are to be read, then this driver cannot be removed from the list.
                 // Also, if any driver supports zeInitDrivers, then no driver can be removed to allow for different sets of drivers.
@@ -174,6 +176,8 @@ namespace loader
                         debug_trace_message(errorMessage, loader::to_string(result));
                     }
                     it = drivers->erase(it);
+                    // handles of the removed driver may have been enumerated already
+                    enumeration_cache.clear();
                     // If the number of drivers is now ==1, then we need to reinit the ddi tables to pass through.
                     // If ZE_ENABLE_LOADER_INTERCEPT is set to 1, then even if drivers were removed, don't reinit the ddi tables.
                     if (drivers->size() == 1 && !loader::context->forceIntercept) {
@@ -197,7 +201,54 @@ namespace loader
         return ZE_RESULT_SUCCESS;
     }
 
-    ze_result_t context_t::init_driver(driver_t &driver, ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, ze_global_dditable_t *globalInitStored, zes_global_dditable_t *sysmanGlobalInitStored, bool sysmanOnly) {
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Run each driver's own zeInit, zeInitDrivers or zesInit once, concurrently
+    /// when there are several drivers, and keep the result in the driver for
+    /// init_driver to report in list order. The layers are not called: they see
+    /// the application's own call, which ze_lib makes once the drivers are checked.
+    void context_t::probe_drivers(driver_vector_t &drivers, ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, bool sysmanOnly) {
+        auto probe = [&](size_t i) {
+            auto &driver = drivers[i];
+            driver.probeResult = ZE_RESULT_ERROR_UNINITIALIZED;
+            if (desc && driver.driverTypeFlags && !(driver.driverTypeFlags & desc->flags))
+                return;
+            if (sysmanOnly) {
+                auto getTable = reinterpret_cast<zes_pfnGetGlobalProcAddrTable_t>(
+                    GET_FUNCTION_PTR(driver.handle, "zesGetGlobalProcAddrTable"));
+                zes_global_dditable_t global = {};
+                if (!getTable || getTable(ZE_API_VERSION_CURRENT, &global) != ZE_RESULT_SUCCESS || !global.pfnInit)
+                    return;
+                // as the zesInit intercept does, a driver which failed is not asked again
+                if (driver.initStatus == ZE_RESULT_SUCCESS)
+                    driver.initStatus = global.pfnInit(flags);
+                driver.probeResult = driver.initStatus;
+            } else {
+                auto getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
+                    GET_FUNCTION_PTR(driver.handle, "zeGetGlobalProcAddrTable"));
+                ze_global_dditable_t global = {};
+                if (!getTable || getTable(ZE_API_VERSION_CURRENT, &global) != ZE_RESULT_SUCCESS)
+                    return;
+                if (desc && global.pfnInitDrivers) {
+                    uint32_t count = 0;
+                    driver.probeResult = global.pfnInitDrivers(&count, nullptr, desc);
+                } else if (!desc && global.pfnInit) {
+                    // as the zeInit intercept does, a driver which failed is not asked again
+                    if (driver.initStatus == ZE_RESULT_SUCCESS)
+                        driver.initStatus = global.pfnInit(flags);
+                    driver.probeResult = driver.initStatus;
+                }
+            }
+        };
+
+        if (drivers.size() < 2 || initThreadCount < 2) {
+            for (size_t i = 0; i < drivers.size(); ++i)
+                probe(i);
+        } else {
+            parallel_for(drivers.size(), initThreadCount, probe);
+        }
+    }
+
+    ze_result_t context_t::init_driver(driver_t &driver, ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, bool sysmanOnly) {
 
         if (sysmanOnly) {
             auto getTable = reinterpret_cast<zes_pfnGetGlobalProcAddrTable_t>(
@@ -228,12 +279,8 @@ namespace loader
                 return ZE_RESULT_ERROR_UNINITIALIZED;
             }
 
-            // Use the previously init ddi table pointer to zesInit to allow for intercept of the zesInit calls
-            ze_result_t res = sysmanGlobalInitStored->pfnInit(flags);
-            // Verify that this driver successfully init in the call above.
-            if (driver.initStatus != ZE_RESULT_SUCCESS) {
-                res = driver.initStatus;
-            }
+            // The driver was initialized by probe_drivers.
+            ze_result_t res = driver.probeResult;
             if (debugTraceEnabled) {
                 std::string message = "init driver " + driver.name + " zesInit(" + loader::to_string(flags) + ") returning ";
                 debug_trace_message(message, loader::to_string(res));
@@ -269,48 +316,32 @@ namespace loader
                     return ZE_RESULT_ERROR_UNINITIALIZED;
                 }
 
-                auto pfnInit = global.pfnInit;
-                if(nullptr == pfnInit || globalInitStored->pfnInit == nullptr) {
-                    if (debugTraceEnabled) {
-                        std::string errorMessage = "init driver " + driver.name + " failed, zeInit function pointer null. Returning ";
-                        debug_trace_message(errorMessage, loader::to_string(ZE_RESULT_ERROR_UNINITIALIZED));
-                    }
-                    return ZE_RESULT_ERROR_UNINITIALIZED;
-                }
-
-                // Use the previously init ddi table pointer to zeInit to allow for intercept of the zeInit calls
-                ze_result_t res = globalInitStored->pfnInit(flags);
-                // Verify that this driver successfully init in the call above.
-                if (driver.initStatus != ZE_RESULT_SUCCESS) {
-                    res = driver.initStatus;
-                }
+                // The driver was initialized by probe_drivers.
+                ze_result_t res = driver.probeResult;
                 if (debugTraceEnabled) {
                     std::string message = "init driver " + driver.name + " zeInit(" + loader::to_string(flags) + ") returning ";
                     debug_trace_message(message, loader::to_string(res));
                 }
                 return res;
             } else {
-                if(nullptr == global.pfnInitDrivers) {
+                if(driver.driverTypeFlags && !(driver.driverTypeFlags & desc->flags)) {
                     if (debugTraceEnabled) {
-                        std::string errorMessage = "init driver " + driver.name + " failed, zeInitDrivers function pointer null. Returning ";
+                        std::string errorMessage = "init driver " + driver.name + " skipped, its manifest declares other driver types. Returning ";
                         debug_trace_message(errorMessage, loader::to_string(ZE_RESULT_ERROR_UNINITIALIZED));
                     }
                     return ZE_RESULT_ERROR_UNINITIALIZED;
                 }
 
-                auto pfnInitDrivers = global.pfnInitDrivers;
-                if(nullptr == pfnInitDrivers || globalInitStored->pfnInitDrivers == nullptr) {
+                if(nullptr == global.pfnInitDrivers) {
                     if (debugTraceEnabled) {
-                        std::string errorMessage = "init driver " + driver.name + " failed, pfnInitDrivers function pointer null. Returning ";
+                        std::string errorMessage = "init driver " + driver.name + " failed, zeInitDrivers function pointer null. Returning ";
                         debug_trace_message(errorMessage, loader::to_string(ZE_RESULT_ERROR_UNINITIALIZED));
                     }
                     return ZE_RESULT_ERROR_UNINITIALIZED;
                 }
 
-                // Use the previously init ddi table pointer to zeInit to allow for intercept of the zeInit calls
-                uint32_t pCount = 0;
-                ze_result_t res = globalInitStored->pfnInitDrivers(&pCount, nullptr, desc);
-                // Verify that this driver successfully init in the call above.
+                // The driver was initialized by probe_drivers.
+                ze_result_t res = driver.probeResult;
                 if (driver.initDriversStatus != ZE_RESULT_SUCCESS) {
                     res = driver.initDriversStatus;
                 }
@@ -330,8 +361,10 @@ namespace loader
             return ZE_RESULT_SUCCESS;
         }
         debugTraceEnabled = getenv_tobool( "ZE_ENABLE_LOADER_DEBUG_TRACE" );
+        auto initThreads = getenv_string( "ZEL_LOADER_INIT_THREADS" );
+        if( !initThreads.empty() )
+            initThreadCount = std::max( 1, std::atoi( initThreads.c_str() ) );
         auto discoveredDrivers = discoverEnabledDrivers();
-        std::string loadLibraryErrorValue;
 
         auto log_directory = getenv_string("ZEL_LOADER_LOG_DIR");
         if (log_directory.empty()) {
@@ -407,46 +440,65 @@ namespace loader
         zeDrivers.reserve( discoveredDrivers.size() + getenv_tobool( "ZE_ENABLE_NULL_DRIVER" ) );
         zesDrivers.reserve( discoveredDrivers.size() + getenv_tobool( "ZE_ENABLE_NULL_DRIVER" ) );
         allDrivers.reserve( discoveredDrivers.size() + getenv_tobool( "ZE_ENABLE_NULL_DRIVER" ) );
-        if( getenv_tobool( "ZE_ENABLE_NULL_DRIVER" ) )
+        // the driver and layer libraries are loaded concurrently, then added in discovery order
+        bool nullDriverEnabled = getenv_tobool( "ZE_ENABLE_NULL_DRIVER" );
+        std::vector<std::string> libraryPaths;
+        if( nullDriverEnabled )
         {
             zel_logger->log_info("Enabling Null Driver");
-            auto handle = LOAD_DRIVER_LIBRARY( create_library_path( MAKE_LIBRARY_NAME( "ze_null", L0_LOADER_VERSION ), loaderLibraryPath.c_str()).c_str());
-            if (debugTraceEnabled) {
-                std::string message = "ze_null Driver Init";
-                debug_trace_message(message, "");
-            }
-            if( NULL != handle )
-            {
-                allDrivers.emplace_back();
-                allDrivers.rbegin()->handle = handle;
-                allDrivers.rbegin()->name = "ze_null";
-            } else if (debugTraceEnabled) {
-                GET_LIBRARY_ERROR(loadLibraryErrorValue);
-                std::string errorMessage = "Load Library of " + create_library_path( MAKE_LIBRARY_NAME( "ze_null", L0_LOADER_VERSION ), loaderLibraryPath.c_str()) + " failed with ";
-                debug_trace_message(errorMessage, loadLibraryErrorValue);
-                loadLibraryErrorValue.clear();
-            }
+            libraryPaths.push_back( create_library_path( MAKE_LIBRARY_NAME( "ze_null", L0_LOADER_VERSION ), loaderLibraryPath.c_str()) );
         }
-
         for( auto name : discoveredDrivers )
+            libraryPaths.push_back( name );
+        const size_t driverCount = libraryPaths.size();
+
+        bool validationLayerEnabled = getenv_tobool( "ZE_ENABLE_VALIDATION_LAYER" );
+        if( validationLayerEnabled )
+            libraryPaths.push_back( create_library_path(MAKE_LAYER_NAME( "ze_validation_layer" ), loaderLibraryPath.c_str()) );
+        // the tracing layer is only loaded up front when enabled by the environment,
+        // otherwise on the first zelEnableTracingLayer or zelTracerCreate;
+        // recording API calls with ZEL_TRACE_RECORD, or counting them with
+        // ZEL_ENABLE_API_STATS, also needs the tracing layer
+        if (getenv_tobool( "ZE_ENABLE_TRACING_LAYER" ) || !getenv_string( "ZEL_TRACE_RECORD" ).empty() ||
+            getenv_tobool( "ZEL_ENABLE_API_STATS" )) {
+            zel_logger->log_info("Tracing Layer Enabled");
+            tracingLayerEnabled = true;
+        }
+        tracingLayerLibraryPath = create_library_path(MAKE_LAYER_NAME( "ze_tracing_layer" ), loaderLibraryPath.c_str());
+        const size_t tracingLayerIndex = libraryPaths.size();
+        if( tracingLayerEnabled )
+            libraryPaths.push_back( tracingLayerLibraryPath );
+
+        auto libraries = load_libraries( libraryPaths );
+        if( validationLayerEnabled )
+            validationLayer = libraries[ driverCount ].handle;
+        if( tracingLayerEnabled )
+            tracingLayer = libraries[ tracingLayerIndex ].handle;
+
+        for( size_t i = 0; i < driverCount; ++i )
         {
-            auto handle = LOAD_DRIVER_LIBRARY( name.c_str() );
+            bool isNullDriver = nullDriverEnabled && ( 0 == i );
+            auto handle = libraries[ i ].handle;
             if (debugTraceEnabled) {
-                std::string message = "Loading Driver " + name;
+                std::string message = isNullDriver ? "ze_null Driver Init" : "Loading Driver " + libraryPaths[ i ];
                 debug_trace_message(message, "");
             }
             if( NULL != handle )
             {
                 allDrivers.emplace_back();
                 allDrivers.rbegin()->handle = handle;
-                allDrivers.rbegin()->name = name;
+                allDrivers.rbegin()->name = isNullDriver ? "ze_null" : libraryPaths[ i ];
+                if( !isNullDriver )
+                    allDrivers.rbegin()->driverTypeFlags = getDriverTypeFlags( libraryPaths[ i ] );
             } else if (debugTraceEnabled) {
-                GET_LIBRARY_ERROR(loadLibraryErrorValue);
-                std::string errorMessage = "Load Library of " + name + " failed with ";
-                debug_trace_message(errorMessage, loadLibraryErrorValue);
-                loadLibraryErrorValue.clear();
+                std::string errorMessage = "Load Library of " + libraryPaths[ i ] + " failed with ";
+                debug_trace_message(errorMessage, libraries[ i ].error);
             }
         }
+        std::vector<bool> discoveredDriversLoaded;
+        for( size_t i = driverCount - discoveredDrivers.size(); i < driverCount; ++i )
+            discoveredDriversLoaded.push_back( NULL != libraries[ i ].handle );
+        recordLoadedDrivers( discoveredDrivers, discoveredDriversLoaded );
         if(allDrivers.size()==0){
             if (debugTraceEnabled) {
                 std::string message = "0 Drivers Discovered";
@@ -455,15 +507,16 @@ namespace loader
             zel_logger->log_error("0 Drivers Discovered");
             return ZE_RESULT_ERROR_UNINITIALIZED;
         }
+        for( auto& drv : allDrivers )
+            negotiate_ddi_handles( drv );
+
         std::copy(allDrivers.begin(), allDrivers.end(), std::back_inserter(zeDrivers));
         std::copy(allDrivers.begin(), allDrivers.end(), std::back_inserter(zesDrivers));
 
         typedef ze_result_t (ZE_APICALL *getVersion_t)(zel_component_version_t *version);
-        if( getenv_tobool( "ZE_ENABLE_VALIDATION_LAYER" ) )
+        if( validationLayerEnabled )
         {
             zel_logger->log_info("Validation Layer Enabled");
-            std::string validationLayerLibraryPath = create_library_path(MAKE_LAYER_NAME( "ze_validation_layer" ), loaderLibraryPath.c_str());
-            validationLayer = LOAD_DRIVER_LIBRARY( validationLayerLibraryPath.c_str() );
             if(validationLayer)
             {
                 auto getVersion = reinterpret_cast<getVersion_t>(
@@ -474,37 +527,20 @@ namespace loader
                     compVersions.push_back(compVersion);
                 }
             } else if (debugTraceEnabled) {
-                GET_LIBRARY_ERROR(loadLibraryErrorValue);
                 std::string errorMessage = "Load Library of " + std::string(MAKE_LAYER_NAME( "ze_validation_layer" )) + " failed with ";
-                debug_trace_message(errorMessage, loadLibraryErrorValue);
-                loadLibraryErrorValue.clear();
+                debug_trace_message(errorMessage, libraries[ driverCount ].error);
             }
         }
 
-        if (getenv_tobool( "ZE_ENABLE_TRACING_LAYER" )) {
-            zel_logger->log_info("Tracing Layer Enabled");
-            tracingLayerEnabled = true;
-        }
-        std::string tracingLayerLibraryPath = create_library_path(MAKE_LAYER_NAME( "ze_tracing_layer" ), loaderLibraryPath.c_str());
         if (debugTraceEnabled)
             debug_trace_message("Tracing Layer Library Path: ", tracingLayerLibraryPath);
-        tracingLayer = LOAD_DRIVER_LIBRARY( tracingLayerLibraryPath.c_str() );
         if(tracingLayer)
         {
-            auto getVersion = reinterpret_cast<getVersion_t>(
-                GET_FUNCTION_PTR(tracingLayer, "zelLoaderGetVersion"));
-            zel_component_version_t compVersion;
-            if(getVersion && ZE_RESULT_SUCCESS == getVersion(&compVersion))
-            {   
-                compVersions.push_back(compVersion);
-            }
-        } else if (debugTraceEnabled) {
-            GET_LIBRARY_ERROR(loadLibraryErrorValue);
+            add_tracing_layer_version();
+        } else if (tracingLayerEnabled && debugTraceEnabled) {
             std::string errorMessage = "Load Library of " + std::string(MAKE_LAYER_NAME( "ze_tracing_layer" )) + " failed with ";
-            debug_trace_message(errorMessage, loadLibraryErrorValue);
-            loadLibraryErrorValue.clear();
+            debug_trace_message(errorMessage, libraries[ tracingLayerIndex ].error);
         }
-
         if( getenv_tobool( "ZET_ENABLE_API_TRACING_EXP" ) ) {
             auto depr_msg = "ZET_ENABLE_API_TRACING_EXP is deprecated. Use ZE_ENABLE_TRACING_LAYER instead";
             zel_logger->log_warning(depr_msg);
@@ -574,6 +610,91 @@ namespace loader
 
     };
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Load the libraries concurrently; the entries follow the order of paths.
+    std::vector<context_t::library_t> context_t::load_libraries(const std::vector<std::string> &paths){
+        std::vector<library_t> libraries(paths.size());
+        parallel_for(paths.size(), initThreadCount, [&](size_t i) {
+            libraries[i].handle = LOAD_DRIVER_LIBRARY( paths[i].c_str() );
+            if (!libraries[i].handle && debugTraceEnabled)
+                GET_LIBRARY_ERROR(libraries[i].error);
+        });
+        return libraries;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Drivers exporting zelDriverSetLoaderDdiTable store a table owned by the
+    /// loader as the first member of their handles, which the intercepts then
+    /// dispatch on directly. The table is shared by the driver's copies in
+    /// zeDrivers and zesDrivers and filled as their ddi tables are queried.
+    void context_t::negotiate_ddi_handles(driver_t &driver){
+        auto setLoaderDdiTable = reinterpret_cast<zel_pfnDriverSetLoaderDdiTable_t>(
+            GET_FUNCTION_PTR(driver.handle, ZEL_DRIVER_SET_LOADER_DDI_TABLE_NAME));
+        if(!setLoaderDdiTable)
+            return;
+
+        auto ddiHandlesTable = std::make_shared<dditable_t>();
+        ddiHandlesTable->ddiHandles = true;
+        auto result = setLoaderDdiTable(ddiHandlesTable.get());
+        if (debugTraceEnabled) {
+            std::string message = "Driver " + driver.name + " " + ZEL_DRIVER_SET_LOADER_DDI_TABLE_NAME + " returned ";
+            debug_trace_message(message, loader::to_string(result));
+        }
+        if(result == ZE_RESULT_SUCCESS) {
+            driver.ddiHandlesTable = ddiHandlesTable;
+            zel_logger->log_info("Driver " + driver.name + " dispatches on driver handles");
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// load the API tracing layer if init left it unloaded and let it intercept
+    /// the loader's DDIs kept in tracing_dditable; safe to call concurrently
+    ze_result_t context_t::load_tracing_layer()
+    {
+        std::lock_guard<std::mutex> lk( tracingLayerMutex );
+        if( tracingLayer )
+            return ZE_RESULT_SUCCESS;
+        if( tracingLayerLibraryPath.empty() )
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+
+        auto handle = LOAD_DRIVER_LIBRARY( tracingLayerLibraryPath.c_str() );
+        if( NULL == handle ) {
+            if (debugTraceEnabled) {
+                std::string errorMessage = "Load Library of " + std::string(MAKE_LAYER_NAME( "ze_tracing_layer" )) + " failed with ";
+                std::string errorValue;
+                GET_LIBRARY_ERROR(errorValue);
+                debug_trace_message(errorMessage, errorValue);
+            }
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        }
+
+        tracingLayer = handle;
+        add_tracing_layer_version();
+        auto result = zeTracingLayerGetProcAddrTables( ZE_API_VERSION_CURRENT );
+        if( ZE_RESULT_SUCCESS == result )
+            result = zetTracingLayerGetProcAddrTables( ZE_API_VERSION_CURRENT );
+        if( ZE_RESULT_SUCCESS == result )
+            result = zesTracingLayerGetProcAddrTables( ZE_API_VERSION_CURRENT );
+        if( ZE_RESULT_SUCCESS != result )
+            zel_logger->log_error("Tracing Layer failed to intercept the loader's DDIs");
+        else
+            zel_logger->log_info("Tracing Layer Loaded");
+        return result;
+    }
+
+    void context_t::add_tracing_layer_version()
+    {
+        typedef ze_result_t (ZE_APICALL *getVersion_t)(zel_component_version_t *version);
+        auto getVersion = reinterpret_cast<getVersion_t>(
+            GET_FUNCTION_PTR(tracingLayer, "zelLoaderGetVersion"));
+        zel_component_version_t compVersion;
+        if(getVersion && ZE_RESULT_SUCCESS == getVersion(&compVersion))
+        {
+            std::lock_guard<std::mutex> lock(compVersionsMutex);
+            compVersions.push_back(compVersion);
+        }
+    }
+
     void context_t::add_loader_version(){
         zel_component_version_t compVersion = {};
         string_copy_s(compVersion.component_name, LOADER_COMP_NAME, ZEL_COMPONENT_STRING_SIZE - 1);
@@ -33,9 +33,9 @@ zeLoaderInit()
 ///     - ::ZE_RESULT_SUCCESS
 ///     - ::ZE_RESULT_ERROR_UNINITIALIZED
 ZE_DLLEXPORT ze_result_t ZE_APICALL
-zelLoaderDriverCheck(ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, ze_global_dditable_t *globalInitStored, zes_global_dditable_t *sysmanGlobalInitStored, bool *requireDdiReinit, bool sysmanOnly)
+zelLoaderDriverCheck(ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, bool *requireDdiReinit, bool sysmanOnly)
 {
-    return loader::context->check_drivers(flags, desc, globalInitStored, sysmanGlobalInitStored, requireDdiReinit, sysmanOnly);
+    return loader::context->check_drivers(flags, desc, requireDdiReinit, sysmanOnly);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -50,19 +50,30 @@ zeLoaderGetTracingHandle()
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Internal function for Setting the ddi table for the Tracing Layer.
+/// @brief Internal function for Setting the ddi tables for the Tracing Layer.
 ///
 ZE_DLLEXPORT ze_result_t ZE_APICALL
-zelLoaderTracingLayerInit(std::atomic<ze_dditable_t *> &zeDdiTable) {
+zelLoaderTracingLayerInit(std::atomic<ze_dditable_t *> &zeDdiTable, std::atomic<zet_dditable_t *> &zetDdiTable, std::atomic<zes_dditable_t *> &zesDdiTable) {
     zeDdiTable.store(&loader::context->tracing_dditable.ze);
+    zetDdiTable.store(&loader::context->tracing_dditable.zet);
+    zesDdiTable.store(&loader::context->tracing_dditable.zes);
     return ZE_RESULT_SUCCESS;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Internal function for loading the Tracing Layer on first use.
+///
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelLoaderTracingLayerLoad() {
+    return loader::context->load_tracing_layer();
+}
+
 ZE_DLLEXPORT ze_result_t ZE_APICALL
 zelLoaderGetVersionsInternal(
    size_t *num_elems,                     //Pointer to num versions to get.  
    zel_component_version_t *versions)    //Pointer to array of versions. If set to NULL, num_elems is returned
 {
+    std::lock_guard<std::mutex> lock(loader::context->compVersionsMutex);
     if(nullptr == versions){
         *num_elems = loader::context->compVersions.size();
         return ZE_RESULT_SUCCESS;
@@ -86,6 +97,12 @@ zelLoaderTranslateHandleInternal(
         return ZE_RESULT_SUCCESS;
     }
 
+    // handles of drivers storing the loader's table are never wrapped
+    if(handleIn && reinterpret_cast<loader::ze_driver_object_t*>( handleIn )->dditable->ddiHandles) {
+        *handleOut = handleIn;
+        return ZE_RESULT_SUCCESS;
+    }
+
     switch(handleType){
         case ZEL_HANDLE_DRIVER: 
             *handleOut = reinterpret_cast<loader::ze_driver_object_t*>( handleIn )->handle;
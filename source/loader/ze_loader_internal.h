@@ -9,13 +9,19 @@
 #include <vector>
 #include <map>
 #include <atomic>
+#include <memory>
+#include <mutex>
 
 #include "ze_ddi.h"
 #include "zet_ddi.h"
 #include "zes_ddi.h"
 
 #include "ze_util.h"
+#include "ze_cache_line.h"
 #include "ze_object.h"
+#include "ze_handle_array.h"
+#include "ze_enumeration_cache.h"
+#include "ze_thread_pool.h"
 
 #include "ze_ldrddi.h"
 #include "zet_ldrddi.h"
@@ -32,15 +38,18 @@ namespace loader
         HMODULE handle = NULL;
         ze_result_t initStatus = ZE_RESULT_SUCCESS;
         ze_result_t initDriversStatus = ZE_RESULT_SUCCESS;
+        ze_result_t probeResult = ZE_RESULT_SUCCESS;    ///< result of the driver's own init in the last check_drivers
         dditable_t dditable = {};
+        std::shared_ptr<dditable_t> ddiHandlesTable;    ///< set if the driver stores this table in its handles
         std::string name;
         bool driverInuse = false;
+        uint32_t driverTypeFlags = 0;                   ///< ze_init_driver_type_flags_t from the driver's manifest, 0 if unknown
     };
 
     using driver_vector_t = std::vector< driver_t >;
 
     ///////////////////////////////////////////////////////////////////////////////
-    class context_t
+    class context_t : public cache_line_allocated_t
     {
     public:
         ///////////////////////////////////////////////////////////////////////////////
@@ -100,10 +109,7 @@ namespace loader
         zet_metric_tracer_exp_factory_t     zet_metric_tracer_exp_factory;
         zet_metric_decoder_exp_factory_t    zet_metric_decoder_exp_factory;
         ///////////////////////////////////////////////////////////////////////////////
-        std::mutex image_handle_map_lock;
-        std::mutex sampler_handle_map_lock;
-        std::unordered_map<ze_image_object_t *, ze_image_handle_t>            image_handle_map;
-        std::unordered_map<ze_sampler_object_t *, ze_sampler_handle_t>        sampler_handle_map;
+        enumeration_cache_t enumeration_cache;
         ze_api_version_t version = ZE_API_VERSION_CURRENT;
 
         driver_vector_t allDrivers;
@@ -118,20 +124,39 @@ namespace loader
         bool forceIntercept = false;
         bool initDriversSupport = false;
         std::vector<zel_component_version_t> compVersions;
+        std::mutex compVersionsMutex;               ///< the tracing layer's version may be added after init
         const char *LOADER_COMP_NAME = "loader";
 
-        ze_result_t check_drivers(ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, ze_global_dditable_t *globalInitStored, zes_global_dditable_t *sysmanGlobalInitStored, bool *requireDdiReinit, bool sysmanOnly);
+        ze_result_t check_drivers(ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, bool *requireDdiReinit, bool sysmanOnly);
         void debug_trace_message(std::string errorMessage, std::string errorValue);
         ze_result_t init();
-        ze_result_t init_driver(driver_t &driver, ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, ze_global_dditable_t *globalInitStored, zes_global_dditable_t *sysmanGlobalInitStored, bool sysmanOnly);
+        ze_result_t init_driver(driver_t &driver, ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, bool sysmanOnly);
         void add_loader_version();
+        void negotiate_ddi_handles(driver_t &driver);
+
+        struct library_t
+        {
+            HMODULE handle = nullptr;
+            std::string error;                      ///< reason the load failed, only kept when debug tracing
+        };
+        std::vector<library_t> load_libraries(const std::vector<std::string> &paths);
+        void probe_drivers(driver_vector_t &drivers, ze_init_flags_t flags, ze_init_driver_type_desc_t* desc, bool sysmanOnly);
+        size_t initThreadCount = 8;                 ///< threads loading and probing drivers, ZEL_LOADER_INIT_THREADS
         ~context_t();
         bool intercept_enabled = false;
         bool debugTraceEnabled = false;
         bool tracingLayerEnabled = false;
         dditable_t tracing_dditable = {};
+        std::string tracingLayerLibraryPath;
+        std::mutex tracingLayerMutex;               ///< serializes loading the tracing layer on first use
+        ze_result_t load_tracing_layer();
+        void add_tracing_layer_version();
         std::shared_ptr<Logger> zel_logger;
     };
 
     extern context_t *context;
+
+    __zedlllocal ze_result_t ZE_APICALL zeTracingLayerGetProcAddrTables( ze_api_version_t version );
+    __zedlllocal ze_result_t ZE_APICALL zetTracingLayerGetProcAddrTables( ze_api_version_t version );
+    __zedlllocal ze_result_t ZE_APICALL zesTracingLayerGetProcAddrTables( ze_api_version_t version );
 }
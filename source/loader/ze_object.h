@@ -11,27 +11,34 @@
 #include "ze_singleton.h"
 
 //////////////////////////////////////////////////////////////////////////
+/// driver function pointer tables; when ddiHandles is set, this is the table
+/// a driver stores as the first member of each of its handles, and the
+/// loader forwards calls on those handles without translating them
 struct dditable_t
 {
+    bool            ddiHandles = false;
     ze_dditable_t   ze;
     zet_dditable_t  zet;
     zes_dditable_t  zes;
 };
 
 //////////////////////////////////////////////////////////////////////////
+/// loader handle wrapping a driver handle; the dditable comes first so that
+/// it is found at the same offset as in the handles of drivers that store
+/// the loader's dditable themselves
 template<typename _handle_t>
 class object_t
 {
 public:
     using handle_t = _handle_t;
 
-    handle_t    handle;
     dditable_t* dditable;
+    handle_t    handle;
 
     object_t() = delete;
 
     object_t( handle_t _handle, dditable_t* _dditable )
-        : handle( _handle ), dditable( _dditable )
+        : dditable( _dditable ), handle( _handle )
     {
     }
 
@@ -0,0 +1,54 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ze_thread_pool.h
+ *
+ */
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace loader
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// run f( 0 ) .. f( count - 1 ) on up to max_threads threads, the calling
+    /// thread included, and return once every call has finished.
+    /// the calls are handed out in index order but may complete in any order,
+    /// so f must only write to state owned by its index; callers merge the
+    /// results afterwards in index order to keep the outcome deterministic.
+    /// if no worker thread can be started the calls simply run on the caller.
+    inline void parallel_for( size_t count, size_t max_threads, const std::function<void( size_t )>& f )
+    {
+        std::atomic<size_t> next{ 0 };
+        auto work = [&]() {
+            for( size_t i = next++; i < count; i = next++ )
+                f( i );
+        };
+
+        std::vector<std::thread> workers;
+        size_t thread_count = std::min( count, max_threads );
+        for( size_t i = 1; i < thread_count; ++i )
+        {
+            try
+            {
+                workers.emplace_back( work );
+            }
+            catch( std::system_error& )
+            {
+                break;
+            }
+        }
+
+        work();
+        for( auto& worker : workers )
+            worker.join();
+    }
+}
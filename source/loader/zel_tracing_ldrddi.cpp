@@ -54,6 +54,86 @@ zelGetTracerApiProcAddrTable(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's API statistics table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelGetTracingStatsProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zel_tracing_stats_dditable_t* pDdiTable         ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    if( loader::context->zeDrivers.size() < 1 )
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if( loader::context->version < version )
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if(( nullptr != loader::context->tracingLayer ))
+    {
+        // tracing layers older than the statistics have no table
+        auto getTable = reinterpret_cast<zel_pfnGetTracingStatsProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zelGetTracingStatsProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        result = getTable( version, pDdiTable );
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's deferred epilogue
+///        table with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelGetTracerAsyncProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zel_tracer_async_dditable_t* pDdiTable          ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    if( loader::context->zeDrivers.size() < 1 )
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if( loader::context->version < version )
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if(( nullptr != loader::context->tracingLayer ))
+    {
+        // tracing layers older than deferred epilogues have no table
+        auto getTable = reinterpret_cast<zel_pfnGetTracerAsyncProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zelGetTracerAsyncProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        result = getTable( version, pDdiTable );
+    }
+
+    return result;
+}
+
 
 #if defined(__cplusplus)
 };
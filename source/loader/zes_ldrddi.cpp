@@ -87,7 +87,8 @@ namespace loader
 
                 try
                 {
-                    for( uint32_t i = 0; i < library_driver_handle_count; ++i ) {
+                    // driver handles carry the loader's table and are returned as is
+                    for( uint32_t i = 0; !drv.ddiHandlesTable && i < library_driver_handle_count; ++i ) {
                         uint32_t driver_index = total_driver_handle_count + i;
                         phDrivers[ driver_index ] = reinterpret_cast<zes_driver_handle_t>(
                             context->zes_driver_factory.getInstance( phDrivers[ driver_index ], &drv.dditable ) );
@@ -137,6 +138,10 @@ namespace loader
         if( nullptr == pfnGetExtensionProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<zes_driver_object_t*>( hDriver )->handle;
 
@@ -163,6 +168,10 @@ namespace loader
         if( nullptr == pfnGetExtensionFunctionAddress )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<zes_driver_object_t*>( hDriver )->handle;
 
@@ -196,6 +205,10 @@ namespace loader
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGet( hDriver, pCount, phDevices );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<zes_driver_object_t*>( hDriver )->handle;
 
@@ -236,6 +249,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hDevice, pProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -261,6 +278,10 @@ namespace loader
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetState( hDevice, pState );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -287,6 +308,10 @@ namespace loader
         if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnReset( hDevice, force );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -312,6 +337,10 @@ namespace loader
         if( nullptr == pfnResetExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnResetExt( hDevice, pProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -346,6 +375,10 @@ namespace loader
         if( nullptr == pfnProcessesGetState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnProcessesGetState( hDevice, pCount, pProcesses );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -371,6 +404,10 @@ namespace loader
         if( nullptr == pfnPciGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnPciGetProperties( hDevice, pProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -396,6 +433,10 @@ namespace loader
         if( nullptr == pfnPciGetState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnPciGetState( hDevice, pState );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -429,6 +470,10 @@ namespace loader
         if( nullptr == pfnPciGetBars )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnPciGetBars( hDevice, pCount, pProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -454,6 +499,10 @@ namespace loader
         if( nullptr == pfnPciGetStats )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnPciGetStats( hDevice, pStats );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -478,6 +527,10 @@ namespace loader
         if( nullptr == pfnSetOverclockWaiver )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetOverclockWaiver( hDevice );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -505,6 +558,10 @@ namespace loader
         if( nullptr == pfnGetOverclockDomains )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetOverclockDomains( hDevice, pOverclockDomains );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -533,6 +590,10 @@ namespace loader
         if( nullptr == pfnGetOverclockControls )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetOverclockControls( hDevice, domainType, pAvailableControls );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -559,6 +620,10 @@ namespace loader
         if( nullptr == pfnResetOverclockSettings )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnResetOverclockSettings( hDevice, onShippedState );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -589,6 +654,10 @@ namespace loader
         if( nullptr == pfnReadOverclockState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnReadOverclockState( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -624,6 +693,10 @@ namespace loader
         if( nullptr == pfnEnumOverclockDomains )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumOverclockDomains( hDevice, pCount, phDomainHandle );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -664,6 +737,10 @@ namespace loader
         if( nullptr == pfnGetDomainProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetDomainProperties( hDomainHandle, pDomainProperties );
+
         // convert loader handle to driver handle
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
@@ -689,6 +766,10 @@ namespace loader
         if( nullptr == pfnGetDomainVFProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetDomainVFProperties( hDomainHandle, pVFProperties );
+
         // convert loader handle to driver handle
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
@@ -715,6 +796,10 @@ namespace loader
         if( nullptr == pfnGetDomainControlProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetDomainControlProperties( hDomainHandle, DomainControl, pControlProperties );
+
         // convert loader handle to driver handle
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
@@ -741,6 +826,10 @@ namespace loader
         if( nullptr == pfnGetControlCurrentValue )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetControlCurrentValue( hDomainHandle, DomainControl, pValue );
+
         // convert loader handle to driver handle
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
@@ -768,6 +857,10 @@ namespace loader
         if( nullptr == pfnGetControlPendingValue )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetControlPendingValue( hDomainHandle, DomainControl, pValue );
+
         // convert loader handle to driver handle
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
@@ -796,6 +889,10 @@ namespace loader
         if( nullptr == pfnSetControlUserValue )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetControlUserValue( hDomainHandle, DomainControl, pValue, pPendingAction );
+
         // convert loader handle to driver handle
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
@@ -823,6 +920,10 @@ namespace loader
         if( nullptr == pfnGetControlState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetControlState( hDomainHandle, DomainControl, pControlState, pPendingAction );
+
         // convert loader handle to driver handle
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
@@ -852,6 +953,10 @@ namespace loader
         if( nullptr == pfnGetVFPointValues )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetVFPointValues( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
+
         // convert loader handle to driver handle
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
@@ -880,6 +985,10 @@ namespace loader
         if( nullptr == pfnSetVFPointValues )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetVFPointValues( hDomainHandle, VFType, PointIndex, PointValue );
+
         // convert loader handle to driver handle
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
@@ -915,6 +1024,10 @@ namespace loader
         if( nullptr == pfnEnumDiagnosticTestSuites )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumDiagnosticTestSuites( hDevice, pCount, phDiagnostics );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -956,6 +1069,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hDiagnostics, pProperties );
+
         // convert loader handle to driver handle
         hDiagnostics = reinterpret_cast<zes_diag_object_t*>( hDiagnostics )->handle;
 
@@ -989,6 +1106,10 @@ namespace loader
         if( nullptr == pfnGetTests )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetTests( hDiagnostics, pCount, pTests );
+
         // convert loader handle to driver handle
         hDiagnostics = reinterpret_cast<zes_diag_object_t*>( hDiagnostics )->handle;
 
@@ -1018,6 +1139,10 @@ namespace loader
         if( nullptr == pfnRunTests )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnRunTests( hDiagnostics, startIndex, endIndex, pResult );
+
         // convert loader handle to driver handle
         hDiagnostics = reinterpret_cast<zes_diag_object_t*>( hDiagnostics )->handle;
 
@@ -1043,6 +1168,10 @@ namespace loader
         if( nullptr == pfnEccAvailable )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEccAvailable( hDevice, pAvailable );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -1068,6 +1197,10 @@ namespace loader
         if( nullptr == pfnEccConfigurable )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEccConfigurable( hDevice, pConfigurable );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -1093,6 +1226,10 @@ namespace loader
         if( nullptr == pfnGetEccState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetEccState( hDevice, pState );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -1119,6 +1256,10 @@ namespace loader
         if( nullptr == pfnSetEccState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetEccState( hDevice, newState, pState );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -1154,6 +1295,10 @@ namespace loader
         if( nullptr == pfnEnumEngineGroups )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumEngineGroups( hDevice, pCount, phEngine );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -1194,6 +1339,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hEngine, pProperties );
+
         // convert loader handle to driver handle
         hEngine = reinterpret_cast<zes_engine_object_t*>( hEngine )->handle;
 
@@ -1220,6 +1369,10 @@ namespace loader
         if( nullptr == pfnGetActivity )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetActivity( hEngine, pStats );
+
         // convert loader handle to driver handle
         hEngine = reinterpret_cast<zes_engine_object_t*>( hEngine )->handle;
 
@@ -1245,6 +1398,10 @@ namespace loader
         if( nullptr == pfnEventRegister )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEventRegister( hDevice, events );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -1286,17 +1443,20 @@ namespace loader
         if( nullptr == pfnEventListen )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // convert loader handles to driver handles
-        auto phDevicesLocal = new zes_device_handle_t [count];
+        handle_array_t<zes_device_handle_t> phDevicesLocal( count );
         for( size_t i = 0; ( nullptr != phDevices ) && ( i < count ); ++i )
             phDevicesLocal[ i ] = reinterpret_cast<zes_device_object_t*>( phDevices[ i ] )->handle;
 
         // forward to device-driver
         result = pfnEventListen( hDriver, timeout, count, phDevicesLocal, pNumDeviceEvents, pEvents );
-        delete []phDevicesLocal;
 
         return result;
     }
@@ -1333,17 +1493,20 @@ namespace loader
         if( nullptr == pfnEventListenEx )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // convert loader handles to driver handles
-        auto phDevicesLocal = new zes_device_handle_t [count];
+        handle_array_t<zes_device_handle_t> phDevicesLocal( count );
         for( size_t i = 0; ( nullptr != phDevices ) && ( i < count ); ++i )
             phDevicesLocal[ i ] = reinterpret_cast<zes_device_object_t*>( phDevices[ i ] )->handle;
 
         // forward to device-driver
         result = pfnEventListenEx( hDriver, timeout, count, phDevicesLocal, pNumDeviceEvents, pEvents );
-        delete []phDevicesLocal;
 
         return result;
     }
@@ -1374,6 +1537,10 @@ namespace loader
         if( nullptr == pfnEnumFabricPorts )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumFabricPorts( hDevice, pCount, phPort );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -1414,6 +1581,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hPort, pProperties );
+
         // convert loader handle to driver handle
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
@@ -1440,6 +1611,10 @@ namespace loader
         if( nullptr == pfnGetLinkType )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetLinkType( hPort, pLinkType );
+
         // convert loader handle to driver handle
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
@@ -1465,6 +1640,10 @@ namespace loader
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetConfig( hPort, pConfig );
+
         // convert loader handle to driver handle
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
@@ -1490,6 +1669,10 @@ namespace loader
         if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetConfig( hPort, pConfig );
+
         // convert loader handle to driver handle
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
@@ -1515,6 +1698,10 @@ namespace loader
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetState( hPort, pState );
+
         // convert loader handle to driver handle
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
@@ -1540,6 +1727,10 @@ namespace loader
         if( nullptr == pfnGetThroughput )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetThroughput( hPort, pThroughput );
+
         // convert loader handle to driver handle
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
@@ -1565,6 +1756,10 @@ namespace loader
         if( nullptr == pfnGetFabricErrorCounters )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetFabricErrorCounters( hPort, pErrors );
+
         // convert loader handle to driver handle
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
@@ -1594,17 +1789,20 @@ namespace loader
         if( nullptr == pfnGetMultiPortThroughput )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetMultiPortThroughput( hDevice, numPorts, phPort, pThroughput );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // convert loader handles to driver handles
-        auto phPortLocal = new zes_fabric_port_handle_t [numPorts];
+        handle_array_t<zes_fabric_port_handle_t> phPortLocal( numPorts );
         for( size_t i = 0; ( nullptr != phPort ) && ( i < numPorts ); ++i )
             phPortLocal[ i ] = reinterpret_cast<zes_fabric_port_object_t*>( phPort[ i ] )->handle;
 
         // forward to device-driver
         result = pfnGetMultiPortThroughput( hDevice, numPorts, phPortLocal, pThroughput );
-        delete []phPortLocal;
 
         return result;
     }
@@ -1635,6 +1833,10 @@ namespace loader
         if( nullptr == pfnEnumFans )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumFans( hDevice, pCount, phFan );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -1675,6 +1877,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hFan, pProperties );
+
         // convert loader handle to driver handle
         hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
 
@@ -1700,6 +1906,10 @@ namespace loader
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetConfig( hFan, pConfig );
+
         // convert loader handle to driver handle
         hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
 
@@ -1724,6 +1934,10 @@ namespace loader
         if( nullptr == pfnSetDefaultMode )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetDefaultMode( hFan );
+
         // convert loader handle to driver handle
         hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
 
@@ -1749,6 +1963,10 @@ namespace loader
         if( nullptr == pfnSetFixedSpeedMode )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetFixedSpeedMode( hFan, speed );
+
         // convert loader handle to driver handle
         hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
 
@@ -1774,6 +1992,10 @@ namespace loader
         if( nullptr == pfnSetSpeedTableMode )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetSpeedTableMode( hFan, speedTable );
+
         // convert loader handle to driver handle
         hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
 
@@ -1802,6 +2024,10 @@ namespace loader
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetState( hFan, units, pSpeed );
+
         // convert loader handle to driver handle
         hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
 
@@ -1837,6 +2063,10 @@ namespace loader
         if( nullptr == pfnEnumFirmwares )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumFirmwares( hDevice, pCount, phFirmware );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -1878,6 +2108,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hFirmware, pProperties );
+
         // convert loader handle to driver handle
         hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
 
@@ -1904,6 +2138,10 @@ namespace loader
         if( nullptr == pfnFlash )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnFlash( hFirmware, pImage, size );
+
         // convert loader handle to driver handle
         hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
 
@@ -1929,6 +2167,10 @@ namespace loader
         if( nullptr == pfnGetFlashProgress )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetFlashProgress( hFirmware, pCompletionPercent );
+
         // convert loader handle to driver handle
         hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
 
@@ -1955,6 +2197,10 @@ namespace loader
         if( nullptr == pfnGetConsoleLogs )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetConsoleLogs( hFirmware, pSize, pFirmwareLog );
+
         // convert loader handle to driver handle
         hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
 
@@ -1990,6 +2236,10 @@ namespace loader
         if( nullptr == pfnEnumFrequencyDomains )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumFrequencyDomains( hDevice, pCount, phFrequency );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -2030,6 +2280,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hFrequency, pProperties );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2063,6 +2317,10 @@ namespace loader
         if( nullptr == pfnGetAvailableClocks )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetAvailableClocks( hFrequency, pCount, phFrequency );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2089,6 +2347,10 @@ namespace loader
         if( nullptr == pfnGetRange )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetRange( hFrequency, pLimits );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2115,6 +2377,10 @@ namespace loader
         if( nullptr == pfnSetRange )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetRange( hFrequency, pLimits );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2140,6 +2406,10 @@ namespace loader
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetState( hFrequency, pState );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2166,6 +2436,10 @@ namespace loader
         if( nullptr == pfnGetThrottleTime )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetThrottleTime( hFrequency, pThrottleTime );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2191,6 +2465,10 @@ namespace loader
         if( nullptr == pfnOcGetCapabilities )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOcGetCapabilities( hFrequency, pOcCapabilities );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2219,6 +2497,10 @@ namespace loader
         if( nullptr == pfnOcGetFrequencyTarget )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOcGetFrequencyTarget( hFrequency, pCurrentOcFrequency );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2247,6 +2529,10 @@ namespace loader
         if( nullptr == pfnOcSetFrequencyTarget )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOcSetFrequencyTarget( hFrequency, CurrentOcFrequency );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2277,6 +2563,10 @@ namespace loader
         if( nullptr == pfnOcGetVoltageTarget )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOcGetVoltageTarget( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2307,6 +2597,10 @@ namespace loader
         if( nullptr == pfnOcSetVoltageTarget )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOcSetVoltageTarget( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2332,6 +2626,10 @@ namespace loader
         if( nullptr == pfnOcSetMode )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOcSetMode( hFrequency, CurrentOcMode );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2357,6 +2655,10 @@ namespace loader
         if( nullptr == pfnOcGetMode )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOcGetMode( hFrequency, pCurrentOcMode );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2383,6 +2685,10 @@ namespace loader
         if( nullptr == pfnOcGetIccMax )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOcGetIccMax( hFrequency, pOcIccMax );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2408,6 +2714,10 @@ namespace loader
         if( nullptr == pfnOcSetIccMax )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOcSetIccMax( hFrequency, ocIccMax );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2434,6 +2744,10 @@ namespace loader
         if( nullptr == pfnOcGetTjMax )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOcGetTjMax( hFrequency, pOcTjMax );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2459,6 +2773,10 @@ namespace loader
         if( nullptr == pfnOcSetTjMax )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOcSetTjMax( hFrequency, ocTjMax );
+
         // convert loader handle to driver handle
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
@@ -2494,6 +2812,10 @@ namespace loader
         if( nullptr == pfnEnumLeds )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumLeds( hDevice, pCount, phLed );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -2534,6 +2856,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hLed, pProperties );
+
         // convert loader handle to driver handle
         hLed = reinterpret_cast<zes_led_object_t*>( hLed )->handle;
 
@@ -2559,6 +2885,10 @@ namespace loader
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetState( hLed, pState );
+
         // convert loader handle to driver handle
         hLed = reinterpret_cast<zes_led_object_t*>( hLed )->handle;
 
@@ -2584,6 +2914,10 @@ namespace loader
         if( nullptr == pfnSetState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetState( hLed, enable );
+
         // convert loader handle to driver handle
         hLed = reinterpret_cast<zes_led_object_t*>( hLed )->handle;
 
@@ -2609,6 +2943,10 @@ namespace loader
         if( nullptr == pfnSetColor )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetColor( hLed, pColor );
+
         // convert loader handle to driver handle
         hLed = reinterpret_cast<zes_led_object_t*>( hLed )->handle;
 
@@ -2644,6 +2982,10 @@ namespace loader
         if( nullptr == pfnEnumMemoryModules )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumMemoryModules( hDevice, pCount, phMemory );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -2684,6 +3026,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hMemory, pProperties );
+
         // convert loader handle to driver handle
         hMemory = reinterpret_cast<zes_mem_object_t*>( hMemory )->handle;
 
@@ -2709,6 +3055,10 @@ namespace loader
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetState( hMemory, pState );
+
         // convert loader handle to driver handle
         hMemory = reinterpret_cast<zes_mem_object_t*>( hMemory )->handle;
 
@@ -2735,6 +3085,10 @@ namespace loader
         if( nullptr == pfnGetBandwidth )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetBandwidth( hMemory, pBandwidth );
+
         // convert loader handle to driver handle
         hMemory = reinterpret_cast<zes_mem_object_t*>( hMemory )->handle;
 
@@ -2770,6 +3124,10 @@ namespace loader
         if( nullptr == pfnEnumPerformanceFactorDomains )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumPerformanceFactorDomains( hDevice, pCount, phPerf );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -2811,6 +3169,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hPerf, pProperties );
+
         // convert loader handle to driver handle
         hPerf = reinterpret_cast<zes_perf_object_t*>( hPerf )->handle;
 
@@ -2837,6 +3199,10 @@ namespace loader
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetConfig( hPerf, pFactor );
+
         // convert loader handle to driver handle
         hPerf = reinterpret_cast<zes_perf_object_t*>( hPerf )->handle;
 
@@ -2862,6 +3228,10 @@ namespace loader
         if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetConfig( hPerf, factor );
+
         // convert loader handle to driver handle
         hPerf = reinterpret_cast<zes_perf_object_t*>( hPerf )->handle;
 
@@ -2897,6 +3267,10 @@ namespace loader
         if( nullptr == pfnEnumPowerDomains )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumPowerDomains( hDevice, pCount, phPower );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -2937,6 +3311,10 @@ namespace loader
         if( nullptr == pfnGetCardPowerDomain )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetCardPowerDomain( hDevice, phPower );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -2976,6 +3354,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hPower, pProperties );
+
         // convert loader handle to driver handle
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
@@ -3002,6 +3384,10 @@ namespace loader
         if( nullptr == pfnGetEnergyCounter )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetEnergyCounter( hPower, pEnergy );
+
         // convert loader handle to driver handle
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
@@ -3032,6 +3418,10 @@ namespace loader
         if( nullptr == pfnGetLimits )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetLimits( hPower, pSustained, pBurst, pPeak );
+
         // convert loader handle to driver handle
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
@@ -3062,6 +3452,10 @@ namespace loader
         if( nullptr == pfnSetLimits )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetLimits( hPower, pSustained, pBurst, pPeak );
+
         // convert loader handle to driver handle
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
@@ -3088,6 +3482,10 @@ namespace loader
         if( nullptr == pfnGetEnergyThreshold )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetEnergyThreshold( hPower, pThreshold );
+
         // convert loader handle to driver handle
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
@@ -3113,6 +3511,10 @@ namespace loader
         if( nullptr == pfnSetEnergyThreshold )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetEnergyThreshold( hPower, threshold );
+
         // convert loader handle to driver handle
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
@@ -3148,6 +3550,10 @@ namespace loader
         if( nullptr == pfnEnumPsus )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumPsus( hDevice, pCount, phPsu );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -3188,6 +3594,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hPsu, pProperties );
+
         // convert loader handle to driver handle
         hPsu = reinterpret_cast<zes_psu_object_t*>( hPsu )->handle;
 
@@ -3213,6 +3623,10 @@ namespace loader
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetState( hPsu, pState );
+
         // convert loader handle to driver handle
         hPsu = reinterpret_cast<zes_psu_object_t*>( hPsu )->handle;
 
@@ -3248,6 +3662,10 @@ namespace loader
         if( nullptr == pfnEnumRasErrorSets )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumRasErrorSets( hDevice, pCount, phRas );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -3288,6 +3706,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hRas, pProperties );
+
         // convert loader handle to driver handle
         hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
 
@@ -3314,6 +3736,10 @@ namespace loader
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetConfig( hRas, pConfig );
+
         // convert loader handle to driver handle
         hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
 
@@ -3339,6 +3765,10 @@ namespace loader
         if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetConfig( hRas, pConfig );
+
         // convert loader handle to driver handle
         hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
 
@@ -3365,6 +3795,10 @@ namespace loader
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetState( hRas, clear, pState );
+
         // convert loader handle to driver handle
         hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
 
@@ -3400,6 +3834,10 @@ namespace loader
         if( nullptr == pfnEnumSchedulers )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumSchedulers( hDevice, pCount, phScheduler );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -3440,6 +3878,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hScheduler, pProperties );
+
         // convert loader handle to driver handle
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
@@ -3465,6 +3907,10 @@ namespace loader
         if( nullptr == pfnGetCurrentMode )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetCurrentMode( hScheduler, pMode );
+
         // convert loader handle to driver handle
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
@@ -3492,6 +3938,10 @@ namespace loader
         if( nullptr == pfnGetTimeoutModeProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetTimeoutModeProperties( hScheduler, getDefaults, pConfig );
+
         // convert loader handle to driver handle
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
@@ -3519,6 +3969,10 @@ namespace loader
         if( nullptr == pfnGetTimesliceModeProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetTimesliceModeProperties( hScheduler, getDefaults, pConfig );
+
         // convert loader handle to driver handle
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
@@ -3546,6 +4000,10 @@ namespace loader
         if( nullptr == pfnSetTimeoutMode )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetTimeoutMode( hScheduler, pProperties, pNeedReload );
+
         // convert loader handle to driver handle
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
@@ -3573,6 +4031,10 @@ namespace loader
         if( nullptr == pfnSetTimesliceMode )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetTimesliceMode( hScheduler, pProperties, pNeedReload );
+
         // convert loader handle to driver handle
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
@@ -3599,6 +4061,10 @@ namespace loader
         if( nullptr == pfnSetExclusiveMode )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetExclusiveMode( hScheduler, pNeedReload );
+
         // convert loader handle to driver handle
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
@@ -3625,6 +4091,10 @@ namespace loader
         if( nullptr == pfnSetComputeUnitDebugMode )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetComputeUnitDebugMode( hScheduler, pNeedReload );
+
         // convert loader handle to driver handle
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
@@ -3660,6 +4130,10 @@ namespace loader
         if( nullptr == pfnEnumStandbyDomains )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumStandbyDomains( hDevice, pCount, phStandby );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -3700,6 +4174,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hStandby, pProperties );
+
         // convert loader handle to driver handle
         hStandby = reinterpret_cast<zes_standby_object_t*>( hStandby )->handle;
 
@@ -3725,6 +4203,10 @@ namespace loader
         if( nullptr == pfnGetMode )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetMode( hStandby, pMode );
+
         // convert loader handle to driver handle
         hStandby = reinterpret_cast<zes_standby_object_t*>( hStandby )->handle;
 
@@ -3750,6 +4232,10 @@ namespace loader
         if( nullptr == pfnSetMode )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetMode( hStandby, mode );
+
         // convert loader handle to driver handle
         hStandby = reinterpret_cast<zes_standby_object_t*>( hStandby )->handle;
 
@@ -3785,6 +4271,10 @@ namespace loader
         if( nullptr == pfnEnumTemperatureSensors )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumTemperatureSensors( hDevice, pCount, phTemperature );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -3825,6 +4315,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hTemperature, pProperties );
+
         // convert loader handle to driver handle
         hTemperature = reinterpret_cast<zes_temp_object_t*>( hTemperature )->handle;
 
@@ -3850,6 +4344,10 @@ namespace loader
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetConfig( hTemperature, pConfig );
+
         // convert loader handle to driver handle
         hTemperature = reinterpret_cast<zes_temp_object_t*>( hTemperature )->handle;
 
@@ -3875,6 +4373,10 @@ namespace loader
         if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetConfig( hTemperature, pConfig );
+
         // convert loader handle to driver handle
         hTemperature = reinterpret_cast<zes_temp_object_t*>( hTemperature )->handle;
 
@@ -3901,6 +4403,10 @@ namespace loader
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetState( hTemperature, pTemperature );
+
         // convert loader handle to driver handle
         hTemperature = reinterpret_cast<zes_temp_object_t*>( hTemperature )->handle;
 
@@ -3934,6 +4440,10 @@ namespace loader
         if( nullptr == pfnGetLimitsExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetLimitsExt( hPower, pCount, pSustained );
+
         // convert loader handle to driver handle
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
@@ -3960,6 +4470,10 @@ namespace loader
         if( nullptr == pfnSetLimitsExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetLimitsExt( hPower, pCount, pSustained );
+
         // convert loader handle to driver handle
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
@@ -3998,6 +4512,10 @@ namespace loader
         if( nullptr == pfnGetActivityExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetActivityExt( hEngine, pCount, pStats );
+
         // convert loader handle to driver handle
         hEngine = reinterpret_cast<zes_engine_object_t*>( hEngine )->handle;
 
@@ -4031,6 +4549,10 @@ namespace loader
         if( nullptr == pfnGetStateExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetStateExp( hRas, pCount, pState );
+
         // convert loader handle to driver handle
         hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
 
@@ -4056,6 +4578,10 @@ namespace loader
         if( nullptr == pfnClearStateExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnClearStateExp( hRas, category );
+
         // convert loader handle to driver handle
         hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
 
@@ -4082,6 +4608,10 @@ namespace loader
         if( nullptr == pfnGetSecurityVersionExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetSecurityVersionExp( hFirmware, pVersion );
+
         // convert loader handle to driver handle
         hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
 
@@ -4106,6 +4636,10 @@ namespace loader
         if( nullptr == pfnSetSecurityVersionExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetSecurityVersionExp( hFirmware );
+
         // convert loader handle to driver handle
         hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
 
@@ -4139,6 +4673,10 @@ namespace loader
         if( nullptr == pfnGetSubDevicePropertiesExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetSubDevicePropertiesExp( hDevice, pCount, pSubdeviceProps );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -4168,6 +4706,10 @@ namespace loader
         if( nullptr == pfnGetDeviceByUuidExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetDeviceByUuidExp( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<zes_driver_object_t*>( hDriver )->handle;
 
@@ -4217,6 +4759,10 @@ namespace loader
         if( nullptr == pfnEnumActiveVFExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumActiveVFExp( hDevice, pCount, phVFhandle );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -4257,6 +4803,10 @@ namespace loader
         if( nullptr == pfnGetVFPropertiesExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetVFPropertiesExp( hVFhandle, pProperties );
+
         // convert loader handle to driver handle
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
@@ -4294,6 +4844,10 @@ namespace loader
         if( nullptr == pfnGetVFMemoryUtilizationExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetVFMemoryUtilizationExp( hVFhandle, pCount, pMemUtil );
+
         // convert loader handle to driver handle
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
@@ -4331,6 +4885,10 @@ namespace loader
         if( nullptr == pfnGetVFEngineUtilizationExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetVFEngineUtilizationExp( hVFhandle, pCount, pEngineUtil );
+
         // convert loader handle to driver handle
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
@@ -4358,6 +4916,10 @@ namespace loader
         if( nullptr == pfnSetVFTelemetryModeExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetVFTelemetryModeExp( hVFhandle, flags, enable );
+
         // convert loader handle to driver handle
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
@@ -4385,6 +4947,10 @@ namespace loader
         if( nullptr == pfnSetVFTelemetrySamplingIntervalExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetVFTelemetrySamplingIntervalExp( hVFhandle, flag, samplingInterval );
+
         // convert loader handle to driver handle
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
@@ -4420,6 +4986,10 @@ namespace loader
         if( nullptr == pfnEnumEnabledVFExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnumEnabledVFExp( hDevice, pCount, phVFhandle );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
@@ -4460,6 +5030,10 @@ namespace loader
         if( nullptr == pfnGetVFCapabilitiesExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetVFCapabilitiesExp( hVFhandle, pCapability );
+
         // convert loader handle to driver handle
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
@@ -4495,6 +5069,10 @@ namespace loader
         if( nullptr == pfnGetVFMemoryUtilizationExp2 )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetVFMemoryUtilizationExp2( hVFhandle, pCount, pMemUtil );
+
         // convert loader handle to driver handle
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
@@ -4530,6 +5108,10 @@ namespace loader
         if( nullptr == pfnGetVFEngineUtilizationExp2 )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetVFEngineUtilizationExp2( hVFhandle, pCount, pEngineUtil );
+
         // convert loader handle to driver handle
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
@@ -4591,6 +5173,8 @@ zesGetGlobalProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Global = drv.dditable.zes.Global;
     }
 
     if(!atLeastOneDriverValid)
@@ -4622,6 +5206,23 @@ zesGetGlobalProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Global = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetGlobalProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetGlobalProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Global );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -4667,6 +5268,8 @@ zesGetDeviceProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Device = drv.dditable.zes.Device;
     }
 
     if(!atLeastOneDriverValid)
@@ -4734,6 +5337,23 @@ zesGetDeviceProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Device = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetDeviceProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetDeviceProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Device );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -4774,6 +5394,8 @@ zesGetDeviceExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.zes.DeviceExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.DeviceExp = drv.dditable.zes.DeviceExp;
     }
 
 
@@ -4803,6 +5425,10 @@ zesGetDeviceExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which passes them through untraced
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.DeviceExp = *pDdiTable;
+
     return result;
 }
 
@@ -4848,6 +5474,8 @@ zesGetDriverProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Driver = drv.dditable.zes.Driver;
     }
 
     if(!atLeastOneDriverValid)
@@ -4883,6 +5511,23 @@ zesGetDriverProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Driver = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetDriverProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetDriverProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Driver );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -4923,6 +5568,8 @@ zesGetDriverExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.zes.DriverExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.DriverExp = drv.dditable.zes.DriverExp;
     }
 
 
@@ -4950,6 +5597,10 @@ zesGetDriverExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which passes them through untraced
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.DriverExp = *pDdiTable;
+
     return result;
 }
 
@@ -4995,6 +5646,8 @@ zesGetDiagnosticsProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Diagnostics = drv.dditable.zes.Diagnostics;
     }
 
     if(!atLeastOneDriverValid)
@@ -5028,6 +5681,23 @@ zesGetDiagnosticsProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Diagnostics = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetDiagnosticsProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetDiagnosticsProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Diagnostics );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -5073,6 +5743,8 @@ zesGetEngineProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Engine = drv.dditable.zes.Engine;
     }
 
     if(!atLeastOneDriverValid)
@@ -5106,6 +5778,23 @@ zesGetEngineProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Engine = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetEngineProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetEngineProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Engine );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -5151,6 +5840,8 @@ zesGetFabricPortProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.FabricPort = drv.dditable.zes.FabricPort;
     }
 
     if(!atLeastOneDriverValid)
@@ -5189,6 +5880,23 @@ zesGetFabricPortProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.FabricPort = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetFabricPortProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetFabricPortProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.FabricPort );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -5234,6 +5942,8 @@ zesGetFanProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Fan = drv.dditable.zes.Fan;
     }
 
     if(!atLeastOneDriverValid)
@@ -5270,6 +5980,23 @@ zesGetFanProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Fan = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetFanProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetFanProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Fan );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -5315,6 +6042,8 @@ zesGetFirmwareProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Firmware = drv.dditable.zes.Firmware;
     }
 
     if(!atLeastOneDriverValid)
@@ -5349,6 +6078,23 @@ zesGetFirmwareProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Firmware = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetFirmwareProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetFirmwareProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Firmware );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -5389,6 +6135,8 @@ zesGetFirmwareExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.zes.FirmwareExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.FirmwareExp = drv.dditable.zes.FirmwareExp;
     }
 
 
@@ -5417,6 +6165,10 @@ zesGetFirmwareExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which passes them through untraced
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.FirmwareExp = *pDdiTable;
+
     return result;
 }
 
@@ -5462,6 +6214,8 @@ zesGetFrequencyProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Frequency = drv.dditable.zes.Frequency;
     }
 
     if(!atLeastOneDriverValid)
@@ -5509,6 +6263,23 @@ zesGetFrequencyProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Frequency = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetFrequencyProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetFrequencyProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Frequency );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -5554,6 +6325,8 @@ zesGetLedProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Led = drv.dditable.zes.Led;
     }
 
     if(!atLeastOneDriverValid)
@@ -5588,6 +6361,23 @@ zesGetLedProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Led = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetLedProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetLedProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Led );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -5633,6 +6423,8 @@ zesGetMemoryProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Memory = drv.dditable.zes.Memory;
     }
 
     if(!atLeastOneDriverValid)
@@ -5666,6 +6458,23 @@ zesGetMemoryProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Memory = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetMemoryProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetMemoryProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Memory );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -5715,6 +6524,8 @@ zesGetOverclockProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Overclock = drv.dditable.zes.Overclock;
     }
 
     if(!atLeastOneDriverValid)
@@ -5754,6 +6565,23 @@ zesGetOverclockProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Overclock = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetOverclockProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetOverclockProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Overclock );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -5799,6 +6627,8 @@ zesGetPerformanceFactorProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.PerformanceFactor = drv.dditable.zes.PerformanceFactor;
     }
 
     if(!atLeastOneDriverValid)
@@ -5832,6 +6662,23 @@ zesGetPerformanceFactorProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.PerformanceFactor = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetPerformanceFactorProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetPerformanceFactorProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.PerformanceFactor );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -5877,6 +6724,8 @@ zesGetPowerProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Power = drv.dditable.zes.Power;
     }
 
     if(!atLeastOneDriverValid)
@@ -5915,6 +6764,23 @@ zesGetPowerProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Power = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetPowerProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetPowerProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Power );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -5960,6 +6826,8 @@ zesGetPsuProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Psu = drv.dditable.zes.Psu;
     }
 
     if(!atLeastOneDriverValid)
@@ -5992,6 +6860,23 @@ zesGetPsuProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Psu = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetPsuProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetPsuProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Psu );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -6037,6 +6922,8 @@ zesGetRasProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Ras = drv.dditable.zes.Ras;
     }
 
     if(!atLeastOneDriverValid)
@@ -6071,6 +6958,23 @@ zesGetRasProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Ras = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetRasProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetRasProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Ras );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -6111,6 +7015,8 @@ zesGetRasExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.zes.RasExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.RasExp = drv.dditable.zes.RasExp;
     }
 
 
@@ -6139,6 +7045,23 @@ zesGetRasExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.RasExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetRasExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetRasExpProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.RasExp );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -6184,6 +7107,8 @@ zesGetSchedulerProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Scheduler = drv.dditable.zes.Scheduler;
     }
 
     if(!atLeastOneDriverValid)
@@ -6222,6 +7147,23 @@ zesGetSchedulerProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Scheduler = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetSchedulerProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetSchedulerProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Scheduler );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -6267,6 +7209,8 @@ zesGetStandbyProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Standby = drv.dditable.zes.Standby;
     }
 
     if(!atLeastOneDriverValid)
@@ -6300,6 +7244,23 @@ zesGetStandbyProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Standby = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetStandbyProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetStandbyProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Standby );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -6345,6 +7306,8 @@ zesGetTemperatureProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.Temperature = drv.dditable.zes.Temperature;
     }
 
     if(!atLeastOneDriverValid)
@@ -6379,6 +7342,23 @@ zesGetTemperatureProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.Temperature = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zes_pfnGetTemperatureProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetTemperatureProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zes.Temperature );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -6419,6 +7399,8 @@ zesGetVFManagementExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.zes.VFManagementExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zes.VFManagementExp = drv.dditable.zes.VFManagementExp;
     }
 
 
@@ -6453,6 +7435,10 @@ zesGetVFManagementExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which passes them through untraced
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zes.VFManagementExp = *pDdiTable;
+
     return result;
 }
 
@@ -6460,3 +7446,199 @@ zesGetVFManagementExpProcAddrTable(
 #if defined(__cplusplus)
 };
 #endif
+
+namespace loader
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercepts the loader's DDIs kept in tracing_dditable with the
+    ///        API tracing layer's DDIs, once the layer has been loaded on demand
+    __zedlllocal ze_result_t ZE_APICALL
+    zesTracingLayerGetProcAddrTables(
+        ze_api_version_t version                       ///< [in] API version requested
+        )
+    {
+        ze_result_t result = ZE_RESULT_SUCCESS;
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetGlobalProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetGlobalProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Global );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetDeviceProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetDeviceProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Device );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetDriverProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetDriverProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Driver );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetDiagnosticsProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetDiagnosticsProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Diagnostics );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetEngineProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetEngineProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Engine );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetFabricPortProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetFabricPortProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.FabricPort );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetFanProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetFanProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Fan );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetFirmwareProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetFirmwareProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Firmware );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetFrequencyProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetFrequencyProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Frequency );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetLedProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetLedProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Led );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetMemoryProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetMemoryProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Memory );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetOverclockProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetOverclockProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Overclock );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetPerformanceFactorProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetPerformanceFactorProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.PerformanceFactor );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetPowerProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetPowerProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Power );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetPsuProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetPsuProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Psu );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetRasProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetRasProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Ras );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetRasExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetRasExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.RasExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetSchedulerProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetSchedulerProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Scheduler );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetStandbyProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetStandbyProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Standby );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetTemperatureProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zesGetTemperatureProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zes.Temperature );
+        }
+
+        return result;
+    }
+} // namespace loader
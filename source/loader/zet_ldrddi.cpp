@@ -29,6 +29,10 @@ namespace loader
         if( nullptr == pfnGetDebugInfo )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetDebugInfo( hModule, format, pSize, pDebugInfo );
+
         // convert loader handle to driver handle
         hModule = reinterpret_cast<zet_module_object_t*>( hModule )->handle;
 
@@ -54,6 +58,10 @@ namespace loader
         if( nullptr == pfnGetDebugProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetDebugProperties( hDevice, pDebugProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
@@ -80,6 +88,10 @@ namespace loader
         if( nullptr == pfnAttach )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAttach( hDevice, config, phDebug );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
@@ -118,6 +130,10 @@ namespace loader
         if( nullptr == pfnDetach )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDetach( hDebug );
+
         // convert loader handle to driver handle
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
@@ -156,6 +172,10 @@ namespace loader
         if( nullptr == pfnReadEvent )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnReadEvent( hDebug, timeout, event );
+
         // convert loader handle to driver handle
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
@@ -181,6 +201,10 @@ namespace loader
         if( nullptr == pfnAcknowledgeEvent )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAcknowledgeEvent( hDebug, event );
+
         // convert loader handle to driver handle
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
@@ -206,6 +230,10 @@ namespace loader
         if( nullptr == pfnInterrupt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnInterrupt( hDebug, thread );
+
         // convert loader handle to driver handle
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
@@ -231,6 +259,10 @@ namespace loader
         if( nullptr == pfnResume )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnResume( hDebug, thread );
+
         // convert loader handle to driver handle
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
@@ -259,6 +291,10 @@ namespace loader
         if( nullptr == pfnReadMemory )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnReadMemory( hDebug, thread, desc, size, buffer );
+
         // convert loader handle to driver handle
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
@@ -287,6 +323,10 @@ namespace loader
         if( nullptr == pfnWriteMemory )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnWriteMemory( hDebug, thread, desc, size, buffer );
+
         // convert loader handle to driver handle
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
@@ -321,6 +361,10 @@ namespace loader
         if( nullptr == pfnGetRegisterSetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetRegisterSetProperties( hDevice, pCount, pRegisterSetProperties );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
@@ -356,6 +400,10 @@ namespace loader
         if( nullptr == pfnGetThreadRegisterSetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetThreadRegisterSetProperties( hDebug, thread, pCount, pRegisterSetProperties );
+
         // convert loader handle to driver handle
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
@@ -389,6 +437,10 @@ namespace loader
         if( nullptr == pfnReadRegisters )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnReadRegisters( hDebug, thread, type, start, count, pRegisterValues );
+
         // convert loader handle to driver handle
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
@@ -422,6 +474,10 @@ namespace loader
         if( nullptr == pfnWriteRegisters )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnWriteRegisters( hDebug, thread, type, start, count, pRegisterValues );
+
         // convert loader handle to driver handle
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
@@ -455,6 +511,10 @@ namespace loader
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGet( hDevice, pCount, phMetricGroups );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
@@ -495,6 +555,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hMetricGroup, pProperties );
+
         // convert loader handle to driver handle
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
@@ -531,6 +595,10 @@ namespace loader
         if( nullptr == pfnCalculateMetricValues )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCalculateMetricValues( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
+
         // convert loader handle to driver handle
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
@@ -563,6 +631,10 @@ namespace loader
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGet( hMetricGroup, pCount, phMetrics );
+
         // convert loader handle to driver handle
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
@@ -603,6 +675,10 @@ namespace loader
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProperties( hMetric, pProperties );
+
         // convert loader handle to driver handle
         hMetric = reinterpret_cast<zet_metric_object_t*>( hMetric )->handle;
 
@@ -634,6 +710,10 @@ namespace loader
         if( nullptr == pfnActivateMetricGroups )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnActivateMetricGroups( hContext, hDevice, count, phMetricGroups );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<zet_context_object_t*>( hContext )->handle;
 
@@ -641,13 +721,12 @@ namespace loader
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
         // convert loader handles to driver handles
-        auto phMetricGroupsLocal = new zet_metric_group_handle_t [count];
+        handle_array_t<zet_metric_group_handle_t> phMetricGroupsLocal( count );
         for( size_t i = 0; ( nullptr != phMetricGroups ) && ( i < count ); ++i )
             phMetricGroupsLocal[ i ] = reinterpret_cast<zet_metric_group_object_t*>( phMetricGroups[ i ] )->handle;
 
         // forward to device-driver
         result = pfnActivateMetricGroups( hContext, hDevice, count, phMetricGroupsLocal );
-        delete []phMetricGroupsLocal;
 
         return result;
     }
@@ -672,6 +751,10 @@ namespace loader
         if( nullptr == pfnOpen )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<zet_context_object_t*>( hContext )->handle;
 
@@ -721,6 +804,10 @@ namespace loader
         if( nullptr == pfnAppendMetricStreamerMarker )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<zet_command_list_object_t*>( hCommandList )->handle;
 
@@ -748,6 +835,10 @@ namespace loader
         if( nullptr == pfnClose )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnClose( hMetricStreamer );
+
         // convert loader handle to driver handle
         hMetricStreamer = reinterpret_cast<zet_metric_streamer_object_t*>( hMetricStreamer )->handle;
 
@@ -789,6 +880,10 @@ namespace loader
         if( nullptr == pfnReadData )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnReadData( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
+
         // convert loader handle to driver handle
         hMetricStreamer = reinterpret_cast<zet_metric_streamer_object_t*>( hMetricStreamer )->handle;
 
@@ -817,6 +912,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<zet_context_object_t*>( hContext )->handle;
 
@@ -861,6 +960,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hMetricQueryPool );
+
         // convert loader handle to driver handle
         hMetricQueryPool = reinterpret_cast<zet_metric_query_pool_object_t*>( hMetricQueryPool )->handle;
 
@@ -893,6 +996,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hMetricQueryPool, index, phMetricQuery );
+
         // convert loader handle to driver handle
         hMetricQueryPool = reinterpret_cast<zet_metric_query_pool_object_t*>( hMetricQueryPool )->handle;
 
@@ -931,6 +1038,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hMetricQuery );
+
         // convert loader handle to driver handle
         hMetricQuery = reinterpret_cast<zet_metric_query_object_t*>( hMetricQuery )->handle;
 
@@ -961,6 +1072,10 @@ namespace loader
         if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnReset( hMetricQuery );
+
         // convert loader handle to driver handle
         hMetricQuery = reinterpret_cast<zet_metric_query_object_t*>( hMetricQuery )->handle;
 
@@ -986,6 +1101,10 @@ namespace loader
         if( nullptr == pfnAppendMetricQueryBegin )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendMetricQueryBegin( hCommandList, hMetricQuery );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<zet_command_list_object_t*>( hCommandList )->handle;
 
@@ -1017,6 +1136,10 @@ namespace loader
         if( nullptr == pfnAppendMetricQueryEnd )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<zet_command_list_object_t*>( hCommandList )->handle;
 
@@ -1027,13 +1150,12 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
         result = pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1053,6 +1175,10 @@ namespace loader
         if( nullptr == pfnAppendMetricMemoryBarrier )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAppendMetricMemoryBarrier( hCommandList );
+
         // convert loader handle to driver handle
         hCommandList = reinterpret_cast<zet_command_list_object_t*>( hCommandList )->handle;
 
@@ -1086,6 +1212,10 @@ namespace loader
         if( nullptr == pfnGetData )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetData( hMetricQuery, pRawDataSize, pRawData );
+
         // convert loader handle to driver handle
         hMetricQuery = reinterpret_cast<zet_metric_query_object_t*>( hMetricQuery )->handle;
 
@@ -1111,6 +1241,10 @@ namespace loader
         if( nullptr == pfnGetProfileInfo )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetProfileInfo( hKernel, pProfileProperties );
+
         // convert loader handle to driver handle
         hKernel = reinterpret_cast<zet_kernel_object_t*>( hKernel )->handle;
 
@@ -1137,6 +1271,10 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreate( hContext, desc, phTracer );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<zet_context_object_t*>( hContext )->handle;
 
@@ -1175,6 +1313,10 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroy( hTracer );
+
         // convert loader handle to driver handle
         hTracer = reinterpret_cast<zet_tracer_exp_object_t*>( hTracer )->handle;
 
@@ -1206,6 +1348,10 @@ namespace loader
         if( nullptr == pfnSetPrologues )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetPrologues( hTracer, pCoreCbs );
+
         // convert loader handle to driver handle
         hTracer = reinterpret_cast<zet_tracer_exp_object_t*>( hTracer )->handle;
 
@@ -1231,6 +1377,10 @@ namespace loader
         if( nullptr == pfnSetEpilogues )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetEpilogues( hTracer, pCoreCbs );
+
         // convert loader handle to driver handle
         hTracer = reinterpret_cast<zet_tracer_exp_object_t*>( hTracer )->handle;
 
@@ -1256,6 +1406,10 @@ namespace loader
         if( nullptr == pfnSetEnabled )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnSetEnabled( hTracer, enable );
+
         // convert loader handle to driver handle
         hTracer = reinterpret_cast<zet_tracer_exp_object_t*>( hTracer )->handle;
 
@@ -1288,6 +1442,10 @@ namespace loader
         if( nullptr == pfnGetConcurrentMetricGroupsExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetConcurrentMetricGroupsExp( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
@@ -1321,6 +1479,10 @@ namespace loader
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreateExp( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
+
         // convert loader handle to driver handle
         hContext = reinterpret_cast<zet_context_object_t*>( hContext )->handle;
 
@@ -1328,7 +1490,7 @@ namespace loader
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
         // convert loader handles to driver handles
-        auto phMetricGroupsLocal = new zet_metric_group_handle_t [metricGroupCount ];
+        handle_array_t<zet_metric_group_handle_t> phMetricGroupsLocal( metricGroupCount );
         for( size_t i = 0; ( nullptr != phMetricGroups ) && ( i < metricGroupCount  ); ++i )
             phMetricGroupsLocal[ i ] = reinterpret_cast<zet_metric_group_object_t*>( phMetricGroups[ i ] )->handle;
 
@@ -1337,7 +1499,6 @@ namespace loader
 
         // forward to device-driver
         result = pfnCreateExp( hContext, hDevice, metricGroupCount, phMetricGroupsLocal, desc, hNotificationEvent, phMetricTracer );
-        delete []phMetricGroupsLocal;
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1371,6 +1532,10 @@ namespace loader
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroyExp( hMetricTracer );
+
         // convert loader handle to driver handle
         hMetricTracer = reinterpret_cast<zet_metric_tracer_exp_object_t*>( hMetricTracer )->handle;
 
@@ -1400,6 +1565,10 @@ namespace loader
         if( nullptr == pfnEnableExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnEnableExp( hMetricTracer, synchronous );
+
         // convert loader handle to driver handle
         hMetricTracer = reinterpret_cast<zet_metric_tracer_exp_object_t*>( hMetricTracer )->handle;
 
@@ -1430,6 +1599,10 @@ namespace loader
         if( nullptr == pfnDisableExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDisableExp( hMetricTracer, synchronous );
+
         // convert loader handle to driver handle
         hMetricTracer = reinterpret_cast<zet_metric_tracer_exp_object_t*>( hMetricTracer )->handle;
 
@@ -1463,6 +1636,10 @@ namespace loader
         if( nullptr == pfnReadDataExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnReadDataExp( hMetricTracer, pRawDataSize, pRawData );
+
         // convert loader handle to driver handle
         hMetricTracer = reinterpret_cast<zet_metric_tracer_exp_object_t*>( hMetricTracer )->handle;
 
@@ -1488,6 +1665,10 @@ namespace loader
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreateExp( hMetricTracer, phMetricDecoder );
+
         // convert loader handle to driver handle
         hMetricTracer = reinterpret_cast<zet_metric_tracer_exp_object_t*>( hMetricTracer )->handle;
 
@@ -1526,6 +1707,10 @@ namespace loader
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroyExp( phMetricDecoder );
+
         // convert loader handle to driver handle
         phMetricDecoder = reinterpret_cast<zet_metric_decoder_exp_object_t*>( phMetricDecoder )->handle;
 
@@ -1561,6 +1746,10 @@ namespace loader
         if( nullptr == pfnGetDecodableMetricsExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetDecodableMetricsExp( hMetricDecoder, pCount, phMetrics );
+
         // convert loader handle to driver handle
         hMetricDecoder = reinterpret_cast<zet_metric_decoder_exp_object_t*>( hMetricDecoder )->handle;
 
@@ -1639,17 +1828,20 @@ namespace loader
         if( nullptr == pfnDecodeExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDecodeExp( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
+
         // convert loader handle to driver handle
         phMetricDecoder = reinterpret_cast<zet_metric_decoder_exp_object_t*>( phMetricDecoder )->handle;
 
         // convert loader handles to driver handles
-        auto phMetricsLocal = new zet_metric_handle_t [metricsCount];
+        handle_array_t<zet_metric_handle_t> phMetricsLocal( metricsCount );
         for( size_t i = 0; ( nullptr != phMetrics ) && ( i < metricsCount ); ++i )
             phMetricsLocal[ i ] = reinterpret_cast<zet_metric_object_t*>( phMetrics[ i ] )->handle;
 
         // forward to device-driver
         result = pfnDecodeExp( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetricsLocal, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
-        delete []phMetricsLocal;
 
         return result;
     }
@@ -1691,6 +1883,10 @@ namespace loader
         if( nullptr == pfnCalculateMultipleMetricValuesExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCalculateMultipleMetricValuesExp( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+
         // convert loader handle to driver handle
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
@@ -1718,6 +1914,10 @@ namespace loader
         if( nullptr == pfnGetGlobalTimestampsExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetGlobalTimestampsExp( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
+
         // convert loader handle to driver handle
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
@@ -1750,6 +1950,10 @@ namespace loader
         if( nullptr == pfnGetExportDataExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetExportDataExp( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
+
         // convert loader handle to driver handle
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
@@ -1797,6 +2001,10 @@ namespace loader
         if( nullptr == pfnCalculateMetricExportDataExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCalculateMetricExportDataExp( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+
         // convert loader handle to driver handle
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
@@ -1830,6 +2038,10 @@ namespace loader
         if( nullptr == pfnGetExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetExp( hDevice, pCount, phMetricProgrammables );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
@@ -1870,6 +2082,10 @@ namespace loader
         if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetPropertiesExp( hMetricProgrammable, pProperties );
+
         // convert loader handle to driver handle
         hMetricProgrammable = reinterpret_cast<zet_metric_programmable_exp_object_t*>( hMetricProgrammable )->handle;
 
@@ -1902,6 +2118,10 @@ namespace loader
         if( nullptr == pfnGetParamInfoExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetParamInfoExp( hMetricProgrammable, pParameterCount, pParameterInfo );
+
         // convert loader handle to driver handle
         hMetricProgrammable = reinterpret_cast<zet_metric_programmable_exp_object_t*>( hMetricProgrammable )->handle;
 
@@ -1935,6 +2155,10 @@ namespace loader
         if( nullptr == pfnGetParamValueInfoExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnGetParamValueInfoExp( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
+
         // convert loader handle to driver handle
         hMetricProgrammable = reinterpret_cast<zet_metric_programmable_exp_object_t*>( hMetricProgrammable )->handle;
 
@@ -1975,6 +2199,10 @@ namespace loader
         if( nullptr == pfnCreateFromProgrammableExp2 )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreateFromProgrammableExp2( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
+
         // convert loader handle to driver handle
         hMetricProgrammable = reinterpret_cast<zet_metric_programmable_exp_object_t*>( hMetricProgrammable )->handle;
 
@@ -2030,6 +2258,10 @@ namespace loader
         if( nullptr == pfnCreateFromProgrammableExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreateFromProgrammableExp( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
+
         // convert loader handle to driver handle
         hMetricProgrammable = reinterpret_cast<zet_metric_programmable_exp_object_t*>( hMetricProgrammable )->handle;
 
@@ -2088,6 +2320,10 @@ namespace loader
         if( nullptr == pfnCreateMetricGroupsFromMetricsExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreateMetricGroupsFromMetricsExp( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
@@ -2134,6 +2370,10 @@ namespace loader
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCreateExp( hDevice, pName, pDescription, samplingType, phMetricGroup );
+
         // convert loader handle to driver handle
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
@@ -2180,6 +2420,10 @@ namespace loader
         if( nullptr == pfnAddMetricExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnAddMetricExp( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
+
         // convert loader handle to driver handle
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
@@ -2208,6 +2452,10 @@ namespace loader
         if( nullptr == pfnRemoveMetricExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnRemoveMetricExp( hMetricGroup, hMetric );
+
         // convert loader handle to driver handle
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
@@ -2235,6 +2483,10 @@ namespace loader
         if( nullptr == pfnCloseExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnCloseExp( hMetricGroup );
+
         // convert loader handle to driver handle
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
@@ -2259,6 +2511,10 @@ namespace loader
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroyExp( hMetricGroup );
+
         // convert loader handle to driver handle
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
@@ -2283,6 +2539,10 @@ namespace loader
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // driver handles carry the loader's table, forward them untranslated
+        if( dditable->ddiHandles )
+            return pfnDestroyExp( hMetric );
+
         // convert loader handle to driver handle
         hMetric = reinterpret_cast<zet_metric_object_t*>( hMetric )->handle;
 
@@ -2335,6 +2595,8 @@ zetGetMetricDecoderExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.zet.MetricDecoderExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.MetricDecoderExp = drv.dditable.zet.MetricDecoderExp;
     }
 
 
@@ -2364,6 +2626,10 @@ zetGetMetricDecoderExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which passes them through untraced
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.MetricDecoderExp = *pDdiTable;
+
     return result;
 }
 
@@ -2404,6 +2670,8 @@ zetGetMetricProgrammableExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.zet.MetricProgrammableExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.MetricProgrammableExp = drv.dditable.zet.MetricProgrammableExp;
     }
 
 
@@ -2434,6 +2702,10 @@ zetGetMetricProgrammableExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which passes them through untraced
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.MetricProgrammableExp = *pDdiTable;
+
     return result;
 }
 
@@ -2474,6 +2746,8 @@ zetGetMetricTracerExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.zet.MetricTracerExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.MetricTracerExp = drv.dditable.zet.MetricTracerExp;
     }
 
 
@@ -2506,6 +2780,10 @@ zetGetMetricTracerExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which passes them through untraced
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.MetricTracerExp = *pDdiTable;
+
     return result;
 }
 
@@ -2551,6 +2829,8 @@ zetGetDeviceProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.Device = drv.dditable.zet.Device;
     }
 
     if(!atLeastOneDriverValid)
@@ -2582,6 +2862,23 @@ zetGetDeviceProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.Device = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetDeviceProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetDeviceProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.Device );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -2622,6 +2919,8 @@ zetGetDeviceExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.zet.DeviceExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.DeviceExp = drv.dditable.zet.DeviceExp;
     }
 
 
@@ -2650,6 +2949,10 @@ zetGetDeviceExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which passes them through untraced
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.DeviceExp = *pDdiTable;
+
     return result;
 }
 
@@ -2695,6 +2998,8 @@ zetGetContextProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.Context = drv.dditable.zet.Context;
     }
 
     if(!atLeastOneDriverValid)
@@ -2726,6 +3031,23 @@ zetGetContextProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.Context = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetContextProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetContextProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.Context );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -2771,6 +3093,8 @@ zetGetCommandListProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.CommandList = drv.dditable.zet.CommandList;
     }
 
     if(!atLeastOneDriverValid)
@@ -2805,6 +3129,23 @@ zetGetCommandListProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.CommandList = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetCommandListProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetCommandListProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.CommandList );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -2850,6 +3191,8 @@ zetGetKernelProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.Kernel = drv.dditable.zet.Kernel;
     }
 
     if(!atLeastOneDriverValid)
@@ -2881,6 +3224,23 @@ zetGetKernelProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.Kernel = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetKernelProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetKernelProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.Kernel );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -2926,6 +3286,8 @@ zetGetModuleProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.Module = drv.dditable.zet.Module;
     }
 
     if(!atLeastOneDriverValid)
@@ -2957,6 +3319,23 @@ zetGetModuleProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.Module = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetModuleProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetModuleProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.Module );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -3002,6 +3381,8 @@ zetGetDebugProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.Debug = drv.dditable.zet.Debug;
     }
 
     if(!atLeastOneDriverValid)
@@ -3044,6 +3425,23 @@ zetGetDebugProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.Debug = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetDebugProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetDebugProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.Debug );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -3089,6 +3487,8 @@ zetGetMetricProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.Metric = drv.dditable.zet.Metric;
     }
 
     if(!atLeastOneDriverValid)
@@ -3121,6 +3521,23 @@ zetGetMetricProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.Metric = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetMetricProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.Metric );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -3161,6 +3578,8 @@ zetGetMetricExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.zet.MetricExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.MetricExp = drv.dditable.zet.MetricExp;
     }
 
 
@@ -3190,6 +3609,10 @@ zetGetMetricExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which passes them through untraced
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.MetricExp = *pDdiTable;
+
     return result;
 }
 
@@ -3235,6 +3658,8 @@ zetGetMetricGroupProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.MetricGroup = drv.dditable.zet.MetricGroup;
     }
 
     if(!atLeastOneDriverValid)
@@ -3268,6 +3693,23 @@ zetGetMetricGroupProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.MetricGroup = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricGroupProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetMetricGroupProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.MetricGroup );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -3308,6 +3750,8 @@ zetGetMetricGroupExpProcAddrTable(
         if(!getTable) 
             continue; 
         result = getTable( version, &drv.dditable.zet.MetricGroupExp);
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.MetricGroupExp = drv.dditable.zet.MetricGroupExp;
     }
 
 
@@ -3343,6 +3787,23 @@ zetGetMetricGroupExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.MetricGroupExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricGroupExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetMetricGroupExpProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.MetricGroupExp );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -3388,6 +3849,8 @@ zetGetMetricQueryProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.MetricQuery = drv.dditable.zet.MetricQuery;
     }
 
     if(!atLeastOneDriverValid)
@@ -3422,6 +3885,23 @@ zetGetMetricQueryProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.MetricQuery = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricQueryProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetMetricQueryProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.MetricQuery );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -3467,6 +3947,8 @@ zetGetMetricQueryPoolProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.MetricQueryPool = drv.dditable.zet.MetricQueryPool;
     }
 
     if(!atLeastOneDriverValid)
@@ -3499,6 +3981,23 @@ zetGetMetricQueryPoolProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.MetricQueryPool = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricQueryPoolProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetMetricQueryPoolProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.MetricQueryPool );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -3544,6 +4043,8 @@ zetGetMetricStreamerProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.MetricStreamer = drv.dditable.zet.MetricStreamer;
     }
 
     if(!atLeastOneDriverValid)
@@ -3577,6 +4078,23 @@ zetGetMetricStreamerProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.MetricStreamer = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricStreamerProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetMetricStreamerProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.MetricStreamer );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -3622,6 +4140,8 @@ zetGetTracerExpProcAddrTable(
             atLeastOneDriverValid = true;
         else
             drv.initStatus = getTableResult;
+        if( drv.ddiHandlesTable )
+            drv.ddiHandlesTable->zet.TracerExp = drv.dditable.zet.TracerExp;
     }
 
     if(!atLeastOneDriverValid)
@@ -3657,6 +4177,23 @@ zetGetTracerExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
+    // Keep the loader's DDIs for the API tracing layer, which intercepts them once loaded
+    if( ZE_RESULT_SUCCESS == result )
+        loader::context->tracing_dditable.zet.TracerExp = *pDdiTable;
+
+    // If the API tracing layer is loaded, then intercept the loader's DDIs
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetTracerExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetTracerExpProcAddrTable") );
+        if(!getTable)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        result = getTable( version, &loader::context->tracing_dditable.zet.TracerExp );
+        if ( loader::context->tracingLayerEnabled ) {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
     return result;
 }
 
@@ -3664,3 +4201,136 @@ zetGetTracerExpProcAddrTable(
 #if defined(__cplusplus)
 };
 #endif
+
+namespace loader
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercepts the loader's DDIs kept in tracing_dditable with the
+    ///        API tracing layer's DDIs, once the layer has been loaded on demand
+    __zedlllocal ze_result_t ZE_APICALL
+    zetTracingLayerGetProcAddrTables(
+        ze_api_version_t version                       ///< [in] API version requested
+        )
+    {
+        ze_result_t result = ZE_RESULT_SUCCESS;
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetDeviceProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetDeviceProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.Device );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetContextProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetContextProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.Context );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetCommandListProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetCommandListProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.CommandList );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetKernelProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetKernelProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.Kernel );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetModuleProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetModuleProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.Module );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetDebugProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetDebugProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.Debug );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetMetricProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetMetricProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.Metric );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetMetricGroupProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetMetricGroupProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.MetricGroup );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetMetricGroupExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetMetricGroupExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.MetricGroupExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetMetricQueryProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetMetricQueryProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.MetricQuery );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetMetricQueryPoolProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetMetricQueryPoolProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.MetricQueryPool );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetMetricStreamerProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetMetricStreamerProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.MetricStreamer );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetTracerExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(loader::context->tracingLayer, "zetGetTracerExpProcAddrTable") );
+            if(!getTable)
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( version, &loader::context->tracing_dditable.zet.TracerExp );
+        }
+
+        return result;
+    }
+} // namespace loader
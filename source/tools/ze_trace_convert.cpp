@@ -0,0 +1,579 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ze_trace_convert.cpp
+ *
+ * Converts a trace recorded with ZEL_TRACE_RECORD into Chrome Trace Event
+ * JSON or into a Perfetto protobuf trace.  Every recording thread gets its
+ * own track, and the events signaled by zeCommandListAppend* calls are
+ * linked by flow arrows to the zeCommandListAppend* calls waiting on them.
+ *
+ * The trace is streamed: only a short window of records, kept to put the
+ * records of different threads back into time order, and the events
+ * currently signaled are held in memory.
+ */
+
+#include "layers/zel_tracing_record.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+enum class ArgKind { Value, Handle, HandleArray };
+
+struct ApiDesc {
+    std::string name;
+    std::vector<std::string> argNames;
+    std::vector<ArgKind> argKinds;
+    bool append = false;       // zeCommandListAppend*, whose events get flows
+    int signalArg = -1;        // event signaled when the appended command completes
+    int waitArg = -1;          // first of the events waited on
+};
+
+//
+// Reads the header, the API descriptions and then the records of a
+// trace, a block of records at a time.
+//
+class TraceReader {
+  public:
+    ~TraceReader() {
+        if (file != nullptr)
+            fclose(file);
+    }
+
+    bool open(const char *path) {
+        file = fopen(path, "rb");
+        if (file == nullptr) {
+            std::cerr << "cannot open " << path << std::endl;
+            return false;
+        }
+        if (fread(&header, sizeof(header), 1, file) != 1 ||
+            memcmp(header.magic, ZEL_API_RECORD_MAGIC, sizeof(header.magic)) != 0) {
+            std::cerr << path << " is not a ZEL_TRACE_RECORD trace" << std::endl;
+            return false;
+        }
+        if (header.version != ZEL_API_RECORD_VERSION ||
+            header.recordSize != sizeof(zel_api_record_t) ||
+            header.argCount != ZEL_API_RECORD_ARG_COUNT) {
+            std::cerr << path << " has unsupported trace version " << header.version << std::endl;
+            return false;
+        }
+        for (uint32_t i = 0; i < header.apiCount; i++) {
+            if (!readApiDesc()) {
+                std::cerr << path << " is truncated" << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Returns false at the end of the trace.
+    bool next(zel_api_record_t &record) {
+        if (current == records.size()) {
+            records.resize(recordsPerRead);
+            size_t count = ended ? 0 : fread(records.data(), sizeof(zel_api_record_t), recordsPerRead, file);
+            records.resize(count);
+            current = 0;
+            if (count == 0)
+                return false;
+        }
+        record = records[current++];
+        // the rest of a file still being recorded is zeroed
+        if (record.begin == 0) {
+            ended = true;
+            records.clear();
+            current = 0;
+            return false;
+        }
+        return true;
+    }
+
+    const ApiDesc *api(uint32_t id) const {
+        auto it = apis.find(id);
+        return it == apis.end() ? nullptr : &it->second;
+    }
+
+    zel_api_record_header_t header = {};
+
+  private:
+    static const size_t recordsPerRead = 4096;
+
+    bool readApiDesc() {
+        zel_api_record_api_desc_t desc;
+        if (fread(&desc, sizeof(desc), 1, file) != 1)
+            return false;
+        size_t size = desc.nameSize + desc.argNamesSize;
+        std::string text(size + (8 - size % 8) % 8, '\0');
+        if (!text.empty() && fread(&text[0], text.size(), 1, file) != 1)
+            return false;
+
+        ApiDesc &api = apis[desc.api];
+        api.name = text.substr(0, desc.nameSize);
+        api.append = api.name.compare(0, 19, "zeCommandListAppend") == 0;
+        std::string argNames = text.substr(desc.nameSize, desc.argNamesSize);
+        for (size_t begin = 0; begin < argNames.size();) {
+            size_t end = argNames.find(',', begin);
+            if (end == std::string::npos)
+                end = argNames.size();
+            api.argNames.push_back(argNames.substr(begin, end - begin));
+            begin = end + 1;
+        }
+        for (size_t i = 0; i < api.argNames.size(); i++) {
+            const std::string &name = api.argNames[i];
+            if (name.compare(0, 2, "ph") == 0) {
+                api.argKinds.push_back(ArgKind::HandleArray);
+                if (name == "phWaitEvents" || name == "phEvents")
+                    api.waitArg = static_cast<int>(i);
+            } else if (name[0] == 'h') {
+                api.argKinds.push_back(ArgKind::Handle);
+                if (name == "hSignalEvent" || (name == "hEvent" && api.name == "zeCommandListAppendSignalEvent"))
+                    api.signalArg = static_cast<int>(i);
+            } else {
+                api.argKinds.push_back(ArgKind::Value);
+            }
+        }
+        return true;
+    }
+
+    FILE *file = nullptr;
+    std::unordered_map<uint32_t, ApiDesc> apis;
+    std::vector<zel_api_record_t> records;
+    size_t current = 0;
+    bool ended = false;
+};
+
+// The call which last signaled an event.
+struct SignaledEvent {
+    uint32_t thread;
+    uint64_t begin;
+    uint64_t flow;
+    bool waited;
+};
+
+// A flow from the call signaling an event into a call waiting on it.
+struct WaitFlow {
+    const SignaledEvent *signal;
+    bool firstWait;
+};
+
+//
+// Visits the arguments of a record: a single argument is passed as an
+// array of one, the events of an array argument take the remaining args.
+//
+template <typename TVisitor>
+void forEachArg(const ApiDesc &api, const zel_api_record_t &record, TVisitor visit) {
+    for (uint32_t i = 0; i < api.argNames.size() && i < record.argCount; i++) {
+        uint32_t count = api.argKinds[i] == ArgKind::HandleArray ? record.argCount - i : 1;
+        visit(i, &record.args[i], count);
+    }
+}
+
+class TraceWriter {
+  public:
+    virtual ~TraceWriter() = default;
+    virtual void begin(const zel_api_record_header_t &header) = 0;
+    virtual void thread(uint32_t thread) = 0;
+    virtual void call(const zel_api_record_t &record, const ApiDesc &api,
+                      uint64_t signalFlow, const std::vector<WaitFlow> &waits) = 0;
+    virtual void dropped(const zel_api_record_t &record) = 0;
+    virtual void end() = 0;
+};
+
+//
+// Chrome Trace Event JSON, loaded by chrome://tracing and ui.perfetto.dev.
+// Every waiting call gets its own arrow from the signaling call.
+//
+class JsonWriter : public TraceWriter {
+  public:
+    explicit JsonWriter(FILE *out) : out(out) {}
+
+    void begin(const zel_api_record_header_t &header) override {
+        startTime = header.startTime;
+        fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+                     "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":1,\"args\":{\"name\":\"Level Zero API\"}}");
+    }
+
+    void thread(uint32_t thread) override {
+        fprintf(out, ",\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"thread %u\"}}",
+                thread + 1, thread);
+    }
+
+    void call(const zel_api_record_t &record, const ApiDesc &api,
+              uint64_t, const std::vector<WaitFlow> &waits) override {
+        fprintf(out, ",\n{\"ph\":\"X\",\"cat\":\"api\",\"name\":\"%s\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,"
+                     "\"args\":{\"result\":\"0x%x\"",
+                api.name.c_str(), record.thread + 1, timestamp(record.begin),
+                (record.end - record.begin) / 1000.0, static_cast<uint32_t>(record.result));
+        forEachArg(api, record, [&](uint32_t i, const uint64_t *args, uint32_t count) {
+            fprintf(out, ",\"%s\":", api.argNames[i].c_str());
+            if (api.argKinds[i] == ArgKind::Value) {
+                fprintf(out, "%" PRIu64, args[0]);
+            } else if (api.argKinds[i] == ArgKind::Handle) {
+                fprintf(out, "\"0x%" PRIx64 "\"", args[0]);
+            } else {
+                for (uint32_t j = 0; j < count; j++)
+                    fprintf(out, "%s\"0x%" PRIx64 "\"", j == 0 ? "[" : ",", args[j]);
+                fprintf(out, "]");
+            }
+        });
+        fprintf(out, "}}");
+
+        for (auto &wait : waits) {
+            uint64_t flow = ++flows;
+            fprintf(out, ",\n{\"ph\":\"s\",\"cat\":\"event\",\"name\":\"event\",\"id\":%" PRIu64 ",\"pid\":1,\"tid\":%u,\"ts\":%.3f}",
+                    flow, wait.signal->thread + 1, timestamp(wait.signal->begin));
+            fprintf(out, ",\n{\"ph\":\"f\",\"bp\":\"e\",\"cat\":\"event\",\"name\":\"event\",\"id\":%" PRIu64 ",\"pid\":1,\"tid\":%u,\"ts\":%.3f}",
+                    flow, record.thread + 1, timestamp(record.begin));
+        }
+    }
+
+    void dropped(const zel_api_record_t &record) override {
+        fprintf(out, ",\n{\"ph\":\"i\",\"s\":\"t\",\"name\":\"dropped records\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,"
+                     "\"args\":{\"count\":%" PRIu64 "}}",
+                record.thread + 1, timestamp(record.begin), record.args[0]);
+    }
+
+    void end() override { fprintf(out, "\n]}\n"); }
+
+  private:
+    // microseconds since recording started
+    double timestamp(uint64_t time) const {
+        return static_cast<double>(static_cast<int64_t>(time - startTime)) / 1000.0;
+    }
+
+    FILE *out;
+    uint64_t startTime = 0;
+    uint64_t flows = 0;
+};
+
+// Protobuf wire format encoding of a message.
+class ProtoMessage {
+  public:
+    void varint(uint32_t field, uint64_t value) {
+        key(field, 0);
+        putVarint(value);
+    }
+    void fixed64(uint32_t field, uint64_t value) {
+        key(field, 1);
+        for (int i = 0; i < 8; i++)
+            data.push_back(static_cast<char>(value >> (8 * i)));
+    }
+    void bytes(uint32_t field, const std::string &value) {
+        key(field, 2);
+        putVarint(value.size());
+        data += value;
+    }
+    void message(uint32_t field, const ProtoMessage &value) { bytes(field, value.data); }
+
+    std::string data;
+
+  private:
+    void key(uint32_t field, uint32_t wireType) { putVarint((static_cast<uint64_t>(field) << 3) | wireType); }
+    void putVarint(uint64_t value) {
+        while (value >= 0x80) {
+            data.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        data.push_back(static_cast<char>(value));
+    }
+};
+
+//
+// Perfetto trace of TrackEvent slices, one packet sequence and track per
+// thread.  A flow can only end once in Perfetto, so the call signaling an
+// event is linked to the first call waiting on it.
+//
+class PerfettoWriter : public TraceWriter {
+  public:
+    explicit PerfettoWriter(FILE *out) : out(out) {}
+
+    void begin(const zel_api_record_header_t &) override {
+        ProtoMessage process;
+        process.varint(ProcessDescriptorPid, 1);
+        process.bytes(ProcessDescriptorName, "Level Zero API");
+        ProtoMessage track;
+        track.varint(TrackDescriptorUuid, processUuid);
+        track.message(TrackDescriptorProcess, process);
+        ProtoMessage packet;
+        packet.varint(PacketSequenceId, processUuid);
+        packet.message(PacketTrackDescriptor, track);
+        write(packet);
+    }
+
+    void thread(uint32_t thread) override {
+        ProtoMessage descriptor;
+        descriptor.varint(ThreadDescriptorPid, 1);
+        descriptor.varint(ThreadDescriptorTid, thread + 1);
+        descriptor.bytes(ThreadDescriptorName, "thread " + std::to_string(thread));
+        ProtoMessage track;
+        track.varint(TrackDescriptorUuid, threadUuid(thread));
+        track.varint(TrackDescriptorParentUuid, processUuid);
+        track.message(TrackDescriptorThread, descriptor);
+        ProtoMessage packet;
+        packet.varint(PacketSequenceId, threadUuid(thread));
+        packet.message(PacketTrackDescriptor, track);
+        write(packet);
+    }
+
+    void call(const zel_api_record_t &record, const ApiDesc &api,
+              uint64_t signalFlow, const std::vector<WaitFlow> &waits) override {
+        ProtoMessage event;
+        event.varint(TrackEventType, SliceBegin);
+        event.varint(TrackEventTrackUuid, threadUuid(record.thread));
+        event.bytes(TrackEventName, api.name);
+        char text[32];
+        snprintf(text, sizeof(text), "0x%x", static_cast<uint32_t>(record.result));
+        annotate(event, "result", AnnotationString, 0, text);
+        forEachArg(api, record, [&](uint32_t i, const uint64_t *args, uint32_t count) {
+            if (api.argKinds[i] == ArgKind::HandleArray) {
+                for (uint32_t j = 0; j < count; j++)
+                    annotate(event, api.argNames[i] + "[" + std::to_string(j) + "]", AnnotationPointer, args[j]);
+            } else {
+                annotate(event, api.argNames[i],
+                         api.argKinds[i] == ArgKind::Handle ? AnnotationPointer : AnnotationUint, args[0]);
+            }
+        });
+        if (signalFlow != 0)
+            event.fixed64(TrackEventFlowIds, signalFlow);
+        for (auto &wait : waits) {
+            if (wait.firstWait)
+                event.fixed64(TrackEventTerminatingFlowIds, wait.signal->flow);
+        }
+        writeEvent(record.thread, record.begin, event);
+
+        ProtoMessage endEvent;
+        endEvent.varint(TrackEventType, SliceEnd);
+        endEvent.varint(TrackEventTrackUuid, threadUuid(record.thread));
+        writeEvent(record.thread, record.end, endEvent);
+    }
+
+    void dropped(const zel_api_record_t &record) override {
+        ProtoMessage event;
+        event.varint(TrackEventType, Instant);
+        event.varint(TrackEventTrackUuid, threadUuid(record.thread));
+        event.bytes(TrackEventName, "dropped records");
+        annotate(event, "count", AnnotationUint, record.args[0]);
+        writeEvent(record.thread, record.begin, event);
+    }
+
+    void end() override {}
+
+  private:
+    // field numbers of perfetto/trace/trace_packet.proto and the messages it uses
+    enum {
+        TracePacket = 1,
+        PacketTimestamp = 8,
+        PacketSequenceId = 10,
+        PacketTrackEvent = 11,
+        PacketTrackDescriptor = 60,
+        TrackDescriptorUuid = 1,
+        TrackDescriptorProcess = 3,
+        TrackDescriptorThread = 4,
+        TrackDescriptorParentUuid = 5,
+        ProcessDescriptorPid = 1,
+        ProcessDescriptorName = 6,
+        ThreadDescriptorPid = 1,
+        ThreadDescriptorTid = 2,
+        ThreadDescriptorName = 5,
+        TrackEventAnnotations = 4,
+        TrackEventType = 9,
+        TrackEventTrackUuid = 11,
+        TrackEventName = 23,
+        TrackEventFlowIds = 47,
+        TrackEventTerminatingFlowIds = 48,
+        AnnotationUint = 3,
+        AnnotationString = 6,
+        AnnotationPointer = 7,
+        AnnotationName = 10,
+        SliceBegin = 1,
+        SliceEnd = 2,
+        Instant = 3,
+    };
+
+    static const uint64_t processUuid = 1;
+    static uint64_t threadUuid(uint32_t thread) { return processUuid + 1 + thread; }
+
+    static void annotate(ProtoMessage &event, const std::string &name, uint32_t field,
+                         uint64_t value, const char *text = nullptr) {
+        ProtoMessage annotation;
+        annotation.bytes(AnnotationName, name);
+        if (text != nullptr)
+            annotation.bytes(field, text);
+        else
+            annotation.varint(field, value);
+        event.message(TrackEventAnnotations, annotation);
+    }
+
+    void writeEvent(uint32_t thread, uint64_t time, const ProtoMessage &event) {
+        ProtoMessage packet;
+        packet.varint(PacketTimestamp, time);
+        packet.varint(PacketSequenceId, threadUuid(thread));
+        packet.message(PacketTrackEvent, event);
+        write(packet);
+    }
+
+    void write(const ProtoMessage &packet) {
+        ProtoMessage trace;
+        trace.message(TracePacket, packet);
+        fwrite(trace.data.data(), 1, trace.data.size(), out);
+    }
+
+    FILE *out;
+};
+
+// A record waiting in the reorder window, ordered by begin time.
+struct PendingRecord {
+    zel_api_record_t record;
+    uint64_t sequence;
+
+    bool operator>(const PendingRecord &other) const {
+        return record.begin != other.record.begin ? record.begin > other.record.begin
+                                                  : sequence > other.sequence;
+    }
+};
+
+class TraceConverter {
+  public:
+    explicit TraceConverter(TraceWriter &writer) : writer(writer) {}
+
+    //
+    // Records of different threads are interleaved in the order they were
+    // flushed, so records are only converted once a record beginning
+    // window ns later has been read.
+    //
+    void convert(TraceReader &reader, uint64_t window) {
+        writer.begin(reader.header);
+        zel_api_record_t record;
+        uint64_t sequence = 0;
+        uint64_t latest = 0;
+        while (reader.next(record)) {
+            latest = std::max(latest, record.begin);
+            pending.push({record, sequence++});
+            while (pending.top().record.begin + window < latest) {
+                convertRecord(reader, pending.top().record);
+                pending.pop();
+            }
+        }
+        while (!pending.empty()) {
+            convertRecord(reader, pending.top().record);
+            pending.pop();
+        }
+        writer.end();
+    }
+
+  private:
+    void convertRecord(const TraceReader &reader, const zel_api_record_t &record) {
+        if (threads.insert(record.thread).second)
+            writer.thread(record.thread);
+
+        if (record.api == ZEL_API_RECORD_DROPPED) {
+            writer.dropped(record);
+            return;
+        }
+        const ApiDesc *api = reader.api(record.api);
+        if (api == nullptr)
+            return;
+
+        waits.clear();
+        uint64_t signalFlow = 0;
+        if (api->append && record.result == 0) {
+            for (int i = api->waitArg; i >= 0 && static_cast<uint32_t>(i) < record.argCount; i++) {
+                auto it = signaledEvents.find(record.args[i]);
+                if (it != signaledEvents.end()) {
+                    waits.push_back({&it->second, !it->second.waited});
+                    it->second.waited = true;
+                }
+            }
+            if (api->signalArg >= 0 && static_cast<uint32_t>(api->signalArg) < record.argCount &&
+                record.args[api->signalArg] != 0) {
+                signalFlow = ++flows;
+            }
+        }
+        writer.call(record, *api, signalFlow, waits);
+
+        if (signalFlow != 0) {
+            signaledEvents[record.args[api->signalArg]] = {record.thread, record.begin, signalFlow, false};
+        } else if (api->name == "zeEventDestroy" && record.argCount > 0) {
+            signaledEvents.erase(record.args[0]);
+        }
+    }
+
+    TraceWriter &writer;
+    std::priority_queue<PendingRecord, std::vector<PendingRecord>, std::greater<PendingRecord>> pending;
+    std::unordered_set<uint32_t> threads;
+    std::unordered_map<uint64_t, SignaledEvent> signaledEvents;
+    std::vector<WaitFlow> waits;
+    uint64_t flows = 0;
+};
+
+bool endsWith(const std::string &str, const std::string &suffix) {
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+int usage() {
+    std::cerr << "usage: ze_trace_convert [--format json|perfetto] [--window-ms <ms>] <trace> <output>\n"
+                 "  converts a trace recorded with ZEL_TRACE_RECORD; the format defaults to perfetto\n"
+                 "  for outputs named *.pftrace or *.perfetto-trace and to json otherwise\n";
+    return 1;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    std::string format;
+    uint64_t windowMs = 100;
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if ((arg == "--format" || arg == "-f") && i + 1 < argc) {
+            format = argv[++i];
+        } else if (arg == "--window-ms" && i + 1 < argc) {
+            windowMs = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg.size() > 1 && arg[0] == '-') {
+            return usage();
+        } else {
+            paths.push_back(arg);
+        }
+    }
+    if (paths.size() != 2)
+        return usage();
+    if (format.empty())
+        format = endsWith(paths[1], ".pftrace") || endsWith(paths[1], ".perfetto-trace") ? "perfetto" : "json";
+    if (format != "json" && format != "perfetto")
+        return usage();
+
+    TraceReader reader;
+    if (!reader.open(paths[0].c_str()))
+        return 1;
+
+    FILE *out = fopen(paths[1].c_str(), format == "json" ? "w" : "wb");
+    if (out == nullptr) {
+        std::cerr << "cannot open " << paths[1] << std::endl;
+        return 1;
+    }
+    static char buffer[1 << 20];
+    setvbuf(out, buffer, _IOFBF, sizeof(buffer));
+
+    JsonWriter json(out);
+    PerfettoWriter perfetto(out);
+    TraceWriter &writer = format == "json" ? static_cast<TraceWriter &>(json) : perfetto;
+    TraceConverter(writer).convert(reader, windowMs * 1000000);
+
+    if (fclose(out) != 0) {
+        std::cerr << "cannot write " << paths[1] << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -9,7 +9,26 @@
 #include "gtest/gtest.h"
 
 #include "loader/ze_loader.h"
+#include "layers/zel_tracing_api.h"
+#include "layers/zel_tracing_record.h"
+#include "layers/zel_tracing_register_cb.h"
 #include "ze_api.h"
+#include "zes_api.h"
+#include "zet_api.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 #if defined(_WIN32)
     #define putenv_safe _putenv
@@ -19,6 +38,17 @@
 
 namespace {
 
+// Initialize, and create a context on the first device of the first driver.
+void createTestContext(ze_driver_handle_t &driver, ze_device_handle_t &device, ze_context_handle_t &context) {
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  uint32_t count = 1;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&count, &driver));
+  count = 1;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(driver, &count, &device));
+  ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &context));
+}
+
 TEST(
     LoaderAPI,
     GivenLevelZeroLoaderPresentWhenCallingzeGetLoaderVersionsAPIThenValidVersionIsReturned) {
@@ -199,4 +229,1258 @@ TEST(
   EXPECT_GT(pCount, 0);
 }
 
+TEST(
+    LoaderTranslateHandles,
+    GivenManyEventsCreatedAndDestroyedWhenTranslatingLiveEventsThenDriverHandlesAreUnchanged) {
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+  ze_event_pool_handle_t eventPool = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolCreate(context, &eventPoolDesc, 0, nullptr, &eventPool));
+
+  const size_t numEvents = 4096;
+  std::vector<ze_event_handle_t> events(numEvents);
+  std::vector<void *> driverEvents(numEvents);
+  ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+  for (size_t i = 0; i < numEvents; ++i) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventCreate(eventPool, &eventDesc, &events[i]));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelLoaderTranslateHandle(ZEL_HANDLE_EVENT, events[i], &driverEvents[i]));
+  }
+
+  // release every other event and recreate them, reusing the released slots
+  for (size_t i = 0; i < numEvents; i += 2) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventDestroy(events[i]));
+  }
+  for (size_t i = 0; i < numEvents; i += 2) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventCreate(eventPool, &eventDesc, &events[i]));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelLoaderTranslateHandle(ZEL_HANDLE_EVENT, events[i], &driverEvents[i]));
+  }
+
+  std::set<ze_event_handle_t> uniqueEvents(events.begin(), events.end());
+  EXPECT_EQ(numEvents, uniqueEvents.size());
+  for (size_t i = 0; i < numEvents; ++i) {
+    void *driverEvent = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelLoaderTranslateHandle(ZEL_HANDLE_EVENT, events[i], &driverEvent));
+    EXPECT_EQ(driverEvents[i], driverEvent);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventDestroy(events[i]));
+  }
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolDestroy(eventPool));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+
+TEST(
+    LoaderTranslateHandles,
+    GivenManyImagesAndSamplersWhenSettingThemAsKernelArgumentsThenCallsSucceed) {
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+  ze_module_handle_t module = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeModuleCreate(context, device, &moduleDesc, &module, nullptr));
+  ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+  ze_kernel_handle_t kernel = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeKernelCreate(module, &kernelDesc, &kernel));
+
+  // enough objects to span several slabs of the image and sampler factories
+  const size_t numObjects = 2048;
+  std::vector<ze_image_handle_t> images(numObjects);
+  std::vector<ze_sampler_handle_t> samplers(numObjects);
+  ze_image_desc_t imageDesc = {ZE_STRUCTURE_TYPE_IMAGE_DESC};
+  ze_sampler_desc_t samplerDesc = {ZE_STRUCTURE_TYPE_SAMPLER_DESC};
+  for (size_t i = 0; i < numObjects; ++i) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeImageCreate(context, device, &imageDesc, &images[i]));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeSamplerCreate(context, device, &samplerDesc, &samplers[i]));
+  }
+  for (size_t i = 0; i < numObjects; ++i) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeKernelSetArgumentValue(kernel, 0, sizeof(images[i]), &images[i]));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeKernelSetArgumentValue(kernel, 1, sizeof(samplers[i]), &samplers[i]));
+  }
+  uint32_t scalar = 7;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeKernelSetArgumentValue(kernel, 2, sizeof(scalar), &scalar));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeKernelSetArgumentValue(kernel, 3, sizeof(void *), nullptr));
+
+  for (size_t i = 0; i < numObjects; ++i) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeImageDestroy(images[i]));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeSamplerDestroy(samplers[i]));
+  }
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeKernelDestroy(kernel));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeModuleDestroy(module));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+TEST(
+    LoaderDdiHandles,
+    GivenDriverStoringLoaderTableInHandlesWhenCallingApisThenHandlesAreForwardedUntranslated) {
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  void *driverHandle = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelLoaderTranslateHandle(ZEL_HANDLE_DRIVER, driver, &driverHandle));
+  EXPECT_EQ(driver, driverHandle);
+
+  ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+  ze_event_pool_handle_t eventPool = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolCreate(context, &eventPoolDesc, 0, nullptr, &eventPool));
+  ze_command_list_desc_t commandListDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+  ze_command_list_handle_t commandList = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &commandListDesc, &commandList));
+
+  const size_t numEvents = 32;
+  std::vector<ze_event_handle_t> events(numEvents);
+  ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+  for (size_t i = 0; i < numEvents; ++i) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventCreate(eventPool, &eventDesc, &events[i]));
+    void *driverEvent = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelLoaderTranslateHandle(ZEL_HANDLE_EVENT, events[i], &driverEvent));
+    EXPECT_EQ(events[i], driverEvent);
+  }
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendWaitOnEvents(commandList, numEvents, events.data()));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListClose(commandList));
+
+  for (size_t i = 0; i < numEvents; ++i) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventDestroy(events[i]));
+  }
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolDestroy(eventPool));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+
+TEST(
+    LoaderEnumerationCache,
+    GivenDriversAndDevicesEnumeratedWhenEnumeratingAgainThenSameHandlesAreReturned) {
+
+  uint32_t driverCount = 0;
+  ze_init_driver_type_desc_t desc = {ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC};
+  desc.flags = UINT32_MAX;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&driverCount, nullptr, &desc));
+
+  driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, nullptr));
+  EXPECT_GT(driverCount, 0);
+  std::vector<ze_driver_handle_t> drivers(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, drivers.data()));
+
+  std::vector<ze_driver_handle_t> driversAgain(driverCount + 1);
+  uint32_t driverCountAgain = driverCount + 1;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCountAgain, driversAgain.data()));
+  EXPECT_EQ(driverCount, driverCountAgain);
+  for (uint32_t i = 0; i < driverCount; ++i) {
+    EXPECT_EQ(drivers[i], driversAgain[i]);
+  }
+
+  uint32_t deviceCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, nullptr));
+  EXPECT_GT(deviceCount, 0);
+  std::vector<ze_device_handle_t> devices(deviceCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, devices.data()));
+  for (int repeat = 0; repeat < 4; ++repeat) {
+    std::vector<ze_device_handle_t> devicesAgain(deviceCount);
+    uint32_t deviceCountAgain = deviceCount;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCountAgain, devicesAgain.data()));
+    EXPECT_EQ(deviceCount, deviceCountAgain);
+    EXPECT_EQ(devices, devicesAgain);
+  }
+
+  // other driver types may report other drivers, so the drivers are enumerated again
+  desc.flags = ZE_INIT_DRIVER_TYPE_FLAG_GPU;
+  driverCountAgain = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&driverCountAgain, nullptr, &desc));
+  driverCountAgain = driverCount;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCountAgain, driversAgain.data()));
+  EXPECT_EQ(driverCount, driverCountAgain);
+}
+
+TEST(
+    LoaderTracingLayer,
+    GivenTracingLayerNotEnabledAtInitWhenEnablingItFromSeveralThreadsThenTheLayerIsLoadedAndCallbacksAreCalled) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  uint32_t driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, nullptr));
+  EXPECT_GT(driverCount, 0);
+  std::vector<ze_driver_handle_t> drivers(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, drivers.data()));
+
+  std::atomic<uint32_t> prologueCount{0};
+  zel_tracer_desc_t tracerDesc = {ZEL_STRUCTURE_TYPE_TRACER_DESC, nullptr, &prologueCount};
+  zel_tracer_handle_t tracer = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerCreate(&tracerDesc, &tracer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerContextCreateRegisterCallback(tracer, ZEL_REGISTER_PROLOGUE,
+      [](ze_context_create_params_t *, ze_result_t, void *pTracerUserData, void **) {
+        ++*static_cast<std::atomic<uint32_t> *>(pTracerUserData);
+      }));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, true));
+
+  std::vector<std::thread> threads;
+  std::atomic<uint32_t> failures{0};
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&failures]() {
+      if (ZE_RESULT_SUCCESS != zelEnableTracingLayer())
+        ++failures;
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(0u, failures);
+
+  ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+  ze_context_handle_t context = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(drivers[0], &contextDesc, &context));
+  EXPECT_EQ(1u, prologueCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelDisableTracingLayer());
+  }
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(drivers[0], &contextDesc, &context));
+  EXPECT_EQ(1u, prologueCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, false));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(tracer));
+}
+
+struct TracerCallbackCounts {
+  std::atomic<uint64_t> prologues{0};
+  std::atomic<uint64_t> epilogues{0};
+  std::atomic<uint64_t> unpaired{0};
+};
+
+TEST(
+    LoaderTracingLayer,
+    GivenTracersToggledWhileManyThreadsCallApisThenProloguesAndEpiloguesAreCalledInPairs) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  uint32_t driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, nullptr));
+  EXPECT_GT(driverCount, 0);
+  std::vector<ze_driver_handle_t> drivers(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, drivers.data()));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelEnableTracingLayer());
+
+  std::atomic<bool> stop{false};
+  std::atomic<uint32_t> failures{0};
+  std::vector<std::thread> callers;
+  for (int i = 0; i < 8; ++i) {
+    callers.emplace_back([&]() {
+      while (!stop) {
+        ze_api_version_t version;
+        if (ZE_RESULT_SUCCESS != zeDriverGetApiVersion(drivers[0], &version))
+          ++failures;
+      }
+    });
+  }
+
+  std::vector<std::thread> togglers;
+  for (int i = 0; i < 2; ++i) {
+    togglers.emplace_back([&]() {
+      for (int iteration = 0; iteration < 100; ++iteration) {
+        TracerCallbackCounts counts;
+        zel_tracer_desc_t tracerDesc = {ZEL_STRUCTURE_TYPE_TRACER_DESC, nullptr, &counts};
+        zel_tracer_handle_t tracer = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerCreate(&tracerDesc, &tracer));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDriverGetApiVersionRegisterCallback(tracer, ZEL_REGISTER_PROLOGUE,
+            [](ze_driver_get_api_version_params_t *, ze_result_t, void *pTracerUserData, void **ppTracerInstanceUserData) {
+              ++static_cast<TracerCallbackCounts *>(pTracerUserData)->prologues;
+              *ppTracerInstanceUserData = pTracerUserData;
+            }));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDriverGetApiVersionRegisterCallback(tracer, ZEL_REGISTER_EPILOGUE,
+            [](ze_driver_get_api_version_params_t *, ze_result_t, void *pTracerUserData, void **ppTracerInstanceUserData) {
+              auto callbackCounts = static_cast<TracerCallbackCounts *>(pTracerUserData);
+              if (*ppTracerInstanceUserData != pTracerUserData)
+                ++callbackCounts->unpaired;
+              ++callbackCounts->epilogues;
+            }));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, true));
+        std::this_thread::yield();
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, false));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(tracer));
+
+        // no callback of a destroyed tracer may still be running
+        EXPECT_EQ(counts.prologues, counts.epilogues);
+        EXPECT_EQ(0u, counts.unpaired);
+      }
+    });
+  }
+  for (auto &toggler : togglers) {
+    toggler.join();
+  }
+  stop = true;
+  for (auto &caller : callers) {
+    caller.join();
+  }
+  EXPECT_EQ(0u, failures);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelDisableTracingLayer());
+}
+
+// Create a tracer counting the prologues and epilogues of zeDriverGetApiVersion.
+zel_tracer_handle_t createApiVersionTracer(TracerCallbackCounts &counts, const void *pNext) {
+  zel_tracer_desc_t tracerDesc = {ZEL_STRUCTURE_TYPE_TRACER_DESC, pNext, &counts};
+  zel_tracer_handle_t tracer = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerCreate(&tracerDesc, &tracer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDriverGetApiVersionRegisterCallback(tracer, ZEL_REGISTER_PROLOGUE,
+      [](ze_driver_get_api_version_params_t *, ze_result_t, void *pTracerUserData, void **) {
+        ++static_cast<TracerCallbackCounts *>(pTracerUserData)->prologues;
+      }));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDriverGetApiVersionRegisterCallback(tracer, ZEL_REGISTER_EPILOGUE,
+      [](ze_driver_get_api_version_params_t *, ze_result_t, void *pTracerUserData, void **) {
+        ++static_cast<TracerCallbackCounts *>(pTracerUserData)->epilogues;
+      }));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, true));
+  return tracer;
+}
+
+// Call zeDriverGetApiVersion on a new thread, which has no sampling state yet.
+void callApiVersionOnNewThread(ze_driver_handle_t driver, uint32_t calls) {
+  std::thread caller([=]() {
+    for (uint32_t i = 0; i < calls; ++i) {
+      ze_api_version_t version;
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetApiVersion(driver, &version));
+    }
+  });
+  caller.join();
+}
+
+TEST(
+    LoaderTracingLayer,
+    GivenTracersSamplingEveryNthCallWhenCallingAnApiThenOnlyTheSampledCallsAreTraced) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  uint32_t driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, nullptr));
+  EXPECT_GT(driverCount, 0);
+  std::vector<ze_driver_handle_t> drivers(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, drivers.data()));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelEnableTracingLayer());
+
+  zel_tracer_sampling_desc_t sampling = {ZEL_STRUCTURE_TYPE_TRACER_SAMPLING_DESC, nullptr,
+                                         ZEL_TRACER_SAMPLING_MODE_EVERY_NTH, 4, 0};
+  TracerCallbackCounts sampledCounts;
+  zel_tracer_handle_t sampledTracer = createApiVersionTracer(sampledCounts, &sampling);
+  TracerCallbackCounts allCounts;
+  zel_tracer_handle_t allTracer = createApiVersionTracer(allCounts, nullptr);
+
+  // calls 1, 5 and 9 are sampled
+  callApiVersionOnNewThread(drivers[0], 10);
+  EXPECT_EQ(3u, sampledCounts.prologues);
+  EXPECT_EQ(3u, sampledCounts.epilogues);
+  EXPECT_EQ(10u, allCounts.prologues);
+  EXPECT_EQ(10u, allCounts.epilogues);
+
+  // with only sampling tracers left, the calls in between skip tracing
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(allTracer, false));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(allTracer));
+  callApiVersionOnNewThread(drivers[0], 10);
+  callApiVersionOnNewThread(drivers[0], 1);
+  EXPECT_EQ(7u, sampledCounts.prologues);
+  EXPECT_EQ(7u, sampledCounts.epilogues);
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(sampledTracer, false));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(sampledTracer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelDisableTracingLayer());
+}
+
+TEST(
+    LoaderTracingLayer,
+    GivenTracerSamplingByTimeWhenCallingAnApiThenOneCallPerIntervalIsTraced) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  uint32_t driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, nullptr));
+  EXPECT_GT(driverCount, 0);
+  std::vector<ze_driver_handle_t> drivers(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, drivers.data()));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelEnableTracingLayer());
+
+  zel_tracer_sampling_desc_t sampling = {ZEL_STRUCTURE_TYPE_TRACER_SAMPLING_DESC, nullptr,
+                                         ZEL_TRACER_SAMPLING_MODE_INTERVAL, 0, 3600000000000ull};
+  TracerCallbackCounts hourlyCounts;
+  zel_tracer_handle_t hourlyTracer = createApiVersionTracer(hourlyCounts, &sampling);
+  sampling.interval = 1000000;
+  TracerCallbackCounts millisecondCounts;
+  zel_tracer_handle_t millisecondTracer = createApiVersionTracer(millisecondCounts, &sampling);
+
+  std::thread caller([&]() {
+    for (int i = 0; i < 3; ++i) {
+      ze_api_version_t version;
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetApiVersion(drivers[0], &version));
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+  });
+  caller.join();
+  // each call after a pause is sampled
+  EXPECT_EQ(1u, hourlyCounts.prologues);
+  EXPECT_EQ(3u, millisecondCounts.prologues);
+  EXPECT_EQ(3u, millisecondCounts.epilogues);
+
+  callApiVersionOnNewThread(drivers[0], 1000);
+  EXPECT_EQ(2u, hourlyCounts.prologues);
+  EXPECT_EQ(2u, hourlyCounts.epilogues);
+  EXPECT_LE(4u, millisecondCounts.prologues);
+  EXPECT_EQ(millisecondCounts.prologues, millisecondCounts.epilogues);
+
+  sampling.count = 0;
+  sampling.mode = ZEL_TRACER_SAMPLING_MODE_EVERY_NTH;
+  zel_tracer_desc_t tracerDesc = {ZEL_STRUCTURE_TYPE_TRACER_DESC, &sampling, &hourlyCounts};
+  zel_tracer_handle_t tracer = nullptr;
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zelTracerCreate(&tracerDesc, &tracer));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(hourlyTracer, false));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(hourlyTracer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(millisecondTracer, false));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(millisecondTracer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelDisableTracingLayer());
+}
+
+TEST(
+    LoaderTracingLayer,
+    GivenTracingLayerEnabledForOneThreadWhenSeveralThreadsCallAnApiThenOnlyThatThreadsCallsAreTraced) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  uint32_t driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, nullptr));
+  EXPECT_GT(driverCount, 0);
+  std::vector<ze_driver_handle_t> drivers(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, drivers.data()));
+
+  TracerCallbackCounts counts;
+  zel_tracer_handle_t tracer = createApiVersionTracer(counts, nullptr);
+
+  std::thread traced([&]() {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelEnableTracingLayerForThread());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelEnableTracingLayerForThread());
+    for (int i = 0; i < 5; ++i) {
+      ze_api_version_t version;
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetApiVersion(drivers[0], &version));
+    }
+    callApiVersionOnNewThread(drivers[0], 5);
+    EXPECT_EQ(5u, counts.prologues);
+
+    // tracing stays enabled until every enable is matched by a disable
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelDisableTracingLayerForThread());
+    ze_api_version_t version;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetApiVersion(drivers[0], &version));
+    EXPECT_EQ(6u, counts.prologues);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelDisableTracingLayerForThread());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetApiVersion(drivers[0], &version));
+    EXPECT_EQ(6u, counts.prologues);
+  });
+  traced.join();
+
+  // a thread exiting with tracing enabled does not trace other threads
+  std::thread exiting([]() { EXPECT_EQ(ZE_RESULT_SUCCESS, zelEnableTracingLayerForThread()); });
+  exiting.join();
+  callApiVersionOnNewThread(drivers[0], 5);
+  EXPECT_EQ(6u, counts.prologues);
+  EXPECT_EQ(6u, counts.epilogues);
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, false));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(tracer));
+}
+
+struct AsyncEpilogueCounts {
+  std::atomic<uint64_t> epilogues{0};
+  std::atomic<uint64_t> onCallingThread{0};
+  std::atomic<uint64_t> wrongArguments{0};
+  std::atomic<bool> blocked{false};
+  std::thread::id callingThread;
+  ze_driver_handle_t driver = nullptr;
+  ze_api_version_t *pVersion = nullptr;
+};
+
+// Create a tracer deferring the epilogues of zeDriverGetApiVersion.
+zel_tracer_handle_t createAsyncApiVersionTracer(AsyncEpilogueCounts &counts) {
+  zel_tracer_async_desc_t async = {ZEL_STRUCTURE_TYPE_TRACER_ASYNC_DESC, nullptr,
+                                   ZEL_TRACER_ASYNC_FLAG_EPILOGUES};
+  zel_tracer_desc_t tracerDesc = {ZEL_STRUCTURE_TYPE_TRACER_DESC, &async, &counts};
+  zel_tracer_handle_t tracer = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerCreate(&tracerDesc, &tracer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDriverGetApiVersionRegisterCallback(tracer, ZEL_REGISTER_PROLOGUE,
+      [](ze_driver_get_api_version_params_t *, ze_result_t, void *pTracerUserData, void **ppTracerInstanceUserData) {
+        *ppTracerInstanceUserData = pTracerUserData;
+      }));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDriverGetApiVersionRegisterCallback(tracer, ZEL_REGISTER_EPILOGUE,
+      [](ze_driver_get_api_version_params_t *params, ze_result_t result, void *pTracerUserData, void **ppTracerInstanceUserData) {
+        auto callbackCounts = static_cast<AsyncEpilogueCounts *>(pTracerUserData);
+        while (callbackCounts->blocked)
+          std::this_thread::yield();
+        if (std::this_thread::get_id() == callbackCounts->callingThread)
+          ++callbackCounts->onCallingThread;
+        if (*params->phDriver != callbackCounts->driver || *params->pversion != callbackCounts->pVersion ||
+            result != ZE_RESULT_SUCCESS || *ppTracerInstanceUserData != pTracerUserData)
+          ++callbackCounts->wrongArguments;
+        ++callbackCounts->epilogues;
+      }));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, true));
+  return tracer;
+}
+
+TEST(
+    LoaderTracingLayer,
+    GivenTracerWithAsyncEpiloguesWhenCallingAnApiThenTheEpiloguesRunOnAnotherThreadWithTheArgumentValues) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  uint32_t driverCount = 1;
+  ze_driver_handle_t driver = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelEnableTracingLayer());
+
+  ze_api_version_t version;
+  AsyncEpilogueCounts counts;
+  counts.callingThread = std::this_thread::get_id();
+  counts.driver = driver;
+  counts.pVersion = &version;
+  zel_tracer_handle_t tracer = createAsyncApiVersionTracer(counts);
+
+  for (int call = 0; call < 100; ++call)
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetApiVersion(driver, &version));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerFlushEpilogues(tracer));
+  EXPECT_EQ(100u, counts.epilogues);
+  EXPECT_EQ(0u, counts.onCallingThread);
+  EXPECT_EQ(0u, counts.wrongArguments);
+  uint64_t dropped = 1;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerGetDroppedEpilogueCount(tracer, &dropped));
+  EXPECT_EQ(0u, dropped);
+
+  // destroying the tracer waits for its deferred epilogues
+  for (int call = 0; call < 100; ++call)
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetApiVersion(driver, &version));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, false));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(tracer));
+  EXPECT_EQ(200u, counts.epilogues);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelDisableTracingLayer());
+}
+
+TEST(
+    LoaderTracingLayer,
+    GivenAsyncEpiloguesWhenTheQueueOfAThreadIsFullThenTheEpiloguesAreDroppedAndCounted) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  uint32_t driverCount = 1;
+  ze_driver_handle_t driver = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelEnableTracingLayer());
+
+  ze_api_version_t version;
+  AsyncEpilogueCounts counts;
+  counts.driver = driver;
+  counts.pVersion = &version;
+  counts.blocked = true;
+  zel_tracer_handle_t tracer = createAsyncApiVersionTracer(counts);
+
+  // the worker is held in the first epilogue while the queue fills up
+  const uint64_t calls = 5000;
+  for (uint64_t call = 0; call < calls; ++call)
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetApiVersion(driver, &version));
+  uint64_t dropped = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerGetDroppedEpilogueCount(tracer, &dropped));
+  EXPECT_GT(dropped, 0u);
+
+  counts.blocked = false;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerFlushEpilogues(tracer));
+  EXPECT_EQ(calls, counts.epilogues + dropped);
+  EXPECT_EQ(0u, counts.wrongArguments);
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, false));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(tracer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelDisableTracingLayer());
+}
+
+TEST(
+    LoaderTracingLayer,
+    GivenAsyncEpiloguesWhenTheOutputVariableIsOverwrittenBeforeTheEpilogueRunsThenTheEpilogueSeesTheCreatedHandle) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  uint32_t driverCount = 1;
+  ze_driver_handle_t driver = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelEnableTracingLayer());
+
+  struct {
+    std::atomic<bool> blocked{true};
+    ze_context_handle_t created = nullptr;
+    ze_context_handle_t seen = nullptr;
+  } state;
+  zel_tracer_async_desc_t async = {ZEL_STRUCTURE_TYPE_TRACER_ASYNC_DESC, nullptr,
+                                   ZEL_TRACER_ASYNC_FLAG_EPILOGUES};
+  zel_tracer_desc_t tracerDesc = {ZEL_STRUCTURE_TYPE_TRACER_DESC, &async, &state};
+  zel_tracer_handle_t tracer = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerCreate(&tracerDesc, &tracer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerContextCreateRegisterCallback(tracer, ZEL_REGISTER_EPILOGUE,
+      [](ze_context_create_params_t *params, ze_result_t, void *pTracerUserData, void **) {
+        auto callbackState = static_cast<decltype(state) *>(pTracerUserData);
+        while (callbackState->blocked)
+          std::this_thread::yield();
+        callbackState->seen = **params->pphContext;
+      }));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, true));
+
+  // the epilogue is held until the caller's variable has been reused
+  ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+  ze_context_handle_t context = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &context));
+  state.created = context;
+  context = nullptr;
+  state.blocked = false;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerFlushEpilogues(tracer));
+  EXPECT_NE(nullptr, state.seen);
+  EXPECT_EQ(state.created, state.seen);
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, false));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(tracer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(state.created));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelDisableTracingLayer());
+}
+
+// Get the first power domain of the first sysman device.
+zes_pwr_handle_t getPowerDomain() {
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesInit(0));
+  uint32_t count = 1;
+  zes_driver_handle_t driver = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDriverGet(&count, &driver));
+  zes_device_handle_t device = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceGet(driver, &count, &device));
+  zes_pwr_handle_t power = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceEnumPowerDomains(device, &count, &power));
+  return power;
+}
+
+TEST(
+    LoaderTracingLayer,
+    GivenTracerWithSysmanAndToolsCallbacksWhenCallingThoseApisThenTheCallbacksAreCalled) {
+
+  zes_pwr_handle_t power = getPowerDomain();
+  TracerCallbackCounts counts;
+  zel_tracer_desc_t tracerDesc = {ZEL_STRUCTURE_TYPE_TRACER_DESC, nullptr, &counts};
+  zel_tracer_handle_t tracer = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerCreate(&tracerDesc, &tracer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerZesPowerGetEnergyCounterRegisterCallback(tracer, ZEL_REGISTER_PROLOGUE,
+      [](zes_power_get_energy_counter_params_t *params, ze_result_t, void *pTracerUserData, void **) {
+        auto callbackCounts = static_cast<TracerCallbackCounts *>(pTracerUserData);
+        if (*params->ppEnergy == nullptr)
+          ++callbackCounts->unpaired;
+        ++callbackCounts->prologues;
+      }));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerZetMetricStreamerReadDataRegisterCallback(tracer, ZEL_REGISTER_EPILOGUE,
+      [](zet_metric_streamer_read_data_params_t *, ze_result_t, void *pTracerUserData, void **) {
+        ++static_cast<TracerCallbackCounts *>(pTracerUserData)->epilogues;
+      }));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, true));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelEnableTracingLayer());
+
+  zes_power_energy_counter_t energy = {};
+  size_t rawDataSize = 0;
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesPowerGetEnergyCounter(power, &energy));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetMetricStreamerReadData(nullptr, 1, &rawDataSize, nullptr));
+  }
+  EXPECT_EQ(3u, counts.prologues);
+  EXPECT_EQ(3u, counts.epilogues);
+  EXPECT_EQ(0u, counts.unpaired);
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelDisableTracingLayer());
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zesPowerGetEnergyCounter(power, &energy));
+  EXPECT_EQ(3u, counts.prologues);
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(tracer, false));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(tracer));
+}
+
+// Count the records of an API in a file recorded with ZEL_TRACE_RECORD,
+// collecting the first recorded argument of each.
+uint32_t countApiRecords(const char *path, const std::string &apiName, std::multiset<uint64_t> &firstArgs) {
+  std::ifstream in(path, std::ios::binary);
+  zel_api_record_header_t header;
+  if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)))
+    return 0;
+  EXPECT_EQ(0, memcmp(header.magic, ZEL_API_RECORD_MAGIC, sizeof(header.magic)));
+  EXPECT_EQ(sizeof(zel_api_record_t), header.recordSize);
+
+  uint32_t api = ZEL_API_RECORD_DROPPED;
+  for (uint32_t i = 0; i < header.apiCount; ++i) {
+    zel_api_record_api_desc_t desc;
+    in.read(reinterpret_cast<char *>(&desc), sizeof(desc));
+    size_t size = desc.nameSize + desc.argNamesSize;
+    std::vector<char> names(size + (8 - size % 8) % 8);
+    in.read(names.data(), names.size());
+    if (apiName == std::string(names.data(), desc.nameSize))
+      api = desc.api;
+  }
+
+  uint32_t count = 0;
+  zel_api_record_t record;
+  while (in.read(reinterpret_cast<char *>(&record), sizeof(record)) && record.begin != 0) {
+    if (record.api == api) {
+      EXPECT_LE(record.begin, record.end);
+      EXPECT_EQ(ZE_RESULT_SUCCESS, record.result);
+      firstArgs.insert(record.args[0]);
+      ++count;
+    }
+  }
+  return count;
+}
+
+TEST(
+    LoaderTraceRecord,
+    GivenTraceRecordFileWhenCallingApisThenTheCallsAreRecordedWithTheirHandles) {
+
+  const char *path = getenv("ZEL_TRACE_RECORD");
+  ASSERT_NE(nullptr, path);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  uint32_t driverCount = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, nullptr));
+  EXPECT_GT(driverCount, 0);
+  std::vector<ze_driver_handle_t> drivers(driverCount);
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, drivers.data()));
+
+  std::multiset<uint64_t> contexts;
+  std::thread thread([&]() {
+    for (int i = 0; i < 4; ++i) {
+      ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+      ze_context_handle_t context = nullptr;
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(drivers[0], &contextDesc, &context));
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+      contexts.insert(reinterpret_cast<uintptr_t>(context));
+    }
+  });
+  thread.join();
+
+  // the records are streamed to the file in the background
+  std::multiset<uint64_t> recordedContexts;
+  for (int retry = 0; retry < 500; ++retry) {
+    recordedContexts.clear();
+    if (countApiRecords(path, "zeContextDestroy", recordedContexts) == contexts.size())
+      break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(contexts, recordedContexts);
+}
+
+#if defined(ZE_TRACE_CONVERT_PATH)
+std::string readFile(const std::string &path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+size_t countOccurrences(const std::string &str, const std::string &pattern) {
+  size_t count = 0;
+  for (size_t pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1))
+    ++count;
+  return count;
+}
+
+TEST(
+    LoaderTraceRecord,
+    GivenRecordedAppendsWaitingOnAnEventWhenConvertingTheTraceThenTheWaitsAreLinkedToTheSignalingAppend) {
+
+  const char *path = getenv("ZEL_TRACE_RECORD");
+  ASSERT_NE(nullptr, path);
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, 0, 1};
+  ze_event_pool_handle_t pool = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolCreate(context, &poolDesc, 1, &device, &pool));
+  ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, 0, 0, 0};
+  ze_event_handle_t event = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventCreate(pool, &eventDesc, &event));
+  ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC, nullptr, 0, 0};
+  ze_command_list_handle_t list = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &listDesc, &list));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendBarrier(list, event, 0, nullptr));
+  std::thread thread([&]() {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendWaitOnEvents(list, 1, &event));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendBarrier(list, nullptr, 1, &event));
+  });
+  thread.join();
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(list));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventDestroy(event));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolDestroy(pool));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+
+  std::multiset<uint64_t> lists;
+  for (int retry = 0; retry < 500 && countApiRecords(path, "zeCommandListDestroy", lists) == 0; ++retry) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  std::string json = std::string(path) + ".json";
+  std::string command = std::string("\"") + ZE_TRACE_CONVERT_PATH + "\" \"" + path + "\" \"" + json + "\"";
+  ASSERT_EQ(0, std::system(command.c_str()));
+  std::string trace = readFile(json);
+  EXPECT_EQ(1u, countOccurrences(trace, "\"name\":\"zeCommandListAppendWaitOnEvents\""));
+  EXPECT_EQ(2u, countOccurrences(trace, "\"ph\":\"s\""));
+  EXPECT_EQ(2u, countOccurrences(trace, "\"ph\":\"f\""));
+  EXPECT_LE(2u, countOccurrences(trace, "\"name\":\"thread_name\""));
+
+  std::string perfetto = std::string(path) + ".pftrace";
+  command = std::string("\"") + ZE_TRACE_CONVERT_PATH + "\" \"" + path + "\" \"" + perfetto + "\"";
+  ASSERT_EQ(0, std::system(command.c_str()));
+  EXPECT_EQ(1u, countOccurrences(readFile(perfetto), "zeCommandListAppendWaitOnEvents"));
+}
+#endif
+
+const zel_api_stats_t *findApiStats(const std::vector<zel_api_stats_t> &stats, const std::string &name) {
+  for (auto &api : stats) {
+    if (name == api.name)
+      return &api;
+  }
+  return nullptr;
+}
+
+TEST(
+    LoaderApiStats,
+    GivenApiStatsEnabledWhenCallingApisOnSeveralThreadsThenTheCallsOfEachApiAreMerged) {
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+  uint32_t driverCount = 1;
+  ze_driver_handle_t driver = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracingResetApiStats());
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&]() {
+      ze_api_version_t version;
+      for (int call = 0; call < 250; ++call)
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetApiVersion(driver, &version));
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  ze_driver_properties_t properties = {ZE_STRUCTURE_TYPE_DRIVER_PROPERTIES};
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetProperties(driver, &properties));
+
+  uint32_t count = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracingGetApiStats(&count, nullptr));
+  EXPECT_EQ(2u, count);
+  std::vector<zel_api_stats_t> stats(count, {ZEL_STRUCTURE_TYPE_API_STATS});
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracingGetApiStats(&count, stats.data()));
+  const zel_api_stats_t *apiVersion = findApiStats(stats, "zeDriverGetApiVersion");
+  ASSERT_NE(nullptr, apiVersion);
+  EXPECT_EQ(1000u, apiVersion->callCount);
+  EXPECT_LE(apiVersion->minTime, apiVersion->p50Time);
+  EXPECT_LE(apiVersion->p50Time, apiVersion->p90Time);
+  EXPECT_LE(apiVersion->p90Time, apiVersion->p99Time);
+  EXPECT_LE(apiVersion->p99Time, apiVersion->p999Time);
+  EXPECT_LE(apiVersion->p999Time, apiVersion->maxTime);
+  EXPECT_LE(apiVersion->maxTime, apiVersion->totalTime);
+  ASSERT_NE(nullptr, findApiStats(stats, "zeDriverGetProperties"));
+  EXPECT_EQ(1u, findApiStats(stats, "zeDriverGetProperties")->callCount);
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracingResetApiStats());
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetProperties(driver, &properties));
+  count = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracingGetApiStats(&count, nullptr));
+  EXPECT_EQ(1u, count);
+}
+
+TEST(
+    LoaderApiStats,
+    GivenApiStatsEnabledWhenCallingSysmanAndToolsApisThenTheirCallsAreCounted) {
+
+  zes_pwr_handle_t power = getPowerDomain();
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracingResetApiStats());
+
+  zes_power_energy_counter_t energy = {};
+  for (int call = 0; call < 10; ++call)
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesPowerGetEnergyCounter(power, &energy));
+  size_t rawDataSize = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zetMetricStreamerReadData(nullptr, 1, &rawDataSize, nullptr));
+
+  uint32_t count = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracingGetApiStats(&count, nullptr));
+  EXPECT_EQ(2u, count);
+  std::vector<zel_api_stats_t> stats(count, {ZEL_STRUCTURE_TYPE_API_STATS});
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracingGetApiStats(&count, stats.data()));
+  ASSERT_NE(nullptr, findApiStats(stats, "zesPowerGetEnergyCounter"));
+  EXPECT_EQ(10u, findApiStats(stats, "zesPowerGetEnergyCounter")->callCount);
+  ASSERT_NE(nullptr, findApiStats(stats, "zetMetricStreamerReadData"));
+  EXPECT_EQ(1u, findApiStats(stats, "zetMetricStreamerReadData")->callCount);
+}
+
+TEST(
+    LoaderHandleLifetime,
+    GivenHandleLifetimeValidationWhenThreadsCreateUseAndDestroyEventsConcurrentlyThenEveryCallSucceeds) {
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+  eventPoolDesc.count = 1;
+  ze_event_pool_handle_t eventPool = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolCreate(context, &eventPoolDesc, 1, &device, &eventPool));
+
+  std::atomic<uint32_t> failures{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&]() {
+      ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+      for (int i = 0; i < 1000; ++i) {
+        ze_event_handle_t event = nullptr;
+        if (zeEventCreate(eventPool, &eventDesc, &event) != ZE_RESULT_SUCCESS ||
+            zeEventHostSynchronize(event, 0) != ZE_RESULT_SUCCESS ||
+            zeEventDestroy(event) != ZE_RESULT_SUCCESS ||
+            zeEventHostSynchronize(event, 0) != ZE_RESULT_ERROR_INVALID_NULL_HANDLE) {
+          ++failures;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  EXPECT_EQ(0u, failures.load());
+
+  // the pool has no events left, so it can be destroyed
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolDestroy(eventPool));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+TEST(
+    LoaderHandleLifetime,
+    GivenHandleLifetimeValidationWhenManyEventsAreCreatedAndEveryOtherIsDestroyedThenOnlyTheRemainingEventsAreValid) {
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+  eventPoolDesc.count = 1;
+  ze_event_pool_handle_t eventPool = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolCreate(context, &eventPoolDesc, 1, &device, &eventPool));
+
+  // enough events for the tracked handles to outgrow their first tables
+  std::vector<ze_event_handle_t> events(5000);
+  ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+  for (auto &event : events)
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventCreate(eventPool, &eventDesc, &event));
+  for (size_t i = 0; i < events.size(); i += 2)
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventDestroy(events[i]));
+  EXPECT_EQ(ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE, zeEventPoolDestroy(eventPool));
+
+  uint32_t failures = 0;
+  for (size_t i = 0; i < events.size(); ++i) {
+    ze_result_t expected = (i % 2) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    if (zeEventHostSynchronize(events[i], 0) != expected)
+      ++failures;
+  }
+  EXPECT_EQ(0u, failures);
+
+  for (size_t i = 1; i < events.size(); i += 2)
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventDestroy(events[i]));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolDestroy(eventPool));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+TEST(
+    LoaderHandleLifetime,
+    GivenHandleLifetimeValidationWhenAppendingToAClosedCommandListThenTheCallIsRejectedUntilItIsReset) {
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_command_list_desc_t commandListDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+  ze_command_list_handle_t commandList = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &commandListDesc, &commandList));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendBarrier(commandList, nullptr, 0, nullptr));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListClose(commandList));
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zeCommandListAppendBarrier(commandList, nullptr, 0, nullptr));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListReset(commandList));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendBarrier(commandList, nullptr, 0, nullptr));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+TEST(
+    LoaderThreadingValidation,
+    GivenThreadingValidationWhenAThreadAppendsToACommandListAnotherThreadIsSynchronizingThenTheViolationIsLogged) {
+
+  // the null driver creates this file once it is synchronizing, and keeps
+  // synchronizing until the file is removed
+  const char *signal = getenv("ZEL_TEST_NULL_DRIVER_HOST_SYNCHRONIZE_SIGNAL_FILE");
+  ASSERT_NE(nullptr, signal);
+  std::remove(signal);
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_command_list_desc_t commandListDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+  ze_command_list_handle_t commandList = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &commandListDesc, &commandList));
+
+  std::ostringstream synchronizingThread;
+  std::thread synchronizer([&]() {
+    synchronizingThread << std::this_thread::get_id();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListHostSynchronize(commandList, UINT64_MAX));
+  });
+  while (!std::ifstream(signal).good())
+    std::this_thread::yield();
+
+  testing::internal::CaptureStderr();
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendBarrier(commandList, nullptr, 0, nullptr));
+  std::string log = testing::internal::GetCapturedStderr();
+  std::remove(signal);
+  synchronizer.join();
+
+  std::ostringstream appendingThread;
+  appendingThread << std::this_thread::get_id();
+  EXPECT_NE(std::string::npos, log.find("Threading violation"));
+  EXPECT_NE(std::string::npos, log.find("zeCommandListAppendBarrier on thread " + appendingThread.str()));
+  EXPECT_NE(std::string::npos, log.find("zeCommandListHostSynchronize on thread " + synchronizingThread.str()));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+TEST(
+    LoaderThreadingValidation,
+    GivenThreadingValidationWhenThreadsSynchronizeACommandListSimultaneouslyThenNothingIsLogged) {
+
+  const char *signal = getenv("ZEL_TEST_NULL_DRIVER_HOST_SYNCHRONIZE_SIGNAL_FILE");
+  ASSERT_NE(nullptr, signal);
+  std::remove(signal);
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_command_list_desc_t commandListDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+  ze_command_list_handle_t commandList = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &commandListDesc, &commandList));
+
+  testing::internal::CaptureStderr();
+  std::vector<std::thread> synchronizers;
+  for (int i = 0; i < 2; ++i) {
+    synchronizers.emplace_back([&]() {
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListHostSynchronize(commandList, UINT64_MAX));
+    });
+  }
+  // the null driver grows the file by a byte per synchronizing call
+  while (std::ifstream(signal, std::ios::ate).tellg() < 2)
+    std::this_thread::yield();
+  std::remove(signal);
+  for (auto &synchronizer : synchronizers)
+    synchronizer.join();
+  EXPECT_EQ("", testing::internal::GetCapturedStderr());
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+TEST(
+    LoaderThreadingValidation,
+    GivenThreadingValidationWhenThreadsUseACommandListOneAfterAnotherThenNothingIsLogged) {
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_command_list_desc_t commandListDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+  ze_command_list_handle_t commandList = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &commandListDesc, &commandList));
+
+  testing::internal::CaptureStderr();
+  std::thread appender([&]() {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendBarrier(commandList, nullptr, 0, nullptr));
+  });
+  appender.join();
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendBarrier(commandList, nullptr, 0, nullptr));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListClose(commandList));
+  EXPECT_EQ("", testing::internal::GetCapturedStderr());
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+TEST(
+    LoaderMemoryTracker,
+    GivenMemoryTrackerWhenCopyingOrFillingPastTheEndOfAnAllocationThenTheCallIsRejected) {
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_command_list_desc_t commandListDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+  ze_command_list_handle_t commandList = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &commandListDesc, &commandList));
+  ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+  void *device_ptr = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocDevice(context, &deviceDesc, 256, 64, device, &device_ptr));
+  ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+  void *host_ptr = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocHost(context, &hostDesc, 128, 64, &host_ptr));
+  std::vector<char> system(512);
+  char *device_bytes = static_cast<char *>(device_ptr);
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryCopy(commandList, device_ptr, host_ptr, 128, nullptr, 0, nullptr));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryCopy(commandList, device_bytes + 128, host_ptr, 128, nullptr, 0, nullptr));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryCopy(commandList, system.data(), device_ptr, 256, nullptr, 0, nullptr));
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zeCommandListAppendMemoryCopy(commandList, device_bytes + 129, host_ptr, 128, nullptr, 0, nullptr));
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zeCommandListAppendMemoryCopy(commandList, device_ptr, host_ptr, 256, nullptr, 0, nullptr));
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zeCommandListAppendMemoryCopy(commandList, system.data(), device_ptr, 512, nullptr, 0, nullptr));
+
+  uint32_t pattern = 0;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryFill(commandList, device_ptr, &pattern, sizeof(pattern), 256, nullptr, 0, nullptr));
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zeCommandListAppendMemoryFill(commandList, device_ptr, &pattern, sizeof(pattern), 260, nullptr, 0, nullptr));
+
+  // 16 rows of 16 bytes, copied 8 rows at a time
+  ze_copy_region_t region = {0, 0, 0, 16, 8, 1};
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryCopyRegion(commandList, device_ptr, &region, 16, 0, system.data(), &region, 16, 0, nullptr, 0, nullptr));
+  region.originY = 8;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryCopyRegion(commandList, device_ptr, &region, 16, 0, system.data(), &region, 16, 0, nullptr, 0, nullptr));
+  region.originY = 9;
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zeCommandListAppendMemoryCopyRegion(commandList, device_ptr, &region, 16, 0, system.data(), &region, 16, 0, nullptr, 0, nullptr));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, host_ptr));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, device_ptr));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+TEST(
+    LoaderMemoryTracker,
+    GivenMemoryTrackerWhenAnAllocationFailsThenTheOutputPointerIsNotTracked) {
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_command_list_desc_t commandListDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+  ze_command_list_handle_t commandList = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &commandListDesc, &commandList));
+  std::vector<char> source(512);
+  std::vector<char> destination(512);
+
+  // the failing calls leave the stale pointer where the allocation would go
+  ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+  ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+  void *ptr = source.data();
+  EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT, zeMemAllocDevice(context, &deviceDesc, 16, 3, device, &ptr));
+  EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT, zeMemAllocHost(context, &hostDesc, 16, 3, &ptr));
+  EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT, zeMemAllocShared(context, &deviceDesc, &hostDesc, 16, 3, device, &ptr));
+  EXPECT_EQ(static_cast<void *>(source.data()), ptr);
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryCopy(commandList, destination.data(), source.data(), 512, nullptr, 0, nullptr));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+TEST(
+    LoaderMemoryTracker,
+    GivenMemoryTrackerWhenLaunchingAKernelWhosePointerArgumentWasFreedThenTheLaunchIsRejected) {
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_command_list_desc_t commandListDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+  ze_command_list_handle_t commandList = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &commandListDesc, &commandList));
+  static const uint8_t moduleIl[4] = {};
+  ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+  moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+  moduleDesc.inputSize = sizeof(moduleIl);
+  moduleDesc.pInputModule = moduleIl;
+  ze_module_handle_t module = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeModuleCreate(context, device, &moduleDesc, &module, nullptr));
+  ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+  kernelDesc.pKernelName = "test";
+  ze_kernel_handle_t kernel = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeKernelCreate(module, &kernelDesc, &kernel));
+
+  ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+  void *buffer = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocDevice(context, &deviceDesc, 1024, 64, device, &buffer));
+  uint64_t scalar = 7;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeKernelSetArgumentValue(kernel, 0, sizeof(scalar), &scalar));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeKernelSetArgumentValue(kernel, 1, sizeof(buffer), &buffer));
+  ze_group_count_t groupCount = {1, 1, 1};
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendLaunchKernel(commandList, kernel, &groupCount, nullptr, 0, nullptr));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, buffer));
+  EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zeCommandListAppendLaunchKernel(commandList, kernel, &groupCount, nullptr, 0, nullptr));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocDevice(context, &deviceDesc, 1024, 64, device, &buffer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeKernelSetArgumentValue(kernel, 1, sizeof(buffer), &buffer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendLaunchKernel(commandList, kernel, &groupCount, nullptr, 0, nullptr));
+
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, buffer));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeKernelDestroy(kernel));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeModuleDestroy(module));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+TEST(
+    LoaderMemoryTracker,
+    GivenMemoryTrackerWithManyLiveAllocationsWhenCopyingThenEachAllocationIsFoundByAddress) {
+
+  ze_driver_handle_t driver = nullptr;
+  ze_device_handle_t device = nullptr;
+  ze_context_handle_t context = nullptr;
+  createTestContext(driver, device, context);
+  ze_command_list_desc_t commandListDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+  ze_command_list_handle_t commandList = nullptr;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &commandListDesc, &commandList));
+  ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+  std::vector<void *> buffers(100000);
+  for (auto &buffer : buffers) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocHost(context, &hostDesc, 64, 64, &buffer));
+  }
+  for (size_t i = 1; i < buffers.size(); i += 2) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, buffers[i]));
+  }
+
+  testing::internal::CaptureStderr();
+  for (size_t i = 0; i < buffers.size(); i += 2) {
+    char *bytes = static_cast<char *>(buffers[i]);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryCopy(commandList, bytes + 32, bytes, 32, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zeCommandListAppendMemoryCopy(commandList, bytes + 32, bytes, 33, nullptr, 0, nullptr));
+  }
+  std::string log = testing::internal::GetCapturedStderr();
+  EXPECT_EQ(buffers.size() / 2, static_cast<size_t>(std::count(log.begin(), log.end(), '\n')));
+
+  for (size_t i = 0; i < buffers.size(); i += 2) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, buffers[i]));
+  }
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+}
+
+TEST(
+    LoaderDriverManifest,
+    GivenManifestDeclaringGpuDriverWhenCallingZeInitDriversThenDriverIsOnlyReportedForGpu) {
+
+  uint32_t driverCount = 0;
+  ze_init_driver_type_desc_t desc = {ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC};
+  desc.flags = ZE_INIT_DRIVER_TYPE_FLAG_NPU;
+  // the null driver supports both types, so only the manifest can skip it
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&driverCount, nullptr, &desc));
+  EXPECT_EQ(0u, driverCount);
+
+  driverCount = 0;
+  desc.flags = ZE_INIT_DRIVER_TYPE_FLAG_GPU;
+  EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&driverCount, nullptr, &desc));
+  EXPECT_GT(driverCount, 0);
+}
+
 } // namespace